@@ -0,0 +1,5207 @@
+/* Generated by catalogc from data/compliance - do not edit */
+
+#include "compliance.h"
+
+const char compliance_strings[] = {
+    97, 99, 45, 49, 0, 65, 67, 45, 48, 49, 0, 80, 111, 108, 105, 99,
+    121, 32, 97, 110, 100, 32, 80, 114, 111, 99, 101, 100, 117, 114, 101, 115,
+    0, 65, 99, 99, 101, 115, 115, 32, 67, 111, 110, 116, 114, 111, 108, 0,
+    97, 99, 45, 50, 0, 65, 67, 45, 48, 50, 0, 65, 99, 99, 111, 117,
+    110, 116, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 97, 99,
+    45, 50, 46, 49, 0, 65, 67, 45, 48, 50, 40, 48, 49, 41, 0, 65,
+    117, 116, 111, 109, 97, 116, 101, 100, 32, 83, 121, 115, 116, 101, 109, 32,
+    65, 99, 99, 111, 117, 110, 116, 32, 77, 97, 110, 97, 103, 101, 109, 101,
+    110, 116, 0, 97, 99, 45, 50, 46, 50, 0, 65, 67, 45, 48, 50, 40,
+    48, 50, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 84, 101,
+    109, 112, 111, 114, 97, 114, 121, 32, 97, 110, 100, 32, 69, 109, 101, 114,
+    103, 101, 110, 99, 121, 32, 65, 99, 99, 111, 117, 110, 116, 32, 77, 97,
+    110, 97, 103, 101, 109, 101, 110, 116, 0, 97, 99, 45, 50, 46, 51, 0,
+    65, 67, 45, 48, 50, 40, 48, 51, 41, 0, 68, 105, 115, 97, 98, 108,
+    101, 32, 65, 99, 99, 111, 117, 110, 116, 115, 0, 97, 99, 45, 50, 46,
+    52, 0, 65, 67, 45, 48, 50, 40, 48, 52, 41, 0, 65, 117, 116, 111,
+    109, 97, 116, 101, 100, 32, 65, 117, 100, 105, 116, 32, 65, 99, 116, 105,
+    111, 110, 115, 0, 97, 99, 45, 50, 46, 53, 0, 65, 67, 45, 48, 50,
+    40, 48, 53, 41, 0, 73, 110, 97, 99, 116, 105, 118, 105, 116, 121, 32,
+    76, 111, 103, 111, 117, 116, 0, 97, 99, 45, 50, 46, 54, 0, 65, 67,
+    45, 48, 50, 40, 48, 54, 41, 0, 68, 121, 110, 97, 109, 105, 99, 32,
+    80, 114, 105, 118, 105, 108, 101, 103, 101, 32, 77, 97, 110, 97, 103, 101,
+    109, 101, 110, 116, 0, 97, 99, 45, 50, 46, 55, 0, 65, 67, 45, 48,
+    50, 40, 48, 55, 41, 0, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100,
+    32, 85, 115, 101, 114, 32, 65, 99, 99, 111, 117, 110, 116, 115, 0, 97,
+    99, 45, 50, 46, 56, 0, 65, 67, 45, 48, 50, 40, 48, 56, 41, 0,
+    68, 121, 110, 97, 109, 105, 99, 32, 65, 99, 99, 111, 117, 110, 116, 32,
+    77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 97, 99, 45, 50, 46,
+    57, 0, 65, 67, 45, 48, 50, 40, 48, 57, 41, 0, 82, 101, 115, 116,
+    114, 105, 99, 116, 105, 111, 110, 115, 32, 111, 110, 32, 85, 115, 101, 32,
+    111, 102, 32, 83, 104, 97, 114, 101, 100, 32, 97, 110, 100, 32, 71, 114,
+    111, 117, 112, 32, 65, 99, 99, 111, 117, 110, 116, 115, 0, 97, 99, 45,
+    50, 46, 49, 48, 0, 65, 67, 45, 48, 50, 40, 49, 48, 41, 0, 83,
+    104, 97, 114, 101, 100, 32, 97, 110, 100, 32, 71, 114, 111, 117, 112, 32,
+    65, 99, 99, 111, 117, 110, 116, 32, 67, 114, 101, 100, 101, 110, 116, 105,
+    97, 108, 32, 67, 104, 97, 110, 103, 101, 0, 97, 99, 45, 50, 46, 49,
+    49, 0, 65, 67, 45, 48, 50, 40, 49, 49, 41, 0, 85, 115, 97, 103,
+    101, 32, 67, 111, 110, 100, 105, 116, 105, 111, 110, 115, 0, 97, 99, 45,
+    50, 46, 49, 50, 0, 65, 67, 45, 48, 50, 40, 49, 50, 41, 0, 65,
+    99, 99, 111, 117, 110, 116, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110,
+    103, 32, 102, 111, 114, 32, 65, 116, 121, 112, 105, 99, 97, 108, 32, 85,
+    115, 97, 103, 101, 0, 97, 99, 45, 50, 46, 49, 51, 0, 65, 67, 45,
+    48, 50, 40, 49, 51, 41, 0, 68, 105, 115, 97, 98, 108, 101, 32, 65,
+    99, 99, 111, 117, 110, 116, 115, 32, 102, 111, 114, 32, 72, 105, 103, 104,
+    45, 114, 105, 115, 107, 32, 73, 110, 100, 105, 118, 105, 100, 117, 97, 108,
+    115, 0, 97, 99, 45, 51, 0, 65, 67, 45, 48, 51, 0, 65, 99, 99,
+    101, 115, 115, 32, 69, 110, 102, 111, 114, 99, 101, 109, 101, 110, 116, 0,
+    97, 99, 45, 51, 46, 49, 0, 65, 67, 45, 48, 51, 40, 48, 49, 41,
+    0, 82, 101, 115, 116, 114, 105, 99, 116, 101, 100, 32, 65, 99, 99, 101,
+    115, 115, 32, 116, 111, 32, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100,
+    32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 0, 97, 99, 45, 51, 46,
+    50, 0, 65, 67, 45, 48, 51, 40, 48, 50, 41, 0, 68, 117, 97, 108,
+    32, 65, 117, 116, 104, 111, 114, 105, 122, 97, 116, 105, 111, 110, 0, 97,
+    99, 45, 51, 46, 51, 0, 65, 67, 45, 48, 51, 40, 48, 51, 41, 0,
+    77, 97, 110, 100, 97, 116, 111, 114, 121, 32, 65, 99, 99, 101, 115, 115,
+    32, 67, 111, 110, 116, 114, 111, 108, 0, 97, 99, 45, 51, 46, 52, 0,
+    65, 67, 45, 48, 51, 40, 48, 52, 41, 0, 68, 105, 115, 99, 114, 101,
+    116, 105, 111, 110, 97, 114, 121, 32, 65, 99, 99, 101, 115, 115, 32, 67,
+    111, 110, 116, 114, 111, 108, 0, 97, 99, 45, 51, 46, 53, 0, 65, 67,
+    45, 48, 51, 40, 48, 53, 41, 0, 83, 101, 99, 117, 114, 105, 116, 121,
+    45, 114, 101, 108, 101, 118, 97, 110, 116, 32, 73, 110, 102, 111, 114, 109,
+    97, 116, 105, 111, 110, 0, 97, 99, 45, 51, 46, 54, 0, 65, 67, 45,
+    48, 51, 40, 48, 54, 41, 0, 80, 114, 111, 116, 101, 99, 116, 105, 111,
+    110, 32, 111, 102, 32, 85, 115, 101, 114, 32, 97, 110, 100, 32, 83, 121,
+    115, 116, 101, 109, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110,
+    0, 97, 99, 45, 51, 46, 55, 0, 65, 67, 45, 48, 51, 40, 48, 55,
+    41, 0, 82, 111, 108, 101, 45, 98, 97, 115, 101, 100, 32, 65, 99, 99,
+    101, 115, 115, 32, 67, 111, 110, 116, 114, 111, 108, 0, 97, 99, 45, 51,
+    46, 56, 0, 65, 67, 45, 48, 51, 40, 48, 56, 41, 0, 82, 101, 118,
+    111, 99, 97, 116, 105, 111, 110, 32, 111, 102, 32, 65, 99, 99, 101, 115,
+    115, 32, 65, 117, 116, 104, 111, 114, 105, 122, 97, 116, 105, 111, 110, 115,
+    0, 97, 99, 45, 51, 46, 57, 0, 65, 67, 45, 48, 51, 40, 48, 57,
+    41, 0, 67, 111, 110, 116, 114, 111, 108, 108, 101, 100, 32, 82, 101, 108,
+    101, 97, 115, 101, 0, 97, 99, 45, 51, 46, 49, 48, 0, 65, 67, 45,
+    48, 51, 40, 49, 48, 41, 0, 65, 117, 100, 105, 116, 101, 100, 32, 79,
+    118, 101, 114, 114, 105, 100, 101, 32, 111, 102, 32, 65, 99, 99, 101, 115,
+    115, 32, 67, 111, 110, 116, 114, 111, 108, 32, 77, 101, 99, 104, 97, 110,
+    105, 115, 109, 115, 0, 97, 99, 45, 51, 46, 49, 49, 0, 65, 67, 45,
+    48, 51, 40, 49, 49, 41, 0, 82, 101, 115, 116, 114, 105, 99, 116, 32,
+    65, 99, 99, 101, 115, 115, 32, 116, 111, 32, 83, 112, 101, 99, 105, 102,
+    105, 99, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 84,
+    121, 112, 101, 115, 0, 97, 99, 45, 51, 46, 49, 50, 0, 65, 67, 45,
+    48, 51, 40, 49, 50, 41, 0, 65, 115, 115, 101, 114, 116, 32, 97, 110,
+    100, 32, 69, 110, 102, 111, 114, 99, 101, 32, 65, 112, 112, 108, 105, 99,
+    97, 116, 105, 111, 110, 32, 65, 99, 99, 101, 115, 115, 0, 97, 99, 45,
+    51, 46, 49, 51, 0, 65, 67, 45, 48, 51, 40, 49, 51, 41, 0, 65,
+    116, 116, 114, 105, 98, 117, 116, 101, 45, 98, 97, 115, 101, 100, 32, 65,
+    99, 99, 101, 115, 115, 32, 67, 111, 110, 116, 114, 111, 108, 0, 97, 99,
+    45, 51, 46, 49, 52, 0, 65, 67, 45, 48, 51, 40, 49, 52, 41, 0,
+    73, 110, 100, 105, 118, 105, 100, 117, 97, 108, 32, 65, 99, 99, 101, 115,
+    115, 0, 97, 99, 45, 51, 46, 49, 53, 0, 65, 67, 45, 48, 51, 40,
+    49, 53, 41, 0, 68, 105, 115, 99, 114, 101, 116, 105, 111, 110, 97, 114,
+    121, 32, 97, 110, 100, 32, 77, 97, 110, 100, 97, 116, 111, 114, 121, 32,
+    65, 99, 99, 101, 115, 115, 32, 67, 111, 110, 116, 114, 111, 108, 0, 97,
+    99, 45, 52, 0, 65, 67, 45, 48, 52, 0, 73, 110, 102, 111, 114, 109,
+    97, 116, 105, 111, 110, 32, 70, 108, 111, 119, 32, 69, 110, 102, 111, 114,
+    99, 101, 109, 101, 110, 116, 0, 97, 99, 45, 52, 46, 49, 0, 65, 67,
+    45, 48, 52, 40, 48, 49, 41, 0, 79, 98, 106, 101, 99, 116, 32, 83,
+    101, 99, 117, 114, 105, 116, 121, 32, 97, 110, 100, 32, 80, 114, 105, 118,
+    97, 99, 121, 32, 65, 116, 116, 114, 105, 98, 117, 116, 101, 115, 0, 97,
+    99, 45, 52, 46, 50, 0, 65, 67, 45, 48, 52, 40, 48, 50, 41, 0,
+    80, 114, 111, 99, 101, 115, 115, 105, 110, 103, 32, 68, 111, 109, 97, 105,
+    110, 115, 0, 97, 99, 45, 52, 46, 51, 0, 65, 67, 45, 48, 52, 40,
+    48, 51, 41, 0, 68, 121, 110, 97, 109, 105, 99, 32, 73, 110, 102, 111,
+    114, 109, 97, 116, 105, 111, 110, 32, 70, 108, 111, 119, 32, 67, 111, 110,
+    116, 114, 111, 108, 0, 97, 99, 45, 52, 46, 52, 0, 65, 67, 45, 48,
+    52, 40, 48, 52, 41, 0, 70, 108, 111, 119, 32, 67, 111, 110, 116, 114,
+    111, 108, 32, 111, 102, 32, 69, 110, 99, 114, 121, 112, 116, 101, 100, 32,
+    73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 97, 99, 45, 52,
+    46, 53, 0, 65, 67, 45, 48, 52, 40, 48, 53, 41, 0, 69, 109, 98,
+    101, 100, 100, 101, 100, 32, 68, 97, 116, 97, 32, 84, 121, 112, 101, 115,
+    0, 97, 99, 45, 52, 46, 54, 0, 65, 67, 45, 48, 52, 40, 48, 54,
+    41, 0, 77, 101, 116, 97, 100, 97, 116, 97, 0, 97, 99, 45, 52, 46,
+    55, 0, 65, 67, 45, 48, 52, 40, 48, 55, 41, 0, 79, 110, 101, 45,
+    119, 97, 121, 32, 70, 108, 111, 119, 32, 77, 101, 99, 104, 97, 110, 105,
+    115, 109, 115, 0, 97, 99, 45, 52, 46, 56, 0, 65, 67, 45, 48, 52,
+    40, 48, 56, 41, 0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 97, 110,
+    100, 32, 80, 114, 105, 118, 97, 99, 121, 32, 80, 111, 108, 105, 99, 121,
+    32, 70, 105, 108, 116, 101, 114, 115, 0, 97, 99, 45, 52, 46, 57, 0,
+    65, 67, 45, 48, 52, 40, 48, 57, 41, 0, 72, 117, 109, 97, 110, 32,
+    82, 101, 118, 105, 101, 119, 115, 0, 97, 99, 45, 52, 46, 49, 48, 0,
+    65, 67, 45, 48, 52, 40, 49, 48, 41, 0, 69, 110, 97, 98, 108, 101,
+    32, 97, 110, 100, 32, 68, 105, 115, 97, 98, 108, 101, 32, 83, 101, 99,
+    117, 114, 105, 116, 121, 32, 111, 114, 32, 80, 114, 105, 118, 97, 99, 121,
+    32, 80, 111, 108, 105, 99, 121, 32, 70, 105, 108, 116, 101, 114, 115, 0,
+    97, 99, 45, 52, 46, 49, 49, 0, 65, 67, 45, 48, 52, 40, 49, 49,
+    41, 0, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 32,
+    111, 102, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 111, 114, 32, 80,
+    114, 105, 118, 97, 99, 121, 32, 80, 111, 108, 105, 99, 121, 32, 70, 105,
+    108, 116, 101, 114, 115, 0, 97, 99, 45, 52, 46, 49, 50, 0, 65, 67,
+    45, 48, 52, 40, 49, 50, 41, 0, 68, 97, 116, 97, 32, 84, 121, 112,
+    101, 32, 73, 100, 101, 110, 116, 105, 102, 105, 101, 114, 115, 0, 97, 99,
+    45, 52, 46, 49, 51, 0, 65, 67, 45, 48, 52, 40, 49, 51, 41, 0,
+    68, 101, 99, 111, 109, 112, 111, 115, 105, 116, 105, 111, 110, 32, 105, 110,
+    116, 111, 32, 80, 111, 108, 105, 99, 121, 45, 114, 101, 108, 101, 118, 97,
+    110, 116, 32, 83, 117, 98, 99, 111, 109, 112, 111, 110, 101, 110, 116, 115,
+    0, 97, 99, 45, 52, 46, 49, 52, 0, 65, 67, 45, 48, 52, 40, 49,
+    52, 41, 0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 111, 114, 32, 80,
+    114, 105, 118, 97, 99, 121, 32, 80, 111, 108, 105, 99, 121, 32, 70, 105,
+    108, 116, 101, 114, 32, 67, 111, 110, 115, 116, 114, 97, 105, 110, 116, 115,
+    0, 97, 99, 45, 52, 46, 49, 53, 0, 65, 67, 45, 48, 52, 40, 49,
+    53, 41, 0, 68, 101, 116, 101, 99, 116, 105, 111, 110, 32, 111, 102, 32,
+    85, 110, 115, 97, 110, 99, 116, 105, 111, 110, 101, 100, 32, 73, 110, 102,
+    111, 114, 109, 97, 116, 105, 111, 110, 0, 97, 99, 45, 52, 46, 49, 54,
+    0, 65, 67, 45, 48, 52, 40, 49, 54, 41, 0, 73, 110, 102, 111, 114,
+    109, 97, 116, 105, 111, 110, 32, 84, 114, 97, 110, 115, 102, 101, 114, 115,
+    32, 111, 110, 32, 73, 110, 116, 101, 114, 99, 111, 110, 110, 101, 99, 116,
+    101, 100, 32, 83, 121, 115, 116, 101, 109, 115, 0, 97, 99, 45, 52, 46,
+    49, 55, 0, 65, 67, 45, 48, 52, 40, 49, 55, 41, 0, 68, 111, 109,
+    97, 105, 110, 32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105,
+    111, 110, 0, 97, 99, 45, 52, 46, 49, 56, 0, 65, 67, 45, 48, 52,
+    40, 49, 56, 41, 0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 65, 116,
+    116, 114, 105, 98, 117, 116, 101, 32, 66, 105, 110, 100, 105, 110, 103, 0,
+    97, 99, 45, 52, 46, 49, 57, 0, 65, 67, 45, 48, 52, 40, 49, 57,
+    41, 0, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110, 32, 111, 102, 32,
+    77, 101, 116, 97, 100, 97, 116, 97, 0, 97, 99, 45, 52, 46, 50, 48,
+    0, 65, 67, 45, 48, 52, 40, 50, 48, 41, 0, 65, 112, 112, 114, 111,
+    118, 101, 100, 32, 83, 111, 108, 117, 116, 105, 111, 110, 115, 0, 97, 99,
+    45, 52, 46, 50, 49, 0, 65, 67, 45, 48, 52, 40, 50, 49, 41, 0,
+    80, 104, 121, 115, 105, 99, 97, 108, 32, 111, 114, 32, 76, 111, 103, 105,
+    99, 97, 108, 32, 83, 101, 112, 97, 114, 97, 116, 105, 111, 110, 32, 111,
+    102, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 70, 108,
+    111, 119, 115, 0, 97, 99, 45, 52, 46, 50, 50, 0, 65, 67, 45, 48,
+    52, 40, 50, 50, 41, 0, 65, 99, 99, 101, 115, 115, 32, 79, 110, 108,
+    121, 0, 97, 99, 45, 52, 46, 50, 51, 0, 65, 67, 45, 48, 52, 40,
+    50, 51, 41, 0, 77, 111, 100, 105, 102, 121, 32, 78, 111, 110, 45, 114,
+    101, 108, 101, 97, 115, 97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109,
+    97, 116, 105, 111, 110, 0, 97, 99, 45, 52, 46, 50, 52, 0, 65, 67,
+    45, 48, 52, 40, 50, 52, 41, 0, 73, 110, 116, 101, 114, 110, 97, 108,
+    32, 78, 111, 114, 109, 97, 108, 105, 122, 101, 100, 32, 70, 111, 114, 109,
+    97, 116, 0, 97, 99, 45, 52, 46, 50, 53, 0, 65, 67, 45, 48, 52,
+    40, 50, 53, 41, 0, 68, 97, 116, 97, 32, 83, 97, 110, 105, 116, 105,
+    122, 97, 116, 105, 111, 110, 0, 97, 99, 45, 52, 46, 50, 54, 0, 65,
+    67, 45, 48, 52, 40, 50, 54, 41, 0, 65, 117, 100, 105, 116, 32, 70,
+    105, 108, 116, 101, 114, 105, 110, 103, 32, 65, 99, 116, 105, 111, 110, 115,
+    0, 97, 99, 45, 52, 46, 50, 55, 0, 65, 67, 45, 48, 52, 40, 50,
+    55, 41, 0, 82, 101, 100, 117, 110, 100, 97, 110, 116, 47, 73, 110, 100,
+    101, 112, 101, 110, 100, 101, 110, 116, 32, 70, 105, 108, 116, 101, 114, 105,
+    110, 103, 32, 77, 101, 99, 104, 97, 110, 105, 115, 109, 115, 0, 97, 99,
+    45, 52, 46, 50, 56, 0, 65, 67, 45, 48, 52, 40, 50, 56, 41, 0,
+    76, 105, 110, 101, 97, 114, 32, 70, 105, 108, 116, 101, 114, 32, 80, 105,
+    112, 101, 108, 105, 110, 101, 115, 0, 97, 99, 45, 52, 46, 50, 57, 0,
+    65, 67, 45, 48, 52, 40, 50, 57, 41, 0, 70, 105, 108, 116, 101, 114,
+    32, 79, 114, 99, 104, 101, 115, 116, 114, 97, 116, 105, 111, 110, 32, 69,
+    110, 103, 105, 110, 101, 115, 0, 97, 99, 45, 52, 46, 51, 48, 0, 65,
+    67, 45, 48, 52, 40, 51, 48, 41, 0, 70, 105, 108, 116, 101, 114, 32,
+    77, 101, 99, 104, 97, 110, 105, 115, 109, 115, 32, 85, 115, 105, 110, 103,
+    32, 77, 117, 108, 116, 105, 112, 108, 101, 32, 80, 114, 111, 99, 101, 115,
+    115, 101, 115, 0, 97, 99, 45, 52, 46, 51, 49, 0, 65, 67, 45, 48,
+    52, 40, 51, 49, 41, 0, 70, 97, 105, 108, 101, 100, 32, 67, 111, 110,
+    116, 101, 110, 116, 32, 84, 114, 97, 110, 115, 102, 101, 114, 32, 80, 114,
+    101, 118, 101, 110, 116, 105, 111, 110, 0, 97, 99, 45, 52, 46, 51, 50,
+    0, 65, 67, 45, 48, 52, 40, 51, 50, 41, 0, 80, 114, 111, 99, 101,
+    115, 115, 32, 82, 101, 113, 117, 105, 114, 101, 109, 101, 110, 116, 115, 32,
+    102, 111, 114, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32,
+    84, 114, 97, 110, 115, 102, 101, 114, 0, 97, 99, 45, 53, 0, 65, 67,
+    45, 48, 53, 0, 83, 101, 112, 97, 114, 97, 116, 105, 111, 110, 32, 111,
+    102, 32, 68, 117, 116, 105, 101, 115, 0, 97, 99, 45, 54, 0, 65, 67,
+    45, 48, 54, 0, 76, 101, 97, 115, 116, 32, 80, 114, 105, 118, 105, 108,
+    101, 103, 101, 0, 97, 99, 45, 54, 46, 49, 0, 65, 67, 45, 48, 54,
+    40, 48, 49, 41, 0, 65, 117, 116, 104, 111, 114, 105, 122, 101, 32, 65,
+    99, 99, 101, 115, 115, 32, 116, 111, 32, 83, 101, 99, 117, 114, 105, 116,
+    121, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 0, 97, 99, 45, 54,
+    46, 50, 0, 65, 67, 45, 48, 54, 40, 48, 50, 41, 0, 78, 111, 110,
+    45, 112, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 65, 99, 99, 101,
+    115, 115, 32, 102, 111, 114, 32, 78, 111, 110, 115, 101, 99, 117, 114, 105,
+    116, 121, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 0, 97, 99, 45,
+    54, 46, 51, 0, 65, 67, 45, 48, 54, 40, 48, 51, 41, 0, 78, 101,
+    116, 119, 111, 114, 107, 32, 65, 99, 99, 101, 115, 115, 32, 116, 111, 32,
+    80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 67, 111, 109, 109, 97,
+    110, 100, 115, 0, 97, 99, 45, 54, 46, 52, 0, 65, 67, 45, 48, 54,
+    40, 48, 52, 41, 0, 83, 101, 112, 97, 114, 97, 116, 101, 32, 80, 114,
+    111, 99, 101, 115, 115, 105, 110, 103, 32, 68, 111, 109, 97, 105, 110, 115,
+    0, 97, 99, 45, 54, 46, 53, 0, 65, 67, 45, 48, 54, 40, 48, 53,
+    41, 0, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 65, 99, 99,
+    111, 117, 110, 116, 115, 0, 97, 99, 45, 54, 46, 54, 0, 65, 67, 45,
+    48, 54, 40, 48, 54, 41, 0, 80, 114, 105, 118, 105, 108, 101, 103, 101,
+    100, 32, 65, 99, 99, 101, 115, 115, 32, 98, 121, 32, 78, 111, 110, 45,
+    111, 114, 103, 97, 110, 105, 122, 97, 116, 105, 111, 110, 97, 108, 32, 85,
+    115, 101, 114, 115, 0, 97, 99, 45, 54, 46, 55, 0, 65, 67, 45, 48,
+    54, 40, 48, 55, 41, 0, 82, 101, 118, 105, 101, 119, 32, 111, 102, 32,
+    85, 115, 101, 114, 32, 80, 114, 105, 118, 105, 108, 101, 103, 101, 115, 0,
+    97, 99, 45, 54, 46, 56, 0, 65, 67, 45, 48, 54, 40, 48, 56, 41,
+    0, 80, 114, 105, 118, 105, 108, 101, 103, 101, 32, 76, 101, 118, 101, 108,
+    115, 32, 102, 111, 114, 32, 67, 111, 100, 101, 32, 69, 120, 101, 99, 117,
+    116, 105, 111, 110, 0, 97, 99, 45, 54, 46, 57, 0, 65, 67, 45, 48,
+    54, 40, 48, 57, 41, 0, 76, 111, 103, 32, 85, 115, 101, 32, 111, 102,
+    32, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 70, 117, 110, 99,
+    116, 105, 111, 110, 115, 0, 97, 99, 45, 54, 46, 49, 48, 0, 65, 67,
+    45, 48, 54, 40, 49, 48, 41, 0, 80, 114, 111, 104, 105, 98, 105, 116,
+    32, 78, 111, 110, 45, 112, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32,
+    85, 115, 101, 114, 115, 32, 102, 114, 111, 109, 32, 69, 120, 101, 99, 117,
+    116, 105, 110, 103, 32, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32,
+    70, 117, 110, 99, 116, 105, 111, 110, 115, 0, 97, 99, 45, 55, 0, 65,
+    67, 45, 48, 55, 0, 85, 110, 115, 117, 99, 99, 101, 115, 115, 102, 117,
+    108, 32, 76, 111, 103, 111, 110, 32, 65, 116, 116, 101, 109, 112, 116, 115,
+    0, 97, 99, 45, 55, 46, 49, 0, 65, 67, 45, 48, 55, 40, 48, 49,
+    41, 0, 65, 117, 116, 111, 109, 97, 116, 105, 99, 32, 65, 99, 99, 111,
+    117, 110, 116, 32, 76, 111, 99, 107, 0, 97, 99, 45, 55, 46, 50, 0,
+    65, 67, 45, 48, 55, 40, 48, 50, 41, 0, 80, 117, 114, 103, 101, 32,
+    111, 114, 32, 87, 105, 112, 101, 32, 77, 111, 98, 105, 108, 101, 32, 68,
+    101, 118, 105, 99, 101, 0, 97, 99, 45, 55, 46, 51, 0, 65, 67, 45,
+    48, 55, 40, 48, 51, 41, 0, 66, 105, 111, 109, 101, 116, 114, 105, 99,
+    32, 65, 116, 116, 101, 109, 112, 116, 32, 76, 105, 109, 105, 116, 105, 110,
+    103, 0, 97, 99, 45, 55, 46, 52, 0, 65, 67, 45, 48, 55, 40, 48,
+    52, 41, 0, 85, 115, 101, 32, 111, 102, 32, 65, 108, 116, 101, 114, 110,
+    97, 116, 101, 32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105,
+    111, 110, 32, 70, 97, 99, 116, 111, 114, 0, 97, 99, 45, 56, 0, 65,
+    67, 45, 48, 56, 0, 83, 121, 115, 116, 101, 109, 32, 85, 115, 101, 32,
+    78, 111, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110, 0, 97, 99, 45,
+    57, 0, 65, 67, 45, 48, 57, 0, 80, 114, 101, 118, 105, 111, 117, 115,
+    32, 76, 111, 103, 111, 110, 32, 78, 111, 116, 105, 102, 105, 99, 97, 116,
+    105, 111, 110, 0, 97, 99, 45, 57, 46, 49, 0, 65, 67, 45, 48, 57,
+    40, 48, 49, 41, 0, 85, 110, 115, 117, 99, 99, 101, 115, 115, 102, 117,
+    108, 32, 76, 111, 103, 111, 110, 115, 0, 97, 99, 45, 57, 46, 50, 0,
+    65, 67, 45, 48, 57, 40, 48, 50, 41, 0, 83, 117, 99, 99, 101, 115,
+    115, 102, 117, 108, 32, 97, 110, 100, 32, 85, 110, 115, 117, 99, 99, 101,
+    115, 115, 102, 117, 108, 32, 76, 111, 103, 111, 110, 115, 0, 97, 99, 45,
+    57, 46, 51, 0, 65, 67, 45, 48, 57, 40, 48, 51, 41, 0, 78, 111,
+    116, 105, 102, 105, 99, 97, 116, 105, 111, 110, 32, 111, 102, 32, 65, 99,
+    99, 111, 117, 110, 116, 32, 67, 104, 97, 110, 103, 101, 115, 0, 97, 99,
+    45, 57, 46, 52, 0, 65, 67, 45, 48, 57, 40, 48, 52, 41, 0, 65,
+    100, 100, 105, 116, 105, 111, 110, 97, 108, 32, 76, 111, 103, 111, 110, 32,
+    73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 97, 99, 45, 49,
+    48, 0, 65, 67, 45, 49, 48, 0, 67, 111, 110, 99, 117, 114, 114, 101,
+    110, 116, 32, 83, 101, 115, 115, 105, 111, 110, 32, 67, 111, 110, 116, 114,
+    111, 108, 0, 97, 99, 45, 49, 49, 0, 65, 67, 45, 49, 49, 0, 68,
+    101, 118, 105, 99, 101, 32, 76, 111, 99, 107, 0, 97, 99, 45, 49, 49,
+    46, 49, 0, 65, 67, 45, 49, 49, 40, 48, 49, 41, 0, 80, 97, 116,
+    116, 101, 114, 110, 45, 104, 105, 100, 105, 110, 103, 32, 68, 105, 115, 112,
+    108, 97, 121, 115, 0, 97, 99, 45, 49, 50, 0, 65, 67, 45, 49, 50,
+    0, 83, 101, 115, 115, 105, 111, 110, 32, 84, 101, 114, 109, 105, 110, 97,
+    116, 105, 111, 110, 0, 97, 99, 45, 49, 50, 46, 49, 0, 65, 67, 45,
+    49, 50, 40, 48, 49, 41, 0, 85, 115, 101, 114, 45, 105, 110, 105, 116,
+    105, 97, 116, 101, 100, 32, 76, 111, 103, 111, 117, 116, 115, 0, 97, 99,
+    45, 49, 50, 46, 50, 0, 65, 67, 45, 49, 50, 40, 48, 50, 41, 0,
+    84, 101, 114, 109, 105, 110, 97, 116, 105, 111, 110, 32, 77, 101, 115, 115,
+    97, 103, 101, 0, 97, 99, 45, 49, 50, 46, 51, 0, 65, 67, 45, 49,
+    50, 40, 48, 51, 41, 0, 84, 105, 109, 101, 111, 117, 116, 32, 87, 97,
+    114, 110, 105, 110, 103, 32, 77, 101, 115, 115, 97, 103, 101, 0, 97, 99,
+    45, 49, 51, 0, 65, 67, 45, 49, 51, 0, 83, 117, 112, 101, 114, 118,
+    105, 115, 105, 111, 110, 32, 97, 110, 100, 32, 82, 101, 118, 105, 101, 119,
+    32, -30, -128, -108, 32, 65, 99, 99, 101, 115, 115, 32, 67, 111, 110, 116,
+    114, 111, 108, 0, 97, 99, 45, 49, 52, 0, 65, 67, 45, 49, 52, 0,
+    80, 101, 114, 109, 105, 116, 116, 101, 100, 32, 65, 99, 116, 105, 111, 110,
+    115, 32, 87, 105, 116, 104, 111, 117, 116, 32, 73, 100, 101, 110, 116, 105,
+    102, 105, 99, 97, 116, 105, 111, 110, 32, 111, 114, 32, 65, 117, 116, 104,
+    101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 0, 97, 99, 45, 49, 52,
+    46, 49, 0, 65, 67, 45, 49, 52, 40, 48, 49, 41, 0, 78, 101, 99,
+    101, 115, 115, 97, 114, 121, 32, 85, 115, 101, 115, 0, 97, 99, 45, 49,
+    53, 0, 65, 67, 45, 49, 53, 0, 65, 117, 116, 111, 109, 97, 116, 101,
+    100, 32, 77, 97, 114, 107, 105, 110, 103, 0, 97, 99, 45, 49, 54, 0,
+    65, 67, 45, 49, 54, 0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 97,
+    110, 100, 32, 80, 114, 105, 118, 97, 99, 121, 32, 65, 116, 116, 114, 105,
+    98, 117, 116, 101, 115, 0, 97, 99, 45, 49, 54, 46, 49, 0, 65, 67,
+    45, 49, 54, 40, 48, 49, 41, 0, 68, 121, 110, 97, 109, 105, 99, 32,
+    65, 116, 116, 114, 105, 98, 117, 116, 101, 32, 65, 115, 115, 111, 99, 105,
+    97, 116, 105, 111, 110, 0, 97, 99, 45, 49, 54, 46, 50, 0, 65, 67,
+    45, 49, 54, 40, 48, 50, 41, 0, 65, 116, 116, 114, 105, 98, 117, 116,
+    101, 32, 86, 97, 108, 117, 101, 32, 67, 104, 97, 110, 103, 101, 115, 32,
+    98, 121, 32, 65, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 73, 110,
+    100, 105, 118, 105, 100, 117, 97, 108, 115, 0, 97, 99, 45, 49, 54, 46,
+    51, 0, 65, 67, 45, 49, 54, 40, 48, 51, 41, 0, 77, 97, 105, 110,
+    116, 101, 110, 97, 110, 99, 101, 32, 111, 102, 32, 65, 116, 116, 114, 105,
+    98, 117, 116, 101, 32, 65, 115, 115, 111, 99, 105, 97, 116, 105, 111, 110,
+    115, 32, 98, 121, 32, 83, 121, 115, 116, 101, 109, 0, 97, 99, 45, 49,
+    54, 46, 52, 0, 65, 67, 45, 49, 54, 40, 48, 52, 41, 0, 65, 115,
+    115, 111, 99, 105, 97, 116, 105, 111, 110, 32, 111, 102, 32, 65, 116, 116,
+    114, 105, 98, 117, 116, 101, 115, 32, 98, 121, 32, 65, 117, 116, 104, 111,
+    114, 105, 122, 101, 100, 32, 73, 110, 100, 105, 118, 105, 100, 117, 97, 108,
+    115, 0, 97, 99, 45, 49, 54, 46, 53, 0, 65, 67, 45, 49, 54, 40,
+    48, 53, 41, 0, 65, 116, 116, 114, 105, 98, 117, 116, 101, 32, 68, 105,
+    115, 112, 108, 97, 121, 115, 32, 111, 110, 32, 79, 98, 106, 101, 99, 116,
+    115, 32, 116, 111, 32, 66, 101, 32, 79, 117, 116, 112, 117, 116, 0, 97,
+    99, 45, 49, 54, 46, 54, 0, 65, 67, 45, 49, 54, 40, 48, 54, 41,
+    0, 77, 97, 105, 110, 116, 101, 110, 97, 110, 99, 101, 32, 111, 102, 32,
+    65, 116, 116, 114, 105, 98, 117, 116, 101, 32, 65, 115, 115, 111, 99, 105,
+    97, 116, 105, 111, 110, 0, 97, 99, 45, 49, 54, 46, 55, 0, 65, 67,
+    45, 49, 54, 40, 48, 55, 41, 0, 67, 111, 110, 115, 105, 115, 116, 101,
+    110, 116, 32, 65, 116, 116, 114, 105, 98, 117, 116, 101, 32, 73, 110, 116,
+    101, 114, 112, 114, 101, 116, 97, 116, 105, 111, 110, 0, 97, 99, 45, 49,
+    54, 46, 56, 0, 65, 67, 45, 49, 54, 40, 48, 56, 41, 0, 65, 115,
+    115, 111, 99, 105, 97, 116, 105, 111, 110, 32, 84, 101, 99, 104, 110, 105,
+    113, 117, 101, 115, 32, 97, 110, 100, 32, 84, 101, 99, 104, 110, 111, 108,
+    111, 103, 105, 101, 115, 0, 97, 99, 45, 49, 54, 46, 57, 0, 65, 67,
+    45, 49, 54, 40, 48, 57, 41, 0, 65, 116, 116, 114, 105, 98, 117, 116,
+    101, 32, 82, 101, 97, 115, 115, 105, 103, 110, 109, 101, 110, 116, 32, -30,
+    -128, -108, 32, 82, 101, 103, 114, 97, 100, 105, 110, 103, 32, 77, 101, 99,
+    104, 97, 110, 105, 115, 109, 115, 0, 97, 99, 45, 49, 54, 46, 49, 48,
+    0, 65, 67, 45, 49, 54, 40, 49, 48, 41, 0, 65, 116, 116, 114, 105,
+    98, 117, 116, 101, 32, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105,
+    111, 110, 32, 98, 121, 32, 65, 117, 116, 104, 111, 114, 105, 122, 101, 100,
+    32, 73, 110, 100, 105, 118, 105, 100, 117, 97, 108, 115, 0, 97, 99, 45,
+    49, 55, 0, 65, 67, 45, 49, 55, 0, 82, 101, 109, 111, 116, 101, 32,
+    65, 99, 99, 101, 115, 115, 0, 97, 99, 45, 49, 55, 46, 49, 0, 65,
+    67, 45, 49, 55, 40, 48, 49, 41, 0, 77, 111, 110, 105, 116, 111, 114,
+    105, 110, 103, 32, 97, 110, 100, 32, 67, 111, 110, 116, 114, 111, 108, 0,
+    97, 99, 45, 49, 55, 46, 50, 0, 65, 67, 45, 49, 55, 40, 48, 50,
+    41, 0, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 32, 111, 102, 32,
+    67, 111, 110, 102, 105, 100, 101, 110, 116, 105, 97, 108, 105, 116, 121, 32,
+    97, 110, 100, 32, 73, 110, 116, 101, 103, 114, 105, 116, 121, 32, 85, 115,
+    105, 110, 103, 32, 69, 110, 99, 114, 121, 112, 116, 105, 111, 110, 0, 97,
+    99, 45, 49, 55, 46, 51, 0, 65, 67, 45, 49, 55, 40, 48, 51, 41,
+    0, 77, 97, 110, 97, 103, 101, 100, 32, 65, 99, 99, 101, 115, 115, 32,
+    67, 111, 110, 116, 114, 111, 108, 32, 80, 111, 105, 110, 116, 115, 0, 97,
+    99, 45, 49, 55, 46, 52, 0, 65, 67, 45, 49, 55, 40, 48, 52, 41,
+    0, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 67, 111, 109, 109,
+    97, 110, 100, 115, 32, 97, 110, 100, 32, 65, 99, 99, 101, 115, 115, 0,
+    97, 99, 45, 49, 55, 46, 53, 0, 65, 67, 45, 49, 55, 40, 48, 53,
+    41, 0, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 32, 102, 111, 114,
+    32, 85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 67, 111,
+    110, 110, 101, 99, 116, 105, 111, 110, 115, 0, 97, 99, 45, 49, 55, 46,
+    54, 0, 65, 67, 45, 49, 55, 40, 48, 54, 41, 0, 80, 114, 111, 116,
+    101, 99, 116, 105, 111, 110, 32, 111, 102, 32, 77, 101, 99, 104, 97, 110,
+    105, 115, 109, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0,
+    97, 99, 45, 49, 55, 46, 55, 0, 65, 67, 45, 49, 55, 40, 48, 55,
+    41, 0, 65, 100, 100, 105, 116, 105, 111, 110, 97, 108, 32, 80, 114, 111,
+    116, 101, 99, 116, 105, 111, 110, 32, 102, 111, 114, 32, 83, 101, 99, 117,
+    114, 105, 116, 121, 32, 70, 117, 110, 99, 116, 105, 111, 110, 32, 65, 99,
+    99, 101, 115, 115, 0, 97, 99, 45, 49, 55, 46, 56, 0, 65, 67, 45,
+    49, 55, 40, 48, 56, 41, 0, 68, 105, 115, 97, 98, 108, 101, 32, 78,
+    111, 110, 115, 101, 99, 117, 114, 101, 32, 78, 101, 116, 119, 111, 114, 107,
+    32, 80, 114, 111, 116, 111, 99, 111, 108, 115, 0, 97, 99, 45, 49, 55,
+    46, 57, 0, 65, 67, 45, 49, 55, 40, 48, 57, 41, 0, 68, 105, 115,
+    99, 111, 110, 110, 101, 99, 116, 32, 111, 114, 32, 68, 105, 115, 97, 98,
+    108, 101, 32, 65, 99, 99, 101, 115, 115, 0, 97, 99, 45, 49, 55, 46,
+    49, 48, 0, 65, 67, 45, 49, 55, 40, 49, 48, 41, 0, 65, 117, 116,
+    104, 101, 110, 116, 105, 99, 97, 116, 101, 32, 82, 101, 109, 111, 116, 101,
+    32, 67, 111, 109, 109, 97, 110, 100, 115, 0, 97, 99, 45, 49, 56, 0,
+    65, 67, 45, 49, 56, 0, 87, 105, 114, 101, 108, 101, 115, 115, 32, 65,
+    99, 99, 101, 115, 115, 0, 97, 99, 45, 49, 56, 46, 49, 0, 65, 67,
+    45, 49, 56, 40, 48, 49, 41, 0, 65, 117, 116, 104, 101, 110, 116, 105,
+    99, 97, 116, 105, 111, 110, 32, 97, 110, 100, 32, 69, 110, 99, 114, 121,
+    112, 116, 105, 111, 110, 0, 97, 99, 45, 49, 56, 46, 50, 0, 65, 67,
+    45, 49, 56, 40, 48, 50, 41, 0, 77, 111, 110, 105, 116, 111, 114, 105,
+    110, 103, 32, 85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32,
+    67, 111, 110, 110, 101, 99, 116, 105, 111, 110, 115, 0, 97, 99, 45, 49,
+    56, 46, 51, 0, 65, 67, 45, 49, 56, 40, 48, 51, 41, 0, 68, 105,
+    115, 97, 98, 108, 101, 32, 87, 105, 114, 101, 108, 101, 115, 115, 32, 78,
+    101, 116, 119, 111, 114, 107, 105, 110, 103, 0, 97, 99, 45, 49, 56, 46,
+    52, 0, 65, 67, 45, 49, 56, 40, 48, 52, 41, 0, 82, 101, 115, 116,
+    114, 105, 99, 116, 32, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105,
+    111, 110, 115, 32, 98, 121, 32, 85, 115, 101, 114, 115, 0, 97, 99, 45,
+    49, 56, 46, 53, 0, 65, 67, 45, 49, 56, 40, 48, 53, 41, 0, 65,
+    110, 116, 101, 110, 110, 97, 115, 32, 97, 110, 100, 32, 84, 114, 97, 110,
+    115, 109, 105, 115, 115, 105, 111, 110, 32, 80, 111, 119, 101, 114, 32, 76,
+    101, 118, 101, 108, 115, 0, 97, 99, 45, 49, 57, 0, 65, 67, 45, 49,
+    57, 0, 65, 99, 99, 101, 115, 115, 32, 67, 111, 110, 116, 114, 111, 108,
+    32, 102, 111, 114, 32, 77, 111, 98, 105, 108, 101, 32, 68, 101, 118, 105,
+    99, 101, 115, 0, 97, 99, 45, 49, 57, 46, 49, 0, 65, 67, 45, 49,
+    57, 40, 48, 49, 41, 0, 85, 115, 101, 32, 111, 102, 32, 87, 114, 105,
+    116, 97, 98, 108, 101, 32, 97, 110, 100, 32, 80, 111, 114, 116, 97, 98,
+    108, 101, 32, 83, 116, 111, 114, 97, 103, 101, 32, 68, 101, 118, 105, 99,
+    101, 115, 0, 97, 99, 45, 49, 57, 46, 50, 0, 65, 67, 45, 49, 57,
+    40, 48, 50, 41, 0, 85, 115, 101, 32, 111, 102, 32, 80, 101, 114, 115,
+    111, 110, 97, 108, 108, 121, 32, 79, 119, 110, 101, 100, 32, 80, 111, 114,
+    116, 97, 98, 108, 101, 32, 83, 116, 111, 114, 97, 103, 101, 32, 68, 101,
+    118, 105, 99, 101, 115, 0, 97, 99, 45, 49, 57, 46, 51, 0, 65, 67,
+    45, 49, 57, 40, 48, 51, 41, 0, 85, 115, 101, 32, 111, 102, 32, 80,
+    111, 114, 116, 97, 98, 108, 101, 32, 83, 116, 111, 114, 97, 103, 101, 32,
+    68, 101, 118, 105, 99, 101, 115, 32, 119, 105, 116, 104, 32, 78, 111, 32,
+    73, 100, 101, 110, 116, 105, 102, 105, 97, 98, 108, 101, 32, 79, 119, 110,
+    101, 114, 0, 97, 99, 45, 49, 57, 46, 52, 0, 65, 67, 45, 49, 57,
+    40, 48, 52, 41, 0, 82, 101, 115, 116, 114, 105, 99, 116, 105, 111, 110,
+    115, 32, 102, 111, 114, 32, 67, 108, 97, 115, 115, 105, 102, 105, 101, 100,
+    32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 97, 99, 45,
+    49, 57, 46, 53, 0, 65, 67, 45, 49, 57, 40, 48, 53, 41, 0, 70,
+    117, 108, 108, 32, 68, 101, 118, 105, 99, 101, 32, 111, 114, 32, 67, 111,
+    110, 116, 97, 105, 110, 101, 114, 45, 98, 97, 115, 101, 100, 32, 69, 110,
+    99, 114, 121, 112, 116, 105, 111, 110, 0, 97, 99, 45, 50, 48, 0, 65,
+    67, 45, 50, 48, 0, 85, 115, 101, 32, 111, 102, 32, 69, 120, 116, 101,
+    114, 110, 97, 108, 32, 83, 121, 115, 116, 101, 109, 115, 0, 97, 99, 45,
+    50, 48, 46, 49, 0, 65, 67, 45, 50, 48, 40, 48, 49, 41, 0, 76,
+    105, 109, 105, 116, 115, 32, 111, 110, 32, 65, 117, 116, 104, 111, 114, 105,
+    122, 101, 100, 32, 85, 115, 101, 0, 97, 99, 45, 50, 48, 46, 50, 0,
+    65, 67, 45, 50, 48, 40, 48, 50, 41, 0, 80, 111, 114, 116, 97, 98,
+    108, 101, 32, 83, 116, 111, 114, 97, 103, 101, 32, 68, 101, 118, 105, 99,
+    101, 115, 32, -30, -128, -108, 32, 82, 101, 115, 116, 114, 105, 99, 116, 101,
+    100, 32, 85, 115, 101, 0, 97, 99, 45, 50, 48, 46, 51, 0, 65, 67,
+    45, 50, 48, 40, 48, 51, 41, 0, 78, 111, 110, 45, 111, 114, 103, 97,
+    110, 105, 122, 97, 116, 105, 111, 110, 97, 108, 108, 121, 32, 79, 119, 110,
+    101, 100, 32, 83, 121, 115, 116, 101, 109, 115, 32, -30, -128, -108, 32, 82,
+    101, 115, 116, 114, 105, 99, 116, 101, 100, 32, 85, 115, 101, 0, 97, 99,
+    45, 50, 48, 46, 52, 0, 65, 67, 45, 50, 48, 40, 48, 52, 41, 0,
+    78, 101, 116, 119, 111, 114, 107, 32, 65, 99, 99, 101, 115, 115, 105, 98,
+    108, 101, 32, 83, 116, 111, 114, 97, 103, 101, 32, 68, 101, 118, 105, 99,
+    101, 115, 32, -30, -128, -108, 32, 80, 114, 111, 104, 105, 98, 105, 116, 101,
+    100, 32, 85, 115, 101, 0, 97, 99, 45, 50, 48, 46, 53, 0, 65, 67,
+    45, 50, 48, 40, 48, 53, 41, 0, 80, 111, 114, 116, 97, 98, 108, 101,
+    32, 83, 116, 111, 114, 97, 103, 101, 32, 68, 101, 118, 105, 99, 101, 115,
+    32, -30, -128, -108, 32, 80, 114, 111, 104, 105, 98, 105, 116, 101, 100, 32,
+    85, 115, 101, 0, 97, 99, 45, 50, 49, 0, 65, 67, 45, 50, 49, 0,
+    73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 83, 104, 97, 114,
+    105, 110, 103, 0, 97, 99, 45, 50, 49, 46, 49, 0, 65, 67, 45, 50,
+    49, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32,
+    68, 101, 99, 105, 115, 105, 111, 110, 32, 83, 117, 112, 112, 111, 114, 116,
+    0, 97, 99, 45, 50, 49, 46, 50, 0, 65, 67, 45, 50, 49, 40, 48,
+    50, 41, 0, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 83,
+    101, 97, 114, 99, 104, 32, 97, 110, 100, 32, 82, 101, 116, 114, 105, 101,
+    118, 97, 108, 0, 97, 99, 45, 50, 50, 0, 65, 67, 45, 50, 50, 0,
+    80, 117, 98, 108, 105, 99, 108, 121, 32, 65, 99, 99, 101, 115, 115, 105,
+    98, 108, 101, 32, 67, 111, 110, 116, 101, 110, 116, 0, 97, 99, 45, 50,
+    51, 0, 65, 67, 45, 50, 51, 0, 68, 97, 116, 97, 32, 77, 105, 110,
+    105, 110, 103, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 97,
+    99, 45, 50, 52, 0, 65, 67, 45, 50, 52, 0, 65, 99, 99, 101, 115,
+    115, 32, 67, 111, 110, 116, 114, 111, 108, 32, 68, 101, 99, 105, 115, 105,
+    111, 110, 115, 0, 97, 99, 45, 50, 52, 46, 49, 0, 65, 67, 45, 50,
+    52, 40, 48, 49, 41, 0, 84, 114, 97, 110, 115, 109, 105, 116, 32, 65,
+    99, 99, 101, 115, 115, 32, 65, 117, 116, 104, 111, 114, 105, 122, 97, 116,
+    105, 111, 110, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0,
+    97, 99, 45, 50, 52, 46, 50, 0, 65, 67, 45, 50, 52, 40, 48, 50,
+    41, 0, 78, 111, 32, 85, 115, 101, 114, 32, 111, 114, 32, 80, 114, 111,
+    99, 101, 115, 115, 32, 73, 100, 101, 110, 116, 105, 116, 121, 0, 97, 99,
+    45, 50, 53, 0, 65, 67, 45, 50, 53, 0, 82, 101, 102, 101, 114, 101,
+    110, 99, 101, 32, 77, 111, 110, 105, 116, 111, 114, 0, 97, 116, 45, 49,
+    0, 65, 84, 45, 48, 49, 0, 65, 119, 97, 114, 101, 110, 101, 115, 115,
+    32, 97, 110, 100, 32, 84, 114, 97, 105, 110, 105, 110, 103, 0, 97, 116,
+    45, 50, 0, 65, 84, 45, 48, 50, 0, 76, 105, 116, 101, 114, 97, 99,
+    121, 32, 84, 114, 97, 105, 110, 105, 110, 103, 32, 97, 110, 100, 32, 65,
+    119, 97, 114, 101, 110, 101, 115, 115, 0, 97, 116, 45, 50, 46, 49, 0,
+    65, 84, 45, 48, 50, 40, 48, 49, 41, 0, 80, 114, 97, 99, 116, 105,
+    99, 97, 108, 32, 69, 120, 101, 114, 99, 105, 115, 101, 115, 0, 97, 116,
+    45, 50, 46, 50, 0, 65, 84, 45, 48, 50, 40, 48, 50, 41, 0, 73,
+    110, 115, 105, 100, 101, 114, 32, 84, 104, 114, 101, 97, 116, 0, 97, 116,
+    45, 50, 46, 51, 0, 65, 84, 45, 48, 50, 40, 48, 51, 41, 0, 83,
+    111, 99, 105, 97, 108, 32, 69, 110, 103, 105, 110, 101, 101, 114, 105, 110,
+    103, 32, 97, 110, 100, 32, 77, 105, 110, 105, 110, 103, 0, 97, 116, 45,
+    50, 46, 52, 0, 65, 84, 45, 48, 50, 40, 48, 52, 41, 0, 83, 117,
+    115, 112, 105, 99, 105, 111, 117, 115, 32, 67, 111, 109, 109, 117, 110, 105,
+    99, 97, 116, 105, 111, 110, 115, 32, 97, 110, 100, 32, 65, 110, 111, 109,
+    97, 108, 111, 117, 115, 32, 83, 121, 115, 116, 101, 109, 32, 66, 101, 104,
+    97, 118, 105, 111, 114, 0, 97, 116, 45, 50, 46, 53, 0, 65, 84, 45,
+    48, 50, 40, 48, 53, 41, 0, 65, 100, 118, 97, 110, 99, 101, 100, 32,
+    80, 101, 114, 115, 105, 115, 116, 101, 110, 116, 32, 84, 104, 114, 101, 97,
+    116, 0, 97, 116, 45, 50, 46, 54, 0, 65, 84, 45, 48, 50, 40, 48,
+    54, 41, 0, 67, 121, 98, 101, 114, 32, 84, 104, 114, 101, 97, 116, 32,
+    69, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 0, 97, 116, 45, 51,
+    0, 65, 84, 45, 48, 51, 0, 82, 111, 108, 101, 45, 98, 97, 115, 101,
+    100, 32, 84, 114, 97, 105, 110, 105, 110, 103, 0, 97, 116, 45, 51, 46,
+    49, 0, 65, 84, 45, 48, 51, 40, 48, 49, 41, 0, 69, 110, 118, 105,
+    114, 111, 110, 109, 101, 110, 116, 97, 108, 32, 67, 111, 110, 116, 114, 111,
+    108, 115, 0, 97, 116, 45, 51, 46, 50, 0, 65, 84, 45, 48, 51, 40,
+    48, 50, 41, 0, 80, 104, 121, 115, 105, 99, 97, 108, 32, 83, 101, 99,
+    117, 114, 105, 116, 121, 32, 67, 111, 110, 116, 114, 111, 108, 115, 0, 97,
+    116, 45, 51, 46, 51, 0, 65, 84, 45, 48, 51, 40, 48, 51, 41, 0,
+    97, 116, 45, 51, 46, 52, 0, 65, 84, 45, 48, 51, 40, 48, 52, 41,
+    0, 97, 116, 45, 51, 46, 53, 0, 65, 84, 45, 48, 51, 40, 48, 53,
+    41, 0, 80, 114, 111, 99, 101, 115, 115, 105, 110, 103, 32, 80, 101, 114,
+    115, 111, 110, 97, 108, 108, 121, 32, 73, 100, 101, 110, 116, 105, 102, 105,
+    97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110,
+    0, 97, 116, 45, 52, 0, 65, 84, 45, 48, 52, 0, 84, 114, 97, 105,
+    110, 105, 110, 103, 32, 82, 101, 99, 111, 114, 100, 115, 0, 97, 116, 45,
+    53, 0, 65, 84, 45, 48, 53, 0, 67, 111, 110, 116, 97, 99, 116, 115,
+    32, 119, 105, 116, 104, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 71,
+    114, 111, 117, 112, 115, 32, 97, 110, 100, 32, 65, 115, 115, 111, 99, 105,
+    97, 116, 105, 111, 110, 115, 0, 97, 116, 45, 54, 0, 65, 84, 45, 48,
+    54, 0, 84, 114, 97, 105, 110, 105, 110, 103, 32, 70, 101, 101, 100, 98,
+    97, 99, 107, 0, 97, 117, 45, 49, 0, 65, 85, 45, 48, 49, 0, 65,
+    117, 100, 105, 116, 32, 97, 110, 100, 32, 65, 99, 99, 111, 117, 110, 116,
+    97, 98, 105, 108, 105, 116, 121, 0, 97, 117, 45, 50, 0, 65, 85, 45,
+    48, 50, 0, 69, 118, 101, 110, 116, 32, 76, 111, 103, 103, 105, 110, 103,
+    0, 97, 117, 45, 50, 46, 49, 0, 65, 85, 45, 48, 50, 40, 48, 49,
+    41, 0, 67, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 32, 111, 102,
+    32, 65, 117, 100, 105, 116, 32, 82, 101, 99, 111, 114, 100, 115, 32, 102,
+    114, 111, 109, 32, 77, 117, 108, 116, 105, 112, 108, 101, 32, 83, 111, 117,
+    114, 99, 101, 115, 0, 97, 117, 45, 50, 46, 50, 0, 65, 85, 45, 48,
+    50, 40, 48, 50, 41, 0, 83, 101, 108, 101, 99, 116, 105, 111, 110, 32,
+    111, 102, 32, 65, 117, 100, 105, 116, 32, 69, 118, 101, 110, 116, 115, 32,
+    98, 121, 32, 67, 111, 109, 112, 111, 110, 101, 110, 116, 0, 97, 117, 45,
+    50, 46, 51, 0, 65, 85, 45, 48, 50, 40, 48, 51, 41, 0, 82, 101,
+    118, 105, 101, 119, 115, 32, 97, 110, 100, 32, 85, 112, 100, 97, 116, 101,
+    115, 0, 97, 117, 45, 50, 46, 52, 0, 65, 85, 45, 48, 50, 40, 48,
+    52, 41, 0, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 70, 117,
+    110, 99, 116, 105, 111, 110, 115, 0, 97, 117, 45, 51, 0, 65, 85, 45,
+    48, 51, 0, 67, 111, 110, 116, 101, 110, 116, 32, 111, 102, 32, 65, 117,
+    100, 105, 116, 32, 82, 101, 99, 111, 114, 100, 115, 0, 97, 117, 45, 51,
+    46, 49, 0, 65, 85, 45, 48, 51, 40, 48, 49, 41, 0, 65, 100, 100,
+    105, 116, 105, 111, 110, 97, 108, 32, 65, 117, 100, 105, 116, 32, 73, 110,
+    102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 97, 117, 45, 51, 46, 50,
+    0, 65, 85, 45, 48, 51, 40, 48, 50, 41, 0, 67, 101, 110, 116, 114,
+    97, 108, 105, 122, 101, 100, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110,
+    116, 32, 111, 102, 32, 80, 108, 97, 110, 110, 101, 100, 32, 65, 117, 100,
+    105, 116, 32, 82, 101, 99, 111, 114, 100, 32, 67, 111, 110, 116, 101, 110,
+    116, 0, 97, 117, 45, 51, 46, 51, 0, 65, 85, 45, 48, 51, 40, 48,
+    51, 41, 0, 76, 105, 109, 105, 116, 32, 80, 101, 114, 115, 111, 110, 97,
+    108, 108, 121, 32, 73, 100, 101, 110, 116, 105, 102, 105, 97, 98, 108, 101,
+    32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 69, 108, 101,
+    109, 101, 110, 116, 115, 0, 97, 117, 45, 52, 0, 65, 85, 45, 48, 52,
+    0, 65, 117, 100, 105, 116, 32, 76, 111, 103, 32, 83, 116, 111, 114, 97,
+    103, 101, 32, 67, 97, 112, 97, 99, 105, 116, 121, 0, 97, 117, 45, 52,
+    46, 49, 0, 65, 85, 45, 48, 52, 40, 48, 49, 41, 0, 84, 114, 97,
+    110, 115, 102, 101, 114, 32, 116, 111, 32, 65, 108, 116, 101, 114, 110, 97,
+    116, 101, 32, 83, 116, 111, 114, 97, 103, 101, 0, 97, 117, 45, 53, 0,
+    65, 85, 45, 48, 53, 0, 82, 101, 115, 112, 111, 110, 115, 101, 32, 116,
+    111, 32, 65, 117, 100, 105, 116, 32, 76, 111, 103, 103, 105, 110, 103, 32,
+    80, 114, 111, 99, 101, 115, 115, 32, 70, 97, 105, 108, 117, 114, 101, 115,
+    0, 97, 117, 45, 53, 46, 49, 0, 65, 85, 45, 48, 53, 40, 48, 49,
+    41, 0, 83, 116, 111, 114, 97, 103, 101, 32, 67, 97, 112, 97, 99, 105,
+    116, 121, 32, 87, 97, 114, 110, 105, 110, 103, 0, 97, 117, 45, 53, 46,
+    50, 0, 65, 85, 45, 48, 53, 40, 48, 50, 41, 0, 82, 101, 97, 108,
+    45, 116, 105, 109, 101, 32, 65, 108, 101, 114, 116, 115, 0, 97, 117, 45,
+    53, 46, 51, 0, 65, 85, 45, 48, 53, 40, 48, 51, 41, 0, 67, 111,
+    110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 32, 84, 114, 97, 102, 102,
+    105, 99, 32, 86, 111, 108, 117, 109, 101, 32, 84, 104, 114, 101, 115, 104,
+    111, 108, 100, 115, 0, 97, 117, 45, 53, 46, 52, 0, 65, 85, 45, 48,
+    53, 40, 48, 52, 41, 0, 83, 104, 117, 116, 100, 111, 119, 110, 32, 111,
+    110, 32, 70, 97, 105, 108, 117, 114, 101, 0, 97, 117, 45, 53, 46, 53,
+    0, 65, 85, 45, 48, 53, 40, 48, 53, 41, 0, 65, 108, 116, 101, 114,
+    110, 97, 116, 101, 32, 65, 117, 100, 105, 116, 32, 76, 111, 103, 103, 105,
+    110, 103, 32, 67, 97, 112, 97, 98, 105, 108, 105, 116, 121, 0, 97, 117,
+    45, 54, 0, 65, 85, 45, 48, 54, 0, 65, 117, 100, 105, 116, 32, 82,
+    101, 99, 111, 114, 100, 32, 82, 101, 118, 105, 101, 119, 44, 32, 65, 110,
+    97, 108, 121, 115, 105, 115, 44, 32, 97, 110, 100, 32, 82, 101, 112, 111,
+    114, 116, 105, 110, 103, 0, 97, 117, 45, 54, 46, 49, 0, 65, 85, 45,
+    48, 54, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100,
+    32, 80, 114, 111, 99, 101, 115, 115, 32, 73, 110, 116, 101, 103, 114, 97,
+    116, 105, 111, 110, 0, 97, 117, 45, 54, 46, 50, 0, 65, 85, 45, 48,
+    54, 40, 48, 50, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32,
+    83, 101, 99, 117, 114, 105, 116, 121, 32, 65, 108, 101, 114, 116, 115, 0,
+    97, 117, 45, 54, 46, 51, 0, 65, 85, 45, 48, 54, 40, 48, 51, 41,
+    0, 67, 111, 114, 114, 101, 108, 97, 116, 101, 32, 65, 117, 100, 105, 116,
+    32, 82, 101, 99, 111, 114, 100, 32, 82, 101, 112, 111, 115, 105, 116, 111,
+    114, 105, 101, 115, 0, 97, 117, 45, 54, 46, 52, 0, 65, 85, 45, 48,
+    54, 40, 48, 52, 41, 0, 67, 101, 110, 116, 114, 97, 108, 32, 82, 101,
+    118, 105, 101, 119, 32, 97, 110, 100, 32, 65, 110, 97, 108, 121, 115, 105,
+    115, 0, 97, 117, 45, 54, 46, 53, 0, 65, 85, 45, 48, 54, 40, 48,
+    53, 41, 0, 73, 110, 116, 101, 103, 114, 97, 116, 101, 100, 32, 65, 110,
+    97, 108, 121, 115, 105, 115, 32, 111, 102, 32, 65, 117, 100, 105, 116, 32,
+    82, 101, 99, 111, 114, 100, 115, 0, 97, 117, 45, 54, 46, 54, 0, 65,
+    85, 45, 48, 54, 40, 48, 54, 41, 0, 67, 111, 114, 114, 101, 108, 97,
+    116, 105, 111, 110, 32, 119, 105, 116, 104, 32, 80, 104, 121, 115, 105, 99,
+    97, 108, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 0, 97, 117,
+    45, 54, 46, 55, 0, 65, 85, 45, 48, 54, 40, 48, 55, 41, 0, 80,
+    101, 114, 109, 105, 116, 116, 101, 100, 32, 65, 99, 116, 105, 111, 110, 115,
+    0, 97, 117, 45, 54, 46, 56, 0, 65, 85, 45, 48, 54, 40, 48, 56,
+    41, 0, 70, 117, 108, 108, 32, 84, 101, 120, 116, 32, 65, 110, 97, 108,
+    121, 115, 105, 115, 32, 111, 102, 32, 80, 114, 105, 118, 105, 108, 101, 103,
+    101, 100, 32, 67, 111, 109, 109, 97, 110, 100, 115, 0, 97, 117, 45, 54,
+    46, 57, 0, 65, 85, 45, 48, 54, 40, 48, 57, 41, 0, 67, 111, 114,
+    114, 101, 108, 97, 116, 105, 111, 110, 32, 119, 105, 116, 104, 32, 73, 110,
+    102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 102, 114, 111, 109, 32, 78,
+    111, 110, 116, 101, 99, 104, 110, 105, 99, 97, 108, 32, 83, 111, 117, 114,
+    99, 101, 115, 0, 97, 117, 45, 54, 46, 49, 48, 0, 65, 85, 45, 48,
+    54, 40, 49, 48, 41, 0, 65, 117, 100, 105, 116, 32, 76, 101, 118, 101,
+    108, 32, 65, 100, 106, 117, 115, 116, 109, 101, 110, 116, 0, 97, 117, 45,
+    55, 0, 65, 85, 45, 48, 55, 0, 65, 117, 100, 105, 116, 32, 82, 101,
+    99, 111, 114, 100, 32, 82, 101, 100, 117, 99, 116, 105, 111, 110, 32, 97,
+    110, 100, 32, 82, 101, 112, 111, 114, 116, 32, 71, 101, 110, 101, 114, 97,
+    116, 105, 111, 110, 0, 97, 117, 45, 55, 46, 49, 0, 65, 85, 45, 48,
+    55, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109, 97, 116, 105, 99, 32,
+    80, 114, 111, 99, 101, 115, 115, 105, 110, 103, 0, 97, 117, 45, 55, 46,
+    50, 0, 65, 85, 45, 48, 55, 40, 48, 50, 41, 0, 65, 117, 116, 111,
+    109, 97, 116, 105, 99, 32, 83, 111, 114, 116, 32, 97, 110, 100, 32, 83,
+    101, 97, 114, 99, 104, 0, 97, 117, 45, 56, 0, 65, 85, 45, 48, 56,
+    0, 84, 105, 109, 101, 32, 83, 116, 97, 109, 112, 115, 0, 97, 117, 45,
+    56, 46, 49, 0, 65, 85, 45, 48, 56, 40, 48, 49, 41, 0, 83, 121,
+    110, 99, 104, 114, 111, 110, 105, 122, 97, 116, 105, 111, 110, 32, 119, 105,
+    116, 104, 32, 65, 117, 116, 104, 111, 114, 105, 116, 97, 116, 105, 118, 101,
+    32, 84, 105, 109, 101, 32, 83, 111, 117, 114, 99, 101, 0, 97, 117, 45,
+    56, 46, 50, 0, 65, 85, 45, 48, 56, 40, 48, 50, 41, 0, 83, 101,
+    99, 111, 110, 100, 97, 114, 121, 32, 65, 117, 116, 104, 111, 114, 105, 116,
+    97, 116, 105, 118, 101, 32, 84, 105, 109, 101, 32, 83, 111, 117, 114, 99,
+    101, 0, 97, 117, 45, 57, 0, 65, 85, 45, 48, 57, 0, 80, 114, 111,
+    116, 101, 99, 116, 105, 111, 110, 32, 111, 102, 32, 65, 117, 100, 105, 116,
+    32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 97, 117, 45,
+    57, 46, 49, 0, 65, 85, 45, 48, 57, 40, 48, 49, 41, 0, 72, 97,
+    114, 100, 119, 97, 114, 101, 32, 87, 114, 105, 116, 101, 45, 111, 110, 99,
+    101, 32, 77, 101, 100, 105, 97, 0, 97, 117, 45, 57, 46, 50, 0, 65,
+    85, 45, 48, 57, 40, 48, 50, 41, 0, 83, 116, 111, 114, 101, 32, 111,
+    110, 32, 83, 101, 112, 97, 114, 97, 116, 101, 32, 80, 104, 121, 115, 105,
+    99, 97, 108, 32, 83, 121, 115, 116, 101, 109, 115, 32, 111, 114, 32, 67,
+    111, 109, 112, 111, 110, 101, 110, 116, 115, 0, 97, 117, 45, 57, 46, 51,
+    0, 65, 85, 45, 48, 57, 40, 48, 51, 41, 0, 67, 114, 121, 112, 116,
+    111, 103, 114, 97, 112, 104, 105, 99, 32, 80, 114, 111, 116, 101, 99, 116,
+    105, 111, 110, 0, 97, 117, 45, 57, 46, 52, 0, 65, 85, 45, 48, 57,
+    40, 48, 52, 41, 0, 65, 99, 99, 101, 115, 115, 32, 98, 121, 32, 83,
+    117, 98, 115, 101, 116, 32, 111, 102, 32, 80, 114, 105, 118, 105, 108, 101,
+    103, 101, 100, 32, 85, 115, 101, 114, 115, 0, 97, 117, 45, 57, 46, 53,
+    0, 65, 85, 45, 48, 57, 40, 48, 53, 41, 0, 97, 117, 45, 57, 46,
+    54, 0, 65, 85, 45, 48, 57, 40, 48, 54, 41, 0, 82, 101, 97, 100,
+    45, 111, 110, 108, 121, 32, 65, 99, 99, 101, 115, 115, 0, 97, 117, 45,
+    57, 46, 55, 0, 65, 85, 45, 48, 57, 40, 48, 55, 41, 0, 83, 116,
+    111, 114, 101, 32, 111, 110, 32, 67, 111, 109, 112, 111, 110, 101, 110, 116,
+    32, 119, 105, 116, 104, 32, 68, 105, 102, 102, 101, 114, 101, 110, 116, 32,
+    79, 112, 101, 114, 97, 116, 105, 110, 103, 32, 83, 121, 115, 116, 101, 109,
+    0, 97, 117, 45, 49, 48, 0, 65, 85, 45, 49, 48, 0, 78, 111, 110,
+    45, 114, 101, 112, 117, 100, 105, 97, 116, 105, 111, 110, 0, 97, 117, 45,
+    49, 48, 46, 49, 0, 65, 85, 45, 49, 48, 40, 48, 49, 41, 0, 65,
+    115, 115, 111, 99, 105, 97, 116, 105, 111, 110, 32, 111, 102, 32, 73, 100,
+    101, 110, 116, 105, 116, 105, 101, 115, 0, 97, 117, 45, 49, 48, 46, 50,
+    0, 65, 85, 45, 49, 48, 40, 48, 50, 41, 0, 86, 97, 108, 105, 100,
+    97, 116, 101, 32, 66, 105, 110, 100, 105, 110, 103, 32, 111, 102, 32, 73,
+    110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 80, 114, 111, 100, 117,
+    99, 101, 114, 32, 73, 100, 101, 110, 116, 105, 116, 121, 0, 97, 117, 45,
+    49, 48, 46, 51, 0, 65, 85, 45, 49, 48, 40, 48, 51, 41, 0, 67,
+    104, 97, 105, 110, 32, 111, 102, 32, 67, 117, 115, 116, 111, 100, 121, 0,
+    97, 117, 45, 49, 48, 46, 52, 0, 65, 85, 45, 49, 48, 40, 48, 52,
+    41, 0, 86, 97, 108, 105, 100, 97, 116, 101, 32, 66, 105, 110, 100, 105,
+    110, 103, 32, 111, 102, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111,
+    110, 32, 82, 101, 118, 105, 101, 119, 101, 114, 32, 73, 100, 101, 110, 116,
+    105, 116, 121, 0, 97, 117, 45, 49, 48, 46, 53, 0, 65, 85, 45, 49,
+    48, 40, 48, 53, 41, 0, 68, 105, 103, 105, 116, 97, 108, 32, 83, 105,
+    103, 110, 97, 116, 117, 114, 101, 115, 0, 97, 117, 45, 49, 49, 0, 65,
+    85, 45, 49, 49, 0, 65, 117, 100, 105, 116, 32, 82, 101, 99, 111, 114,
+    100, 32, 82, 101, 116, 101, 110, 116, 105, 111, 110, 0, 97, 117, 45, 49,
+    49, 46, 49, 0, 65, 85, 45, 49, 49, 40, 48, 49, 41, 0, 76, 111,
+    110, 103, 45, 116, 101, 114, 109, 32, 82, 101, 116, 114, 105, 101, 118, 97,
+    108, 32, 67, 97, 112, 97, 98, 105, 108, 105, 116, 121, 0, 97, 117, 45,
+    49, 50, 0, 65, 85, 45, 49, 50, 0, 65, 117, 100, 105, 116, 32, 82,
+    101, 99, 111, 114, 100, 32, 71, 101, 110, 101, 114, 97, 116, 105, 111, 110,
+    0, 97, 117, 45, 49, 50, 46, 49, 0, 65, 85, 45, 49, 50, 40, 48,
+    49, 41, 0, 83, 121, 115, 116, 101, 109, 45, 119, 105, 100, 101, 32, 97,
+    110, 100, 32, 84, 105, 109, 101, 45, 99, 111, 114, 114, 101, 108, 97, 116,
+    101, 100, 32, 65, 117, 100, 105, 116, 32, 84, 114, 97, 105, 108, 0, 97,
+    117, 45, 49, 50, 46, 50, 0, 65, 85, 45, 49, 50, 40, 48, 50, 41,
+    0, 83, 116, 97, 110, 100, 97, 114, 100, 105, 122, 101, 100, 32, 70, 111,
+    114, 109, 97, 116, 115, 0, 97, 117, 45, 49, 50, 46, 51, 0, 65, 85,
+    45, 49, 50, 40, 48, 51, 41, 0, 67, 104, 97, 110, 103, 101, 115, 32,
+    98, 121, 32, 65, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 73, 110,
+    100, 105, 118, 105, 100, 117, 97, 108, 115, 0, 97, 117, 45, 49, 50, 46,
+    52, 0, 65, 85, 45, 49, 50, 40, 48, 52, 41, 0, 81, 117, 101, 114,
+    121, 32, 80, 97, 114, 97, 109, 101, 116, 101, 114, 32, 65, 117, 100, 105,
+    116, 115, 32, 111, 102, 32, 80, 101, 114, 115, 111, 110, 97, 108, 108, 121,
+    32, 73, 100, 101, 110, 116, 105, 102, 105, 97, 98, 108, 101, 32, 73, 110,
+    102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 97, 117, 45, 49, 51, 0,
+    65, 85, 45, 49, 51, 0, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103,
+    32, 102, 111, 114, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110,
+    32, 68, 105, 115, 99, 108, 111, 115, 117, 114, 101, 0, 97, 117, 45, 49,
+    51, 46, 49, 0, 65, 85, 45, 49, 51, 40, 48, 49, 41, 0, 85, 115,
+    101, 32, 111, 102, 32, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 84,
+    111, 111, 108, 115, 0, 97, 117, 45, 49, 51, 46, 50, 0, 65, 85, 45,
+    49, 51, 40, 48, 50, 41, 0, 82, 101, 118, 105, 101, 119, 32, 111, 102,
+    32, 77, 111, 110, 105, 116, 111, 114, 101, 100, 32, 83, 105, 116, 101, 115,
+    0, 97, 117, 45, 49, 51, 46, 51, 0, 65, 85, 45, 49, 51, 40, 48,
+    51, 41, 0, 85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32,
+    82, 101, 112, 108, 105, 99, 97, 116, 105, 111, 110, 32, 111, 102, 32, 73,
+    110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 97, 117, 45, 49, 52,
+    0, 65, 85, 45, 49, 52, 0, 83, 101, 115, 115, 105, 111, 110, 32, 65,
+    117, 100, 105, 116, 0, 97, 117, 45, 49, 52, 46, 49, 0, 65, 85, 45,
+    49, 52, 40, 48, 49, 41, 0, 83, 121, 115, 116, 101, 109, 32, 83, 116,
+    97, 114, 116, 45, 117, 112, 0, 97, 117, 45, 49, 52, 46, 50, 0, 65,
+    85, 45, 49, 52, 40, 48, 50, 41, 0, 67, 97, 112, 116, 117, 114, 101,
+    32, 97, 110, 100, 32, 82, 101, 99, 111, 114, 100, 32, 67, 111, 110, 116,
+    101, 110, 116, 0, 97, 117, 45, 49, 52, 46, 51, 0, 65, 85, 45, 49,
+    52, 40, 48, 51, 41, 0, 82, 101, 109, 111, 116, 101, 32, 86, 105, 101,
+    119, 105, 110, 103, 32, 97, 110, 100, 32, 76, 105, 115, 116, 101, 110, 105,
+    110, 103, 0, 97, 117, 45, 49, 53, 0, 65, 85, 45, 49, 53, 0, 97,
+    117, 45, 49, 54, 0, 65, 85, 45, 49, 54, 0, 67, 114, 111, 115, 115,
+    45, 111, 114, 103, 97, 110, 105, 122, 97, 116, 105, 111, 110, 97, 108, 32,
+    65, 117, 100, 105, 116, 32, 76, 111, 103, 103, 105, 110, 103, 0, 97, 117,
+    45, 49, 54, 46, 49, 0, 65, 85, 45, 49, 54, 40, 48, 49, 41, 0,
+    73, 100, 101, 110, 116, 105, 116, 121, 32, 80, 114, 101, 115, 101, 114, 118,
+    97, 116, 105, 111, 110, 0, 97, 117, 45, 49, 54, 46, 50, 0, 65, 85,
+    45, 49, 54, 40, 48, 50, 41, 0, 83, 104, 97, 114, 105, 110, 103, 32,
+    111, 102, 32, 65, 117, 100, 105, 116, 32, 73, 110, 102, 111, 114, 109, 97,
+    116, 105, 111, 110, 0, 97, 117, 45, 49, 54, 46, 51, 0, 65, 85, 45,
+    49, 54, 40, 48, 51, 41, 0, 68, 105, 115, 97, 115, 115, 111, 99, 105,
+    97, 98, 105, 108, 105, 116, 121, 0, 99, 97, 45, 49, 0, 67, 65, 45,
+    48, 49, 0, 65, 115, 115, 101, 115, 115, 109, 101, 110, 116, 44, 32, 65,
+    117, 116, 104, 111, 114, 105, 122, 97, 116, 105, 111, 110, 44, 32, 97, 110,
+    100, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 0, 99, 97, 45,
+    50, 0, 67, 65, 45, 48, 50, 0, 67, 111, 110, 116, 114, 111, 108, 32,
+    65, 115, 115, 101, 115, 115, 109, 101, 110, 116, 115, 0, 99, 97, 45, 50,
+    46, 49, 0, 67, 65, 45, 48, 50, 40, 48, 49, 41, 0, 73, 110, 100,
+    101, 112, 101, 110, 100, 101, 110, 116, 32, 65, 115, 115, 101, 115, 115, 111,
+    114, 115, 0, 99, 97, 45, 50, 46, 50, 0, 67, 65, 45, 48, 50, 40,
+    48, 50, 41, 0, 83, 112, 101, 99, 105, 97, 108, 105, 122, 101, 100, 32,
+    65, 115, 115, 101, 115, 115, 109, 101, 110, 116, 115, 0, 99, 97, 45, 50,
+    46, 51, 0, 67, 65, 45, 48, 50, 40, 48, 51, 41, 0, 76, 101, 118,
+    101, 114, 97, 103, 105, 110, 103, 32, 82, 101, 115, 117, 108, 116, 115, 32,
+    102, 114, 111, 109, 32, 69, 120, 116, 101, 114, 110, 97, 108, 32, 79, 114,
+    103, 97, 110, 105, 122, 97, 116, 105, 111, 110, 115, 0, 99, 97, 45, 51,
+    0, 67, 65, 45, 48, 51, 0, 73, 110, 102, 111, 114, 109, 97, 116, 105,
+    111, 110, 32, 69, 120, 99, 104, 97, 110, 103, 101, 0, 99, 97, 45, 51,
+    46, 49, 0, 67, 65, 45, 48, 51, 40, 48, 49, 41, 0, 85, 110, 99,
+    108, 97, 115, 115, 105, 102, 105, 101, 100, 32, 78, 97, 116, 105, 111, 110,
+    97, 108, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 83, 121, 115, 116,
+    101, 109, 32, 67, 111, 110, 110, 101, 99, 116, 105, 111, 110, 115, 0, 99,
+    97, 45, 51, 46, 50, 0, 67, 65, 45, 48, 51, 40, 48, 50, 41, 0,
+    67, 108, 97, 115, 115, 105, 102, 105, 101, 100, 32, 78, 97, 116, 105, 111,
+    110, 97, 108, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 83, 121, 115,
+    116, 101, 109, 32, 67, 111, 110, 110, 101, 99, 116, 105, 111, 110, 115, 0,
+    99, 97, 45, 51, 46, 51, 0, 67, 65, 45, 48, 51, 40, 48, 51, 41,
+    0, 85, 110, 99, 108, 97, 115, 115, 105, 102, 105, 101, 100, 32, 78, 111,
+    110, 45, 110, 97, 116, 105, 111, 110, 97, 108, 32, 83, 101, 99, 117, 114,
+    105, 116, 121, 32, 83, 121, 115, 116, 101, 109, 32, 67, 111, 110, 110, 101,
+    99, 116, 105, 111, 110, 115, 0, 99, 97, 45, 51, 46, 52, 0, 67, 65,
+    45, 48, 51, 40, 48, 52, 41, 0, 67, 111, 110, 110, 101, 99, 116, 105,
+    111, 110, 115, 32, 116, 111, 32, 80, 117, 98, 108, 105, 99, 32, 78, 101,
+    116, 119, 111, 114, 107, 115, 0, 99, 97, 45, 51, 46, 53, 0, 67, 65,
+    45, 48, 51, 40, 48, 53, 41, 0, 82, 101, 115, 116, 114, 105, 99, 116,
+    105, 111, 110, 115, 32, 111, 110, 32, 69, 120, 116, 101, 114, 110, 97, 108,
+    32, 83, 121, 115, 116, 101, 109, 32, 67, 111, 110, 110, 101, 99, 116, 105,
+    111, 110, 115, 0, 99, 97, 45, 51, 46, 54, 0, 67, 65, 45, 48, 51,
+    40, 48, 54, 41, 0, 84, 114, 97, 110, 115, 102, 101, 114, 32, 65, 117,
+    116, 104, 111, 114, 105, 122, 97, 116, 105, 111, 110, 115, 0, 99, 97, 45,
+    51, 46, 55, 0, 67, 65, 45, 48, 51, 40, 48, 55, 41, 0, 84, 114,
+    97, 110, 115, 105, 116, 105, 118, 101, 32, 73, 110, 102, 111, 114, 109, 97,
+    116, 105, 111, 110, 32, 69, 120, 99, 104, 97, 110, 103, 101, 115, 0, 99,
+    97, 45, 52, 0, 67, 65, 45, 48, 52, 0, 83, 101, 99, 117, 114, 105,
+    116, 121, 32, 67, 101, 114, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110,
+    0, 99, 97, 45, 53, 0, 67, 65, 45, 48, 53, 0, 80, 108, 97, 110,
+    32, 111, 102, 32, 65, 99, 116, 105, 111, 110, 32, 97, 110, 100, 32, 77,
+    105, 108, 101, 115, 116, 111, 110, 101, 115, 0, 99, 97, 45, 53, 46, 49,
+    0, 67, 65, 45, 48, 53, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109,
+    97, 116, 105, 111, 110, 32, 83, 117, 112, 112, 111, 114, 116, 32, 102, 111,
+    114, 32, 65, 99, 99, 117, 114, 97, 99, 121, 32, 97, 110, 100, 32, 67,
+    117, 114, 114, 101, 110, 99, 121, 0, 99, 97, 45, 54, 0, 67, 65, 45,
+    48, 54, 0, 65, 117, 116, 104, 111, 114, 105, 122, 97, 116, 105, 111, 110,
+    0, 99, 97, 45, 54, 46, 49, 0, 67, 65, 45, 48, 54, 40, 48, 49,
+    41, 0, 74, 111, 105, 110, 116, 32, 65, 117, 116, 104, 111, 114, 105, 122,
+    97, 116, 105, 111, 110, 32, -30, -128, -108, 32, 73, 110, 116, 114, 97, 45,
+    111, 114, 103, 97, 110, 105, 122, 97, 116, 105, 111, 110, 0, 99, 97, 45,
+    54, 46, 50, 0, 67, 65, 45, 48, 54, 40, 48, 50, 41, 0, 74, 111,
+    105, 110, 116, 32, 65, 117, 116, 104, 111, 114, 105, 122, 97, 116, 105, 111,
+    110, 32, -30, -128, -108, 32, 73, 110, 116, 101, 114, 45, 111, 114, 103, 97,
+    110, 105, 122, 97, 116, 105, 111, 110, 0, 99, 97, 45, 55, 0, 67, 65,
+    45, 48, 55, 0, 67, 111, 110, 116, 105, 110, 117, 111, 117, 115, 32, 77,
+    111, 110, 105, 116, 111, 114, 105, 110, 103, 0, 99, 97, 45, 55, 46, 49,
+    0, 67, 65, 45, 48, 55, 40, 48, 49, 41, 0, 73, 110, 100, 101, 112,
+    101, 110, 100, 101, 110, 116, 32, 65, 115, 115, 101, 115, 115, 109, 101, 110,
+    116, 0, 99, 97, 45, 55, 46, 50, 0, 67, 65, 45, 48, 55, 40, 48,
+    50, 41, 0, 84, 121, 112, 101, 115, 32, 111, 102, 32, 65, 115, 115, 101,
+    115, 115, 109, 101, 110, 116, 115, 0, 99, 97, 45, 55, 46, 51, 0, 67,
+    65, 45, 48, 55, 40, 48, 51, 41, 0, 84, 114, 101, 110, 100, 32, 65,
+    110, 97, 108, 121, 115, 101, 115, 0, 99, 97, 45, 55, 46, 52, 0, 67,
+    65, 45, 48, 55, 40, 48, 52, 41, 0, 82, 105, 115, 107, 32, 77, 111,
+    110, 105, 116, 111, 114, 105, 110, 103, 0, 99, 97, 45, 55, 46, 53, 0,
+    67, 65, 45, 48, 55, 40, 48, 53, 41, 0, 67, 111, 110, 115, 105, 115,
+    116, 101, 110, 99, 121, 32, 65, 110, 97, 108, 121, 115, 105, 115, 0, 99,
+    97, 45, 55, 46, 54, 0, 67, 65, 45, 48, 55, 40, 48, 54, 41, 0,
+    65, 117, 116, 111, 109, 97, 116, 105, 111, 110, 32, 83, 117, 112, 112, 111,
+    114, 116, 32, 102, 111, 114, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110,
+    103, 0, 99, 97, 45, 56, 0, 67, 65, 45, 48, 56, 0, 80, 101, 110,
+    101, 116, 114, 97, 116, 105, 111, 110, 32, 84, 101, 115, 116, 105, 110, 103,
+    0, 99, 97, 45, 56, 46, 49, 0, 67, 65, 45, 48, 56, 40, 48, 49,
+    41, 0, 73, 110, 100, 101, 112, 101, 110, 100, 101, 110, 116, 32, 80, 101,
+    110, 101, 116, 114, 97, 116, 105, 111, 110, 32, 84, 101, 115, 116, 105, 110,
+    103, 32, 65, 103, 101, 110, 116, 32, 111, 114, 32, 84, 101, 97, 109, 0,
+    99, 97, 45, 56, 46, 50, 0, 67, 65, 45, 48, 56, 40, 48, 50, 41,
+    0, 82, 101, 100, 32, 84, 101, 97, 109, 32, 69, 120, 101, 114, 99, 105,
+    115, 101, 115, 0, 99, 97, 45, 56, 46, 51, 0, 67, 65, 45, 48, 56,
+    40, 48, 51, 41, 0, 70, 97, 99, 105, 108, 105, 116, 121, 32, 80, 101,
+    110, 101, 116, 114, 97, 116, 105, 111, 110, 32, 84, 101, 115, 116, 105, 110,
+    103, 0, 99, 97, 45, 57, 0, 67, 65, 45, 48, 57, 0, 73, 110, 116,
+    101, 114, 110, 97, 108, 32, 83, 121, 115, 116, 101, 109, 32, 67, 111, 110,
+    110, 101, 99, 116, 105, 111, 110, 115, 0, 99, 97, 45, 57, 46, 49, 0,
+    67, 65, 45, 48, 57, 40, 48, 49, 41, 0, 67, 111, 109, 112, 108, 105,
+    97, 110, 99, 101, 32, 67, 104, 101, 99, 107, 115, 0, 99, 109, 45, 49,
+    0, 67, 77, 45, 48, 49, 0, 67, 111, 110, 102, 105, 103, 117, 114, 97,
+    116, 105, 111, 110, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 0,
+    99, 109, 45, 50, 0, 67, 77, 45, 48, 50, 0, 66, 97, 115, 101, 108,
+    105, 110, 101, 32, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111,
+    110, 0, 99, 109, 45, 50, 46, 49, 0, 67, 77, 45, 48, 50, 40, 48,
+    49, 41, 0, 99, 109, 45, 50, 46, 50, 0, 67, 77, 45, 48, 50, 40,
+    48, 50, 41, 0, 99, 109, 45, 50, 46, 51, 0, 67, 77, 45, 48, 50,
+    40, 48, 51, 41, 0, 82, 101, 116, 101, 110, 116, 105, 111, 110, 32, 111,
+    102, 32, 80, 114, 101, 118, 105, 111, 117, 115, 32, 67, 111, 110, 102, 105,
+    103, 117, 114, 97, 116, 105, 111, 110, 115, 0, 99, 109, 45, 50, 46, 52,
+    0, 67, 77, 45, 48, 50, 40, 48, 52, 41, 0, 85, 110, 97, 117, 116,
+    104, 111, 114, 105, 122, 101, 100, 32, 83, 111, 102, 116, 119, 97, 114, 101,
+    0, 99, 109, 45, 50, 46, 53, 0, 67, 77, 45, 48, 50, 40, 48, 53,
+    41, 0, 65, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 83, 111, 102,
+    116, 119, 97, 114, 101, 0, 99, 109, 45, 50, 46, 54, 0, 67, 77, 45,
+    48, 50, 40, 48, 54, 41, 0, 68, 101, 118, 101, 108, 111, 112, 109, 101,
+    110, 116, 32, 97, 110, 100, 32, 84, 101, 115, 116, 32, 69, 110, 118, 105,
+    114, 111, 110, 109, 101, 110, 116, 115, 0, 99, 109, 45, 50, 46, 55, 0,
+    67, 77, 45, 48, 50, 40, 48, 55, 41, 0, 67, 111, 110, 102, 105, 103,
+    117, 114, 101, 32, 83, 121, 115, 116, 101, 109, 115, 32, 97, 110, 100, 32,
+    67, 111, 109, 112, 111, 110, 101, 110, 116, 115, 32, 102, 111, 114, 32, 72,
+    105, 103, 104, 45, 114, 105, 115, 107, 32, 65, 114, 101, 97, 115, 0, 99,
+    109, 45, 51, 0, 67, 77, 45, 48, 51, 0, 67, 111, 110, 102, 105, 103,
+    117, 114, 97, 116, 105, 111, 110, 32, 67, 104, 97, 110, 103, 101, 32, 67,
+    111, 110, 116, 114, 111, 108, 0, 99, 109, 45, 51, 46, 49, 0, 67, 77,
+    45, 48, 51, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101,
+    100, 32, 68, 111, 99, 117, 109, 101, 110, 116, 97, 116, 105, 111, 110, 44,
+    32, 78, 111, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110, 44, 32, 97,
+    110, 100, 32, 80, 114, 111, 104, 105, 98, 105, 116, 105, 111, 110, 32, 111,
+    102, 32, 67, 104, 97, 110, 103, 101, 115, 0, 99, 109, 45, 51, 46, 50,
+    0, 67, 77, 45, 48, 51, 40, 48, 50, 41, 0, 84, 101, 115, 116, 105,
+    110, 103, 44, 32, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110, 44, 32,
+    97, 110, 100, 32, 68, 111, 99, 117, 109, 101, 110, 116, 97, 116, 105, 111,
+    110, 32, 111, 102, 32, 67, 104, 97, 110, 103, 101, 115, 0, 99, 109, 45,
+    51, 46, 51, 0, 67, 77, 45, 48, 51, 40, 48, 51, 41, 0, 65, 117,
+    116, 111, 109, 97, 116, 101, 100, 32, 67, 104, 97, 110, 103, 101, 32, 73,
+    109, 112, 108, 101, 109, 101, 110, 116, 97, 116, 105, 111, 110, 0, 99, 109,
+    45, 51, 46, 52, 0, 67, 77, 45, 48, 51, 40, 48, 52, 41, 0, 83,
+    101, 99, 117, 114, 105, 116, 121, 32, 97, 110, 100, 32, 80, 114, 105, 118,
+    97, 99, 121, 32, 82, 101, 112, 114, 101, 115, 101, 110, 116, 97, 116, 105,
+    118, 101, 115, 0, 99, 109, 45, 51, 46, 53, 0, 67, 77, 45, 48, 51,
+    40, 48, 53, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 83,
+    101, 99, 117, 114, 105, 116, 121, 32, 82, 101, 115, 112, 111, 110, 115, 101,
+    0, 99, 109, 45, 51, 46, 54, 0, 67, 77, 45, 48, 51, 40, 48, 54,
+    41, 0, 67, 114, 121, 112, 116, 111, 103, 114, 97, 112, 104, 121, 32, 77,
+    97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 99, 109, 45, 51, 46, 55,
+    0, 67, 77, 45, 48, 51, 40, 48, 55, 41, 0, 82, 101, 118, 105, 101,
+    119, 32, 83, 121, 115, 116, 101, 109, 32, 67, 104, 97, 110, 103, 101, 115,
+    0, 99, 109, 45, 51, 46, 56, 0, 67, 77, 45, 48, 51, 40, 48, 56,
+    41, 0, 80, 114, 101, 118, 101, 110, 116, 32, 111, 114, 32, 82, 101, 115,
+    116, 114, 105, 99, 116, 32, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116,
+    105, 111, 110, 32, 67, 104, 97, 110, 103, 101, 115, 0, 99, 109, 45, 52,
+    0, 67, 77, 45, 48, 52, 0, 73, 109, 112, 97, 99, 116, 32, 65, 110,
+    97, 108, 121, 115, 101, 115, 0, 99, 109, 45, 52, 46, 49, 0, 67, 77,
+    45, 48, 52, 40, 48, 49, 41, 0, 83, 101, 112, 97, 114, 97, 116, 101,
+    32, 84, 101, 115, 116, 32, 69, 110, 118, 105, 114, 111, 110, 109, 101, 110,
+    116, 115, 0, 99, 109, 45, 52, 46, 50, 0, 67, 77, 45, 48, 52, 40,
+    48, 50, 41, 0, 86, 101, 114, 105, 102, 105, 99, 97, 116, 105, 111, 110,
+    32, 111, 102, 32, 67, 111, 110, 116, 114, 111, 108, 115, 0, 99, 109, 45,
+    53, 0, 67, 77, 45, 48, 53, 0, 65, 99, 99, 101, 115, 115, 32, 82,
+    101, 115, 116, 114, 105, 99, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32,
+    67, 104, 97, 110, 103, 101, 0, 99, 109, 45, 53, 46, 49, 0, 67, 77,
+    45, 48, 53, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101,
+    100, 32, 65, 99, 99, 101, 115, 115, 32, 69, 110, 102, 111, 114, 99, 101,
+    109, 101, 110, 116, 32, 97, 110, 100, 32, 65, 117, 100, 105, 116, 32, 82,
+    101, 99, 111, 114, 100, 115, 0, 99, 109, 45, 53, 46, 50, 0, 67, 77,
+    45, 48, 53, 40, 48, 50, 41, 0, 99, 109, 45, 53, 46, 51, 0, 67,
+    77, 45, 48, 53, 40, 48, 51, 41, 0, 83, 105, 103, 110, 101, 100, 32,
+    67, 111, 109, 112, 111, 110, 101, 110, 116, 115, 0, 99, 109, 45, 53, 46,
+    52, 0, 67, 77, 45, 48, 53, 40, 48, 52, 41, 0, 99, 109, 45, 53,
+    46, 53, 0, 67, 77, 45, 48, 53, 40, 48, 53, 41, 0, 80, 114, 105,
+    118, 105, 108, 101, 103, 101, 32, 76, 105, 109, 105, 116, 97, 116, 105, 111,
+    110, 32, 102, 111, 114, 32, 80, 114, 111, 100, 117, 99, 116, 105, 111, 110,
+    32, 97, 110, 100, 32, 79, 112, 101, 114, 97, 116, 105, 111, 110, 0, 99,
+    109, 45, 53, 46, 54, 0, 67, 77, 45, 48, 53, 40, 48, 54, 41, 0,
+    76, 105, 109, 105, 116, 32, 76, 105, 98, 114, 97, 114, 121, 32, 80, 114,
+    105, 118, 105, 108, 101, 103, 101, 115, 0, 99, 109, 45, 53, 46, 55, 0,
+    67, 77, 45, 48, 53, 40, 48, 55, 41, 0, 65, 117, 116, 111, 109, 97,
+    116, 105, 99, 32, 73, 109, 112, 108, 101, 109, 101, 110, 116, 97, 116, 105,
+    111, 110, 32, 111, 102, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 83,
+    97, 102, 101, 103, 117, 97, 114, 100, 115, 0, 99, 109, 45, 54, 0, 67,
+    77, 45, 48, 54, 0, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105,
+    111, 110, 32, 83, 101, 116, 116, 105, 110, 103, 115, 0, 99, 109, 45, 54,
+    46, 49, 0, 67, 77, 45, 48, 54, 40, 48, 49, 41, 0, 65, 117, 116,
+    111, 109, 97, 116, 101, 100, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110,
+    116, 44, 32, 65, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 44, 32,
+    97, 110, 100, 32, 86, 101, 114, 105, 102, 105, 99, 97, 116, 105, 111, 110,
+    0, 99, 109, 45, 54, 46, 50, 0, 67, 77, 45, 48, 54, 40, 48, 50,
+    41, 0, 82, 101, 115, 112, 111, 110, 100, 32, 116, 111, 32, 85, 110, 97,
+    117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 67, 104, 97, 110, 103, 101,
+    115, 0, 99, 109, 45, 54, 46, 51, 0, 67, 77, 45, 48, 54, 40, 48,
+    51, 41, 0, 85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32,
+    67, 104, 97, 110, 103, 101, 32, 68, 101, 116, 101, 99, 116, 105, 111, 110,
+    0, 99, 109, 45, 54, 46, 52, 0, 67, 77, 45, 48, 54, 40, 48, 52,
+    41, 0, 67, 111, 110, 102, 111, 114, 109, 97, 110, 99, 101, 32, 68, 101,
+    109, 111, 110, 115, 116, 114, 97, 116, 105, 111, 110, 0, 99, 109, 45, 55,
+    0, 67, 77, 45, 48, 55, 0, 76, 101, 97, 115, 116, 32, 70, 117, 110,
+    99, 116, 105, 111, 110, 97, 108, 105, 116, 121, 0, 99, 109, 45, 55, 46,
+    49, 0, 67, 77, 45, 48, 55, 40, 48, 49, 41, 0, 80, 101, 114, 105,
+    111, 100, 105, 99, 32, 82, 101, 118, 105, 101, 119, 0, 99, 109, 45, 55,
+    46, 50, 0, 67, 77, 45, 48, 55, 40, 48, 50, 41, 0, 80, 114, 101,
+    118, 101, 110, 116, 32, 80, 114, 111, 103, 114, 97, 109, 32, 69, 120, 101,
+    99, 117, 116, 105, 111, 110, 0, 99, 109, 45, 55, 46, 51, 0, 67, 77,
+    45, 48, 55, 40, 48, 51, 41, 0, 82, 101, 103, 105, 115, 116, 114, 97,
+    116, 105, 111, 110, 32, 67, 111, 109, 112, 108, 105, 97, 110, 99, 101, 0,
+    99, 109, 45, 55, 46, 52, 0, 67, 77, 45, 48, 55, 40, 48, 52, 41,
+    0, 85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 83, 111,
+    102, 116, 119, 97, 114, 101, 32, -30, -128, -108, 32, 68, 101, 110, 121, 45,
+    98, 121, 45, 101, 120, 99, 101, 112, 116, 105, 111, 110, 0, 99, 109, 45,
+    55, 46, 53, 0, 67, 77, 45, 48, 55, 40, 48, 53, 41, 0, 65, 117,
+    116, 104, 111, 114, 105, 122, 101, 100, 32, 83, 111, 102, 116, 119, 97, 114,
+    101, 32, -30, -128, -108, 32, 65, 108, 108, 111, 119, 45, 98, 121, 45, 101,
+    120, 99, 101, 112, 116, 105, 111, 110, 0, 99, 109, 45, 55, 46, 54, 0,
+    67, 77, 45, 48, 55, 40, 48, 54, 41, 0, 67, 111, 110, 102, 105, 110,
+    101, 100, 32, 69, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 115, 32,
+    119, 105, 116, 104, 32, 76, 105, 109, 105, 116, 101, 100, 32, 80, 114, 105,
+    118, 105, 108, 101, 103, 101, 115, 0, 99, 109, 45, 55, 46, 55, 0, 67,
+    77, 45, 48, 55, 40, 48, 55, 41, 0, 67, 111, 100, 101, 32, 69, 120,
+    101, 99, 117, 116, 105, 111, 110, 32, 105, 110, 32, 80, 114, 111, 116, 101,
+    99, 116, 101, 100, 32, 69, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116,
+    115, 0, 99, 109, 45, 55, 46, 56, 0, 67, 77, 45, 48, 55, 40, 48,
+    56, 41, 0, 66, 105, 110, 97, 114, 121, 32, 111, 114, 32, 77, 97, 99,
+    104, 105, 110, 101, 32, 69, 120, 101, 99, 117, 116, 97, 98, 108, 101, 32,
+    67, 111, 100, 101, 0, 99, 109, 45, 55, 46, 57, 0, 67, 77, 45, 48,
+    55, 40, 48, 57, 41, 0, 80, 114, 111, 104, 105, 98, 105, 116, 105, 110,
+    103, 32, 84, 104, 101, 32, 85, 115, 101, 32, 111, 102, 32, 85, 110, 97,
+    117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 72, 97, 114, 100, 119, 97,
+    114, 101, 0, 99, 109, 45, 56, 0, 67, 77, 45, 48, 56, 0, 83, 121,
+    115, 116, 101, 109, 32, 67, 111, 109, 112, 111, 110, 101, 110, 116, 32, 73,
+    110, 118, 101, 110, 116, 111, 114, 121, 0, 99, 109, 45, 56, 46, 49, 0,
+    67, 77, 45, 48, 56, 40, 48, 49, 41, 0, 85, 112, 100, 97, 116, 101,
+    115, 32, 68, 117, 114, 105, 110, 103, 32, 73, 110, 115, 116, 97, 108, 108,
+    97, 116, 105, 111, 110, 32, 97, 110, 100, 32, 82, 101, 109, 111, 118, 97,
+    108, 0, 99, 109, 45, 56, 46, 50, 0, 67, 77, 45, 48, 56, 40, 48,
+    50, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 77, 97, 105,
+    110, 116, 101, 110, 97, 110, 99, 101, 0, 99, 109, 45, 56, 46, 51, 0,
+    67, 77, 45, 48, 56, 40, 48, 51, 41, 0, 65, 117, 116, 111, 109, 97,
+    116, 101, 100, 32, 85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100,
+    32, 67, 111, 109, 112, 111, 110, 101, 110, 116, 32, 68, 101, 116, 101, 99,
+    116, 105, 111, 110, 0, 99, 109, 45, 56, 46, 52, 0, 67, 77, 45, 48,
+    56, 40, 48, 52, 41, 0, 65, 99, 99, 111, 117, 110, 116, 97, 98, 105,
+    108, 105, 116, 121, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110,
+    0, 99, 109, 45, 56, 46, 53, 0, 67, 77, 45, 48, 56, 40, 48, 53,
+    41, 0, 78, 111, 32, 68, 117, 112, 108, 105, 99, 97, 116, 101, 32, 65,
+    99, 99, 111, 117, 110, 116, 105, 110, 103, 32, 111, 102, 32, 67, 111, 109,
+    112, 111, 110, 101, 110, 116, 115, 0, 99, 109, 45, 56, 46, 54, 0, 67,
+    77, 45, 48, 56, 40, 48, 54, 41, 0, 65, 115, 115, 101, 115, 115, 101,
+    100, 32, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 115,
+    32, 97, 110, 100, 32, 65, 112, 112, 114, 111, 118, 101, 100, 32, 68, 101,
+    118, 105, 97, 116, 105, 111, 110, 115, 0, 99, 109, 45, 56, 46, 55, 0,
+    67, 77, 45, 48, 56, 40, 48, 55, 41, 0, 67, 101, 110, 116, 114, 97,
+    108, 105, 122, 101, 100, 32, 82, 101, 112, 111, 115, 105, 116, 111, 114, 121,
+    0, 99, 109, 45, 56, 46, 56, 0, 67, 77, 45, 48, 56, 40, 48, 56,
+    41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 76, 111, 99, 97,
+    116, 105, 111, 110, 32, 84, 114, 97, 99, 107, 105, 110, 103, 0, 99, 109,
+    45, 56, 46, 57, 0, 67, 77, 45, 48, 56, 40, 48, 57, 41, 0, 65,
+    115, 115, 105, 103, 110, 109, 101, 110, 116, 32, 111, 102, 32, 67, 111, 109,
+    112, 111, 110, 101, 110, 116, 115, 32, 116, 111, 32, 83, 121, 115, 116, 101,
+    109, 115, 0, 99, 109, 45, 57, 0, 67, 77, 45, 48, 57, 0, 67, 111,
+    110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 77, 97, 110, 97,
+    103, 101, 109, 101, 110, 116, 32, 80, 108, 97, 110, 0, 99, 109, 45, 57,
+    46, 49, 0, 67, 77, 45, 48, 57, 40, 48, 49, 41, 0, 65, 115, 115,
+    105, 103, 110, 109, 101, 110, 116, 32, 111, 102, 32, 82, 101, 115, 112, 111,
+    110, 115, 105, 98, 105, 108, 105, 116, 121, 0, 99, 109, 45, 49, 48, 0,
+    67, 77, 45, 49, 48, 0, 83, 111, 102, 116, 119, 97, 114, 101, 32, 85,
+    115, 97, 103, 101, 32, 82, 101, 115, 116, 114, 105, 99, 116, 105, 111, 110,
+    115, 0, 99, 109, 45, 49, 48, 46, 49, 0, 67, 77, 45, 49, 48, 40,
+    48, 49, 41, 0, 79, 112, 101, 110, 45, 115, 111, 117, 114, 99, 101, 32,
+    83, 111, 102, 116, 119, 97, 114, 101, 0, 99, 109, 45, 49, 49, 0, 67,
+    77, 45, 49, 49, 0, 85, 115, 101, 114, 45, 105, 110, 115, 116, 97, 108,
+    108, 101, 100, 32, 83, 111, 102, 116, 119, 97, 114, 101, 0, 99, 109, 45,
+    49, 49, 46, 49, 0, 67, 77, 45, 49, 49, 40, 48, 49, 41, 0, 65,
+    108, 101, 114, 116, 115, 32, 102, 111, 114, 32, 85, 110, 97, 117, 116, 104,
+    111, 114, 105, 122, 101, 100, 32, 73, 110, 115, 116, 97, 108, 108, 97, 116,
+    105, 111, 110, 115, 0, 99, 109, 45, 49, 49, 46, 50, 0, 67, 77, 45,
+    49, 49, 40, 48, 50, 41, 0, 83, 111, 102, 116, 119, 97, 114, 101, 32,
+    73, 110, 115, 116, 97, 108, 108, 97, 116, 105, 111, 110, 32, 119, 105, 116,
+    104, 32, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 83, 116, 97,
+    116, 117, 115, 0, 99, 109, 45, 49, 49, 46, 51, 0, 67, 77, 45, 49,
+    49, 40, 48, 51, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32,
+    69, 110, 102, 111, 114, 99, 101, 109, 101, 110, 116, 32, 97, 110, 100, 32,
+    77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 0, 99, 109, 45, 49, 50,
+    0, 67, 77, 45, 49, 50, 0, 73, 110, 102, 111, 114, 109, 97, 116, 105,
+    111, 110, 32, 76, 111, 99, 97, 116, 105, 111, 110, 0, 99, 109, 45, 49,
+    50, 46, 49, 0, 67, 77, 45, 49, 50, 40, 48, 49, 41, 0, 65, 117,
+    116, 111, 109, 97, 116, 101, 100, 32, 84, 111, 111, 108, 115, 32, 116, 111,
+    32, 83, 117, 112, 112, 111, 114, 116, 32, 73, 110, 102, 111, 114, 109, 97,
+    116, 105, 111, 110, 32, 76, 111, 99, 97, 116, 105, 111, 110, 0, 99, 109,
+    45, 49, 51, 0, 67, 77, 45, 49, 51, 0, 68, 97, 116, 97, 32, 65,
+    99, 116, 105, 111, 110, 32, 77, 97, 112, 112, 105, 110, 103, 0, 99, 109,
+    45, 49, 52, 0, 67, 77, 45, 49, 52, 0, 99, 112, 45, 49, 0, 67,
+    80, 45, 48, 49, 0, 67, 111, 110, 116, 105, 110, 103, 101, 110, 99, 121,
+    32, 80, 108, 97, 110, 110, 105, 110, 103, 0, 99, 112, 45, 50, 0, 67,
+    80, 45, 48, 50, 0, 67, 111, 110, 116, 105, 110, 103, 101, 110, 99, 121,
+    32, 80, 108, 97, 110, 0, 99, 112, 45, 50, 46, 49, 0, 67, 80, 45,
+    48, 50, 40, 48, 49, 41, 0, 67, 111, 111, 114, 100, 105, 110, 97, 116,
+    101, 32, 119, 105, 116, 104, 32, 82, 101, 108, 97, 116, 101, 100, 32, 80,
+    108, 97, 110, 115, 0, 99, 112, 45, 50, 46, 50, 0, 67, 80, 45, 48,
+    50, 40, 48, 50, 41, 0, 67, 97, 112, 97, 99, 105, 116, 121, 32, 80,
+    108, 97, 110, 110, 105, 110, 103, 0, 99, 112, 45, 50, 46, 51, 0, 67,
+    80, 45, 48, 50, 40, 48, 51, 41, 0, 82, 101, 115, 117, 109, 101, 32,
+    77, 105, 115, 115, 105, 111, 110, 32, 97, 110, 100, 32, 66, 117, 115, 105,
+    110, 101, 115, 115, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 0, 99,
+    112, 45, 50, 46, 52, 0, 67, 80, 45, 48, 50, 40, 48, 52, 41, 0,
+    82, 101, 115, 117, 109, 101, 32, 65, 108, 108, 32, 77, 105, 115, 115, 105,
+    111, 110, 32, 97, 110, 100, 32, 66, 117, 115, 105, 110, 101, 115, 115, 32,
+    70, 117, 110, 99, 116, 105, 111, 110, 115, 0, 99, 112, 45, 50, 46, 53,
+    0, 67, 80, 45, 48, 50, 40, 48, 53, 41, 0, 67, 111, 110, 116, 105,
+    110, 117, 101, 32, 77, 105, 115, 115, 105, 111, 110, 32, 97, 110, 100, 32,
+    66, 117, 115, 105, 110, 101, 115, 115, 32, 70, 117, 110, 99, 116, 105, 111,
+    110, 115, 0, 99, 112, 45, 50, 46, 54, 0, 67, 80, 45, 48, 50, 40,
+    48, 54, 41, 0, 65, 108, 116, 101, 114, 110, 97, 116, 101, 32, 80, 114,
+    111, 99, 101, 115, 115, 105, 110, 103, 32, 97, 110, 100, 32, 83, 116, 111,
+    114, 97, 103, 101, 32, 83, 105, 116, 101, 115, 0, 99, 112, 45, 50, 46,
+    55, 0, 67, 80, 45, 48, 50, 40, 48, 55, 41, 0, 67, 111, 111, 114,
+    100, 105, 110, 97, 116, 101, 32, 119, 105, 116, 104, 32, 69, 120, 116, 101,
+    114, 110, 97, 108, 32, 83, 101, 114, 118, 105, 99, 101, 32, 80, 114, 111,
+    118, 105, 100, 101, 114, 115, 0, 99, 112, 45, 50, 46, 56, 0, 67, 80,
+    45, 48, 50, 40, 48, 56, 41, 0, 73, 100, 101, 110, 116, 105, 102, 121,
+    32, 67, 114, 105, 116, 105, 99, 97, 108, 32, 65, 115, 115, 101, 116, 115,
+    0, 99, 112, 45, 51, 0, 67, 80, 45, 48, 51, 0, 67, 111, 110, 116,
+    105, 110, 103, 101, 110, 99, 121, 32, 84, 114, 97, 105, 110, 105, 110, 103,
+    0, 99, 112, 45, 51, 46, 49, 0, 67, 80, 45, 48, 51, 40, 48, 49,
+    41, 0, 83, 105, 109, 117, 108, 97, 116, 101, 100, 32, 69, 118, 101, 110,
+    116, 115, 0, 99, 112, 45, 51, 46, 50, 0, 67, 80, 45, 48, 51, 40,
+    48, 50, 41, 0, 77, 101, 99, 104, 97, 110, 105, 115, 109, 115, 32, 85,
+    115, 101, 100, 32, 105, 110, 32, 84, 114, 97, 105, 110, 105, 110, 103, 32,
+    69, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 115, 0, 99, 112, 45,
+    52, 0, 67, 80, 45, 48, 52, 0, 67, 111, 110, 116, 105, 110, 103, 101,
+    110, 99, 121, 32, 80, 108, 97, 110, 32, 84, 101, 115, 116, 105, 110, 103,
+    0, 99, 112, 45, 52, 46, 49, 0, 67, 80, 45, 48, 52, 40, 48, 49,
+    41, 0, 99, 112, 45, 52, 46, 50, 0, 67, 80, 45, 48, 52, 40, 48,
+    50, 41, 0, 65, 108, 116, 101, 114, 110, 97, 116, 101, 32, 80, 114, 111,
+    99, 101, 115, 115, 105, 110, 103, 32, 83, 105, 116, 101, 0, 99, 112, 45,
+    52, 46, 51, 0, 67, 80, 45, 48, 52, 40, 48, 51, 41, 0, 65, 117,
+    116, 111, 109, 97, 116, 101, 100, 32, 84, 101, 115, 116, 105, 110, 103, 0,
+    99, 112, 45, 52, 46, 52, 0, 67, 80, 45, 48, 52, 40, 48, 52, 41,
+    0, 70, 117, 108, 108, 32, 82, 101, 99, 111, 118, 101, 114, 121, 32, 97,
+    110, 100, 32, 82, 101, 99, 111, 110, 115, 116, 105, 116, 117, 116, 105, 111,
+    110, 0, 99, 112, 45, 52, 46, 53, 0, 67, 80, 45, 48, 52, 40, 48,
+    53, 41, 0, 83, 101, 108, 102, 45, 99, 104, 97, 108, 108, 101, 110, 103,
+    101, 0, 99, 112, 45, 53, 0, 67, 80, 45, 48, 53, 0, 67, 111, 110,
+    116, 105, 110, 103, 101, 110, 99, 121, 32, 80, 108, 97, 110, 32, 85, 112,
+    100, 97, 116, 101, 0, 99, 112, 45, 54, 0, 67, 80, 45, 48, 54, 0,
+    65, 108, 116, 101, 114, 110, 97, 116, 101, 32, 83, 116, 111, 114, 97, 103,
+    101, 32, 83, 105, 116, 101, 0, 99, 112, 45, 54, 46, 49, 0, 67, 80,
+    45, 48, 54, 40, 48, 49, 41, 0, 83, 101, 112, 97, 114, 97, 116, 105,
+    111, 110, 32, 102, 114, 111, 109, 32, 80, 114, 105, 109, 97, 114, 121, 32,
+    83, 105, 116, 101, 0, 99, 112, 45, 54, 46, 50, 0, 67, 80, 45, 48,
+    54, 40, 48, 50, 41, 0, 82, 101, 99, 111, 118, 101, 114, 121, 32, 84,
+    105, 109, 101, 32, 97, 110, 100, 32, 82, 101, 99, 111, 118, 101, 114, 121,
+    32, 80, 111, 105, 110, 116, 32, 79, 98, 106, 101, 99, 116, 105, 118, 101,
+    115, 0, 99, 112, 45, 54, 46, 51, 0, 67, 80, 45, 48, 54, 40, 48,
+    51, 41, 0, 65, 99, 99, 101, 115, 115, 105, 98, 105, 108, 105, 116, 121,
+    0, 99, 112, 45, 55, 0, 67, 80, 45, 48, 55, 0, 99, 112, 45, 55,
+    46, 49, 0, 67, 80, 45, 48, 55, 40, 48, 49, 41, 0, 99, 112, 45,
+    55, 46, 50, 0, 67, 80, 45, 48, 55, 40, 48, 50, 41, 0, 99, 112,
+    45, 55, 46, 51, 0, 67, 80, 45, 48, 55, 40, 48, 51, 41, 0, 80,
+    114, 105, 111, 114, 105, 116, 121, 32, 111, 102, 32, 83, 101, 114, 118, 105,
+    99, 101, 0, 99, 112, 45, 55, 46, 52, 0, 67, 80, 45, 48, 55, 40,
+    48, 52, 41, 0, 80, 114, 101, 112, 97, 114, 97, 116, 105, 111, 110, 32,
+    102, 111, 114, 32, 85, 115, 101, 0, 99, 112, 45, 55, 46, 53, 0, 67,
+    80, 45, 48, 55, 40, 48, 53, 41, 0, 69, 113, 117, 105, 118, 97, 108,
+    101, 110, 116, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32,
+    83, 101, 99, 117, 114, 105, 116, 121, 32, 83, 97, 102, 101, 103, 117, 97,
+    114, 100, 115, 0, 99, 112, 45, 55, 46, 54, 0, 67, 80, 45, 48, 55,
+    40, 48, 54, 41, 0, 73, 110, 97, 98, 105, 108, 105, 116, 121, 32, 116,
+    111, 32, 82, 101, 116, 117, 114, 110, 32, 116, 111, 32, 80, 114, 105, 109,
+    97, 114, 121, 32, 83, 105, 116, 101, 0, 99, 112, 45, 56, 0, 67, 80,
+    45, 48, 56, 0, 84, 101, 108, 101, 99, 111, 109, 109, 117, 110, 105, 99,
+    97, 116, 105, 111, 110, 115, 32, 83, 101, 114, 118, 105, 99, 101, 115, 0,
+    99, 112, 45, 56, 46, 49, 0, 67, 80, 45, 48, 56, 40, 48, 49, 41,
+    0, 80, 114, 105, 111, 114, 105, 116, 121, 32, 111, 102, 32, 83, 101, 114,
+    118, 105, 99, 101, 32, 80, 114, 111, 118, 105, 115, 105, 111, 110, 115, 0,
+    99, 112, 45, 56, 46, 50, 0, 67, 80, 45, 48, 56, 40, 48, 50, 41,
+    0, 83, 105, 110, 103, 108, 101, 32, 80, 111, 105, 110, 116, 115, 32, 111,
+    102, 32, 70, 97, 105, 108, 117, 114, 101, 0, 99, 112, 45, 56, 46, 51,
+    0, 67, 80, 45, 48, 56, 40, 48, 51, 41, 0, 83, 101, 112, 97, 114,
+    97, 116, 105, 111, 110, 32, 111, 102, 32, 80, 114, 105, 109, 97, 114, 121,
+    32, 97, 110, 100, 32, 65, 108, 116, 101, 114, 110, 97, 116, 101, 32, 80,
+    114, 111, 118, 105, 100, 101, 114, 115, 0, 99, 112, 45, 56, 46, 52, 0,
+    67, 80, 45, 48, 56, 40, 48, 52, 41, 0, 80, 114, 111, 118, 105, 100,
+    101, 114, 32, 67, 111, 110, 116, 105, 110, 103, 101, 110, 99, 121, 32, 80,
+    108, 97, 110, 0, 99, 112, 45, 56, 46, 53, 0, 67, 80, 45, 48, 56,
+    40, 48, 53, 41, 0, 65, 108, 116, 101, 114, 110, 97, 116, 101, 32, 84,
+    101, 108, 101, 99, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110,
+    32, 83, 101, 114, 118, 105, 99, 101, 32, 84, 101, 115, 116, 105, 110, 103,
+    0, 99, 112, 45, 57, 0, 67, 80, 45, 48, 57, 0, 83, 121, 115, 116,
+    101, 109, 32, 66, 97, 99, 107, 117, 112, 0, 99, 112, 45, 57, 46, 49,
+    0, 67, 80, 45, 48, 57, 40, 48, 49, 41, 0, 84, 101, 115, 116, 105,
+    110, 103, 32, 102, 111, 114, 32, 82, 101, 108, 105, 97, 98, 105, 108, 105,
+    116, 121, 32, 97, 110, 100, 32, 73, 110, 116, 101, 103, 114, 105, 116, 121,
+    0, 99, 112, 45, 57, 46, 50, 0, 67, 80, 45, 48, 57, 40, 48, 50,
+    41, 0, 84, 101, 115, 116, 32, 82, 101, 115, 116, 111, 114, 97, 116, 105,
+    111, 110, 32, 85, 115, 105, 110, 103, 32, 83, 97, 109, 112, 108, 105, 110,
+    103, 0, 99, 112, 45, 57, 46, 51, 0, 67, 80, 45, 48, 57, 40, 48,
+    51, 41, 0, 83, 101, 112, 97, 114, 97, 116, 101, 32, 83, 116, 111, 114,
+    97, 103, 101, 32, 102, 111, 114, 32, 67, 114, 105, 116, 105, 99, 97, 108,
+    32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 99, 112, 45,
+    57, 46, 52, 0, 67, 80, 45, 48, 57, 40, 48, 52, 41, 0, 80, 114,
+    111, 116, 101, 99, 116, 105, 111, 110, 32, 102, 114, 111, 109, 32, 85, 110,
+    97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 77, 111, 100, 105, 102,
+    105, 99, 97, 116, 105, 111, 110, 0, 99, 112, 45, 57, 46, 53, 0, 67,
+    80, 45, 48, 57, 40, 48, 53, 41, 0, 84, 114, 97, 110, 115, 102, 101,
+    114, 32, 116, 111, 32, 65, 108, 116, 101, 114, 110, 97, 116, 101, 32, 83,
+    116, 111, 114, 97, 103, 101, 32, 83, 105, 116, 101, 0, 99, 112, 45, 57,
+    46, 54, 0, 67, 80, 45, 48, 57, 40, 48, 54, 41, 0, 82, 101, 100,
+    117, 110, 100, 97, 110, 116, 32, 83, 101, 99, 111, 110, 100, 97, 114, 121,
+    32, 83, 121, 115, 116, 101, 109, 0, 99, 112, 45, 57, 46, 55, 0, 67,
+    80, 45, 48, 57, 40, 48, 55, 41, 0, 68, 117, 97, 108, 32, 65, 117,
+    116, 104, 111, 114, 105, 122, 97, 116, 105, 111, 110, 32, 102, 111, 114, 32,
+    68, 101, 108, 101, 116, 105, 111, 110, 32, 111, 114, 32, 68, 101, 115, 116,
+    114, 117, 99, 116, 105, 111, 110, 0, 99, 112, 45, 57, 46, 56, 0, 67,
+    80, 45, 48, 57, 40, 48, 56, 41, 0, 99, 112, 45, 49, 48, 0, 67,
+    80, 45, 49, 48, 0, 83, 121, 115, 116, 101, 109, 32, 82, 101, 99, 111,
+    118, 101, 114, 121, 32, 97, 110, 100, 32, 82, 101, 99, 111, 110, 115, 116,
+    105, 116, 117, 116, 105, 111, 110, 0, 99, 112, 45, 49, 48, 46, 49, 0,
+    67, 80, 45, 49, 48, 40, 48, 49, 41, 0, 99, 112, 45, 49, 48, 46,
+    50, 0, 67, 80, 45, 49, 48, 40, 48, 50, 41, 0, 84, 114, 97, 110,
+    115, 97, 99, 116, 105, 111, 110, 32, 82, 101, 99, 111, 118, 101, 114, 121,
+    0, 99, 112, 45, 49, 48, 46, 51, 0, 67, 80, 45, 49, 48, 40, 48,
+    51, 41, 0, 67, 111, 109, 112, 101, 110, 115, 97, 116, 105, 110, 103, 32,
+    83, 101, 99, 117, 114, 105, 116, 121, 32, 67, 111, 110, 116, 114, 111, 108,
+    115, 0, 99, 112, 45, 49, 48, 46, 52, 0, 67, 80, 45, 49, 48, 40,
+    48, 52, 41, 0, 82, 101, 115, 116, 111, 114, 101, 32, 87, 105, 116, 104,
+    105, 110, 32, 84, 105, 109, 101, 32, 80, 101, 114, 105, 111, 100, 0, 99,
+    112, 45, 49, 48, 46, 53, 0, 67, 80, 45, 49, 48, 40, 48, 53, 41,
+    0, 70, 97, 105, 108, 111, 118, 101, 114, 32, 67, 97, 112, 97, 98, 105,
+    108, 105, 116, 121, 0, 99, 112, 45, 49, 48, 46, 54, 0, 67, 80, 45,
+    49, 48, 40, 48, 54, 41, 0, 67, 111, 109, 112, 111, 110, 101, 110, 116,
+    32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 99, 112, 45, 49,
+    49, 0, 67, 80, 45, 49, 49, 0, 65, 108, 116, 101, 114, 110, 97, 116,
+    101, 32, 67, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110, 115,
+    32, 80, 114, 111, 116, 111, 99, 111, 108, 115, 0, 99, 112, 45, 49, 50,
+    0, 67, 80, 45, 49, 50, 0, 83, 97, 102, 101, 32, 77, 111, 100, 101,
+    0, 99, 112, 45, 49, 51, 0, 67, 80, 45, 49, 51, 0, 65, 108, 116,
+    101, 114, 110, 97, 116, 105, 118, 101, 32, 83, 101, 99, 117, 114, 105, 116,
+    121, 32, 77, 101, 99, 104, 97, 110, 105, 115, 109, 115, 0, 105, 97, 45,
+    49, 0, 73, 65, 45, 48, 49, 0, 73, 100, 101, 110, 116, 105, 102, 105,
+    99, 97, 116, 105, 111, 110, 32, 97, 110, 100, 32, 65, 117, 116, 104, 101,
+    110, 116, 105, 99, 97, 116, 105, 111, 110, 0, 105, 97, 45, 50, 0, 73,
+    65, 45, 48, 50, 0, 73, 100, 101, 110, 116, 105, 102, 105, 99, 97, 116,
+    105, 111, 110, 32, 97, 110, 100, 32, 65, 117, 116, 104, 101, 110, 116, 105,
+    99, 97, 116, 105, 111, 110, 32, 40, 79, 114, 103, 97, 110, 105, 122, 97,
+    116, 105, 111, 110, 97, 108, 32, 85, 115, 101, 114, 115, 41, 0, 105, 97,
+    45, 50, 46, 49, 0, 73, 65, 45, 48, 50, 40, 48, 49, 41, 0, 77,
+    117, 108, 116, 105, 45, 102, 97, 99, 116, 111, 114, 32, 65, 117, 116, 104,
+    101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 32, 116, 111, 32, 80, 114,
+    105, 118, 105, 108, 101, 103, 101, 100, 32, 65, 99, 99, 111, 117, 110, 116,
+    115, 0, 105, 97, 45, 50, 46, 50, 0, 73, 65, 45, 48, 50, 40, 48,
+    50, 41, 0, 77, 117, 108, 116, 105, 45, 102, 97, 99, 116, 111, 114, 32,
+    65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 32, 116,
+    111, 32, 78, 111, 110, 45, 112, 114, 105, 118, 105, 108, 101, 103, 101, 100,
+    32, 65, 99, 99, 111, 117, 110, 116, 115, 0, 105, 97, 45, 50, 46, 51,
+    0, 73, 65, 45, 48, 50, 40, 48, 51, 41, 0, 76, 111, 99, 97, 108,
+    32, 65, 99, 99, 101, 115, 115, 32, 116, 111, 32, 80, 114, 105, 118, 105,
+    108, 101, 103, 101, 100, 32, 65, 99, 99, 111, 117, 110, 116, 115, 0, 105,
+    97, 45, 50, 46, 52, 0, 73, 65, 45, 48, 50, 40, 48, 52, 41, 0,
+    76, 111, 99, 97, 108, 32, 65, 99, 99, 101, 115, 115, 32, 116, 111, 32,
+    78, 111, 110, 45, 112, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 65,
+    99, 99, 111, 117, 110, 116, 115, 0, 105, 97, 45, 50, 46, 53, 0, 73,
+    65, 45, 48, 50, 40, 48, 53, 41, 0, 73, 110, 100, 105, 118, 105, 100,
+    117, 97, 108, 32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105,
+    111, 110, 32, 119, 105, 116, 104, 32, 71, 114, 111, 117, 112, 32, 65, 117,
+    116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 0, 105, 97, 45,
+    50, 46, 54, 0, 73, 65, 45, 48, 50, 40, 48, 54, 41, 0, 65, 99,
+    99, 101, 115, 115, 32, 116, 111, 32, 65, 99, 99, 111, 117, 110, 116, 115,
+    32, -30, -128, -108, 115, 101, 112, 97, 114, 97, 116, 101, 32, 68, 101, 118,
+    105, 99, 101, 0, 105, 97, 45, 50, 46, 55, 0, 73, 65, 45, 48, 50,
+    40, 48, 55, 41, 0, 78, 101, 116, 119, 111, 114, 107, 32, 65, 99, 99,
+    101, 115, 115, 32, 116, 111, 32, 78, 111, 110, 45, 112, 114, 105, 118, 105,
+    108, 101, 103, 101, 100, 32, 65, 99, 99, 111, 117, 110, 116, 115, 32, -30,
+    -128, -108, 32, 83, 101, 112, 97, 114, 97, 116, 101, 32, 68, 101, 118, 105,
+    99, 101, 0, 105, 97, 45, 50, 46, 56, 0, 73, 65, 45, 48, 50, 40,
+    48, 56, 41, 0, 65, 99, 99, 101, 115, 115, 32, 116, 111, 32, 65, 99,
+    99, 111, 117, 110, 116, 115, 32, -30, -128, -108, 32, 82, 101, 112, 108, 97,
+    121, 32, 82, 101, 115, 105, 115, 116, 97, 110, 116, 0, 105, 97, 45, 50,
+    46, 57, 0, 73, 65, 45, 48, 50, 40, 48, 57, 41, 0, 78, 101, 116,
+    119, 111, 114, 107, 32, 65, 99, 99, 101, 115, 115, 32, 116, 111, 32, 78,
+    111, 110, 45, 112, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 65, 99,
+    99, 111, 117, 110, 116, 115, 32, -30, -128, -108, 32, 82, 101, 112, 108, 97,
+    121, 32, 82, 101, 115, 105, 115, 116, 97, 110, 116, 0, 105, 97, 45, 50,
+    46, 49, 48, 0, 73, 65, 45, 48, 50, 40, 49, 48, 41, 0, 83, 105,
+    110, 103, 108, 101, 32, 83, 105, 103, 110, 45, 111, 110, 0, 105, 97, 45,
+    50, 46, 49, 49, 0, 73, 65, 45, 48, 50, 40, 49, 49, 41, 0, 82,
+    101, 109, 111, 116, 101, 32, 65, 99, 99, 101, 115, 115, 32, -30, -128, -108,
+    32, 83, 101, 112, 97, 114, 97, 116, 101, 32, 68, 101, 118, 105, 99, 101,
+    0, 105, 97, 45, 50, 46, 49, 50, 0, 73, 65, 45, 48, 50, 40, 49,
+    50, 41, 0, 65, 99, 99, 101, 112, 116, 97, 110, 99, 101, 32, 111, 102,
+    32, 80, 73, 86, 32, 67, 114, 101, 100, 101, 110, 116, 105, 97, 108, 115,
+    0, 105, 97, 45, 50, 46, 49, 51, 0, 73, 65, 45, 48, 50, 40, 49,
+    51, 41, 0, 79, 117, 116, 45, 111, 102, 45, 98, 97, 110, 100, 32, 65,
+    117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 0, 105, 97,
+    45, 51, 0, 73, 65, 45, 48, 51, 0, 68, 101, 118, 105, 99, 101, 32,
+    73, 100, 101, 110, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110, 32, 97,
+    110, 100, 32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111,
+    110, 0, 105, 97, 45, 51, 46, 49, 0, 73, 65, 45, 48, 51, 40, 48,
+    49, 41, 0, 67, 114, 121, 112, 116, 111, 103, 114, 97, 112, 104, 105, 99,
+    32, 66, 105, 100, 105, 114, 101, 99, 116, 105, 111, 110, 97, 108, 32, 65,
+    117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 0, 105, 97,
+    45, 51, 46, 50, 0, 73, 65, 45, 48, 51, 40, 48, 50, 41, 0, 67,
+    114, 121, 112, 116, 111, 103, 114, 97, 112, 104, 105, 99, 32, 66, 105, 100,
+    105, 114, 101, 99, 116, 105, 111, 110, 97, 108, 32, 78, 101, 116, 119, 111,
+    114, 107, 32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111,
+    110, 0, 105, 97, 45, 51, 46, 51, 0, 73, 65, 45, 48, 51, 40, 48,
+    51, 41, 0, 68, 121, 110, 97, 109, 105, 99, 32, 65, 100, 100, 114, 101,
+    115, 115, 32, 65, 108, 108, 111, 99, 97, 116, 105, 111, 110, 0, 105, 97,
+    45, 51, 46, 52, 0, 73, 65, 45, 48, 51, 40, 48, 52, 41, 0, 68,
+    101, 118, 105, 99, 101, 32, 65, 116, 116, 101, 115, 116, 97, 116, 105, 111,
+    110, 0, 105, 97, 45, 52, 0, 73, 65, 45, 48, 52, 0, 73, 100, 101,
+    110, 116, 105, 102, 105, 101, 114, 32, 77, 97, 110, 97, 103, 101, 109, 101,
+    110, 116, 0, 105, 97, 45, 52, 46, 49, 0, 73, 65, 45, 48, 52, 40,
+    48, 49, 41, 0, 80, 114, 111, 104, 105, 98, 105, 116, 32, 65, 99, 99,
+    111, 117, 110, 116, 32, 73, 100, 101, 110, 116, 105, 102, 105, 101, 114, 115,
+    32, 97, 115, 32, 80, 117, 98, 108, 105, 99, 32, 73, 100, 101, 110, 116,
+    105, 102, 105, 101, 114, 115, 0, 105, 97, 45, 52, 46, 50, 0, 73, 65,
+    45, 48, 52, 40, 48, 50, 41, 0, 83, 117, 112, 101, 114, 118, 105, 115,
+    111, 114, 32, 65, 117, 116, 104, 111, 114, 105, 122, 97, 116, 105, 111, 110,
+    0, 105, 97, 45, 52, 46, 51, 0, 73, 65, 45, 48, 52, 40, 48, 51,
+    41, 0, 77, 117, 108, 116, 105, 112, 108, 101, 32, 70, 111, 114, 109, 115,
+    32, 111, 102, 32, 67, 101, 114, 116, 105, 102, 105, 99, 97, 116, 105, 111,
+    110, 0, 105, 97, 45, 52, 46, 52, 0, 73, 65, 45, 48, 52, 40, 48,
+    52, 41, 0, 73, 100, 101, 110, 116, 105, 102, 121, 32, 85, 115, 101, 114,
+    32, 83, 116, 97, 116, 117, 115, 0, 105, 97, 45, 52, 46, 53, 0, 73,
+    65, 45, 48, 52, 40, 48, 53, 41, 0, 68, 121, 110, 97, 109, 105, 99,
+    32, 77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 105, 97, 45, 52,
+    46, 54, 0, 73, 65, 45, 48, 52, 40, 48, 54, 41, 0, 67, 114, 111,
+    115, 115, 45, 111, 114, 103, 97, 110, 105, 122, 97, 116, 105, 111, 110, 32,
+    77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 105, 97, 45, 52, 46,
+    55, 0, 73, 65, 45, 48, 52, 40, 48, 55, 41, 0, 73, 110, 45, 112,
+    101, 114, 115, 111, 110, 32, 82, 101, 103, 105, 115, 116, 114, 97, 116, 105,
+    111, 110, 0, 105, 97, 45, 52, 46, 56, 0, 73, 65, 45, 48, 52, 40,
+    48, 56, 41, 0, 80, 97, 105, 114, 119, 105, 115, 101, 32, 80, 115, 101,
+    117, 100, 111, 110, 121, 109, 111, 117, 115, 32, 73, 100, 101, 110, 116, 105,
+    102, 105, 101, 114, 115, 0, 105, 97, 45, 52, 46, 57, 0, 73, 65, 45,
+    48, 52, 40, 48, 57, 41, 0, 65, 116, 116, 114, 105, 98, 117, 116, 101,
+    32, 77, 97, 105, 110, 116, 101, 110, 97, 110, 99, 101, 32, 97, 110, 100,
+    32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 105, 97, 45, 53,
+    0, 73, 65, 45, 48, 53, 0, 65, 117, 116, 104, 101, 110, 116, 105, 99,
+    97, 116, 111, 114, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 0,
+    105, 97, 45, 53, 46, 49, 0, 73, 65, 45, 48, 53, 40, 48, 49, 41,
+    0, 80, 97, 115, 115, 119, 111, 114, 100, 45, 98, 97, 115, 101, 100, 32,
+    65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 0, 105,
+    97, 45, 53, 46, 50, 0, 73, 65, 45, 48, 53, 40, 48, 50, 41, 0,
+    80, 117, 98, 108, 105, 99, 32, 75, 101, 121, 45, 98, 97, 115, 101, 100,
+    32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 0,
+    105, 97, 45, 53, 46, 51, 0, 73, 65, 45, 48, 53, 40, 48, 51, 41,
+    0, 73, 110, 45, 112, 101, 114, 115, 111, 110, 32, 111, 114, 32, 84, 114,
+    117, 115, 116, 101, 100, 32, 69, 120, 116, 101, 114, 110, 97, 108, 32, 80,
+    97, 114, 116, 121, 32, 82, 101, 103, 105, 115, 116, 114, 97, 116, 105, 111,
+    110, 0, 105, 97, 45, 53, 46, 52, 0, 73, 65, 45, 48, 53, 40, 48,
+    52, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 83, 117, 112,
+    112, 111, 114, 116, 32, 102, 111, 114, 32, 80, 97, 115, 115, 119, 111, 114,
+    100, 32, 83, 116, 114, 101, 110, 103, 116, 104, 32, 68, 101, 116, 101, 114,
+    109, 105, 110, 97, 116, 105, 111, 110, 0, 105, 97, 45, 53, 46, 53, 0,
+    73, 65, 45, 48, 53, 40, 48, 53, 41, 0, 67, 104, 97, 110, 103, 101,
+    32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 111, 114, 115, 32,
+    80, 114, 105, 111, 114, 32, 116, 111, 32, 68, 101, 108, 105, 118, 101, 114,
+    121, 0, 105, 97, 45, 53, 46, 54, 0, 73, 65, 45, 48, 53, 40, 48,
+    54, 41, 0, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 32, 111, 102,
+    32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 111, 114, 115, 0,
+    105, 97, 45, 53, 46, 55, 0, 73, 65, 45, 48, 53, 40, 48, 55, 41,
+    0, 78, 111, 32, 69, 109, 98, 101, 100, 100, 101, 100, 32, 85, 110, 101,
+    110, 99, 114, 121, 112, 116, 101, 100, 32, 83, 116, 97, 116, 105, 99, 32,
+    65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 111, 114, 115, 0, 105,
+    97, 45, 53, 46, 56, 0, 73, 65, 45, 48, 53, 40, 48, 56, 41, 0,
+    77, 117, 108, 116, 105, 112, 108, 101, 32, 83, 121, 115, 116, 101, 109, 32,
+    65, 99, 99, 111, 117, 110, 116, 115, 0, 105, 97, 45, 53, 46, 57, 0,
+    73, 65, 45, 48, 53, 40, 48, 57, 41, 0, 70, 101, 100, 101, 114, 97,
+    116, 101, 100, 32, 67, 114, 101, 100, 101, 110, 116, 105, 97, 108, 32, 77,
+    97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 105, 97, 45, 53, 46, 49,
+    48, 0, 73, 65, 45, 48, 53, 40, 49, 48, 41, 0, 68, 121, 110, 97,
+    109, 105, 99, 32, 67, 114, 101, 100, 101, 110, 116, 105, 97, 108, 32, 66,
+    105, 110, 100, 105, 110, 103, 0, 105, 97, 45, 53, 46, 49, 49, 0, 73,
+    65, 45, 48, 53, 40, 49, 49, 41, 0, 72, 97, 114, 100, 119, 97, 114,
+    101, 32, 84, 111, 107, 101, 110, 45, 98, 97, 115, 101, 100, 32, 65, 117,
+    116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 0, 105, 97, 45,
+    53, 46, 49, 50, 0, 73, 65, 45, 48, 53, 40, 49, 50, 41, 0, 66,
+    105, 111, 109, 101, 116, 114, 105, 99, 32, 65, 117, 116, 104, 101, 110, 116,
+    105, 99, 97, 116, 105, 111, 110, 32, 80, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 0, 105, 97, 45, 53, 46, 49, 51, 0, 73, 65, 45, 48,
+    53, 40, 49, 51, 41, 0, 69, 120, 112, 105, 114, 97, 116, 105, 111, 110,
+    32, 111, 102, 32, 67, 97, 99, 104, 101, 100, 32, 65, 117, 116, 104, 101,
+    110, 116, 105, 99, 97, 116, 111, 114, 115, 0, 105, 97, 45, 53, 46, 49,
+    52, 0, 73, 65, 45, 48, 53, 40, 49, 52, 41, 0, 77, 97, 110, 97,
+    103, 105, 110, 103, 32, 67, 111, 110, 116, 101, 110, 116, 32, 111, 102, 32,
+    80, 75, 73, 32, 84, 114, 117, 115, 116, 32, 83, 116, 111, 114, 101, 115,
+    0, 105, 97, 45, 53, 46, 49, 53, 0, 73, 65, 45, 48, 53, 40, 49,
+    53, 41, 0, 71, 83, 65, 45, 97, 112, 112, 114, 111, 118, 101, 100, 32,
+    80, 114, 111, 100, 117, 99, 116, 115, 32, 97, 110, 100, 32, 83, 101, 114,
+    118, 105, 99, 101, 115, 0, 105, 97, 45, 53, 46, 49, 54, 0, 73, 65,
+    45, 48, 53, 40, 49, 54, 41, 0, 73, 110, 45, 112, 101, 114, 115, 111,
+    110, 32, 111, 114, 32, 84, 114, 117, 115, 116, 101, 100, 32, 69, 120, 116,
+    101, 114, 110, 97, 108, 32, 80, 97, 114, 116, 121, 32, 65, 117, 116, 104,
+    101, 110, 116, 105, 99, 97, 116, 111, 114, 32, 73, 115, 115, 117, 97, 110,
+    99, 101, 0, 105, 97, 45, 53, 46, 49, 55, 0, 73, 65, 45, 48, 53,
+    40, 49, 55, 41, 0, 80, 114, 101, 115, 101, 110, 116, 97, 116, 105, 111,
+    110, 32, 65, 116, 116, 97, 99, 107, 32, 68, 101, 116, 101, 99, 116, 105,
+    111, 110, 32, 102, 111, 114, 32, 66, 105, 111, 109, 101, 116, 114, 105, 99,
+    32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 111, 114, 115, 0,
+    105, 97, 45, 53, 46, 49, 56, 0, 73, 65, 45, 48, 53, 40, 49, 56,
+    41, 0, 80, 97, 115, 115, 119, 111, 114, 100, 32, 77, 97, 110, 97, 103,
+    101, 114, 115, 0, 105, 97, 45, 54, 0, 73, 65, 45, 48, 54, 0, 65,
+    117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 32, 70, 101,
+    101, 100, 98, 97, 99, 107, 0, 105, 97, 45, 55, 0, 73, 65, 45, 48,
+    55, 0, 67, 114, 121, 112, 116, 111, 103, 114, 97, 112, 104, 105, 99, 32,
+    77, 111, 100, 117, 108, 101, 32, 65, 117, 116, 104, 101, 110, 116, 105, 99,
+    97, 116, 105, 111, 110, 0, 105, 97, 45, 56, 0, 73, 65, 45, 48, 56,
+    0, 73, 100, 101, 110, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110, 32,
+    97, 110, 100, 32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105,
+    111, 110, 32, 40, 78, 111, 110, 45, 111, 114, 103, 97, 110, 105, 122, 97,
+    116, 105, 111, 110, 97, 108, 32, 85, 115, 101, 114, 115, 41, 0, 105, 97,
+    45, 56, 46, 49, 0, 73, 65, 45, 48, 56, 40, 48, 49, 41, 0, 65,
+    99, 99, 101, 112, 116, 97, 110, 99, 101, 32, 111, 102, 32, 80, 73, 86,
+    32, 67, 114, 101, 100, 101, 110, 116, 105, 97, 108, 115, 32, 102, 114, 111,
+    109, 32, 79, 116, 104, 101, 114, 32, 65, 103, 101, 110, 99, 105, 101, 115,
+    0, 105, 97, 45, 56, 46, 50, 0, 73, 65, 45, 48, 56, 40, 48, 50,
+    41, 0, 65, 99, 99, 101, 112, 116, 97, 110, 99, 101, 32, 111, 102, 32,
+    69, 120, 116, 101, 114, 110, 97, 108, 32, 65, 117, 116, 104, 101, 110, 116,
+    105, 99, 97, 116, 111, 114, 115, 0, 105, 97, 45, 56, 46, 51, 0, 73,
+    65, 45, 48, 56, 40, 48, 51, 41, 0, 85, 115, 101, 32, 111, 102, 32,
+    70, 73, 67, 65, 77, 45, 97, 112, 112, 114, 111, 118, 101, 100, 32, 80,
+    114, 111, 100, 117, 99, 116, 115, 0, 105, 97, 45, 56, 46, 52, 0, 73,
+    65, 45, 48, 56, 40, 48, 52, 41, 0, 85, 115, 101, 32, 111, 102, 32,
+    68, 101, 102, 105, 110, 101, 100, 32, 80, 114, 111, 102, 105, 108, 101, 115,
+    0, 105, 97, 45, 56, 46, 53, 0, 73, 65, 45, 48, 56, 40, 48, 53,
+    41, 0, 65, 99, 99, 101, 112, 116, 97, 110, 99, 101, 32, 111, 102, 32,
+    80, 73, 86, 45, 73, 32, 67, 114, 101, 100, 101, 110, 116, 105, 97, 108,
+    115, 0, 105, 97, 45, 56, 46, 54, 0, 73, 65, 45, 48, 56, 40, 48,
+    54, 41, 0, 105, 97, 45, 57, 0, 73, 65, 45, 48, 57, 0, 83, 101,
+    114, 118, 105, 99, 101, 32, 73, 100, 101, 110, 116, 105, 102, 105, 99, 97,
+    116, 105, 111, 110, 32, 97, 110, 100, 32, 65, 117, 116, 104, 101, 110, 116,
+    105, 99, 97, 116, 105, 111, 110, 0, 105, 97, 45, 57, 46, 49, 0, 73,
+    65, 45, 48, 57, 40, 48, 49, 41, 0, 105, 97, 45, 57, 46, 50, 0,
+    73, 65, 45, 48, 57, 40, 48, 50, 41, 0, 84, 114, 97, 110, 115, 109,
+    105, 115, 115, 105, 111, 110, 32, 111, 102, 32, 68, 101, 99, 105, 115, 105,
+    111, 110, 115, 0, 105, 97, 45, 49, 48, 0, 73, 65, 45, 49, 48, 0,
+    65, 100, 97, 112, 116, 105, 118, 101, 32, 65, 117, 116, 104, 101, 110, 116,
+    105, 99, 97, 116, 105, 111, 110, 0, 105, 97, 45, 49, 49, 0, 73, 65,
+    45, 49, 49, 0, 82, 101, 45, 97, 117, 116, 104, 101, 110, 116, 105, 99,
+    97, 116, 105, 111, 110, 0, 105, 97, 45, 49, 50, 0, 73, 65, 45, 49,
+    50, 0, 73, 100, 101, 110, 116, 105, 116, 121, 32, 80, 114, 111, 111, 102,
+    105, 110, 103, 0, 105, 97, 45, 49, 50, 46, 49, 0, 73, 65, 45, 49,
+    50, 40, 48, 49, 41, 0, 105, 97, 45, 49, 50, 46, 50, 0, 73, 65,
+    45, 49, 50, 40, 48, 50, 41, 0, 73, 100, 101, 110, 116, 105, 116, 121,
+    32, 69, 118, 105, 100, 101, 110, 99, 101, 0, 105, 97, 45, 49, 50, 46,
+    51, 0, 73, 65, 45, 49, 50, 40, 48, 51, 41, 0, 73, 100, 101, 110,
+    116, 105, 116, 121, 32, 69, 118, 105, 100, 101, 110, 99, 101, 32, 86, 97,
+    108, 105, 100, 97, 116, 105, 111, 110, 32, 97, 110, 100, 32, 86, 101, 114,
+    105, 102, 105, 99, 97, 116, 105, 111, 110, 0, 105, 97, 45, 49, 50, 46,
+    52, 0, 73, 65, 45, 49, 50, 40, 48, 52, 41, 0, 73, 110, 45, 112,
+    101, 114, 115, 111, 110, 32, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110,
+    32, 97, 110, 100, 32, 86, 101, 114, 105, 102, 105, 99, 97, 116, 105, 111,
+    110, 0, 105, 97, 45, 49, 50, 46, 53, 0, 73, 65, 45, 49, 50, 40,
+    48, 53, 41, 0, 65, 100, 100, 114, 101, 115, 115, 32, 67, 111, 110, 102,
+    105, 114, 109, 97, 116, 105, 111, 110, 0, 105, 97, 45, 49, 50, 46, 54,
+    0, 73, 65, 45, 49, 50, 40, 48, 54, 41, 0, 65, 99, 99, 101, 112,
+    116, 32, 69, 120, 116, 101, 114, 110, 97, 108, 108, 121, 45, 112, 114, 111,
+    111, 102, 101, 100, 32, 73, 100, 101, 110, 116, 105, 116, 105, 101, 115, 0,
+    105, 97, 45, 49, 51, 0, 73, 65, 45, 49, 51, 0, 73, 100, 101, 110,
+    116, 105, 116, 121, 32, 80, 114, 111, 118, 105, 100, 101, 114, 115, 32, 97,
+    110, 100, 32, 65, 117, 116, 104, 111, 114, 105, 122, 97, 116, 105, 111, 110,
+    32, 83, 101, 114, 118, 101, 114, 115, 0, 105, 97, 45, 49, 51, 46, 49,
+    0, 73, 65, 45, 49, 51, 40, 48, 49, 41, 0, 80, 114, 111, 116, 101,
+    99, 116, 105, 111, 110, 32, 111, 102, 32, 67, 114, 121, 112, 116, 111, 103,
+    114, 97, 112, 104, 105, 99, 32, 75, 101, 121, 115, 0, 105, 97, 45, 49,
+    51, 46, 50, 0, 73, 65, 45, 49, 51, 40, 48, 50, 41, 0, 86, 101,
+    114, 105, 102, 105, 99, 97, 116, 105, 111, 110, 32, 111, 102, 32, 73, 100,
+    101, 110, 116, 105, 116, 121, 32, 65, 115, 115, 101, 114, 116, 105, 111, 110,
+    115, 32, 97, 110, 100, 32, 65, 99, 99, 101, 115, 115, 32, 84, 111, 107,
+    101, 110, 115, 0, 105, 97, 45, 49, 51, 46, 51, 0, 73, 65, 45, 49,
+    51, 40, 48, 51, 41, 0, 84, 111, 107, 101, 110, 32, 77, 97, 110, 97,
+    103, 101, 109, 101, 110, 116, 0, 105, 114, 45, 49, 0, 73, 82, 45, 48,
+    49, 0, 73, 110, 99, 105, 100, 101, 110, 116, 32, 82, 101, 115, 112, 111,
+    110, 115, 101, 0, 105, 114, 45, 50, 0, 73, 82, 45, 48, 50, 0, 73,
+    110, 99, 105, 100, 101, 110, 116, 32, 82, 101, 115, 112, 111, 110, 115, 101,
+    32, 84, 114, 97, 105, 110, 105, 110, 103, 0, 105, 114, 45, 50, 46, 49,
+    0, 73, 82, 45, 48, 50, 40, 48, 49, 41, 0, 105, 114, 45, 50, 46,
+    50, 0, 73, 82, 45, 48, 50, 40, 48, 50, 41, 0, 65, 117, 116, 111,
+    109, 97, 116, 101, 100, 32, 84, 114, 97, 105, 110, 105, 110, 103, 32, 69,
+    110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 115, 0, 105, 114, 45, 50,
+    46, 51, 0, 73, 82, 45, 48, 50, 40, 48, 51, 41, 0, 66, 114, 101,
+    97, 99, 104, 0, 105, 114, 45, 51, 0, 73, 82, 45, 48, 51, 0, 73,
+    110, 99, 105, 100, 101, 110, 116, 32, 82, 101, 115, 112, 111, 110, 115, 101,
+    32, 84, 101, 115, 116, 105, 110, 103, 0, 105, 114, 45, 51, 46, 49, 0,
+    73, 82, 45, 48, 51, 40, 48, 49, 41, 0, 105, 114, 45, 51, 46, 50,
+    0, 73, 82, 45, 48, 51, 40, 48, 50, 41, 0, 67, 111, 111, 114, 100,
+    105, 110, 97, 116, 105, 111, 110, 32, 119, 105, 116, 104, 32, 82, 101, 108,
+    97, 116, 101, 100, 32, 80, 108, 97, 110, 115, 0, 105, 114, 45, 51, 46,
+    51, 0, 73, 82, 45, 48, 51, 40, 48, 51, 41, 0, 67, 111, 110, 116,
+    105, 110, 117, 111, 117, 115, 32, 73, 109, 112, 114, 111, 118, 101, 109, 101,
+    110, 116, 0, 105, 114, 45, 52, 0, 73, 82, 45, 48, 52, 0, 73, 110,
+    99, 105, 100, 101, 110, 116, 32, 72, 97, 110, 100, 108, 105, 110, 103, 0,
+    105, 114, 45, 52, 46, 49, 0, 73, 82, 45, 48, 52, 40, 48, 49, 41,
+    0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 73, 110, 99, 105, 100,
+    101, 110, 116, 32, 72, 97, 110, 100, 108, 105, 110, 103, 32, 80, 114, 111,
+    99, 101, 115, 115, 101, 115, 0, 105, 114, 45, 52, 46, 50, 0, 73, 82,
+    45, 48, 52, 40, 48, 50, 41, 0, 68, 121, 110, 97, 109, 105, 99, 32,
+    82, 101, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 0,
+    105, 114, 45, 52, 46, 51, 0, 73, 82, 45, 48, 52, 40, 48, 51, 41,
+    0, 67, 111, 110, 116, 105, 110, 117, 105, 116, 121, 32, 111, 102, 32, 79,
+    112, 101, 114, 97, 116, 105, 111, 110, 115, 0, 105, 114, 45, 52, 46, 52,
+    0, 73, 82, 45, 48, 52, 40, 48, 52, 41, 0, 73, 110, 102, 111, 114,
+    109, 97, 116, 105, 111, 110, 32, 67, 111, 114, 114, 101, 108, 97, 116, 105,
+    111, 110, 0, 105, 114, 45, 52, 46, 53, 0, 73, 82, 45, 48, 52, 40,
+    48, 53, 41, 0, 65, 117, 116, 111, 109, 97, 116, 105, 99, 32, 68, 105,
+    115, 97, 98, 108, 105, 110, 103, 32, 111, 102, 32, 83, 121, 115, 116, 101,
+    109, 0, 105, 114, 45, 52, 46, 54, 0, 73, 82, 45, 48, 52, 40, 48,
+    54, 41, 0, 73, 110, 115, 105, 100, 101, 114, 32, 84, 104, 114, 101, 97,
+    116, 115, 0, 105, 114, 45, 52, 46, 55, 0, 73, 82, 45, 48, 52, 40,
+    48, 55, 41, 0, 73, 110, 115, 105, 100, 101, 114, 32, 84, 104, 114, 101,
+    97, 116, 115, 32, -30, -128, -108, 32, 73, 110, 116, 114, 97, 45, 111, 114,
+    103, 97, 110, 105, 122, 97, 116, 105, 111, 110, 32, 67, 111, 111, 114, 100,
+    105, 110, 97, 116, 105, 111, 110, 0, 105, 114, 45, 52, 46, 56, 0, 73,
+    82, 45, 48, 52, 40, 48, 56, 41, 0, 67, 111, 114, 114, 101, 108, 97,
+    116, 105, 111, 110, 32, 119, 105, 116, 104, 32, 69, 120, 116, 101, 114, 110,
+    97, 108, 32, 79, 114, 103, 97, 110, 105, 122, 97, 116, 105, 111, 110, 115,
+    0, 105, 114, 45, 52, 46, 57, 0, 73, 82, 45, 48, 52, 40, 48, 57,
+    41, 0, 68, 121, 110, 97, 109, 105, 99, 32, 82, 101, 115, 112, 111, 110,
+    115, 101, 32, 67, 97, 112, 97, 98, 105, 108, 105, 116, 121, 0, 105, 114,
+    45, 52, 46, 49, 48, 0, 73, 82, 45, 48, 52, 40, 49, 48, 41, 0,
+    83, 117, 112, 112, 108, 121, 32, 67, 104, 97, 105, 110, 32, 67, 111, 111,
+    114, 100, 105, 110, 97, 116, 105, 111, 110, 0, 105, 114, 45, 52, 46, 49,
+    49, 0, 73, 82, 45, 48, 52, 40, 49, 49, 41, 0, 73, 110, 116, 101,
+    103, 114, 97, 116, 101, 100, 32, 73, 110, 99, 105, 100, 101, 110, 116, 32,
+    82, 101, 115, 112, 111, 110, 115, 101, 32, 84, 101, 97, 109, 0, 105, 114,
+    45, 52, 46, 49, 50, 0, 73, 82, 45, 48, 52, 40, 49, 50, 41, 0,
+    77, 97, 108, 105, 99, 105, 111, 117, 115, 32, 67, 111, 100, 101, 32, 97,
+    110, 100, 32, 70, 111, 114, 101, 110, 115, 105, 99, 32, 65, 110, 97, 108,
+    121, 115, 105, 115, 0, 105, 114, 45, 52, 46, 49, 51, 0, 73, 82, 45,
+    48, 52, 40, 49, 51, 41, 0, 66, 101, 104, 97, 118, 105, 111, 114, 32,
+    65, 110, 97, 108, 121, 115, 105, 115, 0, 105, 114, 45, 52, 46, 49, 52,
+    0, 73, 82, 45, 48, 52, 40, 49, 52, 41, 0, 83, 101, 99, 117, 114,
+    105, 116, 121, 32, 79, 112, 101, 114, 97, 116, 105, 111, 110, 115, 32, 67,
+    101, 110, 116, 101, 114, 0, 105, 114, 45, 52, 46, 49, 53, 0, 73, 82,
+    45, 48, 52, 40, 49, 53, 41, 0, 80, 117, 98, 108, 105, 99, 32, 82,
+    101, 108, 97, 116, 105, 111, 110, 115, 32, 97, 110, 100, 32, 82, 101, 112,
+    117, 116, 97, 116, 105, 111, 110, 32, 82, 101, 112, 97, 105, 114, 0, 105,
+    114, 45, 53, 0, 73, 82, 45, 48, 53, 0, 73, 110, 99, 105, 100, 101,
+    110, 116, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 0, 105, 114,
+    45, 53, 46, 49, 0, 73, 82, 45, 48, 53, 40, 48, 49, 41, 0, 65,
+    117, 116, 111, 109, 97, 116, 101, 100, 32, 84, 114, 97, 99, 107, 105, 110,
+    103, 44, 32, 68, 97, 116, 97, 32, 67, 111, 108, 108, 101, 99, 116, 105,
+    111, 110, 44, 32, 97, 110, 100, 32, 65, 110, 97, 108, 121, 115, 105, 115,
+    0, 105, 114, 45, 54, 0, 73, 82, 45, 48, 54, 0, 73, 110, 99, 105,
+    100, 101, 110, 116, 32, 82, 101, 112, 111, 114, 116, 105, 110, 103, 0, 105,
+    114, 45, 54, 46, 49, 0, 73, 82, 45, 48, 54, 40, 48, 49, 41, 0,
+    65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 82, 101, 112, 111, 114, 116,
+    105, 110, 103, 0, 105, 114, 45, 54, 46, 50, 0, 73, 82, 45, 48, 54,
+    40, 48, 50, 41, 0, 86, 117, 108, 110, 101, 114, 97, 98, 105, 108, 105,
+    116, 105, 101, 115, 32, 82, 101, 108, 97, 116, 101, 100, 32, 116, 111, 32,
+    73, 110, 99, 105, 100, 101, 110, 116, 115, 0, 105, 114, 45, 54, 46, 51,
+    0, 73, 82, 45, 48, 54, 40, 48, 51, 41, 0, 105, 114, 45, 55, 0,
+    73, 82, 45, 48, 55, 0, 73, 110, 99, 105, 100, 101, 110, 116, 32, 82,
+    101, 115, 112, 111, 110, 115, 101, 32, 65, 115, 115, 105, 115, 116, 97, 110,
+    99, 101, 0, 105, 114, 45, 55, 46, 49, 0, 73, 82, 45, 48, 55, 40,
+    48, 49, 41, 0, 65, 117, 116, 111, 109, 97, 116, 105, 111, 110, 32, 83,
+    117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32, 65, 118, 97, 105, 108,
+    97, 98, 105, 108, 105, 116, 121, 32, 111, 102, 32, 73, 110, 102, 111, 114,
+    109, 97, 116, 105, 111, 110, 32, 97, 110, 100, 32, 83, 117, 112, 112, 111,
+    114, 116, 0, 105, 114, 45, 55, 46, 50, 0, 73, 82, 45, 48, 55, 40,
+    48, 50, 41, 0, 67, 111, 111, 114, 100, 105, 110, 97, 116, 105, 111, 110,
+    32, 119, 105, 116, 104, 32, 69, 120, 116, 101, 114, 110, 97, 108, 32, 80,
+    114, 111, 118, 105, 100, 101, 114, 115, 0, 105, 114, 45, 56, 0, 73, 82,
+    45, 48, 56, 0, 73, 110, 99, 105, 100, 101, 110, 116, 32, 82, 101, 115,
+    112, 111, 110, 115, 101, 32, 80, 108, 97, 110, 0, 105, 114, 45, 56, 46,
+    49, 0, 73, 82, 45, 48, 56, 40, 48, 49, 41, 0, 66, 114, 101, 97,
+    99, 104, 101, 115, 0, 105, 114, 45, 57, 0, 73, 82, 45, 48, 57, 0,
+    73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 83, 112, 105, 108,
+    108, 97, 103, 101, 32, 82, 101, 115, 112, 111, 110, 115, 101, 0, 105, 114,
+    45, 57, 46, 49, 0, 73, 82, 45, 48, 57, 40, 48, 49, 41, 0, 82,
+    101, 115, 112, 111, 110, 115, 105, 98, 108, 101, 32, 80, 101, 114, 115, 111,
+    110, 110, 101, 108, 0, 105, 114, 45, 57, 46, 50, 0, 73, 82, 45, 48,
+    57, 40, 48, 50, 41, 0, 84, 114, 97, 105, 110, 105, 110, 103, 0, 105,
+    114, 45, 57, 46, 51, 0, 73, 82, 45, 48, 57, 40, 48, 51, 41, 0,
+    80, 111, 115, 116, 45, 115, 112, 105, 108, 108, 32, 79, 112, 101, 114, 97,
+    116, 105, 111, 110, 115, 0, 105, 114, 45, 57, 46, 52, 0, 73, 82, 45,
+    48, 57, 40, 48, 52, 41, 0, 69, 120, 112, 111, 115, 117, 114, 101, 32,
+    116, 111, 32, 85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32,
+    80, 101, 114, 115, 111, 110, 110, 101, 108, 0, 105, 114, 45, 49, 48, 0,
+    73, 82, 45, 49, 48, 0, 73, 110, 116, 101, 103, 114, 97, 116, 101, 100,
+    32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 83, 101, 99,
+    117, 114, 105, 116, 121, 32, 65, 110, 97, 108, 121, 115, 105, 115, 32, 84,
+    101, 97, 109, 0, 109, 97, 45, 49, 0, 77, 65, 45, 48, 49, 0, 77,
+    97, 105, 110, 116, 101, 110, 97, 110, 99, 101, 0, 109, 97, 45, 50, 0,
+    77, 65, 45, 48, 50, 0, 67, 111, 110, 116, 114, 111, 108, 108, 101, 100,
+    32, 77, 97, 105, 110, 116, 101, 110, 97, 110, 99, 101, 0, 109, 97, 45,
+    50, 46, 49, 0, 77, 65, 45, 48, 50, 40, 48, 49, 41, 0, 82, 101,
+    99, 111, 114, 100, 32, 67, 111, 110, 116, 101, 110, 116, 0, 109, 97, 45,
+    50, 46, 50, 0, 77, 65, 45, 48, 50, 40, 48, 50, 41, 0, 65, 117,
+    116, 111, 109, 97, 116, 101, 100, 32, 77, 97, 105, 110, 116, 101, 110, 97,
+    110, 99, 101, 32, 65, 99, 116, 105, 118, 105, 116, 105, 101, 115, 0, 109,
+    97, 45, 51, 0, 77, 65, 45, 48, 51, 0, 77, 97, 105, 110, 116, 101,
+    110, 97, 110, 99, 101, 32, 84, 111, 111, 108, 115, 0, 109, 97, 45, 51,
+    46, 49, 0, 77, 65, 45, 48, 51, 40, 48, 49, 41, 0, 73, 110, 115,
+    112, 101, 99, 116, 32, 84, 111, 111, 108, 115, 0, 109, 97, 45, 51, 46,
+    50, 0, 77, 65, 45, 48, 51, 40, 48, 50, 41, 0, 73, 110, 115, 112,
+    101, 99, 116, 32, 77, 101, 100, 105, 97, 0, 109, 97, 45, 51, 46, 51,
+    0, 77, 65, 45, 48, 51, 40, 48, 51, 41, 0, 80, 114, 101, 118, 101,
+    110, 116, 32, 85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32,
+    82, 101, 109, 111, 118, 97, 108, 0, 109, 97, 45, 51, 46, 52, 0, 77,
+    65, 45, 48, 51, 40, 48, 52, 41, 0, 82, 101, 115, 116, 114, 105, 99,
+    116, 101, 100, 32, 84, 111, 111, 108, 32, 85, 115, 101, 0, 109, 97, 45,
+    51, 46, 53, 0, 77, 65, 45, 48, 51, 40, 48, 53, 41, 0, 69, 120,
+    101, 99, 117, 116, 105, 111, 110, 32, 119, 105, 116, 104, 32, 80, 114, 105,
+    118, 105, 108, 101, 103, 101, 0, 109, 97, 45, 51, 46, 54, 0, 77, 65,
+    45, 48, 51, 40, 48, 54, 41, 0, 83, 111, 102, 116, 119, 97, 114, 101,
+    32, 85, 112, 100, 97, 116, 101, 115, 32, 97, 110, 100, 32, 80, 97, 116,
+    99, 104, 101, 115, 0, 109, 97, 45, 52, 0, 77, 65, 45, 48, 52, 0,
+    78, 111, 110, 108, 111, 99, 97, 108, 32, 77, 97, 105, 110, 116, 101, 110,
+    97, 110, 99, 101, 0, 109, 97, 45, 52, 46, 49, 0, 77, 65, 45, 48,
+    52, 40, 48, 49, 41, 0, 76, 111, 103, 103, 105, 110, 103, 32, 97, 110,
+    100, 32, 82, 101, 118, 105, 101, 119, 0, 109, 97, 45, 52, 46, 50, 0,
+    77, 65, 45, 48, 52, 40, 48, 50, 41, 0, 68, 111, 99, 117, 109, 101,
+    110, 116, 32, 78, 111, 110, 108, 111, 99, 97, 108, 32, 77, 97, 105, 110,
+    116, 101, 110, 97, 110, 99, 101, 0, 109, 97, 45, 52, 46, 51, 0, 77,
+    65, 45, 48, 52, 40, 48, 51, 41, 0, 67, 111, 109, 112, 97, 114, 97,
+    98, 108, 101, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 97, 110, 100,
+    32, 83, 97, 110, 105, 116, 105, 122, 97, 116, 105, 111, 110, 0, 109, 97,
+    45, 52, 46, 52, 0, 77, 65, 45, 48, 52, 40, 48, 52, 41, 0, 65,
+    117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 32, 97, 110,
+    100, 32, 83, 101, 112, 97, 114, 97, 116, 105, 111, 110, 32, 111, 102, 32,
+    77, 97, 105, 110, 116, 101, 110, 97, 110, 99, 101, 32, 83, 101, 115, 115,
+    105, 111, 110, 115, 0, 109, 97, 45, 52, 46, 53, 0, 77, 65, 45, 48,
+    52, 40, 48, 53, 41, 0, 65, 112, 112, 114, 111, 118, 97, 108, 115, 32,
+    97, 110, 100, 32, 78, 111, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110,
+    115, 0, 109, 97, 45, 52, 46, 54, 0, 77, 65, 45, 48, 52, 40, 48,
+    54, 41, 0, 109, 97, 45, 52, 46, 55, 0, 77, 65, 45, 48, 52, 40,
+    48, 55, 41, 0, 68, 105, 115, 99, 111, 110, 110, 101, 99, 116, 32, 86,
+    101, 114, 105, 102, 105, 99, 97, 116, 105, 111, 110, 0, 109, 97, 45, 53,
+    0, 77, 65, 45, 48, 53, 0, 77, 97, 105, 110, 116, 101, 110, 97, 110,
+    99, 101, 32, 80, 101, 114, 115, 111, 110, 110, 101, 108, 0, 109, 97, 45,
+    53, 46, 49, 0, 77, 65, 45, 48, 53, 40, 48, 49, 41, 0, 73, 110,
+    100, 105, 118, 105, 100, 117, 97, 108, 115, 32, 87, 105, 116, 104, 111, 117,
+    116, 32, 65, 112, 112, 114, 111, 112, 114, 105, 97, 116, 101, 32, 65, 99,
+    99, 101, 115, 115, 0, 109, 97, 45, 53, 46, 50, 0, 77, 65, 45, 48,
+    53, 40, 48, 50, 41, 0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 67,
+    108, 101, 97, 114, 97, 110, 99, 101, 115, 32, 102, 111, 114, 32, 67, 108,
+    97, 115, 115, 105, 102, 105, 101, 100, 32, 83, 121, 115, 116, 101, 109, 115,
+    0, 109, 97, 45, 53, 46, 51, 0, 77, 65, 45, 48, 53, 40, 48, 51,
+    41, 0, 67, 105, 116, 105, 122, 101, 110, 115, 104, 105, 112, 32, 82, 101,
+    113, 117, 105, 114, 101, 109, 101, 110, 116, 115, 32, 102, 111, 114, 32, 67,
+    108, 97, 115, 115, 105, 102, 105, 101, 100, 32, 83, 121, 115, 116, 101, 109,
+    115, 0, 109, 97, 45, 53, 46, 52, 0, 77, 65, 45, 48, 53, 40, 48,
+    52, 41, 0, 70, 111, 114, 101, 105, 103, 110, 32, 78, 97, 116, 105, 111,
+    110, 97, 108, 115, 0, 109, 97, 45, 53, 46, 53, 0, 77, 65, 45, 48,
+    53, 40, 48, 53, 41, 0, 78, 111, 110, 45, 115, 121, 115, 116, 101, 109,
+    32, 77, 97, 105, 110, 116, 101, 110, 97, 110, 99, 101, 0, 109, 97, 45,
+    54, 0, 77, 65, 45, 48, 54, 0, 84, 105, 109, 101, 108, 121, 32, 77,
+    97, 105, 110, 116, 101, 110, 97, 110, 99, 101, 0, 109, 97, 45, 54, 46,
+    49, 0, 77, 65, 45, 48, 54, 40, 48, 49, 41, 0, 80, 114, 101, 118,
+    101, 110, 116, 105, 118, 101, 32, 77, 97, 105, 110, 116, 101, 110, 97, 110,
+    99, 101, 0, 109, 97, 45, 54, 46, 50, 0, 77, 65, 45, 48, 54, 40,
+    48, 50, 41, 0, 80, 114, 101, 100, 105, 99, 116, 105, 118, 101, 32, 77,
+    97, 105, 110, 116, 101, 110, 97, 110, 99, 101, 0, 109, 97, 45, 54, 46,
+    51, 0, 77, 65, 45, 48, 54, 40, 48, 51, 41, 0, 65, 117, 116, 111,
+    109, 97, 116, 101, 100, 32, 83, 117, 112, 112, 111, 114, 116, 32, 102, 111,
+    114, 32, 80, 114, 101, 100, 105, 99, 116, 105, 118, 101, 32, 77, 97, 105,
+    110, 116, 101, 110, 97, 110, 99, 101, 0, 109, 97, 45, 55, 0, 77, 65,
+    45, 48, 55, 0, 70, 105, 101, 108, 100, 32, 77, 97, 105, 110, 116, 101,
+    110, 97, 110, 99, 101, 0, 109, 112, 45, 49, 0, 77, 80, 45, 48, 49,
+    0, 77, 101, 100, 105, 97, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111,
+    110, 0, 109, 112, 45, 50, 0, 77, 80, 45, 48, 50, 0, 77, 101, 100,
+    105, 97, 32, 65, 99, 99, 101, 115, 115, 0, 109, 112, 45, 50, 46, 49,
+    0, 77, 80, 45, 48, 50, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109,
+    97, 116, 101, 100, 32, 82, 101, 115, 116, 114, 105, 99, 116, 101, 100, 32,
+    65, 99, 99, 101, 115, 115, 0, 109, 112, 45, 50, 46, 50, 0, 77, 80,
+    45, 48, 50, 40, 48, 50, 41, 0, 109, 112, 45, 51, 0, 77, 80, 45,
+    48, 51, 0, 77, 101, 100, 105, 97, 32, 77, 97, 114, 107, 105, 110, 103,
+    0, 109, 112, 45, 52, 0, 77, 80, 45, 48, 52, 0, 77, 101, 100, 105,
+    97, 32, 83, 116, 111, 114, 97, 103, 101, 0, 109, 112, 45, 52, 46, 49,
+    0, 77, 80, 45, 48, 52, 40, 48, 49, 41, 0, 109, 112, 45, 52, 46,
+    50, 0, 77, 80, 45, 48, 52, 40, 48, 50, 41, 0, 109, 112, 45, 53,
+    0, 77, 80, 45, 48, 53, 0, 77, 101, 100, 105, 97, 32, 84, 114, 97,
+    110, 115, 112, 111, 114, 116, 0, 109, 112, 45, 53, 46, 49, 0, 77, 80,
+    45, 48, 53, 40, 48, 49, 41, 0, 80, 114, 111, 116, 101, 99, 116, 105,
+    111, 110, 32, 79, 117, 116, 115, 105, 100, 101, 32, 111, 102, 32, 67, 111,
+    110, 116, 114, 111, 108, 108, 101, 100, 32, 65, 114, 101, 97, 115, 0, 109,
+    112, 45, 53, 46, 50, 0, 77, 80, 45, 48, 53, 40, 48, 50, 41, 0,
+    68, 111, 99, 117, 109, 101, 110, 116, 97, 116, 105, 111, 110, 32, 111, 102,
+    32, 65, 99, 116, 105, 118, 105, 116, 105, 101, 115, 0, 109, 112, 45, 53,
+    46, 51, 0, 77, 80, 45, 48, 53, 40, 48, 51, 41, 0, 67, 117, 115,
+    116, 111, 100, 105, 97, 110, 115, 0, 109, 112, 45, 53, 46, 52, 0, 77,
+    80, 45, 48, 53, 40, 48, 52, 41, 0, 109, 112, 45, 54, 0, 77, 80,
+    45, 48, 54, 0, 77, 101, 100, 105, 97, 32, 83, 97, 110, 105, 116, 105,
+    122, 97, 116, 105, 111, 110, 0, 109, 112, 45, 54, 46, 49, 0, 77, 80,
+    45, 48, 54, 40, 48, 49, 41, 0, 82, 101, 118, 105, 101, 119, 44, 32,
+    65, 112, 112, 114, 111, 118, 101, 44, 32, 84, 114, 97, 99, 107, 44, 32,
+    68, 111, 99, 117, 109, 101, 110, 116, 44, 32, 97, 110, 100, 32, 86, 101,
+    114, 105, 102, 121, 0, 109, 112, 45, 54, 46, 50, 0, 77, 80, 45, 48,
+    54, 40, 48, 50, 41, 0, 69, 113, 117, 105, 112, 109, 101, 110, 116, 32,
+    84, 101, 115, 116, 105, 110, 103, 0, 109, 112, 45, 54, 46, 51, 0, 77,
+    80, 45, 48, 54, 40, 48, 51, 41, 0, 78, 111, 110, 100, 101, 115, 116,
+    114, 117, 99, 116, 105, 118, 101, 32, 84, 101, 99, 104, 110, 105, 113, 117,
+    101, 115, 0, 109, 112, 45, 54, 46, 52, 0, 77, 80, 45, 48, 54, 40,
+    48, 52, 41, 0, 67, 111, 110, 116, 114, 111, 108, 108, 101, 100, 32, 85,
+    110, 99, 108, 97, 115, 115, 105, 102, 105, 101, 100, 32, 73, 110, 102, 111,
+    114, 109, 97, 116, 105, 111, 110, 0, 109, 112, 45, 54, 46, 53, 0, 77,
+    80, 45, 48, 54, 40, 48, 53, 41, 0, 67, 108, 97, 115, 115, 105, 102,
+    105, 101, 100, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0,
+    109, 112, 45, 54, 46, 54, 0, 77, 80, 45, 48, 54, 40, 48, 54, 41,
+    0, 77, 101, 100, 105, 97, 32, 68, 101, 115, 116, 114, 117, 99, 116, 105,
+    111, 110, 0, 109, 112, 45, 54, 46, 55, 0, 77, 80, 45, 48, 54, 40,
+    48, 55, 41, 0, 109, 112, 45, 54, 46, 56, 0, 77, 80, 45, 48, 54,
+    40, 48, 56, 41, 0, 82, 101, 109, 111, 116, 101, 32, 80, 117, 114, 103,
+    105, 110, 103, 32, 111, 114, 32, 87, 105, 112, 105, 110, 103, 32, 111, 102,
+    32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 109, 112, 45,
+    55, 0, 77, 80, 45, 48, 55, 0, 77, 101, 100, 105, 97, 32, 85, 115,
+    101, 0, 109, 112, 45, 55, 46, 49, 0, 77, 80, 45, 48, 55, 40, 48,
+    49, 41, 0, 80, 114, 111, 104, 105, 98, 105, 116, 32, 85, 115, 101, 32,
+    87, 105, 116, 104, 111, 117, 116, 32, 79, 119, 110, 101, 114, 0, 109, 112,
+    45, 55, 46, 50, 0, 77, 80, 45, 48, 55, 40, 48, 50, 41, 0, 80,
+    114, 111, 104, 105, 98, 105, 116, 32, 85, 115, 101, 32, 111, 102, 32, 83,
+    97, 110, 105, 116, 105, 122, 97, 116, 105, 111, 110, 45, 114, 101, 115, 105,
+    115, 116, 97, 110, 116, 32, 77, 101, 100, 105, 97, 0, 109, 112, 45, 56,
+    0, 77, 80, 45, 48, 56, 0, 77, 101, 100, 105, 97, 32, 68, 111, 119,
+    110, 103, 114, 97, 100, 105, 110, 103, 0, 109, 112, 45, 56, 46, 49, 0,
+    77, 80, 45, 48, 56, 40, 48, 49, 41, 0, 68, 111, 99, 117, 109, 101,
+    110, 116, 97, 116, 105, 111, 110, 32, 111, 102, 32, 80, 114, 111, 99, 101,
+    115, 115, 0, 109, 112, 45, 56, 46, 50, 0, 77, 80, 45, 48, 56, 40,
+    48, 50, 41, 0, 109, 112, 45, 56, 46, 51, 0, 77, 80, 45, 48, 56,
+    40, 48, 51, 41, 0, 109, 112, 45, 56, 46, 52, 0, 77, 80, 45, 48,
+    56, 40, 48, 52, 41, 0, 112, 101, 45, 49, 0, 80, 69, 45, 48, 49,
+    0, 80, 104, 121, 115, 105, 99, 97, 108, 32, 97, 110, 100, 32, 69, 110,
+    118, 105, 114, 111, 110, 109, 101, 110, 116, 97, 108, 32, 80, 114, 111, 116,
+    101, 99, 116, 105, 111, 110, 0, 112, 101, 45, 50, 0, 80, 69, 45, 48,
+    50, 0, 80, 104, 121, 115, 105, 99, 97, 108, 32, 65, 99, 99, 101, 115,
+    115, 32, 65, 117, 116, 104, 111, 114, 105, 122, 97, 116, 105, 111, 110, 115,
+    0, 112, 101, 45, 50, 46, 49, 0, 80, 69, 45, 48, 50, 40, 48, 49,
+    41, 0, 65, 99, 99, 101, 115, 115, 32, 98, 121, 32, 80, 111, 115, 105,
+    116, 105, 111, 110, 32, 111, 114, 32, 82, 111, 108, 101, 0, 112, 101, 45,
+    50, 46, 50, 0, 80, 69, 45, 48, 50, 40, 48, 50, 41, 0, 84, 119,
+    111, 32, 70, 111, 114, 109, 115, 32, 111, 102, 32, 73, 100, 101, 110, 116,
+    105, 102, 105, 99, 97, 116, 105, 111, 110, 0, 112, 101, 45, 50, 46, 51,
+    0, 80, 69, 45, 48, 50, 40, 48, 51, 41, 0, 82, 101, 115, 116, 114,
+    105, 99, 116, 32, 85, 110, 101, 115, 99, 111, 114, 116, 101, 100, 32, 65,
+    99, 99, 101, 115, 115, 0, 112, 101, 45, 51, 0, 80, 69, 45, 48, 51,
+    0, 80, 104, 121, 115, 105, 99, 97, 108, 32, 65, 99, 99, 101, 115, 115,
+    32, 67, 111, 110, 116, 114, 111, 108, 0, 112, 101, 45, 51, 46, 49, 0,
+    80, 69, 45, 48, 51, 40, 48, 49, 41, 0, 83, 121, 115, 116, 101, 109,
+    32, 65, 99, 99, 101, 115, 115, 0, 112, 101, 45, 51, 46, 50, 0, 80,
+    69, 45, 48, 51, 40, 48, 50, 41, 0, 70, 97, 99, 105, 108, 105, 116,
+    121, 32, 97, 110, 100, 32, 83, 121, 115, 116, 101, 109, 115, 0, 112, 101,
+    45, 51, 46, 51, 0, 80, 69, 45, 48, 51, 40, 48, 51, 41, 0, 67,
+    111, 110, 116, 105, 110, 117, 111, 117, 115, 32, 71, 117, 97, 114, 100, 115,
+    0, 112, 101, 45, 51, 46, 52, 0, 80, 69, 45, 48, 51, 40, 48, 52,
+    41, 0, 76, 111, 99, 107, 97, 98, 108, 101, 32, 67, 97, 115, 105, 110,
+    103, 115, 0, 112, 101, 45, 51, 46, 53, 0, 80, 69, 45, 48, 51, 40,
+    48, 53, 41, 0, 84, 97, 109, 112, 101, 114, 32, 80, 114, 111, 116, 101,
+    99, 116, 105, 111, 110, 0, 112, 101, 45, 51, 46, 54, 0, 80, 69, 45,
+    48, 51, 40, 48, 54, 41, 0, 112, 101, 45, 51, 46, 55, 0, 80, 69,
+    45, 48, 51, 40, 48, 55, 41, 0, 80, 104, 121, 115, 105, 99, 97, 108,
+    32, 66, 97, 114, 114, 105, 101, 114, 115, 0, 112, 101, 45, 51, 46, 56,
+    0, 80, 69, 45, 48, 51, 40, 48, 56, 41, 0, 65, 99, 99, 101, 115,
+    115, 32, 67, 111, 110, 116, 114, 111, 108, 32, 86, 101, 115, 116, 105, 98,
+    117, 108, 101, 115, 0, 112, 101, 45, 52, 0, 80, 69, 45, 48, 52, 0,
+    65, 99, 99, 101, 115, 115, 32, 67, 111, 110, 116, 114, 111, 108, 32, 102,
+    111, 114, 32, 84, 114, 97, 110, 115, 109, 105, 115, 115, 105, 111, 110, 0,
+    112, 101, 45, 53, 0, 80, 69, 45, 48, 53, 0, 65, 99, 99, 101, 115,
+    115, 32, 67, 111, 110, 116, 114, 111, 108, 32, 102, 111, 114, 32, 79, 117,
+    116, 112, 117, 116, 32, 68, 101, 118, 105, 99, 101, 115, 0, 112, 101, 45,
+    53, 46, 49, 0, 80, 69, 45, 48, 53, 40, 48, 49, 41, 0, 65, 99,
+    99, 101, 115, 115, 32, 116, 111, 32, 79, 117, 116, 112, 117, 116, 32, 98,
+    121, 32, 65, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 73, 110, 100,
+    105, 118, 105, 100, 117, 97, 108, 115, 0, 112, 101, 45, 53, 46, 50, 0,
+    80, 69, 45, 48, 53, 40, 48, 50, 41, 0, 76, 105, 110, 107, 32, 116,
+    111, 32, 73, 110, 100, 105, 118, 105, 100, 117, 97, 108, 32, 73, 100, 101,
+    110, 116, 105, 116, 121, 0, 112, 101, 45, 53, 46, 51, 0, 80, 69, 45,
+    48, 53, 40, 48, 51, 41, 0, 77, 97, 114, 107, 105, 110, 103, 32, 79,
+    117, 116, 112, 117, 116, 32, 68, 101, 118, 105, 99, 101, 115, 0, 112, 101,
+    45, 54, 0, 80, 69, 45, 48, 54, 0, 77, 111, 110, 105, 116, 111, 114,
+    105, 110, 103, 32, 80, 104, 121, 115, 105, 99, 97, 108, 32, 65, 99, 99,
+    101, 115, 115, 0, 112, 101, 45, 54, 46, 49, 0, 80, 69, 45, 48, 54,
+    40, 48, 49, 41, 0, 73, 110, 116, 114, 117, 115, 105, 111, 110, 32, 65,
+    108, 97, 114, 109, 115, 32, 97, 110, 100, 32, 83, 117, 114, 118, 101, 105,
+    108, 108, 97, 110, 99, 101, 32, 69, 113, 117, 105, 112, 109, 101, 110, 116,
+    0, 112, 101, 45, 54, 46, 50, 0, 80, 69, 45, 48, 54, 40, 48, 50,
+    41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 73, 110, 116, 114,
+    117, 115, 105, 111, 110, 32, 82, 101, 99, 111, 103, 110, 105, 116, 105, 111,
+    110, 32, 97, 110, 100, 32, 82, 101, 115, 112, 111, 110, 115, 101, 115, 0,
+    112, 101, 45, 54, 46, 51, 0, 80, 69, 45, 48, 54, 40, 48, 51, 41,
+    0, 86, 105, 100, 101, 111, 32, 83, 117, 114, 118, 101, 105, 108, 108, 97,
+    110, 99, 101, 0, 112, 101, 45, 54, 46, 52, 0, 80, 69, 45, 48, 54,
+    40, 48, 52, 41, 0, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 32,
+    80, 104, 121, 115, 105, 99, 97, 108, 32, 65, 99, 99, 101, 115, 115, 32,
+    116, 111, 32, 83, 121, 115, 116, 101, 109, 115, 0, 112, 101, 45, 55, 0,
+    80, 69, 45, 48, 55, 0, 86, 105, 115, 105, 116, 111, 114, 32, 67, 111,
+    110, 116, 114, 111, 108, 0, 112, 101, 45, 56, 0, 80, 69, 45, 48, 56,
+    0, 86, 105, 115, 105, 116, 111, 114, 32, 65, 99, 99, 101, 115, 115, 32,
+    82, 101, 99, 111, 114, 100, 115, 0, 112, 101, 45, 56, 46, 49, 0, 80,
+    69, 45, 48, 56, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109, 97, 116,
+    101, 100, 32, 82, 101, 99, 111, 114, 100, 115, 32, 77, 97, 105, 110, 116,
+    101, 110, 97, 110, 99, 101, 32, 97, 110, 100, 32, 82, 101, 118, 105, 101,
+    119, 0, 112, 101, 45, 56, 46, 50, 0, 80, 69, 45, 48, 56, 40, 48,
+    50, 41, 0, 80, 104, 121, 115, 105, 99, 97, 108, 32, 65, 99, 99, 101,
+    115, 115, 32, 82, 101, 99, 111, 114, 100, 115, 0, 112, 101, 45, 56, 46,
+    51, 0, 80, 69, 45, 48, 56, 40, 48, 51, 41, 0, 112, 101, 45, 57,
+    0, 80, 69, 45, 48, 57, 0, 80, 111, 119, 101, 114, 32, 69, 113, 117,
+    105, 112, 109, 101, 110, 116, 32, 97, 110, 100, 32, 67, 97, 98, 108, 105,
+    110, 103, 0, 112, 101, 45, 57, 46, 49, 0, 80, 69, 45, 48, 57, 40,
+    48, 49, 41, 0, 82, 101, 100, 117, 110, 100, 97, 110, 116, 32, 67, 97,
+    98, 108, 105, 110, 103, 0, 112, 101, 45, 57, 46, 50, 0, 80, 69, 45,
+    48, 57, 40, 48, 50, 41, 0, 65, 117, 116, 111, 109, 97, 116, 105, 99,
+    32, 86, 111, 108, 116, 97, 103, 101, 32, 67, 111, 110, 116, 114, 111, 108,
+    115, 0, 112, 101, 45, 49, 48, 0, 80, 69, 45, 49, 48, 0, 69, 109,
+    101, 114, 103, 101, 110, 99, 121, 32, 83, 104, 117, 116, 111, 102, 102, 0,
+    112, 101, 45, 49, 48, 46, 49, 0, 80, 69, 45, 49, 48, 40, 48, 49,
+    41, 0, 65, 99, 99, 105, 100, 101, 110, 116, 97, 108, 32, 97, 110, 100,
+    32, 85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 65, 99,
+    116, 105, 118, 97, 116, 105, 111, 110, 0, 112, 101, 45, 49, 49, 0, 80,
+    69, 45, 49, 49, 0, 69, 109, 101, 114, 103, 101, 110, 99, 121, 32, 80,
+    111, 119, 101, 114, 0, 112, 101, 45, 49, 49, 46, 49, 0, 80, 69, 45,
+    49, 49, 40, 48, 49, 41, 0, 65, 108, 116, 101, 114, 110, 97, 116, 101,
+    32, 80, 111, 119, 101, 114, 32, 83, 117, 112, 112, 108, 121, 32, -30, -128,
+    -108, 32, 77, 105, 110, 105, 109, 97, 108, 32, 79, 112, 101, 114, 97, 116,
+    105, 111, 110, 97, 108, 32, 67, 97, 112, 97, 98, 105, 108, 105, 116, 121,
+    0, 112, 101, 45, 49, 49, 46, 50, 0, 80, 69, 45, 49, 49, 40, 48,
+    50, 41, 0, 65, 108, 116, 101, 114, 110, 97, 116, 101, 32, 80, 111, 119,
+    101, 114, 32, 83, 117, 112, 112, 108, 121, 32, -30, -128, -108, 32, 83, 101,
+    108, 102, 45, 99, 111, 110, 116, 97, 105, 110, 101, 100, 0, 112, 101, 45,
+    49, 50, 0, 80, 69, 45, 49, 50, 0, 69, 109, 101, 114, 103, 101, 110,
+    99, 121, 32, 76, 105, 103, 104, 116, 105, 110, 103, 0, 112, 101, 45, 49,
+    50, 46, 49, 0, 80, 69, 45, 49, 50, 40, 48, 49, 41, 0, 69, 115,
+    115, 101, 110, 116, 105, 97, 108, 32, 77, 105, 115, 115, 105, 111, 110, 32,
+    97, 110, 100, 32, 66, 117, 115, 105, 110, 101, 115, 115, 32, 70, 117, 110,
+    99, 116, 105, 111, 110, 115, 0, 112, 101, 45, 49, 51, 0, 80, 69, 45,
+    49, 51, 0, 70, 105, 114, 101, 32, 80, 114, 111, 116, 101, 99, 116, 105,
+    111, 110, 0, 112, 101, 45, 49, 51, 46, 49, 0, 80, 69, 45, 49, 51,
+    40, 48, 49, 41, 0, 68, 101, 116, 101, 99, 116, 105, 111, 110, 32, 83,
+    121, 115, 116, 101, 109, 115, 32, -30, -128, -108, 32, 65, 117, 116, 111, 109,
+    97, 116, 105, 99, 32, 65, 99, 116, 105, 118, 97, 116, 105, 111, 110, 32,
+    97, 110, 100, 32, 78, 111, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110,
+    0, 112, 101, 45, 49, 51, 46, 50, 0, 80, 69, 45, 49, 51, 40, 48,
+    50, 41, 0, 83, 117, 112, 112, 114, 101, 115, 115, 105, 111, 110, 32, 83,
+    121, 115, 116, 101, 109, 115, 32, -30, -128, -108, 32, 65, 117, 116, 111, 109,
+    97, 116, 105, 99, 32, 65, 99, 116, 105, 118, 97, 116, 105, 111, 110, 32,
+    97, 110, 100, 32, 78, 111, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110,
+    0, 112, 101, 45, 49, 51, 46, 51, 0, 80, 69, 45, 49, 51, 40, 48,
+    51, 41, 0, 65, 117, 116, 111, 109, 97, 116, 105, 99, 32, 70, 105, 114,
+    101, 32, 83, 117, 112, 112, 114, 101, 115, 115, 105, 111, 110, 0, 112, 101,
+    45, 49, 51, 46, 52, 0, 80, 69, 45, 49, 51, 40, 48, 52, 41, 0,
+    73, 110, 115, 112, 101, 99, 116, 105, 111, 110, 115, 0, 112, 101, 45, 49,
+    52, 0, 80, 69, 45, 49, 52, 0, 112, 101, 45, 49, 52, 46, 49, 0,
+    80, 69, 45, 49, 52, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109, 97,
+    116, 105, 99, 32, 67, 111, 110, 116, 114, 111, 108, 115, 0, 112, 101, 45,
+    49, 52, 46, 50, 0, 80, 69, 45, 49, 52, 40, 48, 50, 41, 0, 77,
+    111, 110, 105, 116, 111, 114, 105, 110, 103, 32, 119, 105, 116, 104, 32, 65,
+    108, 97, 114, 109, 115, 32, 97, 110, 100, 32, 78, 111, 116, 105, 102, 105,
+    99, 97, 116, 105, 111, 110, 115, 0, 112, 101, 45, 49, 53, 0, 80, 69,
+    45, 49, 53, 0, 87, 97, 116, 101, 114, 32, 68, 97, 109, 97, 103, 101,
+    32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 112, 101, 45, 49,
+    53, 46, 49, 0, 80, 69, 45, 49, 53, 40, 48, 49, 41, 0, 65, 117,
+    116, 111, 109, 97, 116, 105, 111, 110, 32, 83, 117, 112, 112, 111, 114, 116,
+    0, 112, 101, 45, 49, 54, 0, 80, 69, 45, 49, 54, 0, 68, 101, 108,
+    105, 118, 101, 114, 121, 32, 97, 110, 100, 32, 82, 101, 109, 111, 118, 97,
+    108, 0, 112, 101, 45, 49, 55, 0, 80, 69, 45, 49, 55, 0, 65, 108,
+    116, 101, 114, 110, 97, 116, 101, 32, 87, 111, 114, 107, 32, 83, 105, 116,
+    101, 0, 112, 101, 45, 49, 56, 0, 80, 69, 45, 49, 56, 0, 76, 111,
+    99, 97, 116, 105, 111, 110, 32, 111, 102, 32, 83, 121, 115, 116, 101, 109,
+    32, 67, 111, 109, 112, 111, 110, 101, 110, 116, 115, 0, 112, 101, 45, 49,
+    56, 46, 49, 0, 80, 69, 45, 49, 56, 40, 48, 49, 41, 0, 70, 97,
+    99, 105, 108, 105, 116, 121, 32, 83, 105, 116, 101, 0, 112, 101, 45, 49,
+    57, 0, 80, 69, 45, 49, 57, 0, 73, 110, 102, 111, 114, 109, 97, 116,
+    105, 111, 110, 32, 76, 101, 97, 107, 97, 103, 101, 0, 112, 101, 45, 49,
+    57, 46, 49, 0, 80, 69, 45, 49, 57, 40, 48, 49, 41, 0, 78, 97,
+    116, 105, 111, 110, 97, 108, 32, 69, 109, 105, 115, 115, 105, 111, 110, 115,
+    32, 80, 111, 108, 105, 99, 105, 101, 115, 32, 97, 110, 100, 32, 80, 114,
+    111, 99, 101, 100, 117, 114, 101, 115, 0, 112, 101, 45, 50, 48, 0, 80,
+    69, 45, 50, 48, 0, 65, 115, 115, 101, 116, 32, 77, 111, 110, 105, 116,
+    111, 114, 105, 110, 103, 32, 97, 110, 100, 32, 84, 114, 97, 99, 107, 105,
+    110, 103, 0, 112, 101, 45, 50, 49, 0, 80, 69, 45, 50, 49, 0, 69,
+    108, 101, 99, 116, 114, 111, 109, 97, 103, 110, 101, 116, 105, 99, 32, 80,
+    117, 108, 115, 101, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0,
+    112, 101, 45, 50, 50, 0, 80, 69, 45, 50, 50, 0, 67, 111, 109, 112,
+    111, 110, 101, 110, 116, 32, 77, 97, 114, 107, 105, 110, 103, 0, 112, 101,
+    45, 50, 51, 0, 80, 69, 45, 50, 51, 0, 70, 97, 99, 105, 108, 105,
+    116, 121, 32, 76, 111, 99, 97, 116, 105, 111, 110, 0, 112, 108, 45, 49,
+    0, 80, 76, 45, 48, 49, 0, 80, 108, 97, 110, 110, 105, 110, 103, 0,
+    112, 108, 45, 50, 0, 80, 76, 45, 48, 50, 0, 83, 121, 115, 116, 101,
+    109, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 97, 110, 100, 32, 80,
+    114, 105, 118, 97, 99, 121, 32, 80, 108, 97, 110, 115, 0, 112, 108, 45,
+    50, 46, 49, 0, 80, 76, 45, 48, 50, 40, 48, 49, 41, 0, 67, 111,
+    110, 99, 101, 112, 116, 32, 111, 102, 32, 79, 112, 101, 114, 97, 116, 105,
+    111, 110, 115, 0, 112, 108, 45, 50, 46, 50, 0, 80, 76, 45, 48, 50,
+    40, 48, 50, 41, 0, 70, 117, 110, 99, 116, 105, 111, 110, 97, 108, 32,
+    65, 114, 99, 104, 105, 116, 101, 99, 116, 117, 114, 101, 0, 112, 108, 45,
+    50, 46, 51, 0, 80, 76, 45, 48, 50, 40, 48, 51, 41, 0, 80, 108,
+    97, 110, 32, 97, 110, 100, 32, 67, 111, 111, 114, 100, 105, 110, 97, 116,
+    101, 32, 119, 105, 116, 104, 32, 79, 116, 104, 101, 114, 32, 79, 114, 103,
+    97, 110, 105, 122, 97, 116, 105, 111, 110, 97, 108, 32, 69, 110, 116, 105,
+    116, 105, 101, 115, 0, 112, 108, 45, 51, 0, 80, 76, 45, 48, 51, 0,
+    83, 121, 115, 116, 101, 109, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32,
+    80, 108, 97, 110, 32, 85, 112, 100, 97, 116, 101, 0, 112, 108, 45, 52,
+    0, 80, 76, 45, 48, 52, 0, 82, 117, 108, 101, 115, 32, 111, 102, 32,
+    66, 101, 104, 97, 118, 105, 111, 114, 0, 112, 108, 45, 52, 46, 49, 0,
+    80, 76, 45, 48, 52, 40, 48, 49, 41, 0, 83, 111, 99, 105, 97, 108,
+    32, 77, 101, 100, 105, 97, 32, 97, 110, 100, 32, 69, 120, 116, 101, 114,
+    110, 97, 108, 32, 83, 105, 116, 101, 47, 65, 112, 112, 108, 105, 99, 97,
+    116, 105, 111, 110, 32, 85, 115, 97, 103, 101, 32, 82, 101, 115, 116, 114,
+    105, 99, 116, 105, 111, 110, 115, 0, 112, 108, 45, 53, 0, 80, 76, 45,
+    48, 53, 0, 80, 114, 105, 118, 97, 99, 121, 32, 73, 109, 112, 97, 99,
+    116, 32, 65, 115, 115, 101, 115, 115, 109, 101, 110, 116, 0, 112, 108, 45,
+    54, 0, 80, 76, 45, 48, 54, 0, 83, 101, 99, 117, 114, 105, 116, 121,
+    45, 114, 101, 108, 97, 116, 101, 100, 32, 65, 99, 116, 105, 118, 105, 116,
+    121, 32, 80, 108, 97, 110, 110, 105, 110, 103, 0, 112, 108, 45, 55, 0,
+    80, 76, 45, 48, 55, 0, 112, 108, 45, 56, 0, 80, 76, 45, 48, 56,
+    0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 97, 110, 100, 32, 80, 114,
+    105, 118, 97, 99, 121, 32, 65, 114, 99, 104, 105, 116, 101, 99, 116, 117,
+    114, 101, 115, 0, 112, 108, 45, 56, 46, 49, 0, 80, 76, 45, 48, 56,
+    40, 48, 49, 41, 0, 68, 101, 102, 101, 110, 115, 101, 32, 105, 110, 32,
+    68, 101, 112, 116, 104, 0, 112, 108, 45, 56, 46, 50, 0, 80, 76, 45,
+    48, 56, 40, 48, 50, 41, 0, 83, 117, 112, 112, 108, 105, 101, 114, 32,
+    68, 105, 118, 101, 114, 115, 105, 116, 121, 0, 112, 108, 45, 57, 0, 80,
+    76, 45, 48, 57, 0, 67, 101, 110, 116, 114, 97, 108, 32, 77, 97, 110,
+    97, 103, 101, 109, 101, 110, 116, 0, 112, 108, 45, 49, 48, 0, 80, 76,
+    45, 49, 48, 0, 66, 97, 115, 101, 108, 105, 110, 101, 32, 83, 101, 108,
+    101, 99, 116, 105, 111, 110, 0, 112, 108, 45, 49, 49, 0, 80, 76, 45,
+    49, 49, 0, 66, 97, 115, 101, 108, 105, 110, 101, 32, 84, 97, 105, 108,
+    111, 114, 105, 110, 103, 0, 112, 109, 45, 49, 0, 80, 77, 45, 48, 49,
+    0, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 83, 101, 99,
+    117, 114, 105, 116, 121, 32, 80, 114, 111, 103, 114, 97, 109, 32, 80, 108,
+    97, 110, 0, 80, 114, 111, 103, 114, 97, 109, 32, 77, 97, 110, 97, 103,
+    101, 109, 101, 110, 116, 0, 112, 109, 45, 50, 0, 80, 77, 45, 48, 50,
+    0, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 83, 101, 99,
+    117, 114, 105, 116, 121, 32, 80, 114, 111, 103, 114, 97, 109, 32, 76, 101,
+    97, 100, 101, 114, 115, 104, 105, 112, 32, 82, 111, 108, 101, 0, 112, 109,
+    45, 51, 0, 80, 77, 45, 48, 51, 0, 73, 110, 102, 111, 114, 109, 97,
+    116, 105, 111, 110, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 97, 110,
+    100, 32, 80, 114, 105, 118, 97, 99, 121, 32, 82, 101, 115, 111, 117, 114,
+    99, 101, 115, 0, 112, 109, 45, 52, 0, 80, 77, 45, 48, 52, 0, 80,
+    108, 97, 110, 32, 111, 102, 32, 65, 99, 116, 105, 111, 110, 32, 97, 110,
+    100, 32, 77, 105, 108, 101, 115, 116, 111, 110, 101, 115, 32, 80, 114, 111,
+    99, 101, 115, 115, 0, 112, 109, 45, 53, 0, 80, 77, 45, 48, 53, 0,
+    83, 121, 115, 116, 101, 109, 32, 73, 110, 118, 101, 110, 116, 111, 114, 121,
+    0, 112, 109, 45, 53, 46, 49, 0, 80, 77, 45, 48, 53, 40, 48, 49,
+    41, 0, 73, 110, 118, 101, 110, 116, 111, 114, 121, 32, 111, 102, 32, 80,
+    101, 114, 115, 111, 110, 97, 108, 108, 121, 32, 73, 100, 101, 110, 116, 105,
+    102, 105, 97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105,
+    111, 110, 0, 112, 109, 45, 54, 0, 80, 77, 45, 48, 54, 0, 77, 101,
+    97, 115, 117, 114, 101, 115, 32, 111, 102, 32, 80, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 0, 112, 109, 45, 55, 0, 80, 77, 45, 48, 55,
+    0, 69, 110, 116, 101, 114, 112, 114, 105, 115, 101, 32, 65, 114, 99, 104,
+    105, 116, 101, 99, 116, 117, 114, 101, 0, 112, 109, 45, 55, 46, 49, 0,
+    80, 77, 45, 48, 55, 40, 48, 49, 41, 0, 79, 102, 102, 108, 111, 97,
+    100, 105, 110, 103, 0, 112, 109, 45, 56, 0, 80, 77, 45, 48, 56, 0,
+    67, 114, 105, 116, 105, 99, 97, 108, 32, 73, 110, 102, 114, 97, 115, 116,
+    114, 117, 99, 116, 117, 114, 101, 32, 80, 108, 97, 110, 0, 112, 109, 45,
+    57, 0, 80, 77, 45, 48, 57, 0, 82, 105, 115, 107, 32, 77, 97, 110,
+    97, 103, 101, 109, 101, 110, 116, 32, 83, 116, 114, 97, 116, 101, 103, 121,
+    0, 112, 109, 45, 49, 48, 0, 80, 77, 45, 49, 48, 0, 65, 117, 116,
+    104, 111, 114, 105, 122, 97, 116, 105, 111, 110, 32, 80, 114, 111, 99, 101,
+    115, 115, 0, 112, 109, 45, 49, 49, 0, 80, 77, 45, 49, 49, 0, 77,
+    105, 115, 115, 105, 111, 110, 32, 97, 110, 100, 32, 66, 117, 115, 105, 110,
+    101, 115, 115, 32, 80, 114, 111, 99, 101, 115, 115, 32, 68, 101, 102, 105,
+    110, 105, 116, 105, 111, 110, 0, 112, 109, 45, 49, 50, 0, 80, 77, 45,
+    49, 50, 0, 73, 110, 115, 105, 100, 101, 114, 32, 84, 104, 114, 101, 97,
+    116, 32, 80, 114, 111, 103, 114, 97, 109, 0, 112, 109, 45, 49, 51, 0,
+    80, 77, 45, 49, 51, 0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 97,
+    110, 100, 32, 80, 114, 105, 118, 97, 99, 121, 32, 87, 111, 114, 107, 102,
+    111, 114, 99, 101, 0, 112, 109, 45, 49, 52, 0, 80, 77, 45, 49, 52,
+    0, 84, 101, 115, 116, 105, 110, 103, 44, 32, 84, 114, 97, 105, 110, 105,
+    110, 103, 44, 32, 97, 110, 100, 32, 77, 111, 110, 105, 116, 111, 114, 105,
+    110, 103, 0, 112, 109, 45, 49, 53, 0, 80, 77, 45, 49, 53, 0, 83,
+    101, 99, 117, 114, 105, 116, 121, 32, 97, 110, 100, 32, 80, 114, 105, 118,
+    97, 99, 121, 32, 71, 114, 111, 117, 112, 115, 32, 97, 110, 100, 32, 65,
+    115, 115, 111, 99, 105, 97, 116, 105, 111, 110, 115, 0, 112, 109, 45, 49,
+    54, 0, 80, 77, 45, 49, 54, 0, 84, 104, 114, 101, 97, 116, 32, 65,
+    119, 97, 114, 101, 110, 101, 115, 115, 32, 80, 114, 111, 103, 114, 97, 109,
+    0, 112, 109, 45, 49, 54, 46, 49, 0, 80, 77, 45, 49, 54, 40, 48,
+    49, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 77, 101, 97,
+    110, 115, 32, 102, 111, 114, 32, 83, 104, 97, 114, 105, 110, 103, 32, 84,
+    104, 114, 101, 97, 116, 32, 73, 110, 116, 101, 108, 108, 105, 103, 101, 110,
+    99, 101, 0, 112, 109, 45, 49, 55, 0, 80, 77, 45, 49, 55, 0, 80,
+    114, 111, 116, 101, 99, 116, 105, 110, 103, 32, 67, 111, 110, 116, 114, 111,
+    108, 108, 101, 100, 32, 85, 110, 99, 108, 97, 115, 115, 105, 102, 105, 101,
+    100, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 111, 110,
+    32, 69, 120, 116, 101, 114, 110, 97, 108, 32, 83, 121, 115, 116, 101, 109,
+    115, 0, 112, 109, 45, 49, 56, 0, 80, 77, 45, 49, 56, 0, 80, 114,
+    105, 118, 97, 99, 121, 32, 80, 114, 111, 103, 114, 97, 109, 32, 80, 108,
+    97, 110, 0, 112, 109, 45, 49, 57, 0, 80, 77, 45, 49, 57, 0, 80,
+    114, 105, 118, 97, 99, 121, 32, 80, 114, 111, 103, 114, 97, 109, 32, 76,
+    101, 97, 100, 101, 114, 115, 104, 105, 112, 32, 82, 111, 108, 101, 0, 112,
+    109, 45, 50, 48, 0, 80, 77, 45, 50, 48, 0, 68, 105, 115, 115, 101,
+    109, 105, 110, 97, 116, 105, 111, 110, 32, 111, 102, 32, 80, 114, 105, 118,
+    97, 99, 121, 32, 80, 114, 111, 103, 114, 97, 109, 32, 73, 110, 102, 111,
+    114, 109, 97, 116, 105, 111, 110, 0, 112, 109, 45, 50, 48, 46, 49, 0,
+    80, 77, 45, 50, 48, 40, 48, 49, 41, 0, 80, 114, 105, 118, 97, 99,
+    121, 32, 80, 111, 108, 105, 99, 105, 101, 115, 32, 111, 110, 32, 87, 101,
+    98, 115, 105, 116, 101, 115, 44, 32, 65, 112, 112, 108, 105, 99, 97, 116,
+    105, 111, 110, 115, 44, 32, 97, 110, 100, 32, 68, 105, 103, 105, 116, 97,
+    108, 32, 83, 101, 114, 118, 105, 99, 101, 115, 0, 112, 109, 45, 50, 49,
+    0, 80, 77, 45, 50, 49, 0, 65, 99, 99, 111, 117, 110, 116, 105, 110,
+    103, 32, 111, 102, 32, 68, 105, 115, 99, 108, 111, 115, 117, 114, 101, 115,
+    0, 112, 109, 45, 50, 50, 0, 80, 77, 45, 50, 50, 0, 80, 101, 114,
+    115, 111, 110, 97, 108, 108, 121, 32, 73, 100, 101, 110, 116, 105, 102, 105,
+    97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110,
+    32, 81, 117, 97, 108, 105, 116, 121, 32, 77, 97, 110, 97, 103, 101, 109,
+    101, 110, 116, 0, 112, 109, 45, 50, 51, 0, 80, 77, 45, 50, 51, 0,
+    68, 97, 116, 97, 32, 71, 111, 118, 101, 114, 110, 97, 110, 99, 101, 32,
+    66, 111, 100, 121, 0, 112, 109, 45, 50, 52, 0, 80, 77, 45, 50, 52,
+    0, 68, 97, 116, 97, 32, 73, 110, 116, 101, 103, 114, 105, 116, 121, 32,
+    66, 111, 97, 114, 100, 0, 112, 109, 45, 50, 53, 0, 80, 77, 45, 50,
+    53, 0, 77, 105, 110, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 111,
+    102, 32, 80, 101, 114, 115, 111, 110, 97, 108, 108, 121, 32, 73, 100, 101,
+    110, 116, 105, 102, 105, 97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109,
+    97, 116, 105, 111, 110, 32, 85, 115, 101, 100, 32, 105, 110, 32, 84, 101,
+    115, 116, 105, 110, 103, 44, 32, 84, 114, 97, 105, 110, 105, 110, 103, 44,
+    32, 97, 110, 100, 32, 82, 101, 115, 101, 97, 114, 99, 104, 0, 112, 109,
+    45, 50, 54, 0, 80, 77, 45, 50, 54, 0, 67, 111, 109, 112, 108, 97,
+    105, 110, 116, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 112,
+    109, 45, 50, 55, 0, 80, 77, 45, 50, 55, 0, 80, 114, 105, 118, 97,
+    99, 121, 32, 82, 101, 112, 111, 114, 116, 105, 110, 103, 0, 112, 109, 45,
+    50, 56, 0, 80, 77, 45, 50, 56, 0, 82, 105, 115, 107, 32, 70, 114,
+    97, 109, 105, 110, 103, 0, 112, 109, 45, 50, 57, 0, 80, 77, 45, 50,
+    57, 0, 82, 105, 115, 107, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110,
+    116, 32, 80, 114, 111, 103, 114, 97, 109, 32, 76, 101, 97, 100, 101, 114,
+    115, 104, 105, 112, 32, 82, 111, 108, 101, 115, 0, 112, 109, 45, 51, 48,
+    0, 80, 77, 45, 51, 48, 0, 83, 117, 112, 112, 108, 121, 32, 67, 104,
+    97, 105, 110, 32, 82, 105, 115, 107, 32, 77, 97, 110, 97, 103, 101, 109,
+    101, 110, 116, 32, 83, 116, 114, 97, 116, 101, 103, 121, 0, 112, 109, 45,
+    51, 48, 46, 49, 0, 80, 77, 45, 51, 48, 40, 48, 49, 41, 0, 83,
+    117, 112, 112, 108, 105, 101, 114, 115, 32, 111, 102, 32, 67, 114, 105, 116,
+    105, 99, 97, 108, 32, 111, 114, 32, 77, 105, 115, 115, 105, 111, 110, 45,
+    101, 115, 115, 101, 110, 116, 105, 97, 108, 32, 73, 116, 101, 109, 115, 0,
+    112, 109, 45, 51, 49, 0, 80, 77, 45, 51, 49, 0, 67, 111, 110, 116,
+    105, 110, 117, 111, 117, 115, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110,
+    103, 32, 83, 116, 114, 97, 116, 101, 103, 121, 0, 112, 109, 45, 51, 50,
+    0, 80, 77, 45, 51, 50, 0, 80, 117, 114, 112, 111, 115, 105, 110, 103,
+    0, 112, 115, 45, 49, 0, 80, 83, 45, 48, 49, 0, 80, 101, 114, 115,
+    111, 110, 110, 101, 108, 32, 83, 101, 99, 117, 114, 105, 116, 121, 0, 112,
+    115, 45, 50, 0, 80, 83, 45, 48, 50, 0, 80, 111, 115, 105, 116, 105,
+    111, 110, 32, 82, 105, 115, 107, 32, 68, 101, 115, 105, 103, 110, 97, 116,
+    105, 111, 110, 0, 112, 115, 45, 51, 0, 80, 83, 45, 48, 51, 0, 80,
+    101, 114, 115, 111, 110, 110, 101, 108, 32, 83, 99, 114, 101, 101, 110, 105,
+    110, 103, 0, 112, 115, 45, 51, 46, 49, 0, 80, 83, 45, 48, 51, 40,
+    48, 49, 41, 0, 112, 115, 45, 51, 46, 50, 0, 80, 83, 45, 48, 51,
+    40, 48, 50, 41, 0, 70, 111, 114, 109, 97, 108, 32, 73, 110, 100, 111,
+    99, 116, 114, 105, 110, 97, 116, 105, 111, 110, 0, 112, 115, 45, 51, 46,
+    51, 0, 80, 83, 45, 48, 51, 40, 48, 51, 41, 0, 73, 110, 102, 111,
+    114, 109, 97, 116, 105, 111, 110, 32, 82, 101, 113, 117, 105, 114, 105, 110,
+    103, 32, 83, 112, 101, 99, 105, 97, 108, 32, 80, 114, 111, 116, 101, 99,
+    116, 105, 118, 101, 32, 77, 101, 97, 115, 117, 114, 101, 115, 0, 112, 115,
+    45, 51, 46, 52, 0, 80, 83, 45, 48, 51, 40, 48, 52, 41, 0, 67,
+    105, 116, 105, 122, 101, 110, 115, 104, 105, 112, 32, 82, 101, 113, 117, 105,
+    114, 101, 109, 101, 110, 116, 115, 0, 112, 115, 45, 52, 0, 80, 83, 45,
+    48, 52, 0, 80, 101, 114, 115, 111, 110, 110, 101, 108, 32, 84, 101, 114,
+    109, 105, 110, 97, 116, 105, 111, 110, 0, 112, 115, 45, 52, 46, 49, 0,
+    80, 83, 45, 48, 52, 40, 48, 49, 41, 0, 80, 111, 115, 116, 45, 101,
+    109, 112, 108, 111, 121, 109, 101, 110, 116, 32, 82, 101, 113, 117, 105, 114,
+    101, 109, 101, 110, 116, 115, 0, 112, 115, 45, 52, 46, 50, 0, 80, 83,
+    45, 48, 52, 40, 48, 50, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101,
+    100, 32, 65, 99, 116, 105, 111, 110, 115, 0, 112, 115, 45, 53, 0, 80,
+    83, 45, 48, 53, 0, 80, 101, 114, 115, 111, 110, 110, 101, 108, 32, 84,
+    114, 97, 110, 115, 102, 101, 114, 0, 112, 115, 45, 54, 0, 80, 83, 45,
+    48, 54, 0, 65, 99, 99, 101, 115, 115, 32, 65, 103, 114, 101, 101, 109,
+    101, 110, 116, 115, 0, 112, 115, 45, 54, 46, 49, 0, 80, 83, 45, 48,
+    54, 40, 48, 49, 41, 0, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111,
+    110, 32, 82, 101, 113, 117, 105, 114, 105, 110, 103, 32, 83, 112, 101, 99,
+    105, 97, 108, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 112,
+    115, 45, 54, 46, 50, 0, 80, 83, 45, 48, 54, 40, 48, 50, 41, 0,
+    67, 108, 97, 115, 115, 105, 102, 105, 101, 100, 32, 73, 110, 102, 111, 114,
+    109, 97, 116, 105, 111, 110, 32, 82, 101, 113, 117, 105, 114, 105, 110, 103,
+    32, 83, 112, 101, 99, 105, 97, 108, 32, 80, 114, 111, 116, 101, 99, 116,
+    105, 111, 110, 0, 112, 115, 45, 54, 46, 51, 0, 80, 83, 45, 48, 54,
+    40, 48, 51, 41, 0, 112, 115, 45, 55, 0, 80, 83, 45, 48, 55, 0,
+    69, 120, 116, 101, 114, 110, 97, 108, 32, 80, 101, 114, 115, 111, 110, 110,
+    101, 108, 32, 83, 101, 99, 117, 114, 105, 116, 121, 0, 112, 115, 45, 56,
+    0, 80, 83, 45, 48, 56, 0, 80, 101, 114, 115, 111, 110, 110, 101, 108,
+    32, 83, 97, 110, 99, 116, 105, 111, 110, 115, 0, 112, 115, 45, 57, 0,
+    80, 83, 45, 48, 57, 0, 80, 111, 115, 105, 116, 105, 111, 110, 32, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 115, 0, 112, 116, 45, 49,
+    0, 80, 84, 45, 48, 49, 0, 80, 101, 114, 115, 111, 110, 97, 108, 108,
+    121, 32, 73, 100, 101, 110, 116, 105, 102, 105, 97, 98, 108, 101, 32, 73,
+    110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 80, 114, 111, 99, 101,
+    115, 115, 105, 110, 103, 32, 97, 110, 100, 32, 84, 114, 97, 110, 115, 112,
+    97, 114, 101, 110, 99, 121, 0, 112, 116, 45, 50, 0, 80, 84, 45, 48,
+    50, 0, 65, 117, 116, 104, 111, 114, 105, 116, 121, 32, 116, 111, 32, 80,
+    114, 111, 99, 101, 115, 115, 32, 80, 101, 114, 115, 111, 110, 97, 108, 108,
+    121, 32, 73, 100, 101, 110, 116, 105, 102, 105, 97, 98, 108, 101, 32, 73,
+    110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 112, 116, 45, 50, 46,
+    49, 0, 80, 84, 45, 48, 50, 40, 48, 49, 41, 0, 68, 97, 116, 97,
+    32, 84, 97, 103, 103, 105, 110, 103, 0, 112, 116, 45, 50, 46, 50, 0,
+    80, 84, 45, 48, 50, 40, 48, 50, 41, 0, 65, 117, 116, 111, 109, 97,
+    116, 105, 111, 110, 0, 112, 116, 45, 51, 0, 80, 84, 45, 48, 51, 0,
+    80, 101, 114, 115, 111, 110, 97, 108, 108, 121, 32, 73, 100, 101, 110, 116,
+    105, 102, 105, 97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109, 97, 116,
+    105, 111, 110, 32, 80, 114, 111, 99, 101, 115, 115, 105, 110, 103, 32, 80,
+    117, 114, 112, 111, 115, 101, 115, 0, 112, 116, 45, 51, 46, 49, 0, 80,
+    84, 45, 48, 51, 40, 48, 49, 41, 0, 112, 116, 45, 51, 46, 50, 0,
+    80, 84, 45, 48, 51, 40, 48, 50, 41, 0, 112, 116, 45, 52, 0, 80,
+    84, 45, 48, 52, 0, 67, 111, 110, 115, 101, 110, 116, 0, 112, 116, 45,
+    52, 46, 49, 0, 80, 84, 45, 48, 52, 40, 48, 49, 41, 0, 84, 97,
+    105, 108, 111, 114, 101, 100, 32, 67, 111, 110, 115, 101, 110, 116, 0, 112,
+    116, 45, 52, 46, 50, 0, 80, 84, 45, 48, 52, 40, 48, 50, 41, 0,
+    74, 117, 115, 116, 45, 105, 110, 45, 116, 105, 109, 101, 32, 67, 111, 110,
+    115, 101, 110, 116, 0, 112, 116, 45, 52, 46, 51, 0, 80, 84, 45, 48,
+    52, 40, 48, 51, 41, 0, 82, 101, 118, 111, 99, 97, 116, 105, 111, 110,
+    0, 112, 116, 45, 53, 0, 80, 84, 45, 48, 53, 0, 80, 114, 105, 118,
+    97, 99, 121, 32, 78, 111, 116, 105, 99, 101, 0, 112, 116, 45, 53, 46,
+    49, 0, 80, 84, 45, 48, 53, 40, 48, 49, 41, 0, 74, 117, 115, 116,
+    45, 105, 110, 45, 116, 105, 109, 101, 32, 78, 111, 116, 105, 99, 101, 0,
+    112, 116, 45, 53, 46, 50, 0, 80, 84, 45, 48, 53, 40, 48, 50, 41,
+    0, 80, 114, 105, 118, 97, 99, 121, 32, 65, 99, 116, 32, 83, 116, 97,
+    116, 101, 109, 101, 110, 116, 115, 0, 112, 116, 45, 54, 0, 80, 84, 45,
+    48, 54, 0, 83, 121, 115, 116, 101, 109, 32, 111, 102, 32, 82, 101, 99,
+    111, 114, 100, 115, 32, 78, 111, 116, 105, 99, 101, 0, 112, 116, 45, 54,
+    46, 49, 0, 80, 84, 45, 48, 54, 40, 48, 49, 41, 0, 82, 111, 117,
+    116, 105, 110, 101, 32, 85, 115, 101, 115, 0, 112, 116, 45, 54, 46, 50,
+    0, 80, 84, 45, 48, 54, 40, 48, 50, 41, 0, 69, 120, 101, 109, 112,
+    116, 105, 111, 110, 32, 82, 117, 108, 101, 115, 0, 112, 116, 45, 55, 0,
+    80, 84, 45, 48, 55, 0, 83, 112, 101, 99, 105, 102, 105, 99, 32, 67,
+    97, 116, 101, 103, 111, 114, 105, 101, 115, 32, 111, 102, 32, 80, 101, 114,
+    115, 111, 110, 97, 108, 108, 121, 32, 73, 100, 101, 110, 116, 105, 102, 105,
+    97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110,
+    0, 112, 116, 45, 55, 46, 49, 0, 80, 84, 45, 48, 55, 40, 48, 49,
+    41, 0, 83, 111, 99, 105, 97, 108, 32, 83, 101, 99, 117, 114, 105, 116,
+    121, 32, 78, 117, 109, 98, 101, 114, 115, 0, 112, 116, 45, 55, 46, 50,
+    0, 80, 84, 45, 48, 55, 40, 48, 50, 41, 0, 70, 105, 114, 115, 116,
+    32, 65, 109, 101, 110, 100, 109, 101, 110, 116, 32, 73, 110, 102, 111, 114,
+    109, 97, 116, 105, 111, 110, 0, 112, 116, 45, 56, 0, 80, 84, 45, 48,
+    56, 0, 67, 111, 109, 112, 117, 116, 101, 114, 32, 77, 97, 116, 99, 104,
+    105, 110, 103, 32, 82, 101, 113, 117, 105, 114, 101, 109, 101, 110, 116, 115,
+    0, 114, 97, 45, 49, 0, 82, 65, 45, 48, 49, 0, 82, 105, 115, 107,
+    32, 65, 115, 115, 101, 115, 115, 109, 101, 110, 116, 0, 114, 97, 45, 50,
+    0, 82, 65, 45, 48, 50, 0, 83, 101, 99, 117, 114, 105, 116, 121, 32,
+    67, 97, 116, 101, 103, 111, 114, 105, 122, 97, 116, 105, 111, 110, 0, 114,
+    97, 45, 50, 46, 49, 0, 82, 65, 45, 48, 50, 40, 48, 49, 41, 0,
+    73, 109, 112, 97, 99, 116, 45, 108, 101, 118, 101, 108, 32, 80, 114, 105,
+    111, 114, 105, 116, 105, 122, 97, 116, 105, 111, 110, 0, 114, 97, 45, 51,
+    0, 82, 65, 45, 48, 51, 0, 114, 97, 45, 51, 46, 49, 0, 82, 65,
+    45, 48, 51, 40, 48, 49, 41, 0, 83, 117, 112, 112, 108, 121, 32, 67,
+    104, 97, 105, 110, 32, 82, 105, 115, 107, 32, 65, 115, 115, 101, 115, 115,
+    109, 101, 110, 116, 0, 114, 97, 45, 51, 46, 50, 0, 82, 65, 45, 48,
+    51, 40, 48, 50, 41, 0, 85, 115, 101, 32, 111, 102, 32, 65, 108, 108,
+    45, 115, 111, 117, 114, 99, 101, 32, 73, 110, 116, 101, 108, 108, 105, 103,
+    101, 110, 99, 101, 0, 114, 97, 45, 51, 46, 51, 0, 82, 65, 45, 48,
+    51, 40, 48, 51, 41, 0, 68, 121, 110, 97, 109, 105, 99, 32, 84, 104,
+    114, 101, 97, 116, 32, 65, 119, 97, 114, 101, 110, 101, 115, 115, 0, 114,
+    97, 45, 51, 46, 52, 0, 82, 65, 45, 48, 51, 40, 48, 52, 41, 0,
+    80, 114, 101, 100, 105, 99, 116, 105, 118, 101, 32, 67, 121, 98, 101, 114,
+    32, 65, 110, 97, 108, 121, 116, 105, 99, 115, 0, 114, 97, 45, 52, 0,
+    82, 65, 45, 48, 52, 0, 82, 105, 115, 107, 32, 65, 115, 115, 101, 115,
+    115, 109, 101, 110, 116, 32, 85, 112, 100, 97, 116, 101, 0, 114, 97, 45,
+    53, 0, 82, 65, 45, 48, 53, 0, 86, 117, 108, 110, 101, 114, 97, 98,
+    105, 108, 105, 116, 121, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103,
+    32, 97, 110, 100, 32, 83, 99, 97, 110, 110, 105, 110, 103, 0, 114, 97,
+    45, 53, 46, 49, 0, 82, 65, 45, 48, 53, 40, 48, 49, 41, 0, 85,
+    112, 100, 97, 116, 101, 32, 84, 111, 111, 108, 32, 67, 97, 112, 97, 98,
+    105, 108, 105, 116, 121, 0, 114, 97, 45, 53, 46, 50, 0, 82, 65, 45,
+    48, 53, 40, 48, 50, 41, 0, 85, 112, 100, 97, 116, 101, 32, 86, 117,
+    108, 110, 101, 114, 97, 98, 105, 108, 105, 116, 105, 101, 115, 32, 116, 111,
+    32, 66, 101, 32, 83, 99, 97, 110, 110, 101, 100, 0, 114, 97, 45, 53,
+    46, 51, 0, 82, 65, 45, 48, 53, 40, 48, 51, 41, 0, 66, 114, 101,
+    97, 100, 116, 104, 32, 97, 110, 100, 32, 68, 101, 112, 116, 104, 32, 111,
+    102, 32, 67, 111, 118, 101, 114, 97, 103, 101, 0, 114, 97, 45, 53, 46,
+    52, 0, 82, 65, 45, 48, 53, 40, 48, 52, 41, 0, 68, 105, 115, 99,
+    111, 118, 101, 114, 97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109, 97,
+    116, 105, 111, 110, 0, 114, 97, 45, 53, 46, 53, 0, 82, 65, 45, 48,
+    53, 40, 48, 53, 41, 0, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100,
+    32, 65, 99, 99, 101, 115, 115, 0, 114, 97, 45, 53, 46, 54, 0, 82,
+    65, 45, 48, 53, 40, 48, 54, 41, 0, 65, 117, 116, 111, 109, 97, 116,
+    101, 100, 32, 84, 114, 101, 110, 100, 32, 65, 110, 97, 108, 121, 115, 101,
+    115, 0, 114, 97, 45, 53, 46, 55, 0, 82, 65, 45, 48, 53, 40, 48,
+    55, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 68, 101, 116,
+    101, 99, 116, 105, 111, 110, 32, 97, 110, 100, 32, 78, 111, 116, 105, 102,
+    105, 99, 97, 116, 105, 111, 110, 32, 111, 102, 32, 85, 110, 97, 117, 116,
+    104, 111, 114, 105, 122, 101, 100, 32, 67, 111, 109, 112, 111, 110, 101, 110,
+    116, 115, 0, 114, 97, 45, 53, 46, 56, 0, 82, 65, 45, 48, 53, 40,
+    48, 56, 41, 0, 82, 101, 118, 105, 101, 119, 32, 72, 105, 115, 116, 111,
+    114, 105, 99, 32, 65, 117, 100, 105, 116, 32, 76, 111, 103, 115, 0, 114,
+    97, 45, 53, 46, 57, 0, 82, 65, 45, 48, 53, 40, 48, 57, 41, 0,
+    80, 101, 110, 101, 116, 114, 97, 116, 105, 111, 110, 32, 84, 101, 115, 116,
+    105, 110, 103, 32, 97, 110, 100, 32, 65, 110, 97, 108, 121, 115, 101, 115,
+    0, 114, 97, 45, 53, 46, 49, 48, 0, 82, 65, 45, 48, 53, 40, 49,
+    48, 41, 0, 67, 111, 114, 114, 101, 108, 97, 116, 101, 32, 83, 99, 97,
+    110, 110, 105, 110, 103, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111,
+    110, 0, 114, 97, 45, 53, 46, 49, 49, 0, 82, 65, 45, 48, 53, 40,
+    49, 49, 41, 0, 80, 117, 98, 108, 105, 99, 32, 68, 105, 115, 99, 108,
+    111, 115, 117, 114, 101, 32, 80, 114, 111, 103, 114, 97, 109, 0, 114, 97,
+    45, 54, 0, 82, 65, 45, 48, 54, 0, 84, 101, 99, 104, 110, 105, 99,
+    97, 108, 32, 83, 117, 114, 118, 101, 105, 108, 108, 97, 110, 99, 101, 32,
+    67, 111, 117, 110, 116, 101, 114, 109, 101, 97, 115, 117, 114, 101, 115, 32,
+    83, 117, 114, 118, 101, 121, 0, 114, 97, 45, 55, 0, 82, 65, 45, 48,
+    55, 0, 82, 105, 115, 107, 32, 82, 101, 115, 112, 111, 110, 115, 101, 0,
+    114, 97, 45, 56, 0, 82, 65, 45, 48, 56, 0, 80, 114, 105, 118, 97,
+    99, 121, 32, 73, 109, 112, 97, 99, 116, 32, 65, 115, 115, 101, 115, 115,
+    109, 101, 110, 116, 115, 0, 114, 97, 45, 57, 0, 82, 65, 45, 48, 57,
+    0, 67, 114, 105, 116, 105, 99, 97, 108, 105, 116, 121, 32, 65, 110, 97,
+    108, 121, 115, 105, 115, 0, 114, 97, 45, 49, 48, 0, 82, 65, 45, 49,
+    48, 0, 84, 104, 114, 101, 97, 116, 32, 72, 117, 110, 116, 105, 110, 103,
+    0, 115, 97, 45, 49, 0, 83, 65, 45, 48, 49, 0, 83, 121, 115, 116,
+    101, 109, 32, 97, 110, 100, 32, 83, 101, 114, 118, 105, 99, 101, 115, 32,
+    65, 99, 113, 117, 105, 115, 105, 116, 105, 111, 110, 0, 115, 97, 45, 50,
+    0, 83, 65, 45, 48, 50, 0, 65, 108, 108, 111, 99, 97, 116, 105, 111,
+    110, 32, 111, 102, 32, 82, 101, 115, 111, 117, 114, 99, 101, 115, 0, 115,
+    97, 45, 51, 0, 83, 65, 45, 48, 51, 0, 83, 121, 115, 116, 101, 109,
+    32, 68, 101, 118, 101, 108, 111, 112, 109, 101, 110, 116, 32, 76, 105, 102,
+    101, 32, 67, 121, 99, 108, 101, 0, 115, 97, 45, 51, 46, 49, 0, 83,
+    65, 45, 48, 51, 40, 48, 49, 41, 0, 77, 97, 110, 97, 103, 101, 32,
+    80, 114, 101, 112, 114, 111, 100, 117, 99, 116, 105, 111, 110, 32, 69, 110,
+    118, 105, 114, 111, 110, 109, 101, 110, 116, 0, 115, 97, 45, 51, 46, 50,
+    0, 83, 65, 45, 48, 51, 40, 48, 50, 41, 0, 85, 115, 101, 32, 111,
+    102, 32, 76, 105, 118, 101, 32, 111, 114, 32, 79, 112, 101, 114, 97, 116,
+    105, 111, 110, 97, 108, 32, 68, 97, 116, 97, 0, 115, 97, 45, 51, 46,
+    51, 0, 83, 65, 45, 48, 51, 40, 48, 51, 41, 0, 84, 101, 99, 104,
+    110, 111, 108, 111, 103, 121, 32, 82, 101, 102, 114, 101, 115, 104, 0, 115,
+    97, 45, 52, 0, 83, 65, 45, 48, 52, 0, 65, 99, 113, 117, 105, 115,
+    105, 116, 105, 111, 110, 32, 80, 114, 111, 99, 101, 115, 115, 0, 115, 97,
+    45, 52, 46, 49, 0, 83, 65, 45, 48, 52, 40, 48, 49, 41, 0, 70,
+    117, 110, 99, 116, 105, 111, 110, 97, 108, 32, 80, 114, 111, 112, 101, 114,
+    116, 105, 101, 115, 32, 111, 102, 32, 67, 111, 110, 116, 114, 111, 108, 115,
+    0, 115, 97, 45, 52, 46, 50, 0, 83, 65, 45, 48, 52, 40, 48, 50,
+    41, 0, 68, 101, 115, 105, 103, 110, 32, 97, 110, 100, 32, 73, 109, 112,
+    108, 101, 109, 101, 110, 116, 97, 116, 105, 111, 110, 32, 73, 110, 102, 111,
+    114, 109, 97, 116, 105, 111, 110, 32, 102, 111, 114, 32, 67, 111, 110, 116,
+    114, 111, 108, 115, 0, 115, 97, 45, 52, 46, 51, 0, 83, 65, 45, 48,
+    52, 40, 48, 51, 41, 0, 68, 101, 118, 101, 108, 111, 112, 109, 101, 110,
+    116, 32, 77, 101, 116, 104, 111, 100, 115, 44, 32, 84, 101, 99, 104, 110,
+    105, 113, 117, 101, 115, 44, 32, 97, 110, 100, 32, 80, 114, 97, 99, 116,
+    105, 99, 101, 115, 0, 115, 97, 45, 52, 46, 52, 0, 83, 65, 45, 48,
+    52, 40, 48, 52, 41, 0, 115, 97, 45, 52, 46, 53, 0, 83, 65, 45,
+    48, 52, 40, 48, 53, 41, 0, 83, 121, 115, 116, 101, 109, 44, 32, 67,
+    111, 109, 112, 111, 110, 101, 110, 116, 44, 32, 97, 110, 100, 32, 83, 101,
+    114, 118, 105, 99, 101, 32, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116,
+    105, 111, 110, 115, 0, 115, 97, 45, 52, 46, 54, 0, 83, 65, 45, 48,
+    52, 40, 48, 54, 41, 0, 85, 115, 101, 32, 111, 102, 32, 73, 110, 102,
+    111, 114, 109, 97, 116, 105, 111, 110, 32, 65, 115, 115, 117, 114, 97, 110,
+    99, 101, 32, 80, 114, 111, 100, 117, 99, 116, 115, 0, 115, 97, 45, 52,
+    46, 55, 0, 83, 65, 45, 48, 52, 40, 48, 55, 41, 0, 78, 73, 65,
+    80, 45, 97, 112, 112, 114, 111, 118, 101, 100, 32, 80, 114, 111, 116, 101,
+    99, 116, 105, 111, 110, 32, 80, 114, 111, 102, 105, 108, 101, 115, 32, 0,
+    115, 97, 45, 52, 46, 56, 0, 83, 65, 45, 48, 52, 40, 48, 56, 41,
+    0, 67, 111, 110, 116, 105, 110, 117, 111, 117, 115, 32, 77, 111, 110, 105,
+    116, 111, 114, 105, 110, 103, 32, 80, 108, 97, 110, 32, 102, 111, 114, 32,
+    67, 111, 110, 116, 114, 111, 108, 115, 0, 115, 97, 45, 52, 46, 57, 0,
+    83, 65, 45, 48, 52, 40, 48, 57, 41, 0, 70, 117, 110, 99, 116, 105,
+    111, 110, 115, 44, 32, 80, 111, 114, 116, 115, 44, 32, 80, 114, 111, 116,
+    111, 99, 111, 108, 115, 44, 32, 97, 110, 100, 32, 83, 101, 114, 118, 105,
+    99, 101, 115, 32, 105, 110, 32, 85, 115, 101, 0, 115, 97, 45, 52, 46,
+    49, 48, 0, 83, 65, 45, 48, 52, 40, 49, 48, 41, 0, 85, 115, 101,
+    32, 111, 102, 32, 65, 112, 112, 114, 111, 118, 101, 100, 32, 80, 73, 86,
+    32, 80, 114, 111, 100, 117, 99, 116, 115, 0, 115, 97, 45, 52, 46, 49,
+    49, 0, 83, 65, 45, 48, 52, 40, 49, 49, 41, 0, 83, 121, 115, 116,
+    101, 109, 32, 111, 102, 32, 82, 101, 99, 111, 114, 100, 115, 0, 115, 97,
+    45, 52, 46, 49, 50, 0, 83, 65, 45, 48, 52, 40, 49, 50, 41, 0,
+    68, 97, 116, 97, 32, 79, 119, 110, 101, 114, 115, 104, 105, 112, 0, 115,
+    97, 45, 53, 0, 83, 65, 45, 48, 53, 0, 83, 121, 115, 116, 101, 109,
+    32, 68, 111, 99, 117, 109, 101, 110, 116, 97, 116, 105, 111, 110, 0, 115,
+    97, 45, 53, 46, 49, 0, 83, 65, 45, 48, 53, 40, 48, 49, 41, 0,
+    70, 117, 110, 99, 116, 105, 111, 110, 97, 108, 32, 80, 114, 111, 112, 101,
+    114, 116, 105, 101, 115, 32, 111, 102, 32, 83, 101, 99, 117, 114, 105, 116,
+    121, 32, 67, 111, 110, 116, 114, 111, 108, 115, 0, 115, 97, 45, 53, 46,
+    50, 0, 83, 65, 45, 48, 53, 40, 48, 50, 41, 0, 83, 101, 99, 117,
+    114, 105, 116, 121, 45, 114, 101, 108, 101, 118, 97, 110, 116, 32, 69, 120,
+    116, 101, 114, 110, 97, 108, 32, 83, 121, 115, 116, 101, 109, 32, 73, 110,
+    116, 101, 114, 102, 97, 99, 101, 115, 0, 115, 97, 45, 53, 46, 51, 0,
+    83, 65, 45, 48, 53, 40, 48, 51, 41, 0, 72, 105, 103, 104, 45, 108,
+    101, 118, 101, 108, 32, 68, 101, 115, 105, 103, 110, 0, 115, 97, 45, 53,
+    46, 52, 0, 83, 65, 45, 48, 53, 40, 48, 52, 41, 0, 76, 111, 119,
+    45, 108, 101, 118, 101, 108, 32, 68, 101, 115, 105, 103, 110, 0, 115, 97,
+    45, 53, 46, 53, 0, 83, 65, 45, 48, 53, 40, 48, 53, 41, 0, 83,
+    111, 117, 114, 99, 101, 32, 67, 111, 100, 101, 0, 115, 97, 45, 54, 0,
+    83, 65, 45, 48, 54, 0, 115, 97, 45, 55, 0, 83, 65, 45, 48, 55,
+    0, 115, 97, 45, 56, 0, 83, 65, 45, 48, 56, 0, 83, 101, 99, 117,
+    114, 105, 116, 121, 32, 97, 110, 100, 32, 80, 114, 105, 118, 97, 99, 121,
+    32, 69, 110, 103, 105, 110, 101, 101, 114, 105, 110, 103, 32, 80, 114, 105,
+    110, 99, 105, 112, 108, 101, 115, 0, 115, 97, 45, 56, 46, 49, 0, 83,
+    65, 45, 48, 56, 40, 48, 49, 41, 0, 67, 108, 101, 97, 114, 32, 65,
+    98, 115, 116, 114, 97, 99, 116, 105, 111, 110, 115, 0, 115, 97, 45, 56,
+    46, 50, 0, 83, 65, 45, 48, 56, 40, 48, 50, 41, 0, 76, 101, 97,
+    115, 116, 32, 67, 111, 109, 109, 111, 110, 32, 77, 101, 99, 104, 97, 110,
+    105, 115, 109, 0, 115, 97, 45, 56, 46, 51, 0, 83, 65, 45, 48, 56,
+    40, 48, 51, 41, 0, 77, 111, 100, 117, 108, 97, 114, 105, 116, 121, 32,
+    97, 110, 100, 32, 76, 97, 121, 101, 114, 105, 110, 103, 0, 115, 97, 45,
+    56, 46, 52, 0, 83, 65, 45, 48, 56, 40, 48, 52, 41, 0, 80, 97,
+    114, 116, 105, 97, 108, 108, 121, 32, 79, 114, 100, 101, 114, 101, 100, 32,
+    68, 101, 112, 101, 110, 100, 101, 110, 99, 105, 101, 115, 0, 115, 97, 45,
+    56, 46, 53, 0, 83, 65, 45, 48, 56, 40, 48, 53, 41, 0, 69, 102,
+    102, 105, 99, 105, 101, 110, 116, 108, 121, 32, 77, 101, 100, 105, 97, 116,
+    101, 100, 32, 65, 99, 99, 101, 115, 115, 0, 115, 97, 45, 56, 46, 54,
+    0, 83, 65, 45, 48, 56, 40, 48, 54, 41, 0, 77, 105, 110, 105, 109,
+    105, 122, 101, 100, 32, 83, 104, 97, 114, 105, 110, 103, 0, 115, 97, 45,
+    56, 46, 55, 0, 83, 65, 45, 48, 56, 40, 48, 55, 41, 0, 82, 101,
+    100, 117, 99, 101, 100, 32, 67, 111, 109, 112, 108, 101, 120, 105, 116, 121,
+    0, 115, 97, 45, 56, 46, 56, 0, 83, 65, 45, 48, 56, 40, 48, 56,
+    41, 0, 83, 101, 99, 117, 114, 101, 32, 69, 118, 111, 108, 118, 97, 98,
+    105, 108, 105, 116, 121, 0, 115, 97, 45, 56, 46, 57, 0, 83, 65, 45,
+    48, 56, 40, 48, 57, 41, 0, 84, 114, 117, 115, 116, 101, 100, 32, 67,
+    111, 109, 112, 111, 110, 101, 110, 116, 115, 0, 115, 97, 45, 56, 46, 49,
+    48, 0, 83, 65, 45, 48, 56, 40, 49, 48, 41, 0, 72, 105, 101, 114,
+    97, 114, 99, 104, 105, 99, 97, 108, 32, 84, 114, 117, 115, 116, 0, 115,
+    97, 45, 56, 46, 49, 49, 0, 83, 65, 45, 48, 56, 40, 49, 49, 41,
+    0, 73, 110, 118, 101, 114, 115, 101, 32, 77, 111, 100, 105, 102, 105, 99,
+    97, 116, 105, 111, 110, 32, 84, 104, 114, 101, 115, 104, 111, 108, 100, 0,
+    115, 97, 45, 56, 46, 49, 50, 0, 83, 65, 45, 48, 56, 40, 49, 50,
+    41, 0, 72, 105, 101, 114, 97, 114, 99, 104, 105, 99, 97, 108, 32, 80,
+    114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 115, 97, 45, 56, 46, 49,
+    51, 0, 83, 65, 45, 48, 56, 40, 49, 51, 41, 0, 77, 105, 110, 105,
+    109, 105, 122, 101, 100, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 69,
+    108, 101, 109, 101, 110, 116, 115, 0, 115, 97, 45, 56, 46, 49, 52, 0,
+    83, 65, 45, 48, 56, 40, 49, 52, 41, 0, 115, 97, 45, 56, 46, 49,
+    53, 0, 83, 65, 45, 48, 56, 40, 49, 53, 41, 0, 80, 114, 101, 100,
+    105, 99, 97, 116, 101, 32, 80, 101, 114, 109, 105, 115, 115, 105, 111, 110,
+    0, 115, 97, 45, 56, 46, 49, 54, 0, 83, 65, 45, 48, 56, 40, 49,
+    54, 41, 0, 83, 101, 108, 102, 45, 114, 101, 108, 105, 97, 110, 116, 32,
+    84, 114, 117, 115, 116, 119, 111, 114, 116, 104, 105, 110, 101, 115, 115, 0,
+    115, 97, 45, 56, 46, 49, 55, 0, 83, 65, 45, 48, 56, 40, 49, 55,
+    41, 0, 83, 101, 99, 117, 114, 101, 32, 68, 105, 115, 116, 114, 105, 98,
+    117, 116, 101, 100, 32, 67, 111, 109, 112, 111, 115, 105, 116, 105, 111, 110,
+    0, 115, 97, 45, 56, 46, 49, 56, 0, 83, 65, 45, 48, 56, 40, 49,
+    56, 41, 0, 84, 114, 117, 115, 116, 101, 100, 32, 67, 111, 109, 109, 117,
+    110, 105, 99, 97, 116, 105, 111, 110, 115, 32, 67, 104, 97, 110, 110, 101,
+    108, 115, 0, 115, 97, 45, 56, 46, 49, 57, 0, 83, 65, 45, 48, 56,
+    40, 49, 57, 41, 0, 67, 111, 110, 116, 105, 110, 117, 111, 117, 115, 32,
+    80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 115, 97, 45, 56, 46,
+    50, 48, 0, 83, 65, 45, 48, 56, 40, 50, 48, 41, 0, 83, 101, 99,
+    117, 114, 101, 32, 77, 101, 116, 97, 100, 97, 116, 97, 32, 77, 97, 110,
+    97, 103, 101, 109, 101, 110, 116, 0, 115, 97, 45, 56, 46, 50, 49, 0,
+    83, 65, 45, 48, 56, 40, 50, 49, 41, 0, 83, 101, 108, 102, 45, 97,
+    110, 97, 108, 121, 115, 105, 115, 0, 115, 97, 45, 56, 46, 50, 50, 0,
+    83, 65, 45, 48, 56, 40, 50, 50, 41, 0, 65, 99, 99, 111, 117, 110,
+    116, 97, 98, 105, 108, 105, 116, 121, 32, 97, 110, 100, 32, 84, 114, 97,
+    99, 101, 97, 98, 105, 108, 105, 116, 121, 0, 115, 97, 45, 56, 46, 50,
+    51, 0, 83, 65, 45, 48, 56, 40, 50, 51, 41, 0, 83, 101, 99, 117,
+    114, 101, 32, 68, 101, 102, 97, 117, 108, 116, 115, 0, 115, 97, 45, 56,
+    46, 50, 52, 0, 83, 65, 45, 48, 56, 40, 50, 52, 41, 0, 83, 101,
+    99, 117, 114, 101, 32, 70, 97, 105, 108, 117, 114, 101, 32, 97, 110, 100,
+    32, 82, 101, 99, 111, 118, 101, 114, 121, 0, 115, 97, 45, 56, 46, 50,
+    53, 0, 83, 65, 45, 48, 56, 40, 50, 53, 41, 0, 69, 99, 111, 110,
+    111, 109, 105, 99, 32, 83, 101, 99, 117, 114, 105, 116, 121, 0, 115, 97,
+    45, 56, 46, 50, 54, 0, 83, 65, 45, 48, 56, 40, 50, 54, 41, 0,
+    80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 83, 101, 99, 117,
+    114, 105, 116, 121, 0, 115, 97, 45, 56, 46, 50, 55, 0, 83, 65, 45,
+    48, 56, 40, 50, 55, 41, 0, 72, 117, 109, 97, 110, 32, 70, 97, 99,
+    116, 111, 114, 101, 100, 32, 83, 101, 99, 117, 114, 105, 116, 121, 0, 115,
+    97, 45, 56, 46, 50, 56, 0, 83, 65, 45, 48, 56, 40, 50, 56, 41,
+    0, 65, 99, 99, 101, 112, 116, 97, 98, 108, 101, 32, 83, 101, 99, 117,
+    114, 105, 116, 121, 0, 115, 97, 45, 56, 46, 50, 57, 0, 83, 65, 45,
+    48, 56, 40, 50, 57, 41, 0, 82, 101, 112, 101, 97, 116, 97, 98, 108,
+    101, 32, 97, 110, 100, 32, 68, 111, 99, 117, 109, 101, 110, 116, 101, 100,
+    32, 80, 114, 111, 99, 101, 100, 117, 114, 101, 115, 0, 115, 97, 45, 56,
+    46, 51, 48, 0, 83, 65, 45, 48, 56, 40, 51, 48, 41, 0, 80, 114,
+    111, 99, 101, 100, 117, 114, 97, 108, 32, 82, 105, 103, 111, 114, 0, 115,
+    97, 45, 56, 46, 51, 49, 0, 83, 65, 45, 48, 56, 40, 51, 49, 41,
+    0, 83, 101, 99, 117, 114, 101, 32, 83, 121, 115, 116, 101, 109, 32, 77,
+    111, 100, 105, 102, 105, 99, 97, 116, 105, 111, 110, 0, 115, 97, 45, 56,
+    46, 51, 50, 0, 83, 65, 45, 48, 56, 40, 51, 50, 41, 0, 83, 117,
+    102, 102, 105, 99, 105, 101, 110, 116, 32, 68, 111, 99, 117, 109, 101, 110,
+    116, 97, 116, 105, 111, 110, 0, 115, 97, 45, 56, 46, 51, 51, 0, 83,
+    65, 45, 48, 56, 40, 51, 51, 41, 0, 77, 105, 110, 105, 109, 105, 122,
+    97, 116, 105, 111, 110, 0, 115, 97, 45, 57, 0, 83, 65, 45, 48, 57,
+    0, 69, 120, 116, 101, 114, 110, 97, 108, 32, 83, 121, 115, 116, 101, 109,
+    32, 83, 101, 114, 118, 105, 99, 101, 115, 0, 115, 97, 45, 57, 46, 49,
+    0, 83, 65, 45, 48, 57, 40, 48, 49, 41, 0, 82, 105, 115, 107, 32,
+    65, 115, 115, 101, 115, 115, 109, 101, 110, 116, 115, 32, 97, 110, 100, 32,
+    79, 114, 103, 97, 110, 105, 122, 97, 116, 105, 111, 110, 97, 108, 32, 65,
+    112, 112, 114, 111, 118, 97, 108, 115, 0, 115, 97, 45, 57, 46, 50, 0,
+    83, 65, 45, 48, 57, 40, 48, 50, 41, 0, 73, 100, 101, 110, 116, 105,
+    102, 105, 99, 97, 116, 105, 111, 110, 32, 111, 102, 32, 70, 117, 110, 99,
+    116, 105, 111, 110, 115, 44, 32, 80, 111, 114, 116, 115, 44, 32, 80, 114,
+    111, 116, 111, 99, 111, 108, 115, 44, 32, 97, 110, 100, 32, 83, 101, 114,
+    118, 105, 99, 101, 115, 0, 115, 97, 45, 57, 46, 51, 0, 83, 65, 45,
+    48, 57, 40, 48, 51, 41, 0, 69, 115, 116, 97, 98, 108, 105, 115, 104,
+    32, 97, 110, 100, 32, 77, 97, 105, 110, 116, 97, 105, 110, 32, 84, 114,
+    117, 115, 116, 32, 82, 101, 108, 97, 116, 105, 111, 110, 115, 104, 105, 112,
+    32, 119, 105, 116, 104, 32, 80, 114, 111, 118, 105, 100, 101, 114, 115, 0,
+    115, 97, 45, 57, 46, 52, 0, 83, 65, 45, 48, 57, 40, 48, 52, 41,
+    0, 67, 111, 110, 115, 105, 115, 116, 101, 110, 116, 32, 73, 110, 116, 101,
+    114, 101, 115, 116, 115, 32, 111, 102, 32, 67, 111, 110, 115, 117, 109, 101,
+    114, 115, 32, 97, 110, 100, 32, 80, 114, 111, 118, 105, 100, 101, 114, 115,
+    0, 115, 97, 45, 57, 46, 53, 0, 83, 65, 45, 48, 57, 40, 48, 53,
+    41, 0, 80, 114, 111, 99, 101, 115, 115, 105, 110, 103, 44, 32, 83, 116,
+    111, 114, 97, 103, 101, 44, 32, 97, 110, 100, 32, 83, 101, 114, 118, 105,
+    99, 101, 32, 76, 111, 99, 97, 116, 105, 111, 110, 0, 115, 97, 45, 57,
+    46, 54, 0, 83, 65, 45, 48, 57, 40, 48, 54, 41, 0, 79, 114, 103,
+    97, 110, 105, 122, 97, 116, 105, 111, 110, 45, 99, 111, 110, 116, 114, 111,
+    108, 108, 101, 100, 32, 67, 114, 121, 112, 116, 111, 103, 114, 97, 112, 104,
+    105, 99, 32, 75, 101, 121, 115, 0, 115, 97, 45, 57, 46, 55, 0, 83,
+    65, 45, 48, 57, 40, 48, 55, 41, 0, 79, 114, 103, 97, 110, 105, 122,
+    97, 116, 105, 111, 110, 45, 99, 111, 110, 116, 114, 111, 108, 108, 101, 100,
+    32, 73, 110, 116, 101, 103, 114, 105, 116, 121, 32, 67, 104, 101, 99, 107,
+    105, 110, 103, 0, 115, 97, 45, 57, 46, 56, 0, 83, 65, 45, 48, 57,
+    40, 48, 56, 41, 0, 80, 114, 111, 99, 101, 115, 115, 105, 110, 103, 32,
+    97, 110, 100, 32, 83, 116, 111, 114, 97, 103, 101, 32, 76, 111, 99, 97,
+    116, 105, 111, 110, 32, -30, -128, -108, 32, 85, 46, 83, 46, 32, 74, 117,
+    114, 105, 115, 100, 105, 99, 116, 105, 111, 110, 0, 115, 97, 45, 49, 48,
+    0, 83, 65, 45, 49, 48, 0, 68, 101, 118, 101, 108, 111, 112, 101, 114,
+    32, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 77,
+    97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 115, 97, 45, 49, 48, 46,
+    49, 0, 83, 65, 45, 49, 48, 40, 48, 49, 41, 0, 83, 111, 102, 116,
+    119, 97, 114, 101, 32, 97, 110, 100, 32, 70, 105, 114, 109, 119, 97, 114,
+    101, 32, 73, 110, 116, 101, 103, 114, 105, 116, 121, 32, 86, 101, 114, 105,
+    102, 105, 99, 97, 116, 105, 111, 110, 0, 115, 97, 45, 49, 48, 46, 50,
+    0, 83, 65, 45, 49, 48, 40, 48, 50, 41, 0, 65, 108, 116, 101, 114,
+    110, 97, 116, 105, 118, 101, 32, 67, 111, 110, 102, 105, 103, 117, 114, 97,
+    116, 105, 111, 110, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 32,
+    80, 114, 111, 99, 101, 115, 115, 101, 115, 0, 115, 97, 45, 49, 48, 46,
+    51, 0, 83, 65, 45, 49, 48, 40, 48, 51, 41, 0, 72, 97, 114, 100,
+    119, 97, 114, 101, 32, 73, 110, 116, 101, 103, 114, 105, 116, 121, 32, 86,
+    101, 114, 105, 102, 105, 99, 97, 116, 105, 111, 110, 0, 115, 97, 45, 49,
+    48, 46, 52, 0, 83, 65, 45, 49, 48, 40, 48, 52, 41, 0, 84, 114,
+    117, 115, 116, 101, 100, 32, 71, 101, 110, 101, 114, 97, 116, 105, 111, 110,
+    0, 115, 97, 45, 49, 48, 46, 53, 0, 83, 65, 45, 49, 48, 40, 48,
+    53, 41, 0, 77, 97, 112, 112, 105, 110, 103, 32, 73, 110, 116, 101, 103,
+    114, 105, 116, 121, 32, 102, 111, 114, 32, 86, 101, 114, 115, 105, 111, 110,
+    32, 67, 111, 110, 116, 114, 111, 108, 0, 115, 97, 45, 49, 48, 46, 54,
+    0, 83, 65, 45, 49, 48, 40, 48, 54, 41, 0, 84, 114, 117, 115, 116,
+    101, 100, 32, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 0,
+    115, 97, 45, 49, 48, 46, 55, 0, 83, 65, 45, 49, 48, 40, 48, 55,
+    41, 0, 115, 97, 45, 49, 49, 0, 83, 65, 45, 49, 49, 0, 68, 101,
+    118, 101, 108, 111, 112, 101, 114, 32, 84, 101, 115, 116, 105, 110, 103, 32,
+    97, 110, 100, 32, 69, 118, 97, 108, 117, 97, 116, 105, 111, 110, 0, 115,
+    97, 45, 49, 49, 46, 49, 0, 83, 65, 45, 49, 49, 40, 48, 49, 41,
+    0, 83, 116, 97, 116, 105, 99, 32, 67, 111, 100, 101, 32, 65, 110, 97,
+    108, 121, 115, 105, 115, 0, 115, 97, 45, 49, 49, 46, 50, 0, 83, 65,
+    45, 49, 49, 40, 48, 50, 41, 0, 84, 104, 114, 101, 97, 116, 32, 77,
+    111, 100, 101, 108, 105, 110, 103, 32, 97, 110, 100, 32, 86, 117, 108, 110,
+    101, 114, 97, 98, 105, 108, 105, 116, 121, 32, 65, 110, 97, 108, 121, 115,
+    101, 115, 0, 115, 97, 45, 49, 49, 46, 51, 0, 83, 65, 45, 49, 49,
+    40, 48, 51, 41, 0, 73, 110, 100, 101, 112, 101, 110, 100, 101, 110, 116,
+    32, 86, 101, 114, 105, 102, 105, 99, 97, 116, 105, 111, 110, 32, 111, 102,
+    32, 65, 115, 115, 101, 115, 115, 109, 101, 110, 116, 32, 80, 108, 97, 110,
+    115, 32, 97, 110, 100, 32, 69, 118, 105, 100, 101, 110, 99, 101, 0, 115,
+    97, 45, 49, 49, 46, 52, 0, 83, 65, 45, 49, 49, 40, 48, 52, 41,
+    0, 77, 97, 110, 117, 97, 108, 32, 67, 111, 100, 101, 32, 82, 101, 118,
+    105, 101, 119, 115, 0, 115, 97, 45, 49, 49, 46, 53, 0, 83, 65, 45,
+    49, 49, 40, 48, 53, 41, 0, 115, 97, 45, 49, 49, 46, 54, 0, 83,
+    65, 45, 49, 49, 40, 48, 54, 41, 0, 65, 116, 116, 97, 99, 107, 32,
+    83, 117, 114, 102, 97, 99, 101, 32, 82, 101, 118, 105, 101, 119, 115, 0,
+    115, 97, 45, 49, 49, 46, 55, 0, 83, 65, 45, 49, 49, 40, 48, 55,
+    41, 0, 86, 101, 114, 105, 102, 121, 32, 83, 99, 111, 112, 101, 32, 111,
+    102, 32, 84, 101, 115, 116, 105, 110, 103, 32, 97, 110, 100, 32, 69, 118,
+    97, 108, 117, 97, 116, 105, 111, 110, 0, 115, 97, 45, 49, 49, 46, 56,
+    0, 83, 65, 45, 49, 49, 40, 48, 56, 41, 0, 68, 121, 110, 97, 109,
+    105, 99, 32, 67, 111, 100, 101, 32, 65, 110, 97, 108, 121, 115, 105, 115,
+    0, 115, 97, 45, 49, 49, 46, 57, 0, 83, 65, 45, 49, 49, 40, 48,
+    57, 41, 0, 73, 110, 116, 101, 114, 97, 99, 116, 105, 118, 101, 32, 65,
+    112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 32, 83, 101, 99, 117, 114,
+    105, 116, 121, 32, 84, 101, 115, 116, 105, 110, 103, 0, 115, 97, 45, 49,
+    50, 0, 83, 65, 45, 49, 50, 0, 83, 117, 112, 112, 108, 121, 32, 67,
+    104, 97, 105, 110, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0,
+    115, 97, 45, 49, 50, 46, 49, 0, 83, 65, 45, 49, 50, 40, 48, 49,
+    41, 0, 65, 99, 113, 117, 105, 115, 105, 116, 105, 111, 110, 32, 83, 116,
+    114, 97, 116, 101, 103, 105, 101, 115, 32, 47, 32, 84, 111, 111, 108, 115,
+    32, 47, 32, 77, 101, 116, 104, 111, 100, 115, 0, 115, 97, 45, 49, 50,
+    46, 50, 0, 83, 65, 45, 49, 50, 40, 48, 50, 41, 0, 83, 117, 112,
+    112, 108, 105, 101, 114, 32, 82, 101, 118, 105, 101, 119, 115, 0, 115, 97,
+    45, 49, 50, 46, 51, 0, 83, 65, 45, 49, 50, 40, 48, 51, 41, 0,
+    84, 114, 117, 115, 116, 101, 100, 32, 83, 104, 105, 112, 112, 105, 110, 103,
+    32, 97, 110, 100, 32, 87, 97, 114, 101, 104, 111, 117, 115, 105, 110, 103,
+    0, 115, 97, 45, 49, 50, 46, 52, 0, 83, 65, 45, 49, 50, 40, 48,
+    52, 41, 0, 68, 105, 118, 101, 114, 115, 105, 116, 121, 32, 111, 102, 32,
+    83, 117, 112, 112, 108, 105, 101, 114, 115, 0, 115, 97, 45, 49, 50, 46,
+    53, 0, 83, 65, 45, 49, 50, 40, 48, 53, 41, 0, 76, 105, 109, 105,
+    116, 97, 116, 105, 111, 110, 32, 111, 102, 32, 72, 97, 114, 109, 0, 115,
+    97, 45, 49, 50, 46, 54, 0, 83, 65, 45, 49, 50, 40, 48, 54, 41,
+    0, 77, 105, 110, 105, 109, 105, 122, 105, 110, 103, 32, 80, 114, 111, 99,
+    117, 114, 101, 109, 101, 110, 116, 32, 84, 105, 109, 101, 0, 115, 97, 45,
+    49, 50, 46, 55, 0, 83, 65, 45, 49, 50, 40, 48, 55, 41, 0, 65,
+    115, 115, 101, 115, 115, 109, 101, 110, 116, 115, 32, 80, 114, 105, 111, 114,
+    32, 116, 111, 32, 83, 101, 108, 101, 99, 116, 105, 111, 110, 32, 47, 32,
+    65, 99, 99, 101, 112, 116, 97, 110, 99, 101, 32, 47, 32, 85, 112, 100,
+    97, 116, 101, 0, 115, 97, 45, 49, 50, 46, 56, 0, 83, 65, 45, 49,
+    50, 40, 48, 56, 41, 0, 115, 97, 45, 49, 50, 46, 57, 0, 83, 65,
+    45, 49, 50, 40, 48, 57, 41, 0, 79, 112, 101, 114, 97, 116, 105, 111,
+    110, 115, 32, 83, 101, 99, 117, 114, 105, 116, 121, 0, 115, 97, 45, 49,
+    50, 46, 49, 48, 0, 83, 65, 45, 49, 50, 40, 49, 48, 41, 0, 86,
+    97, 108, 105, 100, 97, 116, 101, 32, 97, 115, 32, 71, 101, 110, 117, 105,
+    110, 101, 32, 97, 110, 100, 32, 78, 111, 116, 32, 65, 108, 116, 101, 114,
+    101, 100, 0, 115, 97, 45, 49, 50, 46, 49, 49, 0, 83, 65, 45, 49,
+    50, 40, 49, 49, 41, 0, 80, 101, 110, 101, 116, 114, 97, 116, 105, 111,
+    110, 32, 84, 101, 115, 116, 105, 110, 103, 32, 47, 32, 65, 110, 97, 108,
+    121, 115, 105, 115, 32, 111, 102, 32, 69, 108, 101, 109, 101, 110, 116, 115,
+    44, 32, 80, 114, 111, 99, 101, 115, 115, 101, 115, 44, 32, 97, 110, 100,
+    32, 65, 99, 116, 111, 114, 115, 0, 115, 97, 45, 49, 50, 46, 49, 50,
+    0, 83, 65, 45, 49, 50, 40, 49, 50, 41, 0, 73, 110, 116, 101, 114,
+    45, 111, 114, 103, 97, 110, 105, 122, 97, 116, 105, 111, 110, 97, 108, 32,
+    65, 103, 114, 101, 101, 109, 101, 110, 116, 115, 0, 115, 97, 45, 49, 50,
+    46, 49, 51, 0, 83, 65, 45, 49, 50, 40, 49, 51, 41, 0, 67, 114,
+    105, 116, 105, 99, 97, 108, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105,
+    111, 110, 32, 83, 121, 115, 116, 101, 109, 32, 67, 111, 109, 112, 111, 110,
+    101, 110, 116, 115, 0, 115, 97, 45, 49, 50, 46, 49, 52, 0, 83, 65,
+    45, 49, 50, 40, 49, 52, 41, 0, 73, 100, 101, 110, 116, 105, 116, 121,
+    32, 97, 110, 100, 32, 84, 114, 97, 99, 101, 97, 98, 105, 108, 105, 116,
+    121, 0, 115, 97, 45, 49, 50, 46, 49, 53, 0, 83, 65, 45, 49, 50,
+    40, 49, 53, 41, 0, 80, 114, 111, 99, 101, 115, 115, 101, 115, 32, 116,
+    111, 32, 65, 100, 100, 114, 101, 115, 115, 32, 87, 101, 97, 107, 110, 101,
+    115, 115, 101, 115, 32, 111, 114, 32, 68, 101, 102, 105, 99, 105, 101, 110,
+    99, 105, 101, 115, 0, 115, 97, 45, 49, 51, 0, 83, 65, 45, 49, 51,
+    0, 84, 114, 117, 115, 116, 119, 111, 114, 116, 104, 105, 110, 101, 115, 115,
+    0, 115, 97, 45, 49, 52, 0, 83, 65, 45, 49, 52, 0, 115, 97, 45,
+    49, 52, 46, 49, 0, 83, 65, 45, 49, 52, 40, 48, 49, 41, 0, 67,
+    114, 105, 116, 105, 99, 97, 108, 32, 67, 111, 109, 112, 111, 110, 101, 110,
+    116, 115, 32, 119, 105, 116, 104, 32, 78, 111, 32, 86, 105, 97, 98, 108,
+    101, 32, 65, 108, 116, 101, 114, 110, 97, 116, 105, 118, 101, 32, 83, 111,
+    117, 114, 99, 105, 110, 103, 0, 115, 97, 45, 49, 53, 0, 83, 65, 45,
+    49, 53, 0, 68, 101, 118, 101, 108, 111, 112, 109, 101, 110, 116, 32, 80,
+    114, 111, 99, 101, 115, 115, 44, 32, 83, 116, 97, 110, 100, 97, 114, 100,
+    115, 44, 32, 97, 110, 100, 32, 84, 111, 111, 108, 115, 0, 115, 97, 45,
+    49, 53, 46, 49, 0, 83, 65, 45, 49, 53, 40, 48, 49, 41, 0, 81,
+    117, 97, 108, 105, 116, 121, 32, 77, 101, 116, 114, 105, 99, 115, 0, 115,
+    97, 45, 49, 53, 46, 50, 0, 83, 65, 45, 49, 53, 40, 48, 50, 41,
+    0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 97, 110, 100, 32, 80, 114,
+    105, 118, 97, 99, 121, 32, 84, 114, 97, 99, 107, 105, 110, 103, 32, 84,
+    111, 111, 108, 115, 0, 115, 97, 45, 49, 53, 46, 51, 0, 83, 65, 45,
+    49, 53, 40, 48, 51, 41, 0, 115, 97, 45, 49, 53, 46, 52, 0, 83,
+    65, 45, 49, 53, 40, 48, 52, 41, 0, 84, 104, 114, 101, 97, 116, 32,
+    77, 111, 100, 101, 108, 105, 110, 103, 32, 97, 110, 100, 32, 86, 117, 108,
+    110, 101, 114, 97, 98, 105, 108, 105, 116, 121, 32, 65, 110, 97, 108, 121,
+    115, 105, 115, 0, 115, 97, 45, 49, 53, 46, 53, 0, 83, 65, 45, 49,
+    53, 40, 48, 53, 41, 0, 65, 116, 116, 97, 99, 107, 32, 83, 117, 114,
+    102, 97, 99, 101, 32, 82, 101, 100, 117, 99, 116, 105, 111, 110, 0, 115,
+    97, 45, 49, 53, 46, 54, 0, 83, 65, 45, 49, 53, 40, 48, 54, 41,
+    0, 115, 97, 45, 49, 53, 46, 55, 0, 83, 65, 45, 49, 53, 40, 48,
+    55, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 86, 117, 108,
+    110, 101, 114, 97, 98, 105, 108, 105, 116, 121, 32, 65, 110, 97, 108, 121,
+    115, 105, 115, 0, 115, 97, 45, 49, 53, 46, 56, 0, 83, 65, 45, 49,
+    53, 40, 48, 56, 41, 0, 82, 101, 117, 115, 101, 32, 111, 102, 32, 84,
+    104, 114, 101, 97, 116, 32, 97, 110, 100, 32, 86, 117, 108, 110, 101, 114,
+    97, 98, 105, 108, 105, 116, 121, 32, 73, 110, 102, 111, 114, 109, 97, 116,
+    105, 111, 110, 0, 115, 97, 45, 49, 53, 46, 57, 0, 83, 65, 45, 49,
+    53, 40, 48, 57, 41, 0, 85, 115, 101, 32, 111, 102, 32, 76, 105, 118,
+    101, 32, 68, 97, 116, 97, 0, 115, 97, 45, 49, 53, 46, 49, 48, 0,
+    83, 65, 45, 49, 53, 40, 49, 48, 41, 0, 115, 97, 45, 49, 53, 46,
+    49, 49, 0, 83, 65, 45, 49, 53, 40, 49, 49, 41, 0, 65, 114, 99,
+    104, 105, 118, 101, 32, 83, 121, 115, 116, 101, 109, 32, 111, 114, 32, 67,
+    111, 109, 112, 111, 110, 101, 110, 116, 0, 115, 97, 45, 49, 53, 46, 49,
+    50, 0, 83, 65, 45, 49, 53, 40, 49, 50, 41, 0, 77, 105, 110, 105,
+    109, 105, 122, 101, 32, 80, 101, 114, 115, 111, 110, 97, 108, 108, 121, 32,
+    73, 100, 101, 110, 116, 105, 102, 105, 97, 98, 108, 101, 32, 73, 110, 102,
+    111, 114, 109, 97, 116, 105, 111, 110, 0, 115, 97, 45, 49, 54, 0, 83,
+    65, 45, 49, 54, 0, 68, 101, 118, 101, 108, 111, 112, 101, 114, 45, 112,
+    114, 111, 118, 105, 100, 101, 100, 32, 84, 114, 97, 105, 110, 105, 110, 103,
+    0, 115, 97, 45, 49, 55, 0, 83, 65, 45, 49, 55, 0, 68, 101, 118,
+    101, 108, 111, 112, 101, 114, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32,
+    97, 110, 100, 32, 80, 114, 105, 118, 97, 99, 121, 32, 65, 114, 99, 104,
+    105, 116, 101, 99, 116, 117, 114, 101, 32, 97, 110, 100, 32, 68, 101, 115,
+    105, 103, 110, 0, 115, 97, 45, 49, 55, 46, 49, 0, 83, 65, 45, 49,
+    55, 40, 48, 49, 41, 0, 70, 111, 114, 109, 97, 108, 32, 80, 111, 108,
+    105, 99, 121, 32, 77, 111, 100, 101, 108, 0, 115, 97, 45, 49, 55, 46,
+    50, 0, 83, 65, 45, 49, 55, 40, 48, 50, 41, 0, 83, 101, 99, 117,
+    114, 105, 116, 121, 45, 114, 101, 108, 101, 118, 97, 110, 116, 32, 67, 111,
+    109, 112, 111, 110, 101, 110, 116, 115, 0, 115, 97, 45, 49, 55, 46, 51,
+    0, 83, 65, 45, 49, 55, 40, 48, 51, 41, 0, 70, 111, 114, 109, 97,
+    108, 32, 67, 111, 114, 114, 101, 115, 112, 111, 110, 100, 101, 110, 99, 101,
+    0, 115, 97, 45, 49, 55, 46, 52, 0, 83, 65, 45, 49, 55, 40, 48,
+    52, 41, 0, 73, 110, 102, 111, 114, 109, 97, 108, 32, 67, 111, 114, 114,
+    101, 115, 112, 111, 110, 100, 101, 110, 99, 101, 0, 115, 97, 45, 49, 55,
+    46, 53, 0, 83, 65, 45, 49, 55, 40, 48, 53, 41, 0, 67, 111, 110,
+    99, 101, 112, 116, 117, 97, 108, 108, 121, 32, 83, 105, 109, 112, 108, 101,
+    32, 68, 101, 115, 105, 103, 110, 0, 115, 97, 45, 49, 55, 46, 54, 0,
+    83, 65, 45, 49, 55, 40, 48, 54, 41, 0, 83, 116, 114, 117, 99, 116,
+    117, 114, 101, 32, 102, 111, 114, 32, 84, 101, 115, 116, 105, 110, 103, 0,
+    115, 97, 45, 49, 55, 46, 55, 0, 83, 65, 45, 49, 55, 40, 48, 55,
+    41, 0, 83, 116, 114, 117, 99, 116, 117, 114, 101, 32, 102, 111, 114, 32,
+    76, 101, 97, 115, 116, 32, 80, 114, 105, 118, 105, 108, 101, 103, 101, 0,
+    115, 97, 45, 49, 55, 46, 56, 0, 83, 65, 45, 49, 55, 40, 48, 56,
+    41, 0, 79, 114, 99, 104, 101, 115, 116, 114, 97, 116, 105, 111, 110, 0,
+    115, 97, 45, 49, 55, 46, 57, 0, 83, 65, 45, 49, 55, 40, 48, 57,
+    41, 0, 68, 101, 115, 105, 103, 110, 32, 68, 105, 118, 101, 114, 115, 105,
+    116, 121, 0, 115, 97, 45, 49, 56, 0, 83, 65, 45, 49, 56, 0, 84,
+    97, 109, 112, 101, 114, 32, 82, 101, 115, 105, 115, 116, 97, 110, 99, 101,
+    32, 97, 110, 100, 32, 68, 101, 116, 101, 99, 116, 105, 111, 110, 0, 115,
+    97, 45, 49, 56, 46, 49, 0, 83, 65, 45, 49, 56, 40, 48, 49, 41,
+    0, 77, 117, 108, 116, 105, 112, 108, 101, 32, 80, 104, 97, 115, 101, 115,
+    32, 111, 102, 32, 83, 121, 115, 116, 101, 109, 32, 68, 101, 118, 101, 108,
+    111, 112, 109, 101, 110, 116, 32, 76, 105, 102, 101, 32, 67, 121, 99, 108,
+    101, 0, 115, 97, 45, 49, 56, 46, 50, 0, 83, 65, 45, 49, 56, 40,
+    48, 50, 41, 0, 73, 110, 115, 112, 101, 99, 116, 105, 111, 110, 32, 111,
+    102, 32, 83, 121, 115, 116, 101, 109, 115, 32, 111, 114, 32, 67, 111, 109,
+    112, 111, 110, 101, 110, 116, 115, 0, 115, 97, 45, 49, 57, 0, 83, 65,
+    45, 49, 57, 0, 67, 111, 109, 112, 111, 110, 101, 110, 116, 32, 65, 117,
+    116, 104, 101, 110, 116, 105, 99, 105, 116, 121, 0, 115, 97, 45, 49, 57,
+    46, 49, 0, 83, 65, 45, 49, 57, 40, 48, 49, 41, 0, 65, 110, 116,
+    105, 45, 99, 111, 117, 110, 116, 101, 114, 102, 101, 105, 116, 32, 84, 114,
+    97, 105, 110, 105, 110, 103, 0, 115, 97, 45, 49, 57, 46, 50, 0, 83,
+    65, 45, 49, 57, 40, 48, 50, 41, 0, 67, 111, 110, 102, 105, 103, 117,
+    114, 97, 116, 105, 111, 110, 32, 67, 111, 110, 116, 114, 111, 108, 32, 102,
+    111, 114, 32, 67, 111, 109, 112, 111, 110, 101, 110, 116, 32, 83, 101, 114,
+    118, 105, 99, 101, 32, 97, 110, 100, 32, 82, 101, 112, 97, 105, 114, 0,
+    115, 97, 45, 49, 57, 46, 51, 0, 83, 65, 45, 49, 57, 40, 48, 51,
+    41, 0, 67, 111, 109, 112, 111, 110, 101, 110, 116, 32, 68, 105, 115, 112,
+    111, 115, 97, 108, 0, 115, 97, 45, 49, 57, 46, 52, 0, 83, 65, 45,
+    49, 57, 40, 48, 52, 41, 0, 65, 110, 116, 105, 45, 99, 111, 117, 110,
+    116, 101, 114, 102, 101, 105, 116, 32, 83, 99, 97, 110, 110, 105, 110, 103,
+    0, 115, 97, 45, 50, 48, 0, 83, 65, 45, 50, 48, 0, 67, 117, 115,
+    116, 111, 109, 105, 122, 101, 100, 32, 68, 101, 118, 101, 108, 111, 112, 109,
+    101, 110, 116, 32, 111, 102, 32, 67, 114, 105, 116, 105, 99, 97, 108, 32,
+    67, 111, 109, 112, 111, 110, 101, 110, 116, 115, 0, 115, 97, 45, 50, 49,
+    0, 83, 65, 45, 50, 49, 0, 68, 101, 118, 101, 108, 111, 112, 101, 114,
+    32, 83, 99, 114, 101, 101, 110, 105, 110, 103, 0, 115, 97, 45, 50, 49,
+    46, 49, 0, 83, 65, 45, 50, 49, 40, 48, 49, 41, 0, 86, 97, 108,
+    105, 100, 97, 116, 105, 111, 110, 32, 111, 102, 32, 83, 99, 114, 101, 101,
+    110, 105, 110, 103, 0, 115, 97, 45, 50, 50, 0, 83, 65, 45, 50, 50,
+    0, 85, 110, 115, 117, 112, 112, 111, 114, 116, 101, 100, 32, 83, 121, 115,
+    116, 101, 109, 32, 67, 111, 109, 112, 111, 110, 101, 110, 116, 115, 0, 115,
+    97, 45, 50, 50, 46, 49, 0, 83, 65, 45, 50, 50, 40, 48, 49, 41,
+    0, 65, 108, 116, 101, 114, 110, 97, 116, 105, 118, 101, 32, 83, 111, 117,
+    114, 99, 101, 115, 32, 102, 111, 114, 32, 67, 111, 110, 116, 105, 110, 117,
+    101, 100, 32, 83, 117, 112, 112, 111, 114, 116, 0, 115, 97, 45, 50, 51,
+    0, 83, 65, 45, 50, 51, 0, 83, 112, 101, 99, 105, 97, 108, 105, 122,
+    97, 116, 105, 111, 110, 0, 115, 99, 45, 49, 0, 83, 67, 45, 48, 49,
+    0, 83, 121, 115, 116, 101, 109, 32, 97, 110, 100, 32, 67, 111, 109, 109,
+    117, 110, 105, 99, 97, 116, 105, 111, 110, 115, 32, 80, 114, 111, 116, 101,
+    99, 116, 105, 111, 110, 0, 115, 99, 45, 50, 0, 83, 67, 45, 48, 50,
+    0, 83, 101, 112, 97, 114, 97, 116, 105, 111, 110, 32, 111, 102, 32, 83,
+    121, 115, 116, 101, 109, 32, 97, 110, 100, 32, 85, 115, 101, 114, 32, 70,
+    117, 110, 99, 116, 105, 111, 110, 97, 108, 105, 116, 121, 0, 115, 99, 45,
+    50, 46, 49, 0, 83, 67, 45, 48, 50, 40, 48, 49, 41, 0, 73, 110,
+    116, 101, 114, 102, 97, 99, 101, 115, 32, 102, 111, 114, 32, 78, 111, 110,
+    45, 112, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 85, 115, 101, 114,
+    115, 0, 115, 99, 45, 50, 46, 50, 0, 83, 67, 45, 48, 50, 40, 48,
+    50, 41, 0, 115, 99, 45, 51, 0, 83, 67, 45, 48, 51, 0, 83, 101,
+    99, 117, 114, 105, 116, 121, 32, 70, 117, 110, 99, 116, 105, 111, 110, 32,
+    73, 115, 111, 108, 97, 116, 105, 111, 110, 0, 115, 99, 45, 51, 46, 49,
+    0, 83, 67, 45, 48, 51, 40, 48, 49, 41, 0, 72, 97, 114, 100, 119,
+    97, 114, 101, 32, 83, 101, 112, 97, 114, 97, 116, 105, 111, 110, 0, 115,
+    99, 45, 51, 46, 50, 0, 83, 67, 45, 48, 51, 40, 48, 50, 41, 0,
+    65, 99, 99, 101, 115, 115, 32, 97, 110, 100, 32, 70, 108, 111, 119, 32,
+    67, 111, 110, 116, 114, 111, 108, 32, 70, 117, 110, 99, 116, 105, 111, 110,
+    115, 0, 115, 99, 45, 51, 46, 51, 0, 83, 67, 45, 48, 51, 40, 48,
+    51, 41, 0, 77, 105, 110, 105, 109, 105, 122, 101, 32, 78, 111, 110, 115,
+    101, 99, 117, 114, 105, 116, 121, 32, 70, 117, 110, 99, 116, 105, 111, 110,
+    97, 108, 105, 116, 121, 0, 115, 99, 45, 51, 46, 52, 0, 83, 67, 45,
+    48, 51, 40, 48, 52, 41, 0, 77, 111, 100, 117, 108, 101, 32, 67, 111,
+    117, 112, 108, 105, 110, 103, 32, 97, 110, 100, 32, 67, 111, 104, 101, 115,
+    105, 118, 101, 110, 101, 115, 115, 0, 115, 99, 45, 51, 46, 53, 0, 83,
+    67, 45, 48, 51, 40, 48, 53, 41, 0, 76, 97, 121, 101, 114, 101, 100,
+    32, 83, 116, 114, 117, 99, 116, 117, 114, 101, 115, 0, 115, 99, 45, 52,
+    0, 83, 67, 45, 48, 52, 0, 73, 110, 102, 111, 114, 109, 97, 116, 105,
+    111, 110, 32, 105, 110, 32, 83, 104, 97, 114, 101, 100, 32, 83, 121, 115,
+    116, 101, 109, 32, 82, 101, 115, 111, 117, 114, 99, 101, 115, 0, 115, 99,
+    45, 52, 46, 49, 0, 83, 67, 45, 48, 52, 40, 48, 49, 41, 0, 83,
+    101, 99, 117, 114, 105, 116, 121, 32, 76, 101, 118, 101, 108, 115, 0, 115,
+    99, 45, 52, 46, 50, 0, 83, 67, 45, 48, 52, 40, 48, 50, 41, 0,
+    77, 117, 108, 116, 105, 108, 101, 118, 101, 108, 32, 111, 114, 32, 80, 101,
+    114, 105, 111, 100, 115, 32, 80, 114, 111, 99, 101, 115, 115, 105, 110, 103,
+    0, 115, 99, 45, 53, 0, 83, 67, 45, 48, 53, 0, 68, 101, 110, 105,
+    97, 108, 45, 111, 102, 45, 115, 101, 114, 118, 105, 99, 101, 32, 80, 114,
+    111, 116, 101, 99, 116, 105, 111, 110, 0, 115, 99, 45, 53, 46, 49, 0,
+    83, 67, 45, 48, 53, 40, 48, 49, 41, 0, 82, 101, 115, 116, 114, 105,
+    99, 116, 32, 65, 98, 105, 108, 105, 116, 121, 32, 116, 111, 32, 65, 116,
+    116, 97, 99, 107, 32, 79, 116, 104, 101, 114, 32, 83, 121, 115, 116, 101,
+    109, 115, 0, 115, 99, 45, 53, 46, 50, 0, 83, 67, 45, 48, 53, 40,
+    48, 50, 41, 0, 67, 97, 112, 97, 99, 105, 116, 121, 44, 32, 66, 97,
+    110, 100, 119, 105, 100, 116, 104, 44, 32, 97, 110, 100, 32, 82, 101, 100,
+    117, 110, 100, 97, 110, 99, 121, 0, 115, 99, 45, 53, 46, 51, 0, 83,
+    67, 45, 48, 53, 40, 48, 51, 41, 0, 68, 101, 116, 101, 99, 116, 105,
+    111, 110, 32, 97, 110, 100, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110,
+    103, 0, 115, 99, 45, 54, 0, 83, 67, 45, 48, 54, 0, 82, 101, 115,
+    111, 117, 114, 99, 101, 32, 65, 118, 97, 105, 108, 97, 98, 105, 108, 105,
+    116, 121, 0, 115, 99, 45, 55, 0, 83, 67, 45, 48, 55, 0, 66, 111,
+    117, 110, 100, 97, 114, 121, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111,
+    110, 0, 115, 99, 45, 55, 46, 49, 0, 83, 67, 45, 48, 55, 40, 48,
+    49, 41, 0, 80, 104, 121, 115, 105, 99, 97, 108, 108, 121, 32, 83, 101,
+    112, 97, 114, 97, 116, 101, 100, 32, 83, 117, 98, 110, 101, 116, 119, 111,
+    114, 107, 115, 0, 115, 99, 45, 55, 46, 50, 0, 83, 67, 45, 48, 55,
+    40, 48, 50, 41, 0, 80, 117, 98, 108, 105, 99, 32, 65, 99, 99, 101,
+    115, 115, 0, 115, 99, 45, 55, 46, 51, 0, 83, 67, 45, 48, 55, 40,
+    48, 51, 41, 0, 65, 99, 99, 101, 115, 115, 32, 80, 111, 105, 110, 116,
+    115, 0, 115, 99, 45, 55, 46, 52, 0, 83, 67, 45, 48, 55, 40, 48,
+    52, 41, 0, 69, 120, 116, 101, 114, 110, 97, 108, 32, 84, 101, 108, 101,
+    99, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110, 115, 32, 83,
+    101, 114, 118, 105, 99, 101, 115, 0, 115, 99, 45, 55, 46, 53, 0, 83,
+    67, 45, 48, 55, 40, 48, 53, 41, 0, 68, 101, 110, 121, 32, 98, 121,
+    32, 68, 101, 102, 97, 117, 108, 116, 32, -30, -128, -108, 32, 65, 108, 108,
+    111, 119, 32, 98, 121, 32, 69, 120, 99, 101, 112, 116, 105, 111, 110, 0,
+    115, 99, 45, 55, 46, 54, 0, 83, 67, 45, 48, 55, 40, 48, 54, 41,
+    0, 82, 101, 115, 112, 111, 110, 115, 101, 32, 116, 111, 32, 82, 101, 99,
+    111, 103, 110, 105, 122, 101, 100, 32, 70, 97, 105, 108, 117, 114, 101, 115,
+    0, 115, 99, 45, 55, 46, 55, 0, 83, 67, 45, 48, 55, 40, 48, 55,
+    41, 0, 83, 112, 108, 105, 116, 32, 84, 117, 110, 110, 101, 108, 105, 110,
+    103, 32, 102, 111, 114, 32, 82, 101, 109, 111, 116, 101, 32, 68, 101, 118,
+    105, 99, 101, 115, 0, 115, 99, 45, 55, 46, 56, 0, 83, 67, 45, 48,
+    55, 40, 48, 56, 41, 0, 82, 111, 117, 116, 101, 32, 84, 114, 97, 102,
+    102, 105, 99, 32, 116, 111, 32, 65, 117, 116, 104, 101, 110, 116, 105, 99,
+    97, 116, 101, 100, 32, 80, 114, 111, 120, 121, 32, 83, 101, 114, 118, 101,
+    114, 115, 0, 115, 99, 45, 55, 46, 57, 0, 83, 67, 45, 48, 55, 40,
+    48, 57, 41, 0, 82, 101, 115, 116, 114, 105, 99, 116, 32, 84, 104, 114,
+    101, 97, 116, 101, 110, 105, 110, 103, 32, 79, 117, 116, 103, 111, 105, 110,
+    103, 32, 67, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110, 115,
+    32, 84, 114, 97, 102, 102, 105, 99, 0, 115, 99, 45, 55, 46, 49, 48,
+    0, 83, 67, 45, 48, 55, 40, 49, 48, 41, 0, 80, 114, 101, 118, 101,
+    110, 116, 32, 69, 120, 102, 105, 108, 116, 114, 97, 116, 105, 111, 110, 0,
+    115, 99, 45, 55, 46, 49, 49, 0, 83, 67, 45, 48, 55, 40, 49, 49,
+    41, 0, 82, 101, 115, 116, 114, 105, 99, 116, 32, 73, 110, 99, 111, 109,
+    105, 110, 103, 32, 67, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111,
+    110, 115, 32, 84, 114, 97, 102, 102, 105, 99, 0, 115, 99, 45, 55, 46,
+    49, 50, 0, 83, 67, 45, 48, 55, 40, 49, 50, 41, 0, 72, 111, 115,
+    116, 45, 98, 97, 115, 101, 100, 32, 80, 114, 111, 116, 101, 99, 116, 105,
+    111, 110, 0, 115, 99, 45, 55, 46, 49, 51, 0, 83, 67, 45, 48, 55,
+    40, 49, 51, 41, 0, 73, 115, 111, 108, 97, 116, 105, 111, 110, 32, 111,
+    102, 32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 84, 111, 111, 108, 115,
+    44, 32, 77, 101, 99, 104, 97, 110, 105, 115, 109, 115, 44, 32, 97, 110,
+    100, 32, 83, 117, 112, 112, 111, 114, 116, 32, 67, 111, 109, 112, 111, 110,
+    101, 110, 116, 115, 0, 115, 99, 45, 55, 46, 49, 52, 0, 83, 67, 45,
+    48, 55, 40, 49, 52, 41, 0, 80, 114, 111, 116, 101, 99, 116, 32, 65,
+    103, 97, 105, 110, 115, 116, 32, 85, 110, 97, 117, 116, 104, 111, 114, 105,
+    122, 101, 100, 32, 80, 104, 121, 115, 105, 99, 97, 108, 32, 67, 111, 110,
+    110, 101, 99, 116, 105, 111, 110, 115, 0, 115, 99, 45, 55, 46, 49, 53,
+    0, 83, 67, 45, 48, 55, 40, 49, 53, 41, 0, 78, 101, 116, 119, 111,
+    114, 107, 101, 100, 32, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32,
+    65, 99, 99, 101, 115, 115, 101, 115, 0, 115, 99, 45, 55, 46, 49, 54,
+    0, 83, 67, 45, 48, 55, 40, 49, 54, 41, 0, 80, 114, 101, 118, 101,
+    110, 116, 32, 68, 105, 115, 99, 111, 118, 101, 114, 121, 32, 111, 102, 32,
+    83, 121, 115, 116, 101, 109, 32, 67, 111, 109, 112, 111, 110, 101, 110, 116,
+    115, 0, 115, 99, 45, 55, 46, 49, 55, 0, 83, 67, 45, 48, 55, 40,
+    49, 55, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 69, 110,
+    102, 111, 114, 99, 101, 109, 101, 110, 116, 32, 111, 102, 32, 80, 114, 111,
+    116, 111, 99, 111, 108, 32, 70, 111, 114, 109, 97, 116, 115, 0, 115, 99,
+    45, 55, 46, 49, 56, 0, 83, 67, 45, 48, 55, 40, 49, 56, 41, 0,
+    70, 97, 105, 108, 32, 83, 101, 99, 117, 114, 101, 0, 115, 99, 45, 55,
+    46, 49, 57, 0, 83, 67, 45, 48, 55, 40, 49, 57, 41, 0, 66, 108,
+    111, 99, 107, 32, 67, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111,
+    110, 32, 102, 114, 111, 109, 32, 78, 111, 110, 45, 111, 114, 103, 97, 110,
+    105, 122, 97, 116, 105, 111, 110, 97, 108, 108, 121, 32, 67, 111, 110, 102,
+    105, 103, 117, 114, 101, 100, 32, 72, 111, 115, 116, 115, 0, 115, 99, 45,
+    55, 46, 50, 48, 0, 83, 67, 45, 48, 55, 40, 50, 48, 41, 0, 68,
+    121, 110, 97, 109, 105, 99, 32, 73, 115, 111, 108, 97, 116, 105, 111, 110,
+    32, 97, 110, 100, 32, 83, 101, 103, 114, 101, 103, 97, 116, 105, 111, 110,
+    0, 115, 99, 45, 55, 46, 50, 49, 0, 83, 67, 45, 48, 55, 40, 50,
+    49, 41, 0, 73, 115, 111, 108, 97, 116, 105, 111, 110, 32, 111, 102, 32,
+    83, 121, 115, 116, 101, 109, 32, 67, 111, 109, 112, 111, 110, 101, 110, 116,
+    115, 0, 115, 99, 45, 55, 46, 50, 50, 0, 83, 67, 45, 48, 55, 40,
+    50, 50, 41, 0, 83, 101, 112, 97, 114, 97, 116, 101, 32, 83, 117, 98,
+    110, 101, 116, 115, 32, 102, 111, 114, 32, 67, 111, 110, 110, 101, 99, 116,
+    105, 110, 103, 32, 116, 111, 32, 68, 105, 102, 102, 101, 114, 101, 110, 116,
+    32, 83, 101, 99, 117, 114, 105, 116, 121, 32, 68, 111, 109, 97, 105, 110,
+    115, 0, 115, 99, 45, 55, 46, 50, 51, 0, 83, 67, 45, 48, 55, 40,
+    50, 51, 41, 0, 68, 105, 115, 97, 98, 108, 101, 32, 83, 101, 110, 100,
+    101, 114, 32, 70, 101, 101, 100, 98, 97, 99, 107, 32, 111, 110, 32, 80,
+    114, 111, 116, 111, 99, 111, 108, 32, 86, 97, 108, 105, 100, 97, 116, 105,
+    111, 110, 32, 70, 97, 105, 108, 117, 114, 101, 0, 115, 99, 45, 55, 46,
+    50, 52, 0, 83, 67, 45, 48, 55, 40, 50, 52, 41, 0, 80, 101, 114,
+    115, 111, 110, 97, 108, 108, 121, 32, 73, 100, 101, 110, 116, 105, 102, 105,
+    97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110,
+    0, 115, 99, 45, 55, 46, 50, 53, 0, 83, 67, 45, 48, 55, 40, 50,
+    53, 41, 0, 115, 99, 45, 55, 46, 50, 54, 0, 83, 67, 45, 48, 55,
+    40, 50, 54, 41, 0, 115, 99, 45, 55, 46, 50, 55, 0, 83, 67, 45,
+    48, 55, 40, 50, 55, 41, 0, 115, 99, 45, 55, 46, 50, 56, 0, 83,
+    67, 45, 48, 55, 40, 50, 56, 41, 0, 115, 99, 45, 55, 46, 50, 57,
+    0, 83, 67, 45, 48, 55, 40, 50, 57, 41, 0, 83, 101, 112, 97, 114,
+    97, 116, 101, 32, 83, 117, 98, 110, 101, 116, 115, 32, 116, 111, 32, 73,
+    115, 111, 108, 97, 116, 101, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115,
+    0, 115, 99, 45, 56, 0, 83, 67, 45, 48, 56, 0, 84, 114, 97, 110,
+    115, 109, 105, 115, 115, 105, 111, 110, 32, 67, 111, 110, 102, 105, 100, 101,
+    110, 116, 105, 97, 108, 105, 116, 121, 32, 97, 110, 100, 32, 73, 110, 116,
+    101, 103, 114, 105, 116, 121, 0, 115, 99, 45, 56, 46, 49, 0, 83, 67,
+    45, 48, 56, 40, 48, 49, 41, 0, 115, 99, 45, 56, 46, 50, 0, 83,
+    67, 45, 48, 56, 40, 48, 50, 41, 0, 80, 114, 101, 45, 32, 97, 110,
+    100, 32, 80, 111, 115, 116, 45, 116, 114, 97, 110, 115, 109, 105, 115, 115,
+    105, 111, 110, 32, 72, 97, 110, 100, 108, 105, 110, 103, 0, 115, 99, 45,
+    56, 46, 51, 0, 83, 67, 45, 48, 56, 40, 48, 51, 41, 0, 67, 114,
+    121, 112, 116, 111, 103, 114, 97, 112, 104, 105, 99, 32, 80, 114, 111, 116,
+    101, 99, 116, 105, 111, 110, 32, 102, 111, 114, 32, 77, 101, 115, 115, 97,
+    103, 101, 32, 69, 120, 116, 101, 114, 110, 97, 108, 115, 0, 115, 99, 45,
+    56, 46, 52, 0, 83, 67, 45, 48, 56, 40, 48, 52, 41, 0, 67, 111,
+    110, 99, 101, 97, 108, 32, 111, 114, 32, 82, 97, 110, 100, 111, 109, 105,
+    122, 101, 32, 67, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110,
+    115, 0, 115, 99, 45, 56, 46, 53, 0, 83, 67, 45, 48, 56, 40, 48,
+    53, 41, 0, 80, 114, 111, 116, 101, 99, 116, 101, 100, 32, 68, 105, 115,
+    116, 114, 105, 98, 117, 116, 105, 111, 110, 32, 83, 121, 115, 116, 101, 109,
+    0, 115, 99, 45, 57, 0, 83, 67, 45, 48, 57, 0, 84, 114, 97, 110,
+    115, 109, 105, 115, 115, 105, 111, 110, 32, 67, 111, 110, 102, 105, 100, 101,
+    110, 116, 105, 97, 108, 105, 116, 121, 0, 115, 99, 45, 49, 48, 0, 83,
+    67, 45, 49, 48, 0, 78, 101, 116, 119, 111, 114, 107, 32, 68, 105, 115,
+    99, 111, 110, 110, 101, 99, 116, 0, 115, 99, 45, 49, 49, 0, 83, 67,
+    45, 49, 49, 0, 84, 114, 117, 115, 116, 101, 100, 32, 80, 97, 116, 104,
+    0, 115, 99, 45, 49, 49, 46, 49, 0, 83, 67, 45, 49, 49, 40, 48,
+    49, 41, 0, 73, 114, 114, 101, 102, 117, 116, 97, 98, 108, 101, 32, 67,
+    111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110, 115, 32, 80, 97,
+    116, 104, 0, 115, 99, 45, 49, 50, 0, 83, 67, 45, 49, 50, 0, 67,
+    114, 121, 112, 116, 111, 103, 114, 97, 112, 104, 105, 99, 32, 75, 101, 121,
+    32, 69, 115, 116, 97, 98, 108, 105, 115, 104, 109, 101, 110, 116, 32, 97,
+    110, 100, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 115, 99,
+    45, 49, 50, 46, 49, 0, 83, 67, 45, 49, 50, 40, 48, 49, 41, 0,
+    65, 118, 97, 105, 108, 97, 98, 105, 108, 105, 116, 121, 0, 115, 99, 45,
+    49, 50, 46, 50, 0, 83, 67, 45, 49, 50, 40, 48, 50, 41, 0, 83,
+    121, 109, 109, 101, 116, 114, 105, 99, 32, 75, 101, 121, 115, 0, 115, 99,
+    45, 49, 50, 46, 51, 0, 83, 67, 45, 49, 50, 40, 48, 51, 41, 0,
+    65, 115, 121, 109, 109, 101, 116, 114, 105, 99, 32, 75, 101, 121, 115, 0,
+    115, 99, 45, 49, 50, 46, 52, 0, 83, 67, 45, 49, 50, 40, 48, 52,
+    41, 0, 80, 75, 73, 32, 67, 101, 114, 116, 105, 102, 105, 99, 97, 116,
+    101, 115, 0, 115, 99, 45, 49, 50, 46, 53, 0, 83, 67, 45, 49, 50,
+    40, 48, 53, 41, 0, 80, 75, 73, 32, 67, 101, 114, 116, 105, 102, 105,
+    99, 97, 116, 101, 115, 32, 47, 32, 72, 97, 114, 100, 119, 97, 114, 101,
+    32, 84, 111, 107, 101, 110, 115, 0, 115, 99, 45, 49, 50, 46, 54, 0,
+    83, 67, 45, 49, 50, 40, 48, 54, 41, 0, 80, 104, 121, 115, 105, 99,
+    97, 108, 32, 67, 111, 110, 116, 114, 111, 108, 32, 111, 102, 32, 75, 101,
+    121, 115, 0, 115, 99, 45, 49, 51, 0, 83, 67, 45, 49, 51, 0, 115,
+    99, 45, 49, 51, 46, 49, 0, 83, 67, 45, 49, 51, 40, 48, 49, 41,
+    0, 70, 73, 80, 83, 45, 118, 97, 108, 105, 100, 97, 116, 101, 100, 32,
+    67, 114, 121, 112, 116, 111, 103, 114, 97, 112, 104, 121, 0, 115, 99, 45,
+    49, 51, 46, 50, 0, 83, 67, 45, 49, 51, 40, 48, 50, 41, 0, 78,
+    83, 65, 45, 97, 112, 112, 114, 111, 118, 101, 100, 32, 67, 114, 121, 112,
+    116, 111, 103, 114, 97, 112, 104, 121, 0, 115, 99, 45, 49, 51, 46, 51,
+    0, 83, 67, 45, 49, 51, 40, 48, 51, 41, 0, 73, 110, 100, 105, 118,
+    105, 100, 117, 97, 108, 115, 32, 87, 105, 116, 104, 111, 117, 116, 32, 70,
+    111, 114, 109, 97, 108, 32, 65, 99, 99, 101, 115, 115, 32, 65, 112, 112,
+    114, 111, 118, 97, 108, 115, 0, 115, 99, 45, 49, 51, 46, 52, 0, 83,
+    67, 45, 49, 51, 40, 48, 52, 41, 0, 115, 99, 45, 49, 52, 0, 83,
+    67, 45, 49, 52, 0, 80, 117, 98, 108, 105, 99, 32, 65, 99, 99, 101,
+    115, 115, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 115, 0, 115,
+    99, 45, 49, 53, 0, 83, 67, 45, 49, 53, 0, 67, 111, 108, 108, 97,
+    98, 111, 114, 97, 116, 105, 118, 101, 32, 67, 111, 109, 112, 117, 116, 105,
+    110, 103, 32, 68, 101, 118, 105, 99, 101, 115, 32, 97, 110, 100, 32, 65,
+    112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 115, 0, 115, 99, 45, 49,
+    53, 46, 49, 0, 83, 67, 45, 49, 53, 40, 48, 49, 41, 0, 80, 104,
+    121, 115, 105, 99, 97, 108, 32, 111, 114, 32, 76, 111, 103, 105, 99, 97,
+    108, 32, 68, 105, 115, 99, 111, 110, 110, 101, 99, 116, 0, 115, 99, 45,
+    49, 53, 46, 50, 0, 83, 67, 45, 49, 53, 40, 48, 50, 41, 0, 66,
+    108, 111, 99, 107, 105, 110, 103, 32, 73, 110, 98, 111, 117, 110, 100, 32,
+    97, 110, 100, 32, 79, 117, 116, 98, 111, 117, 110, 100, 32, 67, 111, 109,
+    109, 117, 110, 105, 99, 97, 116, 105, 111, 110, 115, 32, 84, 114, 97, 102,
+    102, 105, 99, 0, 115, 99, 45, 49, 53, 46, 51, 0, 83, 67, 45, 49,
+    53, 40, 48, 51, 41, 0, 68, 105, 115, 97, 98, 108, 105, 110, 103, 32,
+    97, 110, 100, 32, 82, 101, 109, 111, 118, 97, 108, 32, 105, 110, 32, 83,
+    101, 99, 117, 114, 101, 32, 87, 111, 114, 107, 32, 65, 114, 101, 97, 115,
+    0, 115, 99, 45, 49, 53, 46, 52, 0, 83, 67, 45, 49, 53, 40, 48,
+    52, 41, 0, 69, 120, 112, 108, 105, 99, 105, 116, 108, 121, 32, 73, 110,
+    100, 105, 99, 97, 116, 101, 32, 67, 117, 114, 114, 101, 110, 116, 32, 80,
+    97, 114, 116, 105, 99, 105, 112, 97, 110, 116, 115, 0, 115, 99, 45, 49,
+    54, 0, 83, 67, 45, 49, 54, 0, 84, 114, 97, 110, 115, 109, 105, 115,
+    115, 105, 111, 110, 32, 111, 102, 32, 83, 101, 99, 117, 114, 105, 116, 121,
+    32, 97, 110, 100, 32, 80, 114, 105, 118, 97, 99, 121, 32, 65, 116, 116,
+    114, 105, 98, 117, 116, 101, 115, 0, 115, 99, 45, 49, 54, 46, 49, 0,
+    83, 67, 45, 49, 54, 40, 48, 49, 41, 0, 73, 110, 116, 101, 103, 114,
+    105, 116, 121, 32, 86, 101, 114, 105, 102, 105, 99, 97, 116, 105, 111, 110,
+    0, 115, 99, 45, 49, 54, 46, 50, 0, 83, 67, 45, 49, 54, 40, 48,
+    50, 41, 0, 65, 110, 116, 105, 45, 115, 112, 111, 111, 102, 105, 110, 103,
+    32, 77, 101, 99, 104, 97, 110, 105, 115, 109, 115, 0, 115, 99, 45, 49,
+    54, 46, 51, 0, 83, 67, 45, 49, 54, 40, 48, 51, 41, 0, 67, 114,
+    121, 112, 116, 111, 103, 114, 97, 112, 104, 105, 99, 32, 66, 105, 110, 100,
+    105, 110, 103, 0, 115, 99, 45, 49, 55, 0, 83, 67, 45, 49, 55, 0,
+    80, 117, 98, 108, 105, 99, 32, 75, 101, 121, 32, 73, 110, 102, 114, 97,
+    115, 116, 114, 117, 99, 116, 117, 114, 101, 32, 67, 101, 114, 116, 105, 102,
+    105, 99, 97, 116, 101, 115, 0, 115, 99, 45, 49, 56, 0, 83, 67, 45,
+    49, 56, 0, 77, 111, 98, 105, 108, 101, 32, 67, 111, 100, 101, 0, 115,
+    99, 45, 49, 56, 46, 49, 0, 83, 67, 45, 49, 56, 40, 48, 49, 41,
+    0, 73, 100, 101, 110, 116, 105, 102, 121, 32, 85, 110, 97, 99, 99, 101,
+    112, 116, 97, 98, 108, 101, 32, 67, 111, 100, 101, 32, 97, 110, 100, 32,
+    84, 97, 107, 101, 32, 67, 111, 114, 114, 101, 99, 116, 105, 118, 101, 32,
+    65, 99, 116, 105, 111, 110, 115, 0, 115, 99, 45, 49, 56, 46, 50, 0,
+    83, 67, 45, 49, 56, 40, 48, 50, 41, 0, 65, 99, 113, 117, 105, 115,
+    105, 116, 105, 111, 110, 44, 32, 68, 101, 118, 101, 108, 111, 112, 109, 101,
+    110, 116, 44, 32, 97, 110, 100, 32, 85, 115, 101, 0, 115, 99, 45, 49,
+    56, 46, 51, 0, 83, 67, 45, 49, 56, 40, 48, 51, 41, 0, 80, 114,
+    101, 118, 101, 110, 116, 32, 68, 111, 119, 110, 108, 111, 97, 100, 105, 110,
+    103, 32, 97, 110, 100, 32, 69, 120, 101, 99, 117, 116, 105, 111, 110, 0,
+    115, 99, 45, 49, 56, 46, 52, 0, 83, 67, 45, 49, 56, 40, 48, 52,
+    41, 0, 80, 114, 101, 118, 101, 110, 116, 32, 65, 117, 116, 111, 109, 97,
+    116, 105, 99, 32, 69, 120, 101, 99, 117, 116, 105, 111, 110, 0, 115, 99,
+    45, 49, 56, 46, 53, 0, 83, 67, 45, 49, 56, 40, 48, 53, 41, 0,
+    65, 108, 108, 111, 119, 32, 69, 120, 101, 99, 117, 116, 105, 111, 110, 32,
+    79, 110, 108, 121, 32, 105, 110, 32, 67, 111, 110, 102, 105, 110, 101, 100,
+    32, 69, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 115, 0, 115, 99,
+    45, 49, 57, 0, 83, 67, 45, 49, 57, 0, 86, 111, 105, 99, 101, 32,
+    79, 118, 101, 114, 32, 73, 110, 116, 101, 114, 110, 101, 116, 32, 80, 114,
+    111, 116, 111, 99, 111, 108, 0, 115, 99, 45, 50, 48, 0, 83, 67, 45,
+    50, 48, 0, 83, 101, 99, 117, 114, 101, 32, 78, 97, 109, 101, 47, 65,
+    100, 100, 114, 101, 115, 115, 32, 82, 101, 115, 111, 108, 117, 116, 105, 111,
+    110, 32, 83, 101, 114, 118, 105, 99, 101, 32, 40, 65, 117, 116, 104, 111,
+    114, 105, 116, 97, 116, 105, 118, 101, 32, 83, 111, 117, 114, 99, 101, 41,
+    0, 115, 99, 45, 50, 48, 46, 49, 0, 83, 67, 45, 50, 48, 40, 48,
+    49, 41, 0, 67, 104, 105, 108, 100, 32, 83, 117, 98, 115, 112, 97, 99,
+    101, 115, 0, 115, 99, 45, 50, 48, 46, 50, 0, 83, 67, 45, 50, 48,
+    40, 48, 50, 41, 0, 68, 97, 116, 97, 32, 79, 114, 105, 103, 105, 110,
+    32, 97, 110, 100, 32, 73, 110, 116, 101, 103, 114, 105, 116, 121, 0, 115,
+    99, 45, 50, 49, 0, 83, 67, 45, 50, 49, 0, 83, 101, 99, 117, 114,
+    101, 32, 78, 97, 109, 101, 47, 65, 100, 100, 114, 101, 115, 115, 32, 82,
+    101, 115, 111, 108, 117, 116, 105, 111, 110, 32, 83, 101, 114, 118, 105, 99,
+    101, 32, 40, 82, 101, 99, 117, 114, 115, 105, 118, 101, 32, 111, 114, 32,
+    67, 97, 99, 104, 105, 110, 103, 32, 82, 101, 115, 111, 108, 118, 101, 114,
+    41, 0, 115, 99, 45, 50, 49, 46, 49, 0, 83, 67, 45, 50, 49, 40,
+    48, 49, 41, 0, 115, 99, 45, 50, 50, 0, 83, 67, 45, 50, 50, 0,
+    65, 114, 99, 104, 105, 116, 101, 99, 116, 117, 114, 101, 32, 97, 110, 100,
+    32, 80, 114, 111, 118, 105, 115, 105, 111, 110, 105, 110, 103, 32, 102, 111,
+    114, 32, 78, 97, 109, 101, 47, 65, 100, 100, 114, 101, 115, 115, 32, 82,
+    101, 115, 111, 108, 117, 116, 105, 111, 110, 32, 83, 101, 114, 118, 105, 99,
+    101, 0, 115, 99, 45, 50, 51, 0, 83, 67, 45, 50, 51, 0, 83, 101,
+    115, 115, 105, 111, 110, 32, 65, 117, 116, 104, 101, 110, 116, 105, 99, 105,
+    116, 121, 0, 115, 99, 45, 50, 51, 46, 49, 0, 83, 67, 45, 50, 51,
+    40, 48, 49, 41, 0, 73, 110, 118, 97, 108, 105, 100, 97, 116, 101, 32,
+    83, 101, 115, 115, 105, 111, 110, 32, 73, 100, 101, 110, 116, 105, 102, 105,
+    101, 114, 115, 32, 97, 116, 32, 76, 111, 103, 111, 117, 116, 0, 115, 99,
+    45, 50, 51, 46, 50, 0, 83, 67, 45, 50, 51, 40, 48, 50, 41, 0,
+    85, 115, 101, 114, 45, 105, 110, 105, 116, 105, 97, 116, 101, 100, 32, 76,
+    111, 103, 111, 117, 116, 115, 32, 97, 110, 100, 32, 77, 101, 115, 115, 97,
+    103, 101, 32, 68, 105, 115, 112, 108, 97, 121, 115, 0, 115, 99, 45, 50,
+    51, 46, 51, 0, 83, 67, 45, 50, 51, 40, 48, 51, 41, 0, 85, 110,
+    105, 113, 117, 101, 32, 83, 121, 115, 116, 101, 109, 45, 103, 101, 110, 101,
+    114, 97, 116, 101, 100, 32, 83, 101, 115, 115, 105, 111, 110, 32, 73, 100,
+    101, 110, 116, 105, 102, 105, 101, 114, 115, 0, 115, 99, 45, 50, 51, 46,
+    52, 0, 83, 67, 45, 50, 51, 40, 48, 52, 41, 0, 85, 110, 105, 113,
+    117, 101, 32, 83, 101, 115, 115, 105, 111, 110, 32, 73, 100, 101, 110, 116,
+    105, 102, 105, 101, 114, 115, 32, 119, 105, 116, 104, 32, 82, 97, 110, 100,
+    111, 109, 105, 122, 97, 116, 105, 111, 110, 0, 115, 99, 45, 50, 51, 46,
+    53, 0, 83, 67, 45, 50, 51, 40, 48, 53, 41, 0, 65, 108, 108, 111,
+    119, 101, 100, 32, 67, 101, 114, 116, 105, 102, 105, 99, 97, 116, 101, 32,
+    65, 117, 116, 104, 111, 114, 105, 116, 105, 101, 115, 0, 115, 99, 45, 50,
+    52, 0, 83, 67, 45, 50, 52, 0, 70, 97, 105, 108, 32, 105, 110, 32,
+    75, 110, 111, 119, 110, 32, 83, 116, 97, 116, 101, 0, 115, 99, 45, 50,
+    53, 0, 83, 67, 45, 50, 53, 0, 84, 104, 105, 110, 32, 78, 111, 100,
+    101, 115, 0, 115, 99, 45, 50, 54, 0, 83, 67, 45, 50, 54, 0, 68,
+    101, 99, 111, 121, 115, 0, 115, 99, 45, 50, 54, 46, 49, 0, 83, 67,
+    45, 50, 54, 40, 48, 49, 41, 0, 68, 101, 116, 101, 99, 116, 105, 111,
+    110, 32, 111, 102, 32, 77, 97, 108, 105, 99, 105, 111, 117, 115, 32, 67,
+    111, 100, 101, 0, 115, 99, 45, 50, 55, 0, 83, 67, 45, 50, 55, 0,
+    80, 108, 97, 116, 102, 111, 114, 109, 45, 105, 110, 100, 101, 112, 101, 110,
+    100, 101, 110, 116, 32, 65, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110,
+    115, 0, 115, 99, 45, 50, 56, 0, 83, 67, 45, 50, 56, 0, 80, 114,
+    111, 116, 101, 99, 116, 105, 111, 110, 32, 111, 102, 32, 73, 110, 102, 111,
+    114, 109, 97, 116, 105, 111, 110, 32, 97, 116, 32, 82, 101, 115, 116, 0,
+    115, 99, 45, 50, 56, 46, 49, 0, 83, 67, 45, 50, 56, 40, 48, 49,
+    41, 0, 115, 99, 45, 50, 56, 46, 50, 0, 83, 67, 45, 50, 56, 40,
+    48, 50, 41, 0, 79, 102, 102, 108, 105, 110, 101, 32, 83, 116, 111, 114,
+    97, 103, 101, 0, 115, 99, 45, 50, 56, 46, 51, 0, 83, 67, 45, 50,
+    56, 40, 48, 51, 41, 0, 67, 114, 121, 112, 116, 111, 103, 114, 97, 112,
+    104, 105, 99, 32, 75, 101, 121, 115, 0, 115, 99, 45, 50, 57, 0, 83,
+    67, 45, 50, 57, 0, 72, 101, 116, 101, 114, 111, 103, 101, 110, 101, 105,
+    116, 121, 0, 115, 99, 45, 50, 57, 46, 49, 0, 83, 67, 45, 50, 57,
+    40, 48, 49, 41, 0, 86, 105, 114, 116, 117, 97, 108, 105, 122, 97, 116,
+    105, 111, 110, 32, 84, 101, 99, 104, 110, 105, 113, 117, 101, 115, 0, 115,
+    99, 45, 51, 48, 0, 83, 67, 45, 51, 48, 0, 67, 111, 110, 99, 101,
+    97, 108, 109, 101, 110, 116, 32, 97, 110, 100, 32, 77, 105, 115, 100, 105,
+    114, 101, 99, 116, 105, 111, 110, 0, 115, 99, 45, 51, 48, 46, 49, 0,
+    83, 67, 45, 51, 48, 40, 48, 49, 41, 0, 115, 99, 45, 51, 48, 46,
+    50, 0, 83, 67, 45, 51, 48, 40, 48, 50, 41, 0, 82, 97, 110, 100,
+    111, 109, 110, 101, 115, 115, 0, 115, 99, 45, 51, 48, 46, 51, 0, 83,
+    67, 45, 51, 48, 40, 48, 51, 41, 0, 67, 104, 97, 110, 103, 101, 32,
+    80, 114, 111, 99, 101, 115, 115, 105, 110, 103, 32, 97, 110, 100, 32, 83,
+    116, 111, 114, 97, 103, 101, 32, 76, 111, 99, 97, 116, 105, 111, 110, 115,
+    0, 115, 99, 45, 51, 48, 46, 52, 0, 83, 67, 45, 51, 48, 40, 48,
+    52, 41, 0, 77, 105, 115, 108, 101, 97, 100, 105, 110, 103, 32, 73, 110,
+    102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 115, 99, 45, 51, 48, 46,
+    53, 0, 83, 67, 45, 51, 48, 40, 48, 53, 41, 0, 67, 111, 110, 99,
+    101, 97, 108, 109, 101, 110, 116, 32, 111, 102, 32, 83, 121, 115, 116, 101,
+    109, 32, 67, 111, 109, 112, 111, 110, 101, 110, 116, 115, 0, 115, 99, 45,
+    51, 49, 0, 83, 67, 45, 51, 49, 0, 67, 111, 118, 101, 114, 116, 32,
+    67, 104, 97, 110, 110, 101, 108, 32, 65, 110, 97, 108, 121, 115, 105, 115,
+    0, 115, 99, 45, 51, 49, 46, 49, 0, 83, 67, 45, 51, 49, 40, 48,
+    49, 41, 0, 84, 101, 115, 116, 32, 67, 111, 118, 101, 114, 116, 32, 67,
+    104, 97, 110, 110, 101, 108, 115, 32, 102, 111, 114, 32, 69, 120, 112, 108,
+    111, 105, 116, 97, 98, 105, 108, 105, 116, 121, 0, 115, 99, 45, 51, 49,
+    46, 50, 0, 83, 67, 45, 51, 49, 40, 48, 50, 41, 0, 77, 97, 120,
+    105, 109, 117, 109, 32, 66, 97, 110, 100, 119, 105, 100, 116, 104, 0, 115,
+    99, 45, 51, 49, 46, 51, 0, 83, 67, 45, 51, 49, 40, 48, 51, 41,
+    0, 77, 101, 97, 115, 117, 114, 101, 32, 66, 97, 110, 100, 119, 105, 100,
+    116, 104, 32, 105, 110, 32, 79, 112, 101, 114, 97, 116, 105, 111, 110, 97,
+    108, 32, 69, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 115, 0, 115,
+    99, 45, 51, 50, 0, 83, 67, 45, 51, 50, 0, 83, 121, 115, 116, 101,
+    109, 32, 80, 97, 114, 116, 105, 116, 105, 111, 110, 105, 110, 103, 0, 115,
+    99, 45, 51, 50, 46, 49, 0, 83, 67, 45, 51, 50, 40, 48, 49, 41,
+    0, 83, 101, 112, 97, 114, 97, 116, 101, 32, 80, 104, 121, 115, 105, 99,
+    97, 108, 32, 68, 111, 109, 97, 105, 110, 115, 32, 102, 111, 114, 32, 80,
+    114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 70, 117, 110, 99, 116, 105,
+    111, 110, 115, 0, 115, 99, 45, 51, 51, 0, 83, 67, 45, 51, 51, 0,
+    84, 114, 97, 110, 115, 109, 105, 115, 115, 105, 111, 110, 32, 80, 114, 101,
+    112, 97, 114, 97, 116, 105, 111, 110, 32, 73, 110, 116, 101, 103, 114, 105,
+    116, 121, 0, 115, 99, 45, 51, 52, 0, 83, 67, 45, 51, 52, 0, 78,
+    111, 110, 45, 109, 111, 100, 105, 102, 105, 97, 98, 108, 101, 32, 69, 120,
+    101, 99, 117, 116, 97, 98, 108, 101, 32, 80, 114, 111, 103, 114, 97, 109,
+    115, 0, 115, 99, 45, 51, 52, 46, 49, 0, 83, 67, 45, 51, 52, 40,
+    48, 49, 41, 0, 78, 111, 32, 87, 114, 105, 116, 97, 98, 108, 101, 32,
+    83, 116, 111, 114, 97, 103, 101, 0, 115, 99, 45, 51, 52, 46, 50, 0,
+    83, 67, 45, 51, 52, 40, 48, 50, 41, 0, 73, 110, 116, 101, 103, 114,
+    105, 116, 121, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 32, 111,
+    110, 32, 82, 101, 97, 100, 45, 111, 110, 108, 121, 32, 77, 101, 100, 105,
+    97, 0, 115, 99, 45, 51, 52, 46, 51, 0, 83, 67, 45, 51, 52, 40,
+    48, 51, 41, 0, 72, 97, 114, 100, 119, 97, 114, 101, 45, 98, 97, 115,
+    101, 100, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 115, 99,
+    45, 51, 53, 0, 83, 67, 45, 51, 53, 0, 69, 120, 116, 101, 114, 110,
+    97, 108, 32, 77, 97, 108, 105, 99, 105, 111, 117, 115, 32, 67, 111, 100,
+    101, 32, 73, 100, 101, 110, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110,
+    0, 115, 99, 45, 51, 54, 0, 83, 67, 45, 51, 54, 0, 68, 105, 115,
+    116, 114, 105, 98, 117, 116, 101, 100, 32, 80, 114, 111, 99, 101, 115, 115,
+    105, 110, 103, 32, 97, 110, 100, 32, 83, 116, 111, 114, 97, 103, 101, 0,
+    115, 99, 45, 51, 54, 46, 49, 0, 83, 67, 45, 51, 54, 40, 48, 49,
+    41, 0, 80, 111, 108, 108, 105, 110, 103, 32, 84, 101, 99, 104, 110, 105,
+    113, 117, 101, 115, 0, 115, 99, 45, 51, 54, 46, 50, 0, 83, 67, 45,
+    51, 54, 40, 48, 50, 41, 0, 83, 121, 110, 99, 104, 114, 111, 110, 105,
+    122, 97, 116, 105, 111, 110, 0, 115, 99, 45, 51, 55, 0, 83, 67, 45,
+    51, 55, 0, 79, 117, 116, 45, 111, 102, 45, 98, 97, 110, 100, 32, 67,
+    104, 97, 110, 110, 101, 108, 115, 0, 115, 99, 45, 51, 55, 46, 49, 0,
+    83, 67, 45, 51, 55, 40, 48, 49, 41, 0, 69, 110, 115, 117, 114, 101,
+    32, 68, 101, 108, 105, 118, 101, 114, 121, 32, 97, 110, 100, 32, 84, 114,
+    97, 110, 115, 109, 105, 115, 115, 105, 111, 110, 0, 115, 99, 45, 51, 56,
+    0, 83, 67, 45, 51, 56, 0, 115, 99, 45, 51, 57, 0, 83, 67, 45,
+    51, 57, 0, 80, 114, 111, 99, 101, 115, 115, 32, 73, 115, 111, 108, 97,
+    116, 105, 111, 110, 0, 115, 99, 45, 51, 57, 46, 49, 0, 83, 67, 45,
+    51, 57, 40, 48, 49, 41, 0, 115, 99, 45, 51, 57, 46, 50, 0, 83,
+    67, 45, 51, 57, 40, 48, 50, 41, 0, 83, 101, 112, 97, 114, 97, 116,
+    101, 32, 69, 120, 101, 99, 117, 116, 105, 111, 110, 32, 68, 111, 109, 97,
+    105, 110, 32, 80, 101, 114, 32, 84, 104, 114, 101, 97, 100, 0, 115, 99,
+    45, 52, 48, 0, 83, 67, 45, 52, 48, 0, 87, 105, 114, 101, 108, 101,
+    115, 115, 32, 76, 105, 110, 107, 32, 80, 114, 111, 116, 101, 99, 116, 105,
+    111, 110, 0, 115, 99, 45, 52, 48, 46, 49, 0, 83, 67, 45, 52, 48,
+    40, 48, 49, 41, 0, 69, 108, 101, 99, 116, 114, 111, 109, 97, 103, 110,
+    101, 116, 105, 99, 32, 73, 110, 116, 101, 114, 102, 101, 114, 101, 110, 99,
+    101, 0, 115, 99, 45, 52, 48, 46, 50, 0, 83, 67, 45, 52, 48, 40,
+    48, 50, 41, 0, 82, 101, 100, 117, 99, 101, 32, 68, 101, 116, 101, 99,
+    116, 105, 111, 110, 32, 80, 111, 116, 101, 110, 116, 105, 97, 108, 0, 115,
+    99, 45, 52, 48, 46, 51, 0, 83, 67, 45, 52, 48, 40, 48, 51, 41,
+    0, 73, 109, 105, 116, 97, 116, 105, 118, 101, 32, 111, 114, 32, 77, 97,
+    110, 105, 112, 117, 108, 97, 116, 105, 118, 101, 32, 67, 111, 109, 109, 117,
+    110, 105, 99, 97, 116, 105, 111, 110, 115, 32, 68, 101, 99, 101, 112, 116,
+    105, 111, 110, 0, 115, 99, 45, 52, 48, 46, 52, 0, 83, 67, 45, 52,
+    48, 40, 48, 52, 41, 0, 83, 105, 103, 110, 97, 108, 32, 80, 97, 114,
+    97, 109, 101, 116, 101, 114, 32, 73, 100, 101, 110, 116, 105, 102, 105, 99,
+    97, 116, 105, 111, 110, 0, 115, 99, 45, 52, 49, 0, 83, 67, 45, 52,
+    49, 0, 80, 111, 114, 116, 32, 97, 110, 100, 32, 73, 47, 79, 32, 68,
+    101, 118, 105, 99, 101, 32, 65, 99, 99, 101, 115, 115, 0, 115, 99, 45,
+    52, 50, 0, 83, 67, 45, 52, 50, 0, 83, 101, 110, 115, 111, 114, 32,
+    67, 97, 112, 97, 98, 105, 108, 105, 116, 121, 32, 97, 110, 100, 32, 68,
+    97, 116, 97, 0, 115, 99, 45, 52, 50, 46, 49, 0, 83, 67, 45, 52,
+    50, 40, 48, 49, 41, 0, 82, 101, 112, 111, 114, 116, 105, 110, 103, 32,
+    116, 111, 32, 65, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 73, 110,
+    100, 105, 118, 105, 100, 117, 97, 108, 115, 32, 111, 114, 32, 82, 111, 108,
+    101, 115, 0, 115, 99, 45, 52, 50, 46, 50, 0, 83, 67, 45, 52, 50,
+    40, 48, 50, 41, 0, 65, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32,
+    85, 115, 101, 0, 115, 99, 45, 52, 50, 46, 51, 0, 83, 67, 45, 52,
+    50, 40, 48, 51, 41, 0, 80, 114, 111, 104, 105, 98, 105, 116, 32, 85,
+    115, 101, 32, 111, 102, 32, 68, 101, 118, 105, 99, 101, 115, 0, 115, 99,
+    45, 52, 50, 46, 52, 0, 83, 67, 45, 52, 50, 40, 48, 52, 41, 0,
+    78, 111, 116, 105, 99, 101, 32, 111, 102, 32, 67, 111, 108, 108, 101, 99,
+    116, 105, 111, 110, 0, 115, 99, 45, 52, 50, 46, 53, 0, 83, 67, 45,
+    52, 50, 40, 48, 53, 41, 0, 67, 111, 108, 108, 101, 99, 116, 105, 111,
+    110, 32, 77, 105, 110, 105, 109, 105, 122, 97, 116, 105, 111, 110, 0, 115,
+    99, 45, 52, 51, 0, 83, 67, 45, 52, 51, 0, 85, 115, 97, 103, 101,
+    32, 82, 101, 115, 116, 114, 105, 99, 116, 105, 111, 110, 115, 0, 115, 99,
+    45, 52, 52, 0, 83, 67, 45, 52, 52, 0, 68, 101, 116, 111, 110, 97,
+    116, 105, 111, 110, 32, 67, 104, 97, 109, 98, 101, 114, 115, 0, 115, 99,
+    45, 52, 53, 0, 83, 67, 45, 52, 53, 0, 83, 121, 115, 116, 101, 109,
+    32, 84, 105, 109, 101, 32, 83, 121, 110, 99, 104, 114, 111, 110, 105, 122,
+    97, 116, 105, 111, 110, 0, 115, 99, 45, 52, 53, 46, 49, 0, 83, 67,
+    45, 52, 53, 40, 48, 49, 41, 0, 115, 99, 45, 52, 53, 46, 50, 0,
+    83, 67, 45, 52, 53, 40, 48, 50, 41, 0, 115, 99, 45, 52, 54, 0,
+    83, 67, 45, 52, 54, 0, 67, 114, 111, 115, 115, 32, 68, 111, 109, 97,
+    105, 110, 32, 80, 111, 108, 105, 99, 121, 32, 69, 110, 102, 111, 114, 99,
+    101, 109, 101, 110, 116, 0, 115, 99, 45, 52, 55, 0, 83, 67, 45, 52,
+    55, 0, 65, 108, 116, 101, 114, 110, 97, 116, 101, 32, 67, 111, 109, 109,
+    117, 110, 105, 99, 97, 116, 105, 111, 110, 115, 32, 80, 97, 116, 104, 115,
+    0, 115, 99, 45, 52, 56, 0, 83, 67, 45, 52, 56, 0, 83, 101, 110,
+    115, 111, 114, 32, 82, 101, 108, 111, 99, 97, 116, 105, 111, 110, 0, 115,
+    99, 45, 52, 56, 46, 49, 0, 83, 67, 45, 52, 56, 40, 48, 49, 41,
+    0, 68, 121, 110, 97, 109, 105, 99, 32, 82, 101, 108, 111, 99, 97, 116,
+    105, 111, 110, 32, 111, 102, 32, 83, 101, 110, 115, 111, 114, 115, 32, 111,
+    114, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 32, 67, 97, 112,
+    97, 98, 105, 108, 105, 116, 105, 101, 115, 0, 115, 99, 45, 52, 57, 0,
+    83, 67, 45, 52, 57, 0, 72, 97, 114, 100, 119, 97, 114, 101, 45, 101,
+    110, 102, 111, 114, 99, 101, 100, 32, 83, 101, 112, 97, 114, 97, 116, 105,
+    111, 110, 32, 97, 110, 100, 32, 80, 111, 108, 105, 99, 121, 32, 69, 110,
+    102, 111, 114, 99, 101, 109, 101, 110, 116, 0, 115, 99, 45, 53, 48, 0,
+    83, 67, 45, 53, 48, 0, 83, 111, 102, 116, 119, 97, 114, 101, 45, 101,
+    110, 102, 111, 114, 99, 101, 100, 32, 83, 101, 112, 97, 114, 97, 116, 105,
+    111, 110, 32, 97, 110, 100, 32, 80, 111, 108, 105, 99, 121, 32, 69, 110,
+    102, 111, 114, 99, 101, 109, 101, 110, 116, 0, 115, 99, 45, 53, 49, 0,
+    83, 67, 45, 53, 49, 0, 115, 105, 45, 49, 0, 83, 73, 45, 48, 49,
+    0, 83, 121, 115, 116, 101, 109, 32, 97, 110, 100, 32, 73, 110, 102, 111,
+    114, 109, 97, 116, 105, 111, 110, 32, 73, 110, 116, 101, 103, 114, 105, 116,
+    121, 0, 115, 105, 45, 50, 0, 83, 73, 45, 48, 50, 0, 70, 108, 97,
+    119, 32, 82, 101, 109, 101, 100, 105, 97, 116, 105, 111, 110, 0, 115, 105,
+    45, 50, 46, 49, 0, 83, 73, 45, 48, 50, 40, 48, 49, 41, 0, 115,
+    105, 45, 50, 46, 50, 0, 83, 73, 45, 48, 50, 40, 48, 50, 41, 0,
+    65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 70, 108, 97, 119, 32, 82,
+    101, 109, 101, 100, 105, 97, 116, 105, 111, 110, 32, 83, 116, 97, 116, 117,
+    115, 0, 115, 105, 45, 50, 46, 51, 0, 83, 73, 45, 48, 50, 40, 48,
+    51, 41, 0, 84, 105, 109, 101, 32, 116, 111, 32, 82, 101, 109, 101, 100,
+    105, 97, 116, 101, 32, 70, 108, 97, 119, 115, 32, 97, 110, 100, 32, 66,
+    101, 110, 99, 104, 109, 97, 114, 107, 115, 32, 102, 111, 114, 32, 67, 111,
+    114, 114, 101, 99, 116, 105, 118, 101, 32, 65, 99, 116, 105, 111, 110, 115,
+    0, 115, 105, 45, 50, 46, 52, 0, 83, 73, 45, 48, 50, 40, 48, 52,
+    41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 80, 97, 116, 99,
+    104, 32, 77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 32, 84, 111, 111,
+    108, 115, 0, 115, 105, 45, 50, 46, 53, 0, 83, 73, 45, 48, 50, 40,
+    48, 53, 41, 0, 65, 117, 116, 111, 109, 97, 116, 105, 99, 32, 83, 111,
+    102, 116, 119, 97, 114, 101, 32, 97, 110, 100, 32, 70, 105, 114, 109, 119,
+    97, 114, 101, 32, 85, 112, 100, 97, 116, 101, 115, 0, 115, 105, 45, 50,
+    46, 54, 0, 83, 73, 45, 48, 50, 40, 48, 54, 41, 0, 82, 101, 109,
+    111, 118, 97, 108, 32, 111, 102, 32, 80, 114, 101, 118, 105, 111, 117, 115,
+    32, 86, 101, 114, 115, 105, 111, 110, 115, 32, 111, 102, 32, 83, 111, 102,
+    116, 119, 97, 114, 101, 32, 97, 110, 100, 32, 70, 105, 114, 109, 119, 97,
+    114, 101, 0, 115, 105, 45, 51, 0, 83, 73, 45, 48, 51, 0, 77, 97,
+    108, 105, 99, 105, 111, 117, 115, 32, 67, 111, 100, 101, 32, 80, 114, 111,
+    116, 101, 99, 116, 105, 111, 110, 0, 115, 105, 45, 51, 46, 49, 0, 83,
+    73, 45, 48, 51, 40, 48, 49, 41, 0, 115, 105, 45, 51, 46, 50, 0,
+    83, 73, 45, 48, 51, 40, 48, 50, 41, 0, 65, 117, 116, 111, 109, 97,
+    116, 105, 99, 32, 85, 112, 100, 97, 116, 101, 115, 0, 115, 105, 45, 51,
+    46, 51, 0, 83, 73, 45, 48, 51, 40, 48, 51, 41, 0, 78, 111, 110,
+    45, 112, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 85, 115, 101, 114,
+    115, 0, 115, 105, 45, 51, 46, 52, 0, 83, 73, 45, 48, 51, 40, 48,
+    52, 41, 0, 85, 112, 100, 97, 116, 101, 115, 32, 79, 110, 108, 121, 32,
+    98, 121, 32, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 85, 115,
+    101, 114, 115, 0, 115, 105, 45, 51, 46, 53, 0, 83, 73, 45, 48, 51,
+    40, 48, 53, 41, 0, 80, 111, 114, 116, 97, 98, 108, 101, 32, 83, 116,
+    111, 114, 97, 103, 101, 32, 68, 101, 118, 105, 99, 101, 115, 0, 115, 105,
+    45, 51, 46, 54, 0, 83, 73, 45, 48, 51, 40, 48, 54, 41, 0, 84,
+    101, 115, 116, 105, 110, 103, 32, 97, 110, 100, 32, 86, 101, 114, 105, 102,
+    105, 99, 97, 116, 105, 111, 110, 0, 115, 105, 45, 51, 46, 55, 0, 83,
+    73, 45, 48, 51, 40, 48, 55, 41, 0, 78, 111, 110, 115, 105, 103, 110,
+    97, 116, 117, 114, 101, 45, 98, 97, 115, 101, 100, 32, 68, 101, 116, 101,
+    99, 116, 105, 111, 110, 0, 115, 105, 45, 51, 46, 56, 0, 83, 73, 45,
+    48, 51, 40, 48, 56, 41, 0, 68, 101, 116, 101, 99, 116, 32, 85, 110,
+    97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 67, 111, 109, 109, 97,
+    110, 100, 115, 0, 115, 105, 45, 51, 46, 57, 0, 83, 73, 45, 48, 51,
+    40, 48, 57, 41, 0, 115, 105, 45, 51, 46, 49, 48, 0, 83, 73, 45,
+    48, 51, 40, 49, 48, 41, 0, 77, 97, 108, 105, 99, 105, 111, 117, 115,
+    32, 67, 111, 100, 101, 32, 65, 110, 97, 108, 121, 115, 105, 115, 0, 115,
+    105, 45, 52, 0, 83, 73, 45, 48, 52, 0, 83, 121, 115, 116, 101, 109,
+    32, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 0, 115, 105, 45, 52,
+    46, 49, 0, 83, 73, 45, 48, 52, 40, 48, 49, 41, 0, 83, 121, 115,
+    116, 101, 109, 45, 119, 105, 100, 101, 32, 73, 110, 116, 114, 117, 115, 105,
+    111, 110, 32, 68, 101, 116, 101, 99, 116, 105, 111, 110, 32, 83, 121, 115,
+    116, 101, 109, 0, 115, 105, 45, 52, 46, 50, 0, 83, 73, 45, 48, 52,
+    40, 48, 50, 41, 0, 65, 117, 116, 111, 109, 97, 116, 101, 100, 32, 84,
+    111, 111, 108, 115, 32, 97, 110, 100, 32, 77, 101, 99, 104, 97, 110, 105,
+    115, 109, 115, 32, 102, 111, 114, 32, 82, 101, 97, 108, 45, 116, 105, 109,
+    101, 32, 65, 110, 97, 108, 121, 115, 105, 115, 0, 115, 105, 45, 52, 46,
+    51, 0, 83, 73, 45, 48, 52, 40, 48, 51, 41, 0, 65, 117, 116, 111,
+    109, 97, 116, 101, 100, 32, 84, 111, 111, 108, 32, 97, 110, 100, 32, 77,
+    101, 99, 104, 97, 110, 105, 115, 109, 32, 73, 110, 116, 101, 103, 114, 97,
+    116, 105, 111, 110, 0, 115, 105, 45, 52, 46, 52, 0, 83, 73, 45, 48,
+    52, 40, 48, 52, 41, 0, 73, 110, 98, 111, 117, 110, 100, 32, 97, 110,
+    100, 32, 79, 117, 116, 98, 111, 117, 110, 100, 32, 67, 111, 109, 109, 117,
+    110, 105, 99, 97, 116, 105, 111, 110, 115, 32, 84, 114, 97, 102, 102, 105,
+    99, 0, 115, 105, 45, 52, 46, 53, 0, 83, 73, 45, 48, 52, 40, 48,
+    53, 41, 0, 83, 121, 115, 116, 101, 109, 45, 103, 101, 110, 101, 114, 97,
+    116, 101, 100, 32, 65, 108, 101, 114, 116, 115, 0, 115, 105, 45, 52, 46,
+    54, 0, 83, 73, 45, 48, 52, 40, 48, 54, 41, 0, 82, 101, 115, 116,
+    114, 105, 99, 116, 32, 78, 111, 110, 45, 112, 114, 105, 118, 105, 108, 101,
+    103, 101, 100, 32, 85, 115, 101, 114, 115, 0, 115, 105, 45, 52, 46, 55,
+    0, 83, 73, 45, 48, 52, 40, 48, 55, 41, 0, 65, 117, 116, 111, 109,
+    97, 116, 101, 100, 32, 82, 101, 115, 112, 111, 110, 115, 101, 32, 116, 111,
+    32, 83, 117, 115, 112, 105, 99, 105, 111, 117, 115, 32, 69, 118, 101, 110,
+    116, 115, 0, 115, 105, 45, 52, 46, 56, 0, 83, 73, 45, 48, 52, 40,
+    48, 56, 41, 0, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 32, 111,
+    102, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 32, 73, 110, 102,
+    111, 114, 109, 97, 116, 105, 111, 110, 0, 115, 105, 45, 52, 46, 57, 0,
+    83, 73, 45, 48, 52, 40, 48, 57, 41, 0, 84, 101, 115, 116, 105, 110,
+    103, 32, 111, 102, 32, 77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 32,
+    84, 111, 111, 108, 115, 32, 97, 110, 100, 32, 77, 101, 99, 104, 97, 110,
+    105, 115, 109, 115, 0, 115, 105, 45, 52, 46, 49, 48, 0, 83, 73, 45,
+    48, 52, 40, 49, 48, 41, 0, 86, 105, 115, 105, 98, 105, 108, 105, 116,
+    121, 32, 111, 102, 32, 69, 110, 99, 114, 121, 112, 116, 101, 100, 32, 67,
+    111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110, 115, 0, 115, 105,
+    45, 52, 46, 49, 49, 0, 83, 73, 45, 48, 52, 40, 49, 49, 41, 0,
+    65, 110, 97, 108, 121, 122, 101, 32, 67, 111, 109, 109, 117, 110, 105, 99,
+    97, 116, 105, 111, 110, 115, 32, 84, 114, 97, 102, 102, 105, 99, 32, 65,
+    110, 111, 109, 97, 108, 105, 101, 115, 0, 115, 105, 45, 52, 46, 49, 50,
+    0, 83, 73, 45, 48, 52, 40, 49, 50, 41, 0, 65, 117, 116, 111, 109,
+    97, 116, 101, 100, 32, 79, 114, 103, 97, 110, 105, 122, 97, 116, 105, 111,
+    110, 45, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 65, 108, 101, 114,
+    116, 115, 0, 115, 105, 45, 52, 46, 49, 51, 0, 83, 73, 45, 48, 52,
+    40, 49, 51, 41, 0, 65, 110, 97, 108, 121, 122, 101, 32, 84, 114, 97,
+    102, 102, 105, 99, 32, 97, 110, 100, 32, 69, 118, 101, 110, 116, 32, 80,
+    97, 116, 116, 101, 114, 110, 115, 0, 115, 105, 45, 52, 46, 49, 52, 0,
+    83, 73, 45, 48, 52, 40, 49, 52, 41, 0, 87, 105, 114, 101, 108, 101,
+    115, 115, 32, 73, 110, 116, 114, 117, 115, 105, 111, 110, 32, 68, 101, 116,
+    101, 99, 116, 105, 111, 110, 0, 115, 105, 45, 52, 46, 49, 53, 0, 83,
+    73, 45, 48, 52, 40, 49, 53, 41, 0, 87, 105, 114, 101, 108, 101, 115,
+    115, 32, 116, 111, 32, 87, 105, 114, 101, 108, 105, 110, 101, 32, 67, 111,
+    109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110, 115, 0, 115, 105, 45,
+    52, 46, 49, 54, 0, 83, 73, 45, 48, 52, 40, 49, 54, 41, 0, 67,
+    111, 114, 114, 101, 108, 97, 116, 101, 32, 77, 111, 110, 105, 116, 111, 114,
+    105, 110, 103, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0,
+    115, 105, 45, 52, 46, 49, 55, 0, 83, 73, 45, 48, 52, 40, 49, 55,
+    41, 0, 73, 110, 116, 101, 103, 114, 97, 116, 101, 100, 32, 83, 105, 116,
+    117, 97, 116, 105, 111, 110, 97, 108, 32, 65, 119, 97, 114, 101, 110, 101,
+    115, 115, 0, 115, 105, 45, 52, 46, 49, 56, 0, 83, 73, 45, 48, 52,
+    40, 49, 56, 41, 0, 65, 110, 97, 108, 121, 122, 101, 32, 84, 114, 97,
+    102, 102, 105, 99, 32, 97, 110, 100, 32, 67, 111, 118, 101, 114, 116, 32,
+    69, 120, 102, 105, 108, 116, 114, 97, 116, 105, 111, 110, 0, 115, 105, 45,
+    52, 46, 49, 57, 0, 83, 73, 45, 48, 52, 40, 49, 57, 41, 0, 82,
+    105, 115, 107, 32, 102, 111, 114, 32, 73, 110, 100, 105, 118, 105, 100, 117,
+    97, 108, 115, 0, 115, 105, 45, 52, 46, 50, 48, 0, 83, 73, 45, 48,
+    52, 40, 50, 48, 41, 0, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100,
+    32, 85, 115, 101, 114, 115, 0, 115, 105, 45, 52, 46, 50, 49, 0, 83,
+    73, 45, 48, 52, 40, 50, 49, 41, 0, 80, 114, 111, 98, 97, 116, 105,
+    111, 110, 97, 114, 121, 32, 80, 101, 114, 105, 111, 100, 115, 0, 115, 105,
+    45, 52, 46, 50, 50, 0, 83, 73, 45, 48, 52, 40, 50, 50, 41, 0,
+    85, 110, 97, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 78, 101, 116,
+    119, 111, 114, 107, 32, 83, 101, 114, 118, 105, 99, 101, 115, 0, 115, 105,
+    45, 52, 46, 50, 51, 0, 83, 73, 45, 48, 52, 40, 50, 51, 41, 0,
+    72, 111, 115, 116, 45, 98, 97, 115, 101, 100, 32, 68, 101, 118, 105, 99,
+    101, 115, 0, 115, 105, 45, 52, 46, 50, 52, 0, 83, 73, 45, 48, 52,
+    40, 50, 52, 41, 0, 73, 110, 100, 105, 99, 97, 116, 111, 114, 115, 32,
+    111, 102, 32, 67, 111, 109, 112, 114, 111, 109, 105, 115, 101, 0, 115, 105,
+    45, 52, 46, 50, 53, 0, 83, 73, 45, 48, 52, 40, 50, 53, 41, 0,
+    79, 112, 116, 105, 109, 105, 122, 101, 32, 78, 101, 116, 119, 111, 114, 107,
+    32, 84, 114, 97, 102, 102, 105, 99, 32, 65, 110, 97, 108, 121, 115, 105,
+    115, 0, 115, 105, 45, 53, 0, 83, 73, 45, 48, 53, 0, 83, 101, 99,
+    117, 114, 105, 116, 121, 32, 65, 108, 101, 114, 116, 115, 44, 32, 65, 100,
+    118, 105, 115, 111, 114, 105, 101, 115, 44, 32, 97, 110, 100, 32, 68, 105,
+    114, 101, 99, 116, 105, 118, 101, 115, 0, 115, 105, 45, 53, 46, 49, 0,
+    83, 73, 45, 48, 53, 40, 48, 49, 41, 0, 65, 117, 116, 111, 109, 97,
+    116, 101, 100, 32, 65, 108, 101, 114, 116, 115, 32, 97, 110, 100, 32, 65,
+    100, 118, 105, 115, 111, 114, 105, 101, 115, 0, 115, 105, 45, 54, 0, 83,
+    73, 45, 48, 54, 0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 97, 110,
+    100, 32, 80, 114, 105, 118, 97, 99, 121, 32, 70, 117, 110, 99, 116, 105,
+    111, 110, 32, 86, 101, 114, 105, 102, 105, 99, 97, 116, 105, 111, 110, 0,
+    115, 105, 45, 54, 46, 49, 0, 83, 73, 45, 48, 54, 40, 48, 49, 41,
+    0, 78, 111, 116, 105, 102, 105, 99, 97, 116, 105, 111, 110, 32, 111, 102,
+    32, 70, 97, 105, 108, 101, 100, 32, 83, 101, 99, 117, 114, 105, 116, 121,
+    32, 84, 101, 115, 116, 115, 0, 115, 105, 45, 54, 46, 50, 0, 83, 73,
+    45, 48, 54, 40, 48, 50, 41, 0, 65, 117, 116, 111, 109, 97, 116, 105,
+    111, 110, 32, 83, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32, 68,
+    105, 115, 116, 114, 105, 98, 117, 116, 101, 100, 32, 84, 101, 115, 116, 105,
+    110, 103, 0, 115, 105, 45, 54, 46, 51, 0, 83, 73, 45, 48, 54, 40,
+    48, 51, 41, 0, 82, 101, 112, 111, 114, 116, 32, 86, 101, 114, 105, 102,
+    105, 99, 97, 116, 105, 111, 110, 32, 82, 101, 115, 117, 108, 116, 115, 0,
+    115, 105, 45, 55, 0, 83, 73, 45, 48, 55, 0, 83, 111, 102, 116, 119,
+    97, 114, 101, 44, 32, 70, 105, 114, 109, 119, 97, 114, 101, 44, 32, 97,
+    110, 100, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 73,
+    110, 116, 101, 103, 114, 105, 116, 121, 0, 115, 105, 45, 55, 46, 49, 0,
+    83, 73, 45, 48, 55, 40, 48, 49, 41, 0, 73, 110, 116, 101, 103, 114,
+    105, 116, 121, 32, 67, 104, 101, 99, 107, 115, 0, 115, 105, 45, 55, 46,
+    50, 0, 83, 73, 45, 48, 55, 40, 48, 50, 41, 0, 65, 117, 116, 111,
+    109, 97, 116, 101, 100, 32, 78, 111, 116, 105, 102, 105, 99, 97, 116, 105,
+    111, 110, 115, 32, 111, 102, 32, 73, 110, 116, 101, 103, 114, 105, 116, 121,
+    32, 86, 105, 111, 108, 97, 116, 105, 111, 110, 115, 0, 115, 105, 45, 55,
+    46, 51, 0, 83, 73, 45, 48, 55, 40, 48, 51, 41, 0, 67, 101, 110,
+    116, 114, 97, 108, 108, 121, 32, 77, 97, 110, 97, 103, 101, 100, 32, 73,
+    110, 116, 101, 103, 114, 105, 116, 121, 32, 84, 111, 111, 108, 115, 0, 115,
+    105, 45, 55, 46, 52, 0, 83, 73, 45, 48, 55, 40, 48, 52, 41, 0,
+    84, 97, 109, 112, 101, 114, 45, 101, 118, 105, 100, 101, 110, 116, 32, 80,
+    97, 99, 107, 97, 103, 105, 110, 103, 0, 115, 105, 45, 55, 46, 53, 0,
+    83, 73, 45, 48, 55, 40, 48, 53, 41, 0, 65, 117, 116, 111, 109, 97,
+    116, 101, 100, 32, 82, 101, 115, 112, 111, 110, 115, 101, 32, 116, 111, 32,
+    73, 110, 116, 101, 103, 114, 105, 116, 121, 32, 86, 105, 111, 108, 97, 116,
+    105, 111, 110, 115, 0, 115, 105, 45, 55, 46, 54, 0, 83, 73, 45, 48,
+    55, 40, 48, 54, 41, 0, 115, 105, 45, 55, 46, 55, 0, 83, 73, 45,
+    48, 55, 40, 48, 55, 41, 0, 73, 110, 116, 101, 103, 114, 97, 116, 105,
+    111, 110, 32, 111, 102, 32, 68, 101, 116, 101, 99, 116, 105, 111, 110, 32,
+    97, 110, 100, 32, 82, 101, 115, 112, 111, 110, 115, 101, 0, 115, 105, 45,
+    55, 46, 56, 0, 83, 73, 45, 48, 55, 40, 48, 56, 41, 0, 65, 117,
+    100, 105, 116, 105, 110, 103, 32, 67, 97, 112, 97, 98, 105, 108, 105, 116,
+    121, 32, 102, 111, 114, 32, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110,
+    116, 32, 69, 118, 101, 110, 116, 115, 0, 115, 105, 45, 55, 46, 57, 0,
+    83, 73, 45, 48, 55, 40, 48, 57, 41, 0, 86, 101, 114, 105, 102, 121,
+    32, 66, 111, 111, 116, 32, 80, 114, 111, 99, 101, 115, 115, 0, 115, 105,
+    45, 55, 46, 49, 48, 0, 83, 73, 45, 48, 55, 40, 49, 48, 41, 0,
+    80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 32, 111, 102, 32, 66, 111,
+    111, 116, 32, 70, 105, 114, 109, 119, 97, 114, 101, 0, 115, 105, 45, 55,
+    46, 49, 49, 0, 83, 73, 45, 48, 55, 40, 49, 49, 41, 0, 115, 105,
+    45, 55, 46, 49, 50, 0, 83, 73, 45, 48, 55, 40, 49, 50, 41, 0,
+    115, 105, 45, 55, 46, 49, 51, 0, 83, 73, 45, 48, 55, 40, 49, 51,
+    41, 0, 115, 105, 45, 55, 46, 49, 52, 0, 83, 73, 45, 48, 55, 40,
+    49, 52, 41, 0, 115, 105, 45, 55, 46, 49, 53, 0, 83, 73, 45, 48,
+    55, 40, 49, 53, 41, 0, 67, 111, 100, 101, 32, 65, 117, 116, 104, 101,
+    110, 116, 105, 99, 97, 116, 105, 111, 110, 0, 115, 105, 45, 55, 46, 49,
+    54, 0, 83, 73, 45, 48, 55, 40, 49, 54, 41, 0, 84, 105, 109, 101,
+    32, 76, 105, 109, 105, 116, 32, 111, 110, 32, 80, 114, 111, 99, 101, 115,
+    115, 32, 69, 120, 101, 99, 117, 116, 105, 111, 110, 32, 87, 105, 116, 104,
+    111, 117, 116, 32, 83, 117, 112, 101, 114, 118, 105, 115, 105, 111, 110, 0,
+    115, 105, 45, 55, 46, 49, 55, 0, 83, 73, 45, 48, 55, 40, 49, 55,
+    41, 0, 82, 117, 110, 116, 105, 109, 101, 32, 65, 112, 112, 108, 105, 99,
+    97, 116, 105, 111, 110, 32, 83, 101, 108, 102, 45, 112, 114, 111, 116, 101,
+    99, 116, 105, 111, 110, 0, 115, 105, 45, 56, 0, 83, 73, 45, 48, 56,
+    0, 83, 112, 97, 109, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110,
+    0, 115, 105, 45, 56, 46, 49, 0, 83, 73, 45, 48, 56, 40, 48, 49,
+    41, 0, 115, 105, 45, 56, 46, 50, 0, 83, 73, 45, 48, 56, 40, 48,
+    50, 41, 0, 115, 105, 45, 56, 46, 51, 0, 83, 73, 45, 48, 56, 40,
+    48, 51, 41, 0, 67, 111, 110, 116, 105, 110, 117, 111, 117, 115, 32, 76,
+    101, 97, 114, 110, 105, 110, 103, 32, 67, 97, 112, 97, 98, 105, 108, 105,
+    116, 121, 0, 115, 105, 45, 57, 0, 83, 73, 45, 48, 57, 0, 73, 110,
+    102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 73, 110, 112, 117, 116, 32,
+    82, 101, 115, 116, 114, 105, 99, 116, 105, 111, 110, 115, 0, 115, 105, 45,
+    49, 48, 0, 83, 73, 45, 49, 48, 0, 73, 110, 102, 111, 114, 109, 97,
+    116, 105, 111, 110, 32, 73, 110, 112, 117, 116, 32, 86, 97, 108, 105, 100,
+    97, 116, 105, 111, 110, 0, 115, 105, 45, 49, 48, 46, 49, 0, 83, 73,
+    45, 49, 48, 40, 48, 49, 41, 0, 77, 97, 110, 117, 97, 108, 32, 79,
+    118, 101, 114, 114, 105, 100, 101, 32, 67, 97, 112, 97, 98, 105, 108, 105,
+    116, 121, 0, 115, 105, 45, 49, 48, 46, 50, 0, 83, 73, 45, 49, 48,
+    40, 48, 50, 41, 0, 82, 101, 118, 105, 101, 119, 32, 97, 110, 100, 32,
+    82, 101, 115, 111, 108, 118, 101, 32, 69, 114, 114, 111, 114, 115, 0, 115,
+    105, 45, 49, 48, 46, 51, 0, 83, 73, 45, 49, 48, 40, 48, 51, 41,
+    0, 80, 114, 101, 100, 105, 99, 116, 97, 98, 108, 101, 32, 66, 101, 104,
+    97, 118, 105, 111, 114, 0, 115, 105, 45, 49, 48, 46, 52, 0, 83, 73,
+    45, 49, 48, 40, 48, 52, 41, 0, 84, 105, 109, 105, 110, 103, 32, 73,
+    110, 116, 101, 114, 97, 99, 116, 105, 111, 110, 115, 0, 115, 105, 45, 49,
+    48, 46, 53, 0, 83, 73, 45, 49, 48, 40, 48, 53, 41, 0, 82, 101,
+    115, 116, 114, 105, 99, 116, 32, 73, 110, 112, 117, 116, 115, 32, 116, 111,
+    32, 84, 114, 117, 115, 116, 101, 100, 32, 83, 111, 117, 114, 99, 101, 115,
+    32, 97, 110, 100, 32, 65, 112, 112, 114, 111, 118, 101, 100, 32, 70, 111,
+    114, 109, 97, 116, 115, 0, 115, 105, 45, 49, 48, 46, 54, 0, 83, 73,
+    45, 49, 48, 40, 48, 54, 41, 0, 73, 110, 106, 101, 99, 116, 105, 111,
+    110, 32, 80, 114, 101, 118, 101, 110, 116, 105, 111, 110, 0, 115, 105, 45,
+    49, 49, 0, 83, 73, 45, 49, 49, 0, 69, 114, 114, 111, 114, 32, 72,
+    97, 110, 100, 108, 105, 110, 103, 0, 115, 105, 45, 49, 50, 0, 83, 73,
+    45, 49, 50, 0, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32,
+    77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 32, 97, 110, 100, 32, 82,
+    101, 116, 101, 110, 116, 105, 111, 110, 0, 115, 105, 45, 49, 50, 46, 49,
+    0, 83, 73, 45, 49, 50, 40, 48, 49, 41, 0, 115, 105, 45, 49, 50,
+    46, 50, 0, 83, 73, 45, 49, 50, 40, 48, 50, 41, 0, 77, 105, 110,
+    105, 109, 105, 122, 101, 32, 80, 101, 114, 115, 111, 110, 97, 108, 108, 121,
+    32, 73, 100, 101, 110, 116, 105, 102, 105, 97, 98, 108, 101, 32, 73, 110,
+    102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 105, 110, 32, 84, 101, 115,
+    116, 105, 110, 103, 44, 32, 84, 114, 97, 105, 110, 105, 110, 103, 44, 32,
+    97, 110, 100, 32, 82, 101, 115, 101, 97, 114, 99, 104, 0, 115, 105, 45,
+    49, 50, 46, 51, 0, 83, 73, 45, 49, 50, 40, 48, 51, 41, 0, 73,
+    110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 68, 105, 115, 112, 111,
+    115, 97, 108, 0, 115, 105, 45, 49, 51, 0, 83, 73, 45, 49, 51, 0,
+    80, 114, 101, 100, 105, 99, 116, 97, 98, 108, 101, 32, 70, 97, 105, 108,
+    117, 114, 101, 32, 80, 114, 101, 118, 101, 110, 116, 105, 111, 110, 0, 115,
+    105, 45, 49, 51, 46, 49, 0, 83, 73, 45, 49, 51, 40, 48, 49, 41,
+    0, 84, 114, 97, 110, 115, 102, 101, 114, 114, 105, 110, 103, 32, 67, 111,
+    109, 112, 111, 110, 101, 110, 116, 32, 82, 101, 115, 112, 111, 110, 115, 105,
+    98, 105, 108, 105, 116, 105, 101, 115, 0, 115, 105, 45, 49, 51, 46, 50,
+    0, 83, 73, 45, 49, 51, 40, 48, 50, 41, 0, 115, 105, 45, 49, 51,
+    46, 51, 0, 83, 73, 45, 49, 51, 40, 48, 51, 41, 0, 77, 97, 110,
+    117, 97, 108, 32, 84, 114, 97, 110, 115, 102, 101, 114, 32, 66, 101, 116,
+    119, 101, 101, 110, 32, 67, 111, 109, 112, 111, 110, 101, 110, 116, 115, 0,
+    115, 105, 45, 49, 51, 46, 52, 0, 83, 73, 45, 49, 51, 40, 48, 52,
+    41, 0, 83, 116, 97, 110, 100, 98, 121, 32, 67, 111, 109, 112, 111, 110,
+    101, 110, 116, 32, 73, 110, 115, 116, 97, 108, 108, 97, 116, 105, 111, 110,
+    32, 97, 110, 100, 32, 78, 111, 116, 105, 102, 105, 99, 97, 116, 105, 111,
+    110, 0, 115, 105, 45, 49, 51, 46, 53, 0, 83, 73, 45, 49, 51, 40,
+    48, 53, 41, 0, 115, 105, 45, 49, 52, 0, 83, 73, 45, 49, 52, 0,
+    78, 111, 110, 45, 112, 101, 114, 115, 105, 115, 116, 101, 110, 99, 101, 0,
+    115, 105, 45, 49, 52, 46, 49, 0, 83, 73, 45, 49, 52, 40, 48, 49,
+    41, 0, 82, 101, 102, 114, 101, 115, 104, 32, 102, 114, 111, 109, 32, 84,
+    114, 117, 115, 116, 101, 100, 32, 83, 111, 117, 114, 99, 101, 115, 0, 115,
+    105, 45, 49, 52, 46, 50, 0, 83, 73, 45, 49, 52, 40, 48, 50, 41,
+    0, 78, 111, 110, 45, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 32,
+    73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 0, 115, 105, 45, 49,
+    52, 46, 51, 0, 83, 73, 45, 49, 52, 40, 48, 51, 41, 0, 78, 111,
+    110, 45, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 32, 67, 111, 110,
+    110, 101, 99, 116, 105, 118, 105, 116, 121, 0, 115, 105, 45, 49, 53, 0,
+    83, 73, 45, 49, 53, 0, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111,
+    110, 32, 79, 117, 116, 112, 117, 116, 32, 70, 105, 108, 116, 101, 114, 105,
+    110, 103, 0, 115, 105, 45, 49, 54, 0, 83, 73, 45, 49, 54, 0, 77,
+    101, 109, 111, 114, 121, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110,
+    0, 115, 105, 45, 49, 55, 0, 83, 73, 45, 49, 55, 0, 70, 97, 105,
+    108, 45, 115, 97, 102, 101, 32, 80, 114, 111, 99, 101, 100, 117, 114, 101,
+    115, 0, 115, 105, 45, 49, 56, 0, 83, 73, 45, 49, 56, 0, 80, 101,
+    114, 115, 111, 110, 97, 108, 108, 121, 32, 73, 100, 101, 110, 116, 105, 102,
+    105, 97, 98, 108, 101, 32, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111,
+    110, 32, 81, 117, 97, 108, 105, 116, 121, 32, 79, 112, 101, 114, 97, 116,
+    105, 111, 110, 115, 0, 115, 105, 45, 49, 56, 46, 49, 0, 83, 73, 45,
+    49, 56, 40, 48, 49, 41, 0, 115, 105, 45, 49, 56, 46, 50, 0, 83,
+    73, 45, 49, 56, 40, 48, 50, 41, 0, 68, 97, 116, 97, 32, 84, 97,
+    103, 115, 0, 115, 105, 45, 49, 56, 46, 51, 0, 83, 73, 45, 49, 56,
+    40, 48, 51, 41, 0, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 0,
+    115, 105, 45, 49, 56, 46, 52, 0, 83, 73, 45, 49, 56, 40, 48, 52,
+    41, 0, 73, 110, 100, 105, 118, 105, 100, 117, 97, 108, 32, 82, 101, 113,
+    117, 101, 115, 116, 115, 0, 115, 105, 45, 49, 56, 46, 53, 0, 83, 73,
+    45, 49, 56, 40, 48, 53, 41, 0, 78, 111, 116, 105, 99, 101, 32, 111,
+    102, 32, 67, 111, 114, 114, 101, 99, 116, 105, 111, 110, 32, 111, 114, 32,
+    68, 101, 108, 101, 116, 105, 111, 110, 0, 115, 105, 45, 49, 57, 0, 83,
+    73, 45, 49, 57, 0, 68, 101, 45, 105, 100, 101, 110, 116, 105, 102, 105,
+    99, 97, 116, 105, 111, 110, 0, 115, 105, 45, 49, 57, 46, 49, 0, 83,
+    73, 45, 49, 57, 40, 48, 49, 41, 0, 115, 105, 45, 49, 57, 46, 50,
+    0, 83, 73, 45, 49, 57, 40, 48, 50, 41, 0, 65, 114, 99, 104, 105,
+    118, 105, 110, 103, 0, 115, 105, 45, 49, 57, 46, 51, 0, 83, 73, 45,
+    49, 57, 40, 48, 51, 41, 0, 82, 101, 108, 101, 97, 115, 101, 0, 115,
+    105, 45, 49, 57, 46, 52, 0, 83, 73, 45, 49, 57, 40, 48, 52, 41,
+    0, 82, 101, 109, 111, 118, 97, 108, 44, 32, 77, 97, 115, 107, 105, 110,
+    103, 44, 32, 69, 110, 99, 114, 121, 112, 116, 105, 111, 110, 44, 32, 72,
+    97, 115, 104, 105, 110, 103, 44, 32, 111, 114, 32, 82, 101, 112, 108, 97,
+    99, 101, 109, 101, 110, 116, 32, 111, 102, 32, 68, 105, 114, 101, 99, 116,
+    32, 73, 100, 101, 110, 116, 105, 102, 105, 101, 114, 115, 0, 115, 105, 45,
+    49, 57, 46, 53, 0, 83, 73, 45, 49, 57, 40, 48, 53, 41, 0, 83,
+    116, 97, 116, 105, 115, 116, 105, 99, 97, 108, 32, 68, 105, 115, 99, 108,
+    111, 115, 117, 114, 101, 32, 67, 111, 110, 116, 114, 111, 108, 0, 115, 105,
+    45, 49, 57, 46, 54, 0, 83, 73, 45, 49, 57, 40, 48, 54, 41, 0,
+    68, 105, 102, 102, 101, 114, 101, 110, 116, 105, 97, 108, 32, 80, 114, 105,
+    118, 97, 99, 121, 0, 115, 105, 45, 49, 57, 46, 55, 0, 83, 73, 45,
+    49, 57, 40, 48, 55, 41, 0, 86, 97, 108, 105, 100, 97, 116, 101, 100,
+    32, 65, 108, 103, 111, 114, 105, 116, 104, 109, 115, 32, 97, 110, 100, 32,
+    83, 111, 102, 116, 119, 97, 114, 101, 0, 115, 105, 45, 49, 57, 46, 56,
+    0, 83, 73, 45, 49, 57, 40, 48, 56, 41, 0, 77, 111, 116, 105, 118,
+    97, 116, 101, 100, 32, 73, 110, 116, 114, 117, 100, 101, 114, 0, 115, 105,
+    45, 50, 48, 0, 83, 73, 45, 50, 48, 0, 84, 97, 105, 110, 116, 105,
+    110, 103, 0, 115, 105, 45, 50, 49, 0, 83, 73, 45, 50, 49, 0, 73,
+    110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 82, 101, 102, 114, 101,
+    115, 104, 0, 115, 105, 45, 50, 50, 0, 83, 73, 45, 50, 50, 0, 73,
+    110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 68, 105, 118, 101, 114,
+    115, 105, 116, 121, 0, 115, 105, 45, 50, 51, 0, 83, 73, 45, 50, 51,
+    0, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 70, 114, 97,
+    103, 109, 101, 110, 116, 97, 116, 105, 111, 110, 0, 115, 114, 45, 49, 0,
+    83, 82, 45, 48, 49, 0, 83, 117, 112, 112, 108, 121, 32, 67, 104, 97,
+    105, 110, 32, 82, 105, 115, 107, 32, 77, 97, 110, 97, 103, 101, 109, 101,
+    110, 116, 0, 115, 114, 45, 50, 0, 83, 82, 45, 48, 50, 0, 83, 117,
+    112, 112, 108, 121, 32, 67, 104, 97, 105, 110, 32, 82, 105, 115, 107, 32,
+    77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 32, 80, 108, 97, 110, 0,
+    115, 114, 45, 50, 46, 49, 0, 83, 82, 45, 48, 50, 40, 48, 49, 41,
+    0, 69, 115, 116, 97, 98, 108, 105, 115, 104, 32, 83, 67, 82, 77, 32,
+    84, 101, 97, 109, 0, 115, 114, 45, 51, 0, 83, 82, 45, 48, 51, 0,
+    83, 117, 112, 112, 108, 121, 32, 67, 104, 97, 105, 110, 32, 67, 111, 110,
+    116, 114, 111, 108, 115, 32, 97, 110, 100, 32, 80, 114, 111, 99, 101, 115,
+    115, 101, 115, 0, 115, 114, 45, 51, 46, 49, 0, 83, 82, 45, 48, 51,
+    40, 48, 49, 41, 0, 68, 105, 118, 101, 114, 115, 101, 32, 83, 117, 112,
+    112, 108, 121, 32, 66, 97, 115, 101, 0, 115, 114, 45, 51, 46, 50, 0,
+    83, 82, 45, 48, 51, 40, 48, 50, 41, 0, 115, 114, 45, 51, 46, 51,
+    0, 83, 82, 45, 48, 51, 40, 48, 51, 41, 0, 83, 117, 98, 45, 116,
+    105, 101, 114, 32, 70, 108, 111, 119, 32, 68, 111, 119, 110, 0, 115, 114,
+    45, 52, 0, 83, 82, 45, 48, 52, 0, 80, 114, 111, 118, 101, 110, 97,
+    110, 99, 101, 0, 115, 114, 45, 52, 46, 49, 0, 83, 82, 45, 48, 52,
+    40, 48, 49, 41, 0, 73, 100, 101, 110, 116, 105, 116, 121, 0, 115, 114,
+    45, 52, 46, 50, 0, 83, 82, 45, 48, 52, 40, 48, 50, 41, 0, 84,
+    114, 97, 99, 107, 32, 97, 110, 100, 32, 84, 114, 97, 99, 101, 0, 115,
+    114, 45, 52, 46, 51, 0, 83, 82, 45, 48, 52, 40, 48, 51, 41, 0,
+    115, 114, 45, 52, 46, 52, 0, 83, 82, 45, 48, 52, 40, 48, 52, 41,
+    0, 83, 117, 112, 112, 108, 121, 32, 67, 104, 97, 105, 110, 32, 73, 110,
+    116, 101, 103, 114, 105, 116, 121, 32, -30, -128, -108, 32, 80, 101, 100, 105,
+    103, 114, 101, 101, 0, 115, 114, 45, 53, 0, 83, 82, 45, 48, 53, 0,
+    65, 99, 113, 117, 105, 115, 105, 116, 105, 111, 110, 32, 83, 116, 114, 97,
+    116, 101, 103, 105, 101, 115, 44, 32, 84, 111, 111, 108, 115, 44, 32, 97,
+    110, 100, 32, 77, 101, 116, 104, 111, 100, 115, 0, 115, 114, 45, 53, 46,
+    49, 0, 83, 82, 45, 48, 53, 40, 48, 49, 41, 0, 65, 100, 101, 113,
+    117, 97, 116, 101, 32, 83, 117, 112, 112, 108, 121, 0, 115, 114, 45, 53,
+    46, 50, 0, 83, 82, 45, 48, 53, 40, 48, 50, 41, 0, 65, 115, 115,
+    101, 115, 115, 109, 101, 110, 116, 115, 32, 80, 114, 105, 111, 114, 32, 116,
+    111, 32, 83, 101, 108, 101, 99, 116, 105, 111, 110, 44, 32, 65, 99, 99,
+    101, 112, 116, 97, 110, 99, 101, 44, 32, 77, 111, 100, 105, 102, 105, 99,
+    97, 116, 105, 111, 110, 44, 32, 111, 114, 32, 85, 112, 100, 97, 116, 101,
+    0, 115, 114, 45, 54, 0, 83, 82, 45, 48, 54, 0, 83, 117, 112, 112,
+    108, 105, 101, 114, 32, 65, 115, 115, 101, 115, 115, 109, 101, 110, 116, 115,
+    32, 97, 110, 100, 32, 82, 101, 118, 105, 101, 119, 115, 0, 115, 114, 45,
+    54, 46, 49, 0, 83, 82, 45, 48, 54, 40, 48, 49, 41, 0, 84, 101,
+    115, 116, 105, 110, 103, 32, 97, 110, 100, 32, 65, 110, 97, 108, 121, 115,
+    105, 115, 0, 115, 114, 45, 55, 0, 83, 82, 45, 48, 55, 0, 83, 117,
+    112, 112, 108, 121, 32, 67, 104, 97, 105, 110, 32, 79, 112, 101, 114, 97,
+    116, 105, 111, 110, 115, 32, 83, 101, 99, 117, 114, 105, 116, 121, 0, 115,
+    114, 45, 56, 0, 83, 82, 45, 48, 56, 0, 78, 111, 116, 105, 102, 105,
+    99, 97, 116, 105, 111, 110, 32, 65, 103, 114, 101, 101, 109, 101, 110, 116,
+    115, 0, 115, 114, 45, 57, 0, 83, 82, 45, 48, 57, 0, 115, 114, 45,
+    57, 46, 49, 0, 83, 82, 45, 48, 57, 40, 48, 49, 41, 0, 77, 117,
+    108, 116, 105, 112, 108, 101, 32, 83, 116, 97, 103, 101, 115, 32, 111, 102,
+    32, 83, 121, 115, 116, 101, 109, 32, 68, 101, 118, 101, 108, 111, 112, 109,
+    101, 110, 116, 32, 76, 105, 102, 101, 32, 67, 121, 99, 108, 101, 0, 115,
+    114, 45, 49, 48, 0, 83, 82, 45, 49, 48, 0, 115, 114, 45, 49, 49,
+    0, 83, 82, 45, 49, 49, 0, 115, 114, 45, 49, 49, 46, 49, 0, 83,
+    82, 45, 49, 49, 40, 48, 49, 41, 0, 115, 114, 45, 49, 49, 46, 50,
+    0, 83, 82, 45, 49, 49, 40, 48, 50, 41, 0, 115, 114, 45, 49, 49,
+    46, 51, 0, 83, 82, 45, 49, 49, 40, 48, 51, 41, 0, 115, 114, 45,
+    49, 50, 0, 83, 82, 45, 49, 50, 0, 97, 99, 46, 108, 49, 45, 98,
+    46, 49, 46, 105, 0, 65, 67, 46, 76, 49, 45, 98, 46, 49, 46, 105,
+    0, 65, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 65, 99, 99, 101,
+    115, 115, 32, 67, 111, 110, 116, 114, 111, 108, 32, 91, 70, 67, 73, 32,
+    68, 97, 116, 97, 93, 0, 65, 67, 67, 69, 83, 83, 32, 67, 79, 78,
+    84, 82, 79, 76, 0, 97, 99, 46, 108, 49, 45, 98, 46, 49, 46, 105,
+    105, 0, 65, 67, 46, 76, 49, 45, 98, 46, 49, 46, 105, 105, 0, 84,
+    114, 97, 110, 115, 97, 99, 116, 105, 111, 110, 32, 38, 32, 70, 117, 110,
+    99, 116, 105, 111, 110, 32, 67, 111, 110, 116, 114, 111, 108, 32, 91, 70,
+    67, 73, 0, 97, 99, 46, 108, 49, 45, 98, 46, 49, 46, 105, 105, 105,
+    0, 65, 67, 46, 76, 49, 45, 98, 46, 49, 46, 105, 105, 105, 0, 69,
+    120, 116, 101, 114, 110, 97, 108, 32, 67, 111, 110, 110, 101, 99, 116, 105,
+    111, 110, 115, 32, 91, 70, 67, 73, 32, 68, 97, 116, 97, 93, 0, 97,
+    99, 46, 108, 49, 45, 98, 46, 49, 46, 105, 118, 0, 65, 67, 46, 76,
+    49, 45, 98, 46, 49, 46, 105, 118, 0, 67, 111, 110, 116, 114, 111, 108,
+    32, 80, 117, 98, 108, 105, 99, 32, 73, 110, 102, 111, 114, 109, 97, 116,
+    105, 111, 110, 32, 91, 70, 67, 73, 32, 68, 97, 116, 97, 93, 0, 105,
+    97, 46, 108, 49, 45, 98, 46, 49, 46, 118, 0, 73, 65, 46, 76, 49,
+    45, 98, 46, 49, 46, 118, 0, 73, 100, 101, 110, 116, 105, 102, 105, 99,
+    97, 116, 105, 111, 110, 32, 91, 70, 67, 73, 32, 68, 97, 116, 97, 93,
+    0, 73, 68, 69, 78, 84, 73, 70, 73, 67, 65, 84, 73, 79, 78, 32,
+    65, 78, 68, 32, 65, 85, 84, 72, 69, 78, 84, 73, 67, 65, 84, 73,
+    79, 78, 0, 105, 97, 46, 108, 49, 45, 98, 46, 49, 46, 118, 105, 0,
+    73, 65, 46, 76, 49, 45, 98, 46, 49, 46, 118, 105, 0, 65, 117, 116,
+    104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 32, 91, 70, 67, 73,
+    32, 68, 97, 116, 97, 93, 0, 109, 112, 46, 108, 49, 45, 98, 46, 49,
+    46, 118, 105, 105, 0, 77, 80, 46, 76, 49, 45, 98, 46, 49, 46, 118,
+    105, 105, 0, 77, 101, 100, 105, 97, 32, 68, 105, 115, 112, 111, 115, 97,
+    108, 32, 91, 70, 67, 73, 32, 68, 97, 116, 97, 93, 0, 77, 69, 68,
+    73, 65, 32, 80, 82, 79, 84, 69, 67, 84, 73, 79, 78, 0, 112, 101,
+    46, 108, 49, 45, 98, 46, 49, 46, 118, 105, 105, 105, 0, 80, 69, 46,
+    76, 49, 45, 98, 46, 49, 46, 118, 105, 105, 105, 0, 76, 105, 109, 105,
+    116, 32, 80, 104, 121, 115, 105, 99, 97, 108, 32, 65, 99, 99, 101, 115,
+    115, 32, 91, 70, 67, 73, 32, 68, 97, 116, 97, 93, 0, 80, 72, 89,
+    83, 73, 67, 65, 76, 32, 80, 82, 79, 84, 69, 67, 84, 73, 79, 78,
+    0, 112, 101, 46, 108, 49, 45, 98, 46, 49, 46, 105, 120, 0, 80, 69,
+    46, 76, 49, 45, 98, 46, 49, 46, 105, 120, 0, 77, 97, 110, 97, 103,
+    101, 32, 86, 105, 115, 105, 116, 111, 114, 115, 32, 38, 32, 80, 104, 121,
+    115, 105, 99, 97, 108, 32, 65, 99, 99, 101, 115, 115, 0, 115, 99, 46,
+    108, 49, 45, 98, 46, 49, 46, 120, 0, 83, 67, 46, 76, 49, 45, 98,
+    46, 49, 46, 120, 0, 66, 111, 117, 110, 100, 97, 114, 121, 32, 80, 114,
+    111, 116, 101, 99, 116, 105, 111, 110, 32, 91, 70, 67, 73, 32, 68, 97,
+    116, 97, 93, 0, 83, 89, 83, 84, 69, 77, 32, 65, 78, 68, 32, 67,
+    79, 77, 77, 85, 78, 73, 67, 65, 84, 73, 79, 78, 83, 32, 80, 82,
+    79, 84, 69, 67, 84, 73, 79, 78, 0, 115, 99, 46, 108, 49, 45, 98,
+    46, 49, 46, 120, 105, 0, 83, 67, 46, 76, 49, 45, 98, 46, 49, 46,
+    120, 105, 0, 80, 117, 98, 108, 105, 99, 45, 65, 99, 99, 101, 115, 115,
+    32, 83, 121, 115, 116, 101, 109, 32, 83, 101, 112, 97, 114, 97, 116, 105,
+    111, 110, 0, 115, 105, 46, 108, 49, 45, 98, 46, 49, 46, 120, 105, 105,
+    0, 83, 73, 46, 76, 49, 45, 98, 46, 49, 46, 120, 105, 105, 0, 70,
+    108, 97, 119, 32, 82, 101, 109, 101, 100, 105, 97, 116, 105, 111, 110, 32,
+    91, 70, 67, 73, 32, 68, 97, 116, 97, 93, 0, 83, 89, 83, 84, 69,
+    77, 32, 65, 78, 68, 32, 73, 78, 70, 79, 82, 77, 65, 84, 73, 79,
+    78, 32, 73, 78, 84, 69, 71, 82, 73, 84, 89, 0, 115, 105, 46, 108,
+    49, 45, 98, 46, 49, 46, 120, 105, 105, 105, 0, 83, 73, 46, 76, 49,
+    45, 98, 46, 49, 46, 120, 105, 105, 105, 0, 77, 97, 108, 105, 99, 105,
+    111, 117, 115, 32, 67, 111, 100, 101, 32, 80, 114, 111, 116, 101, 99, 116,
+    105, 111, 110, 32, 91, 70, 67, 73, 32, 68, 97, 116, 97, 93, 0, 115,
+    105, 46, 108, 49, 45, 98, 46, 49, 46, 120, 105, 118, 0, 83, 73, 46,
+    76, 49, 45, 98, 46, 49, 46, 120, 105, 118, 0, 85, 112, 100, 97, 116,
+    101, 32, 77, 97, 108, 105, 99, 105, 111, 117, 115, 32, 67, 111, 100, 101,
+    32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 115, 105, 46, 108,
+    49, 45, 98, 46, 49, 46, 120, 118, 0, 83, 73, 46, 76, 49, 45, 98,
+    46, 49, 46, 120, 118, 0, 83, 121, 115, 116, 101, 109, 32, 38, 32, 70,
+    105, 108, 101, 32, 83, 99, 97, 110, 110, 105, 110, 103, 32, 91, 70, 67,
+    73, 32, 68, 97, 116, 97, 93, 0, 97, 99, 46, 108, 50, 45, 51, 46,
+    49, 46, 49, 0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46, 49, 0,
+    65, 117, 116, 104, 111, 114, 105, 122, 101, 100, 32, 65, 99, 99, 101, 115,
+    115, 32, 67, 111, 110, 116, 114, 111, 108, 32, 91, 67, 85, 73, 32, 68,
+    97, 116, 97, 93, 0, 97, 99, 46, 108, 50, 45, 51, 46, 49, 46, 50,
+    0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46, 50, 0, 84, 114, 97,
+    110, 115, 97, 99, 116, 105, 111, 110, 32, 38, 32, 70, 117, 110, 99, 116,
+    105, 111, 110, 32, 67, 111, 110, 116, 114, 111, 108, 32, 91, 67, 85, 73,
+    0, 97, 99, 46, 108, 50, 45, 51, 46, 49, 46, 51, 0, 65, 67, 46,
+    76, 50, 45, 51, 46, 49, 46, 51, 0, 67, 111, 110, 116, 114, 111, 108,
+    32, 67, 85, 73, 32, 70, 108, 111, 119, 0, 97, 99, 46, 108, 50, 45,
+    51, 46, 49, 46, 52, 0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46,
+    52, 0, 97, 99, 46, 108, 50, 45, 51, 46, 49, 46, 53, 0, 65, 67,
+    46, 76, 50, 45, 51, 46, 49, 46, 53, 0, 97, 99, 46, 108, 50, 45,
+    51, 46, 49, 46, 54, 0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46,
+    54, 0, 78, 111, 110, 45, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100,
+    32, 65, 99, 99, 111, 117, 110, 116, 32, 85, 115, 101, 0, 97, 99, 46,
+    108, 50, 45, 51, 46, 49, 46, 55, 0, 65, 67, 46, 76, 50, 45, 51,
+    46, 49, 46, 55, 0, 97, 99, 46, 108, 50, 45, 51, 46, 49, 46, 56,
+    0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46, 56, 0, 97, 99, 46,
+    108, 50, 45, 51, 46, 49, 46, 57, 0, 65, 67, 46, 76, 50, 45, 51,
+    46, 49, 46, 57, 0, 80, 114, 105, 118, 97, 99, 121, 32, 38, 32, 83,
+    101, 99, 117, 114, 105, 116, 121, 32, 78, 111, 116, 105, 99, 101, 115, 0,
+    97, 99, 46, 108, 50, 45, 51, 46, 49, 46, 49, 48, 0, 65, 67, 46,
+    76, 50, 45, 51, 46, 49, 46, 49, 48, 0, 83, 101, 115, 115, 105, 111,
+    110, 32, 76, 111, 99, 107, 0, 97, 99, 46, 108, 50, 45, 51, 46, 49,
+    46, 49, 49, 0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46, 49, 49,
+    0, 97, 99, 46, 108, 50, 45, 51, 46, 49, 46, 49, 50, 0, 65, 67,
+    46, 76, 50, 45, 51, 46, 49, 46, 49, 50, 0, 67, 111, 110, 116, 114,
+    111, 108, 32, 82, 101, 109, 111, 116, 101, 32, 65, 99, 99, 101, 115, 115,
+    0, 97, 99, 46, 108, 50, 45, 51, 46, 49, 46, 49, 51, 0, 65, 67,
+    46, 76, 50, 45, 51, 46, 49, 46, 49, 51, 0, 82, 101, 109, 111, 116,
+    101, 32, 65, 99, 99, 101, 115, 115, 32, 67, 111, 110, 102, 105, 100, 101,
+    110, 116, 105, 97, 108, 105, 116, 121, 0, 97, 99, 46, 108, 50, 45, 51,
+    46, 49, 46, 49, 52, 0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46,
+    49, 52, 0, 82, 101, 109, 111, 116, 101, 32, 65, 99, 99, 101, 115, 115,
+    32, 82, 111, 117, 116, 105, 110, 103, 0, 97, 99, 46, 108, 50, 45, 51,
+    46, 49, 46, 49, 53, 0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46,
+    49, 53, 0, 80, 114, 105, 118, 105, 108, 101, 103, 101, 100, 32, 82, 101,
+    109, 111, 116, 101, 32, 65, 99, 99, 101, 115, 115, 0, 97, 99, 46, 108,
+    50, 45, 51, 46, 49, 46, 49, 54, 0, 65, 67, 46, 76, 50, 45, 51,
+    46, 49, 46, 49, 54, 0, 87, 105, 114, 101, 108, 101, 115, 115, 32, 65,
+    99, 99, 101, 115, 115, 32, 65, 117, 116, 104, 111, 114, 105, 122, 97, 116,
+    105, 111, 110, 0, 97, 99, 46, 108, 50, 45, 51, 46, 49, 46, 49, 55,
+    0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46, 49, 55, 0, 87, 105,
+    114, 101, 108, 101, 115, 115, 32, 65, 99, 99, 101, 115, 115, 32, 80, 114,
+    111, 116, 101, 99, 116, 105, 111, 110, 0, 97, 99, 46, 108, 50, 45, 51,
+    46, 49, 46, 49, 56, 0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46,
+    49, 56, 0, 77, 111, 98, 105, 108, 101, 32, 68, 101, 118, 105, 99, 101,
+    32, 67, 111, 110, 110, 101, 99, 116, 105, 111, 110, 0, 97, 99, 46, 108,
+    50, 45, 51, 46, 49, 46, 49, 57, 0, 65, 67, 46, 76, 50, 45, 51,
+    46, 49, 46, 49, 57, 0, 69, 110, 99, 114, 121, 112, 116, 32, 67, 85,
+    73, 32, 111, 110, 32, 77, 111, 98, 105, 108, 101, 0, 97, 99, 46, 108,
+    50, 45, 51, 46, 49, 46, 50, 48, 0, 65, 67, 46, 76, 50, 45, 51,
+    46, 49, 46, 50, 48, 0, 69, 120, 116, 101, 114, 110, 97, 108, 32, 67,
+    111, 110, 110, 101, 99, 116, 105, 111, 110, 115, 32, 91, 67, 85, 73, 32,
+    68, 97, 116, 97, 93, 0, 97, 99, 46, 108, 50, 45, 51, 46, 49, 46,
+    50, 49, 0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46, 50, 49, 0,
+    80, 111, 114, 116, 97, 98, 108, 101, 32, 83, 116, 111, 114, 97, 103, 101,
+    32, 85, 115, 101, 0, 97, 99, 46, 108, 50, 45, 51, 46, 49, 46, 50,
+    50, 0, 65, 67, 46, 76, 50, 45, 51, 46, 49, 46, 50, 50, 0, 67,
+    111, 110, 116, 114, 111, 108, 32, 80, 117, 98, 108, 105, 99, 32, 73, 110,
+    102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 91, 67, 85, 73, 32, 68,
+    97, 116, 97, 93, 0, 97, 116, 46, 108, 50, 45, 51, 46, 50, 46, 49,
+    0, 65, 84, 46, 76, 50, 45, 51, 46, 50, 46, 49, 0, 82, 111, 108,
+    101, 45, 66, 97, 115, 101, 100, 32, 82, 105, 115, 107, 32, 65, 119, 97,
+    114, 101, 110, 101, 115, 115, 0, 65, 87, 65, 82, 69, 78, 69, 83, 83,
+    32, 65, 78, 68, 32, 84, 82, 65, 73, 78, 73, 78, 71, 0, 97, 116,
+    46, 108, 50, 45, 51, 46, 50, 46, 50, 0, 65, 84, 46, 76, 50, 45,
+    51, 46, 50, 46, 50, 0, 82, 111, 108, 101, 45, 66, 97, 115, 101, 100,
+    32, 84, 114, 97, 105, 110, 105, 110, 103, 0, 97, 116, 46, 108, 50, 45,
+    51, 46, 50, 46, 51, 0, 65, 84, 46, 76, 50, 45, 51, 46, 50, 46,
+    51, 0, 73, 110, 115, 105, 100, 101, 114, 32, 84, 104, 114, 101, 97, 116,
+    32, 65, 119, 97, 114, 101, 110, 101, 115, 115, 0, 97, 117, 46, 108, 50,
+    45, 51, 46, 51, 46, 49, 0, 65, 85, 46, 76, 50, 45, 51, 46, 51,
+    46, 49, 0, 83, 121, 115, 116, 101, 109, 32, 65, 117, 100, 105, 116, 105,
+    110, 103, 0, 65, 85, 68, 73, 84, 32, 65, 78, 68, 32, 65, 67, 67,
+    79, 85, 78, 84, 65, 66, 73, 76, 73, 84, 89, 0, 97, 117, 46, 108,
+    50, 45, 51, 46, 51, 46, 50, 0, 65, 85, 46, 76, 50, 45, 51, 46,
+    51, 46, 50, 0, 85, 115, 101, 114, 32, 65, 99, 99, 111, 117, 110, 116,
+    97, 98, 105, 108, 105, 116, 121, 0, 97, 117, 46, 108, 50, 45, 51, 46,
+    51, 46, 51, 0, 65, 85, 46, 76, 50, 45, 51, 46, 51, 46, 51, 0,
+    69, 118, 101, 110, 116, 32, 82, 101, 118, 105, 101, 119, 0, 97, 117, 46,
+    108, 50, 45, 51, 46, 51, 46, 52, 0, 65, 85, 46, 76, 50, 45, 51,
+    46, 51, 46, 52, 0, 65, 117, 100, 105, 116, 32, 70, 97, 105, 108, 117,
+    114, 101, 32, 65, 108, 101, 114, 116, 105, 110, 103, 0, 97, 117, 46, 108,
+    50, 45, 51, 46, 51, 46, 53, 0, 65, 85, 46, 76, 50, 45, 51, 46,
+    51, 46, 53, 0, 65, 117, 100, 105, 116, 32, 67, 111, 114, 114, 101, 108,
+    97, 116, 105, 111, 110, 0, 97, 117, 46, 108, 50, 45, 51, 46, 51, 46,
+    54, 0, 65, 85, 46, 76, 50, 45, 51, 46, 51, 46, 54, 0, 82, 101,
+    100, 117, 99, 116, 105, 111, 110, 32, 38, 32, 82, 101, 112, 111, 114, 116,
+    105, 110, 103, 0, 97, 117, 46, 108, 50, 45, 51, 46, 51, 46, 55, 0,
+    65, 85, 46, 76, 50, 45, 51, 46, 51, 46, 55, 0, 65, 117, 116, 104,
+    111, 114, 105, 116, 97, 116, 105, 118, 101, 32, 84, 105, 109, 101, 32, 83,
+    111, 117, 114, 99, 101, 0, 97, 117, 46, 108, 50, 45, 51, 46, 51, 46,
+    56, 0, 65, 85, 46, 76, 50, 45, 51, 46, 51, 46, 56, 0, 65, 117,
+    100, 105, 116, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 0, 97,
+    117, 46, 108, 50, 45, 51, 46, 51, 46, 57, 0, 65, 85, 46, 76, 50,
+    45, 51, 46, 51, 46, 57, 0, 65, 117, 100, 105, 116, 32, 77, 97, 110,
+    97, 103, 101, 109, 101, 110, 116, 0, 99, 109, 46, 108, 50, 45, 51, 46,
+    52, 46, 49, 0, 67, 77, 46, 76, 50, 45, 51, 46, 52, 46, 49, 0,
+    83, 121, 115, 116, 101, 109, 32, 66, 97, 115, 101, 108, 105, 110, 105, 110,
+    103, 0, 67, 79, 78, 70, 73, 71, 85, 82, 65, 84, 73, 79, 78, 32,
+    77, 65, 78, 65, 71, 69, 77, 69, 78, 84, 0, 99, 109, 46, 108, 50,
+    45, 51, 46, 52, 46, 50, 0, 67, 77, 46, 76, 50, 45, 51, 46, 52,
+    46, 50, 0, 83, 101, 99, 117, 114, 105, 116, 121, 32, 67, 111, 110, 102,
+    105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 69, 110, 102, 111, 114, 99,
+    101, 109, 101, 110, 116, 0, 99, 109, 46, 108, 50, 45, 51, 46, 52, 46,
+    51, 0, 67, 77, 46, 76, 50, 45, 51, 46, 52, 46, 51, 0, 83, 121,
+    115, 116, 101, 109, 32, 67, 104, 97, 110, 103, 101, 32, 77, 97, 110, 97,
+    103, 101, 109, 101, 110, 116, 0, 99, 109, 46, 108, 50, 45, 51, 46, 52,
+    46, 52, 0, 67, 77, 46, 76, 50, 45, 51, 46, 52, 46, 52, 0, 83,
+    101, 99, 117, 114, 105, 116, 121, 32, 73, 109, 112, 97, 99, 116, 32, 65,
+    110, 97, 108, 121, 115, 105, 115, 0, 99, 109, 46, 108, 50, 45, 51, 46,
+    52, 46, 53, 0, 67, 77, 46, 76, 50, 45, 51, 46, 52, 46, 53, 0,
+    99, 109, 46, 108, 50, 45, 51, 46, 52, 46, 54, 0, 67, 77, 46, 76,
+    50, 45, 51, 46, 52, 46, 54, 0, 99, 109, 46, 108, 50, 45, 51, 46,
+    52, 46, 55, 0, 67, 77, 46, 76, 50, 45, 51, 46, 52, 46, 55, 0,
+    78, 111, 110, 101, 115, 115, 101, 110, 116, 105, 97, 108, 32, 70, 117, 110,
+    99, 116, 105, 111, 110, 97, 108, 105, 116, 121, 0, 99, 109, 46, 108, 50,
+    45, 51, 46, 52, 46, 56, 0, 67, 77, 46, 76, 50, 45, 51, 46, 52,
+    46, 56, 0, 65, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 32, 69,
+    120, 101, 99, 117, 116, 105, 111, 110, 32, 80, 111, 108, 105, 99, 121, 0,
+    99, 109, 46, 108, 50, 45, 51, 46, 52, 46, 57, 0, 67, 77, 46, 76,
+    50, 45, 51, 46, 52, 46, 57, 0, 85, 115, 101, 114, 45, 73, 110, 115,
+    116, 97, 108, 108, 101, 100, 32, 83, 111, 102, 116, 119, 97, 114, 101, 0,
+    105, 97, 46, 108, 50, 45, 51, 46, 53, 46, 49, 0, 73, 65, 46, 76,
+    50, 45, 51, 46, 53, 46, 49, 0, 73, 100, 101, 110, 116, 105, 102, 105,
+    99, 97, 116, 105, 111, 110, 32, 91, 67, 85, 73, 32, 68, 97, 116, 97,
+    93, 0, 105, 97, 46, 108, 50, 45, 51, 46, 53, 46, 50, 0, 73, 65,
+    46, 76, 50, 45, 51, 46, 53, 46, 50, 0, 65, 117, 116, 104, 101, 110,
+    116, 105, 99, 97, 116, 105, 111, 110, 32, 91, 67, 85, 73, 32, 68, 97,
+    116, 97, 93, 0, 105, 97, 46, 108, 50, 45, 51, 46, 53, 46, 51, 0,
+    73, 65, 46, 76, 50, 45, 51, 46, 53, 46, 51, 0, 77, 117, 108, 116,
+    105, 102, 97, 99, 116, 111, 114, 32, 65, 117, 116, 104, 101, 110, 116, 105,
+    99, 97, 116, 105, 111, 110, 0, 105, 97, 46, 108, 50, 45, 51, 46, 53,
+    46, 52, 0, 73, 65, 46, 76, 50, 45, 51, 46, 53, 46, 52, 0, 82,
+    101, 112, 108, 97, 121, 45, 82, 101, 115, 105, 115, 116, 97, 110, 116, 32,
+    65, 117, 116, 104, 101, 110, 116, 105, 99, 97, 116, 105, 111, 110, 0, 105,
+    97, 46, 108, 50, 45, 51, 46, 53, 46, 53, 0, 73, 65, 46, 76, 50,
+    45, 51, 46, 53, 46, 53, 0, 73, 100, 101, 110, 116, 105, 102, 105, 101,
+    114, 32, 82, 101, 117, 115, 101, 0, 105, 97, 46, 108, 50, 45, 51, 46,
+    53, 46, 54, 0, 73, 65, 46, 76, 50, 45, 51, 46, 53, 46, 54, 0,
+    73, 100, 101, 110, 116, 105, 102, 105, 101, 114, 32, 72, 97, 110, 100, 108,
+    105, 110, 103, 0, 105, 97, 46, 108, 50, 45, 51, 46, 53, 46, 55, 0,
+    73, 65, 46, 76, 50, 45, 51, 46, 53, 46, 55, 0, 80, 97, 115, 115,
+    119, 111, 114, 100, 32, 67, 111, 109, 112, 108, 101, 120, 105, 116, 121, 0,
+    105, 97, 46, 108, 50, 45, 51, 46, 53, 46, 56, 0, 73, 65, 46, 76,
+    50, 45, 51, 46, 53, 46, 56, 0, 80, 97, 115, 115, 119, 111, 114, 100,
+    32, 82, 101, 117, 115, 101, 0, 105, 97, 46, 108, 50, 45, 51, 46, 53,
+    46, 57, 0, 73, 65, 46, 76, 50, 45, 51, 46, 53, 46, 57, 0, 84,
+    101, 109, 112, 111, 114, 97, 114, 121, 32, 80, 97, 115, 115, 119, 111, 114,
+    100, 115, 0, 105, 97, 46, 108, 50, 45, 51, 46, 53, 46, 49, 48, 0,
+    73, 65, 46, 76, 50, 45, 51, 46, 53, 46, 49, 48, 0, 67, 114, 121,
+    112, 116, 111, 103, 114, 97, 112, 104, 105, 99, 97, 108, 108, 121, 45, 80,
+    114, 111, 116, 101, 99, 116, 101, 100, 0, 105, 97, 46, 108, 50, 45, 51,
+    46, 53, 46, 49, 49, 0, 73, 65, 46, 76, 50, 45, 51, 46, 53, 46,
+    49, 49, 0, 79, 98, 115, 99, 117, 114, 101, 32, 70, 101, 101, 100, 98,
+    97, 99, 107, 0, 105, 114, 46, 108, 50, 45, 51, 46, 54, 46, 49, 0,
+    73, 82, 46, 76, 50, 45, 51, 46, 54, 46, 49, 0, 73, 78, 67, 73,
+    68, 69, 78, 84, 32, 82, 69, 83, 80, 79, 78, 83, 69, 0, 105, 114,
+    46, 108, 50, 45, 51, 46, 54, 46, 50, 0, 73, 82, 46, 76, 50, 45,
+    51, 46, 54, 46, 50, 0, 105, 114, 46, 108, 50, 45, 51, 46, 54, 46,
+    51, 0, 73, 82, 46, 76, 50, 45, 51, 46, 54, 46, 51, 0, 109, 97,
+    46, 108, 50, 45, 51, 46, 55, 46, 49, 0, 77, 65, 46, 76, 50, 45,
+    51, 46, 55, 46, 49, 0, 80, 101, 114, 102, 111, 114, 109, 32, 77, 97,
+    105, 110, 116, 101, 110, 97, 110, 99, 101, 0, 77, 65, 73, 78, 84, 69,
+    78, 65, 78, 67, 69, 0, 109, 97, 46, 108, 50, 45, 51, 46, 55, 46,
+    50, 0, 77, 65, 46, 76, 50, 45, 51, 46, 55, 46, 50, 0, 83, 121,
+    115, 116, 101, 109, 32, 77, 97, 105, 110, 116, 101, 110, 97, 110, 99, 101,
+    32, 67, 111, 110, 116, 114, 111, 108, 0, 109, 97, 46, 108, 50, 45, 51,
+    46, 55, 46, 51, 0, 77, 65, 46, 76, 50, 45, 51, 46, 55, 46, 51,
+    0, 69, 113, 117, 105, 112, 109, 101, 110, 116, 32, 83, 97, 110, 105, 116,
+    105, 122, 97, 116, 105, 111, 110, 0, 109, 97, 46, 108, 50, 45, 51, 46,
+    55, 46, 52, 0, 77, 65, 46, 76, 50, 45, 51, 46, 55, 46, 52, 0,
+    77, 101, 100, 105, 97, 32, 73, 110, 115, 112, 101, 99, 116, 105, 111, 110,
+    0, 109, 97, 46, 108, 50, 45, 51, 46, 55, 46, 53, 0, 77, 65, 46,
+    76, 50, 45, 51, 46, 55, 46, 53, 0, 109, 97, 46, 108, 50, 45, 51,
+    46, 55, 46, 54, 0, 77, 65, 46, 76, 50, 45, 51, 46, 55, 46, 54,
+    0, 109, 112, 46, 108, 50, 45, 51, 46, 56, 46, 49, 0, 77, 80, 46,
+    76, 50, 45, 51, 46, 56, 46, 49, 0, 109, 112, 46, 108, 50, 45, 51,
+    46, 56, 46, 50, 0, 77, 80, 46, 76, 50, 45, 51, 46, 56, 46, 50,
+    0, 109, 112, 46, 108, 50, 45, 51, 46, 56, 46, 51, 0, 77, 80, 46,
+    76, 50, 45, 51, 46, 56, 46, 51, 0, 77, 101, 100, 105, 97, 32, 68,
+    105, 115, 112, 111, 115, 97, 108, 32, 91, 67, 85, 73, 32, 68, 97, 116,
+    97, 93, 0, 109, 112, 46, 108, 50, 45, 51, 46, 56, 46, 52, 0, 77,
+    80, 46, 76, 50, 45, 51, 46, 56, 46, 52, 0, 77, 101, 100, 105, 97,
+    32, 77, 97, 114, 107, 105, 110, 103, 115, 0, 109, 112, 46, 108, 50, 45,
+    51, 46, 56, 46, 53, 0, 77, 80, 46, 76, 50, 45, 51, 46, 56, 46,
+    53, 0, 77, 101, 100, 105, 97, 32, 65, 99, 99, 111, 117, 110, 116, 97,
+    98, 105, 108, 105, 116, 121, 0, 109, 112, 46, 108, 50, 45, 51, 46, 56,
+    46, 54, 0, 77, 80, 46, 76, 50, 45, 51, 46, 56, 46, 54, 0, 80,
+    111, 114, 116, 97, 98, 108, 101, 32, 83, 116, 111, 114, 97, 103, 101, 32,
+    69, 110, 99, 114, 121, 112, 116, 105, 111, 110, 0, 109, 112, 46, 108, 50,
+    45, 51, 46, 56, 46, 55, 0, 77, 80, 46, 76, 50, 45, 51, 46, 56,
+    46, 55, 0, 82, 101, 109, 111, 118, 97, 98, 108, 101, 32, 77, 101, 100,
+    105, 97, 0, 109, 112, 46, 108, 50, 45, 51, 46, 56, 46, 56, 0, 77,
+    80, 46, 76, 50, 45, 51, 46, 56, 46, 56, 0, 83, 104, 97, 114, 101,
+    100, 32, 77, 101, 100, 105, 97, 0, 109, 112, 46, 108, 50, 45, 51, 46,
+    56, 46, 57, 0, 77, 80, 46, 76, 50, 45, 51, 46, 56, 46, 57, 0,
+    80, 114, 111, 116, 101, 99, 116, 32, 66, 97, 99, 107, 117, 112, 115, 0,
+    112, 115, 46, 108, 50, 45, 51, 46, 57, 46, 49, 0, 80, 83, 46, 76,
+    50, 45, 51, 46, 57, 46, 49, 0, 83, 99, 114, 101, 101, 110, 32, 73,
+    110, 100, 105, 118, 105, 100, 117, 97, 108, 115, 0, 80, 69, 82, 83, 79,
+    78, 78, 69, 76, 32, 83, 69, 67, 85, 82, 73, 84, 89, 0, 112, 115,
+    46, 108, 50, 45, 51, 46, 57, 46, 50, 0, 80, 83, 46, 76, 50, 45,
+    51, 46, 57, 46, 50, 0, 80, 101, 114, 115, 111, 110, 110, 101, 108, 32,
+    65, 99, 116, 105, 111, 110, 115, 0, 112, 101, 46, 108, 50, 45, 51, 46,
+    49, 48, 46, 49, 0, 80, 69, 46, 76, 50, 45, 51, 46, 49, 48, 46,
+    49, 0, 76, 105, 109, 105, 116, 32, 80, 104, 121, 115, 105, 99, 97, 108,
+    32, 65, 99, 99, 101, 115, 115, 32, 91, 67, 85, 73, 32, 68, 97, 116,
+    97, 93, 0, 112, 101, 46, 108, 50, 45, 51, 46, 49, 48, 46, 50, 0,
+    80, 69, 46, 76, 50, 45, 51, 46, 49, 48, 46, 50, 0, 77, 111, 110,
+    105, 116, 111, 114, 32, 70, 97, 99, 105, 108, 105, 116, 121, 0, 112, 101,
+    46, 108, 50, 45, 51, 46, 49, 48, 46, 51, 0, 80, 69, 46, 76, 50,
+    45, 51, 46, 49, 48, 46, 51, 0, 69, 115, 99, 111, 114, 116, 32, 86,
+    105, 115, 105, 116, 111, 114, 115, 32, 91, 67, 85, 73, 32, 68, 97, 116,
+    97, 93, 0, 112, 101, 46, 108, 50, 45, 51, 46, 49, 48, 46, 52, 0,
+    80, 69, 46, 76, 50, 45, 51, 46, 49, 48, 46, 52, 0, 80, 104, 121,
+    115, 105, 99, 97, 108, 32, 65, 99, 99, 101, 115, 115, 32, 76, 111, 103,
+    115, 32, 91, 67, 85, 73, 32, 68, 97, 116, 97, 93, 0, 112, 101, 46,
+    108, 50, 45, 51, 46, 49, 48, 46, 53, 0, 80, 69, 46, 76, 50, 45,
+    51, 46, 49, 48, 46, 53, 0, 77, 97, 110, 97, 103, 101, 32, 80, 104,
+    121, 115, 105, 99, 97, 108, 32, 65, 99, 99, 101, 115, 115, 32, 91, 67,
+    85, 73, 32, 68, 97, 116, 97, 93, 0, 112, 101, 46, 108, 50, 45, 51,
+    46, 49, 48, 46, 54, 0, 80, 69, 46, 76, 50, 45, 51, 46, 49, 48,
+    46, 54, 0, 65, 108, 116, 101, 114, 110, 97, 116, 105, 118, 101, 32, 87,
+    111, 114, 107, 32, 83, 105, 116, 101, 115, 0, 114, 97, 46, 108, 50, 45,
+    51, 46, 49, 49, 46, 49, 0, 82, 65, 46, 76, 50, 45, 51, 46, 49,
+    49, 46, 49, 0, 82, 105, 115, 107, 32, 65, 115, 115, 101, 115, 115, 109,
+    101, 110, 116, 115, 0, 82, 73, 83, 75, 32, 65, 83, 83, 69, 83, 83,
+    77, 69, 78, 84, 0, 114, 97, 46, 108, 50, 45, 51, 46, 49, 49, 46,
+    50, 0, 82, 65, 46, 76, 50, 45, 51, 46, 49, 49, 46, 50, 0, 86,
+    117, 108, 110, 101, 114, 97, 98, 105, 108, 105, 116, 121, 32, 83, 99, 97,
+    110, 0, 114, 97, 46, 108, 50, 45, 51, 46, 49, 49, 46, 51, 0, 82,
+    65, 46, 76, 50, 45, 51, 46, 49, 49, 46, 51, 0, 86, 117, 108, 110,
+    101, 114, 97, 98, 105, 108, 105, 116, 121, 32, 82, 101, 109, 101, 100, 105,
+    97, 116, 105, 111, 110, 0, 99, 97, 46, 108, 50, 45, 51, 46, 49, 50,
+    46, 49, 0, 67, 65, 46, 76, 50, 45, 51, 46, 49, 50, 46, 49, 0,
+    83, 101, 99, 117, 114, 105, 116, 121, 32, 67, 111, 110, 116, 114, 111, 108,
+    32, 65, 115, 115, 101, 115, 115, 109, 101, 110, 116, 0, 83, 69, 67, 85,
+    82, 73, 84, 89, 32, 65, 83, 83, 69, 83, 83, 77, 69, 78, 84, 0,
+    99, 97, 46, 108, 50, 45, 51, 46, 49, 50, 46, 50, 0, 67, 65, 46,
+    76, 50, 45, 51, 46, 49, 50, 46, 50, 0, 79, 112, 101, 114, 97, 116,
+    105, 111, 110, 97, 108, 32, 80, 108, 97, 110, 32, 111, 102, 32, 65, 99,
+    116, 105, 111, 110, 0, 99, 97, 46, 108, 50, 45, 51, 46, 49, 50, 46,
+    51, 0, 67, 65, 46, 76, 50, 45, 51, 46, 49, 50, 46, 51, 0, 83,
+    101, 99, 117, 114, 105, 116, 121, 32, 67, 111, 110, 116, 114, 111, 108, 32,
+    77, 111, 110, 105, 116, 111, 114, 105, 110, 103, 0, 99, 97, 46, 108, 50,
+    45, 51, 46, 49, 50, 46, 52, 0, 67, 65, 46, 76, 50, 45, 51, 46,
+    49, 50, 46, 52, 0, 83, 121, 115, 116, 101, 109, 32, 83, 101, 99, 117,
+    114, 105, 116, 121, 32, 80, 108, 97, 110, 0, 115, 99, 46, 108, 50, 45,
+    51, 46, 49, 51, 46, 49, 0, 83, 67, 46, 76, 50, 45, 51, 46, 49,
+    51, 46, 49, 0, 66, 111, 117, 110, 100, 97, 114, 121, 32, 80, 114, 111,
+    116, 101, 99, 116, 105, 111, 110, 32, 91, 67, 85, 73, 32, 68, 97, 116,
+    97, 93, 0, 115, 99, 46, 108, 50, 45, 51, 46, 49, 51, 46, 50, 0,
+    83, 67, 46, 76, 50, 45, 51, 46, 49, 51, 46, 50, 0, 83, 101, 99,
+    117, 114, 105, 116, 121, 32, 69, 110, 103, 105, 110, 101, 101, 114, 105, 110,
+    103, 0, 115, 99, 46, 108, 50, 45, 51, 46, 49, 51, 46, 51, 0, 83,
+    67, 46, 76, 50, 45, 51, 46, 49, 51, 46, 51, 0, 82, 111, 108, 101,
+    32, 83, 101, 112, 97, 114, 97, 116, 105, 111, 110, 0, 115, 99, 46, 108,
+    50, 45, 51, 46, 49, 51, 46, 52, 0, 83, 67, 46, 76, 50, 45, 51,
+    46, 49, 51, 46, 52, 0, 83, 104, 97, 114, 101, 100, 32, 82, 101, 115,
+    111, 117, 114, 99, 101, 32, 67, 111, 110, 116, 114, 111, 108, 0, 115, 99,
+    46, 108, 50, 45, 51, 46, 49, 51, 46, 53, 0, 83, 67, 46, 76, 50,
+    45, 51, 46, 49, 51, 46, 53, 0, 115, 99, 46, 108, 50, 45, 51, 46,
+    49, 51, 46, 54, 0, 83, 67, 46, 76, 50, 45, 51, 46, 49, 51, 46,
+    54, 0, 78, 101, 116, 119, 111, 114, 107, 32, 67, 111, 109, 109, 117, 110,
+    105, 99, 97, 116, 105, 111, 110, 32, 98, 121, 0, 115, 99, 46, 108, 50,
+    45, 51, 46, 49, 51, 46, 55, 0, 83, 67, 46, 76, 50, 45, 51, 46,
+    49, 51, 46, 55, 0, 83, 112, 108, 105, 116, 32, 84, 117, 110, 110, 101,
+    108, 105, 110, 103, 0, 115, 99, 46, 108, 50, 45, 51, 46, 49, 51, 46,
+    56, 0, 83, 67, 46, 76, 50, 45, 51, 46, 49, 51, 46, 56, 0, 68,
+    97, 116, 97, 32, 105, 110, 32, 84, 114, 97, 110, 115, 105, 116, 0, 115,
+    99, 46, 108, 50, 45, 51, 46, 49, 51, 46, 57, 0, 83, 67, 46, 76,
+    50, 45, 51, 46, 49, 51, 46, 57, 0, 67, 111, 110, 110, 101, 99, 116,
+    105, 111, 110, 115, 32, 84, 101, 114, 109, 105, 110, 97, 116, 105, 111, 110,
+    0, 115, 99, 46, 108, 50, 45, 51, 46, 49, 51, 46, 49, 48, 0, 83,
+    67, 46, 76, 50, 45, 51, 46, 49, 51, 46, 49, 48, 0, 75, 101, 121,
+    32, 77, 97, 110, 97, 103, 101, 109, 101, 110, 116, 0, 115, 99, 46, 108,
+    50, 45, 51, 46, 49, 51, 46, 49, 49, 0, 83, 67, 46, 76, 50, 45,
+    51, 46, 49, 51, 46, 49, 49, 0, 67, 85, 73, 32, 69, 110, 99, 114,
+    121, 112, 116, 105, 111, 110, 0, 115, 99, 46, 108, 50, 45, 51, 46, 49,
+    51, 46, 49, 50, 0, 83, 67, 46, 76, 50, 45, 51, 46, 49, 51, 46,
+    49, 50, 0, 67, 111, 108, 108, 97, 98, 111, 114, 97, 116, 105, 118, 101,
+    32, 68, 101, 118, 105, 99, 101, 32, 67, 111, 110, 116, 114, 111, 108, 0,
+    115, 99, 46, 108, 50, 45, 51, 46, 49, 51, 46, 49, 51, 0, 83, 67,
+    46, 76, 50, 45, 51, 46, 49, 51, 46, 49, 51, 0, 115, 99, 46, 108,
+    50, 45, 51, 46, 49, 51, 46, 49, 52, 0, 83, 67, 46, 76, 50, 45,
+    51, 46, 49, 51, 46, 49, 52, 0, 86, 111, 105, 99, 101, 32, 111, 118,
+    101, 114, 32, 73, 110, 116, 101, 114, 110, 101, 116, 32, 80, 114, 111, 116,
+    111, 99, 111, 108, 0, 115, 99, 46, 108, 50, 45, 51, 46, 49, 51, 46,
+    49, 53, 0, 83, 67, 46, 76, 50, 45, 51, 46, 49, 51, 46, 49, 53,
+    0, 67, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110, 115, 32,
+    65, 117, 116, 104, 101, 110, 116, 105, 99, 105, 116, 121, 0, 115, 99, 46,
+    108, 50, 45, 51, 46, 49, 51, 46, 49, 54, 0, 83, 67, 46, 76, 50,
+    45, 51, 46, 49, 51, 46, 49, 54, 0, 68, 97, 116, 97, 32, 97, 116,
+    32, 82, 101, 115, 116, 0, 115, 105, 46, 108, 50, 45, 51, 46, 49, 52,
+    46, 49, 0, 83, 73, 46, 76, 50, 45, 51, 46, 49, 52, 46, 49, 0,
+    70, 108, 97, 119, 32, 82, 101, 109, 101, 100, 105, 97, 116, 105, 111, 110,
+    32, 91, 67, 85, 73, 32, 68, 97, 116, 97, 93, 0, 115, 105, 46, 108,
+    50, 45, 51, 46, 49, 52, 46, 50, 0, 83, 73, 46, 76, 50, 45, 51,
+    46, 49, 52, 46, 50, 0, 77, 97, 108, 105, 99, 105, 111, 117, 115, 32,
+    67, 111, 100, 101, 32, 80, 114, 111, 116, 101, 99, 116, 105, 111, 110, 32,
+    91, 67, 85, 73, 0, 115, 105, 46, 108, 50, 45, 51, 46, 49, 52, 46,
+    51, 0, 83, 73, 46, 76, 50, 45, 51, 46, 49, 52, 46, 51, 0, 83,
+    101, 99, 117, 114, 105, 116, 121, 32, 65, 108, 101, 114, 116, 115, 32, 38,
+    32, 65, 100, 118, 105, 115, 111, 114, 105, 101, 115, 0, 115, 105, 46, 108,
+    50, 45, 51, 46, 49, 52, 46, 52, 0, 83, 73, 46, 76, 50, 45, 51,
+    46, 49, 52, 46, 52, 0, 115, 105, 46, 108, 50, 45, 51, 46, 49, 52,
+    46, 53, 0, 83, 73, 46, 76, 50, 45, 51, 46, 49, 52, 46, 53, 0,
+    83, 121, 115, 116, 101, 109, 32, 38, 32, 70, 105, 108, 101, 32, 83, 99,
+    97, 110, 110, 105, 110, 103, 32, 91, 67, 85, 73, 32, 68, 97, 116, 97,
+    93, 0, 115, 105, 46, 108, 50, 45, 51, 46, 49, 52, 46, 54, 0, 83,
+    73, 46, 76, 50, 45, 51, 46, 49, 52, 46, 54, 0, 77, 111, 110, 105,
+    116, 111, 114, 32, 67, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111,
+    110, 115, 32, 102, 111, 114, 0, 115, 105, 46, 108, 50, 45, 51, 46, 49,
+    52, 46, 55, 0, 83, 73, 46, 76, 50, 45, 51, 46, 49, 52, 46, 55,
+    0, 73, 100, 101, 110, 116, 105, 102, 121, 32, 85, 110, 97, 117, 116, 104,
+    111, 114, 105, 122, 101, 100, 32, 85, 115, 101, 0,
+};
+
+const compliance_control_t compliance_controls[] = {
+    { 0, 5, 11, 33, "AC", 0, 0 },
+    { 48, 53, 59, 33, "AC", 0, 0 },
+    { 78, 85, 95, 33, "AC", 0, 0 },
+    { 131, 138, 148, 33, "AC", 0, 0 },
+    { 201, 208, 218, 33, "AC", 0, 0 },
+    { 235, 242, 252, 33, "AC", 0, 0 },
+    { 276, 283, 293, 33, "AC", 0, 0 },
+    { 311, 318, 328, 33, "AC", 0, 0 },
+    { 357, 364, 374, 33, "AC", 0, 0 },
+    { 399, 406, 416, 33, "AC", 0, 0 },
+    { 443, 450, 460, 33, "AC", 0, 0 },
+    { 509, 517, 527, 33, "AC", 0, 0 },
+    { 570, 578, 588, 33, "AC", 0, 0 },
+    { 605, 613, 623, 33, "AC", 0, 0 },
+    { 661, 669, 679, 33, "AC", 0, 0 },
+    { 722, 727, 733, 33, "AC", 0, 2 },
+    { 752, 759, 769, 33, "AC", 2, 0 },
+    { 811, 818, 828, 33, "AC", 2, 0 },
+    { 847, 854, 864, 33, "AC", 2, 0 },
+    { 889, 896, 906, 33, "AC", 2, 0 },
+    { 935, 942, 952, 33, "AC", 2, 0 },
+    { 982, 989, 999, 33, "AC", 2, 0 },
+    { 1041, 1048, 1058, 33, "AC", 2, 0 },
+    { 1084, 1091, 1101, 33, "AC", 2, 0 },
+    { 1137, 1144, 1154, 33, "AC", 2, 0 },
+    { 1173, 1181, 1191, 33, "AC", 2, 0 },
+    { 1237, 1245, 1255, 33, "AC", 2, 0 },
+    { 1301, 1309, 1319, 33, "AC", 2, 0 },
+    { 1357, 1365, 1375, 33, "AC", 2, 0 },
+    { 1406, 1414, 1424, 33, "AC", 2, 0 },
+    { 1442, 1450, 1460, 33, "AC", 2, 0 },
+    { 1503, 1508, 1514, 33, "AC", 2, 0 },
+    { 1543, 1550, 1560, 33, "AC", 2, 0 },
+    { 1599, 1606, 1616, 33, "AC", 2, 0 },
+    { 1635, 1642, 1652, 33, "AC", 2, 0 },
+    { 1685, 1692, 1702, 33, "AC", 2, 0 },
+    { 1740, 1747, 1757, 33, "AC", 2, 0 },
+    { 1777, 1784, 1794, 33, "AC", 2, 0 },
+    { 1803, 1810, 1820, 33, "AC", 2, 0 },
+    { 1844, 1851, 1861, 33, "AC", 2, 0 },
+    { 1897, 1904, 1914, 33, "AC", 2, 0 },
+    { 1928, 1936, 1946, 33, "AC", 2, 0 },
+    { 2000, 2008, 2018, 33, "AC", 2, 0 },
+    { 2070, 2078, 2088, 33, "AC", 2, 0 },
+    { 2110, 2118, 2128, 33, "AC", 2, 0 },
+    { 2177, 2185, 2195, 33, "AC", 2, 0 },
+    { 2241, 2249, 2259, 33, "AC", 2, 0 },
+    { 2297, 2305, 2315, 33, "AC", 2, 0 },
+    { 2363, 2371, 2381, 33, "AC", 2, 0 },
+    { 2403, 2411, 2421, 33, "AC", 2, 0 },
+    { 2448, 2456, 2466, 33, "AC", 2, 0 },
+    { 2489, 2497, 2507, 33, "AC", 2, 0 },
+    { 2526, 2534, 2544, 33, "AC", 2, 0 },
+    { 2596, 2604, 2614, 33, "AC", 2, 0 },
+    { 2626, 2634, 2644, 33, "AC", 2, 0 },
+    { 2678, 2686, 2696, 33, "AC", 2, 0 },
+    { 2723, 2731, 2741, 33, "AC", 2, 0 },
+    { 2759, 2767, 2777, 33, "AC", 2, 0 },
+    { 2801, 2809, 2819, 33, "AC", 2, 0 },
+    { 2862, 2870, 2880, 33, "AC", 2, 0 },
+    { 2904, 2912, 2922, 33, "AC", 2, 0 },
+    { 2951, 2959, 2969, 33, "AC", 2, 0 },
+    { 3012, 3020, 3030, 33, "AC", 2, 0 },
+    { 3065, 3073, 3083, 33, "AC", 2, 0 },
+    { 3129, 3134, 3140, 33, "AC", 2, 0 },
+    { 3161, 3166, 3172, 33, "AC", 2, 1 },
+    { 3188, 3195, 3205, 33, "AC", 3, 0 },
+    { 3244, 3251, 3261, 33, "AC", 3, 0 },
+    { 3309, 3316, 3326, 33, "AC", 3, 0 },
+    { 3364, 3371, 3381, 33, "AC", 3, 0 },
+    { 3409, 3416, 3426, 33, "AC", 3, 0 },
+    { 3446, 3453, 3463, 33, "AC", 3, 0 },
+    { 3509, 3516, 3526, 33, "AC", 3, 0 },
+    { 3552, 3559, 3569, 33, "AC", 3, 0 },
+    { 3605, 3612, 3622, 33, "AC", 3, 1 },
+    { 3654, 3662, 3672, 33, "AC", 4, 0 },
+    { 3738, 3743, 3749, 33, "AC", 4, 1 },
+    { 3777, 3784, 3794, 33, "AC", 5, 0 },
+    { 3817, 3824, 3834, 33, "AC", 5, 0 },
+    { 3862, 3869, 3879, 33, "AC", 5, 0 },
+    { 3906, 3913, 3923, 33, "AC", 5, 0 },
+    { 3962, 3967, 3973, 33, "AC", 5, 0 },
+    { 3997, 4002, 4008, 33, "AC", 5, 0 },
+    { 4036, 4043, 4053, 33, "AC", 5, 0 },
+    { 4073, 4080, 4090, 33, "AC", 5, 0 },
+    { 4125, 4132, 4142, 33, "AC", 5, 0 },
+    { 4174, 4181, 4191, 33, "AC", 5, 0 },
+    { 4220, 4226, 4232, 33, "AC", 5, 0 },
+    { 4259, 4265, 4271, 33, "AC", 5, 0 },
+    { 4283, 4291, 4301, 33, "AC", 5, 0 },
+    { 4325, 4331, 4337, 33, "AC", 5, 0 },
+    { 4357, 4365, 4375, 33, "AC", 5, 0 },
+    { 4398, 4406, 4416, 33, "AC", 5, 0 },
+    { 4436, 4444, 4454, 33, "AC", 5, 0 },
+    { 4478, 4484, 4490, 33, "AC", 5, 0 },
+    { 4532, 4538, 4544, 33, "AC", 5, 0 },
+    { 4603, 4611, 4621, 33, "AC", 5, 0 },
+    { 4636, 4642, 4648, 33, "AC", 5, 0 },
+    { 4666, 4672, 4678, 33, "AC", 5, 0 },
+    { 4710, 4718, 4728, 33, "AC", 5, 0 },
+    { 4758, 4766, 4776, 33, "AC", 5, 0 },
+    { 4826, 4834, 4844, 33, "AC", 5, 0 },
+    { 4892, 4900, 4910, 33, "AC", 5, 0 },
+    { 4962, 4970, 4980, 33, "AC", 5, 0 },
+    { 5023, 5031, 5041, 33, "AC", 5, 0 },
+    { 5078, 5086, 5096, 33, "AC", 5, 0 },
+    { 5132, 5140, 5150, 33, "AC", 5, 0 },
+    { 5190, 5198, 5208, 33, "AC", 5, 0 },
+    { 5256, 5265, 5275, 33, "AC", 5, 0 },
+    { 5325, 5331, 5337, 33, "AC", 5, 0 },
+    { 5351, 5359, 5369, 33, "AC", 5, 0 },
+    { 5392, 5400, 5410, 33, "AC", 5, 0 },
+    { 5471, 5479, 5489, 33, "AC", 5, 0 },
+    { 5519, 5527, 5537, 33, "AC", 5, 0 },
+    { 5568, 5576, 5586, 33, "AC", 5, 0 },
+    { 5626, 5634, 5644, 33, "AC", 5, 0 },
+    { 5680, 5688, 5698, 33, "AC", 5, 0 },
+    { 5749, 5757, 5767, 33, "AC", 5, 0 },
+    { 5803, 5811, 5821, 33, "AC", 5, 0 },
+    { 5850, 5859, 5869, 33, "AC", 5, 0 },
+    { 5898, 5904, 5910, 33, "AC", 5, 0 },
+    { 5926, 5934, 5944, 33, "AC", 5, 0 },
+    { 5974, 5982, 5992, 33, "AC", 5, 0 },
+    { 6028, 6036, 6046, 33, "AC", 5, 0 },
+    { 6074, 6082, 6092, 33, "AC", 5, 0 },
+    { 6125, 6133, 6143, 33, "AC", 5, 0 },
+    { 6182, 6188, 6194, 33, "AC", 5, 0 },
+    { 6228, 6236, 6246, 33, "AC", 5, 0 },
+    { 6291, 6299, 6309, 33, "AC", 5, 0 },
+    { 6358, 6366, 6376, 33, "AC", 5, 0 },
+    { 6435, 6443, 6453, 33, "AC", 5, 0 },
+    { 6493, 6501, 6511, 33, "AC", 5, 0 },
+    { 6553, 6559, 6565, 33, "AC", 5, 0 },
+    { 6589, 6597, 6607, 33, "AC", 5, 0 },
+    { 6632, 6640, 6650, 33, "AC", 5, 0 },
+    { 6694, 6702, 6712, 33, "AC", 5, 0 },
+    { 6766, 6774, 6784, 33, "AC", 5, 0 },
+    { 6838, 6846, 6856, 33, "AC", 5, 0 },
+    { 6900, 6906, 6912, 33, "AC", 5, 0 },
+    { 6932, 6940, 6950, 33, "AC", 5, 0 },
+    { 6977, 6985, 6995, 33, "AC", 5, 0 },
+    { 7028, 7034, 7040, 33, "AC", 5, 0 },
+    { 7068, 7074, 7080, 33, "AC", 5, 0 },
+    { 7103, 7109, 7115, 33, "AC", 5, 0 },
+    { 7140, 7148, 7158, 33, "AC", 5, 0 },
+    { 7200, 7208, 7218, 33, "AC", 5, 0 },
+    { 7246, 7252, 7258, 33, "AC", 5, 0 },
+    { 7276, 7281, 11, 7287, "AT", 5, 0 },
+    { 7310, 7315, 7321, 7287, "AT", 5, 0 },
+    { 7353, 7360, 7370, 7287, "AT", 5, 0 },
+    { 7390, 7397, 7407, 7287, "AT", 5, 0 },
+    { 7422, 7429, 7439, 7287, "AT", 5, 0 },
+    { 7469, 7476, 7486, 7287, "AT", 5, 0 },
+    { 7542, 7549, 7559, 7287, "AT", 5, 0 },
+    { 7586, 7593, 7603, 7287, "AT", 5, 0 },
+    { 7628, 7633, 7639, 7287, "AT", 5, 0 },
+    { 7659, 7666, 7676, 7287, "AT", 5, 0 },
+    { 7699, 7706, 7716, 7287, "AT", 5, 0 },
+    { 7743, 7750, 7370, 7287, "AT", 5, 0 },
+    { 7760, 7767, 7486, 7287, "AT", 5, 0 },
+    { 7777, 7784, 7794, 7287, "AT", 5, 0 },
+    { 7841, 7846, 7852, 7287, "AT", 5, 0 },
+    { 7869, 7874, 7880, 7287, "AT", 5, 0 },
+    { 7927, 7932, 7938, 7287, "AT", 5, 0 },
+    { 7956, 7961, 11, 7967, "AU", 5, 0 },
+    { 7992, 7997, 8003, 7967, "AU", 5, 1 },
+    { 8017, 8024, 8034, 7967, "AU", 6, 0 },
+    { 8085, 8092, 8102, 7967, "AU", 6, 0 },
+    { 8141, 8148, 8158, 7967, "AU", 6, 0 },
+    { 8178, 8185, 8195, 7967, "AU", 6, 0 },
+    { 8216, 8221, 8227, 7967, "AU", 6, 1 },
+    { 8252, 8259, 8269, 7967, "AU", 7, 0 },
+    { 8298, 8305, 8315, 7967, "AU", 7, 0 },
+    { 8370, 8377, 8387, 7967, "AU", 7, 0 },
+    { 8438, 8443, 8449, 7967, "AU", 7, 0 },
+    { 8476, 8483, 8493, 7967, "AU", 7, 0 },
+    { 8523, 8528, 8534, 7967, "AU", 7, 0 },
+    { 8577, 8584, 8594, 7967, "AU", 7, 0 },
+    { 8619, 8626, 8636, 7967, "AU", 7, 0 },
+    { 8653, 8660, 8670, 7967, "AU", 7, 0 },
+    { 8709, 8716, 8726, 7967, "AU", 7, 0 },
+    { 8746, 8753, 8763, 7967, "AU", 7, 0 },
+    { 8798, 8803, 8809, 7967, "AU", 7, 1 },
+    { 8854, 8861, 8871, 7967, "AU", 8, 0 },
+    { 8901, 8908, 8918, 7967, "AU", 8, 0 },
+    { 8944, 8951, 8961, 7967, "AU", 8, 0 },
+    { 8997, 9004, 9014, 7967, "AU", 8, 0 },
+    { 9042, 9049, 9059, 7967, "AU", 8, 0 },
+    { 9096, 9103, 9113, 7967, "AU", 8, 0 },
+    { 9150, 9157, 9167, 7967, "AU", 8, 0 },
+    { 9185, 9192, 9202, 7967, "AU", 8, 0 },
+    { 9244, 9251, 9261, 7967, "AU", 8, 0 },
+    { 9316, 9324, 9334, 7967, "AU", 8, 0 },
+    { 9357, 9362, 9368, 7967, "AU", 8, 0 },
+    { 9413, 9420, 9430, 7967, "AU", 8, 0 },
+    { 9451, 9458, 9468, 7967, "AU", 8, 0 },
+    { 9494, 9499, 9505, 7967, "AU", 8, 0 },
+    { 9517, 9524, 9534, 7967, "AU", 8, 0 },
+    { 9581, 9588, 9598, 7967, "AU", 8, 0 },
+    { 9634, 9639, 9645, 7967, "AU", 8, 0 },
+    { 9677, 9684, 9694, 7967, "AU", 8, 0 },
+    { 9720, 9727, 9737, 7967, "AU", 8, 0 },
+    { 9786, 9793, 9803, 7967, "AU", 8, 0 },
+    { 9828, 9835, 9845, 7967, "AU", 8, 0 },
+    { 9882, 9889, 828, 7967, "AU", 8, 0 },
+    { 9899, 9906, 9916, 7967, "AU", 8, 0 },
+    { 9933, 9940, 9950, 7967, "AU", 8, 0 },
+    { 10001, 10007, 10013, 7967, "AU", 8, 0 },
+    { 10029, 10037, 10047, 7967, "AU", 8, 0 },
+    { 10073, 10081, 10091, 7967, "AU", 8, 0 },
+    { 10141, 10149, 10159, 7967, "AU", 8, 0 },
+    { 10176, 10184, 10194, 7967, "AU", 8, 0 },
+    { 10244, 10252, 10262, 7967, "AU", 8, 0 },
+    { 10281, 10287, 10293, 7967, "AU", 8, 0 },
+    { 10316, 10324, 10334, 7967, "AU", 8, 0 },
+    { 10365, 10371, 10377, 7967, "AU", 8, 1 },
+    { 10401, 10409, 10419, 7967, "AU", 9, 0 },
+    { 10463, 10471, 10481, 7967, "AU", 9, 0 },
+    { 10502, 10510, 10520, 7967, "AU", 9, 0 },
+    { 10554, 10562, 10572, 7967, "AU", 9, 0 },
+    { 10634, 10640, 10646, 7967, "AU", 9, 0 },
+    { 10684, 10692, 10702, 7967, "AU", 9, 0 },
+    { 10725, 10733, 10743, 7967, "AU", 9, 0 },
+    { 10769, 10777, 10787, 7967, "AU", 9, 0 },
+    { 10827, 10833, 10839, 7967, "AU", 9, 0 },
+    { 10853, 10861, 10871, 7967, "AU", 9, 0 },
+    { 10887, 10895, 10905, 7967, "AU", 9, 0 },
+    { 10932, 10940, 10950, 7967, "AU", 9, 0 },
+    { 10979, 10985, 8763, 7967, "AU", 9, 0 },
+    { 10991, 10997, 11003, 7967, "AU", 9, 0 },
+    { 11038, 11046, 11056, 7967, "AU", 9, 0 },
+    { 11078, 11086, 11096, 7967, "AU", 9, 0 },
+    { 11125, 11133, 11143, 7967, "AU", 9, 0 },
+    { 11160, 11165, 11, 11171, "CA", 9, 0 },
+    { 11213, 11218, 11224, 11171, "CA", 9, 0 },
+    { 11244, 11251, 11261, 11171, "CA", 9, 0 },
+    { 11283, 11290, 11300, 11171, "CA", 9, 0 },
+    { 11324, 11331, 11341, 11171, "CA", 9, 0 },
+    { 11388, 11393, 11399, 11171, "CA", 9, 0 },
+    { 11420, 11427, 11437, 11171, "CA", 9, 0 },
+    { 11487, 11494, 11504, 11171, "CA", 9, 0 },
+    { 11552, 11559, 11569, 11171, "CA", 9, 0 },
+    { 11623, 11630, 11640, 11171, "CA", 9, 0 },
+    { 11671, 11678, 11688, 11171, "CA", 9, 0 },
+    { 11732, 11739, 11749, 11171, "CA", 9, 0 },
+    { 11773, 11780, 11790, 11171, "CA", 9, 0 },
+    { 11823, 11828, 11834, 11171, "CA", 9, 0 },
+    { 11857, 11862, 11868, 11171, "CA", 9, 0 },
+    { 11898, 11905, 11915, 11171, "CA", 9, 0 },
+    { 11960, 11965, 11971, 11171, "CA", 9, 0 },
+    { 11985, 11992, 12002, 11171, "CA", 9, 0 },
+    { 12045, 12052, 12062, 11171, "CA", 9, 0 },
+    { 12105, 12110, 12116, 11171, "CA", 9, 0 },
+    { 12138, 12145, 12155, 11171, "CA", 9, 0 },
+    { 12178, 12185, 12195, 11171, "CA", 9, 0 },
+    { 12216, 12223, 12233, 11171, "CA", 9, 0 },
+    { 12248, 12255, 12265, 11171, "CA", 9, 0 },
+    { 12281, 12288, 12298, 11171, "CA", 9, 0 },
+    { 12319, 12326, 12336, 11171, "CA", 9, 0 },
+    { 12370, 12375, 12381, 11171, "CA", 9, 0 },
+    { 12401, 12408, 12418, 11171, "CA", 9, 0 },
+    { 12464, 12471, 12481, 11171, "CA", 9, 0 },
+    { 12500, 12507, 12517, 11171, "CA", 9, 0 },
+    { 12546, 12551, 12557, 11171, "CA", 9, 0 },
+    { 12585, 12592, 12602, 11171, "CA", 9, 0 },
+    { 12620, 12625, 11, 12631, "CM", 9, 0 },
+    { 12656, 12661, 12667, 12631, "CM", 9, 1 },
+    { 12690, 12697, 8158, 12631, "CM", 10, 0 },
+    { 12707, 12714, 11915, 12631, "CM", 10, 0 },
+    { 12724, 12731, 12741, 12631, "CM", 10, 0 },
+    { 12778, 12785, 12795, 12631, "CM", 10, 0 },
+    { 12817, 12824, 12834, 12631, "CM", 10, 0 },
+    { 12854, 12861, 12871, 12631, "CM", 10, 0 },
+    { 12905, 12912, 12922, 12631, "CM", 10, 0 },
+    { 12975, 12980, 12986, 12631, "CM", 10, 1 },
+    { 13015, 13022, 13032, 12631, "CM", 11, 0 },
+    { 13098, 13105, 13115, 12631, "CM", 11, 0 },
+    { 13165, 13172, 13182, 12631, "CM", 11, 0 },
+    { 13214, 13221, 13231, 12631, "CM", 11, 0 },
+    { 13268, 13275, 13285, 12631, "CM", 11, 0 },
+    { 13313, 13320, 13330, 12631, "CM", 11, 0 },
+    { 13354, 13361, 13371, 12631, "CM", 11, 0 },
+    { 13393, 13400, 13410, 12631, "CM", 11, 0 },
+    { 13452, 13457, 13463, 12631, "CM", 11, 0 },
+    { 13479, 13486, 13496, 12631, "CM", 11, 0 },
+    { 13523, 13530, 13540, 12631, "CM", 11, 0 },
+    { 13565, 13570, 13576, 12631, "CM", 11, 1 },
+    { 13607, 13614, 13624, 12631, "CM", 12, 0 },
+    { 13671, 13678, 13371, 12631, "CM", 12, 0 },
+    { 13688, 13695, 13705, 12631, "CM", 12, 0 },
+    { 13723, 13730, 828, 12631, "CM", 12, 0 },
+    { 13740, 13747, 13757, 12631, "CM", 12, 0 },
+    { 13807, 13814, 13824, 12631, "CM", 12, 0 },
+    { 13849, 13856, 13866, 12631, "CM", 12, 0 },
+    { 13914, 13919, 13925, 12631, "CM", 12, 2 },
+    { 13948, 13955, 13965, 12631, "CM", 14, 0 },
+    { 14017, 14024, 14034, 12631, "CM", 14, 0 },
+    { 14066, 14073, 14083, 12631, "CM", 14, 0 },
+    { 14113, 14120, 14130, 12631, "CM", 14, 0 },
+    { 14156, 14161, 14167, 12631, "CM", 14, 1 },
+    { 14187, 14194, 14204, 12631, "CM", 15, 0 },
+    { 14220, 14227, 14237, 12631, "CM", 15, 1 },
+    { 14263, 14270, 14280, 12631, "CM", 16, 0 },
+    { 14304, 14311, 14321, 12631, "CM", 16, 0 },
+    { 14365, 14372, 14382, 12631, "CM", 16, 0 },
+    { 14425, 14432, 14442, 12631, "CM", 16, 0 },
+    { 14488, 14495, 14505, 12631, "CM", 16, 0 },
+    { 14546, 14553, 14563, 12631, "CM", 16, 0 },
+    { 14597, 14604, 14614, 12631, "CM", 16, 0 },
+    { 14659, 14664, 14670, 12631, "CM", 16, 0 },
+    { 14697, 14704, 14714, 12631, "CM", 16, 0 },
+    { 14754, 14761, 14771, 12631, "CM", 16, 0 },
+    { 14793, 14800, 14810, 12631, "CM", 16, 0 },
+    { 14853, 14860, 14870, 12631, "CM", 16, 0 },
+    { 14897, 14904, 14914, 12631, "CM", 16, 0 },
+    { 14952, 14959, 14969, 12631, "CM", 16, 0 },
+    { 15017, 15024, 15034, 12631, "CM", 16, 0 },
+    { 15057, 15064, 15074, 12631, "CM", 16, 0 },
+    { 15102, 15109, 15119, 12631, "CM", 16, 0 },
+    { 15155, 15160, 15166, 12631, "CM", 16, 0 },
+    { 15196, 15203, 15213, 12631, "CM", 16, 0 },
+    { 15242, 15248, 15254, 12631, "CM", 16, 0 },
+    { 15282, 15290, 15300, 12631, "CM", 16, 0 },
+    { 15321, 15327, 15333, 12631, "CM", 16, 0 },
+    { 15357, 15365, 15375, 12631, "CM", 16, 0 },
+    { 15413, 15421, 15431, 12631, "CM", 16, 0 },
+    { 15476, 15484, 15494, 12631, "CM", 16, 0 },
+    { 15531, 15537, 15543, 12631, "CM", 16, 0 },
+    { 15564, 15572, 15582, 12631, "CM", 16, 0 },
+    { 15630, 15636, 15642, 12631, "CM", 16, 0 },
+    { 15662, 15668, 13705, 12631, "CM", 16, 0 },
+    { 15674, 15679, 11, 15685, "CP", 16, 0 },
+    { 15706, 15711, 15717, 15685, "CP", 16, 0 },
+    { 15734, 15741, 15751, 15685, "CP", 16, 0 },
+    { 15781, 15788, 15798, 15685, "CP", 16, 0 },
+    { 15816, 15823, 15833, 15685, "CP", 16, 0 },
+    { 15871, 15878, 15888, 15685, "CP", 16, 0 },
+    { 15930, 15937, 15947, 15685, "CP", 16, 0 },
+    { 15987, 15994, 16004, 15685, "CP", 16, 0 },
+    { 16043, 16050, 16060, 15685, "CP", 16, 0 },
+    { 16103, 16110, 16120, 15685, "CP", 16, 0 },
+    { 16145, 16150, 16156, 15685, "CP", 16, 0 },
+    { 16177, 16184, 16194, 15685, "CP", 16, 0 },
+    { 16211, 16218, 16228, 15685, "CP", 16, 0 },
+    { 16269, 16274, 16280, 15685, "CP", 16, 0 },
+    { 16305, 16312, 15751, 15685, "CP", 16, 0 },
+    { 16322, 16329, 16339, 15685, "CP", 16, 0 },
+    { 16365, 16372, 16382, 15685, "CP", 16, 0 },
+    { 16400, 16407, 16417, 15685, "CP", 16, 0 },
+    { 16450, 16457, 16467, 15685, "CP", 16, 0 },
+    { 16482, 16487, 16493, 15685, "CP", 16, 0 },
+    { 16517, 16522, 16528, 15685, "CP", 16, 0 },
+    { 16551, 16558, 16568, 15685, "CP", 16, 0 },
+    { 16597, 16604, 16614, 15685, "CP", 16, 0 },
+    { 16658, 16665, 16675, 15685, "CP", 16, 0 },
+    { 16689, 16694, 16339, 15685, "CP", 16, 0 },
+    { 16700, 16707, 16568, 15685, "CP", 16, 0 },
+    { 16717, 16724, 16675, 15685, "CP", 16, 0 },
+    { 16734, 16741, 16751, 15685, "CP", 16, 0 },
+    { 16771, 16778, 16788, 15685, "CP", 16, 0 },
+    { 16808, 16815, 16825, 15685, "CP", 16, 0 },
+    { 16868, 16875, 16885, 15685, "CP", 16, 0 },
+    { 16921, 16926, 16932, 15685, "CP", 16, 0 },
+    { 16960, 16967, 16977, 15685, "CP", 16, 0 },
+    { 17008, 17015, 17025, 15685, "CP", 16, 0 },
+    { 17050, 17057, 17067, 15685, "CP", 16, 0 },
+    { 17113, 17120, 17130, 15685, "CP", 16, 0 },
+    { 17156, 17163, 17173, 15685, "CP", 16, 0 },
+    { 17217, 17222, 17228, 15685, "CP", 16, 0 },
+    { 17242, 17249, 17259, 15685, "CP", 16, 0 },
+    { 17297, 17304, 17314, 15685, "CP", 16, 0 },
+    { 17346, 17353, 17363, 15685, "CP", 16, 0 },
+    { 17405, 17412, 17422, 15685, "CP", 16, 0 },
+    { 17464, 17471, 17481, 15685, "CP", 16, 0 },
+    { 17516, 17523, 17533, 15685, "CP", 16, 0 },
+    { 17560, 17567, 17577, 15685, "CP", 16, 0 },
+    { 17624, 17631, 9803, 15685, "CP", 16, 0 },
+    { 17641, 17647, 17653, 15685, "CP", 16, 0 },
+    { 17688, 17696, 16280, 15685, "CP", 16, 0 },
+    { 17706, 17714, 17724, 15685, "CP", 16, 0 },
+    { 17745, 17753, 17763, 15685, "CP", 16, 0 },
+    { 17794, 17802, 17812, 15685, "CP", 16, 0 },
+    { 17839, 17847, 17857, 15685, "CP", 16, 0 },
+    { 17877, 17885, 17895, 15685, "CP", 16, 0 },
+    { 17916, 17922, 17928, 15685, "CP", 16, 0 },
+    { 17963, 17969, 17975, 15685, "CP", 16, 0 },
+    { 17985, 17991, 17997, 15685, "CP", 16, 0 },
+    { 18029, 18034, 11, 18040, "IA", 16, 0 },
+    { 18074, 18079, 18085, 18040, "IA", 16, 0 },
+    { 18142, 18149, 18159, 18040, "IA", 16, 0 },
+    { 18210, 18217, 18227, 18040, "IA", 16, 0 },
+    { 18282, 18289, 18299, 18040, "IA", 16, 0 },
+    { 18335, 18342, 18352, 18040, "IA", 16, 0 },
+    { 18392, 18399, 18409, 18040, "IA", 16, 0 },
+    { 18461, 18468, 18478, 18040, "IA", 16, 0 },
+    { 18516, 18523, 18533, 18040, "IA", 16, 0 },
+    { 18595, 18602, 18612, 18040, "IA", 16, 0 },
+    { 18652, 18659, 18669, 18040, "IA", 16, 0 },
+    { 18732, 18740, 18750, 18040, "IA", 16, 0 },
+    { 18765, 18773, 18783, 18040, "IA", 16, 0 },
+    { 18817, 18825, 18835, 18040, "IA", 16, 0 },
+    { 18865, 18873, 18883, 18040, "IA", 16, 0 },
+    { 18910, 18915, 18921, 18040, "IA", 16, 0 },
+    { 18962, 18969, 18979, 18040, "IA", 16, 0 },
+    { 19022, 19029, 19039, 18040, "IA", 16, 0 },
+    { 19090, 19097, 19107, 18040, "IA", 16, 0 },
+    { 19134, 19141, 19151, 18040, "IA", 16, 0 },
+    { 19170, 19175, 19181, 18040, "IA", 16, 0 },
+    { 19203, 19210, 19220, 18040, "IA", 16, 0 },
+    { 19271, 19278, 19288, 18040, "IA", 16, 0 },
+    { 19313, 19320, 19330, 18040, "IA", 16, 0 },
+    { 19362, 19369, 19379, 18040, "IA", 16, 0 },
+    { 19400, 19407, 19417, 18040, "IA", 16, 0 },
+    { 19436, 19443, 19453, 18040, "IA", 16, 0 },
+    { 19483, 19490, 19500, 18040, "IA", 16, 0 },
+    { 19523, 19530, 19540, 18040, "IA", 16, 0 },
+    { 19574, 19581, 19591, 18040, "IA", 16, 0 },
+    { 19628, 19633, 19639, 18040, "IA", 16, 0 },
+    { 19664, 19671, 19681, 18040, "IA", 16, 0 },
+    { 19711, 19718, 19728, 18040, "IA", 16, 0 },
+    { 19760, 19767, 19777, 18040, "IA", 16, 0 },
+    { 19826, 19833, 19843, 18040, "IA", 16, 0 },
+    { 19897, 19904, 19914, 18040, "IA", 16, 0 },
+    { 19954, 19961, 19971, 18040, "IA", 16, 0 },
+    { 20000, 20007, 20017, 18040, "IA", 16, 0 },
+    { 20063, 20070, 20080, 18040, "IA", 16, 0 },
+    { 20105, 20112, 20122, 18040, "IA", 16, 0 },
+    { 20154, 20162, 20172, 18040, "IA", 16, 0 },
+    { 20199, 20207, 20217, 18040, "IA", 16, 0 },
+    { 20253, 20261, 20271, 18040, "IA", 16, 0 },
+    { 20308, 20316, 20326, 18040, "IA", 16, 0 },
+    { 20362, 20370, 20380, 18040, "IA", 16, 0 },
+    { 20417, 20425, 20435, 18040, "IA", 16, 0 },
+    { 20470, 20478, 20488, 18040, "IA", 16, 0 },
+    { 20547, 20555, 20565, 18040, "IA", 16, 0 },
+    { 20624, 20632, 20642, 18040, "IA", 16, 0 },
+    { 20660, 20665, 20671, 18040, "IA", 16, 0 },
+    { 20695, 20700, 20706, 18040, "IA", 16, 0 },
+    { 20742, 20747, 20753, 18040, "IA", 16, 0 },
+    { 20814, 20821, 20831, 18040, "IA", 16, 0 },
+    { 20881, 20888, 20898, 18040, "IA", 16, 0 },
+    { 20936, 20943, 20953, 18040, "IA", 16, 0 },
+    { 20984, 20991, 21001, 18040, "IA", 16, 0 },
+    { 21025, 21032, 21042, 18040, "IA", 16, 0 },
+    { 21074, 21081, 11143, 18040, "IA", 16, 0 },
+    { 21091, 21096, 21102, 18040, "IA", 16, 0 },
+    { 21144, 21151, 11399, 18040, "IA", 16, 0 },
+    { 21161, 21168, 21178, 18040, "IA", 16, 0 },
+    { 21204, 21210, 21216, 18040, "IA", 16, 0 },
+    { 21240, 21246, 21252, 18040, "IA", 16, 0 },
+    { 21270, 21276, 21282, 18040, "IA", 16, 0 },
+    { 21300, 21308, 19288, 18040, "IA", 16, 0 },
+    { 21318, 21326, 21336, 18040, "IA", 16, 0 },
+    { 21354, 21362, 21372, 18040, "IA", 16, 0 },
+    { 21418, 21426, 21436, 18040, "IA", 16, 0 },
+    { 21474, 21482, 21492, 18040, "IA", 16, 0 },
+    { 21513, 21521, 21531, 18040, "IA", 16, 0 },
+    { 21568, 21574, 21580, 18040, "IA", 16, 0 },
+    { 21625, 21633, 21643, 18040, "IA", 16, 0 },
+    { 21676, 21684, 21694, 18040, "IA", 16, 0 },
+    { 21748, 21756, 21766, 18040, "IA", 16, 0 },
+    { 21783, 21788, 11, 21794, "IR", 16, 0 },
+    { 21812, 21817, 21823, 21794, "IR", 16, 0 },
+    { 21850, 21857, 16194, 21794, "IR", 16, 0 },
+    { 21867, 21874, 21884, 21794, "IR", 16, 0 },
+    { 21916, 21923, 21933, 21794, "IR", 16, 0 },
+    { 21940, 21945, 21951, 21794, "IR", 16, 0 },
+    { 21977, 21984, 16382, 21794, "IR", 16, 0 },
+    { 21994, 22001, 22011, 21794, "IR", 16, 0 },
+    { 22043, 22050, 22060, 21794, "IR", 16, 0 },
+    { 22083, 22088, 22094, 21794, "IR", 16, 0 },
+    { 22112, 22119, 22129, 21794, "IR", 16, 0 },
+    { 22167, 22174, 22184, 21794, "IR", 16, 0 },
+    { 22208, 22215, 22225, 21794, "IR", 16, 0 },
+    { 22250, 22257, 22267, 21794, "IR", 16, 0 },
+    { 22291, 22298, 22308, 21794, "IR", 16, 0 },
+    { 22338, 22345, 22355, 21794, "IR", 16, 0 },
+    { 22371, 22378, 22388, 21794, "IR", 16, 0 },
+    { 22440, 22447, 22457, 21794, "IR", 16, 0 },
+    { 22497, 22504, 22514, 21794, "IR", 16, 0 },
+    { 22542, 22550, 22560, 21794, "IR", 16, 0 },
+    { 22586, 22594, 22604, 21794, "IR", 16, 0 },
+    { 22638, 22646, 22656, 21794, "IR", 16, 0 },
+    { 22693, 22701, 22711, 21794, "IR", 16, 0 },
+    { 22729, 22737, 22747, 21794, "IR", 16, 0 },
+    { 22774, 22782, 22792, 21794, "IR", 16, 0 },
+    { 22831, 22836, 22842, 21794, "IR", 16, 0 },
+    { 22862, 22869, 22879, 21794, "IR", 16, 0 },
+    { 22929, 22934, 22940, 21794, "IR", 16, 0 },
+    { 22959, 22966, 22976, 21794, "IR", 16, 0 },
+    { 22996, 23003, 23013, 21794, "IR", 16, 0 },
+    { 23050, 23057, 22560, 21794, "IR", 16, 0 },
+    { 23067, 23072, 23078, 21794, "IR", 16, 0 },
+    { 23107, 23114, 23124, 21794, "IR", 16, 0 },
+    { 23187, 23194, 23204, 21794, "IR", 16, 0 },
+    { 23241, 23246, 23252, 21794, "IR", 16, 0 },
+    { 23275, 23282, 23292, 21794, "IR", 16, 0 },
+    { 23301, 23306, 23312, 21794, "IR", 16, 0 },
+    { 23342, 23349, 23359, 21794, "IR", 16, 0 },
+    { 23381, 23388, 23398, 21794, "IR", 16, 0 },
+    { 23407, 23414, 23424, 21794, "IR", 16, 0 },
+    { 23446, 23453, 23463, 21794, "IR", 16, 0 },
+    { 23498, 23504, 23510, 21794, "IR", 16, 0 },
+    { 23556, 23561, 11, 23567, "MA", 16, 0 },
+    { 23579, 23584, 23590, 23567, "MA", 16, 0 },
+    { 23613, 23620, 23630, 23567, "MA", 16, 0 },
+    { 23645, 23652, 23662, 23567, "MA", 16, 0 },
+    { 23695, 23700, 23706, 23567, "MA", 16, 0 },
+    { 23724, 23731, 23741, 23567, "MA", 16, 0 },
+    { 23755, 23762, 23772, 23567, "MA", 16, 0 },
+    { 23786, 23793, 23803, 23567, "MA", 16, 0 },
+    { 23832, 23839, 23849, 23567, "MA", 16, 0 },
+    { 23869, 23876, 23886, 23567, "MA", 16, 0 },
+    { 23911, 23918, 23928, 23567, "MA", 16, 0 },
+    { 23957, 23962, 23968, 23567, "MA", 16, 0 },
+    { 23989, 23996, 24006, 23567, "MA", 16, 0 },
+    { 24025, 24032, 24042, 23567, "MA", 16, 0 },
+    { 24072, 24079, 24089, 23567, "MA", 16, 0 },
+    { 24126, 24133, 24143, 23567, "MA", 16, 0 },
+    { 24197, 24204, 24214, 23567, "MA", 16, 0 },
+    { 24242, 24249, 9803, 23567, "MA", 16, 0 },
+    { 24259, 24266, 24276, 23567, "MA", 16, 0 },
+    { 24300, 24305, 24311, 23567, "MA", 16, 0 },
+    { 24333, 24340, 24350, 23567, "MA", 16, 0 },
+    { 24389, 24396, 24406, 23567, "MA", 16, 0 },
+    { 24449, 24456, 24466, 23567, "MA", 16, 0 },
+    { 24514, 24521, 24531, 23567, "MA", 16, 0 },
+    { 24549, 24556, 24566, 23567, "MA", 16, 0 },
+    { 24589, 24594, 24600, 23567, "MA", 16, 0 },
+    { 24619, 24626, 24636, 23567, "MA", 16, 0 },
+    { 24659, 24666, 24676, 23567, "MA", 16, 0 },
+    { 24699, 24706, 24716, 23567, "MA", 16, 0 },
+    { 24761, 24766, 24772, 23567, "MA", 16, 0 },
+    { 24790, 24795, 11, 24801, "MP", 16, 0 },
+    { 24818, 24823, 24829, 24801, "MP", 16, 0 },
+    { 24842, 24849, 24859, 24801, "MP", 16, 0 },
+    { 24887, 24894, 9803, 24801, "MP", 16, 0 },
+    { 24904, 24909, 24915, 24801, "MP", 16, 0 },
+    { 24929, 24934, 24940, 24801, "MP", 16, 0 },
+    { 24954, 24961, 9803, 24801, "MP", 16, 0 },
+    { 24971, 24978, 24859, 24801, "MP", 16, 0 },
+    { 24988, 24993, 24999, 24801, "MP", 16, 0 },
+    { 25015, 25022, 25032, 24801, "MP", 16, 0 },
+    { 25071, 25078, 25088, 24801, "MP", 16, 0 },
+    { 25116, 25123, 25133, 24801, "MP", 16, 0 },
+    { 25144, 25151, 9803, 24801, "MP", 16, 0 },
+    { 25161, 25166, 25172, 24801, "MP", 16, 0 },
+    { 25191, 25198, 25208, 24801, "MP", 16, 0 },
+    { 25253, 25260, 25270, 24801, "MP", 16, 0 },
+    { 25288, 25295, 25305, 24801, "MP", 16, 0 },
+    { 25331, 25338, 25348, 24801, "MP", 16, 0 },
+    { 25384, 25391, 25401, 24801, "MP", 16, 0 },
+    { 25424, 25431, 25441, 24801, "MP", 16, 0 },
+    { 25459, 25466, 828, 24801, "MP", 16, 0 },
+    { 25476, 25483, 25493, 24801, "MP", 16, 0 },
+    { 25533, 25538, 25544, 24801, "MP", 16, 0 },
+    { 25554, 25561, 25571, 24801, "MP", 16, 0 },
+    { 25598, 25605, 25615, 24801, "MP", 16, 0 },
+    { 25660, 25665, 25671, 24801, "MP", 16, 0 },
+    { 25689, 25696, 25706, 24801, "MP", 16, 0 },
+    { 25731, 25738, 25270, 24801, "MP", 16, 0 },
+    { 25748, 25755, 25348, 24801, "MP", 16, 0 },
+    { 25765, 25772, 25401, 24801, "MP", 16, 0 },
+    { 25782, 25787, 11, 25793, "PE", 16, 0 },
+    { 25831, 25836, 25842, 25793, "PE", 16, 0 },
+    { 25873, 25880, 25890, 25793, "PE", 16, 0 },
+    { 25917, 25924, 25934, 25793, "PE", 16, 0 },
+    { 25962, 25969, 25979, 25793, "PE", 16, 0 },
+    { 26006, 26011, 26017, 25793, "PE", 16, 0 },
+    { 26041, 26048, 26058, 25793, "PE", 16, 0 },
+    { 26072, 26079, 26089, 25793, "PE", 16, 0 },
+    { 26110, 26117, 26127, 25793, "PE", 16, 0 },
+    { 26145, 26152, 26162, 25793, "PE", 16, 0 },
+    { 26179, 26186, 26196, 25793, "PE", 16, 0 },
+    { 26214, 26221, 12517, 25793, "PE", 16, 0 },
+    { 26231, 26238, 26248, 25793, "PE", 16, 0 },
+    { 26266, 26273, 26283, 25793, "PE", 16, 0 },
+    { 26309, 26314, 26320, 25793, "PE", 16, 0 },
+    { 26352, 26357, 26363, 25793, "PE", 16, 0 },
+    { 26397, 26404, 26414, 25793, "PE", 16, 0 },
+    { 26457, 26464, 26474, 25793, "PE", 16, 0 },
+    { 26502, 26509, 26519, 25793, "PE", 16, 0 },
+    { 26542, 26547, 26553, 25793, "PE", 16, 0 },
+    { 26580, 26587, 26597, 25793, "PE", 16, 0 },
+    { 26641, 26648, 26658, 25793, "PE", 16, 0 },
+    { 26704, 26711, 26721, 25793, "PE", 16, 0 },
+    { 26740, 26747, 26757, 25793, "PE", 16, 0 },
+    { 26795, 26800, 26806, 25793, "PE", 16, 0 },
+    { 26822, 26827, 26833, 25793, "PE", 16, 0 },
+    { 26856, 26863, 26873, 25793, "PE", 16, 0 },
+    { 26914, 26921, 26931, 25793, "PE", 16, 0 },
+    { 26955, 26962, 8387, 25793, "PE", 16, 0 },
+    { 26972, 26977, 26983, 25793, "PE", 16, 0 },
+    { 27011, 27018, 27028, 25793, "PE", 16, 0 },
+    { 27046, 27053, 27063, 25793, "PE", 16, 0 },
+    { 27090, 27096, 27102, 25793, "PE", 16, 0 },
+    { 27120, 27128, 27138, 25793, "PE", 16, 0 },
+    { 27177, 27183, 27189, 25793, "PE", 16, 0 },
+    { 27205, 27213, 27223, 25793, "PE", 16, 0 },
+    { 27281, 27289, 27299, 25793, "PE", 16, 0 },
+    { 27341, 27347, 27353, 25793, "PE", 16, 0 },
+    { 27372, 27380, 27390, 25793, "PE", 16, 0 },
+    { 27431, 27437, 27443, 25793, "PE", 16, 0 },
+    { 27459, 27467, 27477, 25793, "PE", 16, 0 },
+    { 27537, 27545, 27555, 25793, "PE", 16, 0 },
+    { 27617, 27625, 27635, 25793, "PE", 16, 0 },
+    { 27662, 27670, 27680, 25793, "PE", 16, 0 },
+    { 27692, 27698, 7676, 25793, "PE", 16, 0 },
+    { 27704, 27712, 27722, 25793, "PE", 16, 0 },
+    { 27741, 27749, 27759, 25793, "PE", 16, 0 },
+    { 27800, 27806, 27812, 25793, "PE", 16, 0 },
+    { 27836, 27844, 27854, 25793, "PE", 16, 0 },
+    { 27873, 27879, 27885, 25793, "PE", 16, 0 },
+    { 27906, 27912, 27918, 25793, "PE", 16, 0 },
+    { 27938, 27944, 27950, 25793, "PE", 16, 0 },
+    { 27980, 27988, 27998, 25793, "PE", 16, 0 },
+    { 28012, 28018, 28024, 25793, "PE", 16, 0 },
+    { 28044, 28052, 28062, 25793, "PE", 16, 0 },
+    { 28105, 28111, 28117, 25793, "PE", 16, 0 },
+    { 28147, 28153, 28159, 25793, "PE", 16, 0 },
+    { 28192, 28198, 28204, 25793, "PE", 16, 0 },
+    { 28222, 28228, 28234, 25793, "PE", 16, 0 },
+    { 28252, 28257, 11, 28263, "PL", 16, 0 },
+    { 28272, 28277, 28283, 28263, "PL", 16, 0 },
+    { 28317, 28324, 28334, 28263, "PL", 16, 0 },
+    { 28356, 28363, 28373, 28263, "PL", 16, 0 },
+    { 28397, 28404, 28414, 28263, "PL", 16, 0 },
+    { 28469, 28474, 28480, 28263, "PL", 16, 0 },
+    { 28508, 28513, 28519, 28263, "PL", 16, 0 },
+    { 28537, 28544, 28554, 28263, "PL", 16, 0 },
+    { 28616, 28621, 28627, 28263, "PL", 16, 0 },
+    { 28653, 28658, 28664, 28263, "PL", 16, 0 },
+    { 28699, 28704, 28334, 28263, "PL", 16, 0 },
+    { 28710, 28715, 28721, 28263, "PL", 16, 0 },
+    { 28756, 28763, 28773, 28263, "PL", 16, 0 },
+    { 28790, 28797, 28807, 28263, "PL", 16, 0 },
+    { 28826, 28831, 28837, 28263, "PL", 16, 0 },
+    { 28856, 28862, 28868, 28263, "PL", 16, 0 },
+    { 28887, 28893, 28899, 28263, "PL", 16, 0 },
+    { 28918, 28923, 28929, 28963, "PM", 16, 0 },
+    { 28982, 28987, 28993, 28963, "PM", 16, 0 },
+    { 29038, 29043, 29049, 28963, "PM", 16, 0 },
+    { 29092, 29097, 29103, 28963, "PM", 16, 0 },
+    { 29141, 29146, 29152, 28963, "PM", 16, 0 },
+    { 29169, 29176, 29186, 28963, "PM", 16, 0 },
+    { 29235, 29240, 29246, 28963, "PM", 16, 0 },
+    { 29270, 29275, 29281, 28963, "PM", 16, 0 },
+    { 29305, 29312, 29322, 28963, "PM", 16, 0 },
+    { 29333, 29338, 29344, 28963, "PM", 16, 0 },
+    { 29373, 29378, 29384, 28963, "PM", 16, 0 },
+    { 29409, 29415, 29421, 28963, "PM", 16, 0 },
+    { 29443, 29449, 29455, 28963, "PM", 16, 0 },
+    { 29495, 29501, 29507, 28963, "PM", 16, 0 },
+    { 29530, 29536, 29542, 28963, "PM", 16, 0 },
+    { 29573, 29579, 29585, 28963, "PM", 16, 0 },
+    { 29619, 29625, 29631, 28963, "PM", 16, 0 },
+    { 29676, 29682, 29688, 28963, "PM", 16, 0 },
+    { 29713, 29721, 29731, 28963, "PM", 16, 0 },
+    { 29779, 29785, 29791, 28963, "PM", 16, 0 },
+    { 29858, 29864, 29870, 28963, "PM", 16, 0 },
+    { 29891, 29897, 29903, 28963, "PM", 16, 0 },
+    { 29935, 29941, 29947, 28963, "PM", 16, 0 },
+    { 29992, 30000, 30010, 28963, "PM", 16, 0 },
+    { 30075, 30081, 30087, 28963, "PM", 16, 0 },
+    { 30113, 30119, 30125, 28963, "PM", 16, 0 },
+    { 30180, 30186, 30192, 28963, "PM", 16, 0 },
+    { 30213, 30219, 30225, 28963, "PM", 16, 0 },
+    { 30246, 30252, 30258, 28963, "PM", 16, 0 },
+    { 30350, 30356, 30362, 28963, "PM", 16, 0 },
+    { 30383, 30389, 30395, 28963, "PM", 16, 0 },
+    { 30413, 30419, 30425, 28963, "PM", 16, 0 },
+    { 30438, 30444, 30450, 28963, "PM", 16, 0 },
+    { 30491, 30497, 30503, 28963, "PM", 16, 0 },
+    { 30541, 30549, 30559, 28963, "PM", 16, 0 },
+    { 30608, 30614, 30620, 28963, "PM", 16, 0 },
+    { 30651, 30657, 30663, 28963, "PM", 16, 0 },
+    { 30673, 30678, 11, 30684, "PS", 16, 0 },
+    { 30703, 30708, 30714, 30684, "PS", 16, 0 },
+    { 30740, 30745, 30751, 30684, "PS", 16, 0 },
+    { 30771, 30778, 25401, 30684, "PS", 16, 0 },
+    { 30788, 30795, 30805, 30684, "PS", 16, 0 },
+    { 30827, 30834, 30844, 30684, "PS", 16, 0 },
+    { 30894, 30901, 30911, 30684, "PS", 16, 0 },
+    { 30936, 30941, 30947, 30684, "PS", 16, 0 },
+    { 30969, 30976, 30986, 30684, "PS", 16, 0 },
+    { 31015, 31022, 31032, 30684, "PS", 16, 0 },
+    { 31050, 31055, 31061, 30684, "PS", 16, 0 },
+    { 31080, 31085, 31091, 30684, "PS", 16, 0 },
+    { 31109, 31116, 31126, 30684, "PS", 16, 0 },
+    { 31167, 31174, 31184, 30684, "PS", 16, 0 },
+    { 31236, 31243, 30986, 30684, "PS", 16, 0 },
+    { 31253, 31258, 31264, 30684, "PS", 16, 0 },
+    { 31292, 31297, 31303, 30684, "PS", 16, 0 },
+    { 31323, 31328, 31334, 30684, "PS", 16, 0 },
+    { 31356, 31361, 11, 31367, "PT", 16, 0 },
+    { 31431, 31436, 31442, 31367, "PT", 16, 0 },
+    { 31499, 31506, 31516, 31367, "PT", 16, 0 },
+    { 31529, 31536, 31546, 31367, "PT", 16, 0 },
+    { 31557, 31562, 31568, 31367, "PT", 16, 0 },
+    { 31624, 31631, 31516, 31367, "PT", 16, 0 },
+    { 31641, 31648, 31546, 31367, "PT", 16, 0 },
+    { 31658, 31663, 31669, 31367, "PT", 16, 0 },
+    { 31677, 31684, 31694, 31367, "PT", 16, 0 },
+    { 31711, 31718, 31728, 31367, "PT", 16, 0 },
+    { 31749, 31756, 31766, 31367, "PT", 16, 0 },
+    { 31777, 31782, 31788, 31367, "PT", 16, 0 },
+    { 31803, 31810, 31820, 31367, "PT", 16, 0 },
+    { 31840, 31847, 31857, 31367, "PT", 16, 0 },
+    { 31880, 31885, 31891, 31367, "PT", 16, 0 },
+    { 31916, 31923, 31933, 31367, "PT", 16, 0 },
+    { 31946, 31953, 31963, 31367, "PT", 16, 0 },
+    { 31979, 31984, 31990, 31367, "PT", 16, 0 },
+    { 32049, 32056, 32066, 31367, "PT", 16, 0 },
+    { 32090, 32097, 32107, 31367, "PT", 16, 0 },
+    { 32135, 32140, 32146, 31367, "PT", 16, 0 },
+    { 32177, 32182, 11, 32188, "RA", 16, 0 },
+    { 32204, 32209, 32215, 32188, "RA", 16, 0 },
+    { 32239, 32246, 32256, 32188, "RA", 16, 0 },
+    { 32284, 32289, 32188, 32188, "RA", 16, 0 },
+    { 32295, 32302, 32312, 32188, "RA", 16, 0 },
+    { 32341, 32348, 32358, 32188, "RA", 16, 0 },
+    { 32389, 32396, 32406, 32188, "RA", 16, 0 },
+    { 32431, 32438, 32448, 32188, "RA", 16, 0 },
+    { 32475, 32480, 32486, 32188, "RA", 16, 0 },
+    { 32509, 32514, 32520, 32188, "RA", 16, 0 },
+    { 32558, 32565, 32575, 32188, "RA", 16, 0 },
+    { 32598, 32605, 32615, 32188, "RA", 16, 0 },
+    { 32652, 32659, 32669, 32188, "RA", 16, 0 },
+    { 32699, 32706, 32716, 32188, "RA", 16, 0 },
+    { 32741, 32748, 32758, 32188, "RA", 16, 0 },
+    { 32776, 32783, 32793, 32188, "RA", 16, 0 },
+    { 32818, 32825, 32835, 32188, "RA", 16, 0 },
+    { 32899, 32906, 32916, 32188, "RA", 16, 0 },
+    { 32943, 32950, 32960, 32188, "RA", 16, 0 },
+    { 32993, 33001, 33011, 32188, "RA", 16, 0 },
+    { 33042, 33050, 33060, 32188, "RA", 16, 0 },
+    { 33086, 33091, 33097, 32188, "RA", 16, 0 },
+    { 33143, 33148, 33154, 32188, "RA", 16, 0 },
+    { 33168, 33173, 33179, 32188, "RA", 16, 0 },
+    { 33206, 33211, 33217, 32188, "RA", 16, 0 },
+    { 33238, 33244, 33250, 32188, "RA", 16, 0 },
+    { 33265, 33270, 11, 33276, "SA", 16, 0 },
+    { 33308, 33313, 33319, 33276, "SA", 16, 0 },
+    { 33343, 33348, 33354, 33276, "SA", 16, 0 },
+    { 33384, 33391, 33401, 33276, "SA", 16, 0 },
+    { 33434, 33441, 33451, 33276, "SA", 16, 0 },
+    { 33483, 33490, 33500, 33276, "SA", 16, 0 },
+    { 33519, 33524, 33530, 33276, "SA", 16, 0 },
+    { 33550, 33557, 33567, 33276, "SA", 16, 0 },
+    { 33601, 33608, 33618, 33276, "SA", 16, 0 },
+    { 33669, 33676, 33686, 33276, "SA", 16, 0 },
+    { 33733, 33740, 15119, 33276, "SA", 16, 0 },
+    { 33750, 33757, 33767, 33276, "SA", 16, 0 },
+    { 33813, 33820, 33830, 33276, "SA", 16, 0 },
+    { 33868, 33875, 33885, 33276, "SA", 16, 0 },
+    { 33920, 33927, 33937, 33276, "SA", 16, 0 },
+    { 33977, 33984, 33994, 33276, "SA", 16, 0 },
+    { 34043, 34051, 34061, 33276, "SA", 16, 0 },
+    { 34090, 34098, 34108, 33276, "SA", 16, 0 },
+    { 34126, 34134, 34144, 33276, "SA", 16, 0 },
+    { 34159, 34164, 34170, 33276, "SA", 16, 0 },
+    { 34191, 34198, 34208, 33276, "SA", 16, 0 },
+    { 34251, 34258, 34268, 33276, "SA", 16, 0 },
+    { 34313, 34320, 34330, 33276, "SA", 16, 0 },
+    { 34348, 34355, 34365, 33276, "SA", 16, 0 },
+    { 34382, 34389, 34399, 33276, "SA", 16, 0 },
+    { 34411, 34416, 15254, 33276, "SA", 16, 0 },
+    { 34422, 34427, 15333, 33276, "SA", 16, 0 },
+    { 34433, 34438, 34444, 33276, "SA", 16, 0 },
+    { 34488, 34495, 34505, 33276, "SA", 16, 0 },
+    { 34524, 34531, 34541, 33276, "SA", 16, 0 },
+    { 34564, 34571, 34581, 33276, "SA", 16, 0 },
+    { 34605, 34612, 34622, 33276, "SA", 16, 0 },
+    { 34653, 34660, 34670, 33276, "SA", 16, 0 },
+    { 34698, 34705, 34715, 33276, "SA", 16, 0 },
+    { 34733, 34740, 34750, 33276, "SA", 16, 0 },
+    { 34769, 34776, 34786, 33276, "SA", 16, 0 },
+    { 34806, 34813, 34823, 33276, "SA", 16, 0 },
+    { 34842, 34850, 34860, 33276, "SA", 16, 0 },
+    { 34879, 34887, 34897, 33276, "SA", 16, 0 },
+    { 34928, 34936, 34946, 33276, "SA", 16, 0 },
+    { 34970, 34978, 34988, 33276, "SA", 16, 0 },
+    { 35016, 35024, 3172, 33276, "SA", 16, 0 },
+    { 35034, 35042, 35052, 33276, "SA", 16, 0 },
+    { 35073, 35081, 35091, 33276, "SA", 16, 0 },
+    { 35120, 35128, 35138, 33276, "SA", 16, 0 },
+    { 35169, 35177, 35187, 33276, "SA", 16, 0 },
+    { 35219, 35227, 35237, 33276, "SA", 16, 0 },
+    { 35259, 35267, 35277, 33276, "SA", 16, 0 },
+    { 35304, 35312, 35322, 33276, "SA", 16, 0 },
+    { 35336, 35344, 35354, 33276, "SA", 16, 0 },
+    { 35386, 35394, 35404, 33276, "SA", 16, 0 },
+    { 35420, 35428, 35438, 33276, "SA", 16, 0 },
+    { 35466, 35474, 35484, 33276, "SA", 16, 0 },
+    { 35502, 35510, 35520, 33276, "SA", 16, 0 },
+    { 35541, 35549, 35559, 33276, "SA", 16, 0 },
+    { 35583, 35591, 35601, 33276, "SA", 16, 0 },
+    { 35621, 35629, 35639, 33276, "SA", 16, 0 },
+    { 35676, 35684, 35694, 33276, "SA", 16, 0 },
+    { 35711, 35719, 35729, 33276, "SA", 16, 0 },
+    { 35756, 35764, 35774, 33276, "SA", 16, 0 },
+    { 35799, 35807, 35817, 33276, "SA", 16, 0 },
+    { 35830, 35835, 35841, 33276, "SA", 16, 0 },
+    { 35866, 35873, 35883, 33276, "SA", 16, 0 },
+    { 35929, 35936, 35946, 33276, "SA", 16, 0 },
+    { 36006, 36013, 36023, 33276, "SA", 16, 0 },
+    { 36080, 36087, 36097, 33276, "SA", 16, 0 },
+    { 36145, 36152, 36162, 33276, "SA", 16, 0 },
+    { 36204, 36211, 36221, 33276, "SA", 16, 0 },
+    { 36264, 36271, 36281, 33276, "SA", 16, 0 },
+    { 36324, 36331, 36341, 33276, "SA", 16, 0 },
+    { 36395, 36401, 36407, 33276, "SA", 16, 0 },
+    { 36442, 36450, 36460, 33276, "SA", 16, 0 },
+    { 36505, 36513, 36523, 33276, "SA", 16, 0 },
+    { 36570, 36578, 36588, 33276, "SA", 16, 0 },
+    { 36620, 36628, 36638, 33276, "SA", 16, 0 },
+    { 36657, 36665, 36675, 33276, "SA", 16, 0 },
+    { 36713, 36721, 36731, 33276, "SA", 16, 0 },
+    { 36752, 36760, 13231, 33276, "SA", 16, 0 },
+    { 36770, 36776, 36782, 33276, "SA", 16, 0 },
+    { 36815, 36823, 36833, 33276, "SA", 16, 0 },
+    { 36854, 36862, 36872, 33276, "SA", 16, 0 },
+    { 36915, 36923, 36933, 33276, "SA", 16, 0 },
+    { 36991, 36999, 37009, 33276, "SA", 16, 0 },
+    { 37029, 37037, 12381, 33276, "SA", 16, 0 },
+    { 37047, 37055, 37065, 33276, "SA", 16, 0 },
+    { 37088, 37096, 37106, 33276, "SA", 16, 0 },
+    { 37145, 37153, 37163, 33276, "SA", 16, 0 },
+    { 37185, 37193, 37203, 33276, "SA", 16, 0 },
+    { 37244, 37250, 37256, 33276, "SA", 16, 0 },
+    { 37280, 37288, 37298, 33276, "SA", 16, 0 },
+    { 37339, 37347, 37357, 33276, "SA", 16, 0 },
+    { 37374, 37382, 37392, 33276, "SA", 16, 0 },
+    { 37425, 37433, 37443, 33276, "SA", 16, 0 },
+    { 37466, 37474, 37484, 33276, "SA", 16, 0 },
+    { 37503, 37511, 37521, 33276, "SA", 16, 0 },
+    { 37549, 37557, 37567, 33276, "SA", 16, 0 },
+    { 37620, 37628, 32358, 33276, "SA", 16, 0 },
+    { 37638, 37646, 37656, 33276, "SA", 16, 0 },
+    { 37676, 37685, 37695, 33276, "SA", 16, 0 },
+    { 37731, 37740, 37750, 33276, "SA", 16, 0 },
+    { 37816, 37825, 37835, 33276, "SA", 16, 0 },
+    { 37867, 37876, 37886, 33276, "SA", 16, 0 },
+    { 37925, 37934, 37944, 33276, "SA", 16, 0 },
+    { 37970, 37979, 37989, 33276, "SA", 16, 0 },
+    { 38037, 38043, 38049, 33276, "SA", 16, 0 },
+    { 38065, 38071, 33217, 33276, "SA", 16, 0 },
+    { 38077, 38085, 38095, 33276, "SA", 16, 0 },
+    { 38151, 38157, 38163, 33276, "SA", 16, 0 },
+    { 38205, 38213, 38223, 33276, "SA", 16, 0 },
+    { 38239, 38247, 38257, 33276, "SA", 16, 0 },
+    { 38293, 38301, 33217, 33276, "SA", 16, 0 },
+    { 38311, 38319, 38329, 33276, "SA", 16, 0 },
+    { 38372, 38380, 38390, 33276, "SA", 16, 0 },
+    { 38415, 38423, 22060, 33276, "SA", 16, 0 },
+    { 38433, 38441, 38451, 33276, "SA", 16, 0 },
+    { 38484, 38492, 38502, 33276, "SA", 16, 0 },
+    { 38548, 38556, 38566, 33276, "SA", 16, 0 },
+    { 38583, 38592, 23252, 33276, "SA", 16, 0 },
+    { 38602, 38611, 38621, 33276, "SA", 16, 0 },
+    { 38649, 38658, 38668, 33276, "SA", 16, 0 },
+    { 38713, 38719, 38725, 33276, "SA", 16, 0 },
+    { 38753, 38759, 38765, 33276, "SA", 16, 0 },
+    { 38820, 38828, 38838, 33276, "SA", 16, 0 },
+    { 38858, 38866, 38876, 33276, "SA", 16, 0 },
+    { 38905, 38913, 38923, 33276, "SA", 16, 0 },
+    { 38945, 38953, 38963, 33276, "SA", 16, 0 },
+    { 38987, 38995, 39005, 33276, "SA", 16, 0 },
+    { 39032, 39040, 39050, 33276, "SA", 16, 0 },
+    { 39072, 39080, 39090, 33276, "SA", 16, 0 },
+    { 39120, 39128, 39138, 33276, "SA", 16, 0 },
+    { 39152, 39160, 39170, 33276, "SA", 16, 0 },
+    { 39187, 39193, 39199, 33276, "SA", 16, 0 },
+    { 39231, 39239, 39249, 33276, "SA", 16, 0 },
+    { 39298, 39306, 39316, 33276, "SA", 16, 0 },
+    { 39352, 39358, 39364, 33276, "SA", 16, 0 },
+    { 39387, 39395, 39405, 33276, "SA", 16, 0 },
+    { 39431, 39439, 39449, 33276, "SA", 16, 0 },
+    { 39504, 39512, 39522, 33276, "SA", 16, 0 },
+    { 39541, 39549, 39559, 33276, "SA", 16, 0 },
+    { 39585, 39591, 39597, 33276, "SA", 16, 0 },
+    { 39643, 39649, 39655, 33276, "SA", 16, 0 },
+    { 39675, 39683, 39693, 33276, "SA", 16, 0 },
+    { 39717, 39723, 39729, 33276, "SA", 16, 0 },
+    { 39759, 39767, 39777, 33276, "SA", 16, 0 },
+    { 39819, 39825, 39831, 33276, "SA", 16, 0 },
+    { 39846, 39851, 11, 39857, "SC", 16, 0 },
+    { 39894, 39899, 39905, 39857, "SC", 16, 0 },
+    { 39949, 39956, 39966, 39857, "SC", 16, 0 },
+    { 40002, 40009, 11143, 39857, "SC", 16, 0 },
+    { 40019, 40024, 40030, 39857, "SC", 16, 0 },
+    { 40058, 40065, 40075, 39857, "SC", 16, 0 },
+    { 40095, 40102, 40112, 39857, "SC", 16, 0 },
+    { 40146, 40153, 40163, 39857, "SC", 16, 0 },
+    { 40198, 40205, 40215, 39857, "SC", 16, 0 },
+    { 40248, 40255, 40265, 39857, "SC", 16, 0 },
+    { 40284, 40289, 40295, 39857, "SC", 16, 0 },
+    { 40334, 40341, 40351, 39857, "SC", 16, 0 },
+    { 40367, 40374, 40384, 39857, "SC", 16, 0 },
+    { 40417, 40422, 40428, 39857, "SC", 16, 0 },
+    { 40457, 40464, 40474, 39857, "SC", 16, 0 },
+    { 40515, 40522, 40532, 39857, "SC", 16, 0 },
+    { 40568, 40575, 40585, 39857, "SC", 16, 0 },
+    { 40610, 40615, 40621, 39857, "SC", 16, 0 },
+    { 40643, 40648, 40654, 39857, "SC", 16, 1 },
+    { 40674, 40681, 40691, 39857, "SC", 17, 0 },
+    { 40724, 40731, 40741, 39857, "SC", 17, 0 },
+    { 40755, 40762, 40772, 39857, "SC", 17, 0 },
+    { 40786, 40793, 40803, 39857, "SC", 17, 0 },
+    { 40840, 40847, 40857, 39857, "SC", 17, 0 },
+    { 40896, 40903, 40913, 39857, "SC", 17, 0 },
+    { 40945, 40952, 40962, 39857, "SC", 17, 0 },
+    { 40997, 41004, 41014, 39857, "SC", 17, 0 },
+    { 41059, 41066, 41076, 39857, "SC", 17, 0 },
+    { 41129, 41137, 41147, 39857, "SC", 17, 0 },
+    { 41168, 41176, 41186, 39857, "SC", 17, 0 },
+    { 41227, 41235, 41245, 39857, "SC", 17, 0 },
+    { 41267, 41275, 41285, 39857, "SC", 17, 0 },
+    { 41349, 41357, 41367, 39857, "SC", 17, 0 },
+    { 41417, 41425, 41435, 39857, "SC", 17, 0 },
+    { 41465, 41473, 41483, 39857, "SC", 17, 0 },
+    { 41522, 41530, 41540, 39857, "SC", 17, 0 },
+    { 41582, 41590, 41600, 39857, "SC", 17, 0 },
+    { 41612, 41620, 41630, 39857, "SC", 17, 0 },
+    { 41693, 41701, 41711, 39857, "SC", 17, 0 },
+    { 41745, 41753, 41763, 39857, "SC", 17, 0 },
+    { 41794, 41802, 41812, 39857, "SC", 17, 0 },
+    { 41874, 41882, 41892, 39857, "SC", 17, 0 },
+    { 41947, 41955, 41965, 39857, "SC", 17, 0 },
+    { 42001, 42009, 11437, 39857, "SC", 17, 0 },
+    { 42019, 42027, 11504, 39857, "SC", 17, 0 },
+    { 42037, 42045, 11569, 39857, "SC", 17, 0 },
+    { 42055, 42063, 11640, 39857, "SC", 17, 0 },
+    { 42073, 42081, 42091, 39857, "SC", 17, 0 },
+    { 42129, 42134, 42140, 39857, "SC", 17, 0 },
+    { 42183, 42190, 9803, 39857, "SC", 17, 0 },
+    { 42200, 42207, 42217, 39857, "SC", 17, 0 },
+    { 42253, 42260, 42270, 39857, "SC", 17, 0 },
+    { 42317, 42324, 42334, 39857, "SC", 17, 0 },
+    { 42370, 42377, 42387, 39857, "SC", 17, 0 },
+    { 42417, 42422, 42428, 39857, "SC", 17, 0 },
+    { 42457, 42463, 42469, 39857, "SC", 17, 0 },
+    { 42488, 42494, 42500, 39857, "SC", 17, 0 },
+    { 42513, 42521, 42531, 39857, "SC", 17, 0 },
+    { 42563, 42569, 42575, 39857, "SC", 17, 0 },
+    { 42622, 42630, 42640, 39857, "SC", 17, 0 },
+    { 42653, 42661, 42671, 39857, "SC", 17, 0 },
+    { 42686, 42694, 42704, 39857, "SC", 17, 0 },
+    { 42720, 42728, 42738, 39857, "SC", 17, 0 },
+    { 42755, 42763, 42773, 39857, "SC", 17, 0 },
+    { 42808, 42816, 42826, 39857, "SC", 17, 0 },
+    { 42851, 42857, 9803, 39857, "SC", 17, 0 },
+    { 42863, 42871, 42881, 39857, "SC", 17, 0 },
+    { 42909, 42917, 42927, 39857, "SC", 17, 0 },
+    { 42953, 42961, 42971, 39857, "SC", 17, 0 },
+    { 43015, 43023, 10262, 39857, "SC", 17, 0 },
+    { 43033, 43039, 43045, 39857, "SC", 17, 0 },
+    { 43071, 43077, 43083, 39857, "SC", 17, 0 },
+    { 43132, 43140, 43150, 39857, "SC", 17, 0 },
+    { 43181, 43189, 43199, 39857, "SC", 17, 0 },
+    { 43252, 43260, 43270, 39857, "SC", 17, 0 },
+    { 43313, 43321, 43331, 39857, "SC", 17, 0 },
+    { 43372, 43378, 43384, 39857, "SC", 17, 0 },
+    { 43432, 43440, 43450, 39857, "SC", 17, 0 },
+    { 43473, 43481, 43491, 39857, "SC", 17, 0 },
+    { 43516, 43524, 43534, 39857, "SC", 17, 0 },
+    { 43556, 43562, 43568, 39857, "SC", 17, 0 },
+    { 43607, 43613, 43619, 39857, "SC", 17, 0 },
+    { 43631, 43639, 43649, 39857, "SC", 17, 0 },
+    { 43704, 43712, 43722, 39857, "SC", 17, 0 },
+    { 43756, 43764, 43774, 39857, "SC", 17, 0 },
+    { 43808, 43816, 43826, 39857, "SC", 17, 0 },
+    { 43854, 43862, 43872, 39857, "SC", 17, 0 },
+    { 43918, 43924, 43930, 39857, "SC", 17, 0 },
+    { 43959, 43965, 43971, 39857, "SC", 17, 0 },
+    { 44033, 44041, 44051, 39857, "SC", 17, 0 },
+    { 44067, 44075, 44085, 39857, "SC", 17, 0 },
+    { 44111, 44117, 44123, 39857, "SC", 17, 0 },
+    { 44194, 44202, 44085, 39857, "SC", 17, 0 },
+    { 44212, 44218, 44224, 39857, "SC", 17, 0 },
+    { 44290, 44296, 44302, 39857, "SC", 17, 0 },
+    { 44323, 44331, 44341, 39857, "SC", 17, 0 },
+    { 44382, 44390, 44400, 39857, "SC", 17, 0 },
+    { 44444, 44452, 44462, 39857, "SC", 17, 0 },
+    { 44506, 44514, 44524, 39857, "SC", 17, 0 },
+    { 44570, 44578, 44588, 39857, "SC", 17, 0 },
+    { 44620, 44626, 44632, 39857, "SC", 17, 0 },
+    { 44652, 44658, 44664, 39857, "SC", 17, 0 },
+    { 44675, 44681, 44687, 39857, "SC", 17, 0 },
+    { 44694, 44702, 44712, 39857, "SC", 17, 0 },
+    { 44740, 44746, 44752, 39857, "SC", 17, 0 },
+    { 44786, 44792, 44798, 39857, "SC", 17, 0 },
+    { 44832, 44840, 9803, 39857, "SC", 17, 0 },
+    { 44850, 44858, 44868, 39857, "SC", 17, 0 },
+    { 44884, 44892, 44902, 39857, "SC", 17, 0 },
+    { 44921, 44927, 44933, 39857, "SC", 17, 0 },
+    { 44947, 44955, 44965, 39857, "SC", 17, 0 },
+    { 44991, 44997, 45003, 39857, "SC", 17, 0 },
+    { 45032, 45040, 44965, 39857, "SC", 17, 0 },
+    { 45050, 45058, 45068, 39857, "SC", 17, 0 },
+    { 45079, 45087, 45097, 39857, "SC", 17, 0 },
+    { 45137, 45145, 45155, 39857, "SC", 17, 0 },
+    { 45178, 45186, 45196, 39857, "SC", 17, 0 },
+    { 45229, 45235, 45241, 39857, "SC", 17, 0 },
+    { 45265, 45273, 45283, 39857, "SC", 17, 0 },
+    { 45323, 45331, 45341, 39857, "SC", 17, 0 },
+    { 45359, 45367, 45377, 39857, "SC", 17, 0 },
+    { 45423, 45429, 45435, 39857, "SC", 17, 0 },
+    { 45455, 45463, 45473, 39857, "SC", 17, 0 },
+    { 45524, 45530, 45536, 39857, "SC", 17, 0 },
+    { 45571, 45577, 45583, 39857, "SC", 17, 0 },
+    { 45618, 45626, 45636, 39857, "SC", 17, 0 },
+    { 45656, 45664, 45674, 39857, "SC", 17, 0 },
+    { 45714, 45722, 45732, 39857, "SC", 17, 0 },
+    { 45758, 45764, 45770, 39857, "SC", 17, 0 },
+    { 45809, 45815, 45821, 39857, "SC", 17, 0 },
+    { 45856, 45864, 45874, 39857, "SC", 17, 0 },
+    { 45893, 45901, 45911, 39857, "SC", 17, 0 },
+    { 45927, 45933, 45939, 39857, "SC", 17, 0 },
+    { 45960, 45968, 45978, 39857, "SC", 17, 0 },
+    { 46011, 46017, 37656, 39857, "SC", 17, 0 },
+    { 46023, 46029, 46035, 39857, "SC", 17, 0 },
+    { 46053, 46061, 40075, 39857, "SC", 17, 0 },
+    { 46071, 46079, 46089, 39857, "SC", 17, 0 },
+    { 46126, 46132, 46138, 39857, "SC", 17, 0 },
+    { 46163, 46171, 46181, 39857, "SC", 17, 0 },
+    { 46210, 46218, 46228, 39857, "SC", 17, 0 },
+    { 46255, 46263, 46273, 39857, "SC", 17, 0 },
+    { 46324, 46332, 46342, 39857, "SC", 17, 0 },
+    { 46374, 46380, 46386, 39857, "SC", 17, 0 },
+    { 46413, 46419, 46425, 39857, "SC", 17, 0 },
+    { 46452, 46460, 46470, 39857, "SC", 17, 0 },
+    { 46515, 46523, 46533, 39857, "SC", 17, 0 },
+    { 46548, 46556, 46566, 39857, "SC", 17, 0 },
+    { 46590, 46598, 46608, 39857, "SC", 17, 0 },
+    { 46629, 46637, 46647, 39857, "SC", 17, 0 },
+    { 46671, 46677, 46683, 39857, "SC", 17, 0 },
+    { 46702, 46708, 46714, 39857, "SC", 17, 0 },
+    { 46734, 46740, 46746, 39857, "SC", 17, 0 },
+    { 46774, 46782, 9534, 39857, "SC", 17, 0 },
+    { 46792, 46800, 9598, 39857, "SC", 17, 0 },
+    { 46810, 46816, 46822, 39857, "SC", 17, 0 },
+    { 46854, 46860, 46866, 39857, "SC", 17, 0 },
+    { 46897, 46903, 46909, 39857, "SC", 17, 0 },
+    { 46927, 46935, 46945, 39857, "SC", 17, 0 },
+    { 47002, 47008, 47014, 39857, "SC", 17, 0 },
+    { 47066, 47072, 47078, 39857, "SC", 17, 0 },
+    { 47130, 47136, 45732, 39857, "SC", 17, 0 },
+    { 47142, 47147, 11, 47153, "SI", 17, 0 },
+    { 47186, 47191, 47197, 47153, "SI", 17, 0 },
+    { 47214, 47221, 28837, 47153, "SI", 17, 0 },
+    { 47231, 47238, 47248, 47153, "SI", 17, 0 },
+    { 47282, 47289, 47299, 47153, "SI", 17, 0 },
+    { 47361, 47368, 47378, 47153, "SI", 17, 0 },
+    { 47411, 47418, 47428, 47153, "SI", 17, 0 },
+    { 47468, 47475, 47485, 47153, "SI", 17, 0 },
+    { 47539, 47544, 47550, 47153, "SI", 17, 1 },
+    { 47576, 47583, 28837, 47153, "SI", 18, 0 },
+    { 47593, 47600, 47610, 47153, "SI", 18, 0 },
+    { 47628, 47635, 47645, 47153, "SI", 18, 0 },
+    { 47666, 47673, 47683, 47153, "SI", 18, 0 },
+    { 47716, 47723, 47733, 47153, "SI", 18, 0 },
+    { 47758, 47765, 47775, 47153, "SI", 18, 0 },
+    { 47800, 47807, 47817, 47153, "SI", 18, 0 },
+    { 47846, 47853, 47863, 47153, "SI", 18, 0 },
+    { 47892, 47899, 5869, 47153, "SI", 18, 0 },
+    { 47909, 47917, 47927, 47153, "SI", 18, 0 },
+    { 47951, 47956, 47962, 47153, "SI", 18, 3 },
+    { 47980, 47987, 47997, 47153, "SI", 21, 0 },
+    { 48036, 48043, 48053, 47153, "SI", 21, 0 },
+    { 48107, 48114, 48124, 47153, "SI", 21, 0 },
+    { 48165, 48172, 48182, 47153, "SI", 21, 0 },
+    { 48226, 48233, 48243, 47153, "SI", 21, 0 },
+    { 48267, 48274, 48284, 47153, "SI", 21, 0 },
+    { 48314, 48321, 48331, 47153, "SI", 21, 0 },
+    { 48371, 48378, 48388, 47153, "SI", 21, 0 },
+    { 48425, 48432, 48442, 47153, "SI", 21, 0 },
+    { 48485, 48493, 48503, 47153, "SI", 21, 0 },
+    { 48542, 48550, 48560, 47153, "SI", 21, 0 },
+    { 48601, 48609, 48619, 47153, "SI", 21, 0 },
+    { 48659, 48667, 48677, 47153, "SI", 21, 0 },
+    { 48712, 48720, 48730, 47153, "SI", 21, 0 },
+    { 48759, 48767, 48777, 47153, "SI", 21, 0 },
+    { 48813, 48821, 48831, 47153, "SI", 21, 0 },
+    { 48864, 48872, 48882, 47153, "SI", 21, 0 },
+    { 48915, 48923, 48933, 47153, "SI", 21, 0 },
+    { 48973, 48981, 48991, 47153, "SI", 21, 0 },
+    { 49012, 49020, 49030, 47153, "SI", 21, 0 },
+    { 49047, 49055, 49065, 47153, "SI", 21, 0 },
+    { 49086, 49094, 49104, 47153, "SI", 21, 0 },
+    { 49134, 49142, 49152, 47153, "SI", 21, 0 },
+    { 49171, 49179, 49189, 47153, "SI", 21, 0 },
+    { 49214, 49222, 49232, 47153, "SI", 21, 0 },
+    { 49266, 49271, 49277, 47153, "SI", 21, 0 },
+    { 49321, 49328, 49338, 47153, "SI", 21, 0 },
+    { 49370, 49375, 49381, 47153, "SI", 21, 0 },
+    { 49424, 49431, 49441, 47153, "SI", 21, 0 },
+    { 49479, 49486, 49496, 47153, "SI", 21, 0 },
+    { 49539, 49546, 49556, 47153, "SI", 21, 0 },
+    { 49584, 49589, 49595, 47153, "SI", 21, 1 },
+    { 49641, 49648, 49658, 47153, "SI", 22, 0 },
+    { 49675, 49682, 49692, 47153, "SI", 22, 0 },
+    { 49740, 49747, 49757, 47153, "SI", 22, 0 },
+    { 49791, 49798, 49808, 47153, "SI", 22, 0 },
+    { 49833, 49840, 49850, 47153, "SI", 22, 0 },
+    { 49893, 49900, 9803, 47153, "SI", 22, 0 },
+    { 49910, 49917, 49927, 47153, "SI", 22, 0 },
+    { 49965, 49972, 49982, 47153, "SI", 22, 0 },
+    { 50025, 50032, 50042, 47153, "SI", 22, 0 },
+    { 50062, 50070, 50080, 47153, "SI", 22, 0 },
+    { 50108, 50116, 14442, 47153, "SI", 22, 0 },
+    { 50126, 50134, 43450, 47153, "SI", 22, 0 },
+    { 50144, 50152, 14505, 47153, "SI", 22, 0 },
+    { 50162, 50170, 14563, 47153, "SI", 22, 0 },
+    { 50180, 50188, 50198, 47153, "SI", 22, 0 },
+    { 50218, 50226, 50236, 47153, "SI", 22, 0 },
+    { 50288, 50296, 50306, 47153, "SI", 22, 0 },
+    { 50342, 50347, 50353, 47153, "SI", 22, 0 },
+    { 50369, 50376, 28837, 47153, "SI", 22, 0 },
+    { 50386, 50393, 47610, 47153, "SI", 22, 0 },
+    { 50403, 50410, 50420, 47153, "SI", 22, 0 },
+    { 50451, 50456, 50462, 47153, "SI", 22, 0 },
+    { 50493, 50499, 50505, 47153, "SI", 22, 0 },
+    { 50534, 50542, 50552, 47153, "SI", 22, 0 },
+    { 50579, 50587, 50597, 47153, "SI", 22, 0 },
+    { 50623, 50631, 50641, 47153, "SI", 22, 0 },
+    { 50662, 50670, 50680, 47153, "SI", 22, 0 },
+    { 50700, 50708, 50718, 47153, "SI", 22, 0 },
+    { 50774, 50782, 50792, 47153, "SI", 22, 0 },
+    { 50813, 50819, 50825, 47153, "SI", 22, 0 },
+    { 50840, 50846, 50852, 47153, "SI", 22, 0 },
+    { 50889, 50897, 8387, 47153, "SI", 22, 0 },
+    { 50907, 50915, 50925, 47153, "SI", 22, 0 },
+    { 51005, 51013, 51023, 47153, "SI", 22, 0 },
+    { 51044, 51050, 51056, 47153, "SI", 22, 0 },
+    { 51087, 51095, 51105, 47153, "SI", 22, 0 },
+    { 51145, 51153, 50236, 47153, "SI", 22, 0 },
+    { 51163, 51171, 51181, 47153, "SI", 22, 0 },
+    { 51216, 51224, 51234, 47153, "SI", 22, 0 },
+    { 51282, 51290, 17857, 47153, "SI", 22, 0 },
+    { 51300, 51306, 51312, 47153, "SI", 22, 0 },
+    { 51328, 51336, 51346, 47153, "SI", 22, 0 },
+    { 51375, 51383, 51393, 47153, "SI", 22, 0 },
+    { 51420, 51428, 51438, 47153, "SI", 22, 0 },
+    { 51466, 51472, 51478, 47153, "SI", 22, 0 },
+    { 51507, 51513, 51519, 47153, "SI", 22, 0 },
+    { 51537, 51543, 51549, 47153, "SI", 22, 0 },
+    { 51570, 51576, 51582, 47153, "SI", 22, 0 },
+    { 51637, 51645, 27854, 47153, "SI", 22, 0 },
+    { 51655, 51663, 51673, 47153, "SI", 22, 0 },
+    { 51683, 51691, 51701, 47153, "SI", 22, 0 },
+    { 51712, 51720, 51730, 47153, "SI", 22, 0 },
+    { 51750, 51758, 51768, 47153, "SI", 22, 0 },
+    { 51801, 51807, 51813, 47153, "SI", 22, 0 },
+    { 51831, 51839, 51701, 47153, "SI", 22, 0 },
+    { 51849, 51857, 51867, 47153, "SI", 22, 0 },
+    { 51877, 51885, 51895, 47153, "SI", 22, 0 },
+    { 51903, 51911, 51921, 47153, "SI", 22, 0 },
+    { 51997, 52005, 52015, 47153, "SI", 22, 0 },
+    { 52046, 52054, 52064, 47153, "SI", 22, 0 },
+    { 52085, 52093, 52103, 47153, "SI", 22, 0 },
+    { 52137, 52145, 52155, 47153, "SI", 22, 0 },
+    { 52174, 52180, 52186, 47153, "SI", 22, 0 },
+    { 52195, 52201, 52207, 47153, "SI", 22, 0 },
+    { 52227, 52233, 52239, 47153, "SI", 22, 0 },
+    { 52261, 52267, 52273, 47153, "SI", 22, 0 },
+    { 52299, 52304, 11, 52310, "SR", 22, 0 },
+    { 52339, 52344, 52350, 52310, "SR", 22, 0 },
+    { 52384, 52391, 52401, 52310, "SR", 22, 0 },
+    { 52421, 52426, 52432, 52310, "SR", 22, 0 },
+    { 52468, 52475, 52485, 52310, "SR", 22, 0 },
+    { 52505, 52512, 37484, 52310, "SR", 22, 0 },
+    { 52522, 52529, 52539, 52310, "SR", 22, 0 },
+    { 52558, 52563, 52569, 52310, "SR", 22, 0 },
+    { 52580, 52587, 52597, 52310, "SR", 22, 0 },
+    { 52606, 52613, 52623, 52310, "SR", 22, 0 },
+    { 52639, 52646, 37695, 52310, "SR", 22, 0 },
+    { 52656, 52663, 52673, 52310, "SR", 22, 0 },
+    { 52709, 52714, 52720, 52310, "SR", 22, 0 },
+    { 52763, 52770, 52780, 52310, "SR", 22, 0 },
+    { 52796, 52803, 52813, 52310, "SR", 22, 0 },
+    { 52881, 52886, 52892, 52310, "SR", 22, 0 },
+    { 52925, 52932, 52942, 52310, "SR", 22, 0 },
+    { 52963, 52968, 52974, 52310, "SR", 22, 0 },
+    { 53007, 53012, 53018, 52310, "SR", 22, 0 },
+    { 53042, 53047, 39199, 52310, "SR", 22, 0 },
+    { 53053, 53060, 53070, 52310, "SR", 22, 0 },
+    { 53119, 53125, 39316, 52310, "SR", 22, 0 },
+    { 53131, 53137, 39364, 52310, "SR", 22, 0 },
+    { 53143, 53151, 39405, 52310, "SR", 22, 0 },
+    { 53161, 53169, 39449, 52310, "SR", 22, 0 },
+    { 53179, 53187, 39559, 52310, "SR", 22, 0 },
+    { 53197, 53203, 39522, 52310, "SR", 22, 0 },
+    { 53209, 53221, 53233, 53270, "AC", 22, 1 },
+    { 53285, 53298, 53311, 53270, "AC", 23, 0 },
+    { 53347, 53361, 53375, 53270, "AC", 23, 1 },
+    { 53407, 53420, 53433, 53270, "AC", 24, 0 },
+    { 53471, 53483, 53495, 53521, "IA", 24, 0 },
+    { 53555, 53568, 53581, 53521, "IA", 24, 0 },
+    { 53607, 53621, 53635, 53661, "MP", 24, 0 },
+    { 53678, 53693, 53708, 53741, "PE", 24, 0 },
+    { 53761, 53774, 53787, 53741, "PE", 24, 0 },
+    { 53821, 53833, 53845, 53876, "SC", 24, 1 },
+    { 53913, 53926, 53939, 53876, "SC", 25, 0 },
+    { 53971, 53985, 53999, 54027, "SI", 25, 0 },
+    { 54060, 54075, 54090, 54027, "SI", 25, 1 },
+    { 54127, 54141, 54155, 54027, "SI", 26, 0 },
+    { 54188, 54201, 54214, 54027, "SI", 26, 0 },
+    { 54248, 54260, 54272, 53270, "AC", 26, 1 },
+    { 54309, 54321, 54333, 53270, "AC", 27, 0 },
+    { 54369, 54381, 54393, 53270, "AC", 27, 0 },
+    { 54410, 54422, 3140, 53270, "AC", 27, 0 },
+    { 54434, 54446, 3172, 53270, "AC", 27, 1 },
+    { 54458, 54470, 54482, 53270, "AC", 28, 0 },
+    { 54509, 54521, 8195, 53270, "AC", 28, 1 },
+    { 54533, 54545, 3749, 53270, "AC", 29, 1 },
+    { 54557, 54569, 54581, 53270, "AC", 30, 0 },
+    { 54608, 54621, 54634, 53270, "AC", 30, 0 },
+    { 54647, 54660, 4337, 53270, "AC", 30, 0 },
+    { 54673, 54686, 54699, 53270, "AC", 30, 0 },
+    { 54721, 54734, 54747, 53270, "AC", 30, 0 },
+    { 54777, 54790, 54803, 53270, "AC", 30, 0 },
+    { 54825, 54838, 54851, 53270, "AC", 30, 0 },
+    { 54876, 54889, 54902, 53270, "AC", 30, 0 },
+    { 54932, 54945, 54958, 53270, "AC", 30, 0 },
+    { 54985, 54998, 55011, 53270, "AC", 30, 0 },
+    { 55036, 55049, 55062, 53270, "AC", 30, 0 },
+    { 55084, 55097, 55110, 53270, "AC", 30, 0 },
+    { 55142, 55155, 55168, 53270, "AC", 30, 0 },
+    { 55189, 55202, 55215, 53270, "AC", 30, 0 },
+    { 55253, 55265, 55277, 55303, "AT", 30, 0 },
+    { 55326, 55338, 55350, 55303, "AT", 30, 0 },
+    { 55370, 55382, 55394, 55303, "AT", 30, 0 },
+    { 55419, 55431, 55443, 55459, "AU", 30, 1 },
+    { 55484, 55496, 55508, 55459, "AU", 31, 1 },
+    { 55528, 55540, 55552, 55459, "AU", 32, 0 },
+    { 55565, 55577, 55589, 55459, "AU", 32, 0 },
+    { 55612, 55624, 55636, 55459, "AU", 32, 1 },
+    { 55654, 55666, 55678, 55459, "AU", 33, 0 },
+    { 55700, 55712, 55724, 55459, "AU", 33, 0 },
+    { 55750, 55762, 55774, 55459, "AU", 33, 0 },
+    { 55791, 55803, 55815, 55459, "AU", 33, 0 },
+    { 55832, 55844, 55856, 55874, "CM", 33, 1 },
+    { 55899, 55911, 55923, 55874, "CM", 34, 1 },
+    { 55958, 55970, 55982, 55874, "CM", 35, 1 },
+    { 56007, 56019, 56031, 55874, "CM", 36, 0 },
+    { 56056, 56068, 13576, 55874, "CM", 36, 1 },
+    { 56080, 56092, 14167, 55874, "CM", 37, 1 },
+    { 56104, 56116, 56128, 55874, "CM", 38, 1 },
+    { 56155, 56167, 56179, 55874, "CM", 39, 1 },
+    { 56208, 56220, 56232, 55874, "CM", 40, 0 },
+    { 56256, 56268, 56280, 53521, "IA", 40, 0 },
+    { 56306, 56318, 56330, 53521, "IA", 40, 0 },
+    { 56356, 56368, 56380, 53521, "IA", 40, 0 },
+    { 56407, 56419, 56431, 53521, "IA", 40, 0 },
+    { 56463, 56475, 56487, 53521, "IA", 40, 0 },
+    { 56504, 56516, 56528, 53521, "IA", 40, 0 },
+    { 56548, 56560, 56572, 53521, "IA", 40, 0 },
+    { 56592, 56604, 56616, 53521, "IA", 40, 0 },
+    { 56631, 56643, 56655, 53521, "IA", 40, 0 },
+    { 56675, 56688, 56701, 53521, "IA", 40, 0 },
+    { 56729, 56742, 56755, 53521, "IA", 40, 0 },
+    { 56772, 56784, 22094, 56796, "IR", 40, 0 },
+    { 56814, 56826, 22940, 56796, "IR", 40, 0 },
+    { 56838, 56850, 21951, 56796, "IR", 40, 0 },
+    { 56862, 56874, 56886, 56906, "MA", 40, 0 },
+    { 56918, 56930, 56942, 56906, "MA", 40, 0 },
+    { 56969, 56981, 56993, 56906, "MA", 40, 0 },
+    { 57016, 57028, 57040, 56906, "MA", 40, 0 },
+    { 57057, 57069, 23968, 56906, "MA", 40, 0 },
+    { 57081, 57093, 24311, 56906, "MA", 40, 0 },
+    { 57105, 57117, 24801, 53661, "MP", 40, 0 },
+    { 57129, 57141, 24829, 53661, "MP", 40, 0 },
+    { 57153, 57165, 57177, 53661, "MP", 40, 0 },
+    { 57203, 57215, 57227, 53661, "MP", 40, 0 },
+    { 57242, 57254, 57266, 53661, "MP", 40, 0 },
+    { 57287, 57299, 57311, 53661, "MP", 40, 0 },
+    { 57339, 57351, 57363, 53661, "MP", 40, 0 },
+    { 57379, 57391, 57403, 53661, "MP", 40, 0 },
+    { 57416, 57428, 57440, 53661, "MP", 40, 0 },
+    { 57456, 57468, 57480, 57499, "PS", 40, 0 },
+    { 57518, 57530, 57542, 57499, "PS", 40, 0 },
+    { 57560, 57573, 57586, 53741, "PE", 40, 0 },
+    { 57619, 57632, 57645, 53741, "PE", 40, 0 },
+    { 57662, 57675, 57688, 53741, "PE", 40, 0 },
+    { 57715, 57728, 57741, 53741, "PE", 40, 0 },
+    { 57773, 57786, 57799, 53741, "PE", 40, 0 },
+    { 57833, 57846, 57859, 53741, "PE", 40, 0 },
+    { 57882, 57895, 57908, 57925, "RA", 40, 0 },
+    { 57941, 57954, 57967, 57925, "RA", 40, 0 },
+    { 57986, 57999, 58012, 57925, "RA", 40, 0 },
+    { 58038, 58051, 58064, 58092, "CA", 40, 0 },
+    { 58112, 58125, 58138, 58092, "CA", 40, 0 },
+    { 58165, 58178, 58191, 58092, "CA", 40, 0 },
+    { 58219, 58232, 58245, 58092, "CA", 40, 0 },
+    { 58266, 58279, 58292, 53876, "SC", 40, 1 },
+    { 58323, 58336, 58349, 53876, "SC", 41, 0 },
+    { 58370, 58383, 58396, 53876, "SC", 41, 0 },
+    { 58412, 58425, 58438, 53876, "SC", 41, 0 },
+    { 58462, 58475, 53939, 53876, "SC", 41, 0 },
+    { 58488, 58501, 58514, 53876, "SC", 41, 0 },
+    { 58539, 58552, 58565, 53876, "SC", 41, 0 },
+    { 58581, 58594, 58607, 53876, "SC", 41, 0 },
+    { 58623, 58636, 58649, 53876, "SC", 41, 0 },
+    { 58673, 58687, 58701, 53876, "SC", 41, 0 },
+    { 58716, 58730, 58744, 53876, "SC", 41, 0 },
+    { 58759, 58773, 58787, 53876, "SC", 41, 0 },
+    { 58816, 58830, 43619, 53876, "SC", 41, 0 },
+    { 58844, 58858, 58872, 53876, "SC", 41, 0 },
+    { 58901, 58915, 58929, 53876, "SC", 41, 0 },
+    { 58957, 58971, 58985, 53876, "SC", 41, 0 },
+    { 58998, 59011, 59024, 54027, "SI", 41, 0 },
+    { 59052, 59065, 59078, 54027, "SI", 41, 1 },
+    { 59109, 59122, 59135, 54027, "SI", 42, 0 },
+    { 59164, 59177, 54155, 54027, "SI", 42, 0 },
+    { 59190, 59203, 59216, 54027, "SI", 42, 0 },
+    { 59250, 59263, 59276, 54027, "SI", 42, 0 },
+    { 59303, 59316, 59329, 54027, "SI", 42, 2 },
+};
+const uint32_t compliance_control_count = 1318;
+
+const uint8_t compliance_control_checks[] = {
+    0, 6, 0, 6, 4, 3, 3, 3, 3, 2, 2, 0, 0, 2, 1, 5,
+    1, 5, 3, 4, 6, 2, 0, 1, 1, 5, 0, 0, 6, 4, 3, 3,
+    3, 2, 0, 2, 0, 1, 1, 5, 1, 5, 4, 6,
+    0
+};
+
+const uint16_t compliance_framework_controls[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+    336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+    368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+    384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+    400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+    416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+    432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+    448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+    464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+    480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+    496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+    512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+    528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+    544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+    576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+    672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687,
+    688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703,
+    704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+    720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735,
+    736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751,
+    752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767,
+    768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783,
+    784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799,
+    800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815,
+    816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831,
+    832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847,
+    848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863,
+    864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879,
+    880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+    896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911,
+    912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943,
+    944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959,
+    960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975,
+    976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991,
+    992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007,
+    1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+    1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+    1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+    1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+    1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+    1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+    1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119,
+    1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+    1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+    1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+    1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+    1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 0, 1, 15, 76, 81, 95, 109,
+    120, 126, 132, 141, 147, 148, 150, 155, 161, 164, 165, 170, 174, 176, 182, 196,
+    199, 213, 215, 233, 234, 235, 238, 247, 249, 252, 256, 259, 263, 265, 266, 283,
+    286, 294, 299, 309, 321, 323, 331, 332, 341, 344, 368, 377, 387, 388, 389, 390,
+    396, 400, 407, 417, 418, 436, 437, 438, 439, 440, 442, 449, 461, 462, 470, 486,
+    488, 492, 495, 503, 504, 514, 522, 533, 534, 546, 555, 563, 564, 568, 582, 588,
+    600, 602, 607, 610, 612, 622, 623, 628, 629, 633, 637, 638, 676, 677, 678, 683,
+    686, 687, 691, 692, 693, 715, 716, 718, 719, 724, 726, 735, 737, 741, 742, 743,
+    747, 757, 760, 768, 802, 883, 886, 899, 904, 934, 935, 944, 951, 957, 974, 977,
+    979, 991, 992, 1021, 1048, 1049, 1056, 1067, 1093, 1130, 1166, 1167, 1168, 1169, 1178, 1184,
+    1187, 1188, 1189, 1190, 1192, 0, 1, 2, 3, 4, 5, 6, 8, 10, 13, 14,
+    15, 31, 52, 64, 65, 66, 67, 70, 72, 74, 75, 76, 81, 88, 89, 90,
+    95, 109, 110, 111, 112, 113, 120, 121, 123, 126, 131, 132, 133, 134, 138, 141,
+    147, 148, 150, 151, 155, 161, 164, 165, 170, 171, 174, 176, 182, 183, 185, 193,
+    194, 196, 199, 203, 213, 215, 233, 234, 235, 237, 238, 247, 249, 252, 253, 256,
+    259, 260, 261, 263, 265, 266, 268, 269, 273, 274, 276, 278, 283, 285, 286, 287,
+    291, 294, 295, 299, 300, 301, 304, 309, 310, 312, 319, 321, 323, 327, 328, 331,
+    332, 333, 335, 340, 341, 344, 345, 351, 352, 354, 355, 356, 357, 358, 362, 363,
+    364, 368, 369, 376, 377, 379, 387, 388, 389, 390, 393, 394, 396, 400, 402, 407,
+    411, 417, 418, 419, 423, 424, 436, 437, 438, 439, 440, 442, 449, 450, 452, 453,
+    455, 461, 462, 466, 468, 470, 471, 486, 488, 489, 491, 492, 493, 495, 497, 499,
+    500, 501, 503, 504, 507, 508, 509, 510, 514, 522, 523, 528, 533, 534, 537, 538,
+    541, 546, 555, 563, 564, 568, 577, 578, 582, 583, 588, 592, 595, 597, 600, 602,
+    603, 604, 607, 610, 612, 613, 622, 623, 628, 629, 633, 637, 638, 676, 677, 678,
+    681, 683, 686, 687, 691, 692, 693, 715, 716, 718, 719, 724, 726, 727, 729, 735,
+    737, 739, 741, 742, 743, 747, 748, 749, 756, 757, 760, 768, 802, 803, 804, 807,
+    811, 819, 820, 821, 848, 851, 883, 886, 887, 896, 899, 904, 907, 908, 909, 911,
+    912, 916, 922, 934, 935, 941, 944, 951, 957, 966, 967, 974, 977, 979, 980, 991,
+    992, 1021, 1038, 1039, 1048, 1049, 1051, 1052, 1056, 1067, 1068, 1069, 1071, 1072, 1083, 1085,
+    1090, 1093, 1095, 1099, 1100, 1106, 1117, 1119, 1122, 1129, 1130, 1145, 1166, 1167, 1168, 1169,
+    1178, 1181, 1184, 1187, 1188, 1189, 1190, 1192, 0, 1, 2, 3, 4, 5, 6, 8,
+    10, 12, 13, 14, 15, 31, 35, 52, 64, 65, 66, 67, 68, 70, 72, 73,
+    74, 75, 76, 81, 87, 88, 89, 90, 95, 109, 110, 111, 112, 113, 120, 121,
+    123, 124, 125, 126, 131, 132, 133, 134, 138, 141, 147, 148, 150, 151, 155, 161,
+    164, 165, 170, 171, 174, 176, 177, 178, 182, 183, 185, 186, 187, 188, 189, 193,
+    194, 196, 199, 201, 202, 203, 207, 213, 215, 216, 218, 233, 234, 235, 236, 237,
+    238, 244, 247, 249, 252, 253, 256, 259, 260, 261, 263, 265, 266, 268, 269, 273,
+    274, 275, 276, 278, 280, 283, 284, 285, 286, 287, 291, 294, 295, 296, 299, 300,
+    301, 304, 309, 310, 311, 312, 313, 319, 321, 323, 327, 328, 330, 331, 332, 333,
+    334, 335, 337, 340, 341, 342, 344, 345, 346, 351, 352, 353, 354, 355, 356, 357,
+    358, 359, 362, 363, 364, 365, 366, 368, 369, 370, 371, 373, 376, 377, 379, 381,
+    387, 388, 389, 390, 393, 394, 396, 400, 402, 407, 411, 417, 418, 419, 423, 424,
+    425, 430, 436, 437, 438, 439, 440, 442, 449, 450, 452, 453, 454, 455, 461, 462,
+    463, 464, 466, 468, 470, 471, 472, 474, 476, 481, 486, 487, 488, 489, 491, 492,
+    493, 495, 497, 499, 500, 501, 503, 504, 506, 507, 508, 509, 510, 514, 517, 522,
+    523, 528, 533, 534, 537, 538, 541, 546, 547, 548, 549, 555, 563, 564, 568, 569,
+    577, 578, 582, 583, 586, 588, 589, 592, 595, 597, 598, 600, 602, 603, 604, 607,
+    609, 610, 611, 612, 613, 614, 622, 623, 628, 629, 633, 637, 638, 676, 677, 678,
+    681, 683, 685, 686, 687, 691, 692, 693, 715, 716, 718, 719, 724, 726, 727, 728,
+    729, 732, 735, 737, 739, 741, 742, 743, 747, 748, 749, 752, 756, 757, 760, 768,
+    802, 803, 804, 807, 811, 819, 820, 821, 848, 851, 861, 862, 881, 883, 886, 887,
+    890, 896, 899, 904, 907, 908, 909, 911, 912, 914, 916, 922, 924, 925, 934, 935,
+    941, 944, 945, 951, 957, 966, 967, 974, 977, 979, 980, 986, 991, 992, 1021, 1038,
+    1039, 1048, 1049, 1051, 1052, 1056, 1067, 1068, 1069, 1071, 1072, 1077, 1078, 1079, 1081, 1083,
+    1085, 1086, 1087, 1089, 1090, 1093, 1094, 1095, 1099, 1100, 1101, 1104, 1106, 1114, 1117, 1119,
+    1122, 1129, 1130, 1145, 1166, 1167, 1168, 1169, 1178, 1181, 1184, 1185, 1186, 1187, 1188, 1189,
+    1190, 1192, 0, 1, 15, 76, 81, 95, 109, 120, 126, 132, 141, 147, 148, 150,
+    155, 161, 164, 165, 170, 174, 176, 182, 196, 199, 213, 215, 233, 234, 235, 238,
+    247, 249, 252, 256, 259, 263, 265, 266, 283, 286, 294, 299, 309, 321, 323, 331,
+    332, 341, 344, 368, 377, 387, 388, 389, 390, 396, 400, 407, 417, 418, 436, 437,
+    438, 439, 440, 442, 449, 461, 462, 470, 486, 488, 492, 495, 503, 504, 514, 522,
+    533, 534, 546, 555, 563, 564, 568, 582, 588, 600, 602, 607, 610, 612, 622, 623,
+    628, 629, 633, 637, 638, 676, 677, 678, 683, 686, 687, 691, 692, 693, 715, 716,
+    718, 719, 724, 726, 735, 737, 741, 742, 743, 747, 757, 760, 768, 802, 883, 886,
+    899, 904, 934, 935, 944, 951, 957, 974, 977, 979, 991, 992, 1021, 1048, 1049, 1056,
+    1067, 1093, 1130, 1166, 1167, 1168, 1169, 1178, 1184, 1187, 1188, 1189, 1190, 1192, 1193, 1194,
+    1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210,
+    1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226,
+    1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242,
+    1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258,
+    1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274,
+    1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290,
+    1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306,
+    1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317,
+};
+
+const compliance_framework_t compliance_frameworks[] = {
+    { "nist", 0, 1193 },
+    { "fedramp-low", 1193, 156 },
+    { "fedramp-moderate", 1349, 323 },
+    { "fedramp-high", 1672, 410 },
+    { "fedramp-li-saas", 2082, 156 },
+    { "cmmc-l1", 2238, 15 },
+    { "cmmc-l2", 2253, 110 },
+};
+const uint32_t compliance_framework_count = 7;
@@ -1892,6 +1892,17 @@ def init_db():
         ON fingerprints(host_id, captured_at DESC)
     ''')
     
+    # Fingerprint sections by digest, so agents can skip unchanged ones
+    cur.execute('''
+        CREATE TABLE IF NOT EXISTS fingerprint_sections (
+            host_id INTEGER REFERENCES hosts(id) ON DELETE CASCADE,
+            digest CHAR(64) NOT NULL,
+            data JSONB NOT NULL,
+            stored_at TIMESTAMP DEFAULT NOW(),
+            PRIMARY KEY (host_id, digest)
+        )
+    ''')
+    
     cur.execute('''
         CREATE INDEX IF NOT EXISTS idx_fingerprints_captured 
         ON fingerprints(captured_at DESC)
@@ -1906,6 +1917,45 @@ def init_db():
 # API Endpoints
 # ============================================================
 
+def resolve_sections(cur, host_id, data, manifest):
+    """Store the sections a fingerprint carries under their digests and fill
+    in the ones it left out from earlier uploads by the same host.
+    
+    Only the sections of the newest manifest are kept: that is all an
+    agent can leave out next time. Returns (names neither sent nor
+    stored, digests now held).
+    """
+    missing = []
+    digests = []
+    for name, digest in manifest.items():
+        if not isinstance(digest, str) or len(digest) != 64:
+            continue
+        if name in data:
+            cur.execute('''
+                INSERT INTO fingerprint_sections (host_id, digest, data)
+                VALUES (%s, %s, %s)
+                ON CONFLICT (host_id, digest) DO NOTHING
+            ''', (host_id, digest, json.dumps(data[name])))
+        else:
+            cur.execute('''
+                SELECT data FROM fingerprint_sections
+                WHERE host_id = %s AND digest = %s
+            ''', (host_id, digest))
+            row = cur.fetchone()
+            if not row:
+                missing.append(name)
+                continue
+            data[name] = row['data']
+        digests.append(digest)
+    
+    if not missing:
+        cur.execute('''
+            DELETE FROM fingerprint_sections
+            WHERE host_id = %s AND NOT (digest = ANY(%s))
+        ''', (host_id, digests))
+    return missing, digests
+
+
 @app.route('/api/ingest', methods=['POST'])
 @require_api_key
 def ingest_fingerprint():
@@ -1915,7 +1965,9 @@ def ingest_fingerprint():
         if not data:
             return jsonify({'error': 'No JSON data provided'}), 400
         
-        hostname = data.get('system', {}).get('hostname', data.get('hostname', 'unknown'))
+        # "system" may be left out as unchanged; the agent names itself then
+        hostname = data.get('system', {}).get(
+            'hostname', data.get('hostname', request.headers.get('X-Sentinel-Host', 'unknown')))
         
         conn = get_db()
         cur = conn.cursor()
@@ -1929,6 +1981,17 @@ def ingest_fingerprint():
         ''', (hostname,))
         host_id = cur.fetchone()['id']
         
+        # Sections the agent skipped because we already hold them
+        manifest = data.get('section_digests')
+        known_digests = []
+        if isinstance(manifest, dict):
+            missing, known_digests = resolve_sections(cur, host_id, data, manifest)
+            if missing:
+                conn.rollback()
+                cur.close()
+                conn.close()
+                return jsonify({'status': 'resend', 'missing': missing}), 409
+        
         # Extract metrics
         system = data.get('system', {})
         process_summary = data.get('process_summary', {})
@@ -2001,7 +2064,8 @@ def ingest_fingerprint():
         return jsonify({
             'status': 'ok',
             'host_id': host_id,
-            'fingerprint_id': fingerprint_id
+            'fingerprint_id': fingerprint_id,
+            'known_digests': known_digests
         })
         
     except Exception as e:
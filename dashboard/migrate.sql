@@ -38,6 +38,16 @@ CREATE TABLE IF NOT EXISTS fingerprints (
 
 CREATE INDEX IF NOT EXISTS idx_fingerprints_host_time ON fingerprints(host_id, captured_at DESC);
 
+-- Fingerprint sections by digest (agents leave out sections the
+-- dashboard already holds; see "section_digests")
+CREATE TABLE IF NOT EXISTS fingerprint_sections (
+    host_id INTEGER REFERENCES hosts(id) ON DELETE CASCADE,
+    digest CHAR(64) NOT NULL,
+    data JSONB NOT NULL,
+    stored_at TIMESTAMP DEFAULT NOW(),
+    PRIMARY KEY (host_id, digest)
+);
+
 -- ============================================
 -- AUDIT EVENTS (security event history)
 -- ============================================
@@ -142,6 +152,7 @@ $$ LANGUAGE plpgsql;
 
 GRANT ALL ON hosts TO sentinel;
 GRANT ALL ON fingerprints TO sentinel;
+GRANT ALL ON fingerprint_sections TO sentinel;
 GRANT ALL ON audit_events TO sentinel;
 GRANT ALL ON users TO sentinel;
 GRANT ALL ON user_sessions TO sentinel;
@@ -0,0 +1,78 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * agent.c - Example libsentinel embedder
+ *
+ * A node agent loop that probes in-process and counts what the
+ * library allocates through it:
+ *
+ *   make lib
+ *   cc -I include examples/embed/agent.c bin/libsentinel.a -lm -pthread -ldl -o agent
+ *   cc -I include examples/embed/agent.c -L bin -lsentinel -o agent   (shared)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "libsentinel.h"
+
+static size_t bytes_allocated;
+
+static void *counting_alloc(size_t size, void *ctx) {
+    (void)ctx;
+    bytes_allocated += size;
+    return malloc(size);
+}
+
+static void counting_free(void *ptr, void *ctx) {
+    (void)ctx;
+    free(ptr);
+}
+
+int main(int argc, char *argv[]) {
+    int cycles = argc > 1 ? atoi(argv[1]) : 3;
+    sentinel_allocator_t alloc = { counting_alloc, counting_free, NULL };
+    sentinel_options_t opts = { SENTINEL_API_VERSION, &alloc, NULL, 0,
+                                SENTINEL_PROBE_NETWORK, 0, NULL };
+
+    sentinel_t *s = sentinel_open(&opts);
+    if (!s) {
+        fprintf(stderr, "sentinel_open failed\n");
+        return 1;
+    }
+
+    for (int i = 0; i < cycles; i++) {
+        sentinel_capture(s);
+
+        sentinel_summary_t sum;
+        sentinel_summary(s, &sum);
+        size_t json_len = 0;
+        sentinel_json(s, &json_len);
+        printf("cycle %d: severity %d, %d processes, %d listeners, load %.2f, "
+               "probe %.1f ms, JSON %zu bytes\n",
+               i, sum.severity, sum.processes, sum.listeners, sum.load_avg[0],
+               sum.probe_ms, json_len);
+
+        /* Biggest resident process, straight from the snapshot */
+        sentinel_process_t p, top = { 0 };
+        for (int k = 0; k < sentinel_process_count(s); k++) {
+            if (sentinel_process(s, k, &p) == 0 && p.rss_bytes > top.rss_bytes) top = p;
+        }
+        if (top.name) {
+            printf("  largest: %s[%d] %.1f MB\n", top.name, (int)top.pid,
+                   top.rss_bytes / (1024.0 * 1024.0));
+        }
+        if (i + 1 < cycles) sleep(1);
+    }
+
+    sentinel_close(s);
+    printf("allocated through the agent: %zu bytes\n", bytes_allocated);
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * filenr.c - Example probe plugin module: system-wide file handles
+ *
+ * Build and install:
+ *
+ *   make example-plugins
+ *   cp build/plugins/filenr.so ~/.sentinel/plugins/
+ *
+ * or load it for one run with --plugin build/plugins/filenr.so.
+ * Only plugin.h is needed to build a module.
+ */
+
+#include <stdio.h>
+
+#include "plugin.h"
+
+typedef struct {
+    unsigned long long allocated;
+    unsigned long long max;
+} filenr_section_t;
+
+static int filenr_collect(void *section) {
+    filenr_section_t *s = section;
+    unsigned long long unused;
+
+    FILE *f = fopen("/proc/sys/fs/file-nr", "r");
+    if (!f) return -1;
+    int n = fscanf(f, "%llu %llu %llu", &s->allocated, &unused, &s->max);
+    fclose(f);
+    return n == 3 ? 0 : -1;
+}
+
+static void filenr_serialize(const void *section, probe_json_t *out) {
+    const filenr_section_t *s = section;
+    probe_json_number(out, "allocated", (double)s->allocated);
+    probe_json_number(out, "max", (double)s->max);
+    probe_json_number(out, "used_pct", s->max ? 100.0 * s->allocated / s->max : 0);
+}
+
+static void filenr_diff(const void *prev, const void *cur, probe_json_t *out) {
+    const filenr_section_t *a = prev, *b = cur;
+    probe_json_number(out, "allocated_delta", (double)b->allocated - (double)a->allocated);
+}
+
+static const probe_plugin_t filenr_plugin = {
+    .abi = PROBE_PLUGIN_ABI,
+    .name = "filenr",
+    .description = "System-wide open file handles against fs.file-max",
+    .section_size = sizeof(filenr_section_t),
+    .cost_ms = 0.05,
+    .every = 1,
+    .collect = filenr_collect,
+    .serialize = filenr_serialize,
+    .diff = filenr_diff,
+};
+
+const probe_plugin_t *sentinel_probe_plugin(void) {
+    return &filenr_plugin;
+}
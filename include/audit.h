@@ -34,6 +34,20 @@
 #define HASH_USERNAME_LEN       12      /* "user_xxxx" + null */
 #define AUDIT_PATH_LEN          256     /* Shorter paths for audit */
 #define RISK_FACTOR_REASON_LEN  128
+#define MAX_DENIAL_GROUPS       8       /* Largest denial groups kept */
+#define DENIAL_MAP_SLOTS        512     /* Groups counted per probe: 3/4 of this */
+#define DENIAL_RECENT           16      /* Records remembered to drop repeats */
+#define AUTH_SKETCH_DEPTH       4       /* Count-min rows */
+#define AUTH_SKETCH_WIDTH       512     /* Counters per row */
+#define AUTH_SKETCH_BITS        1024    /* Distinct-count bitmap */
+#define AUTH_BUCKET_SECONDS     300
+#define AUTH_BUCKETS            12      /* Sliding window: one hour */
+#define AUTH_HH_CANDIDATES      16      /* Heavy-hitter candidates tracked */
+#define AUTH_TOP_REPORTED       5
+#define AUTH_BURST_FAILURES     6       /* From one source in two buckets */
+#define AUTH_SPRAY_DISTINCT     10      /* Sources or users in the window */
+#define AUDIT_LOG_DIR           "/var/log/audit"
+#define AUDIT_INDEX_STRIDE      256     /* Records per time index entry */
 
 /* Hashed username for privacy */
 typedef struct {
@@ -78,6 +92,56 @@ typedef struct {
     time_t timestamp;
 } audit_anomaly_t;
 
+/* SELinux AVC / AppArmor denials that share subject, target, class,
+ * permission and comm: one line for a policy regression, however many
+ * events it caused */
+typedef enum {
+    DENIAL_SELINUX,
+    DENIAL_APPARMOR
+} denial_source_t;
+
+typedef struct {
+    denial_source_t source;
+    char subject[96];                   /* scontext, or AppArmor profile */
+    char target[160];                   /* tcontext, or the object's name */
+    char tclass[32];                    /* tclass, or AppArmor class/operation */
+    char perms[48];                     /* "read write", or denied_mask */
+    char comm[32];
+    int  count;
+    time_t first_seen;
+    time_t last_seen;
+} denial_group_t;
+
+/* A source address or hashed user with many auth failures */
+typedef struct {
+    char key[48];
+    int  burst;                         /* Failures in the last two buckets */
+    int  window;                        /* ... in the whole sliding window */
+} auth_hitter_t;
+
+/* Auth failures per source and per user over a sliding window of
+ * AUTH_BUCKETS buckets, carried across probes (stored to disk). Every
+ * bucket is a count-min sketch and a distinct-count bitmap for each,
+ * so the size is fixed however many addresses attack. */
+typedef struct {
+    int64_t epoch;                      /* time / AUTH_BUCKET_SECONDS */
+    uint32_t failures;
+    uint32_t sources[AUTH_SKETCH_DEPTH][AUTH_SKETCH_WIDTH];
+    uint32_t users[AUTH_SKETCH_DEPTH][AUTH_SKETCH_WIDTH];
+    uint8_t source_bits[AUTH_SKETCH_BITS / 8];
+    uint8_t user_bits[AUTH_SKETCH_BITS / 8];
+} auth_bucket_t;
+
+typedef struct {
+    char magic[8];                      /* "SNTLAUTH" */
+    uint32_t version;
+    uint32_t last_serial;               /* Highest serial and time counted, */
+    int64_t last_ms;                    /* so a re-read window is not recounted */
+    auth_bucket_t buckets[AUTH_BUCKETS];
+    auth_hitter_t source_candidates[AUTH_HH_CANDIDATES];
+    auth_hitter_t user_candidates[AUTH_HH_CANDIDATES];
+} auth_sketch_t;
+
 /* Risk factor - explains why the score is what it is */
 typedef struct {
     char reason[RISK_FACTOR_REASON_LEN];
@@ -96,10 +160,20 @@ typedef struct {
     int  auth_successes;                /* We track but don't output */
     hashed_user_t failure_users[MAX_AUDIT_USERS];
     int  failure_user_count;
-    int  failure_sources;               /* Unique source addresses */
+    int  failure_sources;               /* Distinct sources in the window, estimated */
     float auth_baseline_avg;
     float auth_deviation_pct;
-    bool brute_force_detected;
+    bool brute_force_detected;          /* Burst or spray */
+    
+    /* Sliding window over probes (auth_sketch.c) */
+    int  window_failures;
+    int  window_users;                  /* Distinct users, estimated */
+    auth_hitter_t top_sources[AUTH_TOP_REPORTED];
+    int  top_source_count;
+    auth_hitter_t top_users[AUTH_TOP_REPORTED];
+    int  top_user_count;
+    bool source_burst;                  /* One source, AUTH_BURST_FAILURES+ */
+    bool distributed_spray;             /* Many sources or users */
     
     /* Privilege escalation */
     int  sudo_count;
@@ -127,6 +201,10 @@ typedef struct {
     bool selinux_enforcing;
     int  selinux_avc_denials;
     int  apparmor_denials;
+    denial_group_t denials[MAX_DENIAL_GROUPS];  /* Largest first */
+    int  denial_count;
+    int  denial_groups;                 /* Distinct groups counted */
+    int  denial_untracked;              /* Denials past the last group that fit */
     
     /* Anomalies */
     audit_anomaly_t anomalies[MAX_AUDIT_ANOMALIES];
@@ -160,16 +238,24 @@ typedef struct {
     float avg_shell_spawns;
 } audit_baseline_t;
 
+/* What a time window query cost (audit_index.c) */
+typedef struct {
+    int files;                          /* Logs in the directory */
+    int files_read;                     /* ... that overlapped the window */
+    unsigned long long bytes_total;
+    unsigned long long bytes_read;
+    unsigned long records_read;         /* Decoded */
+    unsigned long records_matched;      /* ... and inside the window */
+    unsigned long index_entries;
+} audit_window_stats_t;
+
 /* ============================================================
  * Function Prototypes
  * ============================================================ */
 
-/* Main probe function */
+/* Main probe function - the summary lives in the probe arena */
 audit_summary_t* probe_audit(int window_seconds);
 
-/* Cleanup */
-void free_audit_summary(audit_summary_t *summary);
-
 /* JSON output */
 void audit_to_json(const audit_summary_t *summary, char *buf, size_t bufsize);
 
@@ -193,4 +279,21 @@ void hash_username(const char *username, char *output, size_t outsize);
 /* Risk scoring */
 void calculate_risk_score(audit_summary_t *summary);
 
+/* Sparse time index over the logs in log_dir (audit_index.c); does
+ * nothing unless state is kept (probe_state_keep) */
+int audit_index_update(const char *log_dir);
+/* Print the records from since to until (inclusive, whole seconds) */
+int audit_window_query(const char *log_dir, time_t since, time_t until, FILE *out,
+                       audit_window_stats_t *stats);
+int audit_parse_time(const char *text, time_t *out);
+/* Auth failure sketches (auth_sketch.c) */
+void auth_sketch_load(auth_sketch_t *s);
+bool auth_sketch_save(const auth_sketch_t *s);
+void auth_sketch_add(auth_sketch_t *s, int64_t ts_ms, uint32_t serial,
+                     const char *source, const char *user);
+void auth_sketch_report(const auth_sketch_t *s, time_t now, audit_summary_t *summary);
+
+/* msg=audit(SEC.MS:SERIAL) of a raw record */
+bool audit_parse_record(const char *line, int64_t *ts_ms, uint32_t *serial);
+
 #endif /* SENTINEL_AUDIT_H */
@@ -0,0 +1,147 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * collector.h - sentinel-collector wire protocol and record format
+ *
+ * Agents and query clients talk to the collector over TCP or a UNIX
+ * stream socket, in frames:
+ *
+ *   u32 length (big-endian, counts type + payload), u8 type, payload
+ *
+ * Ingest frames get no reply, so an agent may stream them. Every query
+ * frame gets one FRAME_REPLY (JSON) or FRAME_ERROR (text); queries for
+ * different hosts may be answered out of order, so clients that
+ * pipeline them should send one host at a time.
+ *
+ * A collector started with a key file takes nothing else from a TCP
+ * client until it sends FRAME_AUTH with that key; a wrong key gets
+ * FRAME_ERROR and the connection is closed. UNIX socket clients
+ * running as root or as the collector's user need no key.
+ *
+ * A binary agent sends FRAME_RECORD: one collector_record_t as encoded
+ * by collector_record_encode(). The collector stores records in that
+ * same encoding, so its logs read the same on any architecture.
+ */
+
+#ifndef SENTINEL_COLLECTOR_H
+#define SENTINEL_COLLECTOR_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define COLLECTOR_PORT          7319
+#define COLLECTOR_FRAME_MAX     (8u << 20)  /* Type + payload */
+#define COLLECTOR_HOST_MAX      64          /* Hostname, with its NUL */
+#define COLLECTOR_RECORD_SIZE   128         /* Encoded collector_record_t */
+#define COLLECTOR_KEY_MAX       256         /* Shared key, in bytes */
+
+typedef enum {
+    FRAME_JSON = 1,             /* Fingerprint, as sentinel --json prints it */
+    FRAME_RECORD = 2,           /* Encoded collector_record_t */
+    FRAME_AUTH = 3,             /* Shared key (no reply unless wrong) */
+    FRAME_LATEST = 16,          /* hostname -> newest summary and fingerprint */
+    FRAME_RANGE = 17,           /* i64 from, i64 to (BE unix s), hostname -> summaries */
+    FRAME_HOSTS = 18,           /* (empty) -> every host and its newest probe */
+    FRAME_REPLY = 128,          /* JSON */
+    FRAME_ERROR = 129           /* Text */
+} collector_frame_t;
+
+/* What the collector keeps of each fingerprint */
+typedef struct {
+    char hostname[COLLECTOR_HOST_MAX];
+    int64_t probe_time;         /* Unix seconds */
+    float load_avg[3];
+    float mem_used_pct;
+    uint32_t processes;
+    uint32_t zombies;
+    uint32_t high_fd_processes;
+    uint32_t listeners;
+    uint32_t established;
+    uint32_t unusual_ports;
+    uint32_t rule_hits;
+    uint32_t probe_errors;
+    int32_t audit_risk_score;   /* -1 = not probed */
+} collector_record_t;
+
+static inline void collector_put_u32(unsigned char *p, uint32_t v) {
+    p[0] = (unsigned char)(v >> 24);
+    p[1] = (unsigned char)(v >> 16);
+    p[2] = (unsigned char)(v >> 8);
+    p[3] = (unsigned char)v;
+}
+
+static inline uint32_t collector_get_u32(const unsigned char *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static inline void collector_put_u64(unsigned char *p, uint64_t v) {
+    collector_put_u32(p, (uint32_t)(v >> 32));
+    collector_put_u32(p + 4, (uint32_t)v);
+}
+
+static inline uint64_t collector_get_u64(const unsigned char *p) {
+    return (uint64_t)collector_get_u32(p) << 32 | collector_get_u32(p + 4);
+}
+
+static inline void collector_put_float(unsigned char *p, float f) {
+    uint32_t v;
+    memcpy(&v, &f, sizeof(v));
+    collector_put_u32(p, v);
+}
+
+static inline float collector_get_float(const unsigned char *p) {
+    uint32_t v = collector_get_u32(p);
+    float f;
+    memcpy(&f, &v, sizeof(f));
+    return f;
+}
+
+/* Layout: hostname (NUL-padded), then big-endian probe_time, load_avg,
+ * mem_used_pct, the eight counters and audit_risk_score; the last four
+ * bytes are reserved (zero) */
+static inline void collector_record_encode(const collector_record_t *r, unsigned char *out) {
+    const uint32_t counters[8] = {
+        r->processes, r->zombies, r->high_fd_processes, r->listeners,
+        r->established, r->unusual_ports, r->rule_hits, r->probe_errors
+    };
+    size_t n = 0;
+    while (n < COLLECTOR_HOST_MAX - 1 && r->hostname[n]) n++;
+    memset(out, 0, COLLECTOR_RECORD_SIZE);
+    memcpy(out, r->hostname, n);
+    unsigned char *p = out + COLLECTOR_HOST_MAX;
+    collector_put_u64(p, (uint64_t)r->probe_time);
+    p += 8;
+    for (int i = 0; i < 3; i++, p += 4) collector_put_float(p, r->load_avg[i]);
+    collector_put_float(p, r->mem_used_pct);
+    p += 4;
+    for (int i = 0; i < 8; i++, p += 4) collector_put_u32(p, counters[i]);
+    collector_put_u32(p, (uint32_t)r->audit_risk_score);
+}
+
+/* 0, or -1 if the hostname is empty or unterminated */
+static inline int collector_record_decode(const unsigned char *in, collector_record_t *r) {
+    memset(r, 0, sizeof(*r));
+    memcpy(r->hostname, in, COLLECTOR_HOST_MAX);
+    if (r->hostname[0] == '\0' || r->hostname[COLLECTOR_HOST_MAX - 1] != '\0') return -1;
+    const unsigned char *p = in + COLLECTOR_HOST_MAX;
+    r->probe_time = (int64_t)collector_get_u64(p);
+    p += 8;
+    for (int i = 0; i < 3; i++, p += 4) r->load_avg[i] = collector_get_float(p);
+    r->mem_used_pct = collector_get_float(p);
+    p += 4;
+    uint32_t *counters[8] = {
+        &r->processes, &r->zombies, &r->high_fd_processes, &r->listeners,
+        &r->established, &r->unusual_ports, &r->rule_hits, &r->probe_errors
+    };
+    for (int i = 0; i < 8; i++, p += 4) *counters[i] = collector_get_u32(p);
+    r->audit_risk_score = (int32_t)collector_get_u32(p);
+    return 0;
+}
+
+#endif /* SENTINEL_COLLECTOR_H */
@@ -0,0 +1,138 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * compliance.h - Control evaluation over the bundled compliance catalogs
+ *
+ * The JSON catalogs in data/compliance/ are compiled by catalogc at
+ * build time into read-only tables (build/compliance_catalog.c):
+ * controls with their titles, per-framework control lists, and for
+ * each control the checks that data/compliance/mapping.conf ties to
+ * it. Evaluating a framework is then a walk over static arrays - no
+ * JSON is parsed at run time.
+ */
+
+#ifndef SENTINEL_COMPLIANCE_H
+#define SENTINEL_COMPLIANCE_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "sentinel.h"
+#include "audit.h"
+
+/* Facts Sentinel can assess, as X(enum, mapping name, description).
+ * mapping.conf refers to checks by name; catalogc rejects unknown
+ * names, so adding a check here is what makes it mappable. */
+#define COMPLIANCE_CHECKS(X) \
+    X(CHECK_CONFIG_PERMISSIONS, "config_permissions", \
+      "Monitored config files are not world-writable") \
+    X(CHECK_LISTENING_SERVICES, "listening_services", \
+      "No listeners on unexpected ports") \
+    X(CHECK_BASELINE_DRIFT, "baseline_drift", \
+      "Configs and listeners match the learned baseline") \
+    X(CHECK_AUDIT_LOGGING, "audit_logging", \
+      "auditd is running and its log is readable") \
+    X(CHECK_AUTH_FAILURES, "auth_failures", \
+      "No brute-force pattern in authentication failures") \
+    X(CHECK_UNTRUSTED_EXEC, "untrusted_execution", \
+      "No programs executed from /tmp or /dev/shm") \
+    X(CHECK_SENSITIVE_FILES, "sensitive_files", \
+      "No suspicious access to sensitive files")
+
+#define COMPLIANCE_CHECK_ENUM(e, name, desc) e,
+typedef enum {
+    COMPLIANCE_CHECKS(COMPLIANCE_CHECK_ENUM)
+    COMPLIANCE_CHECK_COUNT
+} compliance_check_t;
+#undef COMPLIANCE_CHECK_ENUM
+
+/* ============================================================
+ * Compiled Catalog (generated by catalogc)
+ * ============================================================ */
+
+/* String fields are offsets into compliance_strings */
+typedef struct {
+    uint32_t id;                /* "ac-2.1", "ac.l2-3.1.1" */
+    uint32_t label;             /* "AC-02(01)", "AC.L2-3.1.1" */
+    uint32_t title;
+    uint32_t group;             /* Family title, e.g. "Access Control" */
+    char family[4];             /* "AC" */
+    uint16_t checks_first;      /* Into compliance_control_checks */
+    uint8_t checks_count;
+} compliance_control_t;
+
+typedef struct {
+    const char *name;           /* "fedramp-moderate" */
+    uint32_t first;             /* Into compliance_framework_controls */
+    uint32_t count;
+} compliance_framework_t;
+
+extern const char compliance_strings[];
+extern const compliance_control_t compliance_controls[];
+extern const uint32_t compliance_control_count;
+extern const uint8_t compliance_control_checks[];       /* compliance_check_t */
+extern const uint16_t compliance_framework_controls[];  /* Catalog order */
+extern const compliance_framework_t compliance_frameworks[];
+extern const uint32_t compliance_framework_count;
+
+static inline const char *compliance_str(uint32_t offset) {
+    return compliance_strings + offset;
+}
+
+/* ============================================================
+ * Evaluation (compliance.c)
+ * ============================================================ */
+
+typedef enum {
+    COMPLIANCE_NOT_ASSESSED = 0,    /* No mapped check could run */
+    COMPLIANCE_PASS,
+    COMPLIANCE_FAIL
+} compliance_status_t;
+
+typedef struct {
+    compliance_status_t status;
+    char evidence[128];
+} compliance_check_result_t;
+
+typedef struct {
+    const compliance_framework_t *framework;
+    compliance_check_result_t checks[COMPLIANCE_CHECK_COUNT];
+    int controls;               /* In the framework */
+    int assessed;               /* With at least one check that ran */
+    int passed;
+    int failed;
+    double eval_ms;
+} compliance_report_t;
+
+/* Inputs the checks read; audit and baseline are optional */
+typedef struct {
+    const fingerprint_t *fp;
+    const quick_analysis_t *analysis;
+    const audit_summary_t *audit;           /* NULL if not probed */
+    const deviation_report_t *deviations;   /* NULL without a baseline */
+    int network_probed;
+} compliance_facts_t;
+
+/* Framework by name ("nist", "fedramp-moderate", "cmmc-l2", ...) */
+const compliance_framework_t *compliance_find_framework(const char *name);
+
+/* Run every check and roll the results up over the framework's
+ * controls. Returns -1 if the framework is unknown. */
+int compliance_evaluate(const char *framework, const compliance_facts_t *facts,
+                        compliance_report_t *report);
+
+/* Worst of a control's mapped checks (fail beats pass beats not run) */
+compliance_status_t compliance_control_status(const compliance_report_t *report,
+                                              const compliance_control_t *c);
+
+void compliance_print_report(const compliance_report_t *report, int verbose);
+void compliance_print_json(const compliance_report_t *report, FILE *out);
+void compliance_list_frameworks(FILE *out);
+
+#endif /* SENTINEL_COMPLIANCE_H */
@@ -0,0 +1,156 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * libsentinel.h - Embedding API (libsentinel.a / libsentinel.so)
+ *
+ * Runs sentinel's probes, analysis and serializers inside another
+ * process, with no fork/exec and no JSON round trip:
+ *
+ *   sentinel_options_t opts = { SENTINEL_API_VERSION };
+ *   opts.probes = SENTINEL_PROBE_NETWORK;
+ *   sentinel_t *s = sentinel_open(&opts);
+ *
+ *   while (running) {
+ *       sentinel_capture(s);
+ *       sentinel_summary_t sum;
+ *       sentinel_summary(s, &sum);
+ *       if (sum.severity >= SENTINEL_WARNINGS) ship(sentinel_json(s, NULL));
+ *       sleep(60);
+ *   }
+ *   sentinel_close(s);
+ *
+ * Only the functions and types here are stable: structs are only ever
+ * extended at the end, and sentinel_open() refuses an api_version it
+ * does not know. Everything a capture produces (JSON, names) stays
+ * valid until the next sentinel_capture() or sentinel_close().
+ *
+ * Probe state - rate and leak history, the probe arena, the loaded
+ * rules and plugins - is process-wide, so one handle may be open at a
+ * time, and it must not be used from two threads at once.
+ */
+
+#ifndef LIBSENTINEL_H
+#define LIBSENTINEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SENTINEL_API_VERSION 1
+
+typedef struct sentinel sentinel_t;
+
+/* Memory for the handle, the fingerprint and every per-cycle probe
+ * allocation. alloc must return memory aligned for any type. */
+typedef struct {
+    void *(*alloc)(size_t size, void *ctx);
+    void (*free)(void *ptr, void *ctx);
+    void *ctx;
+} sentinel_allocator_t;
+
+/* Optional probes, on top of system, CPU, process and config state */
+#define SENTINEL_PROBE_NETWORK  (1u << 0)   /* Listeners, connections, TCP health */
+#define SENTINEL_PROBE_AUDIT    (1u << 1)   /* auditd log summary */
+#define SENTINEL_PROBE_RULES    (1u << 2)   /* Evaluate ~/.sentinel/rules or rules_path */
+
+typedef struct {
+    int api_version;                        /* SENTINEL_API_VERSION */
+    const sentinel_allocator_t *allocator;  /* NULL = malloc/free */
+    const char *const *config_paths;        /* NULL = sentinel's defaults */
+    int config_count;
+    unsigned probes;                        /* SENTINEL_PROBE_* */
+    int audit_window_seconds;               /* 0 = 300 */
+    const char *rules_path;                 /* NULL = ~/.sentinel/rules */
+} sentinel_options_t;
+
+typedef enum {
+    SENTINEL_OK = 0,
+    SENTINEL_WARNINGS = 1,
+    SENTINEL_CRITICAL = 2,
+    SENTINEL_ERROR = 3
+} sentinel_severity_t;                      /* Same as sentinel's exit codes */
+
+typedef struct {
+    sentinel_severity_t severity;
+    int64_t probe_time;                     /* Unix seconds */
+    double probe_ms;
+    double load_avg[3];
+    double mem_used_pct;
+    double cpu_busy_pct;
+    int processes;                          /* On the host */
+    int zombies;
+    int high_fd_processes;
+    int long_running_processes;
+    int high_memory_processes;
+    int leak_suspects;
+    int config_permission_issues;
+    int listeners;                          /* 0 unless SENTINEL_PROBE_NETWORK */
+    int connections;
+    int unusual_listeners;
+    int rule_hits;
+    int audit_risk_score;                   /* -1 unless SENTINEL_PROBE_AUDIT */
+    int probe_errors;
+} sentinel_summary_t;
+
+typedef struct {
+    int32_t pid;
+    int32_t ppid;
+    const char *name;
+    char state;                             /* R, S, D, Z, T, ... */
+    uint64_t rss_bytes;
+    uint32_t open_fds;
+    uint32_t threads;
+    double cpu_percent;
+    uint64_t age_seconds;
+} sentinel_process_t;
+
+typedef struct {
+    const char *protocol;                   /* tcp, tcp6, udp, udp6 */
+    const char *address;
+    uint16_t port;
+    int32_t pid;
+    const char *process;
+} sentinel_listener_t;
+
+/* The version this library implements */
+int sentinel_api_version(void);
+
+/* NULL on a bad api_version, if a handle is already open, or if
+ * a rules file exists but does not compile */
+sentinel_t *sentinel_open(const sentinel_options_t *opts);
+void sentinel_close(sentinel_t *s);
+
+/* One probe cycle plus analysis; 0 on success, -1 if some probes
+ * failed (the rest of the snapshot is still usable) */
+int sentinel_capture(sentinel_t *s);
+
+/* Re-probe just one part of the current snapshot */
+int sentinel_probe_network(sentinel_t *s);
+int sentinel_probe_audit(sentinel_t *s, int window_seconds);
+
+/* Analysis of the current snapshot */
+int sentinel_summary(const sentinel_t *s, sentinel_summary_t *out);
+
+/* Processes and listeners of the current snapshot */
+int sentinel_process_count(const sentinel_t *s);
+int sentinel_process(const sentinel_t *s, int index, sentinel_process_t *out);
+int sentinel_listener_count(const sentinel_t *s);
+int sentinel_listener(const sentinel_t *s, int index, sentinel_listener_t *out);
+
+/* The snapshot as sentinel's JSON (audit included when probed) */
+const char *sentinel_json(sentinel_t *s, size_t *len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBSENTINEL_H */
@@ -0,0 +1,58 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * pipeline.h - Watch mode as probe -> analyze -> serialize -> emit stages
+ */
+
+#ifndef SENTINEL_PIPELINE_H
+#define SENTINEL_PIPELINE_H
+
+#include "sentinel.h"
+#include "audit.h"
+
+#define PIPELINE_SLOTS 4                /* Snapshots in flight */
+
+/* One probe cycle's results. Once the probe stage hands it on, nothing
+ * in it points at probe-owned memory: strings, per-CPU figures and
+ * plugin sections are copies, and later stages allocate from arena. */
+typedef struct {
+    fingerprint_t fp;
+    audit_summary_t audit;
+    int have_audit;             /* audit was probed */
+    quick_analysis_t analysis;  /* Analyze stage */
+    int exit_code;
+    const char *output;         /* Serialize stage, or NULL; in arena */
+
+    /* Storage fp refers to */
+    arena_t *arena;
+    strtab_t *strings;
+    cpu_usage_t *cpus;
+    int cpus_cap;
+
+    double t_start;             /* Monotonic ms: probe started ... */
+    double t_done[PIPELINE_STAGES];     /* ... and each stage finished */
+} snapshot_t;
+
+typedef struct {
+    int interval;               /* Seconds between probe starts */
+    /* On the calling thread: fill s->fp, and s->audit/have_audit */
+    void (*probe)(snapshot_t *s, void *ctx);
+    /* On the serialize thread, where probe_arena() is s->arena */
+    void (*serialize)(snapshot_t *s, void *ctx);
+    /* On the emit thread */
+    void (*emit)(const snapshot_t *s, void *ctx);
+    void *ctx;
+} pipeline_t;
+
+/* Probe every interval until *keep_running drops, while the other
+ * stages run behind on their own threads. Returns the worst exit code
+ * seen, or EXIT_ERROR if the pipeline could not be set up. */
+int pipeline_run(const pipeline_t *p, volatile int *keep_running);
+
+#endif /* SENTINEL_PIPELINE_H */
@@ -0,0 +1,87 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * plugin.h - Probe plugin interface
+ *
+ * A probe plugin describes one source of facts: how big its section
+ * is, how to fill it, how to write it out and how to compare two of
+ * them. The registry (plugin.c) does the rest for every plugin alike -
+ * scheduling by cadence and cost, running collect() under the probe
+ * watchdog, timing it, placing its section in the probe arena, and
+ * emitting it under "plugins" in the JSON.
+ *
+ * Built-in plugins are listed in plugin.c. External ones are shared
+ * objects in ~/.sentinel/plugins/ (or given with --plugin) exporting
+ *
+ *   const probe_plugin_t *sentinel_probe_plugin(void);
+ *
+ * This header has no other dependencies so modules can be built
+ * against it alone; see examples/plugins/.
+ */
+
+#ifndef SENTINEL_PLUGIN_H
+#define SENTINEL_PLUGIN_H
+
+#include <stddef.h>
+
+/* Bumped whenever probe_plugin_t changes; modules built against
+ * another version are refused */
+#define PROBE_PLUGIN_ABI 1
+
+#define PROBE_PLUGIN_SYMBOL "sentinel_probe_plugin"
+
+/* Writer handed to serialize() and diff(); each call adds one
+ * "key": value member to the plugin's JSON object. Calls go through
+ * the struct so modules need no symbols from the executable. */
+typedef struct probe_json {
+    void (*number)(struct probe_json *out, const char *key, double value);
+    void (*string)(struct probe_json *out, const char *key, const char *value);
+    void *ctx;                  /* The serializer's */
+} probe_json_t;
+
+static inline void probe_json_number(probe_json_t *out, const char *key, double value) {
+    out->number(out, key, value);
+}
+
+static inline void probe_json_string(probe_json_t *out, const char *key, const char *value) {
+    out->string(out, key, value);
+}
+
+typedef struct probe_plugin {
+    int abi;                    /* PROBE_PLUGIN_ABI */
+    const char *name;           /* JSON key and watchdog stage, [a-z0-9_] */
+    const char *description;
+    size_t section_size;        /* Bytes collect() fills */
+
+    /* Cost hints for the scheduler: expected collect() time, and how
+     * often it is worth running (every Nth cycle, 0 or 1 = each) */
+    double cost_ms;
+    int every;
+
+    /* Once, before the first collect(); non-zero disables the plugin */
+    int (*init)(void);
+
+    /* Fill a zeroed section; 0 on success. Runs on a watchdog worker,
+     * so it must not touch anything but the section and its own state */
+    int (*collect)(void *section);
+
+    /* Write the section's members */
+    void (*serialize)(const void *section, probe_json_t *out);
+
+    /* Optional: write what changed between the previous successful
+     * section and this one */
+    void (*diff)(const void *prev, const void *cur, probe_json_t *out);
+
+    /* Optional: at exit */
+    void (*teardown)(void);
+} probe_plugin_t;
+
+typedef const probe_plugin_t *(*probe_plugin_entry_fn)(void);
+
+#endif /* SENTINEL_PLUGIN_H */
@@ -14,11 +14,14 @@
 #ifndef SENTINEL_H
 #define SENTINEL_H
 
+#include <stdio.h>
 #include <stdint.h>
 #include <time.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 
+#include "plugin.h"
+
 /* Version and limits */
 #define SENTINEL_VERSION "0.6.0"
 #define MAX_PATH_LEN 4096
@@ -27,6 +30,114 @@
 #define MAX_CONFIG_FILES 64
 #define MAX_LISTENERS 128
 #define MAX_CONNECTIONS 256
+#define MAX_PROBE_ERRORS 32
+#define MAX_DELETED_FDS 16
+#define MAX_UNIX_LISTENERS 64
+#define MAX_UNIX_PROCS 16
+
+/* FD census - full breakdown only for processes above the threshold */
+#define FD_CENSUS_THRESHOLD 32          /* Open fds before we look closer */
+#define FD_CENSUS_BUDGET 16384          /* readlinkat() calls per probe cycle */
+#define FD_DELETED_INODES 4096          /* Distinct deleted files told apart per cycle */
+
+/* Watchdog deadlines - a probe cycle finishes on time with partial data */
+#define PROBE_STAGE_DEADLINE_MS 5000    /* Whole stage (processes, network...) */
+#define PROBE_ITEM_DEADLINE_MS 250      /* One item (a pid, a config file) */
+
+/* Batched procfs reads */
+#define PROCFS_SLOT_SIZE 1024           /* Per-file buffer; stat lines are ~300B */
+#define PROC_IO_SLOT_SIZE 256           /* /proc/[pid]/io is ~120B */
+#define PROCFS_BATCH_DEADLINE_MS 1000   /* Give up on io_uring after this, or
+                                           the item deadline if that is less */
+#define PROCFS_DIRBUF_SIZE 65536        /* getdents64 buffer per walk level */
+#define PROCFS_WALK_DEPTH 2             /* Nested walks, e.g. /proc then fd/ */
+#define PROCFS_DIRBUF_POOL 24           /* Buffer sets kept as threads come and go */
+
+/* Process sampling mode (--sample K) */
+#define SAMPLE_NOTABLE_MAX 256          /* Notable pids carried between cycles */
+#define SAMPLE_Z 1.96                   /* 95% confidence bounds */
+
+/* CPU sampling */
+#define CPU_SAMPLE_WINDOW_MS 200        /* Window when no previous sample */
+#define CPU_HOT_BUSY_PCT 80.0           /* A core this busy ... */
+#define CPU_HOT_GAP_PCT 50.0            /* ... and this far above the mean */
+#define CPU_SOFTIRQ_HOT_PCT 25.0        /* Softirq time worth flagging */
+
+/* ============================================================
+ * Probe Arena (arena.c)
+ * ============================================================
+ * Probe-time allocations come from a bump allocator that is reset,
+ * not freed, at the end of each probe cycle. Nothing allocated from
+ * it may be kept across arena_reset().
+ */
+
+#define ARENA_DEFAULT_CHUNK (256 * 1024)
+
+typedef struct arena arena_t;
+
+typedef struct {
+    size_t capacity;                    /* Bytes in reusable chunks */
+    size_t used;                        /* Handed out this cycle */
+    size_t high_water;                  /* Largest cycle so far */
+    size_t retired;                     /* Held back for stragglers */
+    int chunks;
+    unsigned long chunk_allocs;         /* malloc() calls, ever */
+} arena_stats_t;
+
+/* Memory for arenas and their chunks; malloc/free unless set (NULL
+ * restores them). Fails with -1 if arenas from a different allocator
+ * are still alive - the probe arena lives until exit */
+typedef void *(*arena_alloc_fn)(size_t size, void *ctx);
+typedef void (*arena_free_fn)(void *ptr, void *ctx);
+int arena_set_allocator(arena_alloc_fn alloc, arena_free_fn release, void *ctx);
+
+arena_t *arena_create(size_t chunk_size);
+void arena_destroy(arena_t *a);
+void *arena_alloc(arena_t *a, size_t size);
+void *arena_calloc(arena_t *a, size_t count, size_t size);
+void *arena_realloc(arena_t *a, void *ptr, size_t old_size, size_t new_size);
+void arena_reset(arena_t *a);           /* End of cycle: rewind, keep memory */
+void arena_get_stats(arena_t *a, arena_stats_t *stats);
+
+/* Watchdog hooks - see the straggler notes in arena.c */
+void arena_bind_thread(arena_t *a);
+void arena_taint(arena_t *a);
+void arena_straggler_done(arena_t *a);
+
+/* The arena for the current probe cycle; the caller of the cycle resets it */
+arena_t *probe_arena(void);
+
+/* Make probe_arena() return a on this thread (NULL: the shared one again) */
+void probe_arena_use(arena_t *a);
+
+/* ============================================================
+ * Interned Strings (strtab.c)
+ * ============================================================
+ * Names, paths and addresses are stored once per snapshot and
+ * referenced by id, so equal strings compare as equal integers.
+ */
+
+typedef uint32_t str_id_t;
+#define STR_EMPTY 0                     /* Always "" - zeroed structs are valid */
+#define STR_NONE UINT32_MAX             /* strtab_find(): not interned */
+
+typedef struct strtab strtab_t;
+
+strtab_t *strtab_create(void);
+void strtab_destroy(strtab_t *t);
+void strtab_reset(strtab_t *t);         /* Forget all strings, keep memory */
+str_id_t strtab_intern(strtab_t *t, const char *s);
+str_id_t strtab_intern_n(strtab_t *t, const char *s, size_t len);
+str_id_t strtab_find(strtab_t *t, const char *s);
+const char *strtab_get(const strtab_t *t, str_id_t id);
+uint32_t strtab_count(const strtab_t *t);
+size_t strtab_bytes(const strtab_t *t);
+
+/* The table probes intern into; capture_fingerprint() resets it */
+strtab_t *strtab_snapshot(void);
+
+/* Replace dst's strings with src's, keeping every id; 0 on success */
+int strtab_copy(strtab_t *dst, strtab_t *src);
 
 /* ============================================================
  * Core Data Structures - The "System Fingerprint"
@@ -47,34 +158,90 @@ typedef struct {
     uint64_t uptime_seconds;
 } system_info_t;
 
+/* CPU utilisation over the last probe interval, percent of that CPU */
+typedef struct {
+    int cpu;                    /* cpuN id, -1 for the all-CPU total */
+    float user_pct;             /* user + nice */
+    float system_pct;
+    float iowait_pct;
+    float irq_pct;
+    float softirq_pct;
+    float steal_pct;
+    float idle_pct;
+    float busy_pct;             /* 100 - idle - iowait */
+    double softirqs_per_sec;    /* From /proc/softirqs, all types */
+    double net_rx_per_sec;      /* NET_RX softirqs */
+    double net_tx_per_sec;      /* NET_TX softirqs */
+} cpu_usage_t;
+
+typedef struct {
+    int available;
+    int cpu_count;              /* Online CPUs */
+    double interval_seconds;
+    cpu_usage_t total;
+    cpu_usage_t *cpus;          /* cpu_count entries, owned by the probe;
+                                 * valid until the next probe_cpu_stats() */
+} cpu_info_t;
+
 /* Process snapshot - for detecting zombies and anomalies */
 typedef struct {
     pid_t pid;
     pid_t ppid;
-    char name[256];
+    str_id_t name;
     char state;                 /* R, S, D, Z, T, etc. */
     uint64_t rss_bytes;         /* Resident memory */
     uint64_t vsize_bytes;       /* Virtual memory */
-    time_t start_time;
+    time_t start_time;          /* Derived from uptime: may differ by 1s between reads */
+    uint64_t start_ticks;       /* starttime from stat, clock ticks since boot - exact */
     uint32_t open_fd_count;
     uint32_t thread_count;
-    double cpu_percent;
+    uint64_t cpu_ticks;         /* utime + stime, clock ticks */
+    double cpu_percent;         /* Over rate_seconds, of one CPU */
+    uint64_t io_read_bytes;     /* Storage I/O from /proc/[pid]/io, */
+    uint64_t io_write_bytes;    /* only read when top-K is enabled */
+    double io_bytes_per_sec;    /* Read + write, over rate_seconds */
+    double rate_seconds;        /* Since last cycle, or process age if new */
     /* Zombie detection fields */
     uint64_t age_seconds;       /* How long has this been running? */
     int is_potentially_stuck;   /* Heuristic flag */
+    /* FD census - filled when open_fd_count > FD_CENSUS_THRESHOLD */
+    int fd_census_done;
+    uint32_t fd_sockets;
+    uint32_t fd_pipes;
+    uint32_t fd_anon_inodes;    /* eventfd, epoll, memfd, ... */
+    uint32_t fd_files;          /* Regular files and devices */
+    uint32_t fd_deleted;        /* Open but unlinked - still using disk */
+    uint64_t fd_deleted_bytes;  /* Each file once, however many fds hold it */
+    uint64_t fd_soft_limit;     /* "Max open files"; 0 if unlimited/unknown */
 } process_info_t;
 
 /* File descriptor info - for detecting leaked handles */
 typedef struct {
     int fd;
+    pid_t pid;                  /* Process holding it open */
     char type[32];              /* file, socket, pipe, etc. */
-    char target[MAX_PATH_LEN];  /* What it points to */
+    str_id_t target;            /* What it points to */
+    uint64_t size_bytes;        /* For files: st_size of the target */
     time_t estimated_age;       /* If we can determine it */
 } fd_info_t;
 
+/* Host-wide FD census, aggregated from per-process breakdowns */
+typedef struct {
+    int processes_scanned;      /* Processes that got a full census */
+    int budget_exhausted;       /* Hit FD_CENSUS_BUDGET this cycle */
+    uint64_t sockets;
+    uint64_t pipes;
+    uint64_t anon_inodes;
+    uint64_t files;
+    uint64_t deleted;
+    uint64_t deleted_bytes;     /* Disk space held by unlinked files */
+    fd_info_t deleted_files[MAX_DELETED_FDS];   /* Largest first */
+    int deleted_file_count;
+} fd_census_t;
+
 /* Config file metadata - for drift detection */
 typedef struct {
-    char path[MAX_PATH_LEN];
+    str_id_t path;
     uint64_t size;
     time_t mtime;
     time_t ctime;
@@ -87,25 +254,58 @@ typedef struct {
 /* Network listener - for detecting unexpected open ports */
 typedef struct {
     char protocol[8];           /* tcp, tcp6, udp, udp6 */
-    char local_addr[64];        /* IP address */
+    str_id_t local_addr;        /* IP address */
     uint16_t local_port;
     char state[16];             /* LISTEN, ESTABLISHED, etc. */
     pid_t pid;                  /* Process owning this socket */
-    char process_name[256];     /* Name of owning process */
+    str_id_t process_name;      /* Name of owning process */
 } net_listener_t;
 
 /* Network connection - for detecting suspicious connections */
 typedef struct {
     char protocol[8];
-    char local_addr[64];
+    str_id_t local_addr;
     uint16_t local_port;
-    char remote_addr[64];
+    str_id_t remote_addr;
     uint16_t remote_port;
     char state[16];
     pid_t pid;
-    char process_name[256];
+    str_id_t process_name;
 } net_connection_t;
 
+/* UNIX domain socket in the listening state */
+typedef struct {
+    str_id_t path;              /* sun_path; abstract names start with '@' */
+    char type[12];              /* stream, dgram, seqpacket */
+    pid_t pid;
+    str_id_t process_name;
+} unix_listener_t;
+
+/* Per-process UNIX socket usage */
+typedef struct {
+    pid_t pid;
+    str_id_t process_name;
+    int socket_count;
+} unix_proc_t;
+
+/* Kernel socket accounting from /proc/net/sockstat{,6} and tcp_mem */
+typedef struct {
+    int sockets_used;
+    int tcp_inuse;
+    int tcp_orphan;
+    int tcp_time_wait;
+    int tcp_alloc;
+    int tcp6_inuse;
+    int udp_inuse;
+    int udp6_inuse;
+    uint64_t tcp_mem_pages;     /* Pages allocated to TCP buffers now */
+    uint64_t udp_mem_pages;
+    uint64_t tcp_mem_min;       /* net.ipv4.tcp_mem thresholds, in pages */
+    uint64_t tcp_mem_pressure;
+    uint64_t tcp_mem_max;
+    int tcp_mem_under_pressure; /* tcp_mem_pages >= tcp_mem_pressure */
+} socket_mem_t;
+
 /* Network summary */
 typedef struct {
     net_listener_t listeners[MAX_LISTENERS];
@@ -115,21 +315,300 @@ typedef struct {
     int total_established;
     int total_listening;
     int unusual_port_count;     /* Ports not in common list */
+    /* UNIX domain sockets */
+    unix_listener_t unix_listeners[MAX_UNIX_LISTENERS];
+    int unix_listener_count;
+    int unix_socket_total;
+    unix_proc_t unix_procs[MAX_UNIX_PROCS];   /* Heaviest users first */
+    int unix_proc_count;
+    socket_mem_t sockmem;
 } network_info_t;
 
+/* TCP/IP stack health counters from /proc/net/snmp and /proc/net/netstat */
+typedef enum {
+    TCP_CTR_IN_SEGS = 0,        /* Tcp: InSegs */
+    TCP_CTR_OUT_SEGS,           /* Tcp: OutSegs */
+    TCP_CTR_RETRANS_SEGS,       /* Tcp: RetransSegs */
+    TCP_CTR_IN_ERRS,            /* Tcp: InErrs */
+    TCP_CTR_OUT_RSTS,           /* Tcp: OutRsts */
+    TCP_CTR_ATTEMPT_FAILS,      /* Tcp: AttemptFails */
+    TCP_CTR_ESTAB_RESETS,       /* Tcp: EstabResets */
+    TCP_CTR_LISTEN_OVERFLOWS,   /* TcpExt: ListenOverflows */
+    TCP_CTR_LISTEN_DROPS,       /* TcpExt: ListenDrops */
+    TCP_CTR_TIMEOUTS,           /* TcpExt: TCPTimeouts */
+    TCP_CTR_SYN_RETRANS,        /* TcpExt: TCPSynRetrans */
+    TCP_CTR_ABORT_ON_MEMORY,    /* TcpExt: TCPAbortOnMemory */
+    TCP_CTR_BACKLOG_DROP,       /* TcpExt: TCPBacklogDrop */
+    TCP_CTR_IP_IN_DISCARDS,     /* Ip: InDiscards */
+    TCP_CTR_UDP_IN_ERRORS,      /* Udp: InErrors */
+    TCP_CTR_UDP_RCVBUF_ERRORS,  /* Udp: RcvbufErrors */
+    TCP_CTR_COUNT
+} tcp_counter_t;
+
+typedef struct {
+    int available;              /* Parsed at least /proc/net/snmp */
+    int has_delta;              /* A previous sample existed */
+    double interval_seconds;    /* Time since the previous sample */
+    uint64_t totals[TCP_CTR_COUNT];     /* Since boot */
+    uint64_t deltas[TCP_CTR_COUNT];     /* Since the previous sample */
+    double rates[TCP_CTR_COUNT];        /* deltas / interval, per second */
+    double retrans_percent;     /* RetransSegs / OutSegs over the interval */
+} tcp_health_t;
+
+/* A population total scaled up from a sample, with 95% bounds */
+typedef struct {
+    double estimate;
+    double low;
+    double high;
+} sample_estimate_t;
+
+/* Stratified process sampling - see capture_fingerprint() */
+typedef struct {
+    int enabled;
+    int cycles;                 /* Whole table covered every this many cycles */
+    int stratum;                /* Which 1/cycles slice was read this time */
+    int population;             /* Pids enumerated from /proc */
+    int sampled;                /* Probed from the rotating slice */
+    int carried;                /* Probed because flagged notable before */
+    sample_estimate_t zombies;
+    sample_estimate_t high_fd;
+    sample_estimate_t stuck;
+    sample_estimate_t threads;
+} process_sampling_t;
+
+/* Top-K resource consumers (--top K) */
+#define TOPK_DEFAULT 5
+#define TOPK_MAX 32
+
+typedef enum {
+    TOPK_RSS,
+    TOPK_CPU,
+    TOPK_FDS,
+    TOPK_THREADS,
+    TOPK_IO,
+    TOPK_METRIC_COUNT
+} topk_metric_t;
+
+typedef struct {
+    int proc;                   /* Index into fingerprint_t.processes */
+    double value;
+} topk_entry_t;
+
+/* Largest first; count[m] <= k */
+typedef struct {
+    int k;                      /* 0 = disabled */
+    int count[TOPK_METRIC_COUNT];
+    topk_entry_t entries[TOPK_METRIC_COUNT][TOPK_MAX];
+} process_topk_t;
+
+/* Process thresholds shared by quick analysis and the JSON filter */
+#define PROC_HIGH_FD 100                /* Open fds worth flagging */
+#define PROC_FD_SANE_MAX 100000         /* Above this the count was unreadable */
+#define PROC_LONG_RUNNING_SECS (7 * 24 * 3600)
+#define PROC_VERY_LONG_SECS (30 * 24 * 3600)
+#define PROC_HIGH_RSS_KB (1024 * 1024)   /* 1 GiB */
+
+/* Why a process is notable, highest priority first; 0 = not notable */
+typedef enum {
+    PROC_FLAG_NONE = 0,
+    PROC_FLAG_ZOMBIE,
+    PROC_FLAG_HIGH_FD,
+    PROC_FLAG_STUCK,
+    PROC_FLAG_VERY_LONG,
+    PROC_FLAG_HIGH_MEMORY
+} proc_flag_t;
+
+/* Column-oriented copy of the hot process_info_t fields. Threshold
+ * passes read one contiguous array instead of striding over whole
+ * structs. Columns are 32 bits or less (SSE2 has no 64-bit compare)
+ * and rows past count stay zero, which matches no threshold, so the
+ * loops can run over all MAX_PROCS rows and vectorise at -O2.
+ * Index i matches fingerprint_t.processes[i]. */
+typedef struct {
+    int count;
+    char state[MAX_PROCS];
+    uint8_t stuck[MAX_PROCS];
+    uint8_t flag[MAX_PROCS];            /* proc_flag_t */
+    uint32_t fd_count[MAX_PROCS];
+    uint32_t threads[MAX_PROCS];
+    uint32_t rss_kb[MAX_PROCS];
+    uint32_t age_seconds[MAX_PROCS];    /* Saturates at ~136 years */
+} process_columns_t;
+
+/* Slow-leak detection: a decaying least-squares fit of fd count and
+ * RSS against time, per (pid, start_ticks), carried between cycles */
+#define LEAK_TRACK_MAX 2048             /* Processes with history */
+#define LEAK_REPORT_MAX 16
+#define LEAK_DECAY 0.95                 /* Per sample; ~20-sample memory */
+#define LEAK_MIN_SAMPLES 8
+#define LEAK_T_MIN 4.0                  /* Slope t-statistic to flag */
+#define LEAK_MIN_FD_GROWTH 8.0          /* fds over the fitted window */
+#define LEAK_MIN_RSS_GROWTH_KB 16384.0  /* 16 MB over the fitted window */
+#define LEAK_STALE_SECS 3600            /* Forget pids unseen this long */
+#define LEAK_SAVE_SECS 300              /* Rewrite the state file this often */
+
+typedef enum {
+    LEAK_FDS,
+    LEAK_RSS
+} leak_resource_t;
+
+typedef struct {
+    pid_t pid;
+    str_id_t name;
+    leak_resource_t resource;
+    double current;             /* fds, or RSS bytes */
+    double slope_per_hour;      /* Same unit per hour */
+    double t_stat;
+    int samples;
+    double limit;               /* fd soft limit, or RSS + MemAvailable; 0 = none */
+    double seconds_to_limit;    /* -1 when there is no finite limit */
+} leak_suspect_t;
+
+typedef struct {
+    int tracked;                /* Processes with history */
+    int count;
+    leak_suspect_t suspects[LEAK_REPORT_MAX];   /* Soonest to hit a limit first */
+} leak_report_t;
+
+/* Zombie attribution: zombies grouped by parent, with each zombie's
+ * first sighting carried across cycles to time how long reaping takes */
+#define ZOMBIE_TRACK_MAX 4096           /* Zombies with a first-seen time */
+#define ZOMBIE_PARENT_MAX 16
+
+typedef struct {
+    pid_t ppid;
+    str_id_t name;
+    int zombies;                /* Unreaped children right now */
+    double oldest_seconds;      /* Longest any of them has been seen */
+    int reaped;                 /* Children reaped since last cycle */
+    double reap_mean_seconds;
+    double reap_max_seconds;
+} zombie_parent_t;
+
+typedef struct {
+    int zombies;
+    int parent_count;           /* Distinct parents holding zombies */
+    int reaped;                 /* Host-wide, since last cycle */
+    double reap_mean_seconds;
+    double reap_max_seconds;
+    int count;
+    zombie_parent_t parents[ZOMBIE_PARENT_MAX];  /* Most zombies first */
+} zombie_report_t;
+
+/* Detection rules: user conditions over fingerprint fields, compiled
+ * to bytecode at load (rules.c). Hits point into the loaded rule set. */
+#define RULES_MAX 512
+#define RULE_NAME_LEN 48
+#define RULE_TEXT_LEN 160
+#define RULE_HITS_MAX 64
+
+typedef enum {
+    RULE_INFO = 0,
+    RULE_WARNING,
+    RULE_CRITICAL
+} rule_severity_t;
+
+typedef struct {
+    const char *name;
+    const char *text;           /* The rule's expression */
+    rule_severity_t severity;
+} rule_hit_t;
+
+typedef struct {
+    int loaded;                 /* Rules in the set; 0 = none configured */
+    int count;
+    int critical;
+    int warnings;
+    double eval_us;
+    rule_hit_t hits[RULE_HITS_MAX];     /* In rule file order */
+} rule_report_t;
+
+/* Probe plugins (plugin.h): one section per registered plugin, in
+ * registration order. Sections live in the probe arena. */
+#define PROBE_PLUGINS_MAX 32
+#define PROBE_PLUGIN_BUDGET_MS 200      /* Expected plugin time per cycle */
+
+typedef enum {
+    PLUGIN_OK = 0,
+    PLUGIN_FAILED,              /* collect() failed or overran its deadline */
+    PLUGIN_SKIPPED,             /* Not due this cycle (its "every") */
+    PLUGIN_DEFERRED             /* Over the cycle budget; runs first next time */
+} plugin_status_t;
+
+typedef struct {
+    const probe_plugin_t *plugin;
+    plugin_status_t status;
+    void *section;              /* NULL unless PLUGIN_OK */
+    const void *prev;           /* Last successful section before it, or NULL */
+    double elapsed_ms;
+    double mean_ms;             /* Over every run so far */
+    unsigned long runs;
+    unsigned long failures;
+} plugin_section_t;
+
+typedef struct {
+    int count;
+    plugin_section_t sections[PROBE_PLUGINS_MAX];
+} plugin_report_t;
+
+/* Watch mode runs probe, analyze, serialize and emit on separate
+ * threads (pipeline.c); this is how the stages behind the probe were
+ * keeping up when the snapshot was taken */
+#define PIPELINE_STAGES 4               /* probe, analyze, serialize, emit */
+
+typedef struct {
+    int active;                 /* Snapshot came through the pipeline */
+    int slots;                  /* Snapshots in flight at most */
+    int queued[PIPELINE_STAGES - 1];    /* Waiting for analyze/serialize/emit */
+    int queued_max[PIPELINE_STAGES - 1];/* Most ever waiting */
+    unsigned long cycles;
+    unsigned long dropped;      /* Probes skipped: every snapshot in flight */
+    double stage_ms[PIPELINE_STAGES];   /* Previous snapshot, per stage */
+    double lag_ms;              /* Previous snapshot: probed to emitted */
+} pipeline_stats_t;
+
+/* Probe failure record - why part of the fingerprint is missing */
+typedef struct {
+    char stage[16];             /* "system", "processes", "configs", "network" */
+    int item;                   /* pid or config index, -1 for the whole stage */
+    char reason[96];
+    double elapsed_ms;          /* How long we waited before giving up */
+} probe_error_t;
+
 /* The complete system fingerprint */
 typedef struct {
     system_info_t system;
+    cpu_info_t cpu;
     process_info_t processes[MAX_PROCS];
     int process_count;
+    int process_total;          /* On the host; above process_count when sampling */
+    process_sampling_t sampling;
+    process_columns_t proc_cols;        /* Built from processes[] by the probe */
+    process_topk_t topk;
     config_file_t configs[MAX_CONFIG_FILES];
     int config_count;
     network_info_t network;
+    fd_census_t fd_census;
+    tcp_health_t tcp_health;
+    leak_report_t leaks;
+    zombie_report_t zombies;
+    rule_report_t rules;            /* Filled by rules_evaluate() */
+    plugin_report_t plugins;
+    pipeline_stats_t pipeline;      /* Watch mode only */
     /* Metadata about the probe itself */
     double probe_duration_ms;
     int probe_errors;
+    probe_error_t error_log[MAX_PROBE_ERRORS];
+    int error_log_count;
+    /* Names, paths and addresses referenced by the str_id_t fields */
+    strtab_t *strings;
 } fingerprint_t;
 
+/* Text of an interned field, e.g. fp_str(fp, proc->name) */
+static inline const char *fp_str(const fingerprint_t *fp, str_id_t id) {
+    return strtab_get(fp->strings, id);
+}
+
 /* ============================================================
  * Prober Functions - Gather System State
  * ============================================================ */
@@ -139,28 +618,236 @@ int fingerprint_init(fingerprint_t *fp);
 
 /* Probe system basics: hostname, kernel, memory, load */
 int probe_system_info(system_info_t *info);
+int probe_cpu_stats(cpu_info_t *info);
 
 /* Probe running processes from /proc */
 int probe_processes(process_info_t *procs, int max_procs, int *count);
+int probe_process_stat(pid_t pid, process_info_t *proc);
+
+/* ============================================================
+ * Procfs Reader (procfs.c)
+ * ============================================================ */
+
+typedef enum {
+    PROCFS_BACKEND_AUTO = 0,    /* io_uring if the kernel allows it */
+    PROCFS_BACKEND_SYNC,
+    PROCFS_BACKEND_URING
+} procfs_backend_t;
+
+typedef struct {
+    procfs_backend_t backend;   /* What actually ran */
+    uint64_t files;
+    uint64_t syscalls;          /* Issued by the reader itself */
+    double wall_ms;
+} procfs_stats_t;
+
+void procfs_set_backend(procfs_backend_t backend);
+int procfs_uring_available(void);
+
+/* Nonzero if procfs_read_batch() would use io_uring rather than read
+ * file by file on the calling thread */
+int procfs_batch_async(void);
+
+/* Read /proc/<pid>/<name> for each pid into bufs (buf_size bytes per
+ * pid, NUL-terminated); lens[i] is the length or -1. Returns the
+ * number of files read. */
+int procfs_read_batch(const int *pids, int count, const char *name,
+                      char *bufs, size_t buf_size, int *lens,
+                      procfs_stats_t *stats);
+
+/* Directory walk callback; return nonzero to stop early */
+typedef int (*procfs_dirent_fn)(int dirfd, const char *name,
+                                unsigned char d_type, void *arg);
+
+/* Walk an open directory with raw getdents64 ("." and ".." skipped).
+ * fn may be NULL to just count. Returns entries seen, or -1. */
+int procfs_walk_dir(int dirfd, procfs_dirent_fn fn, void *arg);
+int procfs_count_dir(int dirfd);
+
+/* Digits-only name to int (pids, fd numbers); -1 if not numeric */
+int procfs_parse_uint(const char *name);
+
+/* Pids in /proc: into a fixed array, or a growing heap array */
+int procfs_list_pids(int *pids, int max);
+int procfs_list_pids_alloc(int **pids, int *cap);
+
+/* Time both backends over every pid's stat file and print the result */
+int procfs_benchmark(int rounds);
+
+/* ============================================================
+ * Procfs Record/Replay (pfs.c)
+ * ============================================================ */
+
+typedef enum {
+    PFS_LIVE = 0,
+    PFS_RECORD,                 /* Read live, append each read to the archive */
+    PFS_REPLAY                  /* Serve reads from the archive */
+} pfs_mode_t;
+
+/* Switch modes before the first probe; err gets the reason on -1 */
+int pfs_record(const char *path, char *err, size_t err_size);
+int pfs_replay(const char *path, char *err, size_t err_size);
+pfs_mode_t pfs_mode(void);
+int pfs_active(void);
+void pfs_close(void);
+
+/* Whole file into buf (NUL-terminated, size - 1 bytes at most);
+ * length or -1 */
+ssize_t pfs_read(const char *path, char *buf, size_t size);
+FILE *pfs_fopen(const char *path);
+
+/* Directory fds for procfs_walk_dir() and the *at() calls below */
+int pfs_opendir(const char *path);
+int pfs_opendirat(int dirfd, const char *name);
+void pfs_closedir(int dirfd);
+int pfs_rewinddir(int dirfd);
+int pfs_walk_dir(int dirfd, procfs_dirent_fn fn, void *arg);
+ssize_t pfs_readlinkat(int dirfd, const char *name, char *buf, size_t size);
+int pfs_fstatat(int dirfd, const char *name, struct stat *st);
+
+/* Config files: stat fields and checksum only, never contents */
+int pfs_stat(const char *path, struct stat *st);
+int pfs_sha256_file(const char *path, char *out, size_t out_size);
+
+/* Read only a rotating 1/cycles of the process table (plus anything
+ * notable last time) per capture; 0 restores full scans */
+void process_sampling_set(int cycles);
+
+/* Length of each top-K list (0 disables them and the /proc/[pid]/io
+ * reads); clamped to TOPK_MAX */
+void process_topk_set(int k);
+int process_topk_get(void);
+
+/* Add this cycle's fd/RSS samples to the per-process fits and fill
+ * fp->leaks (leak.c); see probe_state_keep() for persistence */
+void leak_track_update(fingerprint_t *fp);
+
+/* Group this cycle's zombies by parent and time reaping into
+ * fp->zombies (zombie.c); see probe_state_keep() for persistence */
+void zombie_track_update(fingerprint_t *fp);
+
+/* Compile a rules file, replacing any loaded set. Returns the rule
+ * count, or -1 with "file:line: reason" in err (rules.c) */
+int rules_load(const char *path, char *err, size_t err_size);
+int rules_loaded(void);
+
+/* Nonzero if a loaded rule reads listeners, connections or network.*,
+ * so the network probe must run for it to mean anything */
+int rules_need_network(void);
+
+/* Evaluate the loaded rules against fp into fp->rules, after every
+ * probe of the cycle has run */
+void rules_evaluate(fingerprint_t *fp);
+const char *rule_severity_name(rule_severity_t s);
+
+/* Register a plugin (built-ins are registered on first use); runs
+ * its init(). 0 on success, -1 with the reason in err (plugin.c) */
+int plugin_register(const probe_plugin_t *p, char *err, size_t err_size);
+
+/* dlopen() a module and register the plugin it exports */
+int plugin_load(const char *path, char *err, size_t err_size);
+
+/* Load every *.so in dir; failures are reported on stderr. The
+ * directory and each module must be owned by the effective user and
+ * not group or world writable, or they are skipped. Returns the
+ * number loaded */
+int plugin_load_dir(const char *dir);
+
+/* Run the plugins due this cycle into fp->plugins (capture_fingerprint
+ * does this) */
+void capture_plugins(fingerprint_t *fp);
+
+void plugins_list(FILE *out);
+void plugins_teardown(void);
+
+/* Fill fp->topk from fp->processes in one pass (topk.c) */
+void select_top_consumers(fingerprint_t *fp);
+const char *topk_metric_name(topk_metric_t m);
 
 /* Probe specific config files for drift detection */
 int probe_config_files(const char **paths, int path_count, 
                        config_file_t *configs, int *config_count);
 
+/* Config files probed when none are given (NULL-terminated) */
+extern const char *default_config_paths[];
+
 /* Full fingerprint capture */
 int capture_fingerprint(fingerprint_t *fp, const char **config_paths, 
                         int config_path_count);
 
+/* Fill fp->proc_cols from fp->processes (capture_fingerprint() does this) */
+void build_process_columns(fingerprint_t *fp);
+
 /* Probe network state */
 int probe_network(network_info_t *net);
 
+/* Probe network state into fp->network under the watchdog */
+int capture_network(fingerprint_t *fp);
+
+/* Read TCP/IP stack counters since boot into th->totals */
+int probe_tcp_health(tcp_health_t *th);
+
+/* Fill deltas against the previous sample (in-process in watch mode,
+ * from tcp_stats.dat in the baseline directory otherwise) */
+void tcp_health_delta(tcp_health_t *th);
+
+/* Counter name as it appears in /proc, e.g. "RetransSegs" */
+const char *tcp_counter_name(tcp_counter_t ctr);
+
+/* ============================================================
+ * Probe Watchdog - Deadlines for stages and items
+ * ============================================================
+ * Stages run on worker threads. An item that overruns its deadline
+ * is abandoned (its worker is left blocked in the kernel) and recorded
+ * in fp->error_log; the stage resumes with the next item. Anything a
+ * worker may touch after being abandoned (ctx, stage args) must outlive
+ * the call - static storage or heap, never the caller's stack.
+ */
+
+/* Probe one item: fill out, return 0 to keep it, non-zero to drop it */
+typedef int (*probe_item_fn)(const void *ctx, int key, void *out);
+
+/* Probe a whole stage into out, return 0 on success */
+typedef int (*probe_stage_fn)(void *arg, void *out);
+
+/* Run item_fn for each key; kept results are packed into outputs */
+int watchdog_run_items(fingerprint_t *fp, const char *stage,
+                       probe_item_fn item_fn, const void *ctx,
+                       const int *keys, int count,
+                       void *outputs, size_t out_size, int *kept);
+
+/* Run fn once; out is only written if it finishes within the deadline */
+int watchdog_run_stage(fingerprint_t *fp, const char *stage,
+                       probe_stage_fn fn, void *arg,
+                       void *out, size_t out_size);
+
+/* Override the default deadlines (<= 0 keeps the current value) */
+void watchdog_set_deadlines(int stage_ms, int item_ms);
+
+/* The per-item deadline currently in force */
+int watchdog_item_deadline_ms(void);
+
+/* Monotonic clock in milliseconds */
+double watchdog_now_ms(void);
+
+/* Record a probe failure in the fingerprint */
+void probe_error_add(fingerprint_t *fp, const char *stage, int item,
+                     double elapsed_ms, const char *reason);
+
 /* ============================================================
  * Serialization - Convert to JSON for LLM
  * ============================================================ */
 
-/* Serialize fingerprint to JSON string (caller must free) */
+/* Serialize fingerprint to JSON (probe arena; valid until the next reset) */
 char* fingerprint_to_json(const fingerprint_t *fp);
 
+/* Re-emit a finished fingerprint document with a "section_digests"
+ * manifest (SHA-256 of each top-level object/array as printed). Sections
+ * whose digest occurs in known (whitespace-separated hex, may be NULL)
+ * are listed in the manifest but left out. Probe arena; returns json
+ * itself if it cannot be parsed. */
+char* json_add_section_digests(char *json, const char *known);
+
 /* ============================================================
  * Sanitization - Strip sensitive data before sending to LLM
  * ============================================================ */
@@ -180,10 +867,18 @@ typedef struct {
     int zombie_process_count;
     int high_fd_process_count;      /* Processes with >100 open fds */
     int long_running_process_count; /* Running >7 days */
+    int leak_suspects;              /* Significant fd/RSS growth */
+    int high_memory_process_count;  /* RSS above 1 GiB */
     int config_permission_issues;   /* World-writable, etc. */
     int config_drift_detected;      /* Checksums differ from expected */
     int unusual_listeners;          /* Ports not in common services list */
     int external_connections;       /* Connections to non-local IPs */
+    int deleted_open_files;         /* Unlinked files still held open */
+    uint64_t deleted_open_bytes;    /* Disk space they pin */
+    int imbalanced_cpus;            /* Cores saturated while others idle */
+    int softirq_hot_cpus;           /* Cores spending >25% in softirq */
+    int hottest_cpu;                /* cpuN id, -1 if none */
+    float hottest_cpu_busy;
     int total_issues;               /* Sum of all issues for exit code */
 } quick_analysis_t;
 
@@ -195,6 +890,11 @@ typedef struct {
 
 int analyze_fingerprint_quick(const fingerprint_t *fp, quick_analysis_t *result);
 
+/* EXIT_OK, EXIT_WARNINGS or EXIT_CRITICAL for an analysed fingerprint,
+ * including rule hits; audit_risk_score is -1 when audit was not probed */
+int analysis_exit_code(const fingerprint_t *fp, const quick_analysis_t *a,
+                       int audit_risk_score);
+
 /* ============================================================
  * Baseline Learning - Detect deviations from "normal"
  * ============================================================ */
@@ -236,6 +936,11 @@ typedef struct {
     } expected_configs[MAX_BASELINE_CONFIGS];
     int expected_config_count;
     
+    /* Normal TCP stack event rates, per second (version 2+) */
+    int tcp_rate_samples;
+    double tcp_rate_avg[TCP_CTR_COUNT];
+    double tcp_rate_max[TCP_CTR_COUNT];
+    
 } baseline_t;
 
 /* Deviation report */
@@ -246,6 +951,7 @@ typedef struct {
     int process_count_anomaly;  /* Outside normal range */
     int memory_anomaly;         /* Higher than normal */
     int load_anomaly;           /* Higher than normal */
+    int tcp_anomalies;          /* Stack counters rising faster than normal */
     
     /* Details */
     uint16_t new_ports[32];
@@ -254,12 +960,24 @@ typedef struct {
     int missing_port_count;
     char changed_configs[8][256];
     int changed_config_count;
+    tcp_counter_t tcp_anomaly_counters[TCP_CTR_COUNT];
+    double tcp_anomaly_rates[TCP_CTR_COUNT];
     
     int total_deviations;
 } deviation_report_t;
 
 /* Baseline functions */
 void baseline_init(baseline_t *b);
+int baseline_state_path(const char *filename, char *path, size_t path_size);
+void baseline_state_lookup(const char *filename, char *path, size_t path_size);
+
+/* Cross-run probe state files: probe_state_path() fails unless
+ * probe_state_keep(1) was called (watch mode, --keep-state) */
+void probe_state_keep(int keep);
+int probe_state_path(const char *filename, char *path, size_t path_size);
+
+/* CLOCK_BOOTTIME in seconds (monotonic if unavailable) */
+double boottime_seconds(void);
 int baseline_load(baseline_t *b);
 int baseline_save(const baseline_t *b);
 int baseline_learn(baseline_t *b, const fingerprint_t *fp);
@@ -282,5 +1000,6 @@ void config_print(void);
 
 int sha256_file(const char *path, char *out, size_t out_size);
 int sha256_string(const char *str, char *out, size_t out_size);
+int sha256_buffer(const void *data, size_t len, char *out, size_t out_size);
 
 #endif /* SENTINEL_H */
@@ -0,0 +1,309 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * arena.c - Bump allocator for one probe cycle
+ *
+ * Everything a probe cycle allocates (hash maps, the JSON buffer, the
+ * audit summary) comes from one arena and is given back all at once by
+ * arena_reset() at the end of the cycle. Chunks are kept and reused, and
+ * after a cycle that needed more than one they are merged into a single
+ * chunk of the high-water size, so the watch loop settles into zero
+ * malloc/free traffic.
+ *
+ * Watchdog stragglers complicate "reset": an abandoned worker may wake
+ * up cycles later and keep writing into what it allocated. So:
+ *   - arena_taint() (on abandonment) makes the next reset retire every
+ *     chunk instead of reusing it; retired chunks are only freed once
+ *     arena_straggler_done() says no abandoned worker is left.
+ *   - a worker calls arena_bind_thread() before each item; if it is
+ *     still allocating after the cycle it belonged to has been reset,
+ *     it gets plain heap memory that is never freed (bounded by
+ *     MAX_STUCK_WORKERS) rather than memory the new cycle owns.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "sentinel.h"
+
+#define ARENA_ALIGN 16
+
+/* Four words, so data[] keeps malloc's 16-byte alignment */
+typedef struct arena_chunk {
+    struct arena_chunk *next;
+    size_t size;
+    size_t used;
+    size_t pad;
+    unsigned char data[];
+} arena_chunk_t;
+
+struct arena {
+    pthread_mutex_t lock;
+    arena_chunk_t *chunks;              /* Owned by the current cycle */
+    arena_chunk_t *current;             /* Where the next allocation goes */
+    arena_chunk_t *retired;             /* Possibly still used by stragglers */
+    size_t min_chunk;
+    size_t used;                        /* Bytes handed out this cycle */
+    size_t high_water;                  /* Largest cycle so far */
+    unsigned epoch;                     /* Bumped by every reset */
+    int retire_pending;                 /* A worker was abandoned this cycle */
+    int stragglers;                     /* Abandoned workers still running */
+    unsigned long chunk_allocs;         /* malloc() calls for chunks, ever */
+};
+
+/* Epoch a worker thread's current item started in; 0 = not a worker */
+static __thread unsigned t_epoch;
+
+/* Where arenas and their chunks come from (libsentinel embedders can
+ * supply their own) */
+static void *heap_alloc(size_t size, void *ctx) {
+    (void)ctx;
+    return malloc(size);
+}
+
+static void heap_release(void *ptr, void *ctx) {
+    (void)ctx;
+    free(ptr);
+}
+
+static arena_alloc_fn g_alloc = heap_alloc;
+static arena_free_fn g_release = heap_release;
+static void *g_alloc_ctx;
+static int g_arenas_live;
+
+int arena_set_allocator(arena_alloc_fn alloc, arena_free_fn release, void *ctx) {
+    if (!alloc || !release) {
+        alloc = heap_alloc;
+        release = heap_release;
+        ctx = NULL;
+    }
+    /* Live arenas must be given back to whoever they came from */
+    if (g_arenas_live > 0) {
+        return alloc == g_alloc && release == g_release && ctx == g_alloc_ctx ? 0 : -1;
+    }
+    g_alloc = alloc;
+    g_release = release;
+    g_alloc_ctx = ctx;
+    return 0;
+}
+
+static size_t align_up(size_t n) {
+    return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+static arena_chunk_t *chunk_new(arena_t *a, size_t size) {
+    arena_chunk_t *c = g_alloc(sizeof(*c) + size, g_alloc_ctx);
+    if (!c) return NULL;
+    c->next = NULL;
+    c->size = size;
+    c->used = 0;
+    a->chunk_allocs++;
+    return c;
+}
+
+static void chunk_list_free(arena_chunk_t *c) {
+    while (c) {
+        arena_chunk_t *next = c->next;
+        g_release(c, g_alloc_ctx);
+        c = next;
+    }
+}
+
+arena_t *arena_create(size_t chunk_size) {
+    arena_t *a = g_alloc(sizeof(*a), g_alloc_ctx);
+    if (!a) return NULL;
+    memset(a, 0, sizeof(*a));
+    g_arenas_live++;
+    a->min_chunk = chunk_size ? align_up(chunk_size) : ARENA_DEFAULT_CHUNK;
+    a->epoch = 1;
+    pthread_mutex_init(&a->lock, NULL);
+    return a;
+}
+
+void arena_destroy(arena_t *a) {
+    if (!a) return;
+    chunk_list_free(a->chunks);
+    chunk_list_free(a->retired);
+    pthread_mutex_destroy(&a->lock);
+    g_release(a, g_alloc_ctx);
+    g_arenas_live--;
+}
+
+/* Caller holds the lock */
+static void *bump(arena_t *a, size_t size) {
+    size = align_up(size ? size : 1);
+    arena_chunk_t *c = a->current;
+
+    /* Chunks after current are left over from a bigger cycle */
+    while (c && c->used + size > c->size) {
+        c = c->next;
+        if (c) c->used = 0;
+    }
+    if (!c) {
+        size_t want = size > a->min_chunk ? size : a->min_chunk;
+        c = chunk_new(a, want);
+        if (!c) return NULL;
+        arena_chunk_t **tail = &a->chunks;
+        while (*tail) tail = &(*tail)->next;
+        *tail = c;
+    }
+    a->current = c;
+
+    void *p = c->data + c->used;
+    c->used += size;
+    a->used += size;
+    return p;
+}
+
+void *arena_alloc(arena_t *a, size_t size) {
+    if (!a) return NULL;
+
+    pthread_mutex_lock(&a->lock);
+    if (t_epoch && t_epoch != a->epoch) {
+        /* A straggler from a cycle that has been reset */
+        pthread_mutex_unlock(&a->lock);
+        return g_alloc(size ? size : 1, g_alloc_ctx);
+    }
+    void *p = bump(a, size);
+    pthread_mutex_unlock(&a->lock);
+    return p;
+}
+
+void *arena_calloc(arena_t *a, size_t count, size_t size) {
+    if (size && count > SIZE_MAX / size) return NULL;
+    void *p = arena_alloc(a, count * size);
+    if (p) memset(p, 0, count * size);
+    return p;
+}
+
+void *arena_realloc(arena_t *a, void *ptr, size_t old_size, size_t new_size) {
+    if (!ptr) return arena_alloc(a, new_size);
+    if (new_size <= old_size) return ptr;
+
+    /* The most recent allocation can usually grow where it is */
+    pthread_mutex_lock(&a->lock);
+    arena_chunk_t *c = a->current;
+    if (!t_epoch || t_epoch == a->epoch) {
+        size_t old_aligned = align_up(old_size ? old_size : 1);
+        size_t new_aligned = align_up(new_size);
+        if (c && (unsigned char *)ptr + old_aligned == c->data + c->used &&
+            c->used - old_aligned + new_aligned <= c->size) {
+            c->used += new_aligned - old_aligned;
+            a->used += new_aligned - old_aligned;
+            pthread_mutex_unlock(&a->lock);
+            return ptr;
+        }
+    }
+    pthread_mutex_unlock(&a->lock);
+
+    void *p = arena_alloc(a, new_size);
+    if (p) memcpy(p, ptr, old_size);
+    return p;
+}
+
+void arena_reset(arena_t *a) {
+    if (!a) return;
+    pthread_mutex_lock(&a->lock);
+
+    if (a->used > a->high_water) a->high_water = a->used;
+
+    if (a->retire_pending) {
+        /* Someone may still be writing into this cycle's memory */
+        arena_chunk_t **tail = &a->retired;
+        while (*tail) tail = &(*tail)->next;
+        *tail = a->chunks;
+        a->chunks = NULL;
+        a->retire_pending = 0;
+    } else if (a->chunks && a->chunks->next) {
+        /* Merge into one chunk that fits the busiest cycle seen, with
+         * headroom so a slightly busier cycle does not split it again */
+        arena_chunk_t *merged = chunk_new(a, align_up(a->high_water + a->high_water / 4));
+        if (merged) {
+            chunk_list_free(a->chunks);
+            a->chunks = merged;
+        }
+    }
+
+    if (a->retired && a->stragglers == 0) {
+        chunk_list_free(a->retired);
+        a->retired = NULL;
+    }
+
+    a->current = a->chunks;
+    if (a->current) a->current->used = 0;
+    a->used = 0;
+    a->epoch++;
+    if (a->epoch == 0) a->epoch = 1;
+
+    pthread_mutex_unlock(&a->lock);
+}
+
+void arena_bind_thread(arena_t *a) {
+    if (!a) return;
+    pthread_mutex_lock(&a->lock);
+    t_epoch = a->epoch;
+    pthread_mutex_unlock(&a->lock);
+}
+
+void arena_taint(arena_t *a) {
+    if (!a) return;
+    pthread_mutex_lock(&a->lock);
+    a->retire_pending = 1;
+    a->stragglers++;
+    pthread_mutex_unlock(&a->lock);
+}
+
+void arena_straggler_done(arena_t *a) {
+    if (!a) return;
+    pthread_mutex_lock(&a->lock);
+    if (a->stragglers > 0) a->stragglers--;
+    pthread_mutex_unlock(&a->lock);
+}
+
+void arena_get_stats(arena_t *a, arena_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    if (!a) return;
+
+    pthread_mutex_lock(&a->lock);
+    for (arena_chunk_t *c = a->chunks; c; c = c->next) {
+        stats->capacity += c->size;
+        stats->chunks++;
+    }
+    for (arena_chunk_t *c = a->retired; c; c = c->next) {
+        stats->retired += c->size;
+    }
+    stats->used = a->used;
+    stats->high_water = a->high_water;
+    stats->chunk_allocs = a->chunk_allocs;
+    pthread_mutex_unlock(&a->lock);
+}
+
+/* The arena every probe-time allocation comes from */
+static arena_t *g_probe_arena = NULL;
+static pthread_once_t g_probe_arena_once = PTHREAD_ONCE_INIT;
+
+static void probe_arena_create(void) {
+    g_probe_arena = arena_create(ARENA_DEFAULT_CHUNK);
+}
+
+/* A watch pipeline stage works on a snapshot that brought its own arena */
+static __thread arena_t *t_probe_arena = NULL;
+
+void probe_arena_use(arena_t *a) {
+    t_probe_arena = a;
+}
+
+arena_t *probe_arena(void) {
+    if (t_probe_arena) return t_probe_arena;
+    pthread_once(&g_probe_arena_once, probe_arena_create);
+    return g_probe_arena;
+}
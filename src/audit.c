@@ -188,6 +188,35 @@ static void parse_syscall_context(int window_seconds) {
 }
 
 
+/* Value of key= in a raw record, quoted or not; quotes and control
+ * characters are replaced so the value can go straight into JSON */
+static bool get_field(const char *line, const char *key, char *out, size_t outsize) {
+    size_t keylen = strlen(key);
+    const char *p = line;
+    
+    /* Whole keys only: "context=" must not match "tcontext=" */
+    while ((p = strstr(p, key)) != NULL) {
+        if (p == line || p[-1] == ' ' || p[-1] == '\'') break;
+        p += keylen;
+    }
+    if (!p || outsize == 0) return false;
+    p += keylen;
+    
+    char end = ' ';
+    if (*p == '"') {
+        end = '"';
+        p++;
+    }
+    
+    size_t n = 0;
+    while (*p && *p != end && *p != '\n' && *p != '\'' && n < outsize - 1) {
+        unsigned char c = (unsigned char)*p++;
+        out[n++] = (c < 0x20 || c == '\\' || c == '"') ? '?' : (char)c;
+    }
+    out[n] = '\0';
+    return n > 0;
+}
+
 /*
  * Hash a username for privacy-preserving output
  * Output format: "user_xxxx" where xxxx is first 4 chars of hash
@@ -249,9 +278,14 @@ static void parse_auth_events(audit_summary_t *summary, int window_seconds) {
     
     (void)window_seconds;
     
+    /* Per-source and per-user counts live in fixed-size sketches, so
+     * every event in the window is read, however many there are */
+    auth_sketch_t *sketch = arena_alloc(probe_arena(), sizeof(*sketch));
+    if (sketch) auth_sketch_load(sketch);
+    
     /* Use raw format for stable parsing */
     snprintf(cmd, sizeof(cmd), 
-             "ausearch -m USER_AUTH -ts '%s' --format raw 2>/dev/null | grep -E 'res=(success|failed)' | tail -100 2>/dev/null",
+             "ausearch -m USER_AUTH -ts '%s' --format raw 2>/dev/null | grep -E 'res=(success|failed)' 2>/dev/null",
              g_ausearch_ts);
     
     fp = popen(cmd, "r");
@@ -265,6 +299,7 @@ static void parse_auth_events(audit_summary_t *summary, int window_seconds) {
             summary->auth_failures++;
             
             /* Extract username from acct="..." (raw format has quotes) */
+            char hashed[HASH_USERNAME_LEN] = "";
             char *acct = strstr(line, "acct=\"");
             if (acct) {
                 acct += 6;
@@ -280,7 +315,25 @@ static void parse_auth_events(audit_summary_t *summary, int window_seconds) {
                     if (user) {
                         user->count++;
                     }
+                    hash_username(username, hashed, sizeof(hashed));
+                }
+            }
+            
+            if (sketch) {
+                /* Remote address, else the host, else a local login */
+                char source[48];
+                if ((!get_field(line, "addr=", source, sizeof(source)) || strcmp(source, "?") == 0) &&
+                    (!get_field(line, "hostname=", source, sizeof(source)) || strcmp(source, "?") == 0)) {
+                    snprintf(source, sizeof(source), "local");
                 }
+                
+                int64_t ts_ms;
+                uint32_t serial;
+                if (!audit_parse_record(line, &ts_ms, &serial)) {
+                    ts_ms = (int64_t)time(NULL) * 1000;
+                    serial = 0;
+                }
+                auth_sketch_add(sketch, ts_ms, serial, source, hashed);
             }
         } else if (strstr(line, "res=success")) {
             summary->auth_successes++;
@@ -289,8 +342,13 @@ static void parse_auth_events(audit_summary_t *summary, int window_seconds) {
     
     pclose(fp);
     
-    /* Detect brute force: >5 failures in the window */
-    summary->brute_force_detected = (summary->auth_failures > 5);
+    /* Brute force: one source bursting, or many sources or users each
+     * trying a little - both over the sliding window, not this probe */
+    if (sketch) {
+        auth_sketch_report(sketch, time(NULL), summary);
+        auth_sketch_save(sketch);
+    }
+    summary->brute_force_detected = summary->source_burst || summary->distributed_spray;
 }
 
 
@@ -484,43 +542,208 @@ static void parse_exec_events(audit_summary_t *summary, int window_seconds) {
 /*
  * Check SELinux/AppArmor status
  */
+/* ============================================================
+ * SELinux / AppArmor Denials
+ * ============================================================ */
+
+typedef struct {
+    uint64_t hash;                      /* 0 = empty slot */
+    denial_group_t group;
+} denial_slot_t;
+
+/* avc:  denied  { read write } -> "read write" */
+static bool get_avc_perms(const char *line, char *out, size_t outsize) {
+    const char *p = strstr(line, "denied");
+    if (!p || !(p = strchr(p, '{'))) return false;
+    p++;
+    while (*p == ' ') p++;
+    
+    const char *end = strchr(p, '}');
+    if (!end) return false;
+    while (end > p && end[-1] == ' ') end--;
+    
+    size_t n = (size_t)(end - p);
+    if (n >= outsize) n = outsize - 1;
+    memcpy(out, p, n);
+    out[n] = '\0';
+    return n > 0;
+}
+
+/* One AVC / USER_AVC / APPARMOR_DENIED record; false if it is not a
+ * denial. *event is its (time, serial), 0 if the record has none. */
+static bool parse_denial(const char *line, denial_group_t *g, uint64_t *event) {
+    memset(g, 0, sizeof(*g));
+    
+    if (strstr(line, "apparmor=\"DENIED\"")) {
+        g->source = DENIAL_APPARMOR;
+        get_field(line, "profile=", g->subject, sizeof(g->subject));
+        get_field(line, "name=", g->target, sizeof(g->target));
+        if (!get_field(line, "class=", g->tclass, sizeof(g->tclass))) {
+            get_field(line, "operation=", g->tclass, sizeof(g->tclass));
+        }
+        get_field(line, "denied_mask=", g->perms, sizeof(g->perms));
+    } else if (strstr(line, "avc:") && strstr(line, "denied")) {
+        g->source = DENIAL_SELINUX;
+        get_field(line, "scontext=", g->subject, sizeof(g->subject));
+        get_field(line, "tcontext=", g->target, sizeof(g->target));
+        get_field(line, "tclass=", g->tclass, sizeof(g->tclass));
+        get_avc_perms(line, g->perms, sizeof(g->perms));
+    } else {
+        return false;
+    }
+    
+    /* USER_AVC records from userspace managers carry exe, not comm */
+    if (!get_field(line, "comm=", g->comm, sizeof(g->comm))) {
+        char exe[AUDIT_PATH_LEN];
+        if (get_field(line, "exe=", exe, sizeof(exe))) {
+            const char *base = strrchr(exe, '/');
+            snprintf(g->comm, sizeof(g->comm), "%.*s", (int)sizeof(g->comm) - 1, base ? base + 1 : exe);
+        }
+    }
+    
+    int64_t ts_ms;
+    uint32_t serial;
+    *event = 0;
+    if (audit_parse_record(line, &ts_ms, &serial)) {
+        g->first_seen = g->last_seen = (time_t)(ts_ms / 1000);
+        *event = (uint64_t)ts_ms * 1000003u ^ serial;
+    }
+    return true;
+}
+
+/* FNV-1a over the grouping key, never 0 */
+static uint64_t denial_hash(const denial_group_t *g) {
+    const char *fields[5] = { g->subject, g->target, g->tclass, g->perms, g->comm };
+    uint64_t h = 14695981039346656037ULL ^ (uint64_t)g->source;
+    
+    for (int i = 0; i < 5; i++) {
+        for (const char *p = fields[i]; *p; p++) {
+            h ^= (unsigned char)*p;
+            h *= 1099511628211ULL;
+        }
+        h ^= 0xff;                      /* Field separator */
+        h *= 1099511628211ULL;
+    }
+    return h ? h : 1;
+}
+
+static bool denial_same_group(const denial_group_t *a, const denial_group_t *b) {
+    return a->source == b->source &&
+           strcmp(a->subject, b->subject) == 0 && strcmp(a->target, b->target) == 0 &&
+           strcmp(a->tclass, b->tclass) == 0 && strcmp(a->perms, b->perms) == 0 &&
+           strcmp(a->comm, b->comm) == 0;
+}
+
+/* Add one denial to the open-addressed map; false once it is full */
+static bool denial_map_add(denial_slot_t *map, int *used, const denial_group_t *g) {
+    uint64_t h = denial_hash(g);
+    
+    for (unsigned i = (unsigned)(h % DENIAL_MAP_SLOTS), probes = 0;
+         probes < DENIAL_MAP_SLOTS; i = (i + 1) % DENIAL_MAP_SLOTS, probes++) {
+        denial_slot_t *s = &map[i];
+        if (s->hash == 0) {
+            /* Keep a quarter free so probe runs stay short */
+            if (*used >= DENIAL_MAP_SLOTS * 3 / 4) return false;
+            s->hash = h;
+            s->group = *g;
+            s->group.count = 1;
+            (*used)++;
+            return true;
+        }
+        if (s->hash == h && denial_same_group(&s->group, g)) {
+            s->group.count++;
+            if (g->first_seen && (g->first_seen < s->group.first_seen || !s->group.first_seen)) {
+                s->group.first_seen = g->first_seen;
+            }
+            if (g->last_seen > s->group.last_seen) s->group.last_seen = g->last_seen;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Aggregate the window's denials, keep the largest groups. AppArmor
+ * logs its denials as type=AVC (1400) on current kernels, so one can
+ * match both -m AVC and -m APPARMOR_DENIED; the same denial in the same
+ * event is counted once. SELinux denials only count where SELinux is
+ * active. */
+static void parse_denial_events(audit_summary_t *summary, bool selinux_active) {
+    char cmd[512];
+    char line[4096];
+    int used = 0;
+    int untracked = 0;
+    uint64_t recent[DENIAL_RECENT] = {0};
+    int recent_next = 0;
+    
+    denial_slot_t *map = arena_calloc(probe_arena(), DENIAL_MAP_SLOTS, sizeof(*map));
+    if (!map) return;
+    
+    snprintf(cmd, sizeof(cmd),
+             "ausearch -m AVC,USER_AVC,APPARMOR_DENIED -ts '%s' --format raw 2>/dev/null",
+             g_ausearch_ts);
+    
+    FILE *fp = popen(cmd, "r");
+    if (!fp) return;
+    
+    while (fgets(line, sizeof(line), fp)) {
+        denial_group_t g;
+        uint64_t event;
+        if (!parse_denial(line, &g, &event)) continue;
+        if (g.source == DENIAL_SELINUX && !selinux_active) continue;
+        
+        /* An event's records arrive together, so a short memory will do */
+        if (event) {
+            uint64_t key = (event ^ denial_hash(&g)) | 1;
+            bool seen = false;
+            for (int i = 0; i < DENIAL_RECENT && !seen; i++) seen = recent[i] == key;
+            if (seen) continue;
+            recent[recent_next] = key;
+            recent_next = (recent_next + 1) % DENIAL_RECENT;
+        }
+        
+        if (g.source == DENIAL_SELINUX) {
+            summary->selinux_avc_denials++;
+        } else {
+            summary->apparmor_denials++;
+        }
+        if (!denial_map_add(map, &used, &g)) untracked++;
+    }
+    pclose(fp);
+    
+    /* Selection by count: the map holds at most DENIAL_MAP_SLOTS * 3/4
+     * groups and only MAX_DENIAL_GROUPS are kept */
+    summary->denial_groups = used;
+    summary->denial_untracked = untracked;
+    summary->denial_count = 0;
+    while (summary->denial_count < MAX_DENIAL_GROUPS) {
+        denial_slot_t *best = NULL;
+        for (int i = 0; i < DENIAL_MAP_SLOTS; i++) {
+            denial_slot_t *s = &map[i];
+            if (s->hash && (!best || s->group.count > best->group.count)) best = s;
+        }
+        if (!best) break;
+        summary->denials[summary->denial_count++] = best->group;
+        best->hash = 0;
+    }
+}
+
 static void check_security_framework(audit_summary_t *summary) {
     FILE *fp;
     char line[256];
-    char cmd[512];
     
     /* Check SELinux */
+    bool selinux_active = false;
     fp = fopen("/sys/fs/selinux/enforce", "r");
     if (fp) {
+        selinux_active = true;
         if (fgets(line, sizeof(line), fp)) {
             summary->selinux_enforcing = (atoi(line) == 1);
         }
         fclose(fp);
-        
-        /* Count AVC denials */
-        snprintf(cmd, sizeof(cmd),
-                 "ausearch -m AVC -ts '%s' 2>/dev/null | grep -c 'denied' 2>/dev/null",
-                 g_ausearch_ts);
-        fp = popen(cmd, "r");
-        if (fp) {
-            if (fgets(line, sizeof(line), fp)) {
-                summary->selinux_avc_denials = atoi(line);
-            }
-            pclose(fp);
-        }
     }
     
-    /* Check AppArmor */
-    snprintf(cmd, sizeof(cmd),
-             "ausearch -m APPARMOR_DENIED -ts '%s' 2>/dev/null | wc -l 2>/dev/null",
-             g_ausearch_ts);
-    fp = popen(cmd, "r");
-    if (fp) {
-        if (fgets(line, sizeof(line), fp)) {
-            summary->apparmor_denials = atoi(line);
-        }
-        pclose(fp);
-    }
+    /* SELinux AVC and AppArmor denials, grouped */
+    parse_denial_events(summary, selinux_active);
 }
 
 
@@ -683,8 +906,25 @@ void calculate_risk_score(audit_summary_t *summary) {
     }
     
     /* Brute force detection */
-    if (summary->brute_force_detected) {
-        add_risk_factor(summary, "Brute force attack pattern detected", 10);
+    if (summary->source_burst) {
+        const auth_hitter_t *src = &summary->top_sources[0];
+        for (int i = 0; i < summary->top_source_count; i++) {
+            if (summary->top_sources[i].burst >= AUTH_BURST_FAILURES) {
+                src = &summary->top_sources[i];
+                break;
+            }
+        }
+        snprintf(reason, sizeof(reason), "Brute force burst from %s (%d failures in %d min)",
+                 src->key, src->burst, 2 * AUTH_BUCKET_SECONDS / 60);
+        add_risk_factor(summary, reason, 10);
+        score += 10;
+    }
+    if (summary->distributed_spray) {
+        snprintf(reason, sizeof(reason),
+                 "Distributed auth failures: %d sources, %d users in %d min",
+                 summary->failure_sources, summary->window_users,
+                 AUTH_BUCKETS * AUTH_BUCKET_SECONDS / 60);
+        add_risk_factor(summary, reason, 10);
         score += 10;
     }
     
@@ -776,7 +1016,9 @@ void calculate_risk_score(audit_summary_t *summary) {
         score += factor_score;
     }
     
-    /* Security framework - SELinux denials */
+    /* Security framework - one point per denial record. SELinux counts
+     * include USER_AVC denials from userspace object managers; AppArmor
+     * counts are records, where they used to be ausearch output lines. */
     if (summary->selinux_avc_denials > 0) {
         factor_score = summary->selinux_avc_denials * 1;
         snprintf(reason, sizeof(reason), "%d SELinux AVC denial(s)", 
@@ -785,7 +1027,6 @@ void calculate_risk_score(audit_summary_t *summary) {
         score += factor_score;
     }
     
-    /* Security framework - AppArmor denials */
     if (summary->apparmor_denials > 0) {
         factor_score = summary->apparmor_denials * 1;
         snprintf(reason, sizeof(reason), "%d AppArmor denial(s)", 
@@ -926,7 +1167,7 @@ void update_audit_baseline(audit_baseline_t *baseline, const audit_summary_t *cu
  * Main probe function - gather all audit data
  */
 audit_summary_t* probe_audit(int window_seconds) {
-    audit_summary_t *summary = calloc(1, sizeof(audit_summary_t));
+    audit_summary_t *summary = arena_calloc(probe_arena(), 1, sizeof(audit_summary_t));
     if (!summary) {
         return NULL;
     }
@@ -936,11 +1177,14 @@ audit_summary_t* probe_audit(int window_seconds) {
     summary->capture_time = time(NULL);
     
     /* Check if auditd is available */
-    if (access("/var/log/audit/audit.log", R_OK) != 0) {
+    if (access(AUDIT_LOG_DIR "/audit.log", R_OK) != 0) {
         summary->enabled = false;
         return summary;
     }
     
+    /* Keep the time index current for --since/--until */
+    audit_index_update(AUDIT_LOG_DIR);
+    
     /* Load baseline to get last probe time for time window */
     audit_baseline_t baseline = {0};
     bool has_baseline = load_audit_baseline(&baseline);
@@ -982,11 +1226,3 @@ audit_summary_t* probe_audit(int window_seconds) {
     
     return summary;
 }
-
-
-/*
- * Cleanup
- */
-void free_audit_summary(audit_summary_t *summary) {
-    free(summary);
-}
@@ -0,0 +1,535 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * audit_index.c - Sparse time index over the audit logs
+ *
+ * Answering "what happened between 02:10 and 02:20" used to mean
+ * decoding every record in every log. Instead, as the logs are read,
+ * every AUDIT_INDEX_STRIDE-th record's time, serial and offset goes in
+ * a small index (~/.sentinel/audit_index.dat when state is kept, as it
+ * is for --since/--until), and a window query
+ * seeks to the last entry before the window and decodes from there
+ * until it is past the end.
+ *
+ * auditd rotates by renaming audit.log to audit.log.1 and so on, so
+ * files are known by device and inode, not by name: a rotated file
+ * keeps its entries, and only bytes appended since the last update are
+ * scanned. A file that shrank was replaced and is indexed again.
+ *
+ * Records carry their event's time, and events can reach the log
+ * slightly out of order, so queries start and stop AUDIT_INDEX_SLACK_MS
+ * outside the window and filter on each record's own time.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "../include/audit.h"
+
+#define AUDIT_INDEX_FILE        "audit_index.dat"
+#define AUDIT_INDEX_MAGIC       "SNTLAIDX"
+#define AUDIT_INDEX_VERSION     1
+#define AUDIT_INDEX_SLACK_MS    2000
+#define AUDIT_INDEX_MAX_FILES   128     /* audit.log and its rotations */
+
+/* On disk: header, then per file an index_file_hdr_t and its entries */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t stride;
+    uint32_t file_count;
+    uint32_t reserved;
+    char log_dir[MAX_PATH_LEN];
+} index_hdr_t;
+
+typedef struct {
+    int64_t ts_ms;                      /* Record time, ms since the epoch */
+    uint32_t serial;
+    uint32_t reserved;
+    uint64_t offset;                    /* Start of the record's line */
+} index_entry_t;
+
+typedef struct {
+    uint64_t dev;
+    uint64_t ino;
+    uint64_t indexed;                   /* Bytes scanned: whole lines only */
+    uint64_t records;                   /* Records in those bytes */
+    int64_t first_ms;
+    int64_t last_ms;
+    uint32_t count;
+    uint32_t reserved;
+} index_file_hdr_t;
+
+typedef struct {
+    index_file_hdr_t h;
+    index_entry_t *entries;
+    uint32_t cap;
+    uint64_t size;                      /* Bytes in the file now */
+    char name[64];
+    bool seen;
+} index_file_t;
+
+typedef struct {
+    char log_dir[MAX_PATH_LEN];
+    index_file_t files[AUDIT_INDEX_MAX_FILES];
+    int file_count;
+    bool dirty;
+} audit_index_t;
+
+/* ============================================================
+ * Records
+ * ============================================================ */
+
+/* type=SYSCALL msg=audit(1767386347.120:631): ... -> time and serial */
+bool audit_parse_record(const char *line, int64_t *ts_ms, uint32_t *serial) {
+    const char *p = strstr(line, "msg=audit(");
+    if (!p) return false;
+    p += 10;
+
+    char *end;
+    long long sec = strtoll(p, &end, 10);
+    if (end == p || *end != '.') return false;
+    p = end + 1;
+    long ms = strtol(p, &end, 10);
+    if (end == p || *end != ':') return false;
+    p = end + 1;
+    unsigned long ser = strtoul(p, &end, 10);
+    if (end == p) return false;
+
+    *ts_ms = sec * 1000 + ms;
+    *serial = (uint32_t)ser;
+    return true;
+}
+
+static bool is_log_name(const char *name) {
+    if (strncmp(name, "audit.log", 9) != 0) return false;
+    if (name[9] == '\0') return true;
+    if (name[9] != '.' || !name[10]) return false;
+    for (const char *p = name + 10; *p; p++) {
+        if (!isdigit((unsigned char)*p)) return false;
+    }
+    return true;
+}
+
+/* ============================================================
+ * Index Storage
+ * ============================================================ */
+
+static void index_free(audit_index_t *idx) {
+    for (int i = 0; i < idx->file_count; i++) free(idx->files[i].entries);
+    idx->file_count = 0;
+}
+
+static int file_add_entry(index_file_t *f, int64_t ts_ms, uint32_t serial, uint64_t offset) {
+    if (f->h.count == f->cap) {
+        uint32_t cap = f->cap ? f->cap * 2 : 64;
+        index_entry_t *e = realloc(f->entries, cap * sizeof(*e));
+        if (!e) return -1;
+        f->entries = e;
+        f->cap = cap;
+    }
+    index_entry_t *e = &f->entries[f->h.count++];
+    e->ts_ms = ts_ms;
+    e->serial = serial;
+    e->reserved = 0;
+    e->offset = offset;
+    return 0;
+}
+
+/* Missing or foreign index files just mean starting over */
+static void index_load(audit_index_t *idx, const char *log_dir) {
+    memset(idx, 0, sizeof(*idx));
+    snprintf(idx->log_dir, sizeof(idx->log_dir), "%s", log_dir);
+
+    char path[MAX_PATH_LEN];
+    if (probe_state_path(AUDIT_INDEX_FILE, path, sizeof(path)) != 0) return;
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return;
+
+    index_hdr_t hdr;
+    if (fread(&hdr, sizeof(hdr), 1, fp) != 1 ||
+        memcmp(hdr.magic, AUDIT_INDEX_MAGIC, 8) != 0 ||
+        hdr.version != AUDIT_INDEX_VERSION || hdr.stride != AUDIT_INDEX_STRIDE ||
+        hdr.file_count > AUDIT_INDEX_MAX_FILES ||
+        strncmp(hdr.log_dir, log_dir, sizeof(hdr.log_dir)) != 0) {
+        fclose(fp);
+        return;
+    }
+
+    for (uint32_t i = 0; i < hdr.file_count; i++) {
+        index_file_t *f = &idx->files[idx->file_count];
+        memset(f, 0, sizeof(*f));
+        if (fread(&f->h, sizeof(f->h), 1, fp) != 1) break;
+        uint32_t count = f->h.count;
+        f->entries = count ? malloc(count * sizeof(*f->entries)) : NULL;
+        if (count && (!f->entries || fread(f->entries, sizeof(*f->entries), count, fp) != count)) {
+            free(f->entries);
+            break;
+        }
+        f->cap = count;
+        idx->file_count++;
+    }
+    fclose(fp);
+
+    /* A torn file is worth less than a rescan */
+    if ((uint32_t)idx->file_count != hdr.file_count) {
+        index_free(idx);
+        idx->dirty = true;
+    }
+}
+
+static int index_save(const audit_index_t *idx) {
+    char path[MAX_PATH_LEN], tmp[MAX_PATH_LEN + 8];
+    if (probe_state_path(AUDIT_INDEX_FILE, path, sizeof(path)) != 0) return -1;
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+    FILE *fp = fopen(tmp, "wb");
+    if (!fp) return -1;
+
+    index_hdr_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, AUDIT_INDEX_MAGIC, 8);
+    hdr.version = AUDIT_INDEX_VERSION;
+    hdr.stride = AUDIT_INDEX_STRIDE;
+    hdr.file_count = (uint32_t)idx->file_count;
+    snprintf(hdr.log_dir, sizeof(hdr.log_dir), "%s", idx->log_dir);
+
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, fp) == 1;
+    for (int i = 0; ok && i < idx->file_count; i++) {
+        const index_file_t *f = &idx->files[i];
+        ok = fwrite(&f->h, sizeof(f->h), 1, fp) == 1 &&
+             fwrite(f->entries, sizeof(*f->entries), f->h.count, fp) == f->h.count;
+    }
+    if (fclose(fp) != 0) ok = false;
+
+    if (!ok || rename(tmp, path) != 0) {
+        remove(tmp);
+        return -1;
+    }
+    chmod(path, 0600);
+    return 0;
+}
+
+/* ============================================================
+ * Index Maintenance
+ * ============================================================ */
+
+static FILE *open_log(const audit_index_t *idx, const index_file_t *f) {
+    char path[MAX_PATH_LEN + 64];
+    snprintf(path, sizeof(path), "%s/%s", idx->log_dir, f->name);
+    return fopen(path, "r");
+}
+
+/* Index whatever was appended to f since the last scan */
+static int file_scan(audit_index_t *idx, index_file_t *f) {
+    if (f->size <= f->h.indexed) return 0;
+
+    FILE *fp = open_log(idx, f);
+    if (!fp) return -1;
+    if (fseeko(fp, (off_t)f->h.indexed, SEEK_SET) != 0) {
+        fclose(fp);
+        return -1;
+    }
+
+    char *line = NULL;
+    size_t cap = 0;
+    ssize_t len;
+    uint64_t offset = f->h.indexed;
+    int rc = 0;
+
+    while ((len = getline(&line, &cap, fp)) > 0) {
+        /* auditd may be mid-write; the rest of the line comes next time */
+        if (line[len - 1] != '\n') break;
+
+        int64_t ts_ms;
+        uint32_t serial;
+        if (audit_parse_record(line, &ts_ms, &serial)) {
+            if (f->h.records % AUDIT_INDEX_STRIDE == 0 &&
+                file_add_entry(f, ts_ms, serial, offset) != 0) {
+                rc = -1;
+                break;
+            }
+            if (f->h.records == 0 || ts_ms < f->h.first_ms) f->h.first_ms = ts_ms;
+            if (ts_ms > f->h.last_ms) f->h.last_ms = ts_ms;
+            f->h.records++;
+        }
+        offset += (uint64_t)len;
+    }
+
+    free(line);
+    fclose(fp);
+    if (offset != f->h.indexed) {
+        f->h.indexed = offset;
+        idx->dirty = true;
+    }
+    return rc;
+}
+
+static int by_first_record(const void *a, const void *b) {
+    const index_file_t *fa = a, *fb = b;
+    /* Files with no records yet sort last */
+    if (!fa->h.records != !fb->h.records) return fa->h.records ? -1 : 1;
+    return (fa->h.first_ms > fb->h.first_ms) - (fa->h.first_ms < fb->h.first_ms);
+}
+
+/* Match the index to the directory, then scan new bytes. Files end up
+ * oldest first. */
+static int index_refresh(audit_index_t *idx) {
+    DIR *dir = opendir(idx->log_dir);
+    if (!dir) return -1;
+
+    for (int i = 0; i < idx->file_count; i++) idx->files[i].seen = false;
+
+    struct dirent *de;
+    while ((de = readdir(dir)) != NULL) {
+        if (!is_log_name(de->d_name) || strlen(de->d_name) >= sizeof(idx->files[0].name)) continue;
+
+        char path[MAX_PATH_LEN + 64];
+        struct stat st;
+        snprintf(path, sizeof(path), "%s/%s", idx->log_dir, de->d_name);
+        if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) continue;
+
+        index_file_t *f = NULL;
+        for (int i = 0; i < idx->file_count; i++) {
+            if (idx->files[i].h.dev == (uint64_t)st.st_dev &&
+                idx->files[i].h.ino == (uint64_t)st.st_ino) {
+                f = &idx->files[i];
+                break;
+            }
+        }
+        if (!f) {
+            if (idx->file_count == AUDIT_INDEX_MAX_FILES) continue;
+            f = &idx->files[idx->file_count++];
+            memset(f, 0, sizeof(*f));
+            f->h.dev = (uint64_t)st.st_dev;
+            f->h.ino = (uint64_t)st.st_ino;
+            idx->dirty = true;
+        } else if ((uint64_t)st.st_size < f->h.indexed) {
+            /* Truncated, or the inode was reused */
+            index_entry_t *entries = f->entries;
+            uint32_t cap = f->cap;
+            memset(&f->h, 0, sizeof(f->h));
+            f->h.dev = (uint64_t)st.st_dev;
+            f->h.ino = (uint64_t)st.st_ino;
+            f->entries = entries;
+            f->cap = cap;
+            idx->dirty = true;
+        }
+        f->seen = true;
+        f->size = (uint64_t)st.st_size;
+        snprintf(f->name, sizeof(f->name), "%s", de->d_name);
+    }
+    closedir(dir);
+
+    /* Rotated out of existence */
+    int kept = 0;
+    for (int i = 0; i < idx->file_count; i++) {
+        if (idx->files[i].seen) {
+            idx->files[kept++] = idx->files[i];
+        } else {
+            free(idx->files[i].entries);
+            idx->dirty = true;
+        }
+    }
+    idx->file_count = kept;
+
+    int rc = 0;
+    for (int i = 0; i < idx->file_count; i++) {
+        if (file_scan(idx, &idx->files[i]) != 0) rc = -1;
+    }
+
+    qsort(idx->files, (size_t)idx->file_count, sizeof(idx->files[0]), by_first_record);
+    return rc;
+}
+
+int audit_index_update(const char *log_dir) {
+    /* An index that cannot be saved would be rebuilt from every byte
+     * of every log on each call; leave it to runs that keep state */
+    char path[MAX_PATH_LEN];
+    if (probe_state_path(AUDIT_INDEX_FILE, path, sizeof(path)) != 0) return 0;
+
+    audit_index_t *idx = malloc(sizeof(*idx));
+    if (!idx) return -1;
+
+    index_load(idx, log_dir);
+    int rc = index_refresh(idx);
+    if (idx->dirty && index_save(idx) != 0) rc = -1;
+
+    index_free(idx);
+    free(idx);
+    return rc;
+}
+
+/* ============================================================
+ * Window Queries
+ * ============================================================ */
+
+/* Offset of the last entry before from_ms, or of the first record */
+static uint64_t seek_offset(const index_file_t *f, int64_t from_ms) {
+    uint32_t lo = 0, hi = f->h.count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (f->entries[mid].ts_ms < from_ms) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo > 0 ? f->entries[lo - 1].offset : 0;
+}
+
+static int file_query(const audit_index_t *idx, const index_file_t *f,
+                      int64_t since_ms, int64_t until_ms, FILE *out,
+                      audit_window_stats_t *stats) {
+    FILE *fp = open_log(idx, f);
+    if (!fp) return -1;
+
+    uint64_t offset = seek_offset(f, since_ms - AUDIT_INDEX_SLACK_MS);
+    if (fseeko(fp, (off_t)offset, SEEK_SET) != 0) {
+        fclose(fp);
+        return -1;
+    }
+
+    char *line = NULL;
+    size_t cap = 0;
+    ssize_t len;
+
+    while ((len = getline(&line, &cap, fp)) > 0) {
+        stats->bytes_read += (unsigned long long)len;
+
+        int64_t ts_ms;
+        uint32_t serial;
+        if (!audit_parse_record(line, &ts_ms, &serial)) continue;
+        stats->records_read++;
+
+        if (ts_ms > until_ms + AUDIT_INDEX_SLACK_MS) break;
+        if (ts_ms >= since_ms && ts_ms <= until_ms) {
+            stats->records_matched++;
+            fputs(line, out);
+            if (line[len - 1] != '\n') fputc('\n', out);
+        }
+    }
+
+    free(line);
+    fclose(fp);
+    stats->files_read++;
+    return 0;
+}
+
+int audit_window_query(const char *log_dir, time_t since, time_t until, FILE *out,
+                       audit_window_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+
+    audit_index_t *idx = malloc(sizeof(*idx));
+    if (!idx) return -1;
+
+    index_load(idx, log_dir);
+    if (index_refresh(idx) != 0 && idx->file_count == 0) {
+        index_free(idx);
+        free(idx);
+        return -1;
+    }
+    /* Only an optimisation: a query still works if this fails */
+    if (idx->dirty) index_save(idx);
+
+    /* --until 02:20 takes in all of 02:20:00 */
+    int64_t since_ms = (int64_t)since * 1000;
+    int64_t until_ms = (int64_t)until * 1000 + 999;
+    int rc = 0;
+
+    for (int i = 0; i < idx->file_count; i++) {
+        const index_file_t *f = &idx->files[i];
+        stats->files++;
+        stats->bytes_total += f->size;
+        stats->index_entries += f->h.count;
+
+        if (f->h.records == 0 ||
+            f->h.last_ms < since_ms - AUDIT_INDEX_SLACK_MS ||
+            f->h.first_ms > until_ms + AUDIT_INDEX_SLACK_MS) {
+            continue;
+        }
+        if (file_query(idx, f, since_ms, until_ms, out, stats) != 0) rc = -1;
+    }
+
+    index_free(idx);
+    free(idx);
+    return rc;
+}
+
+/* now, -N[smhd], unix seconds, YYYY-MM-DD[ HH:MM[:SS]] or HH:MM[:SS]
+ * (today), all local time */
+int audit_parse_time(const char *text, time_t *out) {
+    time_t now = time(NULL);
+    int n = 0;
+
+    if (strcmp(text, "now") == 0) {
+        *out = now;
+        return 0;
+    }
+
+    if (text[0] == '-') {
+        long amount;
+        char unit = 's';
+        if (sscanf(text + 1, "%ld%n%c", &amount, &n, &unit) < 1 || amount < 0) return -1;
+        if (text[1 + n] && text[2 + n]) return -1;
+        long scale = unit == 's' ? 1 : unit == 'm' ? 60 : unit == 'h' ? 3600 :
+                     unit == 'd' ? 86400 : 0;
+        if (!scale) return -1;
+        *out = now - (time_t)(amount * scale);
+        return 0;
+    }
+
+    struct tm tm;
+    struct tm *local = localtime(&now);
+    if (!local) return -1;
+    tm = *local;
+    tm.tm_sec = 0;
+
+    int y, mo, d, h, mi, s = 0;
+    if (sscanf(text, "%d-%d-%d%n", &y, &mo, &d, &n) == 3) {
+        const char *rest = text + n;
+        tm.tm_year = y - 1900;
+        tm.tm_mon = mo - 1;
+        tm.tm_mday = d;
+        tm.tm_hour = tm.tm_min = 0;
+        if (*rest == ' ' || *rest == 'T') {
+            rest++;
+            n = 0;
+            if (sscanf(rest, "%d:%d%n:%d%n", &h, &mi, &n, &s, &n) < 2) return -1;
+            tm.tm_hour = h;
+            tm.tm_min = mi;
+            tm.tm_sec = s;
+            rest += n;
+        }
+        if (*rest) return -1;
+    } else if (strchr(text, ':')) {
+        n = 0;
+        if (sscanf(text, "%d:%d%n:%d%n", &h, &mi, &n, &s, &n) < 2 || text[n]) return -1;
+        tm.tm_hour = h;
+        tm.tm_min = mi;
+        tm.tm_sec = s;
+    } else {
+        char *end;
+        long long secs = strtoll(text, &end, 10);
+        if (end == text || *end) return -1;
+        *out = (time_t)secs;
+        return 0;
+    }
+
+    tm.tm_isdst = -1;
+    time_t t = mktime(&tm);
+    if (t == (time_t)-1) return -1;
+    *out = t;
+    return 0;
+}
@@ -59,8 +59,32 @@ void audit_to_json(const audit_summary_t *summary, char *buf, size_t bufsize) {
     
     buf_append(buf, bufsize, &pos, "      \"baseline_avg\": %.2f,\n", summary->auth_baseline_avg);
     buf_append(buf, bufsize, &pos, "      \"deviation_pct\": %.1f,\n", summary->auth_deviation_pct);
-    buf_append(buf, bufsize, &pos, "      \"brute_force_detected\": %s\n", 
+    buf_append(buf, bufsize, &pos, "      \"brute_force_detected\": %s,\n", 
               summary->brute_force_detected ? "true" : "false");
+    
+    /* Sliding window across probes */
+    buf_append(buf, bufsize, &pos, "      \"window\": {\n");
+    buf_append(buf, bufsize, &pos, "        \"seconds\": %d,\n", AUTH_BUCKETS * AUTH_BUCKET_SECONDS);
+    buf_append(buf, bufsize, &pos, "        \"failures\": %d,\n", summary->window_failures);
+    buf_append(buf, bufsize, &pos, "        \"distinct_sources\": %d,\n", summary->failure_sources);
+    buf_append(buf, bufsize, &pos, "        \"distinct_users\": %d,\n", summary->window_users);
+    buf_append(buf, bufsize, &pos, "        \"source_burst\": %s,\n", summary->source_burst ? "true" : "false");
+    buf_append(buf, bufsize, &pos, "        \"distributed_spray\": %s,\n",
+              summary->distributed_spray ? "true" : "false");
+    const struct { const char *name, *key; const auth_hitter_t *list; int count; } tops[2] = {
+        { "top_sources", "source", summary->top_sources, summary->top_source_count },
+        { "top_users", "user", summary->top_users, summary->top_user_count },
+    };
+    for (int t = 0; t < 2; t++) {
+        buf_append(buf, bufsize, &pos, "        \"%s\": [", tops[t].name);
+        for (int i = 0; i < tops[t].count; i++) {
+            const auth_hitter_t *h = &tops[t].list[i];
+            buf_append(buf, bufsize, &pos, "%s{\"%s\": \"%s\", \"burst\": %d, \"window\": %d}",
+                      i > 0 ? ", " : "", tops[t].key, h->key, h->burst, h->window);
+        }
+        buf_append(buf, bufsize, &pos, "]%s\n", t == 0 ? "," : "");
+    }
+    buf_append(buf, bufsize, &pos, "      }\n");
     buf_append(buf, bufsize, &pos, "    },\n");
     
     /* Privilege escalation section */
@@ -117,7 +141,27 @@ void audit_to_json(const audit_summary_t *summary, char *buf, size_t bufsize) {
     buf_append(buf, bufsize, &pos, "      \"selinux_enforcing\": %s,\n", 
               summary->selinux_enforcing ? "true" : "false");
     buf_append(buf, bufsize, &pos, "      \"selinux_avc_denials\": %d,\n", summary->selinux_avc_denials);
-    buf_append(buf, bufsize, &pos, "      \"apparmor_denials\": %d\n", summary->apparmor_denials);
+    buf_append(buf, bufsize, &pos, "      \"apparmor_denials\": %d,\n", summary->apparmor_denials);
+    buf_append(buf, bufsize, &pos, "      \"denial_groups\": %d,\n", summary->denial_groups);
+    buf_append(buf, bufsize, &pos, "      \"denials_ungrouped\": %d,\n", summary->denial_untracked);
+    buf_append(buf, bufsize, &pos, "      \"top_denials\": [\n");
+    for (int i = 0; i < summary->denial_count; i++) {
+        const denial_group_t *d = &summary->denials[i];
+        buf_append(buf, bufsize, &pos, "        {\n");
+        buf_append(buf, bufsize, &pos, "          \"source\": \"%s\",\n",
+                  d->source == DENIAL_SELINUX ? "selinux" : "apparmor");
+        buf_append(buf, bufsize, &pos, "          \"subject\": \"%s\",\n", d->subject);
+        buf_append(buf, bufsize, &pos, "          \"target\": \"%s\",\n", d->target);
+        buf_append(buf, bufsize, &pos, "          \"class\": \"%s\",\n", d->tclass);
+        buf_append(buf, bufsize, &pos, "          \"permissions\": \"%s\",\n", d->perms);
+        buf_append(buf, bufsize, &pos, "          \"comm\": \"%s\",\n", d->comm);
+        buf_append(buf, bufsize, &pos, "          \"count\": %d,\n", d->count);
+        buf_append(buf, bufsize, &pos, "          \"first_seen\": %ld,\n", (long)d->first_seen);
+        buf_append(buf, bufsize, &pos, "          \"last_seen\": %ld\n", (long)d->last_seen);
+        buf_append(buf, bufsize, &pos, "        }%s\n",
+                  i < summary->denial_count - 1 ? "," : "");
+    }
+    buf_append(buf, bufsize, &pos, "      ]\n");
     buf_append(buf, bufsize, &pos, "    },\n");
     
     /* Anomalies section */
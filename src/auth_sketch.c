@@ -0,0 +1,286 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * auth_sketch.c - Per-source and per-user auth failure sketches
+ *
+ * A failure total cannot tell one noisy host from a hundred addresses
+ * trying a password each, and a per-address table grows with the
+ * attack. Instead each AUTH_BUCKET_SECONDS bucket of the sliding
+ * window holds, for sources and for users:
+ *
+ *   - a count-min sketch: AUTH_SKETCH_DEPTH rows of counters, a key
+ *     maps to one counter per row, and its estimate is the smallest of
+ *     them (never low; high by at most about e/width of the bucket's
+ *     failures, much less with conservative update)
+ *   - a bitmap for distinct counts (linear counting)
+ *
+ * A short list of heavy-hitter candidates remembers which keys to ask
+ * the sketches about, since a sketch cannot list its keys. The whole
+ * state is a fixed-size struct; with --keep-state it is kept in
+ * ~/.sentinel/auth_sketch.dat, so one-shot probes from cron see the
+ * same window that watch mode does.
+ *
+ * Two patterns come out of it:
+ *   burst - one source with AUTH_BURST_FAILURES in the last two buckets
+ *   spray - AUTH_SPRAY_DISTINCT sources, or users, in the window, as a
+ *           distributed or password-spraying attack looks however
+ *           slowly it goes
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/stat.h>
+#include "../include/audit.h"
+
+#define AUTH_SKETCH_FILE        "auth_sketch.dat"
+#define AUTH_SKETCH_MAGIC       "SNTLAUTH"
+#define AUTH_SKETCH_VERSION     1
+
+/* ============================================================
+ * Hashing
+ * ============================================================ */
+
+static uint64_t fnv1a(const char *key) {
+    uint64_t h = 14695981039346656037ULL;
+    for (const char *p = key; *p; p++) {
+        h ^= (unsigned char)*p;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+/* Row i's counter: h1 + i*h2 gives independent enough rows from one hash */
+static unsigned sketch_col(uint64_t h, int row) {
+    uint32_t h1 = (uint32_t)h, h2 = (uint32_t)(h >> 32) | 1;
+    return (h1 + (uint32_t)row * h2) % AUTH_SKETCH_WIDTH;
+}
+
+static unsigned bitmap_bit(uint64_t h) {
+    /* The high bits, so not the same as row 0's column */
+    return (unsigned)(h >> 40) % AUTH_SKETCH_BITS;
+}
+
+/* ============================================================
+ * Buckets
+ * ============================================================ */
+
+static int64_t epoch_of(int64_t seconds) {
+    return seconds / AUTH_BUCKET_SECONDS;
+}
+
+/* In the window ending at now_epoch, and at most `span` buckets old */
+static bool bucket_live(const auth_bucket_t *b, int64_t now_epoch, int span) {
+    return b->failures > 0 && b->epoch <= now_epoch && b->epoch > now_epoch - span;
+}
+
+static uint32_t bucket_estimate(const uint32_t rows[AUTH_SKETCH_DEPTH][AUTH_SKETCH_WIDTH],
+                                uint64_t h) {
+    uint32_t est = UINT32_MAX;
+    for (int r = 0; r < AUTH_SKETCH_DEPTH; r++) {
+        uint32_t c = rows[r][sketch_col(h, r)];
+        if (c < est) est = c;
+    }
+    return est;
+}
+
+/* Sum of per-bucket estimates over the last `span` buckets */
+static int window_estimate(const auth_sketch_t *s, bool users, const char *key,
+                           int64_t now_epoch, int span) {
+    uint64_t h = fnv1a(key);
+    uint64_t total = 0;
+    for (int i = 0; i < AUTH_BUCKETS; i++) {
+        const auth_bucket_t *b = &s->buckets[i];
+        if (!bucket_live(b, now_epoch, span)) continue;
+        total += bucket_estimate(users ? b->users : b->sources, h);
+    }
+    return total > INT32_MAX ? INT32_MAX : (int)total;
+}
+
+/* Linear counting over the OR of the window's bitmaps */
+static int window_distinct(const auth_sketch_t *s, bool users, int64_t now_epoch) {
+    uint8_t bits[AUTH_SKETCH_BITS / 8] = {0};
+    for (int i = 0; i < AUTH_BUCKETS; i++) {
+        const auth_bucket_t *b = &s->buckets[i];
+        if (!bucket_live(b, now_epoch, AUTH_BUCKETS)) continue;
+        const uint8_t *src = users ? b->user_bits : b->source_bits;
+        for (size_t j = 0; j < sizeof(bits); j++) bits[j] |= src[j];
+    }
+
+    int zeros = 0;
+    for (size_t j = 0; j < sizeof(bits); j++) {
+        for (int k = 0; k < 8; k++) zeros += !(bits[j] & (1u << k));
+    }
+    if (zeros == AUTH_SKETCH_BITS) return 0;
+    if (zeros == 0) return AUTH_SKETCH_BITS;        /* Saturated: at least this */
+    return (int)lround(-AUTH_SKETCH_BITS * log((double)zeros / AUTH_SKETCH_BITS));
+}
+
+/* ============================================================
+ * Heavy-Hitter Candidates
+ * ============================================================ */
+
+/* Keep key if it is in the list, there is room, or it now outweighs
+ * the lightest candidate; window holds its last estimate */
+static void candidate_offer(auth_hitter_t *list, const char *key, int estimate) {
+    auth_hitter_t *lightest = NULL;
+
+    for (int i = 0; i < AUTH_HH_CANDIDATES; i++) {
+        auth_hitter_t *c = &list[i];
+        if (c->key[0] == '\0' || strcmp(c->key, key) == 0) {
+            snprintf(c->key, sizeof(c->key), "%s", key);
+            c->window = estimate;
+            return;
+        }
+        if (!lightest || c->window < lightest->window) lightest = c;
+    }
+    if (lightest && estimate > lightest->window) {
+        snprintf(lightest->key, sizeof(lightest->key), "%s", key);
+        lightest->window = estimate;
+    }
+}
+
+static int by_window_desc(const void *a, const void *b) {
+    const auth_hitter_t *ha = a, *hb = b;
+    if (ha->window != hb->window) return hb->window - ha->window;
+    return hb->burst - ha->burst;
+}
+
+/* Re-estimate every candidate as of now, largest first */
+static int candidates_top(const auth_sketch_t *s, bool users, int64_t now_epoch,
+                          auth_hitter_t *out, int max) {
+    const auth_hitter_t *list = users ? s->user_candidates : s->source_candidates;
+    auth_hitter_t ranked[AUTH_HH_CANDIDATES];
+    int n = 0;
+
+    for (int i = 0; i < AUTH_HH_CANDIDATES; i++) {
+        if (list[i].key[0] == '\0') continue;
+        auth_hitter_t h = list[i];
+        h.window = window_estimate(s, users, h.key, now_epoch, AUTH_BUCKETS);
+        h.burst = window_estimate(s, users, h.key, now_epoch, 2);
+        if (h.window > 0) ranked[n++] = h;
+    }
+    qsort(ranked, (size_t)n, sizeof(ranked[0]), by_window_desc);
+
+    if (n > max) n = max;
+    memcpy(out, ranked, (size_t)n * sizeof(*out));
+    return n;
+}
+
+/* ============================================================
+ * Public API
+ * ============================================================ */
+
+void auth_sketch_load(auth_sketch_t *s) {
+    char path[MAX_PATH_LEN];
+    FILE *fp = NULL;
+
+    if (probe_state_path(AUTH_SKETCH_FILE, path, sizeof(path)) == 0) {
+        fp = fopen(path, "rb");
+    }
+    if (fp) {
+        bool ok = fread(s, sizeof(*s), 1, fp) == 1 &&
+                  memcmp(s->magic, AUTH_SKETCH_MAGIC, 8) == 0 &&
+                  s->version == AUTH_SKETCH_VERSION;
+        fclose(fp);
+        if (ok) return;
+    }
+
+    memset(s, 0, sizeof(*s));
+    memcpy(s->magic, AUTH_SKETCH_MAGIC, 8);
+    s->version = AUTH_SKETCH_VERSION;
+}
+
+bool auth_sketch_save(const auth_sketch_t *s) {
+    char path[MAX_PATH_LEN], tmp[MAX_PATH_LEN + 8];
+    if (probe_state_path(AUTH_SKETCH_FILE, path, sizeof(path)) != 0) return false;
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+    FILE *fp = fopen(tmp, "wb");
+    if (!fp) return false;
+    bool ok = fwrite(s, sizeof(*s), 1, fp) == 1;
+    if (fclose(fp) != 0) ok = false;
+
+    if (!ok || rename(tmp, path) != 0) {
+        remove(tmp);
+        return false;
+    }
+    chmod(path, 0600);
+    return true;
+}
+
+void auth_sketch_add(auth_sketch_t *s, int64_t ts_ms, uint32_t serial,
+                     const char *source, const char *user) {
+    /* Windows overlap between probes; count each event once. Records
+     * reach the log slightly out of time order, and serials restart
+     * with auditd, so an event is new if either is past the mark. */
+    if (ts_ms <= s->last_ms && serial <= s->last_serial) return;
+    if (ts_ms > s->last_ms) s->last_ms = ts_ms;
+    if (serial > s->last_serial) s->last_serial = serial;
+
+    int64_t epoch = epoch_of(ts_ms / 1000);
+    auth_bucket_t *b = &s->buckets[epoch % AUTH_BUCKETS];
+    if (b->epoch != epoch) {
+        memset(b, 0, sizeof(*b));
+        b->epoch = epoch;
+    }
+    b->failures++;
+
+    const char *keys[2] = { source, user };
+    for (int k = 0; k < 2; k++) {
+        if (!keys[k] || !keys[k][0]) continue;
+        bool users = k == 1;
+        uint64_t h = fnv1a(keys[k]);
+
+        /* Conservative update: raise only the counters at the minimum,
+         * which keeps a flood of one-off keys from inflating the rest */
+        uint32_t (*rows)[AUTH_SKETCH_WIDTH] = users ? b->users : b->sources;
+        uint32_t est = bucket_estimate((const uint32_t (*)[AUTH_SKETCH_WIDTH])rows, h);
+        if (est < UINT32_MAX) {
+            for (int r = 0; r < AUTH_SKETCH_DEPTH; r++) {
+                uint32_t *c = &rows[r][sketch_col(h, r)];
+                if (*c <= est) *c = est + 1;
+            }
+        }
+        unsigned bit = bitmap_bit(h);
+        (users ? b->user_bits : b->source_bits)[bit / 8] |= (uint8_t)(1u << (bit % 8));
+
+        candidate_offer(users ? s->user_candidates : s->source_candidates, keys[k],
+                        window_estimate(s, users, keys[k], epoch, AUTH_BUCKETS));
+    }
+}
+
+void auth_sketch_report(const auth_sketch_t *s, time_t now, audit_summary_t *summary) {
+    int64_t now_epoch = epoch_of((int64_t)now);
+
+    summary->window_failures = 0;
+    for (int i = 0; i < AUTH_BUCKETS; i++) {
+        if (bucket_live(&s->buckets[i], now_epoch, AUTH_BUCKETS)) {
+            summary->window_failures += (int)s->buckets[i].failures;
+        }
+    }
+    summary->failure_sources = window_distinct(s, false, now_epoch);
+    summary->window_users = window_distinct(s, true, now_epoch);
+
+    summary->top_source_count = candidates_top(s, false, now_epoch,
+                                               summary->top_sources, AUTH_TOP_REPORTED);
+    summary->top_user_count = candidates_top(s, true, now_epoch,
+                                             summary->top_users, AUTH_TOP_REPORTED);
+
+    summary->source_burst = false;
+    for (int i = 0; i < summary->top_source_count; i++) {
+        if (summary->top_sources[i].burst >= AUTH_BURST_FAILURES) summary->source_burst = true;
+    }
+    summary->distributed_spray = summary->failure_sources >= AUTH_SPRAY_DISTINCT ||
+                                 summary->window_users >= AUTH_SPRAY_DISTINCT;
+}
@@ -13,6 +13,7 @@
 #define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <errno.h>
@@ -25,6 +26,11 @@
 /* Default baseline location */
 #define DEFAULT_BASELINE_DIR ".sentinel"
 #define BASELINE_FILENAME "baseline.dat"
+#define BASELINE_VERSION 2
+
+/* TCP counter anomaly: rate must exceed max(3x learned average, learned
+ * maximum) and the interval must have seen at least this many events */
+#define TCP_ANOMALY_MIN_DELTA 20
 
 /* Note: baseline_t and deviation_report_t are defined in sentinel.h */
 
@@ -69,11 +75,53 @@ static int ensure_baseline_dir(void) {
     return mkdir(dir, 0700);
 }
 
+/* Path for a state file kept alongside the baseline; creates the directory */
+int baseline_state_path(const char *filename, char *path, size_t path_size) {
+    if (ensure_baseline_dir() != 0) {
+        return -1;
+    }
+    char dir[256];
+    get_baseline_dir(dir, sizeof(dir));
+    snprintf(path, path_size, "%s/%s", dir, filename);
+    return 0;
+}
+
+/* Same path, for files the user puts there (rules, plugins); creates nothing */
+void baseline_state_lookup(const char *filename, char *path, size_t path_size) {
+    char dir[256];
+    get_baseline_dir(dir, sizeof(dir));
+    snprintf(path, path_size, "%s/%s", dir, filename);
+}
+
+/* History the probes carry between runs (TCP counters, leak fits,
+ * zombie sightings, auth sketches, the audit index) only touches disk
+ * when asked to; otherwise it lives as long as the process */
+static int g_keep_state = 0;
+
+void probe_state_keep(int keep) {
+    g_keep_state = keep;
+}
+
+int probe_state_path(const char *filename, char *path, size_t path_size) {
+    if (!g_keep_state) return -1;
+    return baseline_state_path(filename, path, path_size);
+}
+
+/* Seconds since boot, suspend included - what persisted state is
+ * timed against, since it means the same in the next process */
+double boottime_seconds(void) {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_BOOTTIME, &ts) != 0) {
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+    }
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
 /* Initialize a new baseline */
 void baseline_init(baseline_t *b) {
     memset(b, 0, sizeof(*b));
     memcpy(b->magic, "SNTLBASE", 8);
-    b->version = 1;
+    b->version = BASELINE_VERSION;
     b->created = time(NULL);
     b->last_updated = b->created;
     b->process_count_min = 9999;
@@ -90,13 +138,27 @@ int baseline_load(baseline_t *b) {
         return -1;  /* No baseline exists yet */
     }
     
-    size_t read = fread(b, sizeof(*b), 1, f);
+    memset(b, 0, sizeof(*b));
+    size_t read = fread(b, 1, sizeof(*b), f);
     fclose(f);
     
-    if (read != 1 || memcmp(b->magic, "SNTLBASE", 8) != 0) {
+    if (read < offsetof(baseline_t, expected_port_count) ||
+        memcmp(b->magic, "SNTLBASE", 8) != 0) {
         return -1;  /* Invalid or corrupt baseline */
     }
     
+    /* Version 1 files end before the TCP rate fields (the old tail padding
+     * may overlap tcp_rate_samples). Clear them; the next save upgrades. */
+    if (b->version == 1 && read >= offsetof(baseline_t, tcp_rate_samples)) {
+        size_t tail = offsetof(baseline_t, tcp_rate_samples);
+        memset((char *)b + tail, 0, sizeof(*b) - tail);
+        b->version = BASELINE_VERSION;
+        return 0;
+    }
+    if (read != sizeof(*b) || b->version != BASELINE_VERSION) {
+        return -1;
+    }
+    
     return 0;
 }
 
@@ -134,15 +196,15 @@ int baseline_learn(baseline_t *b, const fingerprint_t *fp) {
     snprintf(b->hostname, sizeof(b->hostname), "%s", fp->system.hostname);
     
     /* Update process count range */
-    if (fp->process_count < b->process_count_min) {
-        b->process_count_min = fp->process_count;
+    if (fp->process_total < b->process_count_min) {
+        b->process_count_min = fp->process_total;
     }
-    if (fp->process_count > b->process_count_max) {
-        b->process_count_max = fp->process_count;
+    if (fp->process_total > b->process_count_max) {
+        b->process_count_max = fp->process_total;
     }
     
     /* Running average for process count */
-    b->process_count_avg = (b->process_count_avg * b->sample_count + fp->process_count) 
+    b->process_count_avg = (b->process_count_avg * b->sample_count + fp->process_total) 
                            / (b->sample_count + 1);
     
     /* Memory usage */
@@ -173,10 +235,10 @@ int baseline_learn(baseline_t *b, const fingerprint_t *fp) {
     for (int i = 0; i < fp->config_count && b->expected_config_count < MAX_BASELINE_CONFIGS; i++) {
         const config_file_t *cfg = &fp->configs[i];
         
-        /* Check if we already have this path */
+        /* Check if we already have this path (same string, same id) */
         int found = -1;
         for (int j = 0; j < b->expected_config_count; j++) {
-            if (strcmp(b->expected_configs[j].path, cfg->path) == 0) {
+            if (strtab_find(fp->strings, b->expected_configs[j].path) == cfg->path) {
                 found = j;
                 break;
             }
@@ -187,13 +249,26 @@ int baseline_learn(baseline_t *b, const fingerprint_t *fp) {
         } else {
             /* Add new */
             strncpy(b->expected_configs[b->expected_config_count].path, 
-                    cfg->path, 255);
+                    fp_str(fp, cfg->path), 255);
             strncpy(b->expected_configs[b->expected_config_count].checksum,
                     cfg->checksum, 64);
             b->expected_config_count++;
         }
     }
     
+    /* Learn TCP stack event rates (needs a previous sample for a delta) */
+    if (fp->tcp_health.has_delta) {
+        int n = b->tcp_rate_samples;
+        for (int i = 0; i < TCP_CTR_COUNT; i++) {
+            double rate = fp->tcp_health.rates[i];
+            b->tcp_rate_avg[i] = (b->tcp_rate_avg[i] * n + rate) / (n + 1);
+            if (rate > b->tcp_rate_max[i]) {
+                b->tcp_rate_max[i] = rate;
+            }
+        }
+        b->tcp_rate_samples++;
+    }
+    
     b->sample_count++;
     b->last_updated = time(NULL);
     
@@ -207,8 +282,8 @@ int baseline_compare(const baseline_t *b, const fingerprint_t *fp,
     
     /* Check process count */
     int margin = (b->process_count_max - b->process_count_min) / 2 + 10;
-    if (fp->process_count < b->process_count_min - margin ||
-        fp->process_count > b->process_count_max + margin) {
+    if (fp->process_total < b->process_count_min - margin ||
+        fp->process_total > b->process_count_max + margin) {
         report->process_count_anomaly = 1;
         report->total_deviations++;
     }
@@ -263,12 +338,16 @@ int baseline_compare(const baseline_t *b, const fingerprint_t *fp,
     
     /* Check config file checksums */
     for (int i = 0; i < b->expected_config_count; i++) {
+        /* A path never interned this snapshot was not probed at all */
+        str_id_t path = strtab_find(fp->strings, b->expected_configs[i].path);
+        if (path == STR_NONE) continue;
+        
         for (int j = 0; j < fp->config_count; j++) {
-            if (strcmp(b->expected_configs[i].path, fp->configs[j].path) == 0) {
+            if (fp->configs[j].path == path) {
                 if (strcmp(b->expected_configs[i].checksum, fp->configs[j].checksum) != 0) {
                     if (report->changed_config_count < 8) {
                         strncpy(report->changed_configs[report->changed_config_count],
-                                fp->configs[j].path, 255);
+                                fp_str(fp, path), 255);
                         report->changed_config_count++;
                     }
                     report->config_changes++;
@@ -281,6 +360,28 @@ int baseline_compare(const baseline_t *b, const fingerprint_t *fp,
         report->total_deviations++;
     }
     
+    /* Check TCP stack event rates. Segment counters are volume, not
+     * trouble, so only the error/drop counters are flagged. */
+    if (fp->tcp_health.has_delta && b->tcp_rate_samples > 0) {
+        for (int i = 0; i < TCP_CTR_COUNT; i++) {
+            if (i == TCP_CTR_IN_SEGS || i == TCP_CTR_OUT_SEGS) continue;
+            if (fp->tcp_health.deltas[i] < TCP_ANOMALY_MIN_DELTA) continue;
+            
+            double limit = b->tcp_rate_avg[i] * 3.0;
+            if (b->tcp_rate_max[i] > limit) {
+                limit = b->tcp_rate_max[i];
+            }
+            if (fp->tcp_health.rates[i] > limit) {
+                report->tcp_anomaly_counters[report->tcp_anomalies] = (tcp_counter_t)i;
+                report->tcp_anomaly_rates[report->tcp_anomalies] = fp->tcp_health.rates[i];
+                report->tcp_anomalies++;
+            }
+        }
+        if (report->tcp_anomalies > 0) {
+            report->total_deviations++;
+        }
+    }
+    
     return report->total_deviations;
 }
 
@@ -339,6 +440,16 @@ void baseline_print_report(const baseline_t *b, const deviation_report_t *report
             printf("    - %s\n", report->changed_configs[i]);
         }
     }
+    
+    if (report->tcp_anomalies > 0) {
+        printf("• TCP STACK COUNTERS ABOVE NORMAL (%d):\n", report->tcp_anomalies);
+        for (int i = 0; i < report->tcp_anomalies; i++) {
+            tcp_counter_t c = report->tcp_anomaly_counters[i];
+            printf("    - %s: %.2f/s (normal avg %.2f/s, max %.2f/s)\n",
+                   tcp_counter_name(c), report->tcp_anomaly_rates[i],
+                   b->tcp_rate_avg[c], b->tcp_rate_max[c]);
+        }
+    }
 }
 
 /* Print baseline info */
@@ -358,6 +469,14 @@ void baseline_print_info(const baseline_t *b) {
            b->memory_used_percent_avg, b->memory_used_percent_max);
     printf("  Load (1m/5m max): %.2f / %.2f\n",
            b->load_avg_1_max, b->load_avg_5_max);
+    if (b->tcp_rate_samples > 0) {
+        printf("  TCP retransmits: avg %.2f/s, max %.2f/s (%d samples)\n",
+               b->tcp_rate_avg[TCP_CTR_RETRANS_SEGS],
+               b->tcp_rate_max[TCP_CTR_RETRANS_SEGS], b->tcp_rate_samples);
+        printf("  Listen overflows: avg %.2f/s, max %.2f/s\n",
+               b->tcp_rate_avg[TCP_CTR_LISTEN_OVERFLOWS],
+               b->tcp_rate_max[TCP_CTR_LISTEN_OVERFLOWS]);
+    }
     printf("\n");
     printf("Expected Ports (%d):\n  ", b->expected_port_count);
     for (int i = 0; i < b->expected_port_count; i++) {
@@ -0,0 +1,490 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * catalogc.c - Build-time compiler for the compliance catalogs
+ *
+ * Reads the JSON control catalogs and mapping.conf and writes a C file
+ * of const tables (see compliance.h) that is linked into sentinel:
+ *
+ *   catalogc -m mapping.conf -o compliance_catalog.c name=catalog.json ...
+ *
+ * Only id, label, title and group are kept; the long control text,
+ * which is most of the 2.8 MB, is left in the JSON. Controls shared
+ * between frameworks (FedRAMP baselines are NIST subsets) are stored
+ * once, and repeated strings are pooled.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdarg.h>
+
+#include "compliance.h"
+
+#define MAX_CONTROLS 8192
+#define MAX_FRAMEWORKS 32
+#define MAX_FIELD 512
+#define HASH_SIZE 16384         /* Power of two, > 2 x (controls + strings) */
+
+typedef struct {
+    uint32_t id, label, title, group;
+    char family[4];
+    uint32_t checks;            /* Bit per compliance_check_t */
+} control_t;
+
+typedef struct {
+    const char *name;
+    uint32_t first;
+    uint32_t count;
+} framework_t;
+
+static const char *check_names[COMPLIANCE_CHECK_COUNT] = {
+#define CHECK_NAME(e, name, desc) [e] = name,
+    COMPLIANCE_CHECKS(CHECK_NAME)
+#undef CHECK_NAME
+};
+
+/* String pool, deduplicated through pool_hash */
+static char *g_pool;
+static size_t g_pool_len, g_pool_cap;
+static int32_t g_pool_hash[HASH_SIZE];
+
+static control_t g_controls[MAX_CONTROLS];
+static uint32_t g_control_count;
+static int32_t g_control_hash[HASH_SIZE];      /* By id */
+
+static uint16_t g_fw_controls[MAX_CONTROLS * 4];
+static uint32_t g_fw_control_count;
+static framework_t g_frameworks[MAX_FRAMEWORKS];
+static uint32_t g_framework_count;
+
+static size_t g_json_bytes;
+
+static void die(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    fprintf(stderr, "catalogc: ");
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+    va_end(ap);
+    exit(1);
+}
+
+static uint32_t hash_str(const char *s) {
+    uint32_t h = 2166136261u;
+    while (*s) h = (h ^ (unsigned char)*s++) * 16777619u;
+    return h;
+}
+
+static uint32_t pool_add(const char *s) {
+    uint32_t slot = hash_str(s) & (HASH_SIZE - 1);
+    while (g_pool_hash[slot] >= 0) {
+        if (strcmp(g_pool + g_pool_hash[slot], s) == 0) return (uint32_t)g_pool_hash[slot];
+        slot = (slot + 1) & (HASH_SIZE - 1);
+    }
+
+    size_t len = strlen(s) + 1;
+    if (g_pool_len + len > g_pool_cap) {
+        g_pool_cap = (g_pool_cap + len) * 2;
+        g_pool = realloc(g_pool, g_pool_cap);
+        if (!g_pool) die("out of memory");
+    }
+    memcpy(g_pool + g_pool_len, s, len);
+    g_pool_hash[slot] = (int32_t)g_pool_len;
+    g_pool_len += len;
+    return (uint32_t)g_pool_hash[slot];
+}
+
+/* Index of the control with this id, or -1 */
+static int32_t *control_slot(const char *id) {
+    uint32_t slot = hash_str(id) & (HASH_SIZE - 1);
+    while (g_control_hash[slot] >= 0 &&
+           strcmp(g_pool + g_controls[g_control_hash[slot]].id, id) != 0) {
+        slot = (slot + 1) & (HASH_SIZE - 1);
+    }
+    return &g_control_hash[slot];
+}
+
+static char *read_file(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) die("cannot open %s", path);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = malloc((size_t)size + 1);
+    if (!data || fread(data, 1, (size_t)size, f) != (size_t)size) die("cannot read %s", path);
+    data[size] = '\0';
+    fclose(f);
+    g_json_bytes += (size_t)size;
+    return data;
+}
+
+/* ============================================================
+ * JSON
+ *
+ * Just enough to walk the catalogs: any object with a string "id" is
+ * a control, wherever it sits (an array in the FedRAMP and CMMC files,
+ * values of a map keyed by id in the NIST one).
+ * ============================================================ */
+
+typedef struct {
+    const char *path;
+    const char *start;
+    const char *p;
+    framework_t *fw;            /* Controls found are added here */
+} parser_t;
+
+static void parse_value(parser_t *ps, char *out, size_t out_size);
+
+static void skip_ws(parser_t *ps) {
+    while (isspace((unsigned char)*ps->p)) ps->p++;
+}
+
+static void expect(parser_t *ps, char c) {
+    skip_ws(ps);
+    if (*ps->p != c) die("%s: expected '%c' at offset %ld", ps->path, c, (long)(ps->p - ps->start));
+    ps->p++;
+}
+
+/* Append bytes to out unless it is full; once one does not fit the
+ * rest are dropped too, so a truncated string never ends mid-character */
+static void put_bytes(char *out, size_t out_size, size_t *n, const char *bytes, size_t len) {
+    if (!out || *n >= out_size) return;
+    if (*n + len >= out_size) {
+        out[*n] = '\0';
+        *n = out_size;
+        return;
+    }
+    memcpy(out + *n, bytes, len);
+    *n += len;
+}
+
+static void put_utf8(char *out, size_t out_size, size_t *n, unsigned cp) {
+    char tmp[4];
+    size_t len;
+    if (cp < 0x80) {
+        tmp[0] = (char)cp; len = 1;
+    } else if (cp < 0x800) {
+        tmp[0] = (char)(0xC0 | cp >> 6); tmp[1] = (char)(0x80 | (cp & 0x3F)); len = 2;
+    } else if (cp < 0x10000) {
+        tmp[0] = (char)(0xE0 | cp >> 12); tmp[1] = (char)(0x80 | (cp >> 6 & 0x3F));
+        tmp[2] = (char)(0x80 | (cp & 0x3F)); len = 3;
+    } else {
+        tmp[0] = (char)(0xF0 | cp >> 18); tmp[1] = (char)(0x80 | (cp >> 12 & 0x3F));
+        tmp[2] = (char)(0x80 | (cp >> 6 & 0x3F)); tmp[3] = (char)(0x80 | (cp & 0x3F)); len = 4;
+    }
+    put_bytes(out, out_size, n, tmp, len);
+}
+
+static unsigned parse_hex4(parser_t *ps) {
+    unsigned v = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = *ps->p++;
+        v <<= 4;
+        if (c >= '0' && c <= '9') v |= (unsigned)(c - '0');
+        else if (c >= 'a' && c <= 'f') v |= (unsigned)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') v |= (unsigned)(c - 'A' + 10);
+        else die("%s: bad \\u escape", ps->path);
+    }
+    return v;
+}
+
+/* Decode a string into out (truncated, control characters become
+ * spaces); out may be NULL to skip it */
+static void parse_string(parser_t *ps, char *out, size_t out_size) {
+    size_t n = 0;
+    expect(ps, '"');
+    while (*ps->p != '"') {
+        const char *raw = ps->p;
+        unsigned char c = (unsigned char)*ps->p++;
+        if (c == '\0') die("%s: unterminated string", ps->path);
+        if (c == '\\') {
+            char e = *ps->p++;
+            unsigned cp;
+            switch (e) {
+                case 'n': case 'r': case 't': case 'b': case 'f': cp = ' '; break;
+                case 'u':
+                    cp = parse_hex4(ps);
+                    if (cp >= 0xD800 && cp < 0xDC00 && ps->p[0] == '\\' && ps->p[1] == 'u') {
+                        ps->p += 2;
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (parse_hex4(ps) - 0xDC00);
+                    }
+                    break;
+                default: cp = (unsigned char)e; break;
+            }
+            put_utf8(out, out_size, &n, cp < 0x20 ? ' ' : cp);
+        } else if (c < 0x20) {
+            put_bytes(out, out_size, &n, " ", 1);
+        } else {
+            /* UTF-8 passes through a whole sequence at a time */
+            while ((*ps->p & 0xC0) == 0x80) ps->p++;
+            put_bytes(out, out_size, &n, raw, (size_t)(ps->p - raw));
+        }
+    }
+    ps->p++;
+    if (out && n < out_size) out[n] = '\0';
+}
+
+static void add_control(framework_t *fw, const char *id, const char *label,
+                        const char *title, const char *group);
+
+static void parse_object(parser_t *ps) {
+    char key[64];
+    char id[MAX_FIELD] = "", label[MAX_FIELD] = "", title[MAX_FIELD] = "", group[MAX_FIELD] = "";
+
+    expect(ps, '{');
+    skip_ws(ps);
+    if (*ps->p == '}') { ps->p++; return; }
+    for (;;) {
+        parse_string(ps, key, sizeof(key));
+        expect(ps, ':');
+        skip_ws(ps);
+
+        char *field = strcmp(key, "id") == 0 ? id :
+                      strcmp(key, "label") == 0 ? label :
+                      strcmp(key, "title") == 0 ? title :
+                      strcmp(key, "group") == 0 ? group : NULL;
+        parse_value(ps, *ps->p == '"' ? field : NULL, MAX_FIELD);
+
+        skip_ws(ps);
+        if (*ps->p == ',') { ps->p++; continue; }
+        expect(ps, '}');
+        break;
+    }
+
+    if (id[0]) add_control(ps->fw, id, label, title, group);
+}
+
+static void parse_value(parser_t *ps, char *out, size_t out_size) {
+    skip_ws(ps);
+    char c = *ps->p;
+    if (c == '"') {
+        parse_string(ps, out, out_size);
+    } else if (c == '{') {
+        parse_object(ps);
+    } else if (c == '[') {
+        ps->p++;
+        skip_ws(ps);
+        if (*ps->p == ']') { ps->p++; return; }
+        for (;;) {
+            parse_value(ps, NULL, 0);
+            skip_ws(ps);
+            if (*ps->p == ',') { ps->p++; continue; }
+            expect(ps, ']');
+            break;
+        }
+    } else if (strncmp(ps->p, "null", 4) == 0 || strncmp(ps->p, "true", 4) == 0) {
+        ps->p += 4;
+    } else if (strncmp(ps->p, "false", 5) == 0) {
+        ps->p += 5;
+    } else if (c == '-' || isdigit((unsigned char)c)) {
+        while (*ps->p && strchr("+-.eE0123456789", *ps->p)) ps->p++;
+    } else {
+        die("%s: unexpected '%c'", ps->path, c ? c : '0');
+    }
+}
+
+static void add_control(framework_t *fw, const char *id, const char *label,
+                        const char *title, const char *group) {
+    int32_t *slot = control_slot(id);
+    if (*slot < 0) {
+        if (g_control_count >= MAX_CONTROLS) die("more than %d controls", MAX_CONTROLS);
+        control_t *c = &g_controls[g_control_count];
+        c->id = pool_add(id);
+        c->label = pool_add(label[0] ? label : id);
+        c->title = pool_add(title);
+        c->group = pool_add(group);
+        /* Family: the id up to the first '-' or '.', upper-cased */
+        size_t i = 0;
+        while (i < sizeof(c->family) - 1 && isalpha((unsigned char)id[i])) {
+            c->family[i] = (char)toupper((unsigned char)id[i]);
+            i++;
+        }
+        *slot = (int32_t)g_control_count++;
+    }
+
+    /* A framework lists each control once */
+    for (uint32_t i = fw->first; i < fw->first + fw->count; i++) {
+        if (g_fw_controls[i] == (uint16_t)*slot) return;
+    }
+    if (g_fw_control_count >= sizeof(g_fw_controls) / sizeof(g_fw_controls[0])) {
+        die("too many framework controls");
+    }
+    g_fw_controls[g_fw_control_count++] = (uint16_t)*slot;
+    fw->count++;
+}
+
+static void compile_catalog(const char *name, const char *path) {
+    if (g_framework_count >= MAX_FRAMEWORKS) die("too many frameworks");
+    framework_t *fw = &g_frameworks[g_framework_count++];
+    fw->name = name;
+    fw->first = g_fw_control_count;
+    fw->count = 0;
+
+    char *json = read_file(path);
+    parser_t ps = { .path = path, .start = json, .p = json, .fw = fw };
+    parse_value(&ps, NULL, 0);
+    free(json);
+
+    if (fw->count == 0) die("%s: no controls", path);
+}
+
+/* ============================================================
+ * Mapping
+ * ============================================================ */
+
+static char *trim(char *s) {
+    while (isspace((unsigned char)*s)) s++;
+    char *end = s + strlen(s);
+    while (end > s && isspace((unsigned char)end[-1])) end--;
+    *end = '\0';
+    return s;
+}
+
+static int compile_mapping(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) die("cannot open %s", path);
+
+    char line[4096];
+    int lineno = 0, mappings = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        char *s = trim(line);
+        if (*s == '#' || *s == '\0') continue;
+
+        char *eq = strchr(s, '=');
+        if (!eq) die("%s:%d: expected 'check = control ...'", path, lineno);
+        *eq = '\0';
+        char *check = trim(s);
+
+        int bit = -1;
+        for (int i = 0; i < COMPLIANCE_CHECK_COUNT; i++) {
+            if (strcmp(check, check_names[i]) == 0) bit = i;
+        }
+        if (bit < 0) die("%s:%d: unknown check '%s'", path, lineno, check);
+
+        for (char *id = strtok(eq + 1, " \t\r\n,"); id; id = strtok(NULL, " \t\r\n,")) {
+            int32_t *slot = control_slot(id);
+            if (*slot < 0) die("%s:%d: no control '%s' in any catalog", path, lineno, id);
+            g_controls[*slot].checks |= 1u << bit;
+            mappings++;
+        }
+    }
+    fclose(f);
+    return mappings;
+}
+
+/* ============================================================
+ * Output
+ * ============================================================ */
+
+static size_t write_tables(FILE *out) {
+    size_t bytes = 0;
+
+    fprintf(out, "/* Generated by catalogc from data/compliance - do not edit */\n\n");
+    fprintf(out, "#include \"compliance.h\"\n\n");
+
+    /* Byte list rather than a literal: C99 only promises 4095-char strings */
+    fprintf(out, "const char compliance_strings[] = {");
+    for (size_t i = 0; i < g_pool_len; i++) {
+        fprintf(out, "%s%d,", i % 16 ? " " : "\n    ", (signed char)g_pool[i]);
+    }
+    fprintf(out, "\n};\n\n");
+    bytes += g_pool_len;
+
+    uint32_t check_count = 0;
+    fprintf(out, "const compliance_control_t compliance_controls[] = {\n");
+    for (uint32_t i = 0; i < g_control_count; i++) {
+        const control_t *c = &g_controls[i];
+        int n = 0;
+        for (int b = 0; b < COMPLIANCE_CHECK_COUNT; b++) n += (c->checks >> b) & 1;
+        fprintf(out, "    { %u, %u, %u, %u, \"%s\", %u, %d },\n",
+                c->id, c->label, c->title, c->group, c->family, check_count, n);
+        check_count += (uint32_t)n;
+    }
+    fprintf(out, "};\n");
+    fprintf(out, "const uint32_t compliance_control_count = %u;\n\n", g_control_count);
+    bytes += g_control_count * sizeof(compliance_control_t);
+    if (check_count > UINT16_MAX) die("too many mappings");
+
+    /* One trailing entry so the array is never empty */
+    fprintf(out, "const uint8_t compliance_control_checks[] = {");
+    uint32_t k = 0;
+    for (uint32_t i = 0; i < g_control_count; i++) {
+        for (int b = 0; b < COMPLIANCE_CHECK_COUNT; b++) {
+            if (g_controls[i].checks & (1u << b)) {
+                fprintf(out, "%s%d,", k++ % 16 ? " " : "\n    ", b);
+            }
+        }
+    }
+    fprintf(out, "\n    0\n};\n\n");
+    bytes += check_count + 1;
+
+    fprintf(out, "const uint16_t compliance_framework_controls[] = {");
+    for (uint32_t i = 0; i < g_fw_control_count; i++) {
+        fprintf(out, "%s%u,", i % 16 ? " " : "\n    ", g_fw_controls[i]);
+    }
+    fprintf(out, "\n};\n\n");
+    bytes += g_fw_control_count * sizeof(uint16_t);
+
+    fprintf(out, "const compliance_framework_t compliance_frameworks[] = {\n");
+    for (uint32_t i = 0; i < g_framework_count; i++) {
+        fprintf(out, "    { \"%s\", %u, %u },\n", g_frameworks[i].name,
+                g_frameworks[i].first, g_frameworks[i].count);
+    }
+    fprintf(out, "};\n");
+    fprintf(out, "const uint32_t compliance_framework_count = %u;\n", g_framework_count);
+    bytes += g_framework_count * sizeof(compliance_framework_t);
+
+    return bytes;
+}
+
+int main(int argc, char **argv) {
+    const char *mapping = NULL;
+    const char *output = NULL;
+    int first_catalog = argc;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            mapping = argv[++i];
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            first_catalog = i;
+            break;
+        }
+    }
+    if (!mapping || !output || first_catalog >= argc) {
+        fprintf(stderr, "Usage: %s -m mapping.conf -o out.c name=catalog.json ...\n", argv[0]);
+        return 1;
+    }
+
+    memset(g_pool_hash, -1, sizeof(g_pool_hash));
+    memset(g_control_hash, -1, sizeof(g_control_hash));
+
+    for (int i = first_catalog; i < argc; i++) {
+        char *eq = strchr(argv[i], '=');
+        if (!eq) die("expected name=catalog.json, got '%s'", argv[i]);
+        *eq = '\0';
+        compile_catalog(argv[i], eq + 1);
+    }
+    int mappings = compile_mapping(mapping);
+
+    FILE *out = fopen(output, "w");
+    if (!out) die("cannot write %s", output);
+    size_t bytes = write_tables(out);
+    if (fclose(out) != 0) die("cannot write %s", output);
+
+    fprintf(stderr, "catalogc: %u frameworks, %u controls, %d mappings: "
+            "%.1f KB of tables from %.1f MB of JSON\n",
+            g_framework_count, g_control_count, mappings,
+            bytes / 1024.0, g_json_bytes / (1024.0 * 1024.0));
+    return 0;
+}
@@ -0,0 +1,1956 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * collector.c - sentinel-collector: fleet ingest, storage and queries
+ *
+ * One thread runs an epoll loop over the listening sockets and every
+ * agent connection. It only cuts frames (collector.h) and queues them:
+ *
+ *   loop --frames--> decode pool --records--> storage shard (by host)
+ *                                                 |
+ *   loop <--replies (eventfd)---------------------+
+ *
+ * Decode workers turn JSON fingerprints into collector_record_t; binary
+ * frames are already one. Each host belongs to one storage shard, so
+ * its log has a single writer and stays in arrival order without
+ * locks. Queries about a host go straight to its shard. Full queues
+ * push back: the loop stops reading from a connection until the
+ * workers catch up.
+ *
+ * On disk, DIR/<hostname>/ holds numbered segments:
+ *
+ *   NNNNNNNN.seg  "SNTLSEG1", then per fingerprint:
+ *                 u32 length, encoded record, fingerprint JSON (if any)
+ *   NNNNNNNN.idx  per fingerprint: i64 time, u64 offset in .seg
+ *
+ * (big-endian). A segment is closed at SEGMENT_MAX bytes. Index times
+ * never go backwards - a probe_time older than the last one is indexed
+ * at the last one - so range queries can binary-search them.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <time.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <dirent.h>
+#include <limits.h>
+#include <netdb.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/resource.h>
+
+#include "collector.h"
+
+#define DEFAULT_DATA_DIR    "/var/lib/sentinel/collector"
+#define SEGMENT_MAGIC       "SNTLSEG1"
+#define SEGMENT_MAX         (16u << 20)
+#define INDEX_ENTRY_SIZE    16
+#define DECODE_QUEUE_MAX    65536       /* Frames waiting for a decoder */
+#define SHARD_QUEUE_MAX     16384       /* Per shard */
+#define OPEN_HOSTS_MAX      64          /* Hosts with open log fds, per shard */
+#define RANGE_MAX           10000       /* Records in one range reply */
+#define WORKERS_MAX         16
+#define READ_CHUNK          65536
+#define BACKLOG             1024
+
+/* ============================================================
+ * Growable Buffer
+ * ============================================================ */
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+    int failed;
+} buf_t;
+
+static int buf_reserve(buf_t *b, size_t extra) {
+    if (b->failed) return -1;
+    if (b->len + extra <= b->cap) return 0;
+    size_t cap = b->cap ? b->cap : 256;
+    while (cap < b->len + extra) cap *= 2;
+    char *p = realloc(b->data, cap);
+    if (!p) {
+        b->failed = 1;
+        return -1;
+    }
+    b->data = p;
+    b->cap = cap;
+    return 0;
+}
+
+static void buf_append(buf_t *b, const void *p, size_t n) {
+    if (buf_reserve(b, n + 1) != 0) return;
+    memcpy(b->data + b->len, p, n);
+    b->len += n;
+    b->data[b->len] = '\0';
+}
+
+static void buf_appendf(buf_t *b, const char *fmt, ...) {
+    va_list ap;
+    char small[256];
+
+    va_start(ap, fmt);
+    int n = vsnprintf(small, sizeof(small), fmt, ap);
+    va_end(ap);
+    if (n < 0) return;
+    if ((size_t)n < sizeof(small)) {
+        buf_append(b, small, (size_t)n);
+        return;
+    }
+    if (buf_reserve(b, (size_t)n + 1) != 0) return;
+    va_start(ap, fmt);
+    vsnprintf(b->data + b->len, (size_t)n + 1, fmt, ap);
+    va_end(ap);
+    b->len += (size_t)n;
+}
+
+static void buf_json_string(buf_t *b, const char *s) {
+    buf_append(b, "\"", 1);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            char esc[2] = { '\\', (char)c };
+            buf_append(b, esc, 2);
+        } else if (c < 0x20) {
+            buf_appendf(b, "\\u%04x", c);
+        } else {
+            buf_append(b, s, 1);
+        }
+    }
+    buf_append(b, "\"", 1);
+}
+
+/* ============================================================
+ * Fingerprint Decoding
+ * ============================================================
+ * Only the summary fields are wanted, so values are found by key
+ * within their section rather than by building a tree - the same
+ * approach as sentinel-diff, scoped so a key inside one section
+ * cannot be mistaken for another's.
+ */
+
+static const char *skip_ws(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) p++;
+    return p;
+}
+
+/* End of the JSON value starting at p */
+static const char *json_skip(const char *p, const char *end) {
+    p = skip_ws(p, end);
+    if (p >= end) return end;
+
+    if (*p == '"') {
+        for (p++; p < end && *p != '"'; p++) {
+            if (*p == '\\') p++;
+        }
+        return p < end ? p + 1 : end;
+    }
+    if (*p == '{' || *p == '[') {
+        int depth = 0;
+        for (; p < end; p++) {
+            if (*p == '"') {
+                for (p++; p < end && *p != '"'; p++) {
+                    if (*p == '\\') p++;
+                }
+            } else if (*p == '{' || *p == '[') {
+                depth++;
+            } else if ((*p == '}' || *p == ']') && --depth == 0) {
+                return p + 1;
+            }
+        }
+        return end;
+    }
+    while (p < end && *p != ',' && *p != '}' && *p != ']') p++;
+    return p;
+}
+
+/* Value of "key" somewhere in [p, end), or NULL */
+static const char *json_member(const char *p, const char *end, const char *key) {
+    char pattern[64];
+    int n = snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    if (n < 0 || (size_t)n >= sizeof(pattern) || !p) return NULL;
+
+    const char *found = memmem(p, (size_t)(end - p), pattern, (size_t)n);
+    if (!found) return NULL;
+    found = skip_ws(found + n, end);
+    return found < end ? found : NULL;
+}
+
+/* A section object as [*start, *sec_end); 0 if present */
+static int json_section(const char *json, const char *end, const char *key,
+                        const char **start, const char **sec_end) {
+    const char *v = json_member(json, end, key);
+    if (!v || *v != '{') return -1;
+    *start = v;
+    *sec_end = json_skip(v, end);
+    return 0;
+}
+
+static double json_number(const char *p, const char *end, const char *key, double fallback) {
+    const char *v = json_member(p, end, key);
+    if (!v || *v == '"' || *v == '{' || *v == '[') return fallback;
+    char *stop;
+    double d = strtod(v, &stop);
+    return stop == v ? fallback : d;
+}
+
+static uint32_t json_count(const char *p, const char *end, const char *key) {
+    double d = json_number(p, end, key, 0);
+    return d > 0 && d < 4294967295.0 ? (uint32_t)d : 0;
+}
+
+/* Copy a string value, unescaping \x as x; 0 if it was a string */
+static int json_string(const char *p, const char *end, const char *key, char *out, size_t size) {
+    const char *v = json_member(p, end, key);
+    if (!v || *v != '"') return -1;
+
+    size_t n = 0;
+    for (v++; v < end && *v != '"' && n < size - 1; v++) {
+        if (*v == '\\' && v + 1 < end) v++;
+        out[n++] = *v;
+    }
+    out[n] = '\0';
+    return 0;
+}
+
+/* Hostnames name directories, so only DNS-ish characters */
+static int valid_hostname(const char *name) {
+    size_t len = strlen(name);
+    if (len == 0 || len >= COLLECTOR_HOST_MAX || name[0] == '.' || name[0] == '-') return 0;
+    for (const char *p = name; *p; p++) {
+        if (!((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') ||
+              (*p >= '0' && *p <= '9') || *p == '.' || *p == '-' || *p == '_')) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* json must be NUL-terminated at end */
+static int decode_fingerprint(const char *json, size_t len, collector_record_t *r) {
+    const char *end = json + len;
+    const char *s, *e;
+    char when[32];
+
+    memset(r, 0, sizeof(*r));
+    r->audit_risk_score = -1;
+
+    if (json_section(json, end, "system", &s, &e) != 0 ||
+        json_string(s, e, "hostname", r->hostname, sizeof(r->hostname)) != 0 ||
+        !valid_hostname(r->hostname)) {
+        return -1;
+    }
+    const char *load = json_member(s, e, "load_average");
+    if (load && *load == '[') {
+        char *stop;
+        const char *q = load + 1;
+        for (int i = 0; i < 3; i++) {
+            r->load_avg[i] = (float)strtod(q, &stop);
+            q = stop;
+            while (q < e && (*q == ',' || *q == ' ')) q++;
+        }
+    }
+    r->mem_used_pct = (float)json_number(s, e, "memory_used_percent", 0);
+
+    /* "2025-01-31T12:00:00Z"; arrival time if absent */
+    struct tm tm;
+    memset(&tm, 0, sizeof(tm));
+    if (json_string(json, end, "probe_time", when, sizeof(when)) == 0 &&
+        sscanf(when, "%d-%d-%dT%d:%d:%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+               &tm.tm_hour, &tm.tm_min, &tm.tm_sec) == 6) {
+        tm.tm_year -= 1900;
+        tm.tm_mon -= 1;
+        r->probe_time = (int64_t)timegm(&tm);
+    } else {
+        r->probe_time = (int64_t)time(NULL);
+    }
+    r->probe_errors = json_count(json, end, "probe_errors");
+
+    if (json_section(json, end, "process_summary", &s, &e) == 0) {
+        r->processes = json_count(s, e, "total_count");
+        r->zombies = json_count(s, e, "zombie_count");
+        r->high_fd_processes = json_count(s, e, "high_fd_count");
+    }
+    if (json_section(json, end, "network", &s, &e) == 0) {
+        r->listeners = json_count(s, e, "total_listeners");
+        r->established = json_count(s, e, "total_established");
+        r->unusual_ports = json_count(s, e, "unusual_ports");
+    }
+    if (json_section(json, end, "rules", &s, &e) == 0) {
+        r->rule_hits = json_count(s, e, "critical") + json_count(s, e, "warnings");
+    }
+    if (json_section(json, end, "audit_summary", &s, &e) == 0) {
+        r->audit_risk_score = (int32_t)json_number(s, e, "risk_score", -1);
+    }
+    return 0;
+}
+
+static void record_to_json(buf_t *b, const collector_record_t *r) {
+    buf_appendf(b, "{\"probe_time\": %lld, \"load_avg\": [%.2f, %.2f, %.2f], "
+                "\"mem_used_pct\": %.1f, ",
+                (long long)r->probe_time, r->load_avg[0], r->load_avg[1], r->load_avg[2],
+                r->mem_used_pct);
+    buf_appendf(b, "\"processes\": %u, \"zombies\": %u, \"high_fd_processes\": %u, ",
+                r->processes, r->zombies, r->high_fd_processes);
+    buf_appendf(b, "\"listeners\": %u, \"established\": %u, \"unusual_ports\": %u, ",
+                r->listeners, r->established, r->unusual_ports);
+    buf_appendf(b, "\"rule_hits\": %u, \"probe_errors\": %u, \"audit_risk_score\": %d}",
+                r->rule_hits, r->probe_errors, r->audit_risk_score);
+}
+
+/* ============================================================
+ * Host Registry
+ * ============================================================
+ * Every host ever seen, by name. The summary fields are shared and
+ * guarded by g_reg_lock; the storage fields belong to the host's shard
+ * thread alone.
+ */
+
+typedef struct {
+    char name[COLLECTOR_HOST_MAX];
+    uint32_t hash;
+
+    /* g_reg_lock */
+    collector_record_t latest;
+    int have_latest;
+    uint64_t records;
+
+    /* Owning shard only */
+    int seq;                    /* Newest segment, -1 = none */
+    uint64_t seg_size;
+    int seg_fd;                 /* -1 unless in the shard's open set */
+    int idx_fd;
+    int64_t last_time;          /* Newest index time */
+    uint64_t lru;
+} host_t;
+
+static pthread_mutex_t g_reg_lock = PTHREAD_MUTEX_INITIALIZER;
+static host_t **g_hosts;        /* Open addressing, power-of-two size */
+static size_t g_host_cap;
+static size_t g_host_count;
+static uint64_t g_total_records;
+
+static uint32_t hash_name(const char *s) {
+    uint32_t h = 2166136261u;
+    for (; *s; s++) h = (h ^ (unsigned char)*s) * 16777619u;
+    return h;
+}
+
+static int registry_grow(void) {
+    size_t cap = g_host_cap ? g_host_cap * 2 : 1024;
+    host_t **table = calloc(cap, sizeof(*table));
+    if (!table) return -1;
+    for (size_t i = 0; i < g_host_cap; i++) {
+        host_t *h = g_hosts[i];
+        if (!h) continue;
+        size_t j = h->hash & (cap - 1);
+        while (table[j]) j = (j + 1) & (cap - 1);
+        table[j] = h;
+    }
+    free(g_hosts);
+    g_hosts = table;
+    g_host_cap = cap;
+    return 0;
+}
+
+/* Caller holds g_reg_lock */
+static host_t *registry_find(const char *name, int create) {
+    uint32_t hash = hash_name(name);
+    if (g_host_cap) {
+        for (size_t i = hash & (g_host_cap - 1); g_hosts[i]; i = (i + 1) & (g_host_cap - 1)) {
+            if (g_hosts[i]->hash == hash && strcmp(g_hosts[i]->name, name) == 0) return g_hosts[i];
+        }
+    }
+    if (!create) return NULL;
+    if ((g_host_count + 1) * 10 > g_host_cap * 7 && registry_grow() != 0) return NULL;
+
+    host_t *h = calloc(1, sizeof(*h));
+    if (!h) return NULL;
+    snprintf(h->name, sizeof(h->name), "%s", name);
+    h->hash = hash;
+    h->seq = -1;
+    h->seg_fd = h->idx_fd = -1;
+
+    size_t i = hash & (g_host_cap - 1);
+    while (g_hosts[i]) i = (i + 1) & (g_host_cap - 1);
+    g_hosts[i] = h;
+    g_host_count++;
+    return h;
+}
+
+static host_t *registry_get(const char *name, int create) {
+    pthread_mutex_lock(&g_reg_lock);
+    host_t *h = registry_find(name, create);
+    pthread_mutex_unlock(&g_reg_lock);
+    return h;
+}
+
+/* ============================================================
+ * Segment Storage
+ * ============================================================ */
+
+static char g_data_dir[512];
+
+static void segment_path(const host_t *h, int seq, const char *ext, char *out, size_t size) {
+    snprintf(out, size, "%s/%s/%08d.%s", g_data_dir, h->name, seq, ext);
+}
+
+static int read_full(int fd, void *buf, size_t len, off_t off) {
+    ssize_t n = pread(fd, buf, len, off);
+    return n == (ssize_t)len ? 0 : -1;
+}
+
+/* Entry n of an open index */
+static int index_entry(int fd, uint64_t n, int64_t *time, uint64_t *offset) {
+    unsigned char e[INDEX_ENTRY_SIZE];
+    if (read_full(fd, e, sizeof(e), (off_t)(n * INDEX_ENTRY_SIZE)) != 0) return -1;
+    *time = (int64_t)collector_get_u64(e);
+    *offset = collector_get_u64(e + 8);
+    return 0;
+}
+
+/* Record (and optionally JSON) of the entry at offset in an open segment */
+static int segment_entry(int fd, uint64_t offset, collector_record_t *r, buf_t *json) {
+    unsigned char head[4 + COLLECTOR_RECORD_SIZE];
+    if (read_full(fd, head, sizeof(head), (off_t)offset) != 0) return -1;
+    uint32_t len = collector_get_u32(head);
+    if (len < COLLECTOR_RECORD_SIZE || len > COLLECTOR_FRAME_MAX ||
+        collector_record_decode(head + 4, r) != 0) {
+        return -1;
+    }
+    if (json && len > COLLECTOR_RECORD_SIZE) {
+        size_t n = len - COLLECTOR_RECORD_SIZE;
+        if (buf_reserve(json, n + 1) != 0 ||
+            read_full(fd, json->data + json->len, n, (off_t)(offset + sizeof(head))) != 0) {
+            return -1;
+        }
+        json->len += n;
+        json->data[json->len] = '\0';
+    }
+    return 0;
+}
+
+/* Segment numbers and sizes from an existing host directory, and its
+ * newest record into the registry. Startup only, before any thread. */
+static void host_load(host_t *h) {
+    char path[PATH_MAX], *dot;
+    snprintf(path, sizeof(path), "%s/%s", g_data_dir, h->name);
+    DIR *d = opendir(path);
+    if (!d) return;
+
+    struct dirent *e;
+    while ((e = readdir(d)) != NULL) {
+        if (!(dot = strchr(e->d_name, '.')) || strcmp(dot, ".idx") != 0) continue;
+        int seq = atoi(e->d_name);
+        struct stat st;
+        segment_path(h, seq, "idx", path, sizeof(path));
+        if (stat(path, &st) == 0) h->records += (uint64_t)st.st_size / INDEX_ENTRY_SIZE;
+        if (seq > h->seq) h->seq = seq;
+    }
+    closedir(d);
+    if (h->seq < 0) return;
+
+    struct stat st;
+    segment_path(h, h->seq, "seg", path, sizeof(path));
+    if (stat(path, &st) == 0) h->seg_size = (uint64_t)st.st_size;
+
+    segment_path(h, h->seq, "idx", path, sizeof(path));
+    int idx = open(path, O_RDONLY | O_CLOEXEC);
+    segment_path(h, h->seq, "seg", path, sizeof(path));
+    int seg = open(path, O_RDONLY | O_CLOEXEC);
+    uint64_t offset;
+    if (idx >= 0 && seg >= 0 && fstat(idx, &st) == 0 && st.st_size >= INDEX_ENTRY_SIZE &&
+        index_entry(idx, (uint64_t)st.st_size / INDEX_ENTRY_SIZE - 1, &h->last_time, &offset) == 0 &&
+        segment_entry(seg, offset, &h->latest, NULL) == 0) {
+        h->have_latest = 1;
+    }
+    if (idx >= 0) close(idx);
+    if (seg >= 0) close(seg);
+    g_total_records += h->records;
+}
+
+static int registry_load(void) {
+    DIR *d = opendir(g_data_dir);
+    if (!d) return -1;
+    struct dirent *e;
+    while ((e = readdir(d)) != NULL) {
+        if (!valid_hostname(e->d_name)) continue;
+        host_t *h = registry_find(e->d_name, 1);
+        if (h) host_load(h);
+    }
+    closedir(d);
+    return 0;
+}
+
+/* ============================================================
+ * Work Queues
+ * ============================================================ */
+
+typedef enum {
+    JOB_JSON = FRAME_JSON,
+    JOB_RECORD = FRAME_RECORD,
+    JOB_LATEST = FRAME_LATEST,
+    JOB_RANGE = FRAME_RANGE,
+    JOB_STORE = 64,             /* Decoded, for a shard */
+    JOB_STOP
+} job_type_t;
+
+typedef struct job {
+    struct job *next;
+    job_type_t type;
+    int fd;                     /* Connection that sent it, for replies */
+    uint64_t conn_id;
+    collector_record_t rec;     /* JOB_STORE */
+    char host[COLLECTOR_HOST_MAX];
+    int64_t from, to;
+    char *payload;              /* NUL-terminated */
+    size_t len;
+} job_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    job_t *head;
+    job_t *tail;
+    size_t count;
+    size_t max;
+} job_queue_t;
+
+static int g_wake_fd = -1;      /* eventfd: replies ready, or resume readers */
+static volatile int g_resume_wanted;
+
+static void wake_loop(void) {
+    uint64_t one = 1;
+    if (write(g_wake_fd, &one, sizeof(one)) < 0) {
+        /* Counter already non-zero: the loop is waking anyway */
+    }
+}
+
+static void queue_init(job_queue_t *q, size_t max) {
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->not_empty, NULL);
+    pthread_cond_init(&q->not_full, NULL);
+    q->head = q->tail = NULL;
+    q->count = 0;
+    q->max = max;
+}
+
+/* -1 if full and not waiting */
+static int queue_push(job_queue_t *q, job_t *job, int wait) {
+    pthread_mutex_lock(&q->lock);
+    while (q->count >= q->max && job->type != JOB_STOP) {
+        if (!wait) {
+            pthread_mutex_unlock(&q->lock);
+            return -1;
+        }
+        pthread_cond_wait(&q->not_full, &q->lock);
+    }
+    job->next = NULL;
+    if (q->tail) q->tail->next = job;
+    else q->head = job;
+    q->tail = job;
+    q->count++;
+    pthread_cond_signal(&q->not_empty);
+    pthread_mutex_unlock(&q->lock);
+    return 0;
+}
+
+static job_t *queue_pop(job_queue_t *q) {
+    pthread_mutex_lock(&q->lock);
+    while (!q->head) pthread_cond_wait(&q->not_empty, &q->lock);
+    job_t *job = q->head;
+    q->head = job->next;
+    if (!q->head) q->tail = NULL;
+    q->count--;
+    int drained = q->count <= q->max / 2;
+    pthread_cond_signal(&q->not_full);
+    pthread_mutex_unlock(&q->lock);
+
+    /* The loop paused a reader on a full queue; there is room again */
+    if (drained && g_resume_wanted && __sync_bool_compare_and_swap(&g_resume_wanted, 1, 0)) {
+        wake_loop();
+    }
+    return job;
+}
+
+static void job_free(job_t *job) {
+    if (!job) return;
+    free(job->payload);
+    free(job);
+}
+
+/* ============================================================
+ * Replies (workers -> loop)
+ * ============================================================ */
+
+typedef struct reply {
+    struct reply *next;
+    int fd;
+    uint64_t conn_id;
+    unsigned char type;
+    size_t len;
+    char data[];
+} reply_t;
+
+static pthread_mutex_t g_reply_lock = PTHREAD_MUTEX_INITIALIZER;
+static reply_t *g_reply_head;
+static reply_t *g_reply_tail;
+
+static void post_reply(const job_t *job, unsigned char type, const char *data, size_t len) {
+    reply_t *r = malloc(sizeof(*r) + len);
+    if (!r) return;
+    r->next = NULL;
+    r->fd = job->fd;
+    r->conn_id = job->conn_id;
+    r->type = type;
+    r->len = len;
+    memcpy(r->data, data, len);
+
+    pthread_mutex_lock(&g_reply_lock);
+    if (g_reply_tail) g_reply_tail->next = r;
+    else g_reply_head = r;
+    g_reply_tail = r;
+    pthread_mutex_unlock(&g_reply_lock);
+    wake_loop();
+}
+
+static void post_json(const job_t *job, buf_t *b) {
+    if (b->failed) {
+        post_reply(job, FRAME_ERROR, "out of memory", 13);
+    } else {
+        post_reply(job, FRAME_REPLY, b->data, b->len);
+    }
+    free(b->data);
+}
+
+static void post_error(const job_t *job, const char *msg) {
+    post_reply(job, FRAME_ERROR, msg, strlen(msg));
+}
+
+/* ============================================================
+ * Storage Shards
+ * ============================================================ */
+
+typedef struct {
+    pthread_t thread;
+    job_queue_t queue;
+    host_t *open[OPEN_HOSTS_MAX];
+    int open_count;
+    uint64_t tick;
+} shard_t;
+
+static shard_t g_shards[WORKERS_MAX];
+static int g_shard_count;
+
+/* Counters, updated with __sync builtins */
+static uint64_t g_frames;
+static uint64_t g_bad_frames;
+static uint64_t g_write_errors;
+
+static shard_t *shard_of(const char *name) {
+    return &g_shards[hash_name(name) % (uint32_t)g_shard_count];
+}
+
+static void host_close(host_t *h) {
+    if (h->seg_fd >= 0) close(h->seg_fd);
+    if (h->idx_fd >= 0) close(h->idx_fd);
+    h->seg_fd = h->idx_fd = -1;
+}
+
+static int host_open_files(host_t *h) {
+    char path[PATH_MAX];
+
+    if (h->seq < 0) {
+        h->seq = 0;
+        h->seg_size = 0;
+    }
+    snprintf(path, sizeof(path), "%s/%s", g_data_dir, h->name);
+    if (mkdir(path, 0750) != 0 && errno != EEXIST) return -1;
+
+    segment_path(h, h->seq, "seg", path, sizeof(path));
+    h->seg_fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0640);
+    segment_path(h, h->seq, "idx", path, sizeof(path));
+    h->idx_fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0640);
+    if (h->seg_fd < 0 || h->idx_fd < 0) {
+        host_close(h);
+        return -1;
+    }
+    if (h->seg_size == 0) {
+        if (write(h->seg_fd, SEGMENT_MAGIC, 8) != 8) {
+            host_close(h);
+            return -1;
+        }
+        h->seg_size = 8;
+    }
+    return 0;
+}
+
+/* Make h's log fds open, closing the least recently used host's if
+ * the shard is at OPEN_HOSTS_MAX */
+static int shard_open(shard_t *sh, host_t *h) {
+    h->lru = ++sh->tick;
+    if (h->seg_fd >= 0) return 0;
+
+    if (sh->open_count == OPEN_HOSTS_MAX) {
+        int victim = 0;
+        for (int i = 1; i < sh->open_count; i++) {
+            if (sh->open[i]->lru < sh->open[victim]->lru) victim = i;
+        }
+        host_close(sh->open[victim]);
+        sh->open[victim] = sh->open[--sh->open_count];
+    }
+    if (host_open_files(h) != 0) return -1;
+    sh->open[sh->open_count++] = h;
+    return 0;
+}
+
+static void shard_forget(shard_t *sh, host_t *h) {
+    for (int i = 0; i < sh->open_count; i++) {
+        if (sh->open[i] == h) {
+            sh->open[i] = sh->open[--sh->open_count];
+            break;
+        }
+    }
+    host_close(h);
+}
+
+static void shard_store(shard_t *sh, job_t *job) {
+    host_t *h = registry_get(job->rec.hostname, 1);
+    if (!h) return;
+
+    uint64_t entry_len = 4 + COLLECTOR_RECORD_SIZE + job->len;
+    if (h->seq >= 0 && h->seg_size > 8 && h->seg_size + entry_len > SEGMENT_MAX) {
+        shard_forget(sh, h);
+        h->seq++;
+        h->seg_size = 0;
+    }
+    if (shard_open(sh, h) != 0) {
+        __sync_add_and_fetch(&g_write_errors, 1);
+        return;
+    }
+
+    unsigned char head[4 + COLLECTOR_RECORD_SIZE];
+    collector_put_u32(head, (uint32_t)(COLLECTOR_RECORD_SIZE + job->len));
+    collector_record_encode(&job->rec, head + 4);
+    struct iovec iov[2] = {
+        { head, sizeof(head) },
+        { job->payload, job->len }
+    };
+
+    unsigned char idx[INDEX_ENTRY_SIZE];
+    int64_t t = job->rec.probe_time > h->last_time ? job->rec.probe_time : h->last_time;
+    collector_put_u64(idx, (uint64_t)t);
+    collector_put_u64(idx + 8, h->seg_size);
+
+    ssize_t n = writev(h->seg_fd, iov, job->len ? 2 : 1);
+    if (n != (ssize_t)entry_len || write(h->idx_fd, idx, sizeof(idx)) != sizeof(idx)) {
+        /* Torn entry: start a fresh segment rather than index past it */
+        __sync_add_and_fetch(&g_write_errors, 1);
+        shard_forget(sh, h);
+        h->seq++;
+        h->seg_size = 0;
+        return;
+    }
+    h->seg_size += entry_len;
+    h->last_time = t;
+
+    pthread_mutex_lock(&g_reg_lock);
+    h->latest = job->rec;
+    h->have_latest = 1;
+    h->records++;
+    g_total_records++;
+    pthread_mutex_unlock(&g_reg_lock);
+}
+
+static void shard_latest(job_t *job) {
+    host_t *h = registry_get(job->host, 0);
+    if (!h || h->seq < 0) {
+        post_error(job, "unknown host");
+        return;
+    }
+
+    char path[PATH_MAX];
+    buf_t b = { 0 }, json = { 0 };
+    collector_record_t r;
+    int64_t t;
+    uint64_t offset, records;
+    struct stat st;
+
+    segment_path(h, h->seq, "idx", path, sizeof(path));
+    int idx = open(path, O_RDONLY | O_CLOEXEC);
+    segment_path(h, h->seq, "seg", path, sizeof(path));
+    int seg = open(path, O_RDONLY | O_CLOEXEC);
+    int ok = idx >= 0 && seg >= 0 && fstat(idx, &st) == 0 && st.st_size >= INDEX_ENTRY_SIZE &&
+             index_entry(idx, (uint64_t)st.st_size / INDEX_ENTRY_SIZE - 1, &t, &offset) == 0 &&
+             segment_entry(seg, offset, &r, &json) == 0;
+    if (idx >= 0) close(idx);
+    if (seg >= 0) close(seg);
+    if (!ok) {
+        free(json.data);
+        post_error(job, "cannot read host log");
+        return;
+    }
+
+    pthread_mutex_lock(&g_reg_lock);
+    records = h->records;
+    pthread_mutex_unlock(&g_reg_lock);
+
+    buf_append(&b, "{\"hostname\": ", 13);
+    buf_json_string(&b, h->name);
+    buf_appendf(&b, ", \"records\": %llu, \"summary\": ", (unsigned long long)records);
+    record_to_json(&b, &r);
+    buf_appendf(&b, ", \"fingerprint\": ");
+    if (json.len) buf_append(&b, json.data, json.len);
+    else buf_append(&b, "null", 4);
+    buf_append(&b, "}\n", 2);
+    free(json.data);
+    post_json(job, &b);
+}
+
+/* First index entry with time >= from */
+static uint64_t index_lower_bound(int fd, uint64_t count, int64_t from) {
+    uint64_t lo = 0, hi = count;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        int64_t t;
+        uint64_t off;
+        if (index_entry(fd, mid, &t, &off) != 0 || t >= from) hi = mid;
+        else lo = mid + 1;
+    }
+    return lo;
+}
+
+static void shard_range(job_t *job) {
+    host_t *h = registry_get(job->host, 0);
+    if (!h || h->seq < 0) {
+        post_error(job, "unknown host");
+        return;
+    }
+
+    buf_t b = { 0 };
+    buf_append(&b, "{\"hostname\": ", 13);
+    buf_json_string(&b, h->name);
+    buf_appendf(&b, ", \"from\": %lld, \"to\": %lld, \"records\": [",
+                (long long)job->from, (long long)job->to);
+
+    int sent = 0, truncated = 0;
+    for (int seq = 0; seq <= h->seq && !truncated; seq++) {
+        char path[PATH_MAX];
+        struct stat st;
+        segment_path(h, seq, "idx", path, sizeof(path));
+        int idx = open(path, O_RDONLY | O_CLOEXEC);
+        if (idx < 0) continue;              /* Removed by hand */
+        segment_path(h, seq, "seg", path, sizeof(path));
+        int seg = open(path, O_RDONLY | O_CLOEXEC);
+
+        uint64_t count = seg >= 0 && fstat(idx, &st) == 0 ? (uint64_t)st.st_size / INDEX_ENTRY_SIZE : 0;
+        int64_t first, last;
+        uint64_t off;
+        if (count && index_entry(idx, 0, &first, &off) == 0 &&
+            index_entry(idx, count - 1, &last, &off) == 0 &&
+            last >= job->from && first <= job->to) {
+            for (uint64_t i = index_lower_bound(idx, count, job->from); i < count; i++) {
+                int64_t t;
+                collector_record_t r;
+                if (index_entry(idx, i, &t, &off) != 0 || t > job->to) break;
+                if (segment_entry(seg, off, &r, NULL) != 0) continue;
+                if (sent == RANGE_MAX) {
+                    truncated = 1;
+                    break;
+                }
+                buf_append(&b, sent ? ",\n  " : "\n  ", sent ? 4 : 3);
+                sent++;
+                record_to_json(&b, &r);
+            }
+        }
+        close(idx);
+        if (seg >= 0) close(seg);
+    }
+    buf_appendf(&b, "\n], \"count\": %d, \"truncated\": %s}\n", sent, truncated ? "true" : "false");
+    post_json(job, &b);
+}
+
+static void *shard_main(void *arg) {
+    shard_t *sh = arg;
+    for (;;) {
+        job_t *job = queue_pop(&sh->queue);
+        switch (job->type) {
+            case JOB_STORE:  shard_store(sh, job); break;
+            case JOB_LATEST: shard_latest(job); break;
+            case JOB_RANGE:  shard_range(job); break;
+            case JOB_STOP:
+                job_free(job);
+                while (sh->open_count) {
+                    host_t *h = sh->open[--sh->open_count];
+                    if (h->seg_fd >= 0) fdatasync(h->seg_fd);
+                    if (h->idx_fd >= 0) fdatasync(h->idx_fd);
+                    host_close(h);
+                }
+                return NULL;
+            default: break;
+        }
+        job_free(job);
+    }
+}
+
+/* ============================================================
+ * Decode Pool
+ * ============================================================ */
+
+static job_queue_t g_decode_queue;
+static pthread_t g_decoders[WORKERS_MAX];
+static int g_decoder_count;
+
+static void *decoder_main(void *arg) {
+    (void)arg;
+    for (;;) {
+        job_t *job = queue_pop(&g_decode_queue);
+        if (job->type == JOB_STOP) {
+            job_free(job);
+            return NULL;
+        }
+
+        int rc;
+        if (job->type == JOB_JSON) {
+            rc = decode_fingerprint(job->payload, job->len, &job->rec);
+        } else {
+            rc = collector_record_decode((const unsigned char *)job->payload, &job->rec);
+            if (rc == 0 && !valid_hostname(job->rec.hostname)) rc = -1;
+            /* Nothing beyond the record to store */
+            free(job->payload);
+            job->payload = NULL;
+            job->len = 0;
+        }
+        if (rc != 0) {
+            __sync_add_and_fetch(&g_bad_frames, 1);
+            job_free(job);
+            continue;
+        }
+        job->type = JOB_STORE;
+        queue_push(&shard_of(job->rec.hostname)->queue, job, 1);
+    }
+}
+
+/* ============================================================
+ * Event Loop
+ * ============================================================ */
+
+typedef struct {
+    int fd;
+    uint64_t id;
+    unsigned char *in;
+    size_t in_len;
+    size_t in_cap;
+    unsigned char *out;
+    size_t out_len;
+    size_t out_off;
+    size_t out_cap;
+    int authed;                 /* Sent the key, or did not need to */
+    int paused;                 /* Queue full: EPOLLIN off, frames kept in in */
+    int writing;                /* EPOLLOUT on */
+} conn_t;
+
+static int g_epoll_fd = -1;
+static int g_listen_fds[2] = { -1, -1 };
+static int g_reserve_fd = -1;   /* Given up to refuse a client at EMFILE */
+static char g_key[COLLECTOR_KEY_MAX];
+static size_t g_key_len;        /* 0: no key file, anyone may connect */
+static conn_t **g_conns;        /* By fd */
+static int g_conn_cap;
+static int g_conn_count;
+static int g_paused_count;
+static uint64_t g_next_conn_id = 1;
+static volatile sig_atomic_t g_stop;
+
+static void conn_events(conn_t *c) {
+    struct epoll_event ev = { 0 };
+    ev.events = (c->paused ? 0 : EPOLLIN) | (c->writing ? EPOLLOUT : 0) | EPOLLRDHUP;
+    ev.data.fd = c->fd;
+    epoll_ctl(g_epoll_fd, EPOLL_CTL_MOD, c->fd, &ev);
+}
+
+static void conn_close(conn_t *c) {
+    epoll_ctl(g_epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    if (c->paused) g_paused_count--;
+    g_conns[c->fd] = NULL;
+    g_conn_count--;
+    free(c->in);
+    free(c->out);
+    free(c);
+}
+
+/* -1 if the connection went away */
+static int conn_flush(conn_t *c) {
+    while (c->out_off < c->out_len) {
+        ssize_t n = write(c->fd, c->out + c->out_off, c->out_len - c->out_off);
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        c->out_off += (size_t)n;
+    }
+    if (c->out_off == c->out_len) c->out_off = c->out_len = 0;
+
+    int writing = c->out_len > 0;
+    if (writing != c->writing) {
+        c->writing = writing;
+        conn_events(c);
+    }
+    return 0;
+}
+
+static int conn_send(conn_t *c, unsigned char type, const char *data, size_t len) {
+    size_t need = c->out_len + 5 + len;
+    if (need > c->out_cap) {
+        size_t cap = c->out_cap ? c->out_cap : 4096;
+        while (cap < need) cap *= 2;
+        unsigned char *p = realloc(c->out, cap);
+        if (!p) return -1;
+        c->out = p;
+        c->out_cap = cap;
+    }
+    collector_put_u32(c->out + c->out_len, (uint32_t)(len + 1));
+    c->out[c->out_len + 4] = type;
+    memcpy(c->out + c->out_len + 5, data, len);
+    c->out_len += 5 + len;
+    return conn_flush(c);
+}
+
+static int conn_error(conn_t *c, const char *msg) {
+    return conn_send(c, FRAME_ERROR, msg, strlen(msg));
+}
+
+static void hosts_reply(conn_t *c, int with_list) {
+    buf_t b = { 0 };
+
+    pthread_mutex_lock(&g_reg_lock);
+    buf_appendf(&b, "{\"hosts\": %llu, \"records\": %llu, \"frames\": %llu, "
+                "\"bad_frames\": %llu, \"write_errors\": %llu, \"connections\": %d",
+                (unsigned long long)g_host_count, (unsigned long long)g_total_records,
+                (unsigned long long)g_frames, (unsigned long long)g_bad_frames,
+                (unsigned long long)g_write_errors, g_conn_count);
+    if (with_list) {
+        int first = 1;
+        buf_append(&b, ", \"list\": [", 11);
+        for (size_t i = 0; i < g_host_cap; i++) {
+            const host_t *h = g_hosts[i];
+            if (!h) continue;
+            buf_append(&b, first ? "\n  {\"hostname\": " : ",\n  {\"hostname\": ", first ? 16 : 17);
+            buf_json_string(&b, h->name);
+            buf_appendf(&b, ", \"records\": %llu, \"probe_time\": %lld}",
+                        (unsigned long long)h->records,
+                        h->have_latest ? (long long)h->latest.probe_time : 0LL);
+            first = 0;
+        }
+        buf_append(&b, "\n]", 2);
+    }
+    buf_append(&b, "}\n", 2);
+    pthread_mutex_unlock(&g_reg_lock);
+
+    if (b.failed) conn_error(c, "out of memory");
+    else conn_send(c, FRAME_REPLY, b.data, b.len);
+    free(b.data);
+}
+
+static job_t *job_new(conn_t *c, job_type_t type) {
+    job_t *job = calloc(1, sizeof(*job));
+    if (job) {
+        job->type = type;
+        job->fd = c->fd;
+        job->conn_id = c->id;
+    }
+    return job;
+}
+
+/* Same time whichever byte differs */
+static int key_matches(const unsigned char *p, size_t len) {
+    unsigned char diff = len != g_key_len;
+    for (size_t i = 0; i < g_key_len; i++) diff |= (unsigned char)(g_key[i] ^ (i < len ? p[i] : 0));
+    return diff == 0;
+}
+
+/* One frame: 0 = handled, 1 = queue full (retry later), -1 = drop the connection */
+static int conn_frame(conn_t *c, unsigned char type, const unsigned char *p, size_t len) {
+    job_t *job;
+    job_queue_t *q;
+    char host[COLLECTOR_HOST_MAX];
+
+    if (type == FRAME_AUTH && !c->authed) {
+        if (!key_matches(p, len)) {
+            conn_error(c, "bad key");
+            return -1;
+        }
+        c->authed = 1;
+        return 0;
+    }
+    if (!c->authed) {
+        conn_error(c, "key required");
+        return -1;
+    }
+
+    switch (type) {
+        case FRAME_AUTH:
+            return 0;
+
+        case FRAME_JSON:
+        case FRAME_RECORD:
+            if (type == FRAME_RECORD && len != COLLECTOR_RECORD_SIZE) {
+                __sync_add_and_fetch(&g_bad_frames, 1);
+                return 0;
+            }
+            if (!(job = job_new(c, (job_type_t)type)) || !(job->payload = malloc(len + 1))) {
+                job_free(job);
+                return -1;
+            }
+            memcpy(job->payload, p, len);
+            job->payload[len] = '\0';
+            job->len = len;
+            q = &g_decode_queue;
+            break;
+
+        case FRAME_LATEST:
+        case FRAME_RANGE: {
+            size_t skip = type == FRAME_RANGE ? 16 : 0;
+            if (len <= skip || len - skip >= sizeof(host)) {
+                return conn_error(c, "bad query");
+            }
+            memcpy(host, p + skip, len - skip);
+            host[len - skip] = '\0';
+            if (!valid_hostname(host)) return conn_error(c, "bad hostname");
+            if (!(job = job_new(c, (job_type_t)type))) return -1;
+            memcpy(job->host, host, sizeof(host));
+            if (type == FRAME_RANGE) {
+                job->from = (int64_t)collector_get_u64(p);
+                job->to = (int64_t)collector_get_u64(p + 8);
+            }
+            q = &shard_of(host)->queue;
+            break;
+        }
+
+        case FRAME_HOSTS:
+            hosts_reply(c, !(len == 5 && memcmp(p, "stats", 5) == 0));
+            return 0;
+
+        default:
+            return conn_error(c, "unknown frame type");
+    }
+
+    if (queue_push(q, job, 0) != 0) {
+        job_free(job);
+        return 1;
+    }
+    if (type == FRAME_JSON || type == FRAME_RECORD) __sync_add_and_fetch(&g_frames, 1);
+    return 0;
+}
+
+/* Cut and dispatch every whole frame in c->in; -1 if c was closed */
+static int conn_process(conn_t *c) {
+    size_t off = 0;
+    int rc = 0;
+
+    while (c->in_len - off >= 4) {
+        uint32_t len = collector_get_u32(c->in + off);
+        if (len == 0 || len > COLLECTOR_FRAME_MAX) {
+            rc = -1;
+            break;
+        }
+        if (c->in_len - off < 4 + (size_t)len) break;
+
+        rc = conn_frame(c, c->in[off + 4], c->in + off + 5, len - 1);
+        if (rc != 0) break;
+        off += 4 + len;
+    }
+    if (rc < 0) {
+        conn_close(c);
+        return -1;
+    }
+
+    memmove(c->in, c->in + off, c->in_len - off);
+    c->in_len -= off;
+
+    if (rc == 1 && !c->paused) {
+        c->paused = 1;
+        g_paused_count++;
+        g_resume_wanted = 1;
+        conn_events(c);
+    }
+    return 0;
+}
+
+static void conn_read(conn_t *c) {
+    for (int reads = 0; reads < 4 && !c->paused; reads++) {
+        size_t want = READ_CHUNK;
+        if (c->in_len >= 4) {
+            size_t frame = 4 + (size_t)collector_get_u32(c->in);
+            if (frame > c->in_len && frame - c->in_len > want) want = frame - c->in_len;
+        }
+        if (c->in_len + want > c->in_cap) {
+            size_t cap = c->in_cap ? c->in_cap : READ_CHUNK;
+            while (cap < c->in_len + want) cap *= 2;
+            if (cap > (size_t)COLLECTOR_FRAME_MAX + 4 + READ_CHUNK) {
+                cap = (size_t)COLLECTOR_FRAME_MAX + 4 + READ_CHUNK;
+            }
+            unsigned char *p = realloc(c->in, cap);
+            if (!p) {
+                conn_close(c);
+                return;
+            }
+            c->in = p;
+            c->in_cap = cap;
+        }
+
+        ssize_t n = read(c->fd, c->in + c->in_len, c->in_cap - c->in_len);
+        if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            conn_close(c);
+            return;
+        }
+        if (n < 0) break;
+        c->in_len += (size_t)n;
+        if (conn_process(c) != 0) return;
+    }
+}
+
+/* Root and our own user may use the UNIX socket without the key */
+static int peer_trusted(int fd) {
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0) return 0;
+    return cred.uid == 0 || cred.uid == geteuid();
+}
+
+/* Out of fds, the pending client would stay in the backlog and keep
+ * the level-triggered listener ready forever: spend the reserve fd to
+ * accept and close it, then take the reserve back */
+static int refuse_one(int lfd) {
+    if (g_reserve_fd < 0) return -1;
+    close(g_reserve_fd);
+    int fd = accept4(lfd, NULL, NULL, SOCK_CLOEXEC);
+    if (fd >= 0) close(fd);
+    g_reserve_fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    return fd >= 0 ? 0 : -1;
+}
+
+static void accept_all(int lfd) {
+    for (;;) {
+        int fd = accept4(lfd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EMFILE || errno == ENFILE) {
+                fprintf(stderr, "sentinel-collector: out of file descriptors, refusing a client\n");
+                if (refuse_one(lfd) == 0) continue;
+            }
+            return;
+        }
+        if (fd >= g_conn_cap) {
+            close(fd);
+            continue;
+        }
+        conn_t *c = calloc(1, sizeof(*c));
+        struct epoll_event ev = { 0 };
+        ev.events = EPOLLIN | EPOLLRDHUP;
+        ev.data.fd = fd;
+        if (!c || epoll_ctl(g_epoll_fd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+            free(c);
+            close(fd);
+            continue;
+        }
+        c->fd = fd;
+        c->id = g_next_conn_id++;
+        c->authed = g_key_len == 0 || (lfd == g_listen_fds[1] && peer_trusted(fd));
+        g_conns[fd] = c;
+        g_conn_count++;
+    }
+}
+
+static void deliver_replies(void) {
+    pthread_mutex_lock(&g_reply_lock);
+    reply_t *r = g_reply_head;
+    g_reply_head = g_reply_tail = NULL;
+    pthread_mutex_unlock(&g_reply_lock);
+
+    while (r) {
+        reply_t *next = r->next;
+        conn_t *c = r->fd < g_conn_cap ? g_conns[r->fd] : NULL;
+        if (c && c->id == r->conn_id && conn_send(c, r->type, r->data, r->len) != 0) {
+            conn_close(c);
+        }
+        free(r);
+        r = next;
+    }
+}
+
+static void resume_paused(void) {
+    for (int fd = 0; fd < g_conn_cap && g_paused_count; fd++) {
+        conn_t *c = g_conns[fd];
+        if (!c || !c->paused) continue;
+        c->paused = 0;
+        g_paused_count--;
+        if (conn_process(c) != 0) continue;
+        if (!c->paused) conn_events(c);
+    }
+}
+
+static void on_signal(int sig) {
+    (void)sig;
+    g_stop = 1;
+    wake_loop();
+}
+
+static void run_loop(void) {
+    struct epoll_event events[256];
+
+    while (!g_stop) {
+        /* A queue can drain before the loop flags that it paused a
+         * reader, leaving no worker to wake it; retry on a timer too */
+        int n = epoll_wait(g_epoll_fd, events, 256, g_paused_count ? 100 : -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            perror("sentinel-collector: epoll_wait");
+            return;
+        }
+        for (int i = 0; i < n; i++) {
+            int fd = events[i].data.fd;
+            if (fd == g_wake_fd) {
+                uint64_t v;
+                if (read(g_wake_fd, &v, sizeof(v)) < 0) {
+                    /* Spurious: nothing pending */
+                }
+                deliver_replies();
+                if (g_paused_count) resume_paused();
+                continue;
+            }
+            if (fd == g_listen_fds[0] || fd == g_listen_fds[1]) {
+                accept_all(fd);
+                continue;
+            }
+
+            conn_t *c = fd < g_conn_cap ? g_conns[fd] : NULL;
+            if (!c) continue;
+            if (events[i].events & EPOLLOUT) {
+                if (conn_flush(c) != 0) {
+                    conn_close(c);
+                    continue;
+                }
+            }
+            if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                conn_read(c);
+            }
+        }
+        if (n == 0 && g_paused_count) resume_paused();
+    }
+}
+
+/* ============================================================
+ * Sockets
+ * ============================================================ */
+
+/* [host:]port; no host is 127.0.0.1, "*" every interface */
+static int listen_tcp(const char *spec) {
+    char host[256] = "";
+    const char *port = spec;
+    const char *colon = strrchr(spec, ':');
+    if (colon) {
+        size_t n = (size_t)(colon - spec);
+        if (n >= sizeof(host)) return -1;
+        memcpy(host, spec, n);
+        host[n] = '\0';
+        port = colon + 1;
+    }
+
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    int any = strcmp(host, "*") == 0;
+    hints.ai_flags = any ? AI_PASSIVE : 0;
+    int rc = getaddrinfo(any ? NULL : host[0] ? host : "127.0.0.1", port, &hints, &res);
+    if (rc != 0) {
+        fprintf(stderr, "sentinel-collector: %s: %s\n", spec, gai_strerror(rc));
+        return -1;
+    }
+
+    int fd = -1;
+    for (struct addrinfo *ai = res; ai && fd < 0; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) continue;
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (bind(fd, ai->ai_addr, ai->ai_addrlen) != 0 || listen(fd, BACKLOG) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(res);
+    if (fd < 0) fprintf(stderr, "sentinel-collector: %s: %s\n", spec, strerror(errno));
+    return fd;
+}
+
+static int listen_unix(const char *path) {
+    struct sockaddr_un sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(sa.sun_path)) {
+        fprintf(stderr, "sentinel-collector: %s: path too long\n", path);
+        return -1;
+    }
+    strcpy(sa.sun_path, path);
+    unlink(path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr *)&sa, sizeof(sa)) != 0 ||
+        chmod(path, 0660) != 0 || listen(fd, BACKLOG) != 0) {
+        fprintf(stderr, "sentinel-collector: %s: %s\n", path, strerror(errno));
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* "path/with/slash" is a UNIX socket; else [host:]port or host */
+static int connect_raw(const char *addr) {
+    if (strchr(addr, '/')) {
+        struct sockaddr_un sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sun_family = AF_UNIX;
+        if (strlen(addr) >= sizeof(sa.sun_path)) return -1;
+        strcpy(sa.sun_path, addr);
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && connect(fd, (struct sockaddr *)&sa, sizeof(sa)) != 0) {
+            close(fd);
+            fd = -1;
+        }
+        return fd;
+    }
+
+    char host[256], port[16];
+    const char *colon = strrchr(addr, ':');
+    if (colon) {
+        snprintf(host, sizeof(host), "%.*s", (int)(colon - addr), addr);
+        snprintf(port, sizeof(port), "%s", colon + 1);
+    } else {
+        snprintf(host, sizeof(host), "%s", addr);
+        snprintf(port, sizeof(port), "%d", COLLECTOR_PORT);
+    }
+
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(host[0] ? host : "localhost", port, &hints, &res) != 0) return -1;
+
+    int fd = -1;
+    for (struct addrinfo *ai = res; ai && fd < 0; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && connect(fd, ai->ai_addr, ai->ai_addrlen) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(res);
+    return fd;
+}
+
+static int write_all(int fd, const void *data, size_t len) {
+    const char *p = data;
+    while (len) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int read_all(int fd, void *data, size_t len) {
+    char *p = data;
+    while (len) {
+        ssize_t n = read(fd, p, len);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int send_frame(int fd, unsigned char type, const void *payload, size_t len) {
+    unsigned char head[5];
+    collector_put_u32(head, (uint32_t)(len + 1));
+    head[4] = type;
+    struct iovec iov[2] = { { head, 5 }, { (void *)payload, len } };
+    ssize_t n = writev(fd, iov, 2);
+    if (n == (ssize_t)(len + 5)) return 0;
+    if (n < 0) return -1;
+    /* Short write: finish it the slow way */
+    size_t done = (size_t)n;
+    if (done < 5 && write_all(fd, head + done, 5 - done) != 0) return -1;
+    return write_all(fd, (const char *)payload + (done > 5 ? done - 5 : 0),
+                     len - (done > 5 ? done - 5 : 0));
+}
+
+/* connect_raw(), then the key if we have one */
+static int connect_addr(const char *addr) {
+    int fd = connect_raw(addr);
+    if (fd >= 0 && g_key_len && send_frame(fd, FRAME_AUTH, g_key, g_key_len) != 0) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+/* Reply payload, malloc'd and NUL-terminated */
+static char *recv_frame(int fd, unsigned char *type) {
+    unsigned char head[5];
+    if (read_all(fd, head, 5) != 0) return NULL;
+    uint32_t len = collector_get_u32(head);
+    if (len == 0 || len > COLLECTOR_FRAME_MAX + 0u) return NULL;
+    *type = head[4];
+    char *data = malloc(len);
+    if (!data) return NULL;
+    if (read_all(fd, data, len - 1) != 0) {
+        free(data);
+        return NULL;
+    }
+    data[len - 1] = '\0';
+    return data;
+}
+
+/* ============================================================
+ * Client Modes
+ * ============================================================ */
+
+static char *read_stream(FILE *f, size_t *len) {
+    buf_t b = { 0 };
+    char chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) buf_append(&b, chunk, n);
+    if (b.failed || !b.data) {
+        free(b.data);
+        return NULL;
+    }
+    *len = b.len;
+    return b.data;
+}
+
+static int run_push(const char *addr, char **files, int count) {
+    int fd = connect_addr(addr);
+    if (fd < 0) {
+        fprintf(stderr, "sentinel-collector: cannot connect to %s\n", addr);
+        return 1;
+    }
+
+    int rc = 0;
+    for (int i = 0; i < (count ? count : 1); i++) {
+        const char *name = count ? files[i] : "-";
+        FILE *f = strcmp(name, "-") == 0 ? stdin : fopen(name, "r");
+        size_t len = 0;
+        char *json = f ? read_stream(f, &len) : NULL;
+        if (f && f != stdin) fclose(f);
+        if (!json || len + 1 > COLLECTOR_FRAME_MAX || send_frame(fd, FRAME_JSON, json, len) != 0) {
+            fprintf(stderr, "sentinel-collector: %s: not sent\n", name);
+            rc = 1;
+        }
+        free(json);
+    }
+    close(fd);
+    return rc;
+}
+
+static int64_t parse_time(const char *s) {
+    if (strcmp(s, "now") == 0) return (int64_t)time(NULL);
+    long long v = atoll(s);
+    return v < 0 ? (int64_t)time(NULL) + v : v;     /* -3600: an hour ago */
+}
+
+static int run_query(const char *addr, int argc, char **argv) {
+    unsigned char frame[16 + COLLECTOR_HOST_MAX];
+    size_t len = 0;
+    unsigned char type;
+
+    if (argc >= 1 && strcmp(argv[0], "hosts") == 0) {
+        type = FRAME_HOSTS;
+    } else if (argc >= 1 && strcmp(argv[0], "stats") == 0) {
+        type = FRAME_HOSTS;
+        memcpy(frame, "stats", 5);
+        len = 5;
+    } else if (argc >= 2 && strcmp(argv[0], "latest") == 0 &&
+               strlen(argv[1]) < COLLECTOR_HOST_MAX) {
+        type = FRAME_LATEST;
+        len = strlen(argv[1]);
+        memcpy(frame, argv[1], len);
+    } else if (argc >= 4 && strcmp(argv[0], "range") == 0 &&
+               strlen(argv[1]) < COLLECTOR_HOST_MAX) {
+        type = FRAME_RANGE;
+        collector_put_u64(frame, (uint64_t)parse_time(argv[2]));
+        collector_put_u64(frame + 8, (uint64_t)parse_time(argv[3]));
+        len = strlen(argv[1]);
+        memcpy(frame + 16, argv[1], len);
+        len += 16;
+    } else {
+        fprintf(stderr, "Query: hosts | stats | latest HOST | range HOST FROM TO\n");
+        return 1;
+    }
+
+    int fd = connect_addr(addr);
+    if (fd < 0) {
+        fprintf(stderr, "sentinel-collector: cannot connect to %s\n", addr);
+        return 1;
+    }
+    unsigned char reply_type;
+    char *reply = send_frame(fd, type, frame, len) == 0 ? recv_frame(fd, &reply_type) : NULL;
+    close(fd);
+    if (!reply) {
+        fprintf(stderr, "sentinel-collector: no reply from %s\n", addr);
+        return 1;
+    }
+    int rc = reply_type == FRAME_REPLY ? 0 : 1;
+    fprintf(rc ? stderr : stdout, "%s%s", reply, rc ? "\n" : "");
+    free(reply);
+    return rc;
+}
+
+/* Agents of a simulated fleet: each host sends one fingerprint per
+ * round over one of a pool of connections, half JSON and half binary
+ * unless told otherwise. Reports the rate the collector stored them. */
+static uint64_t stats_records(const char *addr) {
+    int fd = connect_addr(addr);
+    if (fd < 0) return 0;
+    unsigned char type;
+    char *reply = send_frame(fd, FRAME_HOSTS, "stats", 5) == 0 ? recv_frame(fd, &type) : NULL;
+    close(fd);
+    const char *v = reply ? strstr(reply, "\"records\": ") : NULL;
+    uint64_t n = v ? strtoull(v + 11, NULL, 10) : 0;
+    free(reply);
+    return n;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int run_simulate(const char *addr, int hosts, int rounds, int conns, int json_pct) {
+    if (conns > hosts) conns = hosts;
+    int *fds = calloc((size_t)conns, sizeof(int));
+    if (!fds) return 1;
+    for (int i = 0; i < conns; i++) {
+        if ((fds[i] = connect_addr(addr)) < 0) {
+            fprintf(stderr, "sentinel-collector: connection %d to %s failed\n", i, addr);
+            while (i--) close(fds[i]);
+            free(fds);
+            return 1;
+        }
+    }
+
+    uint64_t before = stats_records(addr);
+    uint64_t expected = (uint64_t)hosts * (uint64_t)rounds;
+    uint64_t json_bytes = 0, json_frames = 0;
+    buf_t b = { 0 };
+    double start = now_s();
+    time_t base = time(NULL) - rounds * 60;
+
+    for (int round = 0; round < rounds; round++) {
+        for (int h = 0; h < hosts; h++) {
+            collector_record_t r;
+            memset(&r, 0, sizeof(r));
+            snprintf(r.hostname, sizeof(r.hostname), "sim-%05d", h);
+            r.probe_time = (int64_t)base + round * 60;
+            r.load_avg[0] = (float)((h * 7 + round) % 400) / 100.0f;
+            r.mem_used_pct = (float)(h % 90 + 5);
+            r.processes = 100 + (uint32_t)(h % 300);
+            r.zombies = (uint32_t)(h % 17 == 0);
+            r.listeners = 3 + (uint32_t)(h % 5);
+            r.audit_risk_score = -1;
+            int fd = fds[h % conns];
+            int rc;
+
+            if ((h * 100 / hosts + round * 37) % 100 < json_pct) {
+                char when[32];
+                time_t t = (time_t)r.probe_time;
+                strftime(when, sizeof(when), "%Y-%m-%dT%H:%M:%SZ", gmtime(&t));
+                b.len = 0;
+                buf_appendf(&b, "{\n  \"sentinel_version\": \"0.6.0\",\n  \"probe_time\": \"%s\",\n"
+                            "  \"probe_errors\": 0,\n  \"system\": {\n    \"hostname\": \"%s\",\n"
+                            "    \"load_average\": [%.2f, 0.50, 0.40],\n    \"memory_used_percent\": %.1f\n  },\n",
+                            when, r.hostname, r.load_avg[0], r.mem_used_pct);
+                buf_appendf(&b, "  \"process_summary\": {\n    \"total_count\": %u,\n"
+                            "    \"zombie_count\": %u,\n    \"high_fd_count\": 0\n  },\n",
+                            r.processes, r.zombies);
+                buf_appendf(&b, "  \"rules\": {\"loaded\": 0, \"critical\": 0, \"warnings\": 0, \"hits\": []},\n"
+                            "  \"network\": {\n    \"total_listeners\": %u,\n    \"total_established\": 12,\n"
+                            "    \"unusual_ports\": 0\n  }\n}\n", r.listeners);
+                if (b.failed) break;
+                rc = send_frame(fd, FRAME_JSON, b.data, b.len);
+                json_bytes += b.len;
+                json_frames++;
+            } else {
+                unsigned char rec[COLLECTOR_RECORD_SIZE];
+                collector_record_encode(&r, rec);
+                rc = send_frame(fd, FRAME_RECORD, rec, sizeof(rec));
+            }
+            if (rc != 0) {
+                fprintf(stderr, "sentinel-collector: send failed: %s\n", strerror(errno));
+                rounds = round;
+                break;
+            }
+        }
+    }
+    double sent = now_s() - start;
+    free(b.data);
+
+    /* Wait for the collector to store everything */
+    uint64_t stored = 0;
+    while (now_s() - start < sent + 120) {
+        stored = stats_records(addr) - before;
+        if (stored >= expected) break;
+        struct timespec ts = { 0, 50 * 1000 * 1000 };
+        nanosleep(&ts, NULL);
+    }
+    double total = now_s() - start;
+    for (int i = 0; i < conns; i++) close(fds[i]);
+    free(fds);
+
+    printf("Simulated %d hosts x %d rounds over %d connections (%llu JSON, avg %.0f bytes)\n",
+           hosts, rounds, conns, (unsigned long long)json_frames,
+           json_frames ? (double)json_bytes / json_frames : 0.0);
+    printf("  sent    %.2f s  (%.0f fingerprints/s)\n", sent, expected / sent);
+    printf("  stored  %llu of %llu in %.2f s  (%.0f fingerprints/s)\n",
+           (unsigned long long)stored, (unsigned long long)expected, total, stored / total);
+    return stored >= expected ? 0 : 1;
+}
+
+/* ============================================================
+ * Server
+ * ============================================================ */
+
+static int mkdir_p(const char *dir) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s", dir);
+    for (char *p = path + 1; *p; p++) {
+        if (*p != '/') continue;
+        *p = '\0';
+        if (mkdir(path, 0750) != 0 && errno != EEXIST) return -1;
+        *p = '/';
+    }
+    return mkdir(path, 0750) != 0 && errno != EEXIST ? -1 : 0;
+}
+
+/* The first line of path, without its newline */
+static int load_key(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "sentinel-collector: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    char line[COLLECTOR_KEY_MAX + 2];
+    size_t len = 0;
+    if (fgets(line, sizeof(line), f)) len = strcspn(line, "\r\n");
+    fclose(f);
+    if (len == 0 || len > COLLECTOR_KEY_MAX) {
+        fprintf(stderr, "sentinel-collector: %s: key must be 1-%d bytes on the first line\n",
+                path, COLLECTOR_KEY_MAX);
+        return -1;
+    }
+    memcpy(g_key, line, len);
+    g_key_len = len;
+    return 0;
+}
+
+static int run_server(const char *tcp, const char *unix_path, int workers) {
+    if (mkdir_p(g_data_dir) != 0 || registry_load() != 0) {
+        fprintf(stderr, "sentinel-collector: %s: %s\n", g_data_dir, strerror(errno));
+        return 1;
+    }
+
+    struct rlimit rl;
+    g_conn_cap = getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur != RLIM_INFINITY ?
+                 (int)rl.rlim_cur : 65536;
+    g_conns = calloc((size_t)g_conn_cap, sizeof(*g_conns));
+    g_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    g_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    g_reserve_fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    if (!g_conns || g_epoll_fd < 0 || g_wake_fd < 0 || g_reserve_fd < 0) {
+        perror("sentinel-collector");
+        return 1;
+    }
+
+    if (tcp && (g_listen_fds[0] = listen_tcp(tcp)) < 0) return 1;
+    if (unix_path && (g_listen_fds[1] = listen_unix(unix_path)) < 0) return 1;
+    int watch[3] = { g_wake_fd, g_listen_fds[0], g_listen_fds[1] };
+    for (int i = 0; i < 3; i++) {
+        struct epoll_event ev = { 0 };
+        ev.events = EPOLLIN;
+        ev.data.fd = watch[i];
+        if (watch[i] >= 0) epoll_ctl(g_epoll_fd, EPOLL_CTL_ADD, watch[i], &ev);
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    g_shard_count = g_decoder_count = workers;
+    queue_init(&g_decode_queue, DECODE_QUEUE_MAX);
+    for (int i = 0; i < workers; i++) {
+        queue_init(&g_shards[i].queue, SHARD_QUEUE_MAX);
+        pthread_create(&g_shards[i].thread, NULL, shard_main, &g_shards[i]);
+        pthread_create(&g_decoders[i], NULL, decoder_main, NULL);
+    }
+
+    fprintf(stderr, "sentinel-collector: %zu hosts in %s; listening on %s%s%s, %d workers\n",
+            g_host_count, g_data_dir, tcp ? tcp : "", tcp && unix_path ? " and " : "",
+            unix_path ? unix_path : "", workers);
+    if (tcp && !g_key_len && strncmp(tcp, "*:", 2) == 0) {
+        fprintf(stderr, "sentinel-collector: warning: no --key-file, any host can push and query\n");
+    }
+    run_loop();
+
+    /* Drain: decoders first, so everything decoded reaches a shard */
+    for (int i = 0; i < g_decoder_count; i++) {
+        job_t *stop = calloc(1, sizeof(*stop));
+        if (stop) {
+            stop->type = JOB_STOP;
+            queue_push(&g_decode_queue, stop, 1);
+        }
+    }
+    for (int i = 0; i < g_decoder_count; i++) pthread_join(g_decoders[i], NULL);
+    for (int i = 0; i < g_shard_count; i++) {
+        job_t *stop = calloc(1, sizeof(*stop));
+        if (stop) {
+            stop->type = JOB_STOP;
+            queue_push(&g_shards[i].queue, stop, 1);
+        }
+        pthread_join(g_shards[i].thread, NULL);
+    }
+    if (unix_path) unlink(unix_path);
+    fprintf(stderr, "sentinel-collector: stored %llu fingerprints (%llu bad frames, %llu write errors)\n",
+            (unsigned long long)g_total_records, (unsigned long long)g_bad_frames,
+            (unsigned long long)g_write_errors);
+    return 0;
+}
+
+static void print_usage(const char *prog) {
+    fprintf(stderr, "C-Sentinel fleet collector\n\n");
+    fprintf(stderr, "Usage: %s [options]                      Run the collector\n", prog);
+    fprintf(stderr, "       %s --push ADDR [FILE...]          Send fingerprints (stdin if none)\n", prog);
+    fprintf(stderr, "       %s --query ADDR QUERY             hosts | stats | latest HOST |\n", prog);
+    fprintf(stderr, "                                                  range HOST FROM TO\n");
+    fprintf(stderr, "       %s --simulate ADDR [--hosts N]    Load-test with a simulated fleet\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -d, --data-dir DIR   Host logs (default: %s)\n", DEFAULT_DATA_DIR);
+    fprintf(stderr, "  -l, --listen [H:]P   TCP address (default: 127.0.0.1:%d; *:P for all)\n", COLLECTOR_PORT);
+    fprintf(stderr, "  -u, --unix PATH      Also (or, with -l none, only) a UNIX socket\n");
+    fprintf(stderr, "  -k, --key-file FILE  Shared key: required of TCP clients, sent by --push etc.\n");
+    fprintf(stderr, "  -w, --workers N      Decode and storage threads each (default: CPUs)\n");
+    fprintf(stderr, "      --hosts N        Simulated hosts (default: 10000)\n");
+    fprintf(stderr, "      --rounds N       Fingerprints per simulated host (default: 3)\n");
+    fprintf(stderr, "      --conns N        Simulated agent connections (default: 500)\n");
+    fprintf(stderr, "      --json-pct N     Share sent as JSON rather than binary (default: 50)\n");
+    fprintf(stderr, "  -h, --help           Show this help\n\n");
+    fprintf(stderr, "ADDR is host:port, a port, or a UNIX socket path. FROM and TO are\n");
+    fprintf(stderr, "unix seconds, \"now\", or -N for N seconds ago.\n");
+}
+
+int main(int argc, char *argv[]) {
+    const char *tcp = NULL;
+    const char *unix_path = NULL;
+    const char *push = NULL, *query = NULL, *simulate = NULL, *key_file = NULL;
+    int workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int hosts = 10000, rounds = 3, conns = 500, json_pct = 50;
+    char default_port[16];
+    int opt;
+
+    snprintf(g_data_dir, sizeof(g_data_dir), "%s", DEFAULT_DATA_DIR);
+    snprintf(default_port, sizeof(default_port), "%d", COLLECTOR_PORT);
+
+    static struct option long_options[] = {
+        {"data-dir", required_argument, 0, 'd'},
+        {"listen", required_argument, 0, 'l'},
+        {"unix", required_argument, 0, 'u'},
+        {"key-file", required_argument, 0, 'k'},
+        {"workers", required_argument, 0, 'w'},
+        {"push", required_argument, 0, 'p'},
+        {"query", required_argument, 0, 'q'},
+        {"simulate", required_argument, 0, 's'},
+        {"hosts", required_argument, 0, 'H'},
+        {"rounds", required_argument, 0, 'r'},
+        {"conns", required_argument, 0, 'c'},
+        {"json-pct", required_argument, 0, 'J'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+
+    while ((opt = getopt_long(argc, argv, "+d:l:u:k:w:p:q:s:h", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'd': snprintf(g_data_dir, sizeof(g_data_dir), "%s", optarg); break;
+            case 'l': tcp = optarg; break;
+            case 'u': unix_path = optarg; break;
+            case 'k': key_file = optarg; break;
+            case 'w': workers = atoi(optarg); break;
+            case 'p': push = optarg; break;
+            case 'q': query = optarg; break;
+            case 's': simulate = optarg; break;
+            case 'H': hosts = atoi(optarg); break;
+            case 'r': rounds = atoi(optarg); break;
+            case 'c': conns = atoi(optarg); break;
+            case 'J': json_pct = atoi(optarg); break;
+            case 'h':
+                print_usage(argv[0]);
+                return 0;
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (key_file && load_key(key_file) != 0) return 1;
+    if (push) return run_push(push, argv + optind, argc - optind);
+    if (query) return run_query(query, argc - optind, argv + optind);
+    if (simulate) {
+        if (hosts < 1 || rounds < 1 || conns < 1) {
+            fprintf(stderr, "sentinel-collector: --hosts, --rounds and --conns must be positive\n");
+            return 1;
+        }
+        signal(SIGPIPE, SIG_IGN);
+        return run_simulate(simulate, hosts, rounds, conns, json_pct);
+    }
+
+    if (!tcp) tcp = default_port;
+    if (strcmp(tcp, "none") == 0) tcp = NULL;
+    if (!tcp && !unix_path) {
+        fprintf(stderr, "sentinel-collector: nothing to listen on\n");
+        return 1;
+    }
+    if (workers < 1) workers = 1;
+    if (workers > WORKERS_MAX) workers = WORKERS_MAX;
+    return run_server(tcp, unix_path, workers);
+}
@@ -0,0 +1,339 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * compliance.c - Evaluate a framework's controls against host facts
+ *
+ * Each check runs once per evaluation and yields pass, fail or "not
+ * assessed" (its input was not probed) with a line of evidence. A
+ * control's status is the worst of the checks mapped to it, read
+ * straight from the compiled tables in compliance_catalog.c.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "compliance.h"
+#include "color.h"
+
+static const char *check_names[COMPLIANCE_CHECK_COUNT] = {
+#define CHECK_NAME(e, name, desc) [e] = name,
+    COMPLIANCE_CHECKS(CHECK_NAME)
+#undef CHECK_NAME
+};
+
+static const char *check_descriptions[COMPLIANCE_CHECK_COUNT] = {
+#define CHECK_DESC(e, name, desc) [e] = desc,
+    COMPLIANCE_CHECKS(CHECK_DESC)
+#undef CHECK_DESC
+};
+
+static const char *status_names[] = {
+    [COMPLIANCE_NOT_ASSESSED] = "not_assessed",
+    [COMPLIANCE_PASS]         = "pass",
+    [COMPLIANCE_FAIL]         = "fail",
+};
+
+const compliance_framework_t *compliance_find_framework(const char *name) {
+    for (uint32_t i = 0; i < compliance_framework_count; i++) {
+        if (strcmp(compliance_frameworks[i].name, name) == 0) return &compliance_frameworks[i];
+    }
+    return NULL;
+}
+
+/* ============================================================
+ * Checks
+ * ============================================================ */
+
+static void set_result(compliance_check_result_t *r, compliance_status_t status,
+                       const char *fmt, ...) {
+    va_list ap;
+    r->status = status;
+    va_start(ap, fmt);
+    vsnprintf(r->evidence, sizeof(r->evidence), fmt, ap);
+    va_end(ap);
+}
+
+static void check_config_permissions(const compliance_facts_t *f, compliance_check_result_t *r) {
+    const fingerprint_t *fp = f->fp;
+    if (fp->config_count == 0) {
+        set_result(r, COMPLIANCE_NOT_ASSESSED, "no config files probed");
+        return;
+    }
+    int bad = f->analysis->config_permission_issues;
+    const char *first = "";
+    for (int i = 0; i < fp->config_count && bad; i++) {
+        if (fp->configs[i].permissions & S_IWOTH) {
+            first = fp_str(fp, fp->configs[i].path);
+            break;
+        }
+    }
+    if (bad) {
+        set_result(r, COMPLIANCE_FAIL, "%d of %d config files world-writable (%s)",
+                   bad, fp->config_count, first);
+    } else {
+        set_result(r, COMPLIANCE_PASS, "%d config files, none world-writable", fp->config_count);
+    }
+}
+
+static void check_listening_services(const compliance_facts_t *f, compliance_check_result_t *r) {
+    if (!f->network_probed) {
+        set_result(r, COMPLIANCE_NOT_ASSESSED, "network not probed");
+        return;
+    }
+    const network_info_t *net = &f->fp->network;
+    if (f->analysis->unusual_listeners > 0) {
+        set_result(r, COMPLIANCE_FAIL, "%d of %d listeners on unexpected ports",
+                   f->analysis->unusual_listeners, net->listener_count);
+    } else {
+        set_result(r, COMPLIANCE_PASS, "%d listeners, all on expected ports", net->listener_count);
+    }
+}
+
+static void check_baseline_drift(const compliance_facts_t *f, compliance_check_result_t *r) {
+    const deviation_report_t *d = f->deviations;
+    if (!d) {
+        set_result(r, COMPLIANCE_NOT_ASSESSED, "no baseline (run --learn)");
+        return;
+    }
+    if (d->config_changes > 0 || d->new_listeners > 0) {
+        set_result(r, COMPLIANCE_FAIL, "%d config(s) changed, %d new listener(s) since baseline",
+                   d->config_changes, d->new_listeners);
+    } else {
+        set_result(r, COMPLIANCE_PASS, "configs and listeners match the baseline");
+    }
+}
+
+static void check_audit_logging(const compliance_facts_t *f, compliance_check_result_t *r) {
+    if (!f->audit) {
+        set_result(r, COMPLIANCE_NOT_ASSESSED, "audit not probed");
+    } else if (!f->audit->enabled) {
+        set_result(r, COMPLIANCE_FAIL, "auditd not running or its log is not readable");
+    } else {
+        set_result(r, COMPLIANCE_PASS, "auditd log readable (%d baseline samples)",
+                   f->audit->baseline_sample_count);
+    }
+}
+
+/* The remaining checks read audit events; without a readable log they
+ * cannot say anything (audit_logging reports that failure) */
+static int need_audit(const compliance_facts_t *f, compliance_check_result_t *r) {
+    if (f->audit && f->audit->enabled) return 1;
+    set_result(r, COMPLIANCE_NOT_ASSESSED, "no audit events available");
+    return 0;
+}
+
+static void check_auth_failures(const compliance_facts_t *f, compliance_check_result_t *r) {
+    if (!need_audit(f, r)) return;
+    const audit_summary_t *a = f->audit;
+    if (a->brute_force_detected) {
+        set_result(r, COMPLIANCE_FAIL, "brute force: %d failures from %d source(s)",
+                   a->auth_failures, a->failure_sources);
+    } else {
+        set_result(r, COMPLIANCE_PASS, "%d authentication failures, no brute-force pattern",
+                   a->auth_failures);
+    }
+}
+
+static void check_untrusted_exec(const compliance_facts_t *f, compliance_check_result_t *r) {
+    if (!need_audit(f, r)) return;
+    const audit_summary_t *a = f->audit;
+    if (a->tmp_executions + a->devshm_executions > 0) {
+        set_result(r, COMPLIANCE_FAIL, "%d execution(s) from /tmp, %d from /dev/shm",
+                   a->tmp_executions, a->devshm_executions);
+    } else {
+        set_result(r, COMPLIANCE_PASS, "no executions from /tmp or /dev/shm");
+    }
+}
+
+static void check_sensitive_files(const compliance_facts_t *f, compliance_check_result_t *r) {
+    if (!need_audit(f, r)) return;
+    const audit_summary_t *a = f->audit;
+    for (int i = 0; i < a->sensitive_file_count; i++) {
+        if (a->sensitive_files[i].suspicious) {
+            set_result(r, COMPLIANCE_FAIL, "suspicious access to %s by %s",
+                       a->sensitive_files[i].path, a->sensitive_files[i].process);
+            return;
+        }
+    }
+    set_result(r, COMPLIANCE_PASS, "%d sensitive file access(es), none suspicious",
+               a->sensitive_file_count);
+}
+
+typedef void (*check_fn)(const compliance_facts_t *f, compliance_check_result_t *r);
+
+static const check_fn check_fns[COMPLIANCE_CHECK_COUNT] = {
+    [CHECK_CONFIG_PERMISSIONS] = check_config_permissions,
+    [CHECK_LISTENING_SERVICES] = check_listening_services,
+    [CHECK_BASELINE_DRIFT]     = check_baseline_drift,
+    [CHECK_AUDIT_LOGGING]      = check_audit_logging,
+    [CHECK_AUTH_FAILURES]      = check_auth_failures,
+    [CHECK_UNTRUSTED_EXEC]     = check_untrusted_exec,
+    [CHECK_SENSITIVE_FILES]    = check_sensitive_files,
+};
+
+/* ============================================================
+ * Evaluation
+ * ============================================================ */
+
+compliance_status_t compliance_control_status(const compliance_report_t *report,
+                                              const compliance_control_t *c) {
+    compliance_status_t worst = COMPLIANCE_NOT_ASSESSED;
+    for (int i = 0; i < c->checks_count; i++) {
+        compliance_status_t s = report->checks[compliance_control_checks[c->checks_first + i]].status;
+        if (s > worst) worst = s;
+    }
+    return worst;
+}
+
+int compliance_evaluate(const char *framework, const compliance_facts_t *facts,
+                        compliance_report_t *report) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    memset(report, 0, sizeof(*report));
+    report->framework = compliance_find_framework(framework);
+    if (!report->framework) return -1;
+
+    for (int i = 0; i < COMPLIANCE_CHECK_COUNT; i++) {
+        check_fns[i](facts, &report->checks[i]);
+    }
+
+    const compliance_framework_t *fw = report->framework;
+    report->controls = (int)fw->count;
+    for (uint32_t i = 0; i < fw->count; i++) {
+        const compliance_control_t *c = &compliance_controls[compliance_framework_controls[fw->first + i]];
+        switch (compliance_control_status(report, c)) {
+            case COMPLIANCE_PASS: report->assessed++; report->passed++; break;
+            case COMPLIANCE_FAIL: report->assessed++; report->failed++; break;
+            default: break;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    report->eval_ms = (end.tv_sec - start.tv_sec) * 1000.0 +
+                      (end.tv_nsec - start.tv_nsec) / 1e6;
+    return 0;
+}
+
+/* ============================================================
+ * Output
+ * ============================================================ */
+
+void compliance_list_frameworks(FILE *out) {
+    fprintf(out, "Available frameworks:\n");
+    for (uint32_t i = 0; i < compliance_framework_count; i++) {
+        fprintf(out, "  %-18s %u controls\n", compliance_frameworks[i].name,
+                compliance_frameworks[i].count);
+    }
+}
+
+void compliance_print_report(const compliance_report_t *report, int verbose) {
+    const compliance_framework_t *fw = report->framework;
+
+    printf("%sCompliance: %s%s\n", col_header(), fw->name, col_reset());
+    printf("========================\n");
+    printf("Controls: %d, assessed %d: %s%d pass%s, %s%d fail%s (%.2f ms)\n",
+           report->controls, report->assessed,
+           col_ok(), report->passed, col_reset(),
+           report->failed ? col_error() : col_ok(), report->failed, col_reset(),
+           report->eval_ms);
+
+    printf("\n%sChecks:%s\n", col_header(), col_reset());
+    for (int i = 0; i < COMPLIANCE_CHECK_COUNT; i++) {
+        const compliance_check_result_t *r = &report->checks[i];
+        const char *col = r->status == COMPLIANCE_FAIL ? col_error() :
+                          r->status == COMPLIANCE_PASS ? col_ok() : col_dim();
+        printf("  %s%-12s%s %-20s %s\n", col,
+               r->status == COMPLIANCE_NOT_ASSESSED ? "NOT ASSESSED" :
+               r->status == COMPLIANCE_PASS ? "PASS" : "FAIL",
+               col_reset(), check_names[i], r->evidence);
+    }
+
+    /* Failed controls always; passing ones only when asked */
+    int header = 0;
+    for (uint32_t i = 0; i < fw->count; i++) {
+        const compliance_control_t *c = &compliance_controls[compliance_framework_controls[fw->first + i]];
+        compliance_status_t s = compliance_control_status(report, c);
+        if (s == COMPLIANCE_NOT_ASSESSED || (s == COMPLIANCE_PASS && !verbose)) continue;
+
+        if (!header) {
+            printf("\n%s%s:%s\n", col_header(), verbose ? "Assessed controls" : "Failed controls",
+                   col_reset());
+            header = 1;
+        }
+        printf("  %s%-4s%s %-14s %s\n",
+               s == COMPLIANCE_FAIL ? col_error() : col_ok(),
+               s == COMPLIANCE_FAIL ? "FAIL" : "PASS", col_reset(),
+               compliance_str(c->label), compliance_str(c->title));
+    }
+}
+
+static void print_json_string(FILE *out, const char *s) {
+    fputc('"', out);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') fprintf(out, "\\%c", c);
+        else if (c < 0x20) fprintf(out, "\\u%04x", c);
+        else fputc(c, out);
+    }
+    fputc('"', out);
+}
+
+void compliance_print_json(const compliance_report_t *report, FILE *out) {
+    const compliance_framework_t *fw = report->framework;
+
+    fprintf(out, "{\n  \"compliance\": {\n");
+    fprintf(out, "    \"framework\": ");
+    print_json_string(out, fw->name);
+    fprintf(out, ",\n    \"controls\": %d,\n", report->controls);
+    fprintf(out, "    \"assessed\": %d,\n", report->assessed);
+    fprintf(out, "    \"passed\": %d,\n", report->passed);
+    fprintf(out, "    \"failed\": %d,\n", report->failed);
+    fprintf(out, "    \"eval_ms\": %.3f,\n", report->eval_ms);
+
+    fprintf(out, "    \"checks\": [");
+    for (int i = 0; i < COMPLIANCE_CHECK_COUNT; i++) {
+        fprintf(out, "%s{\"name\": \"%s\", \"status\": \"%s\", \"description\": ",
+                i ? ",\n      " : "\n      ", check_names[i],
+                status_names[report->checks[i].status]);
+        print_json_string(out, check_descriptions[i]);
+        fprintf(out, ", \"evidence\": ");
+        print_json_string(out, report->checks[i].evidence);
+        fprintf(out, "}");
+    }
+    fprintf(out, "\n    ],\n");
+
+    /* Only assessed controls; the rest are by definition unmapped */
+    fprintf(out, "    \"results\": [");
+    int n = 0;
+    for (uint32_t i = 0; i < fw->count; i++) {
+        const compliance_control_t *c = &compliance_controls[compliance_framework_controls[fw->first + i]];
+        compliance_status_t s = compliance_control_status(report, c);
+        if (s == COMPLIANCE_NOT_ASSESSED) continue;
+
+        fprintf(out, "%s{\"id\": ", n++ ? ",\n      " : "\n      ");
+        print_json_string(out, compliance_str(c->id));
+        fprintf(out, ", \"label\": ");
+        print_json_string(out, compliance_str(c->label));
+        fprintf(out, ", \"family\": \"%s\", \"title\": ", c->family);
+        print_json_string(out, compliance_str(c->title));
+        fprintf(out, ", \"status\": \"%s\", \"checks\": [", status_names[s]);
+        for (int k = 0; k < c->checks_count; k++) {
+            fprintf(out, "%s\"%s\"", k ? ", " : "",
+                    check_names[compliance_control_checks[c->checks_first + k]]);
+        }
+        fprintf(out, "]}");
+    }
+    fprintf(out, n ? "\n    ]\n" : "]\n");
+    fprintf(out, "  }\n}\n");
+}
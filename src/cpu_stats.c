@@ -0,0 +1,258 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * cpu_stats.c - Per-CPU utilisation from /proc/stat and softirq
+ *               counts from /proc/softirqs, computed from deltas
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sentinel.h"
+
+/* /proc/stat tick columns, in kernel order */
+enum {
+    T_USER, T_NICE, T_SYSTEM, T_IDLE, T_IOWAIT, T_IRQ, T_SOFTIRQ, T_STEAL,
+    T_COUNT
+};
+
+/* One raw sample for one CPU (or the "cpu" total line) */
+typedef struct {
+    int cpu;
+    uint64_t ticks[T_COUNT];
+    uint64_t softirqs;          /* All softirq types */
+    uint64_t net_rx;
+    uint64_t net_tx;
+} cpu_raw_t;
+
+/* Two sample buffers, swapped each probe; entries sorted by cpu id as
+ * the kernel lists them. Only the probe stage touches these, and the
+ * watchdog never runs a stage again while an earlier run is stuck. */
+typedef struct {
+    cpu_raw_t *cpus;
+    int count;
+    int cap;
+    cpu_raw_t total;
+    double taken_s;
+} cpu_sample_t;
+
+static cpu_sample_t g_samples[2];
+static int g_prev_idx = -1;
+
+/* Per-CPU results handed out through cpu_info_t.cpus */
+static cpu_usage_t *g_usage;
+static int g_usage_cap;
+
+static double monotonic_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Grow an array to hold at least need entries; returns 0 on success */
+static int ensure_cap(void **arr, int *cap, int need, size_t elem) {
+    if (need <= *cap) return 0;
+    int new_cap = *cap ? *cap : 16;
+    while (new_cap < need) new_cap *= 2;
+    void *p = realloc(*arr, (size_t)new_cap * elem);
+    if (!p) return -1;
+    *arr = p;
+    *cap = new_cap;
+    return 0;
+}
+
+static void parse_ticks(const char *s, uint64_t *ticks) {
+    unsigned long long v[T_COUNT] = {0};
+    sscanf(s, "%llu %llu %llu %llu %llu %llu %llu %llu",
+           &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6], &v[7]);
+    for (int i = 0; i < T_COUNT; i++) ticks[i] = v[i];
+}
+
+/* Read the cpu lines of /proc/stat; they all come before "intr" */
+static int read_proc_stat(cpu_sample_t *s) {
+    FILE *f = pfs_fopen("/proc/stat");
+    if (!f) return -1;
+
+    char line[512];
+    s->count = 0;
+    memset(&s->total, 0, sizeof(s->total));
+    s->total.cpu = -1;
+
+    while (fgets(line, sizeof(line), f)) {
+        if (strncmp(line, "cpu", 3) != 0) break;
+
+        if (line[3] == ' ') {
+            parse_ticks(line + 4, s->total.ticks);
+            continue;
+        }
+
+        int id;
+        int off = 0;
+        if (sscanf(line + 3, "%d %n", &id, &off) != 1 || off == 0) continue;
+        if (ensure_cap((void **)&s->cpus, &s->cap, s->count + 1, sizeof(cpu_raw_t)) != 0) {
+            break;
+        }
+
+        cpu_raw_t *c = &s->cpus[s->count++];
+        memset(c, 0, sizeof(*c));
+        c->cpu = id;
+        parse_ticks(line + 3 + off, c->ticks);
+    }
+
+    fclose(f);
+    return s->count > 0 ? 0 : -1;
+}
+
+/* /proc/softirqs columns are every possible CPU ("CPU0 CPU1 ...");
+ * offline ones are absent from /proc/stat, so map columns by id.
+ * The line and column buffers persist, so steady state allocates nothing. */
+static char *g_softirq_line;
+static size_t g_softirq_line_len;
+static int *g_col_idx;
+static int g_col_cap;
+
+static void read_softirqs(cpu_sample_t *s) {
+    FILE *f = pfs_fopen("/proc/softirqs");
+    if (!f) return;
+
+    int cols = 0;
+
+    /* Header: resolve each column to an index into s->cpus */
+    if (getline(&g_softirq_line, &g_softirq_line_len, f) > 0) {
+        char *save = NULL;
+        int j = 0;
+        for (char *tok = strtok_r(g_softirq_line, " \t\n", &save); tok;
+             tok = strtok_r(NULL, " \t\n", &save)) {
+            int id;
+            if (sscanf(tok, "CPU%d", &id) != 1) continue;
+            if (ensure_cap((void **)&g_col_idx, &g_col_cap, cols + 1, sizeof(int)) != 0) break;
+            while (j < s->count && s->cpus[j].cpu < id) j++;
+            g_col_idx[cols++] = (j < s->count && s->cpus[j].cpu == id) ? j : -1;
+        }
+    }
+
+    while (cols > 0 && getline(&g_softirq_line, &g_softirq_line_len, f) > 0) {
+        char *line = g_softirq_line;
+        char *colon = strchr(line, ':');
+        if (!colon) continue;
+        *colon = '\0';
+
+        char *name = line;
+        while (*name == ' ') name++;
+        int is_rx = strcmp(name, "NET_RX") == 0;
+        int is_tx = strcmp(name, "NET_TX") == 0;
+
+        char *p = colon + 1;
+        for (int c = 0; c < cols; c++) {
+            char *end;
+            unsigned long long v = strtoull(p, &end, 10);
+            if (end == p) break;
+            p = end;
+
+            if (g_col_idx[c] < 0) continue;
+            cpu_raw_t *r = &s->cpus[g_col_idx[c]];
+            r->softirqs += v;
+            if (is_rx) r->net_rx += v;
+            if (is_tx) r->net_tx += v;
+        }
+    }
+
+    fclose(f);
+}
+
+static int take_sample(cpu_sample_t *s) {
+    if (read_proc_stat(s) != 0) return -1;
+    read_softirqs(s);
+    s->taken_s = monotonic_seconds();
+    return 0;
+}
+
+static uint64_t tick_delta(const cpu_raw_t *cur, const cpu_raw_t *prev, int col) {
+    return cur->ticks[col] > prev->ticks[col] ? cur->ticks[col] - prev->ticks[col] : 0;
+}
+
+static void compute_usage(const cpu_raw_t *cur, const cpu_raw_t *prev,
+                          double interval, cpu_usage_t *u) {
+    uint64_t d[T_COUNT];
+    uint64_t sum = 0;
+    for (int i = 0; i < T_COUNT; i++) {
+        d[i] = tick_delta(cur, prev, i);
+        sum += d[i];
+    }
+
+    memset(u, 0, sizeof(*u));
+    u->cpu = cur->cpu;
+    if (sum > 0) {
+        double k = 100.0 / sum;
+        u->user_pct = (d[T_USER] + d[T_NICE]) * k;
+        u->system_pct = d[T_SYSTEM] * k;
+        u->iowait_pct = d[T_IOWAIT] * k;
+        u->irq_pct = d[T_IRQ] * k;
+        u->softirq_pct = d[T_SOFTIRQ] * k;
+        u->steal_pct = d[T_STEAL] * k;
+        u->idle_pct = d[T_IDLE] * k;
+        u->busy_pct = 100.0 - u->idle_pct - u->iowait_pct;
+    }
+    if (interval > 0) {
+        u->softirqs_per_sec = (cur->softirqs - prev->softirqs) / interval;
+        u->net_rx_per_sec = (cur->net_rx - prev->net_rx) / interval;
+        u->net_tx_per_sec = (cur->net_tx - prev->net_tx) / interval;
+    }
+}
+
+int probe_cpu_stats(cpu_info_t *info) {
+    if (!info) return -1;
+    memset(info, 0, sizeof(*info));
+
+    /* No previous sample (first run, or one-shot mode): open a short
+     * window of our own so the percentages are current, not since-boot */
+    if (g_prev_idx < 0) {
+        if (take_sample(&g_samples[0]) != 0) return -1;
+        g_prev_idx = 0;
+        struct timespec ts = { 0, CPU_SAMPLE_WINDOW_MS * 1000000L };
+        nanosleep(&ts, NULL);
+    }
+
+    cpu_sample_t *prev = &g_samples[g_prev_idx];
+    cpu_sample_t *cur = &g_samples[1 - g_prev_idx];
+    if (take_sample(cur) != 0) return -1;
+
+    if (ensure_cap((void **)&g_usage, &g_usage_cap, cur->count, sizeof(cpu_usage_t)) != 0) {
+        return -1;
+    }
+
+    double interval = cur->taken_s - prev->taken_s;
+    info->interval_seconds = interval;
+    compute_usage(&cur->total, &prev->total, interval, &info->total);
+
+    /* Both lists are sorted by cpu id; hot-unplugged or newly onlined
+     * CPUs simply have no partner and report zero for this interval */
+    int j = 0;
+    for (int i = 0; i < cur->count; i++) {
+        while (j < prev->count && prev->cpus[j].cpu < cur->cpus[i].cpu) j++;
+        if (j < prev->count && prev->cpus[j].cpu == cur->cpus[i].cpu) {
+            compute_usage(&cur->cpus[i], &prev->cpus[j], interval, &g_usage[i]);
+        } else {
+            memset(&g_usage[i], 0, sizeof(g_usage[i]));
+            g_usage[i].cpu = cur->cpus[i].cpu;
+        }
+        info->total.softirqs_per_sec += g_usage[i].softirqs_per_sec;
+        info->total.net_rx_per_sec += g_usage[i].net_rx_per_sec;
+        info->total.net_tx_per_sec += g_usage[i].net_tx_per_sec;
+    }
+
+    info->cpus = g_usage;
+    info->cpu_count = cur->count;
+    info->available = 1;
+    g_prev_idx = 1 - g_prev_idx;
+    return 0;
+}
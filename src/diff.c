@@ -120,6 +120,74 @@ static void add_numeric_diff(const char *field, double a, double b, double thres
     d->is_significant = (percent > 10.0);  /* >10% is significant */
 }
 
+/* The "data" object of a plugin in the "plugins" section. Plugin data
+ * is one flat object of "key": value members, which is what lets
+ * sentinel-diff compare plugins it knows nothing about. */
+static const char* plugin_data(const char *json, const char *name, size_t name_len,
+                               const char **end) {
+    const char *plugins = strstr(json, "\"plugins\": {");
+    if (!plugins) return NULL;
+    
+    char search[128];
+    snprintf(search, sizeof(search), "\"%.*s\": {", (int)name_len, name);
+    const char *p = strstr(plugins, search);
+    if (!p) return NULL;
+    
+    const char *line_end = strchr(p, '\n');
+    const char *data = strstr(p, "\"data\": {");
+    if (!data || (line_end && data > line_end)) return NULL;
+    
+    data += strlen("\"data\": {");
+    *end = strchr(data, '}');
+    return *end ? data : NULL;
+}
+
+/* Numeric members of every plugin in A that B also has */
+static void compare_plugins(const char *json_a, const char *json_b) {
+    const char *plugins = strstr(json_a, "\"plugins\": {");
+    if (!plugins) return;
+    
+    /* Each plugin is one line: "name": {"status": ..., "data": {...}} */
+    for (const char *p = strstr(plugins, "\n    \""); p; p = strstr(p, "\n    \"")) {
+        p += 6;
+        const char *name_end = strchr(p, '"');
+        if (!name_end) return;
+        
+        const char *end_a, *end_b;
+        const char *a = plugin_data(json_a, p, (size_t)(name_end - p), &end_a);
+        const char *b = plugin_data(json_b, p, (size_t)(name_end - p), &end_b);
+        
+        for (const char *k = a; b && k && k < end_a; ) {
+            k = strchr(k, '"');
+            if (!k || k >= end_a) break;
+            const char *key_end = strchr(k + 1, '"');
+            if (!key_end || key_end >= end_a) break;
+            
+            char key[40], search[48], field[64];
+            snprintf(key, sizeof(key), "%.*s", (int)(key_end - k - 1), k + 1);
+            snprintf(search, sizeof(search), "\"%s\":", key);
+            const char *va = key_end + 2;
+            while (*va == ' ') va++;
+            const char *vb = strstr(b, search);
+            if (vb && vb < end_b && *va != '"') {
+                int name_len = name_end - p < 16 ? (int)(name_end - p) : 16;
+                snprintf(field, sizeof(field), "%.*s.%s", name_len, p, key);
+                add_numeric_diff(field, atof(va), atof(vb + strlen(search)), 5.0);
+            }
+            
+            /* Next member */
+            k = strchr(key_end + 1, ',');
+            if (!k) break;
+        }
+        p = name_end;
+        
+        /* Stop at the end of the plugins section */
+        const char *next = strstr(p, "\n    \"");
+        const char *close = strstr(p, "\n  }");
+        if (!next || (close && close < next)) break;
+    }
+}
+
 static void compare_fingerprints(const char *json_a, const char *json_b) {
     diff_count = 0;
     
@@ -172,6 +240,8 @@ static void compare_fingerprints(const char *json_a, const char *json_b) {
         }
     }
     
+    compare_plugins(json_a, json_b);
+    
     /* TODO: Compare config file checksums */
     /* This would require more sophisticated JSON parsing */
 }
@@ -30,7 +30,7 @@ typedef struct {
 } json_buffer_t;
 
 static int buf_init(json_buffer_t *buf) {
-    buf->data = malloc(INITIAL_BUF_SIZE);
+    buf->data = arena_alloc(probe_arena(), INITIAL_BUF_SIZE);
     if (!buf->data) return -1;
     buf->data[0] = '\0';
     buf->size = 0;
@@ -46,7 +46,7 @@ static int buf_ensure(json_buffer_t *buf, size_t additional) {
         new_cap *= BUF_GROW_FACTOR;
     }
     
-    char *new_data = realloc(buf->data, new_cap);
+    char *new_data = arena_realloc(probe_arena(), buf->data, buf->capacity, new_cap);
     if (!new_data) return -1;
     
     buf->data = new_data;
@@ -73,14 +73,13 @@ static int buf_appendf(json_buffer_t *buf, const char *fmt, ...) {
     if (len < 0) return -1;
     if ((size_t)len >= sizeof(tmp)) {
         /* Need larger buffer */
-        char *large = malloc(len + 1);
-        if (!large) return -1;
+        /* Format straight into the buffer */
+        if (buf_ensure(buf, (size_t)len + 1) != 0) return -1;
         va_start(args, fmt);
-        vsnprintf(large, len + 1, fmt, args);
+        vsnprintf(buf->data + buf->size, (size_t)len + 1, fmt, args);
         va_end(args);
-        int result = buf_append(buf, large);
-        free(large);
-        return result;
+        buf->size += (size_t)len;
+        return 0;
     }
     
     return buf_append(buf, tmp);
@@ -114,12 +113,82 @@ static int buf_append_json_string(json_buffer_t *buf, const char *str) {
     return buf_append(buf, "\"");
 }
 
+/* Plugin writers: members of one single-line object */
+typedef struct {
+    json_buffer_t *buf;
+    int members;
+} plugin_writer_t;
+
+static void plugin_json_key(probe_json_t *out, const char *key) {
+    plugin_writer_t *w = out->ctx;
+    buf_append(w->buf, w->members++ ? ", " : "");
+    buf_append_json_string(w->buf, key);
+    buf_append(w->buf, ": ");
+}
+
+static void plugin_json_number(probe_json_t *out, const char *key, double value) {
+    plugin_writer_t *w = out->ctx;
+    plugin_json_key(out, key);
+    /* JSON has no NaN or Infinity */
+    if (value != value || value > 1e300 || value < -1e300) buf_append(w->buf, "null");
+    else buf_appendf(w->buf, "%.6g", value);
+}
+
+static void plugin_json_string(probe_json_t *out, const char *key, const char *value) {
+    plugin_writer_t *w = out->ctx;
+    plugin_json_key(out, key);
+    buf_append_json_string(w->buf, value ? value : "");
+}
+
 /* Format time as ISO 8601 */
 static void format_iso_time(time_t t, char *buf, size_t buf_size) {
     struct tm *tm = gmtime(&t);
     strftime(buf, buf_size, "%Y-%m-%dT%H:%M:%SZ", tm);
 }
 
+/* One CPU's utilisation as a single-line object */
+static void append_cpu_usage(json_buffer_t *buf, const cpu_usage_t *c) {
+    buf_appendf(buf, "{\"cpu\": %d, \"busy\": %.1f, \"user\": %.1f, \"system\": %.1f, "
+                "\"iowait\": %.1f, \"irq\": %.1f, \"softirq\": %.1f, \"steal\": %.1f, "
+                "\"softirqs_per_sec\": %.0f, \"net_rx_per_sec\": %.0f, \"net_tx_per_sec\": %.0f}",
+                c->cpu, c->busy_pct, c->user_pct, c->system_pct, c->iowait_pct,
+                c->irq_pct, c->softirq_pct, c->steal_pct,
+                c->softirqs_per_sec, c->net_rx_per_sec, c->net_tx_per_sec);
+}
+
+/* One top-K entry: who, plus the metric in its natural unit */
+static void append_topk_entry(json_buffer_t *buf, const fingerprint_t *fp,
+                              topk_metric_t m, const topk_entry_t *e) {
+    const process_info_t *p = &fp->processes[e->proc];
+    
+    buf_appendf(buf, "{\"pid\": %d, \"name\": ", p->pid);
+    buf_append_json_string(buf, fp_str(fp, p->name));
+    switch (m) {
+        case TOPK_RSS:
+            buf_appendf(buf, ", \"rss_mb\": %.1f}", p->rss_bytes / (1024.0 * 1024.0));
+            break;
+        case TOPK_CPU:
+            buf_appendf(buf, ", \"cpu_percent\": %.1f, \"window_seconds\": %.0f}",
+                        p->cpu_percent, p->rate_seconds);
+            break;
+        case TOPK_FDS:
+            buf_appendf(buf, ", \"open_fds\": %u}", p->open_fd_count);
+            break;
+        case TOPK_THREADS:
+            buf_appendf(buf, ", \"threads\": %u}", p->thread_count);
+            break;
+        case TOPK_IO:
+            buf_appendf(buf, ", \"io_bytes_per_sec\": %.0f, \"read_mb\": %.1f, "
+                        "\"write_mb\": %.1f, \"window_seconds\": %.0f}",
+                        p->io_bytes_per_sec, p->io_read_bytes / (1024.0 * 1024.0),
+                        p->io_write_bytes / (1024.0 * 1024.0), p->rate_seconds);
+            break;
+        default:
+            buf_appendf(buf, ", \"value\": %.1f}", e->value);
+            break;
+    }
+}
+
 /* ============================================================
  * Main Serialization Function
  * ============================================================ */
@@ -142,6 +211,53 @@ char* fingerprint_to_json(const fingerprint_t *fp) {
     buf_appendf(&buf, "  \"probe_duration_ms\": %.2f,\n", fp->probe_duration_ms);
     buf_appendf(&buf, "  \"probe_errors\": %d,\n", fp->probe_errors);
     
+    /* Why parts of the fingerprint are missing (watchdog timeouts etc.) */
+    if (fp->error_log_count > 0) {
+        buf_append(&buf, "  \"probe_error_details\": [\n");
+        for (int i = 0; i < fp->error_log_count; i++) {
+            const probe_error_t *e = &fp->error_log[i];
+            
+            if (i > 0) buf_append(&buf, ",\n");
+            
+            buf_append(&buf, "    {\"stage\": ");
+            buf_append_json_string(&buf, e->stage);
+            buf_appendf(&buf, ", \"item\": %d, \"elapsed_ms\": %.1f, \"reason\": ",
+                        e->item, e->elapsed_ms);
+            buf_append_json_string(&buf, e->reason);
+            buf_append(&buf, "}");
+        }
+        buf_append(&buf, "\n  ],\n");
+    }
+    
+    /* Watch mode: how far the stages behind the probe have fallen back */
+    const pipeline_stats_t *ps = &fp->pipeline;
+    if (ps->active) {
+        static const char *const stage_names[PIPELINE_STAGES] = {
+            "probe", "analyze", "serialize", "emit"
+        };
+        buf_append(&buf, "  \"pipeline\": {\n");
+        buf_appendf(&buf, "    \"slots\": %d,\n", ps->slots);
+        buf_appendf(&buf, "    \"cycles\": %lu,\n", ps->cycles);
+        buf_appendf(&buf, "    \"dropped\": %lu,\n", ps->dropped);
+        buf_append(&buf, "    \"queued\": {");
+        for (int i = 1; i < PIPELINE_STAGES; i++) {
+            buf_appendf(&buf, "%s\"%s\": %d", i > 1 ? ", " : "", stage_names[i],
+                        ps->queued[i - 1]);
+        }
+        buf_append(&buf, "},\n    \"queued_max\": {");
+        for (int i = 1; i < PIPELINE_STAGES; i++) {
+            buf_appendf(&buf, "%s\"%s\": %d", i > 1 ? ", " : "", stage_names[i],
+                        ps->queued_max[i - 1]);
+        }
+        buf_append(&buf, "},\n    \"stage_ms\": {");
+        for (int i = 0; i < PIPELINE_STAGES; i++) {
+            buf_appendf(&buf, "%s\"%s\": %.2f", i ? ", " : "", stage_names[i],
+                        ps->stage_ms[i]);
+        }
+        buf_appendf(&buf, "},\n    \"lag_ms\": %.2f\n", ps->lag_ms);
+        buf_append(&buf, "  },\n");
+    }
+    
     /* System info */
     buf_append(&buf, "  \"system\": {\n");
     buf_append(&buf, "    \"hostname\": ");
@@ -162,9 +278,42 @@ char* fingerprint_to_json(const fingerprint_t *fp) {
                 100.0 * (1.0 - (double)fp->system.free_ram / fp->system.total_ram));
     buf_append(&buf, "  },\n");
     
+    /* Per-CPU utilisation over the probe interval */
+    if (fp->cpu.available) {
+        buf_append(&buf, "  \"cpu\": {\n");
+        buf_appendf(&buf, "    \"online_cpus\": %d,\n", fp->cpu.cpu_count);
+        buf_appendf(&buf, "    \"interval_seconds\": %.2f,\n", fp->cpu.interval_seconds);
+        buf_append(&buf, "    \"total\": ");
+        append_cpu_usage(&buf, &fp->cpu.total);
+        buf_append(&buf, ",\n    \"per_cpu\": [");
+        for (int i = 0; i < fp->cpu.cpu_count; i++) {
+            buf_append(&buf, i > 0 ? ",\n      " : "\n      ");
+            append_cpu_usage(&buf, &fp->cpu.cpus[i]);
+        }
+        buf_append(&buf, "\n    ]\n");
+        buf_append(&buf, "  },\n");
+    }
+    
     /* Process summary - we don't dump all processes, just interesting ones */
     buf_append(&buf, "  \"process_summary\": {\n");
-    buf_appendf(&buf, "    \"total_count\": %d,\n", fp->process_count);
+    buf_appendf(&buf, "    \"total_count\": %d,\n", fp->process_total);
+    if (fp->sampling.enabled) {
+        const process_sampling_t *sp = &fp->sampling;
+        buf_append(&buf, "    \"sampling\": {\n");
+        buf_appendf(&buf, "      \"cycles\": %d,\n", sp->cycles);
+        buf_appendf(&buf, "      \"stratum\": %d,\n", sp->stratum);
+        buf_appendf(&buf, "      \"sampled\": %d,\n", sp->sampled);
+        buf_appendf(&buf, "      \"carried_notable\": %d,\n", sp->carried);
+        buf_appendf(&buf, "      \"zombies\": {\"estimate\": %.1f, \"low\": %.1f, \"high\": %.1f},\n",
+                    sp->zombies.estimate, sp->zombies.low, sp->zombies.high);
+        buf_appendf(&buf, "      \"high_fd\": {\"estimate\": %.1f, \"low\": %.1f, \"high\": %.1f},\n",
+                    sp->high_fd.estimate, sp->high_fd.low, sp->high_fd.high);
+        buf_appendf(&buf, "      \"stuck\": {\"estimate\": %.1f, \"low\": %.1f, \"high\": %.1f},\n",
+                    sp->stuck.estimate, sp->stuck.low, sp->stuck.high);
+        buf_appendf(&buf, "      \"threads\": {\"estimate\": %.0f, \"low\": %.0f, \"high\": %.0f}\n",
+                    sp->threads.estimate, sp->threads.low, sp->threads.high);
+        buf_append(&buf, "    },\n");
+    }
     
     /* Find interesting processes */
     int zombie_count = 0;
@@ -174,53 +323,51 @@ char* fingerprint_to_json(const fingerprint_t *fp) {
     buf_append(&buf, "    \"notable_processes\": [\n");
     int first = 1;
     
-    for (int i = 0; i < fp->process_count; i++) {
-        const process_info_t *p = &fp->processes[i];
+    /* The probe already classified every process; only notable rows
+     * touch the full process_info_t */
+    static const char *const flag_reason[] = {
+        [PROC_FLAG_ZOMBIE]      = "zombie",
+        [PROC_FLAG_HIGH_FD]     = "high_fd_count",
+        [PROC_FLAG_STUCK]       = "potentially_stuck",
+        [PROC_FLAG_VERY_LONG]   = "very_long_running",
+        [PROC_FLAG_HIGH_MEMORY] = "high_memory",
+    };
+    const process_columns_t *pc = &fp->proc_cols;
+    
+    for (int i = 0; i < pc->count; i++) {
+        int flag = pc->flag[i];
+        if (flag == PROC_FLAG_NONE) continue;
         
-        /* Only include "interesting" processes */
-        int interesting = 0;
-        const char *reason = "";
+        const process_info_t *p = &fp->processes[i];
+        const char *reason = flag_reason[flag];
+        zombie_count += flag == PROC_FLAG_ZOMBIE;
+        high_fd_count += flag == PROC_FLAG_HIGH_FD;
+        stuck_count += flag == PROC_FLAG_STUCK;
         
-        if (p->state == 'Z') {
-            interesting = 1;
-            reason = "zombie";
-            zombie_count++;
-        } else if (p->open_fd_count > 100 && p->open_fd_count < 100000) {
-            /* Only flag if we could actually read FDs (uint32 -1 wraps to ~4 billion) */
-            interesting = 1;
-            reason = "high_fd_count";
-            high_fd_count++;
-        } else if (p->is_potentially_stuck) {
-            interesting = 1;
-            reason = "potentially_stuck";
-            stuck_count++;
-        } else if (p->age_seconds > 30 * 24 * 3600) {
-            interesting = 1;
-            reason = "very_long_running";
-        } else if (p->rss_bytes > 1024 * 1024 * 1024) {
-            interesting = 1;
-            reason = "high_memory";
-        }
+        if (!first) buf_append(&buf, ",\n");
+        first = 0;
         
-        if (interesting) {
-            if (!first) buf_append(&buf, ",\n");
-            first = 0;
-            
-            buf_append(&buf, "      {\n");
-            buf_appendf(&buf, "        \"pid\": %d,\n", p->pid);
-            buf_append(&buf, "        \"name\": ");
-            buf_append_json_string(&buf, p->name);
-            buf_append(&buf, ",\n");
-            buf_appendf(&buf, "        \"state\": \"%c\",\n", p->state);
-            buf_appendf(&buf, "        \"age_days\": %.2f,\n", p->age_seconds / 86400.0);
-            buf_appendf(&buf, "        \"memory_mb\": %.1f,\n", p->rss_bytes / (1024.0 * 1024.0));
-            buf_appendf(&buf, "        \"open_fds\": %d,\n", p->open_fd_count);
-            buf_appendf(&buf, "        \"threads\": %d,\n", p->thread_count);
-            buf_append(&buf, "        \"flag\": ");
-            buf_append_json_string(&buf, reason);
-            buf_append(&buf, "\n");
-            buf_append(&buf, "      }");
+        buf_append(&buf, "      {\n");
+        buf_appendf(&buf, "        \"pid\": %d,\n", p->pid);
+        buf_append(&buf, "        \"name\": ");
+        buf_append_json_string(&buf, fp_str(fp, p->name));
+        buf_append(&buf, ",\n");
+        buf_appendf(&buf, "        \"state\": \"%c\",\n", p->state);
+        buf_appendf(&buf, "        \"age_days\": %.2f,\n", p->age_seconds / 86400.0);
+        buf_appendf(&buf, "        \"memory_mb\": %.1f,\n", p->rss_bytes / (1024.0 * 1024.0));
+        buf_appendf(&buf, "        \"open_fds\": %d,\n", p->open_fd_count);
+        buf_appendf(&buf, "        \"threads\": %d,\n", p->thread_count);
+        if (p->fd_census_done) {
+            buf_appendf(&buf, "        \"fd_census\": {\"sockets\": %u, \"pipes\": %u, "
+                        "\"anon_inodes\": %u, \"files\": %u, \"deleted\": %u, "
+                        "\"deleted_mb\": %.1f},\n",
+                        p->fd_sockets, p->fd_pipes, p->fd_anon_inodes, p->fd_files,
+                        p->fd_deleted, p->fd_deleted_bytes / (1024.0 * 1024.0));
         }
+        buf_append(&buf, "        \"flag\": ");
+        buf_append_json_string(&buf, reason);
+        buf_append(&buf, "\n");
+        buf_append(&buf, "      }");
     }
     
     buf_append(&buf, "\n    ],\n");
@@ -229,6 +376,146 @@ char* fingerprint_to_json(const fingerprint_t *fp) {
     buf_appendf(&buf, "    \"stuck_count\": %d\n", stuck_count);
     buf_append(&buf, "  },\n");
     
+    /* Top-K consumers per resource, largest first */
+    const process_topk_t *tk = &fp->topk;
+    if (tk->k > 0) {
+        buf_append(&buf, "  \"top_consumers\": {\n");
+        buf_appendf(&buf, "    \"k\": %d", tk->k);
+        for (int m = 0; m < TOPK_METRIC_COUNT; m++) {
+            buf_appendf(&buf, ",\n    \"%s\": [", topk_metric_name((topk_metric_t)m));
+            for (int i = 0; i < tk->count[m]; i++) {
+                buf_append(&buf, i ? ",\n      " : "\n      ");
+                append_topk_entry(&buf, fp, (topk_metric_t)m, &tk->entries[m][i]);
+            }
+            buf_append(&buf, tk->count[m] ? "\n    ]" : "]");
+        }
+        buf_append(&buf, "\n  },\n");
+    }
+    
+    /* Slow leaks - significant fd/RSS growth across cycles */
+    const leak_report_t *lr = &fp->leaks;
+    buf_append(&buf, "  \"leak_suspects\": {\n");
+    buf_appendf(&buf, "    \"tracked\": %d,\n", lr->tracked);
+    buf_append(&buf, "    \"suspects\": [");
+    for (int i = 0; i < lr->count; i++) {
+        const leak_suspect_t *s = &lr->suspects[i];
+        int fds = s->resource == LEAK_FDS;
+        double unit = fds ? 1.0 : 1024.0 * 1024.0;
+        
+        buf_append(&buf, i ? ",\n      " : "\n      ");
+        buf_appendf(&buf, "{\"pid\": %d, \"name\": ", s->pid);
+        buf_append_json_string(&buf, fp_str(fp, s->name));
+        buf_appendf(&buf, ", \"resource\": \"%s\", \"current\": %.1f, "
+                    "\"growth_per_hour\": %.1f, \"unit\": \"%s\", "
+                    "\"t_stat\": %.1f, \"samples\": %d, ",
+                    fds ? "fds" : "rss", s->current / unit, s->slope_per_hour / unit,
+                    fds ? "fds" : "MB", s->t_stat, s->samples);
+        if (s->seconds_to_limit >= 0) {
+            buf_appendf(&buf, "\"limit\": %.1f, \"hours_to_limit\": %.1f}",
+                        s->limit / unit, s->seconds_to_limit / 3600.0);
+        } else {
+            buf_append(&buf, "\"limit\": null, \"hours_to_limit\": null}");
+        }
+    }
+    buf_append(&buf, lr->count ? "\n    ]\n" : "]\n");
+    buf_append(&buf, "  },\n");
+    
+    /* Zombies by parent - the parent that never waits is the bug */
+    const zombie_report_t *zr = &fp->zombies;
+    buf_append(&buf, "  \"zombie_parents\": {\n");
+    buf_appendf(&buf, "    \"zombies\": %d,\n", zr->zombies);
+    buf_appendf(&buf, "    \"parents\": %d,\n", zr->parent_count);
+    buf_appendf(&buf, "    \"reaped\": %d,\n", zr->reaped);
+    buf_appendf(&buf, "    \"reap_mean_seconds\": %.1f,\n", zr->reap_mean_seconds);
+    buf_appendf(&buf, "    \"reap_max_seconds\": %.1f,\n", zr->reap_max_seconds);
+    buf_append(&buf, "    \"top\": [");
+    for (int i = 0; i < zr->count; i++) {
+        const zombie_parent_t *zp = &zr->parents[i];
+        buf_append(&buf, i ? ",\n      " : "\n      ");
+        buf_appendf(&buf, "{\"ppid\": %d, \"name\": ", zp->ppid);
+        buf_append_json_string(&buf, fp_str(fp, zp->name));
+        buf_appendf(&buf, ", \"zombies\": %d, \"oldest_seconds\": %.0f, "
+                    "\"reaped\": %d, \"reap_mean_seconds\": %.1f, "
+                    "\"reap_max_seconds\": %.1f}",
+                    zp->zombies, zp->oldest_seconds, zp->reaped,
+                    zp->reap_mean_seconds, zp->reap_max_seconds);
+    }
+    buf_append(&buf, zr->count ? "\n    ]\n" : "]\n");
+    buf_append(&buf, "  },\n");
+    
+    /* Detection rules that matched this snapshot */
+    const rule_report_t *rr = &fp->rules;
+    buf_append(&buf, "  \"rules\": {\n");
+    buf_appendf(&buf, "    \"loaded\": %d,\n", rr->loaded);
+    buf_appendf(&buf, "    \"critical\": %d,\n", rr->critical);
+    buf_appendf(&buf, "    \"warnings\": %d,\n", rr->warnings);
+    buf_appendf(&buf, "    \"eval_us\": %.1f,\n", rr->eval_us);
+    buf_append(&buf, "    \"hits\": [");
+    for (int i = 0; i < rr->count; i++) {
+        const rule_hit_t *h = &rr->hits[i];
+        buf_append(&buf, i ? ",\n      " : "\n      ");
+        buf_append(&buf, "{\"name\": ");
+        buf_append_json_string(&buf, h->name);
+        buf_appendf(&buf, ", \"severity\": \"%s\", \"when\": ", rule_severity_name(h->severity));
+        buf_append_json_string(&buf, h->text);
+        buf_append(&buf, "}");
+    }
+    buf_append(&buf, rr->count ? "\n    ]\n" : "]\n");
+    buf_append(&buf, "  },\n");
+    
+    /* Probe plugins, one object each */
+    static const char *plugin_status[] = { "ok", "failed", "skipped", "deferred" };
+    buf_append(&buf, "  \"plugins\": {");
+    for (int i = 0; i < fp->plugins.count; i++) {
+        const plugin_section_t *ps = &fp->plugins.sections[i];
+        buf_append(&buf, i ? ",\n    " : "\n    ");
+        buf_append_json_string(&buf, ps->plugin->name);
+        buf_appendf(&buf, ": {\"status\": \"%s\", \"elapsed_ms\": %.2f, \"mean_ms\": %.2f, "
+                    "\"runs\": %lu, \"failures\": %lu",
+                    plugin_status[ps->status], ps->elapsed_ms, ps->mean_ms,
+                    ps->runs, ps->failures);
+        if (ps->section) {
+            plugin_writer_t w = { &buf, 0 };
+            probe_json_t out = { plugin_json_number, plugin_json_string, &w };
+            buf_append(&buf, ", \"data\": {");
+            ps->plugin->serialize(ps->section, &out);
+            buf_append(&buf, "}");
+            if (ps->prev && ps->plugin->diff) {
+                w.members = 0;
+                buf_append(&buf, ", \"changes\": {");
+                ps->plugin->diff(ps->prev, ps->section, &out);
+                buf_append(&buf, "}");
+            }
+        }
+        buf_append(&buf, "}");
+    }
+    buf_append(&buf, fp->plugins.count ? "\n  },\n" : "},\n");
+    
+    /* FD census - host-wide breakdown for fd-heavy processes */
+    const fd_census_t *fc = &fp->fd_census;
+    buf_append(&buf, "  \"fd_census\": {\n");
+    buf_appendf(&buf, "    \"threshold\": %d,\n", FD_CENSUS_THRESHOLD);
+    buf_appendf(&buf, "    \"processes_scanned\": %d,\n", fc->processes_scanned);
+    buf_appendf(&buf, "    \"budget_exhausted\": %s,\n", fc->budget_exhausted ? "true" : "false");
+    buf_appendf(&buf, "    \"sockets\": %lu,\n", (unsigned long)fc->sockets);
+    buf_appendf(&buf, "    \"pipes\": %lu,\n", (unsigned long)fc->pipes);
+    buf_appendf(&buf, "    \"anon_inodes\": %lu,\n", (unsigned long)fc->anon_inodes);
+    buf_appendf(&buf, "    \"files\": %lu,\n", (unsigned long)fc->files);
+    buf_appendf(&buf, "    \"deleted\": %lu,\n", (unsigned long)fc->deleted);
+    buf_appendf(&buf, "    \"deleted_mb\": %.1f,\n", fc->deleted_bytes / (1024.0 * 1024.0));
+    buf_append(&buf, "    \"deleted_files\": [\n");
+    for (int i = 0; i < fc->deleted_file_count; i++) {
+        const fd_info_t *f = &fc->deleted_files[i];
+        
+        if (i > 0) buf_append(&buf, ",\n");
+        
+        buf_appendf(&buf, "      {\"pid\": %d, \"fd\": %d, \"path\": ", f->pid, f->fd);
+        buf_append_json_string(&buf, fp_str(fp, f->target));
+        buf_appendf(&buf, ", \"size_mb\": %.1f}", f->size_bytes / (1024.0 * 1024.0));
+    }
+    buf_append(&buf, "\n    ]\n");
+    buf_append(&buf, "  },\n");
+    
     /* Config files */
     buf_append(&buf, "  \"config_files\": [\n");
     for (int i = 0; i < fp->config_count; i++) {
@@ -238,7 +525,7 @@ char* fingerprint_to_json(const fingerprint_t *fp) {
         
         buf_append(&buf, "    {\n");
         buf_append(&buf, "      \"path\": ");
-        buf_append_json_string(&buf, c->path);
+        buf_append_json_string(&buf, fp_str(fp, c->path));
         buf_append(&buf, ",\n");
         buf_appendf(&buf, "      \"size_bytes\": %lu,\n", (unsigned long)c->size);
         format_iso_time(c->mtime, time_buf, sizeof(time_buf));
@@ -275,12 +562,12 @@ char* fingerprint_to_json(const fingerprint_t *fp) {
         buf_append_json_string(&buf, l->protocol);
         buf_append(&buf, ",\n");
         buf_append(&buf, "        \"address\": ");
-        buf_append_json_string(&buf, l->local_addr);
+        buf_append_json_string(&buf, fp_str(fp, l->local_addr));
         buf_append(&buf, ",\n");
         buf_appendf(&buf, "        \"port\": %d,\n", l->local_port);
         buf_appendf(&buf, "        \"pid\": %d,\n", l->pid);
         buf_append(&buf, "        \"process\": ");
-        buf_append_json_string(&buf, l->process_name);
+        buf_append_json_string(&buf, fp_str(fp, l->process_name));
         buf_append(&buf, "\n      }");
     }
     buf_append(&buf, "\n    ],\n");
@@ -297,11 +584,11 @@ char* fingerprint_to_json(const fingerprint_t *fp) {
         buf_append_json_string(&buf, c->protocol);
         buf_append(&buf, ",\n");
         buf_append(&buf, "        \"local_addr\": ");
-        buf_append_json_string(&buf, c->local_addr);
+        buf_append_json_string(&buf, fp_str(fp, c->local_addr));
         buf_append(&buf, ",\n");
         buf_appendf(&buf, "        \"local_port\": %d,\n", c->local_port);
         buf_append(&buf, "        \"remote_addr\": ");
-        buf_append_json_string(&buf, c->remote_addr);
+        buf_append_json_string(&buf, fp_str(fp, c->remote_addr));
         buf_append(&buf, ",\n");
         buf_appendf(&buf, "        \"remote_port\": %d,\n", c->remote_port);
         buf_append(&buf, "        \"state\": ");
@@ -309,13 +596,201 @@ char* fingerprint_to_json(const fingerprint_t *fp) {
         buf_append(&buf, ",\n");
         buf_appendf(&buf, "        \"pid\": %d,\n", c->pid);
         buf_append(&buf, "        \"process\": ");
-        buf_append_json_string(&buf, c->process_name);
+        buf_append_json_string(&buf, fp_str(fp, c->process_name));
         buf_append(&buf, "\n      }");
     }
-    buf_append(&buf, "\n    ]\n");
+    buf_append(&buf, "\n    ],\n");
+    
+    /* UNIX domain sockets */
+    buf_append(&buf, "    \"unix_sockets\": {\n");
+    buf_appendf(&buf, "      \"total\": %d,\n", fp->network.unix_socket_total);
+    buf_append(&buf, "      \"listeners\": [\n");
+    for (int i = 0; i < fp->network.unix_listener_count; i++) {
+        const unix_listener_t *u = &fp->network.unix_listeners[i];
+        
+        if (i > 0) buf_append(&buf, ",\n");
+        
+        buf_append(&buf, "        {\"path\": ");
+        buf_append_json_string(&buf, fp_str(fp, u->path));
+        buf_append(&buf, ", \"type\": ");
+        buf_append_json_string(&buf, u->type);
+        buf_appendf(&buf, ", \"pid\": %d, \"process\": ", u->pid);
+        buf_append_json_string(&buf, fp_str(fp, u->process_name));
+        buf_append(&buf, "}");
+    }
+    buf_append(&buf, "\n      ],\n");
+    buf_append(&buf, "      \"per_process\": [\n");
+    for (int i = 0; i < fp->network.unix_proc_count; i++) {
+        const unix_proc_t *up = &fp->network.unix_procs[i];
+        
+        if (i > 0) buf_append(&buf, ",\n");
+        
+        buf_appendf(&buf, "        {\"pid\": %d, \"process\": ", up->pid);
+        buf_append_json_string(&buf, fp_str(fp, up->process_name));
+        buf_appendf(&buf, ", \"sockets\": %d}", up->socket_count);
+    }
+    buf_append(&buf, "\n      ]\n");
+    buf_append(&buf, "    },\n");
+    
+    /* Kernel socket memory */
+    const socket_mem_t *sm = &fp->network.sockmem;
+    buf_append(&buf, "    \"socket_memory\": {\n");
+    buf_appendf(&buf, "      \"sockets_used\": %d,\n", sm->sockets_used);
+    buf_appendf(&buf, "      \"tcp_inuse\": %d,\n", sm->tcp_inuse);
+    buf_appendf(&buf, "      \"tcp6_inuse\": %d,\n", sm->tcp6_inuse);
+    buf_appendf(&buf, "      \"tcp_orphan\": %d,\n", sm->tcp_orphan);
+    buf_appendf(&buf, "      \"tcp_time_wait\": %d,\n", sm->tcp_time_wait);
+    buf_appendf(&buf, "      \"udp_inuse\": %d,\n", sm->udp_inuse);
+    buf_appendf(&buf, "      \"udp6_inuse\": %d,\n", sm->udp6_inuse);
+    buf_appendf(&buf, "      \"tcp_mem_pages\": %lu,\n", (unsigned long)sm->tcp_mem_pages);
+    buf_appendf(&buf, "      \"udp_mem_pages\": %lu,\n", (unsigned long)sm->udp_mem_pages);
+    buf_appendf(&buf, "      \"tcp_mem_limits\": [%lu, %lu, %lu],\n",
+                (unsigned long)sm->tcp_mem_min, (unsigned long)sm->tcp_mem_pressure,
+                (unsigned long)sm->tcp_mem_max);
+    buf_appendf(&buf, "      \"tcp_mem_percent_of_max\": %.1f,\n",
+                sm->tcp_mem_max ? 100.0 * sm->tcp_mem_pages / sm->tcp_mem_max : 0.0);
+    buf_appendf(&buf, "      \"tcp_mem_under_pressure\": %s\n",
+                sm->tcp_mem_under_pressure ? "true" : "false");
+    buf_append(&buf, "    },\n");
+    
+    /* TCP/IP stack counters - totals since boot, deltas since last probe */
+    const tcp_health_t *th = &fp->tcp_health;
+    buf_append(&buf, "    \"tcp_health\": {\n");
+    buf_appendf(&buf, "      \"available\": %s,\n", th->available ? "true" : "false");
+    buf_appendf(&buf, "      \"has_delta\": %s,\n", th->has_delta ? "true" : "false");
+    buf_appendf(&buf, "      \"interval_seconds\": %.1f,\n", th->interval_seconds);
+    buf_appendf(&buf, "      \"retrans_percent\": %.3f,\n", th->retrans_percent);
+    buf_append(&buf, "      \"counters\": {");
+    for (int i = 0; i < TCP_CTR_COUNT; i++) {
+        buf_appendf(&buf, "%s\n        \"%s\": {\"total\": %llu, \"delta\": %llu, \"per_second\": %.3f}",
+                    i > 0 ? "," : "", tcp_counter_name((tcp_counter_t)i),
+                    (unsigned long long)th->totals[i],
+                    (unsigned long long)th->deltas[i], th->rates[i]);
+    }
+    buf_append(&buf, "\n      }\n");
+    buf_append(&buf, "    }\n");
     buf_append(&buf, "  }\n");
     
     buf_append(&buf, "}\n");
     
     return buf.data;
 }
+
+/* ============================================================
+ * Section Manifest
+ * ============================================================
+ * The receiver stores sections by digest, so an agent that knows which
+ * digests it has already delivered can send just the manifest entry
+ * for an unchanged section. Digests cover the value text exactly as
+ * printed above; only the top-level layout is rewritten here.
+ */
+
+#define MAX_SECTIONS 64
+
+typedef struct {
+    const char *key;            /* Including quotes */
+    size_t key_len;
+    const char *value;
+    size_t value_len;
+} json_member_t;
+
+static const char *skip_space(const char *p) {
+    while (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t') p++;
+    return p;
+}
+
+/* End of the value at p, or NULL if the document ends first */
+static const char *value_end(const char *p) {
+    int depth = 0;
+    
+    do {
+        if (*p == '"') {
+            for (p++; *p && *p != '"'; p++) {
+                if (*p == '\\' && p[1]) p++;
+            }
+            if (!*p) return NULL;
+        } else if (*p == '{' || *p == '[') {
+            depth++;
+        } else if (*p == '}' || *p == ']') {
+            depth--;
+        } else if (depth == 0) {
+            while (*p && *p != ',' && *p != '}' && *p != ']' &&
+                   *p != ' ' && *p != '\n') {
+                p++;
+            }
+            return *p ? p : NULL;
+        }
+        if (!*p) return NULL;
+        p++;
+    } while (depth > 0);
+    
+    return p;
+}
+
+static int buf_append_len(json_buffer_t *buf, const char *str, size_t len) {
+    if (buf_ensure(buf, len + 1) != 0) return -1;
+    
+    memcpy(buf->data + buf->size, str, len);
+    buf->size += len;
+    buf->data[buf->size] = '\0';
+    return 0;
+}
+
+char* json_add_section_digests(char *json, const char *known) {
+    json_member_t members[MAX_SECTIONS];
+    char digests[MAX_SECTIONS][65];
+    int count = 0;
+    
+    if (!json) return NULL;
+    const char *p = skip_space(json);
+    if (*p++ != '{') return json;
+    
+    for (p = skip_space(p); *p != '}'; p = skip_space(p)) {
+        if (*p != '"' || count == MAX_SECTIONS) return json;
+        json_member_t *m = &members[count];
+        m->key = p;
+        if (!(p = value_end(p))) return json;
+        m->key_len = (size_t)(p - m->key);
+        
+        p = skip_space(p);
+        if (*p++ != ':') return json;
+        m->value = p = skip_space(p);
+        if (!(p = value_end(p))) return json;
+        m->value_len = (size_t)(p - m->value);
+        
+        digests[count][0] = '\0';
+        if (*m->value == '{' || *m->value == '[') {
+            sha256_buffer(m->value, m->value_len, digests[count], sizeof(digests[count]));
+        }
+        count++;
+        
+        p = skip_space(p);
+        if (*p == ',') p++;
+        else if (*p != '}') return json;
+    }
+    
+    json_buffer_t buf;
+    if (buf_init(&buf) != 0) return json;
+    
+    buf_append(&buf, "{\n");
+    for (int i = 0; i < count; i++) {
+        if (digests[i][0] && known && strstr(known, digests[i])) continue;
+        buf_append(&buf, "  ");
+        buf_append_len(&buf, members[i].key, members[i].key_len);
+        buf_append(&buf, ": ");
+        buf_append_len(&buf, members[i].value, members[i].value_len);
+        buf_append(&buf, ",\n");
+    }
+    
+    int listed = 0;
+    buf_append(&buf, "  \"section_digests\": {");
+    for (int i = 0; i < count; i++) {
+        if (!digests[i][0]) continue;
+        buf_append(&buf, listed++ ? ",\n    " : "\n    ");
+        buf_append_len(&buf, members[i].key, members[i].key_len);
+        buf_appendf(&buf, ": \"%s\"", digests[i]);
+    }
+    buf_append(&buf, listed ? "\n  }\n}\n" : "}\n}\n");
+    
+    return buf.data;
+}
@@ -0,0 +1,298 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * leak.c - Slow fd and memory leak detection across probe cycles
+ *
+ * A single snapshot cannot tell a leak from a busy process. Each
+ * (pid, starttime ticks) keeps running sums for a least-squares line of fd
+ * count and RSS against time. The sums decay by LEAK_DECAY per sample,
+ * so an update is O(1), memory per process is fixed, and the fit
+ * follows the recent trend rather than the whole lifetime. A process
+ * is flagged when the slope is positive, its t-statistic clears
+ * LEAK_T_MIN, and the fitted growth is large enough to matter; the
+ * report projects when it reaches its fd limit or exhausts memory.
+ *
+ * History lives in two static tables sorted by pid (swapped each
+ * cycle); with --keep-state it is also saved to ~/.sentinel/leaks.dat,
+ * at most every LEAK_SAVE_SECS, so cron runs build it up too.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "sentinel.h"
+
+#define LEAK_STATE_FILENAME "leaks.dat"
+#define LEAK_STATE_MAGIC "SNTLLK02"
+#define LEAK_T_PERFECT 1000.0           /* t for a residual-free line */
+
+/* Decayed sums of one series against the shared time sums */
+typedef struct {
+    double sy, sty, syy;
+} leak_series_t;
+
+typedef struct {
+    pid_t pid;
+    int samples;
+    uint64_t start_ticks;
+    double origin;              /* Boot time of the first sample */
+    double last_seen;
+    double sw, sw2, st, stt;    /* Weights and time, shared by both series */
+    leak_series_t fds;
+    leak_series_t rss_kb;
+    int carried;                /* Scratch: matched this cycle */
+} leak_entry_t;
+
+typedef struct {
+    double slope;               /* Per second */
+    double t_stat;
+    double growth;              /* slope x fitted window */
+} leak_fit_t;
+
+static leak_entry_t g_tables[2][LEAK_TRACK_MAX];
+static int g_counts[2];
+static int g_prev = 0;
+static int g_loaded = 0;
+static double g_saved_at = -1;  /* Boot time of the last save */
+
+static int cmp_entry(const void *a, const void *b) {
+    pid_t x = ((const leak_entry_t *)a)->pid;
+    pid_t y = ((const leak_entry_t *)b)->pid;
+    return (x > y) - (x < y);
+}
+
+/* ============================================================
+ * Regression
+ * ============================================================ */
+
+static void series_add(leak_series_t *s, double t, double y) {
+    s->sy = LEAK_DECAY * s->sy + y;
+    s->sty = LEAK_DECAY * s->sty + t * y;
+    s->syy = LEAK_DECAY * s->syy + y * y;
+}
+
+static void entry_add(leak_entry_t *e, double now, double fds, double rss_kb) {
+    double t = now - e->origin;
+    e->sw = LEAK_DECAY * e->sw + 1.0;
+    e->sw2 = LEAK_DECAY * LEAK_DECAY * e->sw2 + 1.0;
+    e->st = LEAK_DECAY * e->st + t;
+    e->stt = LEAK_DECAY * e->stt + t * t;
+    series_add(&e->fds, t, fds);
+    series_add(&e->rss_kb, t, rss_kb);
+    e->samples++;
+    e->last_seen = now;
+}
+
+/* Weighted least squares on the centred sums. Degrees of freedom come
+ * from the effective sample size sw^2/sw2, which decay keeps small. */
+static leak_fit_t fit_series(const leak_entry_t *e, const leak_series_t *s) {
+    leak_fit_t f = { 0, 0, 0 };
+    double stt_c = e->stt - e->st * e->st / e->sw;
+    if (stt_c <= 0) return f;
+
+    double sty_c = s->sty - e->st * s->sy / e->sw;
+    double syy_c = s->syy - s->sy * s->sy / e->sw;
+    f.slope = sty_c / stt_c;
+
+    /* Evenly spaced samples have variance span^2/12 */
+    f.growth = f.slope * sqrt(12.0 * stt_c / e->sw);
+
+    double n_eff = e->sw * e->sw / e->sw2;
+    double sse = syy_c - f.slope * sty_c;
+    if (n_eff <= 2.0) return f;
+    if (sse <= 0) {
+        /* Perfectly straight line: as significant as it gets */
+        f.t_stat = f.slope > 0 ? LEAK_T_PERFECT : 0;
+        return f;
+    }
+    double se = sqrt(sse / (n_eff - 2.0) / stt_c);
+    f.t_stat = f.slope / se;
+    return f;
+}
+
+/* ============================================================
+ * Limits
+ * ============================================================ */
+
+/* MemAvailable in bytes, 0 if unknown */
+static double mem_available(void) {
+    char line[128];
+    double avail = 0;
+    FILE *f = pfs_fopen("/proc/meminfo");
+    if (!f) return 0;
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long long kb;
+        if (sscanf(line, "MemAvailable: %llu kB", &kb) == 1) {
+            avail = kb * 1024.0;
+            break;
+        }
+    }
+    fclose(f);
+    return avail;
+}
+
+/* ============================================================
+ * State File
+ * ============================================================ */
+
+/* Skipped under --record/--replay so output depends on the archive alone */
+static void load_state(void) {
+    char path[512];
+    if (pfs_active() || probe_state_path(LEAK_STATE_FILENAME, path, sizeof(path)) != 0) return;
+
+    FILE *f = fopen(path, "rb");
+    if (!f) return;
+
+    char magic[8];
+    int count = 0;
+    if (fread(magic, sizeof(magic), 1, f) == 1 &&
+        memcmp(magic, LEAK_STATE_MAGIC, 8) == 0 &&
+        fread(&count, sizeof(count), 1, f) == 1 &&
+        count >= 0 && count <= LEAK_TRACK_MAX &&
+        fread(g_tables[g_prev], sizeof(leak_entry_t), (size_t)count, f) == (size_t)count) {
+        g_counts[g_prev] = count;
+    }
+    fclose(f);
+}
+
+static void save_state(const leak_entry_t *entries, int count) {
+    char path[512];
+    if (pfs_active() || probe_state_path(LEAK_STATE_FILENAME, path, sizeof(path)) != 0) return;
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return;
+    fwrite(LEAK_STATE_MAGIC, 8, 1, f);
+    fwrite(&count, sizeof(count), 1, f);
+    fwrite(entries, sizeof(leak_entry_t), (size_t)count, f);
+    fclose(f);
+}
+
+/* ============================================================
+ * Update
+ * ============================================================ */
+
+static double suspect_eta(const leak_suspect_t *s) {
+    return s->seconds_to_limit < 0 ? INFINITY : s->seconds_to_limit;
+}
+
+/* Keep the LEAK_REPORT_MAX suspects that hit a limit soonest */
+static void report_add(leak_report_t *r, const leak_suspect_t *s) {
+    int slot = r->count;
+    while (slot > 0 && suspect_eta(&r->suspects[slot - 1]) > suspect_eta(s)) slot--;
+    if (slot >= LEAK_REPORT_MAX) return;
+
+    int last = r->count < LEAK_REPORT_MAX ? r->count : LEAK_REPORT_MAX - 1;
+    memmove(&r->suspects[slot + 1], &r->suspects[slot],
+            (size_t)(last - slot) * sizeof(leak_suspect_t));
+    if (r->count < LEAK_REPORT_MAX) r->count++;
+    r->suspects[slot] = *s;
+}
+
+static void check_entry(fingerprint_t *fp, const process_info_t *p,
+                        const leak_entry_t *e, double *avail) {
+    if (e->samples < LEAK_MIN_SAMPLES) return;
+
+    leak_fit_t fd_fit = fit_series(e, &e->fds);
+    leak_fit_t rss_fit = fit_series(e, &e->rss_kb);
+
+    if (fd_fit.slope > 0 && fd_fit.t_stat >= LEAK_T_MIN &&
+        fd_fit.growth >= LEAK_MIN_FD_GROWTH) {
+        leak_suspect_t s = {
+            .pid = p->pid, .name = p->name, .resource = LEAK_FDS,
+            .current = p->open_fd_count, .slope_per_hour = fd_fit.slope * 3600,
+            .t_stat = fd_fit.t_stat, .samples = e->samples,
+            .limit = (double)p->fd_soft_limit, .seconds_to_limit = -1,
+        };
+        if (s.limit > 0) {
+            double left = s.limit - s.current;
+            s.seconds_to_limit = left > 0 ? left / fd_fit.slope : 0;
+        }
+        report_add(&fp->leaks, &s);
+    }
+
+    if (rss_fit.slope > 0 && rss_fit.t_stat >= LEAK_T_MIN &&
+        rss_fit.growth >= LEAK_MIN_RSS_GROWTH_KB) {
+        if (*avail < 0) *avail = mem_available();
+        double slope_bytes = rss_fit.slope * 1024.0;
+        leak_suspect_t s = {
+            .pid = p->pid, .name = p->name, .resource = LEAK_RSS,
+            .current = (double)p->rss_bytes, .slope_per_hour = slope_bytes * 3600,
+            .t_stat = rss_fit.t_stat, .samples = e->samples,
+            .limit = 0, .seconds_to_limit = -1,
+        };
+        if (*avail > 0) {
+            s.limit = s.current + *avail;
+            s.seconds_to_limit = *avail / slope_bytes;
+        }
+        report_add(&fp->leaks, &s);
+    }
+}
+
+void leak_track_update(fingerprint_t *fp) {
+    if (!g_loaded) {
+        load_state();
+        g_loaded = 1;
+    }
+
+    leak_entry_t *prev = g_tables[g_prev];
+    int prev_count = g_counts[g_prev];
+    leak_entry_t *cur = g_tables[1 - g_prev];
+    int n = 0;
+    double now = boottime_seconds();
+    double avail = -1;          /* Read on first need */
+
+    memset(&fp->leaks, 0, sizeof(fp->leaks));
+    for (int i = 0; i < prev_count; i++) prev[i].carried = 0;
+
+    for (int i = 0; i < fp->process_count && n < LEAK_TRACK_MAX; i++) {
+        const process_info_t *p = &fp->processes[i];
+        if (p->state == 'Z' || p->open_fd_count >= PROC_FD_SANE_MAX) continue;
+
+        leak_entry_t key = { .pid = p->pid };
+        leak_entry_t *old = bsearch(&key, prev, prev_count, sizeof(key), cmp_entry);
+        leak_entry_t *e = &cur[n++];
+
+        if (old) old->carried = 1;      /* Continued, or its pid was reused */
+        if (old && old->start_ticks == p->start_ticks && now > old->last_seen) {
+            *e = *old;
+        } else {
+            memset(e, 0, sizeof(*e));
+            e->pid = p->pid;
+            e->start_ticks = p->start_ticks;
+            e->origin = now;
+        }
+
+        entry_add(e, now, p->open_fd_count, p->rss_bytes / 1024.0);
+        check_entry(fp, p, e, &avail);
+    }
+
+    /* Sampling mode skips most pids most cycles - keep their history
+     * until it goes stale */
+    for (int i = 0; i < prev_count && n < LEAK_TRACK_MAX; i++) {
+        if (!prev[i].carried && now - prev[i].last_seen < LEAK_STALE_SECS) {
+            cur[n++] = prev[i];
+        }
+    }
+
+    qsort(cur, n, sizeof(*cur), cmp_entry);
+    g_counts[1 - g_prev] = n;
+    g_prev = 1 - g_prev;
+    fp->leaks.tracked = n;
+
+    /* The file is ~150 bytes per tracked process; watch mode keeps the
+     * history in memory and only needs a recent copy on disk */
+    if (g_saved_at < 0 || now - g_saved_at >= LEAK_SAVE_SECS) {
+        save_state(cur, n);
+        g_saved_at = now;
+    }
+}
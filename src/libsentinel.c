@@ -0,0 +1,294 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * libsentinel.c - Embedding API over the probes (see libsentinel.h)
+ *
+ * A thin layer: the handle owns a fingerprint and the analysis of it,
+ * and each call is what run_analysis() in main.c does, minus the
+ * printing. The library is built from the same objects as the sentinel
+ * binary; libsentinel.map keeps everything but sentinel_* out of the
+ * shared object's symbol table.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sentinel.h"
+#include "audit.h"
+#include "libsentinel.h"
+
+#define AUDIT_JSON_MAX 32768
+
+struct sentinel {
+    sentinel_allocator_t alloc;
+    unsigned probes;
+    int audit_window;
+    const char **configs;       /* Copied: abandoned workers may read them */
+    int config_count;
+    int captured;
+    int audit_risk_score;       /* -1 = not probed */
+    fingerprint_t *fp;
+    quick_analysis_t analysis;
+    audit_summary_t *audit;
+    char *json;                 /* Probe arena, built on demand */
+    size_t json_len;
+};
+
+static int g_open;
+
+static void *heap_alloc(size_t size, void *ctx) {
+    (void)ctx;
+    return malloc(size);
+}
+
+static void heap_free(void *ptr, void *ctx) {
+    (void)ctx;
+    free(ptr);
+}
+
+static void *s_alloc(const sentinel_t *s, size_t size) {
+    return s->alloc.alloc(size, s->alloc.ctx);
+}
+
+static void s_free(const sentinel_t *s, void *ptr) {
+    if (ptr) s->alloc.free(ptr, s->alloc.ctx);
+}
+
+int sentinel_api_version(void) {
+    return SENTINEL_API_VERSION;
+}
+
+/* Config paths and their strings in one block */
+static int copy_configs(sentinel_t *s, const char *const *paths, int count) {
+    if (!paths) {
+        paths = default_config_paths;
+        count = 0;
+        while (default_config_paths[count]) count++;
+    }
+    if (count > MAX_CONFIG_FILES) count = MAX_CONFIG_FILES;
+
+    size_t size = (size_t)count * sizeof(char *);
+    for (int i = 0; i < count; i++) size += strlen(paths[i]) + 1;
+
+    char **block = s_alloc(s, size ? size : 1);
+    if (!block) return -1;
+    char *text = (char *)(block + count);
+    for (int i = 0; i < count; i++) {
+        size_t len = strlen(paths[i]) + 1;
+        memcpy(text, paths[i], len);
+        block[i] = text;
+        text += len;
+    }
+    s->configs = (const char **)block;
+    s->config_count = count;
+    return 0;
+}
+
+static int load_rules(const char *path) {
+    char default_path[512], err[512];
+    if (!path) {
+        baseline_state_lookup("rules", default_path, sizeof(default_path));
+        if (access(default_path, R_OK) != 0) return 0;
+        path = default_path;
+    }
+    if (rules_load(path, err, sizeof(err)) < 0) {
+        fprintf(stderr, "libsentinel: %s\n", err);
+        return -1;
+    }
+    return 0;
+}
+
+sentinel_t *sentinel_open(const sentinel_options_t *opts) {
+    if (!opts || opts->api_version != SENTINEL_API_VERSION || g_open) return NULL;
+
+    sentinel_allocator_t alloc = { heap_alloc, heap_free, NULL };
+    if (opts->allocator && opts->allocator->alloc && opts->allocator->free) {
+        alloc = *opts->allocator;
+    }
+    /* The probe arena draws on the same allocator; it outlives the
+     * handle, so a later open has to bring the same one */
+    if (arena_set_allocator(opts->allocator ? alloc.alloc : NULL,
+                            opts->allocator ? alloc.free : NULL, alloc.ctx) != 0) {
+        return NULL;
+    }
+    if ((opts->probes & SENTINEL_PROBE_RULES) && load_rules(opts->rules_path) != 0) {
+        return NULL;
+    }
+
+    sentinel_t *s = alloc.alloc(sizeof(*s), alloc.ctx);
+    if (!s) return NULL;
+    memset(s, 0, sizeof(*s));
+    s->alloc = alloc;
+    s->probes = opts->probes;
+    s->audit_window = opts->audit_window_seconds > 0 ? opts->audit_window_seconds : 300;
+    s->audit_risk_score = -1;
+
+    s->fp = s_alloc(s, sizeof(fingerprint_t));
+    if (!s->fp || copy_configs(s, opts->config_paths, opts->config_count) != 0) {
+        s_free(s, s->fp);
+        alloc.free(s, alloc.ctx);
+        return NULL;
+    }
+    memset(s->fp, 0, sizeof(fingerprint_t));
+
+    g_open = 1;
+    return s;
+}
+
+void sentinel_close(sentinel_t *s) {
+    if (!s) return;
+    s_free(s, (void *)s->configs);
+    s_free(s, s->fp);
+    sentinel_allocator_t alloc = s->alloc;
+    alloc.free(s, alloc.ctx);
+    g_open = 0;
+}
+
+int sentinel_capture(sentinel_t *s) {
+    if (!s) return -1;
+
+    /* The previous cycle's JSON, audit summary and plugin sections go */
+    if (s->captured) arena_reset(probe_arena());
+    s->captured = 1;
+    s->json = NULL;
+    s->audit = NULL;
+    s->audit_risk_score = -1;
+
+    int rules = s->probes & SENTINEL_PROBE_RULES;
+    int rc = capture_fingerprint(s->fp, s->configs, s->config_count);
+    if (((s->probes & SENTINEL_PROBE_NETWORK) || (rules && rules_need_network())) &&
+        capture_network(s->fp) != 0) rc = -1;
+    if (s->probes & SENTINEL_PROBE_AUDIT) sentinel_probe_audit(s, s->audit_window);
+    if (rules) rules_evaluate(s->fp);
+
+    analyze_fingerprint_quick(s->fp, &s->analysis);
+    return rc;
+}
+
+int sentinel_probe_network(sentinel_t *s) {
+    if (!s || !s->captured) return -1;
+    int rc = capture_network(s->fp);
+    s->json = NULL;
+    if (s->probes & SENTINEL_PROBE_RULES) rules_evaluate(s->fp);
+    analyze_fingerprint_quick(s->fp, &s->analysis);
+    return rc;
+}
+
+int sentinel_probe_audit(sentinel_t *s, int window_seconds) {
+    if (!s || !s->captured) return -1;
+    s->json = NULL;
+    s->audit = probe_audit(window_seconds > 0 ? window_seconds : s->audit_window);
+    s->audit_risk_score = s->audit && s->audit->enabled ? s->audit->risk_score : -1;
+    return s->audit_risk_score >= 0 ? 0 : -1;
+}
+
+int sentinel_summary(const sentinel_t *s, sentinel_summary_t *out) {
+    if (!s || !out) return -1;
+    memset(out, 0, sizeof(*out));
+    if (!s->captured) {
+        out->severity = SENTINEL_ERROR;
+        out->audit_risk_score = -1;
+        return -1;
+    }
+
+    const fingerprint_t *fp = s->fp;
+    const quick_analysis_t *a = &s->analysis;
+    out->severity = (sentinel_severity_t)analysis_exit_code(fp, a, s->audit_risk_score);
+    out->probe_time = (int64_t)fp->system.probe_time;
+    out->probe_ms = fp->probe_duration_ms;
+    memcpy(out->load_avg, fp->system.load_avg, sizeof(out->load_avg));
+    out->mem_used_pct = fp->system.total_ram ?
+        100.0 * (1.0 - (double)fp->system.free_ram / fp->system.total_ram) : 0;
+    out->cpu_busy_pct = fp->cpu.available ? fp->cpu.total.busy_pct : 0;
+    out->processes = fp->process_total;
+    out->zombies = a->zombie_process_count;
+    out->high_fd_processes = a->high_fd_process_count;
+    out->long_running_processes = a->long_running_process_count;
+    out->high_memory_processes = a->high_memory_process_count;
+    out->leak_suspects = a->leak_suspects;
+    out->config_permission_issues = a->config_permission_issues;
+    out->listeners = fp->network.listener_count;
+    out->connections = fp->network.connection_count;
+    out->unusual_listeners = a->unusual_listeners;
+    out->rule_hits = fp->rules.count;
+    out->audit_risk_score = s->audit_risk_score;
+    out->probe_errors = fp->probe_errors;
+    return 0;
+}
+
+int sentinel_process_count(const sentinel_t *s) {
+    return s && s->captured ? s->fp->process_count : 0;
+}
+
+int sentinel_process(const sentinel_t *s, int index, sentinel_process_t *out) {
+    if (!out || index < 0 || index >= sentinel_process_count(s)) return -1;
+
+    const process_info_t *p = &s->fp->processes[index];
+    out->pid = p->pid;
+    out->ppid = p->ppid;
+    out->name = fp_str(s->fp, p->name);
+    out->state = p->state;
+    out->rss_bytes = p->rss_bytes;
+    out->open_fds = p->open_fd_count < PROC_FD_SANE_MAX ? p->open_fd_count : 0;
+    out->threads = p->thread_count;
+    out->cpu_percent = p->cpu_percent;
+    out->age_seconds = p->age_seconds;
+    return 0;
+}
+
+int sentinel_listener_count(const sentinel_t *s) {
+    return s && s->captured ? s->fp->network.listener_count : 0;
+}
+
+int sentinel_listener(const sentinel_t *s, int index, sentinel_listener_t *out) {
+    if (!out || index < 0 || index >= sentinel_listener_count(s)) return -1;
+
+    const net_listener_t *l = &s->fp->network.listeners[index];
+    out->protocol = l->protocol;
+    out->address = fp_str(s->fp, l->local_addr);
+    out->port = l->local_port;
+    out->pid = l->pid;
+    out->process = fp_str(s->fp, l->process_name);
+    return 0;
+}
+
+const char *sentinel_json(sentinel_t *s, size_t *len) {
+    if (!s || !s->captured) return NULL;
+    if (s->json) {
+        if (len) *len = s->json_len;
+        return s->json;
+    }
+
+    char *json = fingerprint_to_json(s->fp);
+    if (!json) return NULL;
+
+    /* Audit goes in before the closing brace, as in the CLI */
+    char *last_brace = strrchr(json, '}');
+    if (s->audit && s->audit->enabled && last_brace) {
+        char *audit_json = arena_alloc(probe_arena(), AUDIT_JSON_MAX);
+        if (!audit_json) return NULL;
+        audit_to_json(s->audit, audit_json, AUDIT_JSON_MAX);
+
+        size_t head = (size_t)(last_brace - json);
+        size_t total = head + strlen(audit_json) + 5;
+        char *combined = arena_alloc(probe_arena(), total);
+        if (!combined) return NULL;
+        *last_brace = '\0';
+        snprintf(combined, total, "%s,\n%s\n}\n", json, audit_json);
+        json = combined;
+    }
+    json = json_add_section_digests(json, NULL);
+
+    s->json = json;
+    s->json_len = strlen(json);
+    if (len) *len = s->json_len;
+    return json;
+}
@@ -20,23 +20,15 @@
 
 #include "sentinel.h"
 #include "audit.h"
+#include "compliance.h"
 #include "color.h"
-
-/* Default config files to probe if none specified */
-static const char *default_configs[] = {
-    "/etc/hosts",
-    "/etc/passwd",
-    "/etc/ssh/sshd_config",
-    "/etc/fstab",
-    "/etc/resolv.conf",
-    NULL
-};
+#include "pipeline.h"
 
 /* Global flag for clean shutdown in watch mode */
 static volatile int keep_running = 1;
 
-/* Global audit summary for JSON output integration */
-static audit_summary_t *g_audit_summary = NULL;
+/* --known-digests: sections the receiver already holds */
+static char *g_known_digests = NULL;
 
 static void signal_handler(int signum) {
     (void)signum;
@@ -54,6 +46,8 @@ static void print_usage(const char *prog) {
     fprintf(stderr, "  -j, --json           Output JSON to stdout (even in quick mode)\n");
     fprintf(stderr, "  -w, --watch          Continuous monitoring mode\n");
     fprintf(stderr, "  -i, --interval SEC   Interval between probes in watch mode (default: 60)\n");
+    fprintf(stderr, "      --keep-state     Carry TCP, leak, zombie and auth history to the next\n");
+    fprintf(stderr, "                       run in ~/.sentinel (always on in watch mode)\n");
     fprintf(stderr, "  -n, --network        Include network probe (listeners, connections)\n");
     fprintf(stderr, "  -a, --audit          Include auditd security events\n");
     fprintf(stderr, "  -b, --baseline       Compare against learned baseline\n");
@@ -63,6 +57,20 @@ static void print_usage(const char *prog) {
     fprintf(stderr, "      --audit-learn    Learn audit baseline\n");
     fprintf(stderr, "      --color          Force coloured output\n");
     fprintf(stderr, "      --no-color       Disable coloured output\n");
+    fprintf(stderr, "      --probe-timeout MS  Deadline per probe stage (default: %d)\n", PROBE_STAGE_DEADLINE_MS);
+    fprintf(stderr, "      --sample K       Read 1/K of processes per probe (large hosts)\n");
+    fprintf(stderr, "      --top K          Top-K consumers per resource in JSON (default: %d, 0 = off)\n", TOPK_DEFAULT);
+    fprintf(stderr, "      --procfs-sync    Read /proc synchronously (no io_uring)\n");
+    fprintf(stderr, "      --bench-procfs   Compare io_uring and synchronous /proc reads\n");
+    fprintf(stderr, "      --compliance FW  Evaluate controls of a framework (\"list\" to show them)\n");
+    fprintf(stderr, "      --rules FILE     Detection rules to evaluate (default: ~/.sentinel/rules)\n");
+    fprintf(stderr, "      --plugin SO      Load a probe plugin module (\"list\" to show plugins)\n");
+    fprintf(stderr, "      --record FILE    Save every /proc read the probes make to FILE\n");
+    fprintf(stderr, "      --replay FILE    Probe from a --record archive instead of /proc\n");
+    fprintf(stderr, "      --known-digests FILE  Leave out JSON sections whose digest is in FILE\n");
+    fprintf(stderr, "      --since TIME     Print audit records from TIME (uses the audit time index)\n");
+    fprintf(stderr, "      --until TIME     ... up to TIME (default: now)\n");
+    fprintf(stderr, "      --audit-dir DIR  Audit logs for --since/--until (default: %s)\n", AUDIT_LOG_DIR);
     fprintf(stderr, "\n");
     fprintf(stderr, "Exit codes:\n");
     fprintf(stderr, "  0 - No issues detected\n");
@@ -80,6 +88,8 @@ static void print_usage(const char *prog) {
     fprintf(stderr, "  Include security events:       %s --quick --audit\n", prog);
     fprintf(stderr, "  Learn audit baseline:          %s --audit-learn\n", prog);
     fprintf(stderr, "  Full analysis with audit:      %s --json --network --audit\n", prog);
+    fprintf(stderr, "  Records in a window:           %s --since 02:10 --until 02:20\n", prog);
+    fprintf(stderr, "  TIME is now, -N[smhd], unix seconds, YYYY-MM-DD [HH:MM[:SS]] or HH:MM[:SS]\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "Environment:\n");
     fprintf(stderr, "  NO_COLOR             Disable coloured output (standard)\n");
@@ -96,9 +106,8 @@ static void print_usage(const char *prog) {
     fprintf(stderr, "  %s --baseline --network       Compare against baseline\n", prog);
 }
 
-static void print_timestamp(void) {
-    time_t now = time(NULL);
-    struct tm *t = localtime(&now);
+static void print_timestamp(time_t when) {
+    struct tm *t = localtime(&when);
     char buf[64];
     strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", t);
     printf("[%s] ", buf);
@@ -122,7 +131,19 @@ static void print_audit_summary_quick(const audit_summary_t *audit) {
     printf("\n");
     
     if (audit->brute_force_detected) {
-        printf("  %s⚠ BRUTE FORCE PATTERN DETECTED%s\n", col_critical(), col_reset());
+        printf("  %s⚠ BRUTE FORCE PATTERN DETECTED%s%s%s\n", col_critical(),
+               audit->source_burst ? " (single-source burst)" : "",
+               audit->distributed_spray ? " (distributed)" : "", col_reset());
+    }
+    if (audit->window_failures > 0) {
+        printf("  Last %d min: %d failures from %d source(s) against %d user(s)\n",
+               AUTH_BUCKETS * AUTH_BUCKET_SECONDS / 60, audit->window_failures,
+               audit->failure_sources, audit->window_users);
+        for (int i = 0; i < audit->top_source_count && i < 3; i++) {
+            const auth_hitter_t *h = &audit->top_sources[i];
+            printf("    %s%-40s%s %d (%d recent)\n", col_dim(), h->key, col_reset(),
+                   h->window, h->burst);
+        }
     }
     
     printf("  Sudo commands: %d", audit->sudo_count);
@@ -156,6 +177,15 @@ static void print_audit_summary_quick(const audit_summary_t *audit) {
     if (audit->apparmor_denials > 0) {
         printf("  AppArmor denials: %s%d%s\n", col_warn(), audit->apparmor_denials, col_reset());
     }
+    for (int i = 0; i < audit->denial_count && i < 5; i++) {
+        const denial_group_t *d = &audit->denials[i];
+        printf("    %5d  %s: %s { %s } %s%s -> %s%s\n", d->count,
+               d->comm[0] ? d->comm : "?", d->tclass, d->perms,
+               col_dim(), d->subject, d->target, col_reset());
+    }
+    if (audit->denial_groups > 5) {
+        printf("    %s... and %d more groups%s\n", col_dim(), audit->denial_groups - 5, col_reset());
+    }
     
     /* Show anomalies */
     if (audit->anomaly_count > 0) {
@@ -170,25 +200,58 @@ static void print_audit_summary_quick(const audit_summary_t *audit) {
     printf("\n  Risk: %s (score: %d)\n", audit->risk_level, audit->risk_score);
 }
 
-static int run_analysis(const char **configs, int config_count, 
-                        int quick_mode, int json_mode, int network_mode, int audit_mode) {
-    fingerprint_t fp;
-    int result = capture_fingerprint(&fp, configs, config_count);
+/* Fingerprint JSON with the audit section before the closing brace,
+ * then the section manifest; allocated from probe_arena() */
+static char *render_json(const fingerprint_t *fp, const audit_summary_t *audit) {
+    char *json = fingerprint_to_json(fp);
+    if (!json) {
+        fprintf(stderr, "Error: Failed to serialize fingerprint to JSON\n");
+        return NULL;
+    }
+    
+    char *last_brace = strrchr(json, '}');
+    if (audit && audit->enabled && last_brace && last_brace > json) {
+        char audit_json[32768];
+        audit_to_json(audit, audit_json, sizeof(audit_json));
+        
+        size_t total = (size_t)(last_brace - json) + strlen(audit_json) + 5;
+        char *combined = arena_alloc(probe_arena(), total);
+        if (combined) {
+            *last_brace = '\0';
+            snprintf(combined, total, "%s,\n%s\n}\n", json, audit_json);
+            json = combined;
+        }
+    }
+    
+    return json_add_section_digests(json, g_known_digests);
+}
+
+static int print_json(const fingerprint_t *fp, const audit_summary_t *audit) {
+    char *json = render_json(fp, audit);
+    if (!json) return -1;
+    fputs(json, stdout);
+    return 0;
+}
+
+/* Probe everything asked for into fp. Returns the audit summary (in
+ * probe_arena()), or NULL without audit_mode. */
+static audit_summary_t *probe_cycle(fingerprint_t *fp, const char **configs, int config_count,
+                                    int network_mode, int audit_mode) {
+    int result = capture_fingerprint(fp, configs, config_count);
     
     if (result != 0) {
-        fprintf(stderr, "Warning: Some probes failed (errors: %d)\n", fp.probe_errors);
+        fprintf(stderr, "Warning: Some probes failed (errors: %d)\n", fp->probe_errors);
     }
     
-    /* Probe network if requested */
-    if (network_mode) {
-        probe_network(&fp.network);
+    /* Probe network if requested, or if a rule looks at it */
+    if (network_mode || rules_need_network()) {
+        capture_network(fp);
     }
     
     /* Probe audit if requested */
     audit_summary_t *audit = NULL;
     if (audit_mode) {
         audit = probe_audit(300);  /* Last 5 minutes */
-        g_audit_summary = audit;
         
         /* Auto-update baseline on each probe */
         if (audit && audit->enabled) {
@@ -201,155 +264,227 @@ static int run_analysis(const char **configs, int config_count,
         }
     }
     
-    /* Always do quick analysis for exit code calculation */
-    quick_analysis_t analysis;
-    analyze_fingerprint_quick(&fp, &analysis);
+    /* Rules see the whole cycle */
+    rules_evaluate(fp);
     
-    if (json_mode) {
-        /* Full JSON output */
-        char *json = fingerprint_to_json(&fp);
-        if (!json) {
-            fprintf(stderr, "Error: Failed to serialize fingerprint to JSON\n");
-            if (audit) free_audit_summary(audit);
-            return EXIT_ERROR;
-        }
-        
-        /* If audit mode, we need to inject audit JSON before the closing brace */
-        if (audit && audit->enabled) {
-            /* Find the last closing brace */
-            char *last_brace = strrchr(json, '}');
-            if (last_brace && last_brace > json) {
-                /* Build combined output */
-                char audit_json[16384];
-                audit_to_json(audit, audit_json, sizeof(audit_json));
-                
-                /* Print everything before the last }, then audit, then } */
-                *last_brace = '\0';
-                printf("%s,\n%s\n}\n", json, audit_json);
-            } else {
-                printf("%s", json);
-            }
-        } else {
-            printf("%s", json);
+    return audit;
+}
+
+static void print_quick(const fingerprint_t *fp, const quick_analysis_t *analysis,
+                        const audit_summary_t *audit, int network_mode, int audit_mode) {
+    printf("%sC-Sentinel Quick Analysis%s\n", col_header(), col_reset());
+    printf("========================\n");
+    printf("Hostname: %s%s%s\n", col_info(), fp->system.hostname, col_reset());
+    printf("Uptime: %.1f days\n", fp->system.uptime_seconds / 86400.0);
+    printf("Load: %.2f %.2f %.2f\n", 
+           fp->system.load_avg[0], fp->system.load_avg[1], fp->system.load_avg[2]);
+    if (fp->cpu.available) {
+        printf("CPU: %.1f%% busy across %d cores (iowait %.1f%%, steal %.1f%%)\n",
+               fp->cpu.total.busy_pct, fp->cpu.cpu_count,
+               fp->cpu.total.iowait_pct, fp->cpu.total.steal_pct);
+    }
+    
+    double mem_pct = 100.0 * (1.0 - (double)fp->system.free_ram / fp->system.total_ram);
+    printf("Memory: %s%.1f%%%s used\n", 
+           mem_pct > 90 ? col_error() : mem_pct > 75 ? col_warn() : col_ok(),
+           mem_pct, col_reset());
+    printf("Processes: %d total\n", fp->process_total);
+    if (fp->sampling.enabled) {
+        printf("  (sampled %d + %d notable, slice %d of %d; zombies ~%.0f [%.0f-%.0f])\n",
+               fp->sampling.sampled, fp->sampling.carried,
+               fp->sampling.stratum + 1, fp->sampling.cycles,
+               fp->sampling.zombies.estimate, fp->sampling.zombies.low,
+               fp->sampling.zombies.high);
+    }
+    
+    printf("\n%sPotential Issues:%s\n", col_header(), col_reset());
+    printf("  Zombie processes: %s%d%s%s\n", 
+           analysis->zombie_process_count > 0 ? col_error() : col_ok(),
+           analysis->zombie_process_count, col_reset(),
+           analysis->zombie_process_count > 0 ? " ⚠" : "");
+    if (fp->zombies.count > 0 && fp->zombies.parents[0].zombies > 0) {
+        const zombie_parent_t *zp = &fp->zombies.parents[0];
+        printf("    %d parent(s); most from %s[%d]: %d, oldest %.0fs\n",
+               fp->zombies.parent_count, fp_str(fp, zp->name), zp->ppid,
+               zp->zombies, zp->oldest_seconds);
+    }
+    printf("  High FD processes: %s%d%s%s\n", 
+           analysis->high_fd_process_count > 5 ? col_warn() : col_ok(),
+           analysis->high_fd_process_count, col_reset(),
+           analysis->high_fd_process_count > 5 ? " ⚠" : "");
+    printf("  Long-running (>7d): %d\n", analysis->long_running_process_count);
+    printf("  High memory (>1GB): %d\n", analysis->high_memory_process_count);
+    if (analysis->leak_suspects > 0) {
+        const leak_suspect_t *s = &fp->leaks.suspects[0];
+        printf("  Leak suspects: %s%d%s (%s %s growing %.1f%s/h",
+               col_warn(), analysis->leak_suspects, col_reset(),
+               fp_str(fp, s->name), s->resource == LEAK_FDS ? "fds" : "RSS",
+               s->resource == LEAK_FDS ? s->slope_per_hour
+                                       : s->slope_per_hour / (1024.0 * 1024.0),
+               s->resource == LEAK_FDS ? "" : " MB");
+        if (s->seconds_to_limit >= 3600) {
+            printf(", limit in %.1fh", s->seconds_to_limit / 3600.0);
+        } else if (s->seconds_to_limit >= 0) {
+            printf(", limit in %.0fm", s->seconds_to_limit / 60.0);
         }
-        free(json);
-    } else if (quick_mode) {
-        /* Quick analysis only */
-        printf("%sC-Sentinel Quick Analysis%s\n", col_header(), col_reset());
-        printf("========================\n");
-        printf("Hostname: %s%s%s\n", col_info(), fp.system.hostname, col_reset());
-        printf("Uptime: %.1f days\n", fp.system.uptime_seconds / 86400.0);
-        printf("Load: %.2f %.2f %.2f\n", 
-               fp.system.load_avg[0], fp.system.load_avg[1], fp.system.load_avg[2]);
-        
-        double mem_pct = 100.0 * (1.0 - (double)fp.system.free_ram / fp.system.total_ram);
-        printf("Memory: %s%.1f%%%s used\n", 
-               mem_pct > 90 ? col_error() : mem_pct > 75 ? col_warn() : col_ok(),
-               mem_pct, col_reset());
-        printf("Processes: %d total\n", fp.process_count);
-        
-        printf("\n%sPotential Issues:%s\n", col_header(), col_reset());
-        printf("  Zombie processes: %s%d%s%s\n", 
-               analysis.zombie_process_count > 0 ? col_error() : col_ok(),
-               analysis.zombie_process_count, col_reset(),
-               analysis.zombie_process_count > 0 ? " ⚠" : "");
-        printf("  High FD processes: %s%d%s%s\n", 
-               analysis.high_fd_process_count > 5 ? col_warn() : col_ok(),
-               analysis.high_fd_process_count, col_reset(),
-               analysis.high_fd_process_count > 5 ? " ⚠" : "");
-        printf("  Long-running (>7d): %d\n", analysis.long_running_process_count);
-        printf("  Config permission issues: %s%d%s%s\n", 
-               analysis.config_permission_issues > 0 ? col_error() : col_ok(),
-               analysis.config_permission_issues, col_reset(),
-               analysis.config_permission_issues > 0 ? " ⚠" : "");
-        
-        if (network_mode) {
-            printf("\n%sNetwork:%s\n", col_header(), col_reset());
-            printf("  Listening ports: %d\n", fp.network.total_listening);
-            printf("  Established connections: %d\n", fp.network.total_established);
-            printf("  Unusual ports: %s%d%s%s\n", 
-                   analysis.unusual_listeners > 0 ? col_warn() : col_ok(),
-                   analysis.unusual_listeners, col_reset(),
-                   analysis.unusual_listeners > 0 ? " ⚠" : "");
-            
-            /* Show listeners if any */
-            if (fp.network.listener_count > 0) {
-                printf("\n  Listeners:\n");
-                for (int i = 0; i < fp.network.listener_count && i < 10; i++) {
-                    net_listener_t *l = &fp.network.listeners[i];
-                    printf("    %s%s:%d%s (%s) - %s\n", 
-                           col_dim(), l->local_addr, l->local_port, col_reset(),
-                           l->protocol, l->process_name);
-                }
-                if (fp.network.listener_count > 10) {
-                    printf("    %s... and %d more%s\n", col_dim(), fp.network.listener_count - 10, col_reset());
-                }
-            }
+        printf(") ⚠\n");
+    }
+    if (analysis->imbalanced_cpus > 0 || analysis->softirq_hot_cpus > 0) {
+        printf("  Saturated cores: %s%d%s (cpu%d at %.0f%%, %d softirq-bound) ⚠\n",
+               col_warn(), analysis->imbalanced_cpus, col_reset(),
+               analysis->hottest_cpu, analysis->hottest_cpu_busy,
+               analysis->softirq_hot_cpus);
+    }
+    if (analysis->deleted_open_files > 0) {
+        printf("  Deleted files held open: %s%d (%.1f MB)%s\n", col_warn(),
+               analysis->deleted_open_files,
+               analysis->deleted_open_bytes / (1024.0 * 1024.0), col_reset());
+    }
+    printf("  Config permission issues: %s%d%s%s\n", 
+           analysis->config_permission_issues > 0 ? col_error() : col_ok(),
+           analysis->config_permission_issues, col_reset(),
+           analysis->config_permission_issues > 0 ? " ⚠" : "");
+    if (fp->rules.loaded > 0) {
+        printf("  Rule hits: %s%d%s of %d rules (%.0f us)\n",
+               fp->rules.critical > 0 ? col_error() : fp->rules.count > 0 ? col_warn() : col_ok(),
+               fp->rules.count, col_reset(), fp->rules.loaded, fp->rules.eval_us);
+        for (int i = 0; i < fp->rules.count; i++) {
+            const rule_hit_t *h = &fp->rules.hits[i];
+            printf("    [%s] %s: %s%s%s\n", rule_severity_name(h->severity), h->name,
+                   col_dim(), h->text, col_reset());
         }
-        
-        /* Audit summary */
-        if (audit_mode) {
-            print_audit_summary_quick(audit);
+    }
+    
+    if (network_mode) {
+        printf("\n%sNetwork:%s\n", col_header(), col_reset());
+        printf("  Listening ports: %d\n", fp->network.total_listening);
+        printf("  Established connections: %d\n", fp->network.total_established);
+        printf("  Unusual ports: %s%d%s%s\n", 
+               analysis->unusual_listeners > 0 ? col_warn() : col_ok(),
+               analysis->unusual_listeners, col_reset(),
+               analysis->unusual_listeners > 0 ? " ⚠" : "");
+        printf("  UNIX sockets: %d (%d listening)\n",
+               fp->network.unix_socket_total, fp->network.unix_listener_count);
+        if (fp->network.sockmem.tcp_mem_max > 0) {
+            const socket_mem_t *sm = &fp->network.sockmem;
+            printf("  TCP memory: %s%lu / %lu pages%s%s\n",
+                   sm->tcp_mem_under_pressure ? col_error() : col_ok(),
+                   (unsigned long)sm->tcp_mem_pages, (unsigned long)sm->tcp_mem_max,
+                   col_reset(), sm->tcp_mem_under_pressure ? " (under pressure) ⚠" : "");
         }
-    } else {
-        /* Full JSON output (default) */
-        char *json = fingerprint_to_json(&fp);
-        if (!json) {
-            fprintf(stderr, "Error: Failed to serialize fingerprint to JSON\n");
-            if (audit) free_audit_summary(audit);
-            return EXIT_ERROR;
+        if (fp->tcp_health.has_delta) {
+            const tcp_health_t *th = &fp->tcp_health;
+            int bad = th->retrans_percent > 2.0;
+            printf("  TCP retransmits: %s%.2f%%%s over %.0fs (%llu listen overflows, %llu timeouts)%s\n",
+                   bad ? col_warn() : col_ok(), th->retrans_percent, col_reset(),
+                   th->interval_seconds,
+                   (unsigned long long)th->deltas[TCP_CTR_LISTEN_OVERFLOWS],
+                   (unsigned long long)th->deltas[TCP_CTR_TIMEOUTS],
+                   bad ? " ⚠" : "");
         }
         
-        /* Same audit injection logic */
-        if (audit && audit->enabled) {
-            char *last_brace = strrchr(json, '}');
-            if (last_brace && last_brace > json) {
-                char audit_json[16384];
-                audit_to_json(audit, audit_json, sizeof(audit_json));
-                *last_brace = '\0';
-                printf("%s,\n%s\n}\n", json, audit_json);
-            } else {
-                printf("%s", json);
+        /* Show listeners if any */
+        if (fp->network.listener_count > 0) {
+            printf("\n  Listeners:\n");
+            for (int i = 0; i < fp->network.listener_count && i < 10; i++) {
+                const net_listener_t *l = &fp->network.listeners[i];
+                printf("    %s%s:%d%s (%s) - %s\n", 
+                       col_dim(), fp_str(fp, l->local_addr), l->local_port, col_reset(),
+                       l->protocol, fp_str(fp, l->process_name));
+            }
+            if (fp->network.listener_count > 10) {
+                printf("    %s... and %d more%s\n", col_dim(), fp->network.listener_count - 10, col_reset());
             }
-        } else {
-            printf("%s", json);
         }
-        free(json);
     }
     
-    /* Calculate exit code based on issues */
-    int exit_code = EXIT_OK;
+    if (fp->pipeline.active) {
+        const pipeline_stats_t *ps = &fp->pipeline;
+        printf("\n%sPipeline:%s queued %d/%d/%d (max %d/%d/%d), lag %.0f ms, %lu of %lu probes skipped\n",
+               col_header(), col_reset(),
+               ps->queued[0], ps->queued[1], ps->queued[2],
+               ps->queued_max[0], ps->queued_max[1], ps->queued_max[2],
+               ps->lag_ms, ps->dropped, ps->cycles);
+    }
     
-    if (analysis.zombie_process_count > 0 || 
-        analysis.config_permission_issues > 0 ||
-        analysis.unusual_listeners > 3) {
-        exit_code = EXIT_CRITICAL;
-    } else if (analysis.high_fd_process_count > 5 ||
-               analysis.unusual_listeners > 0) {
-        exit_code = EXIT_WARNINGS;
+    /* Audit summary */
+    if (audit_mode) {
+        print_audit_summary_quick(audit);
     }
+}
+
+static int run_analysis(const char **configs, int config_count, 
+                        int quick_mode, int json_mode, int network_mode, int audit_mode) {
+    fingerprint_t fp;
+    audit_summary_t *audit = probe_cycle(&fp, configs, config_count, network_mode, audit_mode);
     
-    /* Audit can also trigger critical */
-    if (audit && audit->enabled) {
-        if (audit->risk_score >= 16) {  /* high or critical */
-            exit_code = EXIT_CRITICAL;
-        } else if (audit->risk_score >= 6 && exit_code < EXIT_WARNINGS) {
-            exit_code = EXIT_WARNINGS;
-        }
+    /* Always do quick analysis for exit code calculation */
+    quick_analysis_t analysis;
+    analyze_fingerprint_quick(&fp, &analysis);
+    
+    if (quick_mode && !json_mode) {
+        print_quick(&fp, &analysis, audit, network_mode, audit_mode);
+    } else {
+        /* Full JSON output (default) */
+        if (print_json(&fp, audit) != 0) return EXIT_ERROR;
     }
     
+    /* Calculate exit code based on issues */
+    return analysis_exit_code(&fp, &analysis,
+                              audit && audit->enabled ? audit->risk_score : -1);
+}
+
+/* Watch mode: the pipeline stages' side of run_analysis() */
+typedef struct {
+    const char **configs;
+    int config_count;
+    int json_mode;
+    int network_mode;
+    int audit_mode;
+} watch_ctx_t;
+
+static void watch_probe(snapshot_t *s, void *ctx) {
+    const watch_ctx_t *w = ctx;
+    audit_summary_t *audit = probe_cycle(&s->fp, w->configs, w->config_count,
+                                         w->network_mode, w->audit_mode);
     if (audit) {
-        free_audit_summary(audit);
-        g_audit_summary = NULL;
+        s->audit = *audit;
+        s->have_audit = 1;
+    }
+}
+
+static void watch_serialize(snapshot_t *s, void *ctx) {
+    const watch_ctx_t *w = ctx;
+    if (w->json_mode) {
+        s->output = render_json(&s->fp, s->have_audit ? &s->audit : NULL);
+    }
+}
+
+static void watch_emit(const snapshot_t *s, void *ctx) {
+    const watch_ctx_t *w = ctx;
+    
+    print_timestamp(s->fp.system.probe_time);
+    if (s->output) {
+        fputs(s->output, stdout);
+    } else if (!w->json_mode) {
+        print_quick(&s->fp, &s->analysis, s->have_audit ? &s->audit : NULL,
+                    w->network_mode, w->audit_mode);
     }
     
-    return exit_code;
+    if (s->exit_code == EXIT_CRITICAL) {
+        printf(" [CRITICAL]\n");
+    } else if (s->exit_code == EXIT_WARNINGS) {
+        printf(" [WARNINGS]\n");
+    } else {
+        printf(" [OK]\n");
+    }
 }
 
 int main(int argc, char *argv[]) {
     int quick_mode = 0;
     int json_mode = 0;
     int watch_mode = 0;
+    int keep_state = 0;
     int network_mode = 0;
     int audit_mode = 0;
     int audit_learn = 0;
@@ -359,6 +494,13 @@ int main(int argc, char *argv[]) {
     int init_config = 0;
     int interval = 60;
     int force_color = 0;  /* 0=auto, 1=force on, -1=force off */
+    int bench_procfs = 0;
+    const char *compliance_framework = NULL;
+    const char *rules_path = NULL;
+    const char *audit_since = NULL;
+    const char *audit_until = NULL;
+    const char *audit_dir = AUDIT_LOG_DIR;
+    int list_plugins = 0;
     int opt;
     
     static struct option long_options[] = {
@@ -379,10 +521,25 @@ int main(int argc, char *argv[]) {
         {"colour",      no_argument,       0, 'K'},
         {"no-color",    no_argument,       0, 'N'},
         {"no-colour",   no_argument,       0, 'N'},
+        {"probe-timeout", required_argument, 0, 'T'},
+        {"sample", required_argument, 0, 'S'},
+        {"top", required_argument, 0, 'o'},
+        {"procfs-sync", no_argument, 0, 'Y'},
+        {"bench-procfs", no_argument, 0, 'B'},
+        {"compliance", required_argument, 0, 'F'},
+        {"rules", required_argument, 0, 'R'},
+        {"plugin", required_argument, 0, 'P'},
+        {"record", required_argument, 0, 'E'},
+        {"replay", required_argument, 0, 'U'},
+        {"known-digests", required_argument, 0, 'D'},
+        {"since", required_argument, 0, 'G'},
+        {"until", required_argument, 0, 'H'},
+        {"audit-dir", required_argument, 0, 'L'},
+        {"keep-state", no_argument, 0, 'k'},
         {0, 0, 0, 0}
     };
     
-    while ((opt = getopt_long(argc, argv, "hqvjwi:nablcCAKN", long_options, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "hqvjwi:nablcCAKNT:S:o:YBF:R:P:E:U:D:G:H:L:k", long_options, NULL)) != -1) {
         switch (opt) {
             case 'h':
                 print_usage(argv[0]);
@@ -431,6 +588,78 @@ int main(int argc, char *argv[]) {
             case 'N':
                 force_color = -1;
                 break;
+            case 'T':
+                watchdog_set_deadlines(atoi(optarg), 0);
+                break;
+            case 'S':
+                process_sampling_set(atoi(optarg));
+                break;
+            case 'o':
+                process_topk_set(atoi(optarg));
+                break;
+            case 'Y':
+                procfs_set_backend(PROCFS_BACKEND_SYNC);
+                break;
+            case 'B':
+                bench_procfs = 1;
+                break;
+            case 'F':
+                compliance_framework = optarg;
+                break;
+            case 'R':
+                rules_path = optarg;
+                break;
+            case 'P':
+                if (strcmp(optarg, "list") == 0) {
+                    list_plugins = 1;
+                } else {
+                    char err[256];
+                    if (plugin_load(optarg, err, sizeof(err)) != 0) {
+                        fprintf(stderr, "Error: plugin %s\n", err);
+                        return EXIT_ERROR;
+                    }
+                }
+                break;
+            case 'E':
+            case 'U': {
+                char err[MAX_PATH_LEN + 64];
+                int rc = opt == 'E' ? pfs_record(optarg, err, sizeof(err))
+                                    : pfs_replay(optarg, err, sizeof(err));
+                if (rc != 0) {
+                    fprintf(stderr, "Error: %s\n", err);
+                    return EXIT_ERROR;
+                }
+                atexit(pfs_close);
+                break;
+            }
+            case 'D': {
+                /* No file yet just means nothing is known */
+                FILE *f = fopen(optarg, "r");
+                if (f) {
+                    long size = fseek(f, 0, SEEK_END) == 0 ? ftell(f) : -1;
+                    rewind(f);
+                    free(g_known_digests);
+                    g_known_digests = size >= 0 ? calloc(1, (size_t)size + 1) : NULL;
+                    if (g_known_digests &&
+                        fread(g_known_digests, 1, (size_t)size, f) != (size_t)size) {
+                        g_known_digests[0] = '\0';
+                    }
+                    fclose(f);
+                }
+                break;
+            }
+            case 'G':
+                audit_since = optarg;
+                break;
+            case 'H':
+                audit_until = optarg;
+                break;
+            case 'L':
+                audit_dir = optarg;
+                break;
+            case 'k':
+                keep_state = 1;
+                break;
             default:
                 print_usage(argv[0]);
                 return EXIT_ERROR;
@@ -440,6 +669,24 @@ int main(int argc, char *argv[]) {
     /* Initialize colour output */
     color_init(force_color);
     
+    /* History across runs: watch mode, time queries (the index is the
+     * point of them), --learn/--baseline (TCP event rates are deltas
+     * against the previous run's counters), or when asked for */
+    probe_state_keep(keep_state || watch_mode || learn_mode || baseline_mode ||
+                     audit_since || audit_until);
+    
+    /* Probe plugin modules installed for this user */
+    {
+        char plugin_dir[512];
+        baseline_state_lookup("plugins", plugin_dir, sizeof(plugin_dir));
+        plugin_load_dir(plugin_dir);
+        atexit(plugins_teardown);
+    }
+    if (list_plugins) {
+        plugins_list(stdout);
+        return EXIT_OK;
+    }
+    
     /* Handle --init-config */
     if (init_config) {
         if (config_create_default() == 0) {
@@ -457,13 +704,17 @@ int main(int argc, char *argv[]) {
         return EXIT_OK;
     }
     
+    /* Handle --bench-procfs */
+    if (bench_procfs) {
+        return procfs_benchmark(20) == 0 ? EXIT_OK : EXIT_ERROR;
+    }
+    
     /* Handle --audit-learn */
     if (audit_learn) {
         printf("Learning audit baseline...\n");
         audit_summary_t *audit = probe_audit(300);
         if (!audit || !audit->enabled) {
             fprintf(stderr, "Auditd not available. Install and configure auditd first.\n");
-            if (audit) free_audit_summary(audit);
             return EXIT_ERROR;
         }
         
@@ -477,15 +728,37 @@ int main(int argc, char *argv[]) {
             printf("  Avg auth failures: %.2f\n", baseline.avg_auth_failures);
             printf("  Avg sudo commands: %.2f\n", baseline.avg_sudo_count);
             printf("  Avg sensitive file access: %.2f\n", baseline.avg_sensitive_access);
-            free_audit_summary(audit);
             return EXIT_OK;
         } else {
             fprintf(stderr, "Failed to save audit baseline\n");
-            free_audit_summary(audit);
             return EXIT_ERROR;
         }
     }
     
+    /* Handle --since/--until */
+    if (audit_since || audit_until) {
+        time_t since = 0, until = time(NULL);
+        if (audit_since && audit_parse_time(audit_since, &since) != 0) {
+            fprintf(stderr, "Error: bad --since time: %s\n", audit_since);
+            return EXIT_ERROR;
+        }
+        if (audit_until && audit_parse_time(audit_until, &until) != 0) {
+            fprintf(stderr, "Error: bad --until time: %s\n", audit_until);
+            return EXIT_ERROR;
+        }
+        
+        audit_window_stats_t stats;
+        if (audit_window_query(audit_dir, since, until, stdout, &stats) != 0) {
+            fprintf(stderr, "Error: cannot read audit logs in %s\n", audit_dir);
+            return EXIT_ERROR;
+        }
+        fprintf(stderr, "%lu records in window; decoded %lu (%.1f of %.1f MB, %d of %d logs, %lu index entries)\n",
+                stats.records_matched, stats.records_read,
+                stats.bytes_read / (1024.0 * 1024.0), stats.bytes_total / (1024.0 * 1024.0),
+                stats.files_read, stats.files, stats.index_entries);
+        return EXIT_OK;
+    }
+    
     /* Determine config files to probe */
     const char **configs;
     int config_count;
@@ -496,9 +769,9 @@ int main(int argc, char *argv[]) {
         config_count = argc - optind;
     } else {
         /* Use defaults */
-        configs = default_configs;
+        configs = default_config_paths;
         config_count = 0;
-        while (default_configs[config_count]) config_count++;
+        while (default_config_paths[config_count]) config_count++;
     }
     
     /* Handle --learn */
@@ -506,7 +779,7 @@ int main(int argc, char *argv[]) {
         fingerprint_t fp;
         capture_fingerprint(&fp, configs, config_count);
         if (network_mode) {
-            probe_network(&fp.network);
+            capture_network(&fp);
         }
         
         /* Load existing baseline or create new */
@@ -523,6 +796,9 @@ int main(int argc, char *argv[]) {
         
         if (baseline_save(&baseline) == 0) {
             printf("Baseline saved to ~/.sentinel/baseline.dat\n");
+            if (!fp.tcp_health.has_delta) {
+                printf("TCP counters saved; event rates are learned from the next --learn run\n");
+            }
             baseline_print_info(&baseline);
             return EXIT_OK;
         } else {
@@ -543,7 +819,7 @@ int main(int argc, char *argv[]) {
         fingerprint_t fp;
         capture_fingerprint(&fp, configs, config_count);
         if (network_mode) {
-            probe_network(&fp.network);
+            capture_network(&fp);
         }
         
         /* Run quick analysis */
@@ -557,7 +833,19 @@ int main(int argc, char *argv[]) {
         printf("Uptime: %.1f days\n", fp.system.uptime_seconds / 86400.0);
         printf("Load: %.2f %.2f %.2f\n", 
                fp.system.load_avg[0], fp.system.load_avg[1], fp.system.load_avg[2]);
-        printf("Processes: %d total\n", fp.process_count);
+        if (fp.cpu.available) {
+            printf("CPU: %.1f%% busy across %d cores (iowait %.1f%%, steal %.1f%%)\n",
+                   fp.cpu.total.busy_pct, fp.cpu.cpu_count,
+                   fp.cpu.total.iowait_pct, fp.cpu.total.steal_pct);
+        }
+        printf("Processes: %d total\n", fp.process_total);
+        if (fp.sampling.enabled) {
+            printf("  (sampled %d + %d notable, slice %d of %d; zombies ~%.0f [%.0f-%.0f])\n",
+                   fp.sampling.sampled, fp.sampling.carried,
+                   fp.sampling.stratum + 1, fp.sampling.cycles,
+                   fp.sampling.zombies.estimate, fp.sampling.zombies.low,
+                   fp.sampling.zombies.high);
+        }
         
         /* Compare against baseline */
         deviation_report_t report;
@@ -569,7 +857,6 @@ int main(int argc, char *argv[]) {
         if (audit_mode) {
             audit_summary_t *audit = probe_audit(300);
             print_audit_summary_quick(audit);
-            if (audit) free_audit_summary(audit);
         }
         
         if (deviations > 0) {
@@ -578,6 +865,69 @@ int main(int argc, char *argv[]) {
         return EXIT_OK;
     }
     
+    /* Handle --compliance */
+    if (compliance_framework) {
+        if (!compliance_find_framework(compliance_framework)) {
+            if (strcmp(compliance_framework, "list") != 0) {
+                fprintf(stderr, "Unknown framework: %s\n", compliance_framework);
+            }
+            compliance_list_frameworks(stderr);
+            return strcmp(compliance_framework, "list") == 0 ? EXIT_OK : EXIT_ERROR;
+        }
+        
+        /* Every probe a check reads: network and audit always, the
+         * baseline when one has been learned */
+        fingerprint_t fp;
+        capture_fingerprint(&fp, configs, config_count);
+        capture_network(&fp);
+        audit_summary_t *audit = probe_audit(300);
+        
+        quick_analysis_t analysis;
+        analyze_fingerprint_quick(&fp, &analysis);
+        
+        static baseline_t baseline;
+        deviation_report_t deviations;
+        int have_baseline = baseline_load(&baseline) == 0;
+        if (have_baseline) {
+            baseline_compare(&baseline, &fp, &deviations);
+        }
+        
+        compliance_facts_t facts = {
+            .fp = &fp,
+            .analysis = &analysis,
+            .audit = audit,
+            .deviations = have_baseline ? &deviations : NULL,
+            .network_probed = 1,
+        };
+        compliance_report_t report;
+        compliance_evaluate(compliance_framework, &facts, &report);
+        
+        if (json_mode) {
+            compliance_print_json(&report, stdout);
+        } else {
+            compliance_print_report(&report, quick_mode == 0);
+        }
+        return report.failed > 0 ? EXIT_CRITICAL : EXIT_OK;
+    }
+    
+    /* Detection rules: --rules FILE must load; the default file is
+     * optional, but a broken one is still an error */
+    {
+        char default_rules[512];
+        const char *path = rules_path;
+        if (!path) {
+            baseline_state_lookup("rules", default_rules, sizeof(default_rules));
+            if (access(default_rules, R_OK) == 0) path = default_rules;
+        }
+        if (path) {
+            char err[512];
+            if (rules_load(path, err, sizeof(err)) < 0) {
+                fprintf(stderr, "Error: %s\n", err);
+                return EXIT_ERROR;
+            }
+        }
+    }
+    
     /* Watch mode - continuous monitoring */
     if (watch_mode) {
         /* Setup signal handler for clean shutdown */
@@ -591,29 +941,14 @@ int main(int argc, char *argv[]) {
         }
         fprintf(stderr, "\n");
         
-        int worst_exit = EXIT_OK;
-        
-        while (keep_running) {
-            print_timestamp();
-            int exit_code = run_analysis(configs, config_count, 
-                                         quick_mode || 1, json_mode, network_mode, audit_mode);
-            
-            if (exit_code > worst_exit) worst_exit = exit_code;
-            
-            if (exit_code == EXIT_CRITICAL) {
-                printf(" [CRITICAL]\n");
-            } else if (exit_code == EXIT_WARNINGS) {
-                printf(" [WARNINGS]\n");
-            } else {
-                printf(" [OK]\n");
-            }
-            
-            if (keep_running) {
-                sleep(interval);
-            }
-        }
+        watch_ctx_t ctx = {
+            configs, config_count, json_mode, network_mode, audit_mode
+        };
+        pipeline_t p = {
+            interval, watch_probe, watch_serialize, watch_emit, &ctx
+        };
         
-        return worst_exit;
+        return pipeline_run(&p, &keep_running);
     }
     
     /* One-shot mode */
@@ -14,8 +14,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <dirent.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <stdint.h>
 #include <arpa/inet.h>
 
 #include "sentinel.h"
@@ -68,69 +69,167 @@ static void hex_to_ip(const char *hex, char *ip, size_t ip_len, int is_ipv6) {
     }
 }
 
-/* Get process name from pid */
-static void get_process_name(pid_t pid, char *name, size_t name_len) {
+/* Interned process name for a socket owner; "[kernel]" without one */
+static str_id_t owner_name(pid_t pid) {
+    strtab_t *strings = strtab_snapshot();
+    if (pid <= 0) return strtab_intern(strings, "[kernel]");
+    
     char path[64];
-    FILE *f;
+    char name[256];
     
     snprintf(path, sizeof(path), "/proc/%d/comm", pid);
-    f = fopen(path, "r");
-    if (f) {
-        if (fgets(name, name_len, f)) {
-            /* Remove trailing newline */
-            char *nl = strchr(name, '\n');
-            if (nl) *nl = '\0';
-        }
-        fclose(f);
-    } else {
-        snprintf(name, name_len, "[unknown]");
+    FILE *f = pfs_fopen(path);
+    if (!f) return strtab_intern(strings, "[unknown]");
+    
+    str_id_t id = STR_EMPTY;
+    if (fgets(name, sizeof(name), f)) {
+        /* Remove trailing newline */
+        name[strcspn(name, "\n")] = '\0';
+        id = strtab_intern(strings, name);
     }
+    fclose(f);
+    return id;
 }
 
-/* Find PID for a given inode from /proc/[pid]/fd/ */
-static pid_t find_pid_for_inode(unsigned long inode) {
-    DIR *proc_dir;
-    struct dirent *proc_entry;
-    char path[512], link_target[512];
-    char inode_str[64];
-    
-    snprintf(inode_str, sizeof(inode_str), "socket:[%lu]", inode);
-    
-    proc_dir = opendir("/proc");
-    if (!proc_dir) return 0;
+/* Interned dotted/colon form of a /proc/net address */
+static str_id_t intern_ip(const char *hex, int is_ipv6) {
+    char ip[INET6_ADDRSTRLEN];
+    hex_to_ip(hex, ip, sizeof(ip), is_ipv6);
+    return strtab_intern(strtab_snapshot(), ip);
+}
+
+/* ============================================================
+ * Socket Inode Index
+ * ============================================================
+ * Resolving a socket to its owner means finding "socket:[inode]" among
+ * every process's fds. Doing that per socket is O(sockets x fds), so we
+ * walk /proc/[pid]/fd once per probe and index every socket inode seen.
+ * TCP, UDP and UNIX sockets are all attributed through the same index.
+ */
+
+/* Open-addressing hash map, uint64 key -> int value, key 0 = empty */
+typedef struct {
+    uint64_t *keys;
+    int *values;
+    size_t capacity;            /* Power of two */
+    size_t count;
+} u64_map_t;
+
+#define MAP_INITIAL_CAPACITY 1024
+
+static size_t map_hash(uint64_t k) {
+    /* murmur3 finalizer - inodes are sequential, so mix them well */
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    return (size_t)k;
+}
+
+/* Storage comes from the probe arena and goes back with the cycle */
+static int map_init(u64_map_t *m, size_t capacity) {
+    m->keys = arena_calloc(probe_arena(), capacity, sizeof(uint64_t));
+    m->values = arena_calloc(probe_arena(), capacity, sizeof(int));
+    m->capacity = capacity;
+    m->count = 0;
+    if (!m->keys || !m->values) {
+        m->keys = NULL;
+        m->values = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+static void map_free(u64_map_t *m) {
+    memset(m, 0, sizeof(*m));
+}
+
+/* Find the slot for key; with create, insert it (value 0) if missing */
+static int *map_slot(u64_map_t *m, uint64_t key, int create) {
+    if (!m->keys || key == 0) return NULL;
     
-    while ((proc_entry = readdir(proc_dir)) != NULL) {
-        /* Only look at numeric directories (PIDs) */
-        if (proc_entry->d_name[0] < '0' || proc_entry->d_name[0] > '9')
-            continue;
-            
-        pid_t pid = atoi(proc_entry->d_name);
-        char fd_path[128];
-        DIR *fd_dir;
-        struct dirent *fd_entry;
-        
-        snprintf(fd_path, sizeof(fd_path), "/proc/%d/fd", pid);
-        fd_dir = opendir(fd_path);
-        if (!fd_dir) continue;
-        
-        while ((fd_entry = readdir(fd_dir)) != NULL) {
-            snprintf(path, sizeof(path), "%s/%s", fd_path, fd_entry->d_name);
-            ssize_t len = readlink(path, link_target, sizeof(link_target) - 1);
-            if (len > 0) {
-                link_target[len] = '\0';
-                if (strcmp(link_target, inode_str) == 0) {
-                    closedir(fd_dir);
-                    closedir(proc_dir);
-                    return pid;
-                }
+    if (create && (m->count + 1) * 10 > m->capacity * 7) {
+        /* Grow at 70% load */
+        u64_map_t bigger;
+        if (map_init(&bigger, m->capacity * 2) != 0) return NULL;
+        for (size_t i = 0; i < m->capacity; i++) {
+            if (m->keys[i]) {
+                *map_slot(&bigger, m->keys[i], 1) = m->values[i];
             }
         }
-        closedir(fd_dir);
+        map_free(m);
+        *m = bigger;
     }
-    closedir(proc_dir);
+    
+    size_t mask = m->capacity - 1;
+    for (size_t i = map_hash(key) & mask; ; i = (i + 1) & mask) {
+        if (m->keys[i] == key) return &m->values[i];
+        if (m->keys[i] == 0) {
+            if (!create) return NULL;
+            m->keys[i] = key;
+            m->values[i] = 0;
+            m->count++;
+            return &m->values[i];
+        }
+    }
+}
+
+/* Owner of a socket inode, 0 if unknown (kernel socket or raced exit) */
+static pid_t index_lookup(u64_map_t *index, unsigned long inode) {
+    int *pid = map_slot(index, inode, 0);
+    return pid ? *pid : 0;
+}
+
+/* Index the socket links of one /proc/[pid]/fd directory */
+typedef struct {
+    u64_map_t *index;
+    pid_t pid;
+} fd_index_ctx_t;
+
+static int index_fd_entry(int dirfd, const char *name, unsigned char type, void *arg) {
+    (void)type;
+    fd_index_ctx_t *ctx = arg;
+    char link_target[64];
+    
+    ssize_t len = pfs_readlinkat(dirfd, name, link_target, sizeof(link_target) - 1);
+    if (len <= 8 || strncmp(link_target, "socket:[", 8) != 0) return 0;
+    
+    link_target[len] = '\0';
+    uint64_t inode = strtoull(link_target + 8, NULL, 10);
+    int *owner = map_slot(ctx->index, inode, 1);
+    /* First owner wins - shared sockets are attributed once */
+    if (owner && *owner == 0) *owner = ctx->pid;
+    return 0;
+}
+
+static int index_pid_entry(int procfd, const char *name, unsigned char type, void *arg) {
+    (void)type;
+    /* Only look at numeric directories (PIDs) */
+    int pid = procfs_parse_uint(name);
+    if (pid <= 0) return 0;
+    
+    char fd_path[32];
+    snprintf(fd_path, sizeof(fd_path), "%d/fd", pid);
+    int fd_dir = pfs_opendirat(procfd, fd_path);
+    if (fd_dir < 0) return 0;
+    
+    fd_index_ctx_t ctx = { arg, pid };
+    procfs_walk_dir(fd_dir, index_fd_entry, &ctx);
+    pfs_closedir(fd_dir);
     return 0;
 }
 
+/* Walk every /proc/[pid]/fd once and index socket inodes by owner */
+static int build_inode_index(u64_map_t *index) {
+    if (map_init(index, MAP_INITIAL_CAPACITY) != 0) return -1;
+    
+    int procfd = pfs_opendir("/proc");
+    if (procfd < 0) return -1;
+    
+    int rc = procfs_walk_dir(procfd, index_pid_entry, index);
+    pfs_closedir(procfd);
+    return rc < 0 ? -1 : 0;
+}
+
 /* TCP state names */
 static const char *tcp_state_name(int state) {
     static const char *states[] = {
@@ -152,8 +251,9 @@ static const char *tcp_state_name(int state) {
 }
 
 /* Parse /proc/net/tcp or /proc/net/tcp6 */
-static int parse_tcp_file(const char *filename, network_info_t *net, int is_ipv6) {
-    FILE *f = fopen(filename, "r");
+static int parse_tcp_file(const char *filename, network_info_t *net, int is_ipv6,
+                          u64_map_t *index) {
+    FILE *f = pfs_fopen(filename);
     if (!f) return -1;
     
     char line[512];
@@ -187,17 +287,13 @@ static int parse_tcp_file(const char *filename, network_info_t *net, int is_ipv6
             net_listener_t *l = &net->listeners[net->listener_count];
             
             snprintf(l->protocol, sizeof(l->protocol), is_ipv6 ? "tcp6" : "tcp");
-            hex_to_ip(local_addr_hex, l->local_addr, sizeof(l->local_addr), is_ipv6);
+            l->local_addr = intern_ip(local_addr_hex, is_ipv6);
             l->local_port = local_port;
             snprintf(l->state, sizeof(l->state), "%s", tcp_state_name(state));
             
             /* Find owning process */
-            l->pid = find_pid_for_inode(inode);
-            if (l->pid > 0) {
-                get_process_name(l->pid, l->process_name, sizeof(l->process_name));
-            } else {
-                snprintf(l->process_name, sizeof(l->process_name), "[kernel]");
-            }
+            l->pid = index_lookup(index, inode);
+            l->process_name = owner_name(l->pid);
             
             net->listener_count++;
             net->total_listening++;
@@ -211,18 +307,14 @@ static int parse_tcp_file(const char *filename, network_info_t *net, int is_ipv6
             net_connection_t *c = &net->connections[net->connection_count];
             
             snprintf(c->protocol, sizeof(c->protocol), is_ipv6 ? "tcp6" : "tcp");
-            hex_to_ip(local_addr_hex, c->local_addr, sizeof(c->local_addr), is_ipv6);
+            c->local_addr = intern_ip(local_addr_hex, is_ipv6);
             c->local_port = local_port;
-            hex_to_ip(remote_addr_hex, c->remote_addr, sizeof(c->remote_addr), is_ipv6);
+            c->remote_addr = intern_ip(remote_addr_hex, is_ipv6);
             c->remote_port = remote_port;
             snprintf(c->state, sizeof(c->state), "%s", tcp_state_name(state));
             
-            c->pid = find_pid_for_inode(inode);
-            if (c->pid > 0) {
-                get_process_name(c->pid, c->process_name, sizeof(c->process_name));
-            } else {
-                snprintf(c->process_name, sizeof(c->process_name), "[kernel]");
-            }
+            c->pid = index_lookup(index, inode);
+            c->process_name = owner_name(c->pid);
             
             net->connection_count++;
             net->total_established++;
@@ -234,8 +326,9 @@ static int parse_tcp_file(const char *filename, network_info_t *net, int is_ipv6
 }
 
 /* Parse /proc/net/udp or /proc/net/udp6 for listening UDP sockets */
-static int parse_udp_file(const char *filename, network_info_t *net, int is_ipv6) {
-    FILE *f = fopen(filename, "r");
+static int parse_udp_file(const char *filename, network_info_t *net, int is_ipv6,
+                          u64_map_t *index) {
+    FILE *f = pfs_fopen(filename);
     if (!f) return -1;
     
     char line[512];
@@ -268,16 +361,12 @@ static int parse_udp_file(const char *filename, network_info_t *net, int is_ipv6
             net_listener_t *l = &net->listeners[net->listener_count];
             
             snprintf(l->protocol, sizeof(l->protocol), is_ipv6 ? "udp6" : "udp");
-            hex_to_ip(local_addr_hex, l->local_addr, sizeof(l->local_addr), is_ipv6);
+            l->local_addr = intern_ip(local_addr_hex, is_ipv6);
             l->local_port = local_port;
             snprintf(l->state, sizeof(l->state), "LISTEN");
             
-            l->pid = find_pid_for_inode(inode);
-            if (l->pid > 0) {
-                get_process_name(l->pid, l->process_name, sizeof(l->process_name));
-            } else {
-                snprintf(l->process_name, sizeof(l->process_name), "[kernel]");
-            }
+            l->pid = index_lookup(index, inode);
+            l->process_name = owner_name(l->pid);
             
             net->listener_count++;
             net->total_listening++;
@@ -292,17 +381,167 @@ static int parse_udp_file(const char *filename, network_info_t *net, int is_ipv6
     return 0;
 }
 
+/* ============================================================
+ * UNIX Domain Sockets
+ * ============================================================ */
+
+#define SO_ACCEPTCON_FLAG 0x00010000    /* __SO_ACCEPTCON: socket is listening */
+
+static const char *unix_type_name(unsigned int type) {
+    switch (type) {
+        case 1: return "stream";
+        case 2: return "dgram";
+        case 5: return "seqpacket";
+        default: return "unknown";
+    }
+}
+
+/* Parse /proc/net/unix: count sockets per owner, record listeners */
+static int parse_unix_file(const char *filename, network_info_t *net, u64_map_t *index) {
+    FILE *f = pfs_fopen(filename);
+    if (!f) return -1;
+    
+    u64_map_t per_pid;
+    if (map_init(&per_pid, 256) != 0) {
+        fclose(f);
+        return -1;
+    }
+    
+    char line[512];
+    /* Skip header */
+    if (!fgets(line, sizeof(line), f)) {
+        map_free(&per_pid);
+        fclose(f);
+        return -1;
+    }
+    
+    while (fgets(line, sizeof(line), f)) {
+        unsigned int flags, type, state;
+        unsigned long inode;
+        int path_off = 0;
+        
+        /* Num: RefCount Protocol Flags Type St Inode [Path] */
+        if (sscanf(line, "%*s %*x %*x %x %x %x %lu %n",
+                   &flags, &type, &state, &inode, &path_off) != 4) continue;
+        
+        net->unix_socket_total++;
+        
+        pid_t pid = index_lookup(index, inode);
+        if (pid > 0) {
+            int *count = map_slot(&per_pid, (uint64_t)pid, 1);
+            if (count) (*count)++;
+        }
+        
+        if (!(flags & SO_ACCEPTCON_FLAG) || net->unix_listener_count >= MAX_UNIX_LISTENERS) {
+            continue;
+        }
+        
+        unix_listener_t *u = &net->unix_listeners[net->unix_listener_count++];
+        char *path = line + path_off;
+        char *nl = strchr(path, '\n');
+        if (nl) *nl = '\0';
+        u->path = strtab_intern(strtab_snapshot(), path[0] ? path : "(unnamed)");
+        snprintf(u->type, sizeof(u->type), "%s", unix_type_name(type));
+        u->pid = pid;
+        u->process_name = owner_name(pid);
+    }
+    fclose(f);
+    
+    /* Keep the heaviest UNIX socket users, largest first */
+    for (size_t i = 0; i < per_pid.capacity; i++) {
+        if (!per_pid.keys[i]) continue;
+        
+        int count = per_pid.values[i];
+        int slot = net->unix_proc_count;
+        while (slot > 0 && net->unix_procs[slot - 1].socket_count < count) slot--;
+        if (slot >= MAX_UNIX_PROCS) continue;
+        
+        int last = net->unix_proc_count < MAX_UNIX_PROCS ? net->unix_proc_count : MAX_UNIX_PROCS - 1;
+        memmove(&net->unix_procs[slot + 1], &net->unix_procs[slot],
+                (size_t)(last - slot) * sizeof(unix_proc_t));
+        if (net->unix_proc_count < MAX_UNIX_PROCS) net->unix_proc_count++;
+        
+        net->unix_procs[slot].pid = (pid_t)per_pid.keys[i];
+        net->unix_procs[slot].socket_count = count;
+    }
+    for (int i = 0; i < net->unix_proc_count; i++) {
+        unix_proc_t *up = &net->unix_procs[i];
+        up->process_name = owner_name(up->pid);
+    }
+    
+    map_free(&per_pid);
+    return 0;
+}
+
+/* ============================================================
+ * Socket Memory
+ * ============================================================ */
+
+/* Parse /proc/net/sockstat and sockstat6, plus the tcp_mem limits */
+static void parse_sockstat(socket_mem_t *sm) {
+    char line[256];
+    FILE *f = pfs_fopen("/proc/net/sockstat");
+    if (f) {
+        while (fgets(line, sizeof(line), f)) {
+            unsigned long mem;
+            if (sscanf(line, "sockets: used %d", &sm->sockets_used) == 1) continue;
+            if (sscanf(line, "TCP: inuse %d orphan %d tw %d alloc %d mem %lu",
+                       &sm->tcp_inuse, &sm->tcp_orphan, &sm->tcp_time_wait,
+                       &sm->tcp_alloc, &mem) == 5) {
+                sm->tcp_mem_pages = mem;
+                continue;
+            }
+            if (sscanf(line, "UDP: inuse %d mem %lu", &sm->udp_inuse, &mem) == 2) {
+                sm->udp_mem_pages = mem;
+            }
+        }
+        fclose(f);
+    }
+    
+    f = pfs_fopen("/proc/net/sockstat6");
+    if (f) {
+        while (fgets(line, sizeof(line), f)) {
+            if (sscanf(line, "TCP6: inuse %d", &sm->tcp6_inuse) == 1) continue;
+            sscanf(line, "UDP6: inuse %d", &sm->udp6_inuse);
+        }
+        fclose(f);
+    }
+    
+    f = pfs_fopen("/proc/sys/net/ipv4/tcp_mem");
+    if (f) {
+        unsigned long lo, pressure, hi;
+        if (fscanf(f, "%lu %lu %lu", &lo, &pressure, &hi) == 3) {
+            sm->tcp_mem_min = lo;
+            sm->tcp_mem_pressure = pressure;
+            sm->tcp_mem_max = hi;
+            sm->tcp_mem_under_pressure = (pressure > 0 && sm->tcp_mem_pages >= pressure);
+        }
+        fclose(f);
+    }
+}
+
 /* Main network probe function */
 int probe_network(network_info_t *net) {
     memset(net, 0, sizeof(network_info_t));
     
+    /* One pass over every process's fds, shared by all socket types */
+    u64_map_t index;
+    build_inode_index(&index);
+    
     /* Probe TCP */
-    parse_tcp_file("/proc/net/tcp", net, 0);
-    parse_tcp_file("/proc/net/tcp6", net, 1);
+    parse_tcp_file("/proc/net/tcp", net, 0, &index);
+    parse_tcp_file("/proc/net/tcp6", net, 1, &index);
     
     /* Probe UDP */
-    parse_udp_file("/proc/net/udp", net, 0);
-    parse_udp_file("/proc/net/udp6", net, 1);
+    parse_udp_file("/proc/net/udp", net, 0, &index);
+    parse_udp_file("/proc/net/udp6", net, 1, &index);
+    
+    /* Probe UNIX domain sockets */
+    parse_unix_file("/proc/net/unix", net, &index);
+    
+    /* Kernel socket memory */
+    parse_sockstat(&net->sockmem);
     
+    map_free(&index);
     return 0;
 }
@@ -0,0 +1,705 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * pfs.c - Recording and replaying what the probes read from /proc
+ *
+ * Probes read /proc through the pfs_* calls below. Live, they are the
+ * plain syscalls. With --record each read (whole files, directory
+ * listings, fd link targets, stats, config checksums) is also appended
+ * to an archive; with --replay the same calls are answered from the
+ * archive instead, so a production host's process and socket tables
+ * can be probed - and the probes timed - on another machine.
+ *
+ * Archive: "SNTLPF01", then one record per read, in the order the
+ * reads happened:
+ *
+ *     u8 kind, u8 errno, u16 path length, u32 data length, path, data
+ *
+ * (native byte order). A path read more than once - the two /proc/stat
+ * samples, every cycle of --watch - has a record per read; replay hands
+ * them out in order and repeats the last once they run out. Config
+ * files are kept as stat fields and a checksum, never their contents.
+ *
+ * Directory fds are real while recording and stand-ins (PFS_VFD_BASE
+ * and up) in replay; a small table maps either to its path so that
+ * dirfd-relative calls have a key.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+
+#include "sentinel.h"
+
+#define PFS_MAGIC       "SNTLPF01"
+#define PFS_DIRS_MAX    256         /* Directory fds open at once, all workers */
+#define PFS_DIR_PATH    128
+#define PFS_VFD_BASE    (1 << 24)   /* Replay dirfds, well clear of real ones */
+#define PFS_FILE_MAX    (64u << 20)
+
+typedef enum {
+    PFS_FILE = 1,               /* Whole file contents */
+    PFS_OPEN,                   /* Directory open (errno only) */
+    PFS_DIR,                    /* Listing: (d_type, name, NUL) per entry */
+    PFS_LINK,                   /* readlink target */
+    PFS_STAT,                   /* pfs_stat_rec_t */
+    PFS_SUM                     /* Config file checksum */
+} pfs_kind_t;
+
+typedef struct {
+    uint8_t kind;
+    uint8_t err;
+    uint16_t path_len;
+    uint32_t data_len;
+} pfs_rec_t;
+
+/* The struct stat fields the probes use */
+typedef struct {
+    uint32_t mode;
+    uint32_t uid;
+    uint32_t gid;
+    uint32_t pad;
+    int64_t size;
+    int64_t mtime;
+    int64_t ctime;
+} pfs_stat_rec_t;
+
+/* A record's header, copied out (records are packed, so unaligned) */
+typedef struct {
+    uint8_t kind;
+    uint8_t err;
+    uint16_t path_len;
+    uint32_t data_len;
+    const char *path;
+    const char *data;
+    uint32_t seq;
+} pfs_entry_t;
+
+/* All records for one (kind, path), in read order */
+typedef struct {
+    const pfs_entry_t *first;
+    uint32_t count;
+    uint32_t next;
+} pfs_group_t;
+
+typedef struct {
+    int fd;                     /* -1 = free */
+    char path[PFS_DIR_PATH];
+} pfs_dir_t;
+
+static pfs_mode_t g_mode = PFS_LIVE;
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static char g_archive[MAX_PATH_LEN];
+static uint64_t g_reads;
+static uint64_t g_bytes;
+static uint64_t g_misses;
+
+/* Record */
+static FILE *g_out;
+
+/* Replay */
+static char *g_image;
+static pfs_entry_t *g_entries;
+static pfs_group_t *g_groups;
+static int g_group_count;
+
+static pfs_dir_t g_dirs[PFS_DIRS_MAX];
+
+pfs_mode_t pfs_mode(void) {
+    return g_mode;
+}
+
+int pfs_active(void) {
+    return g_mode != PFS_LIVE;
+}
+
+/* ============================================================
+ * Directory fd table
+ * ============================================================ */
+
+static void dirs_reset(void) {
+    for (int i = 0; i < PFS_DIRS_MAX; i++) g_dirs[i].fd = -1;
+}
+
+/* Returns the table fd (fd itself, or a stand-in if fd < 0), -1 if full */
+static int dir_add(int fd, const char *path) {
+    if (strlen(path) >= PFS_DIR_PATH) return -1;
+    int got = -1;
+    pthread_mutex_lock(&g_lock);
+    for (int i = 0; i < PFS_DIRS_MAX; i++) {
+        if (g_dirs[i].fd == -1) {
+            g_dirs[i].fd = got = fd >= 0 ? fd : PFS_VFD_BASE + i;
+            strcpy(g_dirs[i].path, path);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_lock);
+    return got;
+}
+
+static void dir_remove(int fd) {
+    pthread_mutex_lock(&g_lock);
+    for (int i = 0; i < PFS_DIRS_MAX; i++) {
+        if (g_dirs[i].fd == fd) {
+            g_dirs[i].fd = -1;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+/* The directory's path, plus "/name" if name is given */
+static int dir_path(int fd, const char *name, char *out, size_t size) {
+    int rc = -1;
+    pthread_mutex_lock(&g_lock);
+    for (int i = 0; i < PFS_DIRS_MAX; i++) {
+        if (g_dirs[i].fd == fd) {
+            int n = name ? snprintf(out, size, "%s/%s", g_dirs[i].path, name)
+                         : snprintf(out, size, "%s", g_dirs[i].path);
+            rc = n >= 0 && (size_t)n < size ? 0 : -1;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_lock);
+    return rc;
+}
+
+/* ============================================================
+ * Record
+ * ============================================================ */
+
+static void put(pfs_kind_t kind, int err, const char *path, const void *data, size_t len) {
+    size_t path_len = strlen(path);
+    if (path_len > 0xffff || len > PFS_FILE_MAX) return;
+
+    pfs_rec_t rec = { (uint8_t)kind, (uint8_t)(err > 0 && err < 256 ? err : (err ? EIO : 0)),
+                      (uint16_t)path_len, (uint32_t)len };
+    pthread_mutex_lock(&g_lock);
+    if (g_out) {
+        fwrite(&rec, sizeof(rec), 1, g_out);
+        fwrite(path, 1, path_len, g_out);
+        if (len) fwrite(data, 1, len, g_out);
+        g_reads++;
+        g_bytes += sizeof(rec) + path_len + len;
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+/* Read all of a file; NULL with errno set on failure */
+static char *slurp(const char *path, size_t *len) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return NULL;
+
+    size_t cap = 4096, used = 0;
+    char *buf = malloc(cap);
+    while (buf) {
+        if (used == cap) {
+            char *p = cap < PFS_FILE_MAX ? realloc(buf, cap * 2) : NULL;
+            if (!p) {
+                free(buf);
+                buf = NULL;
+                errno = EFBIG;
+                break;
+            }
+            buf = p;
+            cap *= 2;
+        }
+        ssize_t n = read(fd, buf + used, cap - used);
+        if (n < 0) {
+            int e = errno;
+            free(buf);
+            buf = NULL;
+            errno = e;
+        } else if (n == 0) {
+            break;
+        } else {
+            used += (size_t)n;
+        }
+    }
+    int e = errno;
+    close(fd);
+    errno = e;
+    *len = used;
+    return buf;
+}
+
+/* ============================================================
+ * Replay
+ * ============================================================ */
+
+static int cmp_key(int kind_a, const char *path_a, size_t len_a,
+                   int kind_b, const char *path_b, size_t len_b) {
+    if (kind_a != kind_b) return kind_a - kind_b;
+    int c = memcmp(path_a, path_b, len_a < len_b ? len_a : len_b);
+    if (c) return c;
+    return (len_a > len_b) - (len_a < len_b);
+}
+
+static int cmp_entry(const void *a, const void *b) {
+    const pfs_entry_t *x = a, *y = b;
+    int c = cmp_key(x->kind, x->path, x->path_len,
+                    y->kind, y->path, y->path_len);
+    if (c) return c;
+    return (x->seq > y->seq) - (x->seq < y->seq);
+}
+
+typedef struct {
+    int kind;
+    const char *path;
+    size_t len;
+} pfs_key_t;
+
+static int cmp_group(const void *k, const void *g) {
+    const pfs_key_t *key = k;
+    const pfs_entry_t *e = ((const pfs_group_t *)g)->first;
+    return cmp_key(key->kind, key->path, key->len, e->kind, e->path, e->path_len);
+}
+
+/* The next record for (kind, path); NULL (errno ENOENT) if never read */
+static const pfs_entry_t *lookup(pfs_kind_t kind, const char *path) {
+    pfs_key_t key = { kind, path, strlen(path) };
+    const pfs_entry_t *e = NULL;
+
+    pthread_mutex_lock(&g_lock);
+    g_reads++;
+    pfs_group_t *g = bsearch(&key, g_groups, g_group_count, sizeof(*g_groups), cmp_group);
+    if (g) {
+        e = g->first + (g->next < g->count ? g->next++ : g->count - 1);
+    } else {
+        g_misses++;
+    }
+    pthread_mutex_unlock(&g_lock);
+
+    if (!e) {
+        errno = ENOENT;
+    } else if (e->err) {
+        errno = e->err;
+    }
+    return e;
+}
+
+static int load_archive(const char *path, char *err, size_t err_size) {
+    size_t size;
+    g_image = slurp(path, &size);
+    if (!g_image) {
+        snprintf(err, err_size, "%s: %s", path, strerror(errno));
+        return -1;
+    }
+    if (size < 8 || memcmp(g_image, PFS_MAGIC, 8) != 0) {
+        snprintf(err, err_size, "%s: not a sentinel procfs recording", path);
+        return -1;
+    }
+
+    /* Count, then index */
+    size_t count = 0;
+    for (size_t off = 8; off < size; count++) {
+        pfs_rec_t rec;
+        if (size - off < sizeof(rec)) break;
+        memcpy(&rec, g_image + off, sizeof(rec));
+        size_t len = sizeof(rec) + rec.path_len + (size_t)rec.data_len;
+        if (len > size - off) break;
+        off += len;
+    }
+
+    g_entries = calloc(count ? count : 1, sizeof(*g_entries));
+    g_groups = calloc(count ? count : 1, sizeof(*g_groups));
+    if (!g_entries || !g_groups) {
+        snprintf(err, err_size, "%s: out of memory", path);
+        return -1;
+    }
+
+    size_t off = 8;
+    for (size_t i = 0; i < count; i++) {
+        pfs_entry_t *e = &g_entries[i];
+        pfs_rec_t rec;
+        memcpy(&rec, g_image + off, sizeof(rec));
+        e->kind = rec.kind;
+        e->err = rec.err;
+        e->path_len = rec.path_len;
+        e->data_len = rec.data_len;
+        e->path = g_image + off + sizeof(rec);
+        e->data = e->path + rec.path_len;
+        e->seq = (uint32_t)i;
+        off += sizeof(rec) + rec.path_len + rec.data_len;
+    }
+    qsort(g_entries, count, sizeof(*g_entries), cmp_entry);
+
+    g_group_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (i == 0 || cmp_key(g_entries[i].kind, g_entries[i].path, g_entries[i].path_len,
+                              g_entries[i - 1].kind, g_entries[i - 1].path,
+                              g_entries[i - 1].path_len) != 0) {
+            g_groups[g_group_count].first = &g_entries[i];
+            g_group_count++;
+        }
+        g_groups[g_group_count - 1].count++;
+    }
+    return 0;
+}
+
+/* ============================================================
+ * Setup
+ * ============================================================ */
+
+int pfs_record(const char *path, char *err, size_t err_size) {
+    if (g_mode != PFS_LIVE) {
+        snprintf(err, err_size, "only one of --record and --replay");
+        return -1;
+    }
+    g_out = fopen(path, "wb");
+    if (!g_out) {
+        snprintf(err, err_size, "%s: %s", path, strerror(errno));
+        return -1;
+    }
+    fwrite(PFS_MAGIC, 1, 8, g_out);
+    snprintf(g_archive, sizeof(g_archive), "%s", path);
+    dirs_reset();
+    g_mode = PFS_RECORD;
+    return 0;
+}
+
+int pfs_replay(const char *path, char *err, size_t err_size) {
+    if (g_mode != PFS_LIVE) {
+        snprintf(err, err_size, "only one of --record and --replay");
+        return -1;
+    }
+    if (load_archive(path, err, err_size) != 0) {
+        free(g_image);
+        free(g_entries);
+        free(g_groups);
+        g_image = NULL;
+        g_entries = NULL;
+        g_groups = NULL;
+        return -1;
+    }
+    snprintf(g_archive, sizeof(g_archive), "%s", path);
+    dirs_reset();
+    g_mode = PFS_REPLAY;
+    return 0;
+}
+
+/* The replay image is left mapped: an abandoned worker may still be
+ * reading from it */
+void pfs_close(void) {
+    pthread_mutex_lock(&g_lock);
+    if (g_mode == PFS_RECORD && g_out) {
+        fclose(g_out);
+        g_out = NULL;
+        fprintf(stderr, "Recorded %llu reads (%.1f KiB) to %s\n",
+                (unsigned long long)g_reads, g_bytes / 1024.0, g_archive);
+    } else if (g_mode == PFS_REPLAY && g_misses) {
+        fprintf(stderr, "Replay: %llu of %llu reads were not in %s\n",
+                (unsigned long long)g_misses, (unsigned long long)g_reads, g_archive);
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+/* ============================================================
+ * Reads
+ * ============================================================ */
+
+ssize_t pfs_read(const char *path, char *buf, size_t size) {
+    size_t len;
+
+    if (g_mode == PFS_LIVE) {
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return -1;
+        ssize_t n = read(fd, buf, size - 1);
+        close(fd);
+        if (n < 0) return -1;
+        buf[n] = '\0';
+        return n;
+    }
+
+    if (g_mode == PFS_RECORD) {
+        char *data = slurp(path, &len);
+        put(PFS_FILE, data ? 0 : errno, path, data, data ? len : 0);
+        if (!data) return -1;
+        if (len > size - 1) len = size - 1;
+        memcpy(buf, data, len);
+        free(data);
+    } else {
+        const pfs_entry_t *e = lookup(PFS_FILE, path);
+        if (!e || e->err) return -1;
+        len = e->data_len < size - 1 ? e->data_len : size - 1;
+        memcpy(buf, e->data, len);
+    }
+    buf[len] = '\0';
+    return (ssize_t)len;
+}
+
+/* Read-only stdio stream over a buffer, which it frees if owned */
+typedef struct {
+    const char *data;
+    size_t len;
+    size_t pos;
+    char *owned;
+} mem_stream_t;
+
+static ssize_t mem_read(void *cookie, char *buf, size_t size) {
+    mem_stream_t *m = cookie;
+    size_t n = m->len - m->pos < size ? m->len - m->pos : size;
+    memcpy(buf, m->data + m->pos, n);
+    m->pos += n;
+    return (ssize_t)n;
+}
+
+static int mem_close(void *cookie) {
+    mem_stream_t *m = cookie;
+    free(m->owned);
+    free(m);
+    return 0;
+}
+
+static FILE *mem_open(const char *data, size_t len, char *owned) {
+    mem_stream_t *m = malloc(sizeof(*m));
+    if (!m) {
+        free(owned);
+        return NULL;
+    }
+    m->data = data;
+    m->len = len;
+    m->pos = 0;
+    m->owned = owned;
+
+    cookie_io_functions_t io = { mem_read, NULL, NULL, mem_close };
+    FILE *f = fopencookie(m, "r", io);
+    if (!f) mem_close(m);
+    return f;
+}
+
+FILE *pfs_fopen(const char *path) {
+    if (g_mode == PFS_LIVE) return fopen(path, "r");
+
+    if (g_mode == PFS_RECORD) {
+        size_t len;
+        char *data = slurp(path, &len);
+        put(PFS_FILE, data ? 0 : errno, path, data, data ? len : 0);
+        return data ? mem_open(data, len, data) : NULL;
+    }
+
+    const pfs_entry_t *e = lookup(PFS_FILE, path);
+    if (!e || e->err) return NULL;
+    return mem_open(e->data, e->data_len, NULL);
+}
+
+/* ============================================================
+ * Directories and links
+ * ============================================================ */
+
+int pfs_opendir(const char *path) {
+    if (g_mode == PFS_LIVE) return open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    if (g_mode == PFS_RECORD) {
+        int fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        put(PFS_OPEN, fd < 0 ? errno : 0, path, NULL, 0);
+        if (fd < 0) return -1;
+        if (dir_add(fd, path) < 0) {
+            close(fd);
+            errno = EMFILE;
+            return -1;
+        }
+        return fd;
+    }
+
+    const pfs_entry_t *e = lookup(PFS_OPEN, path);
+    if (!e || e->err) return -1;
+    int fd = dir_add(-1, path);
+    if (fd < 0) errno = EMFILE;
+    return fd;
+}
+
+int pfs_opendirat(int dirfd, const char *name) {
+    if (g_mode == PFS_LIVE) return openat(dirfd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    char path[PFS_DIR_PATH];
+    if (dir_path(dirfd, name, path, sizeof(path)) != 0) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    return pfs_opendir(path);
+}
+
+void pfs_closedir(int dirfd) {
+    if (g_mode != PFS_LIVE) dir_remove(dirfd);
+    if (g_mode != PFS_REPLAY) close(dirfd);
+}
+
+int pfs_rewinddir(int dirfd) {
+    if (g_mode == PFS_REPLAY) return 0;
+    return lseek(dirfd, 0, SEEK_SET) == 0 ? 0 : -1;
+}
+
+/* Listing of a recorded directory, from its start like a fresh open */
+int pfs_walk_dir(int dirfd, procfs_dirent_fn fn, void *arg) {
+    char path[PFS_DIR_PATH];
+    if (dir_path(dirfd, NULL, path, sizeof(path)) != 0) return -1;
+
+    const char *list;
+    size_t len;
+    char *owned = NULL;
+
+    if (g_mode == PFS_RECORD) {
+        int dup_fd = dup(dirfd);
+        DIR *d = dup_fd >= 0 ? fdopendir(dup_fd) : NULL;
+        if (!d) {
+            if (dup_fd >= 0) close(dup_fd);
+            put(PFS_DIR, errno, path, NULL, 0);
+            return -1;
+        }
+        rewinddir(d);
+
+        size_t cap = 4096;
+        len = 0;
+        owned = malloc(cap);
+        struct dirent *de;
+        while (owned && (de = readdir(d)) != NULL) {
+            if (de->d_name[0] == '.' &&
+                (de->d_name[1] == '\0' || (de->d_name[1] == '.' && de->d_name[2] == '\0'))) {
+                continue;
+            }
+            size_t need = strlen(de->d_name) + 2;
+            if (len + need > cap) {
+                while (len + need > cap) cap *= 2;
+                char *p = realloc(owned, cap);
+                if (!p) {
+                    free(owned);
+                    owned = NULL;
+                    break;
+                }
+                owned = p;
+            }
+            owned[len] = (char)de->d_type;
+            memcpy(owned + len + 1, de->d_name, need - 1);
+            len += need;
+        }
+        closedir(d);
+        if (!owned) {
+            put(PFS_DIR, ENOMEM, path, NULL, 0);
+            return -1;
+        }
+        put(PFS_DIR, 0, path, owned, len);
+        list = owned;
+    } else {
+        const pfs_entry_t *e = lookup(PFS_DIR, path);
+        if (!e || e->err) return -1;
+        list = e->data;
+        len = e->data_len;
+    }
+
+    int count = 0;
+    for (size_t off = 0; off < len; ) {
+        unsigned char type = (unsigned char)list[off];
+        const char *name = list + off + 1;
+        off += strlen(name) + 2;
+        count++;
+        if (fn && fn(dirfd, name, type, arg)) break;
+    }
+    free(owned);
+    return count;
+}
+
+ssize_t pfs_readlinkat(int dirfd, const char *name, char *buf, size_t size) {
+    if (g_mode == PFS_LIVE) return readlinkat(dirfd, name, buf, size);
+
+    char path[PFS_DIR_PATH + 64];
+    if (dir_path(dirfd, name, path, sizeof(path)) != 0) return readlinkat(dirfd, name, buf, size);
+
+    const char *target;
+    size_t len;
+    char link[MAX_PATH_LEN];
+
+    if (g_mode == PFS_RECORD) {
+        ssize_t n = readlinkat(dirfd, name, link, sizeof(link));
+        put(PFS_LINK, n < 0 ? errno : 0, path, link, n < 0 ? 0 : (size_t)n);
+        if (n < 0) return -1;
+        target = link;
+        len = (size_t)n;
+    } else {
+        const pfs_entry_t *e = lookup(PFS_LINK, path);
+        if (!e || e->err) return -1;
+        target = e->data;
+        len = e->data_len;
+    }
+
+    /* readlink() truncates silently */
+    if (len > size) len = size;
+    memcpy(buf, target, len);
+    return (ssize_t)len;
+}
+
+static void stat_to_rec(const struct stat *st, pfs_stat_rec_t *r) {
+    memset(r, 0, sizeof(*r));
+    r->mode = st->st_mode;
+    r->uid = st->st_uid;
+    r->gid = st->st_gid;
+    r->size = st->st_size;
+    r->mtime = st->st_mtime;
+    r->ctime = st->st_ctime;
+}
+
+static int rec_to_stat(const pfs_entry_t *e, struct stat *st) {
+    pfs_stat_rec_t r;
+    if (!e || e->err || e->data_len != sizeof(r)) return -1;
+    memcpy(&r, e->data, sizeof(r));
+    memset(st, 0, sizeof(*st));
+    st->st_mode = r.mode;
+    st->st_uid = r.uid;
+    st->st_gid = r.gid;
+    st->st_size = r.size;
+    st->st_mtime = r.mtime;
+    st->st_ctime = r.ctime;
+    return 0;
+}
+
+/* Record one stat() result under path */
+static int record_stat(const char *path, int rc, const struct stat *st) {
+    pfs_stat_rec_t r;
+    if (rc == 0) stat_to_rec(st, &r);
+    put(PFS_STAT, rc == 0 ? 0 : errno, path, &r, rc == 0 ? sizeof(r) : 0);
+    return rc;
+}
+
+int pfs_fstatat(int dirfd, const char *name, struct stat *st) {
+    char path[PFS_DIR_PATH + 64];
+    if (g_mode == PFS_LIVE || dir_path(dirfd, name, path, sizeof(path)) != 0) {
+        return fstatat(dirfd, name, st, 0);
+    }
+    if (g_mode == PFS_RECORD) return record_stat(path, fstatat(dirfd, name, st, 0), st);
+    return rec_to_stat(lookup(PFS_STAT, path), st);
+}
+
+int pfs_stat(const char *path, struct stat *st) {
+    if (g_mode == PFS_LIVE) return stat(path, st);
+    if (g_mode == PFS_RECORD) return record_stat(path, stat(path, st), st);
+    return rec_to_stat(lookup(PFS_STAT, path), st);
+}
+
+int pfs_sha256_file(const char *path, char *out, size_t out_size) {
+    if (g_mode == PFS_LIVE) return sha256_file(path, out, out_size);
+
+    if (g_mode == PFS_RECORD) {
+        int rc = sha256_file(path, out, out_size);
+        put(PFS_SUM, rc ? EIO : 0, path, out, strlen(out));
+        return rc;
+    }
+
+    const pfs_entry_t *e = lookup(PFS_SUM, path);
+    size_t len = e ? e->data_len : 0;
+    if (len >= out_size) len = out_size - 1;
+    if (e) memcpy(out, e->data, len);
+    out[len] = '\0';
+    return e && !e->err ? 0 : -1;
+}
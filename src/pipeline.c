@@ -0,0 +1,375 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * pipeline.c - Watch mode as four stages on four threads
+ *
+ * Run back to back, serializing and printing cycle N delayed probing
+ * cycle N+1, so a 1 s interval drifted by however long the output
+ * took. Here the calling thread only probes, on a fixed schedule, and
+ * hands each snapshot on:
+ *
+ *   probe --ring--> analyze --ring--> serialize --ring--> emit
+ *     ^                                                     |
+ *     +------------------------ring (free)------------------+
+ *
+ * A fixed set of PIPELINE_SLOTS snapshots circulates. Each ring has
+ * exactly one producer and one consumer, so it needs no lock: the
+ * producer owns head, the consumer owns tail, and acquire/release on
+ * those indices orders the slot contents. A semaphore per ring only
+ * lets an idle consumer sleep.
+ *
+ * If the downstream stages hold every snapshot when a probe is due,
+ * the probe is skipped and counted rather than delayed, so the stages
+ * behind can never push the schedule back. Ring occupancy at hand-off,
+ * the most ever queued, skips and per-stage times ride along in each
+ * snapshot (fingerprint_t.pipeline).
+ *
+ * The probes keep their shared arena and string table; the probe stage
+ * copies what the snapshot needs out of them before resetting them,
+ * the same point where the sequential loop reset the arena.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+#include "sentinel.h"
+#include "audit.h"
+#include "plugin.h"
+#include "pipeline.h"
+
+#define RING_SIZE 8                     /* Power of two above PIPELINE_SLOTS + 1 */
+
+typedef struct {
+    snapshot_t *items[RING_SIZE];
+    unsigned head;                      /* Next write; producer only */
+    unsigned tail;                      /* Next read; consumer only */
+    int high_water;                     /* Producer only */
+    sem_t ready;                        /* Items the consumer may take */
+} spsc_ring_t;
+
+/* Rings 0-2 feed analyze, serialize and emit; ring 3 returns slots */
+enum { RING_ANALYZE, RING_SERIALIZE, RING_EMIT, RING_FREE, RING_COUNT };
+
+typedef struct {
+    const pipeline_t *p;
+    spsc_ring_t rings[RING_COUNT];
+    snapshot_t *slots[PIPELINE_SLOTS];
+    unsigned long cycles;
+    unsigned long dropped;
+    /* Emit stage -> probe stage: the last snapshot's timings, in us */
+    unsigned last_stage_us[PIPELINE_STAGES];
+    unsigned last_lag_us;
+    int worst_exit;                     /* Emit stage; read after join */
+} pipeline_state_t;
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+/* ============================================================
+ * Single-Producer Single-Consumer Ring
+ * ============================================================ */
+
+static int ring_init(spsc_ring_t *r) {
+    memset(r, 0, sizeof(*r));
+    return sem_init(&r->ready, 0, 0);
+}
+
+static int ring_count(const spsc_ring_t *r) {
+    unsigned head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    unsigned tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+    return (int)(head - tail);
+}
+
+/* Producer; NULL is the end-of-stream marker. -1 if full. */
+static int ring_push(spsc_ring_t *r, snapshot_t *s) {
+    unsigned head = r->head;
+    if (head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) == RING_SIZE) return -1;
+
+    r->items[head % RING_SIZE] = s;
+    __atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE);
+
+    int queued = (int)(head + 1 - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE));
+    if (s && queued > r->high_water) __atomic_store_n(&r->high_water, queued, __ATOMIC_RELAXED);
+    sem_post(&r->ready);
+    return 0;
+}
+
+/* Consumer; blocks until there is an item */
+static snapshot_t *ring_pop(spsc_ring_t *r) {
+    while (sem_wait(&r->ready) != 0 && errno == EINTR) {
+        /* Retry */
+    }
+    unsigned tail = r->tail;
+    snapshot_t *s = r->items[tail % RING_SIZE];
+    __atomic_store_n(&r->tail, tail + 1, __ATOMIC_RELEASE);
+    return s;
+}
+
+/* Consumer; NULL at once if empty */
+static snapshot_t *ring_try_pop(spsc_ring_t *r) {
+    if (sem_trywait(&r->ready) != 0) return NULL;
+    unsigned tail = r->tail;
+    snapshot_t *s = r->items[tail % RING_SIZE];
+    __atomic_store_n(&r->tail, tail + 1, __ATOMIC_RELEASE);
+    return s;
+}
+
+/* ============================================================
+ * Snapshots
+ * ============================================================ */
+
+static snapshot_t *snapshot_create(void) {
+    snapshot_t *s = calloc(1, sizeof(*s));
+    if (!s) return NULL;
+    s->arena = arena_create(ARENA_DEFAULT_CHUNK);
+    s->strings = strtab_create();
+    if (!s->arena || !s->strings) {
+        arena_destroy(s->arena);
+        strtab_destroy(s->strings);
+        free(s);
+        return NULL;
+    }
+    return s;
+}
+
+static void snapshot_destroy(snapshot_t *s) {
+    if (!s) return;
+    arena_destroy(s->arena);
+    strtab_destroy(s->strings);
+    free(s->cpus);
+    free(s);
+}
+
+static void *copy_section(snapshot_t *s, const void *src, size_t size) {
+    if (!src) return NULL;
+    void *dst = arena_alloc(s->arena, size);
+    if (dst) memcpy(dst, src, size);
+    return dst;
+}
+
+/* Detach s->fp from the probes' shared storage; -1 leaves it unusable */
+static int snapshot_seal(snapshot_t *s) {
+    fingerprint_t *fp = &s->fp;
+
+    if (strtab_copy(s->strings, fp->strings) != 0) return -1;
+    fp->strings = s->strings;
+
+    if (fp->cpu.cpus && fp->cpu.cpu_count > 0) {
+        if (fp->cpu.cpu_count > s->cpus_cap) {
+            cpu_usage_t *cpus = realloc(s->cpus, (size_t)fp->cpu.cpu_count * sizeof(*cpus));
+            if (!cpus) return -1;
+            s->cpus = cpus;
+            s->cpus_cap = fp->cpu.cpu_count;
+        }
+        memcpy(s->cpus, fp->cpu.cpus, (size_t)fp->cpu.cpu_count * sizeof(*s->cpus));
+        fp->cpu.cpus = s->cpus;
+    } else {
+        fp->cpu.cpus = NULL;
+    }
+
+    for (int i = 0; i < fp->plugins.count; i++) {
+        plugin_section_t *sec = &fp->plugins.sections[i];
+        size_t size = sec->plugin->section_size;
+        if (sec->section && !(sec->section = copy_section(s, sec->section, size))) return -1;
+        if (sec->prev && !(sec->prev = copy_section(s, sec->prev, size))) return -1;
+    }
+    return 0;
+}
+
+static void snapshot_stats(pipeline_state_t *st, snapshot_t *s) {
+    pipeline_stats_t *ps = &s->fp.pipeline;
+
+    ps->active = 1;
+    ps->slots = PIPELINE_SLOTS;
+    ps->cycles = st->cycles;
+    ps->dropped = st->dropped;
+    for (int i = 0; i < RING_FREE; i++) {
+        ps->queued[i] = ring_count(&st->rings[i]);
+        ps->queued_max[i] = __atomic_load_n(&st->rings[i].high_water, __ATOMIC_RELAXED);
+    }
+    for (int i = 0; i < PIPELINE_STAGES; i++) {
+        ps->stage_ms[i] = __atomic_load_n(&st->last_stage_us[i], __ATOMIC_RELAXED) / 1000.0;
+    }
+    ps->lag_ms = __atomic_load_n(&st->last_lag_us, __ATOMIC_RELAXED) / 1000.0;
+}
+
+/* ============================================================
+ * Stages
+ * ============================================================ */
+
+static void *analyze_stage(void *arg) {
+    pipeline_state_t *st = arg;
+    snapshot_t *s;
+
+    while ((s = ring_pop(&st->rings[RING_ANALYZE])) != NULL) {
+        analyze_fingerprint_quick(&s->fp, &s->analysis);
+        s->exit_code = analysis_exit_code(&s->fp, &s->analysis,
+                                          s->have_audit && s->audit.enabled ?
+                                          s->audit.risk_score : -1);
+        s->t_done[1] = now_ms();
+        ring_push(&st->rings[RING_SERIALIZE], s);
+    }
+    ring_push(&st->rings[RING_SERIALIZE], NULL);
+    return NULL;
+}
+
+static void *serialize_stage(void *arg) {
+    pipeline_state_t *st = arg;
+    snapshot_t *s;
+
+    while ((s = ring_pop(&st->rings[RING_SERIALIZE])) != NULL) {
+        s->output = NULL;
+        if (st->p->serialize) {
+            probe_arena_use(s->arena);
+            st->p->serialize(s, st->p->ctx);
+            probe_arena_use(NULL);
+        }
+        s->t_done[2] = now_ms();
+        ring_push(&st->rings[RING_EMIT], s);
+    }
+    ring_push(&st->rings[RING_EMIT], NULL);
+    return NULL;
+}
+
+static void *emit_stage(void *arg) {
+    pipeline_state_t *st = arg;
+    snapshot_t *s;
+
+    while ((s = ring_pop(&st->rings[RING_EMIT])) != NULL) {
+        st->p->emit(s, st->p->ctx);
+        fflush(stdout);
+        if (s->exit_code > st->worst_exit) st->worst_exit = s->exit_code;
+
+        s->t_done[3] = now_ms();
+        double begin = s->t_start;
+        for (int i = 0; i < PIPELINE_STAGES; i++) {
+            __atomic_store_n(&st->last_stage_us[i],
+                             (unsigned)((s->t_done[i] - begin) * 1000.0), __ATOMIC_RELAXED);
+            begin = s->t_done[i];
+        }
+        __atomic_store_n(&st->last_lag_us, (unsigned)((s->t_done[3] - s->t_done[0]) * 1000.0),
+                         __ATOMIC_RELAXED);
+        ring_push(&st->rings[RING_FREE], s);
+    }
+    return NULL;
+}
+
+/* Sleep until the monotonic deadline, or until a signal */
+static void sleep_until(const struct timespec *deadline) {
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline, NULL);
+}
+
+int pipeline_run(const pipeline_t *p, volatile int *keep_running) {
+    pipeline_state_t st;
+    pthread_t threads[PIPELINE_STAGES - 1];
+    void *(*stages[PIPELINE_STAGES - 1])(void *) = {
+        analyze_stage, serialize_stage, emit_stage
+    };
+    int started = 0;
+
+    memset(&st, 0, sizeof(st));
+    st.p = p;
+    st.worst_exit = EXIT_OK;
+
+    for (int i = 0; i < RING_COUNT; i++) {
+        if (ring_init(&st.rings[i]) != 0) return EXIT_ERROR;
+    }
+    for (int i = 0; i < PIPELINE_SLOTS; i++) {
+        if (!(st.slots[i] = snapshot_create())) goto out;
+        ring_push(&st.rings[RING_FREE], st.slots[i]);
+    }
+
+    /* Signals are for the probe thread, whose sleep they cut short */
+    sigset_t block, old;
+    sigemptyset(&block);
+    sigaddset(&block, SIGINT);
+    sigaddset(&block, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &block, &old);
+    for (; started < PIPELINE_STAGES - 1; started++) {
+        if (pthread_create(&threads[started], NULL, stages[started], &st) != 0) break;
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    if (started < PIPELINE_STAGES - 1) {
+        fprintf(stderr, "Error: cannot start watch pipeline threads\n");
+        *keep_running = 0;
+    }
+
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    /* A slot whose cycle was skipped stays here: RING_FREE has one
+     * producer, the emit thread */
+    snapshot_t *spare = NULL;
+
+    while (*keep_running) {
+        snapshot_t *s = spare ? spare : ring_try_pop(&st.rings[RING_FREE]);
+        spare = NULL;
+        st.cycles++;
+
+        if (!s) {
+            st.dropped++;
+        } else {
+            s->t_start = now_ms();
+            arena_reset(s->arena);
+            memset(&s->audit, 0, sizeof(s->audit));
+            s->have_audit = 0;
+
+            p->probe(s, p->ctx);
+            int sealed = snapshot_seal(s);
+
+            /* End of cycle for the probes: the snapshot has its own copies */
+            arena_reset(probe_arena());
+
+            if (sealed != 0) {
+                fprintf(stderr, "Warning: out of memory copying snapshot, cycle skipped\n");
+                st.dropped++;
+                spare = s;
+            } else {
+                snapshot_stats(&st, s);
+                s->t_done[0] = now_ms();
+                ring_push(&st.rings[RING_ANALYZE], s);
+            }
+        }
+
+        /* Fixed schedule; a cycle that overran starts the next at once */
+        next.tv_sec += p->interval;
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (now.tv_sec > next.tv_sec ||
+            (now.tv_sec == next.tv_sec && now.tv_nsec > next.tv_nsec)) {
+            next = now;
+        } else if (*keep_running) {
+            sleep_until(&next);
+        }
+    }
+
+    /* Drain: the end marker follows every queued snapshot through */
+    if (started > 0) ring_push(&st.rings[RING_ANALYZE], NULL);
+    for (int i = 0; i < started; i++) pthread_join(threads[i], NULL);
+
+    if (st.dropped > 0) {
+        fprintf(stderr, "Watch pipeline: %lu of %lu probes skipped (output fell behind)\n",
+                st.dropped, st.cycles);
+    }
+
+out:
+    for (int i = 0; i < PIPELINE_SLOTS; i++) snapshot_destroy(st.slots[i]);
+    for (int i = 0; i < RING_COUNT; i++) sem_destroy(&st.rings[i].ready);
+    return started == PIPELINE_STAGES - 1 ? st.worst_exit : EXIT_ERROR;
+}
@@ -0,0 +1,321 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * plugin.c - Probe plugin registry and scheduler
+ *
+ * Every plugin goes through the same cycle: if it is due (its "every")
+ * and its cost hint fits what is left of PROBE_PLUGIN_BUDGET_MS, a
+ * zeroed section is taken from the probe arena and collect() runs
+ * under the watchdog as its own stage. Overruns and failures land in
+ * fp->error_log like any other stage. A plugin deferred for budget
+ * runs first on the next cycle, so an expensive one is delayed, never
+ * starved. The last good section is kept so diff() has something to
+ * compare against in watch mode.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#ifndef SENTINEL_NO_DLOPEN
+#include <dlfcn.h>
+#endif
+
+#include "sentinel.h"
+
+/* Built-in plugins */
+extern const probe_plugin_t pressure_plugin;
+
+static const probe_plugin_t *builtin_plugins[] = {
+    &pressure_plugin,
+};
+
+typedef struct {
+    const probe_plugin_t *plugin;
+    void *last;                 /* Copy of the last good section */
+    void *prev;                 /* The one before it */
+    int have_last;
+    int owed;                   /* Deferred last cycle */
+    unsigned long runs;
+    unsigned long failures;
+    double total_ms;
+} plugin_slot_t;
+
+static plugin_slot_t g_slots[PROBE_PLUGINS_MAX];
+static int g_slot_count;
+static int g_builtins_done;
+static unsigned long g_cycle;
+
+static int valid_name(const char *name) {
+    if (!name || !*name || strlen(name) >= 16) return 0;   /* probe_error_t.stage */
+    for (const char *p = name; *p; p++) {
+        if (!((*p >= 'a' && *p <= 'z') || (*p >= '0' && *p <= '9') || *p == '_')) return 0;
+    }
+    return 1;
+}
+
+static int register_plugin(const probe_plugin_t *p, char *err, size_t err_size) {
+    if (!p || p->abi != PROBE_PLUGIN_ABI) {
+        snprintf(err, err_size, "plugin ABI %d, expected %d", p ? p->abi : -1, PROBE_PLUGIN_ABI);
+        return -1;
+    }
+    if (!valid_name(p->name)) {
+        snprintf(err, err_size, "bad plugin name (1-15 of [a-z0-9_])");
+        return -1;
+    }
+    if (!p->collect || !p->serialize || p->section_size == 0) {
+        snprintf(err, err_size, "%s: collect, serialize and section_size are required", p->name);
+        return -1;
+    }
+    for (int i = 0; i < g_slot_count; i++) {
+        if (strcmp(g_slots[i].plugin->name, p->name) == 0) {
+            snprintf(err, err_size, "%s: already registered", p->name);
+            return -1;
+        }
+    }
+    if (g_slot_count >= PROBE_PLUGINS_MAX) {
+        snprintf(err, err_size, "%s: more than %d plugins", p->name, PROBE_PLUGINS_MAX);
+        return -1;
+    }
+
+    plugin_slot_t *s = &g_slots[g_slot_count];
+    memset(s, 0, sizeof(*s));
+    s->last = calloc(1, p->section_size);
+    s->prev = calloc(1, p->section_size);
+    if (!s->last || !s->prev) {
+        free(s->last);
+        free(s->prev);
+        snprintf(err, err_size, "%s: out of memory", p->name);
+        return -1;
+    }
+    if (p->init && p->init() != 0) {
+        free(s->last);
+        free(s->prev);
+        snprintf(err, err_size, "%s: init failed", p->name);
+        return -1;
+    }
+    s->plugin = p;
+    g_slot_count++;
+    return 0;
+}
+
+static void register_builtins(void) {
+    if (g_builtins_done) return;
+    g_builtins_done = 1;
+
+    char err[128];
+    for (size_t i = 0; i < sizeof(builtin_plugins) / sizeof(builtin_plugins[0]); i++) {
+        /* A built-in whose init() fails (no PSI, say) simply stays out */
+        register_plugin(builtin_plugins[i], err, sizeof(err));
+    }
+}
+
+int plugin_register(const probe_plugin_t *p, char *err, size_t err_size) {
+    register_builtins();
+    return register_plugin(p, err, err_size);
+}
+
+int plugin_load(const char *path, char *err, size_t err_size) {
+#ifdef SENTINEL_NO_DLOPEN
+    snprintf(err, err_size, "%s: plugin modules are not supported in this build", path);
+    return -1;
+#else
+    void *h = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!h) {
+        snprintf(err, err_size, "%s", dlerror());
+        return -1;
+    }
+
+    /* ISO C has no function/object pointer conversion; POSIX requires
+     * this one to work */
+    probe_plugin_entry_fn entry;
+    void *sym = dlsym(h, PROBE_PLUGIN_SYMBOL);
+    memcpy(&entry, &sym, sizeof(entry));
+    if (!sym) {
+        snprintf(err, err_size, "%s: no %s()", path, PROBE_PLUGIN_SYMBOL);
+        dlclose(h);
+        return -1;
+    }
+
+    char why[160];
+    if (plugin_register(entry(), why, sizeof(why)) != 0) {
+        snprintf(err, err_size, "%s: %s", path, why);
+        dlclose(h);
+        return -1;
+    }
+    /* Never dlclose()d: an abandoned collect() may still be running */
+    return 0;
+#endif
+}
+
+/* Whoever can write a module, or the directory it sits in, runs code
+ * as us on the next probe: only our own, not group/world-writable */
+static int trusted(const struct stat *st, char *why, size_t why_size) {
+    if (st->st_uid != geteuid()) {
+        snprintf(why, why_size, "owned by uid %u, not %u",
+                 (unsigned)st->st_uid, (unsigned)geteuid());
+        return 0;
+    }
+    if (st->st_mode & (S_IWGRP | S_IWOTH)) {
+        snprintf(why, why_size, "group or world writable (mode %03o)",
+                 (unsigned)(st->st_mode & 0777));
+        return 0;
+    }
+    return 1;
+}
+
+int plugin_load_dir(const char *dir) {
+    int dfd = open(dir, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+    if (dfd < 0) return 0;
+
+    struct stat st;
+    char why[96];
+    if (fstat(dfd, &st) != 0) {
+        close(dfd);
+        return 0;
+    }
+    if (!trusted(&st, why, sizeof(why))) {
+        fprintf(stderr, "Warning: not loading plugins from %s: %s\n", dir, why);
+        close(dfd);
+        return 0;
+    }
+    DIR *d = fdopendir(dfd);
+    if (!d) {
+        close(dfd);
+        return 0;
+    }
+
+    int loaded = 0;
+    struct dirent *e;
+    while ((e = readdir(d)) != NULL) {
+        size_t len = strlen(e->d_name);
+        if (len < 4 || strcmp(e->d_name + len - 3, ".so") != 0) continue;
+
+        char path[MAX_PATH_LEN], err[256];
+        snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+        if (fstatat(dfd, e->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0 ||
+            !S_ISREG(st.st_mode)) {
+            fprintf(stderr, "Warning: plugin %s: not a regular file\n", path);
+            continue;
+        }
+        if (!trusted(&st, why, sizeof(why))) {
+            fprintf(stderr, "Warning: plugin %s: %s\n", path, why);
+            continue;
+        }
+        if (plugin_load(path, err, sizeof(err)) == 0) {
+            loaded++;
+        } else {
+            fprintf(stderr, "Warning: plugin %s\n", err);
+        }
+    }
+    closedir(d);
+    return loaded;
+}
+
+static int stage_plugin(void *arg, void *out) {
+    const probe_plugin_t *p = arg;
+    return p->collect(out);
+}
+
+static void run_slot(fingerprint_t *fp, int i, double *budget) {
+    plugin_slot_t *s = &g_slots[i];
+    const probe_plugin_t *p = s->plugin;
+    plugin_section_t *sec = &fp->plugins.sections[i];
+
+    sec->plugin = p;
+    if (p->every > 1 && g_cycle % (unsigned long)p->every != 0 && !s->owed) {
+        sec->status = PLUGIN_SKIPPED;
+        return;
+    }
+    /* Something always runs, however optimistic the hint */
+    if (p->cost_ms > *budget && *budget < PROBE_PLUGIN_BUDGET_MS && !s->owed) {
+        sec->status = PLUGIN_DEFERRED;
+        s->owed = 1;
+        return;
+    }
+    s->owed = 0;
+
+    void *section = arena_calloc(probe_arena(), 1, p->section_size);
+    double start = watchdog_now_ms();
+    int rc = section ? watchdog_run_stage(fp, p->name, stage_plugin, (void *)p,
+                                          section, p->section_size) : -1;
+    sec->elapsed_ms = watchdog_now_ms() - start;
+    *budget -= sec->elapsed_ms > p->cost_ms ? sec->elapsed_ms : p->cost_ms;
+
+    s->runs++;
+    s->total_ms += sec->elapsed_ms;
+    if (rc != 0) {
+        s->failures++;
+        sec->status = PLUGIN_FAILED;
+        return;
+    }
+
+    /* last -> prev, new -> last */
+    void *t = s->prev;
+    s->prev = s->last;
+    s->last = t;
+    memcpy(s->last, section, p->section_size);
+    sec->prev = s->have_last ? s->prev : NULL;
+    s->have_last = 1;
+
+    sec->status = PLUGIN_OK;
+    sec->section = section;
+}
+
+void capture_plugins(fingerprint_t *fp) {
+    register_builtins();
+
+    plugin_report_t *rep = &fp->plugins;
+    memset(rep, 0, sizeof(*rep));
+    rep->count = g_slot_count;
+
+    double budget = PROBE_PLUGIN_BUDGET_MS;
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < g_slot_count; i++) {
+            if (g_slots[i].owed == (pass == 0)) run_slot(fp, i, &budget);
+        }
+    }
+
+    for (int i = 0; i < g_slot_count; i++) {
+        plugin_section_t *sec = &rep->sections[i];
+        sec->runs = g_slots[i].runs;
+        sec->failures = g_slots[i].failures;
+        sec->mean_ms = g_slots[i].runs ? g_slots[i].total_ms / g_slots[i].runs : 0;
+    }
+    g_cycle++;
+}
+
+void plugins_list(FILE *out) {
+    register_builtins();
+
+    fprintf(out, "Probe plugins:\n");
+    for (int i = 0; i < g_slot_count; i++) {
+        const probe_plugin_t *p = g_slots[i].plugin;
+        fprintf(out, "  %-16s ~%.1f ms", p->name, p->cost_ms);
+        if (p->every > 1) fprintf(out, ", every %d cycles", p->every);
+        fprintf(out, "  %s\n", p->description ? p->description : "");
+    }
+    if (g_slot_count == 0) {
+        fprintf(out, "  (none)\n");
+    }
+}
+
+void plugins_teardown(void) {
+    for (int i = 0; i < g_slot_count; i++) {
+        if (g_slots[i].plugin->teardown) g_slots[i].plugin->teardown();
+        free(g_slots[i].last);
+        free(g_slots[i].prev);
+    }
+    g_slot_count = 0;
+    g_builtins_done = 0;
+}
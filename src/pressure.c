@@ -0,0 +1,106 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * pressure.c - Pressure stall information, as a probe plugin
+ *
+ * /proc/pressure/{cpu,memory,io} (Linux 4.20+, CONFIG_PSI) give the
+ * share of time tasks were stalled waiting on each resource: "some"
+ * when at least one task was, "full" when all non-idle tasks were.
+ * Load average mixes runnable and D-state tasks; PSI says which
+ * resource the waiting is for.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sentinel.h"
+
+#define PSI_RESOURCES 3
+
+static const char *psi_names[PSI_RESOURCES] = { "cpu", "memory", "io" };
+
+typedef struct {
+    double avg10;               /* % of the last 10s */
+    double avg60;
+    unsigned long long total_us;
+} psi_line_t;
+
+typedef struct {
+    psi_line_t some[PSI_RESOURCES];
+    psi_line_t full[PSI_RESOURCES];
+} pressure_section_t;
+
+static int pressure_init(void) {
+    struct stat st;
+    return pfs_stat("/proc/pressure/cpu", &st) == 0 ? 0 : -1;
+}
+
+static int pressure_collect(void *section) {
+    pressure_section_t *ps = section;
+    int read_any = 0;
+
+    for (int r = 0; r < PSI_RESOURCES; r++) {
+        char path[64], line[256];
+        snprintf(path, sizeof(path), "/proc/pressure/%s", psi_names[r]);
+        FILE *f = pfs_fopen(path);
+        if (!f) continue;
+
+        while (fgets(line, sizeof(line), f)) {
+            psi_line_t v;
+            char kind[8];
+            if (sscanf(line, "%7s avg10=%lf avg60=%lf avg300=%*f total=%llu",
+                       kind, &v.avg10, &v.avg60, &v.total_us) != 4) continue;
+            if (strcmp(kind, "some") == 0) ps->some[r] = v;
+            else if (strcmp(kind, "full") == 0) ps->full[r] = v;
+        }
+        fclose(f);
+        read_any = 1;
+    }
+    return read_any ? 0 : -1;
+}
+
+static void pressure_serialize(const void *section, probe_json_t *out) {
+    const pressure_section_t *ps = section;
+    char key[32];
+
+    for (int r = 0; r < PSI_RESOURCES; r++) {
+        snprintf(key, sizeof(key), "%s_some_avg10", psi_names[r]);
+        probe_json_number(out, key, ps->some[r].avg10);
+        snprintf(key, sizeof(key), "%s_some_avg60", psi_names[r]);
+        probe_json_number(out, key, ps->some[r].avg60);
+        snprintf(key, sizeof(key), "%s_full_avg10", psi_names[r]);
+        probe_json_number(out, key, ps->full[r].avg10);
+    }
+}
+
+/* Stall time accumulated since the previous cycle, in ms */
+static void pressure_diff(const void *prev, const void *cur, probe_json_t *out) {
+    const pressure_section_t *a = prev, *b = cur;
+    char key[32];
+
+    for (int r = 0; r < PSI_RESOURCES; r++) {
+        snprintf(key, sizeof(key), "%s_some_stall_ms", psi_names[r]);
+        probe_json_number(out, key, (b->some[r].total_us - a->some[r].total_us) / 1000.0);
+        snprintf(key, sizeof(key), "%s_full_stall_ms", psi_names[r]);
+        probe_json_number(out, key, (b->full[r].total_us - a->full[r].total_us) / 1000.0);
+    }
+}
+
+const probe_plugin_t pressure_plugin = {
+    .abi = PROBE_PLUGIN_ABI,
+    .name = "pressure",
+    .description = "CPU, memory and I/O stall time (PSI)",
+    .section_size = sizeof(pressure_section_t),
+    .cost_ms = 0.1,
+    .every = 1,
+    .init = pressure_init,
+    .collect = pressure_collect,
+    .serialize = pressure_serialize,
+    .diff = pressure_diff,
+};
@@ -15,14 +15,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
-#include <dirent.h>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/sysinfo.h>
 #include <sys/utsname.h>
 #include <time.h>
-#include <ctype.h>
 #include <errno.h>
+#include <math.h>
+#include <pthread.h>
 
 #include "sentinel.h"
 
@@ -37,34 +37,348 @@ static void safe_strcpy(char *dest, const char *src, size_t dest_size) {
     dest[dest_size - 1] = '\0';
 }
 
-/* Count open file descriptors for a process */
-static int count_fds(pid_t pid) {
-    char path[128];
-    snprintf(path, sizeof(path), "/proc/%d/fd", pid);
+/* ============================================================
+ * File Descriptor Census
+ * ============================================================
+ * /proc/<pid>/fd is walked with procfs_walk_dir() (raw getdents64)
+ * and links are resolved with readlinkat() against the same dirfd, so
+ * a census costs one open, a handful of getdents64 calls and one
+ * readlinkat per fd - no DIR allocation, no path building per entry.
+ */
+
+#define DELETED_SUFFIX " (deleted)"
+
+/* readlinkat() calls left this cycle, shared by all workers */
+static volatile int g_census_budget = FD_CENSUS_BUDGET;
+static volatile int g_census_exhausted = 0;
+
+typedef void (*fd_visit_fn)(int dirfd, const char *name, const char *target, void *arg);
+
+typedef struct {
+    fd_visit_fn visit;
+    void *arg;
+} fd_walk_t;
+
+/* Resolve one fd link, charged to the census budget */
+static int fd_walk_entry(int dirfd, const char *name, unsigned char type, void *arg) {
+    (void)type;
+    fd_walk_t *w = arg;
+    char target[MAX_PATH_LEN];
+    
+    if (__sync_sub_and_fetch(&g_census_budget, 1) < 0) {
+        g_census_exhausted = 1;
+        return 1;
+    }
+    
+    ssize_t len = pfs_readlinkat(dirfd, name, target, sizeof(target) - 1);
+    if (len <= 0) return 0;
+    target[len] = '\0';
+    w->visit(dirfd, name, target, w->arg);
+    return 0;
+}
+
+/* Resolve every link in an open /proc/<pid>/fd directory */
+static void walk_fd_dir(int dirfd, fd_visit_fn visit, void *arg) {
+    fd_walk_t w = { visit, arg };
+    procfs_walk_dir(dirfd, fd_walk_entry, &w);
+}
+
+static int ends_with(const char *s, size_t len, const char *suffix) {
+    size_t slen = strlen(suffix);
+    return len >= slen && memcmp(s + len - slen, suffix, slen) == 0;
+}
+
+/* Is this link target an unlinked file on disk (not a memfd)? */
+static int is_deleted_file(const char *target) {
+    return target[0] == '/' &&
+           strncmp(target, "/memfd:", 7) != 0 &&
+           ends_with(target, strlen(target), DELETED_SUFFIX);
+}
+
+/* The largest deleted files seen this cycle: keeps MAX_DELETED_FDS */
+typedef struct {
+    fd_info_t files[MAX_DELETED_FDS];
+    int count;
+} deleted_list_t;
+
+/* A deleted file's inode, claimed by the first fd seen holding it */
+typedef struct {
+    dev_t dev;
+    ino_t ino;
+    unsigned cycle;             /* Slot is free unless this is the current cycle */
+} deleted_inode_t;
+
+/* Filled by every census walk as it goes, so workers share it. An
+ * abandoned worker may finish after the next cycle started; it carries
+ * the cycle it started in and its late finds are dropped. A file held
+ * open by several fds or processes (stdout and stderr, forked workers)
+ * pins its disk once, so bytes and the list count each inode once. */
+static deleted_list_t g_deleted;
+static deleted_inode_t g_deleted_inodes[FD_DELETED_INODES];
+static uint64_t g_deleted_bytes;
+static unsigned g_census_cycle;
+static pthread_mutex_t g_deleted_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* First sighting of this inode this cycle? Open addressing; slots from
+ * earlier cycles are free. Caller holds g_deleted_lock. */
+static int deleted_inode_new(const struct stat *st) {
+    uint64_t h = ((uint64_t)st->st_ino ^ ((uint64_t)st->st_dev << 32)) * 0x9E3779B97F4A7C15ULL;
+    for (unsigned i = 0; i < FD_DELETED_INODES; i++) {
+        deleted_inode_t *d = &g_deleted_inodes[(h + i) % FD_DELETED_INODES];
+        if (d->cycle != g_census_cycle) {
+            *d = (deleted_inode_t){ st->st_dev, st->st_ino, g_census_cycle };
+            return 1;
+        }
+        if (d->dev == st->st_dev && d->ino == st->st_ino) return 0;
+    }
+    return 1;                   /* Table full: cannot tell, count it */
+}
+
+static void deleted_add(unsigned cycle, pid_t pid, const char *name,
+                        const char *target, const struct stat *st) {
+    uint64_t size = (uint64_t)st->st_size;
+    pthread_mutex_lock(&g_deleted_lock);
+    if (cycle != g_census_cycle || !deleted_inode_new(st)) {
+        pthread_mutex_unlock(&g_deleted_lock);
+        return;
+    }
+    g_deleted_bytes += size;
+    deleted_list_t *list = &g_deleted;
+    
+    /* Find the insertion slot in a size-descending list */
+    int slot = list->count;
+    while (slot > 0 && list->files[slot - 1].size_bytes < size) slot--;
+    if (slot >= MAX_DELETED_FDS) {
+        pthread_mutex_unlock(&g_deleted_lock);
+        return;
+    }
+    
+    int last = list->count < MAX_DELETED_FDS ? list->count : MAX_DELETED_FDS - 1;
+    memmove(&list->files[slot + 1], &list->files[slot],
+            (size_t)(last - slot) * sizeof(fd_info_t));
+    if (list->count < MAX_DELETED_FDS) list->count++;
     
-    DIR *dir = opendir(path);
-    if (!dir) return -1;
+    fd_info_t *f = &list->files[slot];
+    memset(f, 0, sizeof(*f));
+    f->fd = procfs_parse_uint(name);
+    f->pid = pid;
+    safe_strcpy(f->type, "deleted", sizeof(f->type));
+    size_t tlen = strlen(target) - strlen(DELETED_SUFFIX);
+    f->target = strtab_intern_n(strtab_snapshot(), target, tlen);
+    f->size_bytes = size;
+    pthread_mutex_unlock(&g_deleted_lock);
+}
+
+/* Deleted inodes remembered per process, for its own byte count */
+#define PROC_DELETED_SEEN 8
+
+typedef struct {
+    process_info_t *proc;
+    pid_t pid;
+    unsigned cycle;
+    struct { dev_t dev; ino_t ino; } seen[PROC_DELETED_SEEN];
+    int seen_count;
+} census_visit_t;
+
+/* Has this process already counted the inode? Remembers the first few */
+static int census_seen(census_visit_t *cv, const struct stat *st) {
+    int n = cv->seen_count < PROC_DELETED_SEEN ? cv->seen_count : PROC_DELETED_SEEN;
+    for (int i = 0; i < n; i++) {
+        if (cv->seen[i].dev == st->st_dev && cv->seen[i].ino == st->st_ino) return 1;
+    }
+    if (cv->seen_count < PROC_DELETED_SEEN) {
+        cv->seen[cv->seen_count].dev = st->st_dev;
+        cv->seen[cv->seen_count].ino = st->st_ino;
+        cv->seen_count++;
+    }
+    return 0;
+}
+
+/* Classify one fd into the process breakdown */
+static void census_visit(int dirfd, const char *name, const char *target, void *arg) {
+    census_visit_t *cv = arg;
+    process_info_t *proc = cv->proc;
     
-    int count = 0;
-    struct dirent *entry;
-    while ((entry = readdir(dir)) != NULL) {
-        if (entry->d_name[0] != '.') {
-            count++;
+    if (strncmp(target, "socket:[", 8) == 0) {
+        proc->fd_sockets++;
+    } else if (strncmp(target, "pipe:[", 6) == 0) {
+        proc->fd_pipes++;
+    } else if (strncmp(target, "anon_inode:", 11) == 0 ||
+               strncmp(target, "/memfd:", 7) == 0) {
+        proc->fd_anon_inodes++;
+    } else if (is_deleted_file(target)) {
+        struct stat st;
+        proc->fd_deleted++;
+        /* fstatat follows the magic link to the unlinked inode */
+        if (pfs_fstatat(dirfd, name, &st) == 0 && S_ISREG(st.st_mode) &&
+            !census_seen(cv, &st)) {
+            proc->fd_deleted_bytes += st.st_size;
+            deleted_add(cv->cycle, cv->pid, name, target, &st);
         }
+    } else if (target[0] == '/') {
+        proc->fd_files++;
+    }
+}
+
+/* Soft "Max open files" from /proc/<pid>/limits; 0 if unlimited/unknown */
+static uint64_t read_fd_soft_limit(pid_t pid) {
+    char path[64];
+    char buf[2048];
+    
+    snprintf(path, sizeof(path), "/proc/%d/limits", pid);
+    if (pfs_read(path, buf, sizeof(buf)) <= 0) return 0;
+    const char *line = strstr(buf, "\nMax open files");
+    return line ? strtoull(line + 15, NULL, 10) : 0;
+}
+
+/* Count open file descriptors, with a census (and the fd limit the
+ * leak report projects against) above the threshold */
+static int scan_fds(pid_t pid, process_info_t *proc) {
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/%d/fd", pid);
+    
+    int dirfd = pfs_opendir(path);
+    if (dirfd < 0) return -1;
+    
+    int count = procfs_count_dir(dirfd);
+    
+    if (count > FD_CENSUS_THRESHOLD && !g_census_exhausted &&
+        pfs_rewinddir(dirfd) == 0) {
+        census_visit_t cv = { .proc = proc, .pid = pid,
+                              .cycle = __atomic_load_n(&g_census_cycle, __ATOMIC_RELAXED) };
+        walk_fd_dir(dirfd, census_visit, &cv);
+        proc->fd_census_done = 1;
     }
+    if (count > FD_CENSUS_THRESHOLD) proc->fd_soft_limit = read_fd_soft_limit(pid);
     
-    closedir(dir);
+    pfs_closedir(dirfd);
     return count;
 }
 
+/* Start a cycle's census: fresh budget, empty deleted-file list */
+static void census_reset(void) {
+    g_census_budget = FD_CENSUS_BUDGET;
+    g_census_exhausted = 0;
+    pthread_mutex_lock(&g_deleted_lock);
+    __atomic_store_n(&g_census_cycle, g_census_cycle + 1, __ATOMIC_RELAXED);
+    g_deleted.count = 0;
+    g_deleted_bytes = 0;
+    pthread_mutex_unlock(&g_deleted_lock);
+}
+
+/* Aggregate per-process breakdowns into the host-wide census */
+static void aggregate_fd_census(fingerprint_t *fp) {
+    fd_census_t *c = &fp->fd_census;
+    
+    for (int i = 0; i < fp->process_count; i++) {
+        const process_info_t *p = &fp->processes[i];
+        if (!p->fd_census_done) continue;
+        
+        c->processes_scanned++;
+        c->sockets += p->fd_sockets;
+        c->pipes += p->fd_pipes;
+        c->anon_inodes += p->fd_anon_inodes;
+        c->files += p->fd_files;
+        c->deleted += p->fd_deleted;
+    }
+    
+    pthread_mutex_lock(&g_deleted_lock);
+    c->deleted_bytes = g_deleted_bytes;
+    memcpy(c->deleted_files, g_deleted.files, sizeof(c->deleted_files));
+    c->deleted_file_count = g_deleted.count;
+    pthread_mutex_unlock(&g_deleted_lock);
+    
+    c->budget_exhausted = g_census_exhausted;
+}
+
+/* Mark why each process is notable, in the JSON filter's priority
+ * order. Written as selects rather than an if/else chain so the loop
+ * has no branches to get in the way of vectorising. */
+static void classify_processes(process_columns_t *pc) {
+    for (int i = 0; i < MAX_PROCS; i++) {
+        uint8_t f = PROC_FLAG_NONE;
+        f = pc->rss_kb[i] > PROC_HIGH_RSS_KB ? PROC_FLAG_HIGH_MEMORY : f;
+        f = pc->age_seconds[i] > PROC_VERY_LONG_SECS ? PROC_FLAG_VERY_LONG : f;
+        f = pc->stuck[i] ? PROC_FLAG_STUCK : f;
+        /* PROC_HIGH_FD < n < PROC_FD_SANE_MAX as one unsigned compare */
+        f = pc->fd_count[i] - (PROC_HIGH_FD + 1) < PROC_FD_SANE_MAX - (PROC_HIGH_FD + 1)
+            ? PROC_FLAG_HIGH_FD : f;
+        f = pc->state[i] == 'Z' ? PROC_FLAG_ZOMBIE : f;
+        pc->flag[i] = f;
+    }
+}
+
+void build_process_columns(fingerprint_t *fp) {
+    process_columns_t *pc = &fp->proc_cols;
+    
+    memset(pc, 0, sizeof(*pc));
+    pc->count = fp->process_count;
+    for (int i = 0; i < fp->process_count; i++) {
+        const process_info_t *p = &fp->processes[i];
+        uint64_t rss_kb = p->rss_bytes / 1024;
+        pc->state[i] = p->state;
+        pc->stuck[i] = p->is_potentially_stuck != 0;
+        pc->fd_count[i] = p->open_fd_count;
+        pc->threads[i] = p->thread_count;
+        pc->rss_kb[i] = rss_kb > UINT32_MAX ? UINT32_MAX : (uint32_t)rss_kb;
+        pc->age_seconds[i] = p->age_seconds > UINT32_MAX ? UINT32_MAX : (uint32_t)p->age_seconds;
+    }
+    classify_processes(pc);
+}
+
 /* ============================================================
  * System Info Probing
  * ============================================================ */
 
+/* Uptime from the last probe_system_info_pfs(), for process ages */
+static volatile double g_pfs_uptime;
+
+/* The same facts from /proc files, so a recording carries them */
+static int probe_system_info_pfs(system_info_t *info) {
+    char buf[4096];
+    
+    if (pfs_read("/proc/sys/kernel/hostname", info->hostname, sizeof(info->hostname)) > 0) {
+        info->hostname[strcspn(info->hostname, "\n")] = '\0';
+    } else {
+        safe_strcpy(info->hostname, "unknown", sizeof(info->hostname));
+    }
+    
+    char release[128];
+    if (pfs_read("/proc/sys/kernel/ostype", buf, sizeof(buf)) > 0 &&
+        pfs_read("/proc/sys/kernel/osrelease", release, sizeof(release)) > 0) {
+        buf[strcspn(buf, "\n")] = '\0';
+        release[strcspn(release, "\n")] = '\0';
+        snprintf(info->kernel_version, sizeof(info->kernel_version),
+                 "%.60s %.60s", buf, release);
+    }
+    
+    if (pfs_read("/proc/meminfo", buf, sizeof(buf)) > 0) {
+        const char *total = strstr(buf, "MemTotal:");
+        const char *free_kb = strstr(buf, "MemFree:");
+        if (total) info->total_ram = strtoull(total + 9, NULL, 10) * 1024;
+        if (free_kb) info->free_ram = strtoull(free_kb + 8, NULL, 10) * 1024;
+    }
+    
+    if (pfs_read("/proc/uptime", buf, sizeof(buf)) > 0) {
+        g_pfs_uptime = strtod(buf, NULL);
+        info->uptime_seconds = (uint64_t)g_pfs_uptime;
+    }
+    
+    if (pfs_read("/proc/loadavg", buf, sizeof(buf)) > 0) {
+        sscanf(buf, "%lf %lf %lf", &info->load_avg[0], &info->load_avg[1], &info->load_avg[2]);
+    }
+    
+    info->probe_time = time(NULL);
+    info->boot_time = info->probe_time - info->uptime_seconds;
+    
+    return 0;
+}
+
 int probe_system_info(system_info_t *info) {
     if (!info) return -1;
     
     memset(info, 0, sizeof(*info));
+    if (pfs_active()) return probe_system_info_pfs(info);
     
     /* Hostname */
     if (gethostname(info->hostname, sizeof(info->hostname)) != 0) {
@@ -101,22 +415,8 @@ int probe_system_info(system_info_t *info) {
  * Process Probing
  * ============================================================ */
 
-/* Parse /proc/[pid]/stat for process info */
-static int parse_proc_stat(pid_t pid, process_info_t *proc) {
-    char path[128];
-    char buf[2048];
-    
-    snprintf(path, sizeof(path), "/proc/%d/stat", pid);
-    
-    FILE *f = fopen(path, "r");
-    if (!f) return -1;
-    
-    if (!fgets(buf, sizeof(buf), f)) {
-        fclose(f);
-        return -1;
-    }
-    fclose(f);
-    
+/* Parse a /proc/[pid]/stat line into process info */
+static int parse_stat_line(pid_t pid, const char *buf, process_info_t *proc) {
     /* Parse the stat line - format is complex due to comm field */
     /* pid (comm) state ppid ... */
     char *start = strchr(buf, '(');
@@ -125,34 +425,34 @@ static int parse_proc_stat(pid_t pid, process_info_t *proc) {
     if (!start || !end) return -1;
     
     /* Extract comm (process name) */
-    size_t name_len = end - start - 1;
-    if (name_len >= sizeof(proc->name)) {
-        name_len = sizeof(proc->name) - 1;
-    }
-    memcpy(proc->name, start + 1, name_len);
-    proc->name[name_len] = '\0';
+    proc->name = strtab_intern_n(strtab_snapshot(), start + 1, (size_t)(end - start - 1));
     
     /* Parse fields after the comm */
     unsigned long vsize;
     long rss;
     unsigned long long starttime;
+    unsigned long long utime, stime;
     
     int thread_count_tmp;
     
     int parsed = sscanf(end + 2, 
         "%c %d %*d %*d %*d %*d %*u %*u %*u %*u %*u "
-        "%*u %*u %*d %*d %*d %*d %d %*d %llu %lu %ld",
+        "%llu %llu %*d %*d %*d %*d %d %*d %llu %lu %ld",
         &proc->state,
         &proc->ppid,
+        &utime,
+        &stime,
         &thread_count_tmp,
         &starttime,
         &vsize,
         &rss);
     
-    if (parsed < 6) return -1;
+    if (parsed < 8) return -1;
     
     proc->pid = pid;
+    proc->start_ticks = starttime;
     proc->thread_count = (uint32_t)thread_count_tmp;
+    proc->cpu_ticks = utime + stime;
     proc->vsize_bytes = vsize;
     proc->rss_bytes = rss * sysconf(_SC_PAGESIZE);
     
@@ -161,8 +461,14 @@ static int parse_proc_stat(pid_t pid, process_info_t *proc) {
     long ticks_per_sec = sysconf(_SC_CLK_TCK);
     time_t now = time(NULL);
     struct sysinfo si;
-    if (sysinfo(&si) == 0) {
-        time_t boot_time = now - si.uptime;
+    long uptime = -1;
+    if (pfs_active()) {
+        uptime = (long)g_pfs_uptime;    /* As recorded, not this host's */
+    } else if (sysinfo(&si) == 0) {
+        uptime = si.uptime;
+    }
+    if (uptime >= 0) {
+        time_t boot_time = now - uptime;
         proc->start_time = boot_time + (starttime / ticks_per_sec);
         proc->age_seconds = now - proc->start_time;
     }
@@ -180,33 +486,431 @@ static int parse_proc_stat(pid_t pid, process_info_t *proc) {
     return 0;
 }
 
+/* Read and parse /proc/[pid]/stat - open, one read, close */
+static int parse_proc_stat(pid_t pid, process_info_t *proc) {
+    char path[128];
+    char buf[2048];
+    
+    snprintf(path, sizeof(path), "/proc/%d/stat", pid);
+    
+    if (pfs_read(path, buf, sizeof(buf)) <= 0) return -1;
+    
+    return parse_stat_line(pid, buf, proc);
+}
+
+/* One process's stat line, outside a full listing */
+int probe_process_stat(pid_t pid, process_info_t *proc) {
+    memset(proc, 0, sizeof(*proc));
+    return parse_proc_stat(pid, proc);
+}
+
+/* Pick read_bytes/write_bytes out of a /proc/[pid]/io buffer */
+static void parse_io_buf(const char *buf, process_info_t *proc) {
+    const char *r = strstr(buf, "\nread_bytes: ");
+    const char *w = strstr(buf, "\nwrite_bytes: ");
+    if (r) proc->io_read_bytes = strtoull(r + 13, NULL, 10);
+    if (w) proc->io_write_bytes = strtoull(w + 14, NULL, 10);
+}
+
+/* Other users' io files need ptrace access; missing is not an error */
+static void read_proc_io(pid_t pid, process_info_t *proc) {
+    char path[64];
+    char buf[PROC_IO_SLOT_SIZE];
+    
+    snprintf(path, sizeof(path), "/proc/%d/io", pid);
+    if (pfs_read(path, buf, sizeof(buf)) <= 0) return;
+    parse_io_buf(buf, proc);
+}
+
+/* stat (and, for top-K, io) files read ahead of the per-pid items in
+ * procfs batches; both use the same slot per pid */
+typedef struct {
+    int pid;
+    int slot;
+} prefetch_entry_t;
+
+typedef struct {
+    prefetch_entry_t *index;    /* Sorted by pid */
+    int count;
+    char (*bufs)[PROCFS_SLOT_SIZE];
+    int *lens;
+    char (*io_bufs)[PROC_IO_SLOT_SIZE];  /* NULL when io was not prefetched */
+    int *io_lens;
+    int want_io;                /* Top-K is on: read io for every pid */
+} stat_prefetch_t;
+
+static int cmp_prefetch(const void *a, const void *b) {
+    int x = ((const prefetch_entry_t *)a)->pid;
+    int y = ((const prefetch_entry_t *)b)->pid;
+    return (x > y) - (x < y);
+}
+
+/* Slot of pid in the prefetch batch, or -1 */
+static int prefetch_slot(const stat_prefetch_t *pf, pid_t pid) {
+    if (!pf) return -1;
+    prefetch_entry_t key = { pid, 0 };
+    const prefetch_entry_t *e = bsearch(&key, pf->index, pf->count,
+                                        sizeof(key), cmp_prefetch);
+    return e ? e->slot : -1;
+}
+
+/* Returns the prefetched stat line for pid, or NULL to read it directly */
+static const char *prefetch_lookup(const stat_prefetch_t *pf, int slot) {
+    if (slot < 0) return NULL;
+    
+    /* A full buffer may be truncated - let the direct read handle it */
+    int len = pf->lens[slot];
+    if (len <= 0 || len >= PROCFS_SLOT_SIZE - 1) return NULL;
+    return pf->bufs[slot];
+}
+
+/* Probe a single process - the unit of work the watchdog times.
+ * ctx is an optional stat_prefetch_t. */
+static int probe_one_process(const void *ctx, int key, void *out) {
+    process_info_t *proc = out;
+    const stat_prefetch_t *pf = ctx;
+    int slot = prefetch_slot(pf, (pid_t)key);
+    const char *line = prefetch_lookup(pf, slot);
+    
+    if (line) {
+        if (parse_stat_line((pid_t)key, line, proc) != 0) return -1;
+    } else if (parse_proc_stat((pid_t)key, proc) != 0) {
+        return -1;
+    }
+    
+    if (pf && pf->want_io) {
+        if (slot >= 0 && pf->io_bufs) {
+            if (pf->io_lens[slot] > 0) parse_io_buf(pf->io_bufs[slot], proc);
+        } else {
+            read_proc_io((pid_t)key, proc);
+        }
+    }
+    
+    /* Count open file descriptors (and break them down if there are many) */
+    proc->open_fd_count = scan_fds((pid_t)key, proc);
+    return 0;
+}
+
 int probe_processes(process_info_t *procs, int max_procs, int *count) {
     if (!procs || !count) return -1;
     
     *count = 0;
     
-    DIR *proc_dir = opendir("/proc");
-    if (!proc_dir) return -1;
+    static int pids[MAX_PROCS];
+    int n = procfs_list_pids(pids, max_procs < MAX_PROCS ? max_procs : MAX_PROCS);
+    if (n < 0) return -1;
     
-    struct dirent *entry;
-    while ((entry = readdir(proc_dir)) != NULL && *count < max_procs) {
-        /* Skip non-numeric entries (not PIDs) */
-        if (!isdigit(entry->d_name[0])) continue;
-        
-        pid_t pid = atoi(entry->d_name);
-        if (pid <= 0) continue;
-        
+    for (int i = 0; i < n; i++) {
         process_info_t *proc = &procs[*count];
         memset(proc, 0, sizeof(*proc));
         
-        if (parse_proc_stat(pid, proc) == 0) {
-            /* Count open file descriptors */
-            proc->open_fd_count = count_fds(pid);
+        if (probe_one_process(NULL, pids[i], proc) == 0) {
             (*count)++;
         }
     }
     
-    closedir(proc_dir);
+    return 0;
+}
+
+/* Batch-read every pid's stat file up front when io_uring is in use,
+ * then run the per-pid items under the watchdog against that data.
+ * The batch gives up after one item's deadline. Without io_uring the
+ * batch would be plain reads on this thread with no watchdog over
+ * them, so each item reads its own files instead. The fd scan stays
+ * per-pid; pids missing from the batch are read directly. */
+static void run_process_items(fingerprint_t *fp, const int *pids, int count) {
+    static char bufs[MAX_PROCS][PROCFS_SLOT_SIZE];
+    static int lens[MAX_PROCS];
+    static char io_bufs[MAX_PROCS][PROC_IO_SLOT_SIZE];
+    static int io_lens[MAX_PROCS];
+    static prefetch_entry_t index[MAX_PROCS];
+    
+    if (count > MAX_PROCS) count = MAX_PROCS;
+    
+    /* Static: an abandoned worker may still hold ctx after we return */
+    static stat_prefetch_t pf;
+    pf.index = index;
+    pf.count = 0;
+    pf.bufs = bufs;
+    pf.lens = lens;
+    pf.io_bufs = NULL;
+    pf.io_lens = NULL;
+    pf.want_io = process_topk_get() > 0;
+    
+    if (procfs_batch_async()) {
+        procfs_read_batch(pids, count, "stat", &bufs[0][0], PROCFS_SLOT_SIZE, lens, NULL);
+        if (pf.want_io && procfs_batch_async()) {
+            procfs_read_batch(pids, count, "io", &io_bufs[0][0], PROC_IO_SLOT_SIZE, io_lens, NULL);
+            pf.io_bufs = io_bufs;
+            pf.io_lens = io_lens;
+        }
+        for (int i = 0; i < count; i++) {
+            index[i].pid = pids[i];
+            index[i].slot = i;
+        }
+        qsort(index, count, sizeof(index[0]), cmp_prefetch);
+        pf.count = count;
+    }
+    
+    watchdog_run_items(fp, "processes", probe_one_process, &pf,
+                       pids, count, fp->processes, sizeof(process_info_t),
+                       &fp->process_count);
+}
+
+/* ============================================================
+ * Per-Process Rates
+ * ============================================================
+ * CPU and I/O counters are cumulative, so rates need the previous
+ * cycle's values. Two static tables sorted by pid are swapped each
+ * cycle; a (pid, start_ticks) pair identifies a process across cycles
+ * so a recycled pid is treated as new. New processes, and the first
+ * cycle, fall back to the average over the process's lifetime.
+ */
+
+typedef struct {
+    pid_t pid;
+    uint64_t start_ticks;
+    uint64_t cpu_ticks;
+    uint64_t io_bytes;
+} rate_sample_t;
+
+static rate_sample_t g_rate_tables[2][MAX_PROCS];
+static int g_rate_counts[2];
+static int g_rate_prev = -1;
+static double g_rate_taken_s;
+
+static int cmp_rate_sample(const void *a, const void *b) {
+    pid_t x = ((const rate_sample_t *)a)->pid;
+    pid_t y = ((const rate_sample_t *)b)->pid;
+    return (x > y) - (x < y);
+}
+
+static void compute_process_rates(fingerprint_t *fp) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    double now = ts.tv_sec + ts.tv_nsec / 1e9;
+    double ticks_per_sec = (double)sysconf(_SC_CLK_TCK);
+    
+    int cur_idx = g_rate_prev < 0 ? 0 : 1 - g_rate_prev;
+    rate_sample_t *cur = g_rate_tables[cur_idx];
+    const rate_sample_t *prev = g_rate_prev < 0 ? NULL : g_rate_tables[g_rate_prev];
+    int prev_count = g_rate_prev < 0 ? 0 : g_rate_counts[g_rate_prev];
+    double interval = now - g_rate_taken_s;
+    
+    for (int i = 0; i < fp->process_count; i++) {
+        process_info_t *p = &fp->processes[i];
+        uint64_t io_bytes = p->io_read_bytes + p->io_write_bytes;
+        
+        cur[i].pid = p->pid;
+        cur[i].start_ticks = p->start_ticks;
+        cur[i].cpu_ticks = p->cpu_ticks;
+        cur[i].io_bytes = io_bytes;
+        
+        rate_sample_t key = { p->pid, 0, 0, 0 };
+        const rate_sample_t *old = prev && interval > 0
+            ? bsearch(&key, prev, prev_count, sizeof(key), cmp_rate_sample) : NULL;
+        
+        if (old && old->start_ticks == p->start_ticks &&
+            p->cpu_ticks >= old->cpu_ticks && io_bytes >= old->io_bytes) {
+            p->rate_seconds = interval;
+            p->cpu_percent = 100.0 * (p->cpu_ticks - old->cpu_ticks) / ticks_per_sec / interval;
+            p->io_bytes_per_sec = (io_bytes - old->io_bytes) / interval;
+        } else {
+            p->rate_seconds = p->age_seconds > 0 ? (double)p->age_seconds : 1.0;
+            p->cpu_percent = 100.0 * p->cpu_ticks / ticks_per_sec / p->rate_seconds;
+            p->io_bytes_per_sec = io_bytes / p->rate_seconds;
+        }
+    }
+    
+    qsort(cur, fp->process_count, sizeof(*cur), cmp_rate_sample);
+    g_rate_counts[cur_idx] = fp->process_count;
+    g_rate_prev = cur_idx;
+    g_rate_taken_s = now;
+}
+
+/* ============================================================
+ * Process Sampling
+ * ============================================================
+ * With 100k+ tasks even the cheap per-pid reads add up. In sampling
+ * mode /proc is only enumerated (getdents64, no per-pid work) and the
+ * expensive reads are done for:
+ *   A - every pid flagged notable last cycle (read in full), and
+ *   B - one rotating slice of the rest, picked by hash(pid) % cycles.
+ * Totals are A's exact count plus B's sample scaled to the number of
+ * pids outside A, with a finite-population 95% interval.
+ */
+
+static int g_sample_cycles = 0;
+static unsigned g_sample_cycle;
+static int g_sample_started = 0;
+
+/* Last cycle's notable pids, sorted for bsearch */
+static int g_notable[SAMPLE_NOTABLE_MAX];
+static int g_notable_count = 0;
+
+/* Every pid on the host - grows, never shrinks */
+static int *g_all_pids = NULL;
+static int g_all_cap = 0;
+
+void process_sampling_set(int cycles) {
+    g_sample_cycles = cycles > 0 ? cycles : 0;
+}
+
+/* Same tests as the JSON notable list, minus plain old age (which
+ * would carry every long-lived daemon forever) */
+static int is_notable(const process_info_t *p) {
+    return p->state == 'Z' ||
+           (p->open_fd_count > PROC_HIGH_FD && p->open_fd_count < PROC_FD_SANE_MAX) ||
+           p->is_potentially_stuck ||
+           p->rss_bytes / 1024 > PROC_HIGH_RSS_KB;
+}
+
+static int cmp_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static int in_notable(int pid) {
+    return bsearch(&pid, g_notable, g_notable_count, sizeof(int), cmp_int) != NULL;
+}
+
+/* Stable across cycles, so a pid stays in one slice for its lifetime */
+static unsigned pid_slice(int pid, int cycles) {
+    uint32_t h = (uint32_t)pid * 2654435761u;
+    return (h ^ (h >> 16)) % (unsigned)cycles;
+}
+
+/* Running sums for one metric over the B sample */
+typedef struct {
+    double exact;               /* Sum over A */
+    double sum;                 /* Sum over the B sample */
+    double sum_sq;
+} metric_acc_t;
+
+static void metric_add(metric_acc_t *m, int carried, double v) {
+    if (carried) {
+        m->exact += v;
+    } else {
+        m->sum += v;
+        m->sum_sq += v * v;
+    }
+}
+
+/* Scale a B-sample of n out of pop_b up, with a 95% interval */
+static sample_estimate_t metric_estimate(const metric_acc_t *m, int n, int pop_b,
+                                         int indicator) {
+    sample_estimate_t e;
+    
+    if (n <= 0 || pop_b <= 0) {
+        e.estimate = e.low = e.high = m->exact;
+        return e;
+    }
+    
+    double mean = m->sum / n;
+    double var = n > 1 ? (m->sum_sq - n * mean * mean) / (n - 1) : 0.0;
+    if (var < 0) var = 0;
+    double fpc = 1.0 - (double)n / pop_b;
+    double se = pop_b * sqrt(var / n * (fpc > 0 ? fpc : 0));
+    
+    e.estimate = m->exact + pop_b * mean;
+    e.low = e.estimate - SAMPLE_Z * se;
+    e.high = e.estimate + SAMPLE_Z * se;
+    
+    /* Never below what was actually seen */
+    if (e.low < m->exact + m->sum) e.low = m->exact + m->sum;
+    
+    if (indicator) {
+        /* None seen: the normal approximation says +-0, which is
+         * wrong - use the rule of three for the upper bound */
+        if (m->sum == 0 && n < pop_b) {
+            e.high = m->exact + pop_b * fmin(1.0, 3.0 / n);
+        }
+        if (e.high > m->exact + pop_b) e.high = m->exact + pop_b;
+    }
+    return e;
+}
+
+/* Probe the notable set and this cycle's slice into fp->processes */
+static int capture_processes_sampled(fingerprint_t *fp) {
+    static int pids[MAX_PROCS];
+    process_sampling_t *s = &fp->sampling;
+    
+    int population = procfs_list_pids_alloc(&g_all_pids, &g_all_cap);
+    if (population < 0) return -1;
+    
+    /* Start somewhere time-dependent so one-shot runs rotate too */
+    if (!g_sample_started) {
+        g_sample_cycle = (unsigned)(time(NULL) / 60);
+        g_sample_started = 1;
+    }
+    
+    /* First pass: how many pids sit outside the carried set */
+    int pop_a = 0;
+    for (int i = 0; i < population; i++) {
+        if (in_notable(g_all_pids[i])) pop_a++;
+    }
+    int pop_b = population - pop_a;
+    
+    /* Stretch the rotation if a slice would not fit the process table */
+    int room = MAX_PROCS - pop_a;
+    int cycles = g_sample_cycles;
+    if (room > 0 && (pop_b + room - 1) / room > cycles) {
+        cycles = (pop_b + room - 1) / room;
+    }
+    unsigned stratum = g_sample_cycle % (unsigned)cycles;
+    
+    /* Second pass: carried pids first, then the slice */
+    int n = 0;
+    for (int i = 0; i < population && n < MAX_PROCS; i++) {
+        if (in_notable(g_all_pids[i])) pids[n++] = g_all_pids[i];
+    }
+    for (int i = 0; i < population && n < MAX_PROCS; i++) {
+        int pid = g_all_pids[i];
+        if (!in_notable(pid) && pid_slice(pid, cycles) == stratum) pids[n++] = pid;
+    }
+    
+    run_process_items(fp, pids, n);
+    
+    /* Tally; pids that exited before their read are non-response */
+    metric_acc_t zombies = {0}, high_fd = {0}, stuck = {0}, threads = {0};
+    int sampled = 0, carried = 0;
+    int next_notable[SAMPLE_NOTABLE_MAX];
+    int next_count = 0;
+    
+    for (int i = 0; i < fp->process_count; i++) {
+        const process_info_t *p = &fp->processes[i];
+        int from_a = in_notable(p->pid);
+        
+        if (from_a) carried++; else sampled++;
+        metric_add(&zombies, from_a, p->state == 'Z');
+        metric_add(&high_fd, from_a, p->open_fd_count > PROC_HIGH_FD &&
+                                     p->open_fd_count < PROC_FD_SANE_MAX);
+        metric_add(&stuck, from_a, p->is_potentially_stuck);
+        metric_add(&threads, from_a, p->thread_count);
+        
+        if (is_notable(p) && next_count < SAMPLE_NOTABLE_MAX) {
+            next_notable[next_count++] = p->pid;
+        }
+    }
+    
+    s->enabled = 1;
+    s->cycles = cycles;
+    s->stratum = (int)stratum;
+    s->population = population;
+    s->sampled = sampled;
+    s->carried = carried;
+    s->zombies = metric_estimate(&zombies, sampled, pop_b, 1);
+    s->high_fd = metric_estimate(&high_fd, sampled, pop_b, 1);
+    s->stuck = metric_estimate(&stuck, sampled, pop_b, 1);
+    s->threads = metric_estimate(&threads, sampled, pop_b, 0);
+    fp->process_total = population;
+    
+    /* Carry this cycle's notable pids into the next one */
+    memcpy(g_notable, next_notable, next_count * sizeof(int));
+    g_notable_count = next_count;
+    qsort(g_notable, g_notable_count, sizeof(int), cmp_int);
+    g_sample_cycle++;
+    
     return 0;
 }
 
@@ -214,6 +918,28 @@ int probe_processes(process_info_t *procs, int max_procs, int *count) {
  * Config File Probing
  * ============================================================ */
 
+/* Probe a single config file; ctx is the path array */
+static int probe_one_config(const void *ctx, int key, void *out) {
+    const char *const *paths = ctx;
+    config_file_t *cfg = out;
+    
+    struct stat st;
+    if (pfs_stat(paths[key], &st) != 0) return -1;
+    
+    cfg->path = strtab_intern(strtab_snapshot(), paths[key]);
+    cfg->size = st.st_size;
+    cfg->mtime = st.st_mtime;
+    cfg->ctime = st.st_ctime;
+    cfg->permissions = st.st_mode;
+    cfg->owner = st.st_uid;
+    cfg->group = st.st_gid;
+    
+    /* Compute SHA256 checksum */
+    pfs_sha256_file(paths[key], cfg->checksum, sizeof(cfg->checksum));
+    
+    return 0;
+}
+
 int probe_config_files(const char **paths, int path_count,
                        config_file_t *configs, int *config_count) {
     if (!configs || !config_count) return -1;
@@ -221,24 +947,12 @@ int probe_config_files(const char **paths, int path_count,
     *config_count = 0;
     
     for (int i = 0; i < path_count && *config_count < MAX_CONFIG_FILES; i++) {
-        struct stat st;
-        if (stat(paths[i], &st) != 0) continue;
-        
         config_file_t *cfg = &configs[*config_count];
         memset(cfg, 0, sizeof(*cfg));
         
-        safe_strcpy(cfg->path, paths[i], sizeof(cfg->path));
-        cfg->size = st.st_size;
-        cfg->mtime = st.st_mtime;
-        cfg->ctime = st.st_ctime;
-        cfg->permissions = st.st_mode;
-        cfg->owner = st.st_uid;
-        cfg->group = st.st_gid;
-        
-        /* Compute SHA256 checksum */
-        sha256_file(paths[i], cfg->checksum, sizeof(cfg->checksum));
-        
-        (*config_count)++;
+        if (probe_one_config(paths, i, cfg) == 0) {
+            (*config_count)++;
+        }
     }
     
     return 0;
@@ -248,44 +962,130 @@ int probe_config_files(const char **paths, int path_count,
  * Full Fingerprint Capture
  * ============================================================ */
 
+const char *default_config_paths[] = {
+    "/etc/hosts",
+    "/etc/passwd",
+    "/etc/ssh/sshd_config",
+    "/etc/fstab",
+    "/etc/resolv.conf",
+    NULL
+};
+
 int fingerprint_init(fingerprint_t *fp) {
     if (!fp) return -1;
     memset(fp, 0, sizeof(*fp));
+    fp->strings = strtab_snapshot();
     return 0;
 }
 
+static int stage_system_info(void *arg, void *out) {
+    (void)arg;
+    return probe_system_info(out);
+}
+
+static int stage_cpu_stats(void *arg, void *out) {
+    (void)arg;
+    return probe_cpu_stats(out);
+}
+
+static int stage_network(void *arg, void *out) {
+    (void)arg;
+    return probe_network(out);
+}
+
+static int stage_tcp_stats(void *arg, void *out) {
+    (void)arg;
+    return probe_tcp_health(out);
+}
+
 int capture_fingerprint(fingerprint_t *fp, const char **config_paths,
                         int config_path_count) {
     if (!fp) return -1;
     
+    /* New snapshot, new strings (the memory is reused) */
+    strtab_reset(strtab_snapshot());
     fingerprint_init(fp);
     
     clock_t start = clock();
     
+    census_reset();
+    
     /* Capture system info */
-    if (probe_system_info(&fp->system) != 0) {
-        fp->probe_errors++;
+    if (watchdog_run_stage(fp, "system", stage_system_info, NULL,
+                           &fp->system, sizeof(fp->system)) != 0) {
+        /* Still need a timestamp for the output */
+        fp->system.probe_time = time(NULL);
     }
     
-    /* Capture process list */
-    if (probe_processes(fp->processes, MAX_PROCS, &fp->process_count) != 0) {
-        fp->probe_errors++;
+    /* Per-CPU utilisation - the first call samples a short window */
+    if (watchdog_run_stage(fp, "cpu", stage_cpu_stats, NULL,
+                           &fp->cpu, sizeof(fp->cpu)) != 0) {
+        memset(&fp->cpu, 0, sizeof(fp->cpu));
     }
     
+    /* Capture process list - each pid is timed on its own */
+    if (g_sample_cycles > 0) {
+        if (capture_processes_sampled(fp) != 0) {
+            probe_error_add(fp, "processes", -1, 0, "cannot list /proc");
+        } else {
+            aggregate_fd_census(fp);
+        }
+    } else {
+        static int pids[MAX_PROCS];
+        int pid_count = procfs_list_pids(pids, MAX_PROCS);
+        if (pid_count < 0) {
+            probe_error_add(fp, "processes", -1, 0, "cannot list /proc");
+        } else {
+            run_process_items(fp, pids, pid_count);
+            fp->process_total = fp->process_count;
+            aggregate_fd_census(fp);
+        }
+    }
+    compute_process_rates(fp);
+    leak_track_update(fp);
+    zombie_track_update(fp);
+    build_process_columns(fp);
+    select_top_consumers(fp);
+    
     /* Capture config files if specified */
     if (config_paths && config_path_count > 0) {
-        if (probe_config_files(config_paths, config_path_count,
-                               fp->configs, &fp->config_count) != 0) {
-            fp->probe_errors++;
-        }
+        static int keys[MAX_CONFIG_FILES];
+        int n = config_path_count < MAX_CONFIG_FILES ? config_path_count : MAX_CONFIG_FILES;
+        for (int i = 0; i < n; i++) keys[i] = i;
+        
+        /* config_paths is argv or static, so it outlives abandoned workers */
+        watchdog_run_items(fp, "configs", probe_one_config, config_paths,
+                           keys, n, fp->configs, sizeof(config_file_t),
+                           &fp->config_count);
     }
     
+    capture_plugins(fp);
+    
     clock_t end = clock();
     fp->probe_duration_ms = ((double)(end - start) / CLOCKS_PER_SEC) * 1000.0;
     
     return fp->probe_errors > 0 ? -1 : 0;
 }
 
+int capture_network(fingerprint_t *fp) {
+    if (!fp) return -1;
+    
+    /* Counters are cheap (two small reads), so they run every cycle */
+    if (watchdog_run_stage(fp, "tcp_stats", stage_tcp_stats, NULL,
+                           &fp->tcp_health, sizeof(fp->tcp_health)) == 0) {
+        tcp_health_delta(&fp->tcp_health);
+    } else {
+        memset(&fp->tcp_health, 0, sizeof(fp->tcp_health));
+    }
+    
+    if (watchdog_run_stage(fp, "network", stage_network, NULL,
+                           &fp->network, sizeof(fp->network)) != 0) {
+        memset(&fp->network, 0, sizeof(fp->network));
+        return -1;
+    }
+    return 0;
+}
+
 /* ============================================================
  * Quick Analysis - Deterministic Pre-checks
  * ============================================================ */
@@ -295,23 +1095,61 @@ int analyze_fingerprint_quick(const fingerprint_t *fp, quick_analysis_t *result)
     
     memset(result, 0, sizeof(*result));
     
-    for (int i = 0; i < fp->process_count; i++) {
-        const process_info_t *p = &fp->processes[i];
-        
-        /* Count zombies */
-        if (p->state == 'Z') {
-            result->zombie_process_count++;
-        }
-        
-        /* High FD count (potential leak) - only flag if we could actually read FDs */
-        /* Note: uint32 -1 wraps to ~4 billion, so add upper bound check */
-        if (p->open_fd_count > 100 && p->open_fd_count < 100000) {
-            result->high_fd_process_count++;
+    /* One pass per column over all MAX_PROCS rows (unused rows are
+     * zero and never match); each loop reads one contiguous array */
+    const process_columns_t *pc = &fp->proc_cols;
+    int zombies = 0, high_fd = 0, long_running = 0, high_memory = 0;
+    
+    for (int i = 0; i < MAX_PROCS; i++) {
+        zombies += pc->state[i] == 'Z';
+    }
+    /* High FD count (potential leak) - only if we could actually read
+     * the fds: uint32 -1 wraps to ~4 billion, hence the upper bound */
+    for (int i = 0; i < MAX_PROCS; i++) {
+        high_fd += pc->fd_count[i] - (PROC_HIGH_FD + 1) < PROC_FD_SANE_MAX - (PROC_HIGH_FD + 1);
+    }
+    for (int i = 0; i < MAX_PROCS; i++) {
+        long_running += pc->age_seconds[i] > PROC_LONG_RUNNING_SECS;
+    }
+    for (int i = 0; i < MAX_PROCS; i++) {
+        high_memory += pc->rss_kb[i] > PROC_HIGH_RSS_KB;
+    }
+    
+    result->zombie_process_count = zombies;
+    result->high_fd_process_count = high_fd;
+    result->long_running_process_count = long_running;
+    result->leak_suspects = fp->leaks.count;
+    result->high_memory_process_count = high_memory;
+    
+    /* Unlinked files still held open */
+    result->deleted_open_files = (int)fp->fd_census.deleted;
+    result->deleted_open_bytes = fp->fd_census.deleted_bytes;
+    
+    /* Saturated cores the load average hides (e.g. NET_RX pinned to cpu0) */
+    result->hottest_cpu = -1;
+    if (fp->cpu.available && fp->cpu.cpu_count > 1) {
+        double busy_sum = 0, softirq_sum = 0;
+        for (int i = 0; i < fp->cpu.cpu_count; i++) {
+            busy_sum += fp->cpu.cpus[i].busy_pct;
+            softirq_sum += fp->cpu.cpus[i].softirq_pct;
         }
+        double busy_mean = busy_sum / fp->cpu.cpu_count;
+        double softirq_mean = softirq_sum / fp->cpu.cpu_count;
         
-        /* Long-running processes (>7 days) */
-        if (p->age_seconds > 7 * 24 * 3600) {
-            result->long_running_process_count++;
+        for (int i = 0; i < fp->cpu.cpu_count; i++) {
+            const cpu_usage_t *c = &fp->cpu.cpus[i];
+            if (result->hottest_cpu < 0 || c->busy_pct > result->hottest_cpu_busy) {
+                result->hottest_cpu = c->cpu;
+                result->hottest_cpu_busy = c->busy_pct;
+            }
+            if (c->busy_pct >= CPU_HOT_BUSY_PCT &&
+                c->busy_pct - busy_mean >= CPU_HOT_GAP_PCT) {
+                result->imbalanced_cpus++;
+            }
+            if (c->softirq_pct >= CPU_SOFTIRQ_HOT_PCT &&
+                c->softirq_pct >= 2.0 * softirq_mean) {
+                result->softirq_hot_cpus++;
+            }
         }
     }
     
@@ -328,13 +1166,15 @@ int analyze_fingerprint_quick(const fingerprint_t *fp, quick_analysis_t *result)
     /* Network checks */
     result->unusual_listeners = fp->network.unusual_port_count;
     
-    /* Count external connections (non-localhost) */
+    /* Count external connections (non-localhost) - loopback ids are
+     * looked up once, then each connection is an integer compare */
+    str_id_t lo4 = strtab_find(fp->strings, "127.0.0.1");
+    str_id_t any4 = strtab_find(fp->strings, "0.0.0.0");
     for (int i = 0; i < fp->network.connection_count; i++) {
         const net_connection_t *c = &fp->network.connections[i];
         /* Check if remote address is not localhost */
-        if (strcmp(c->remote_addr, "127.0.0.1") != 0 &&
-            strcmp(c->remote_addr, "0.0.0.0") != 0 &&
-            strncmp(c->remote_addr, "00000000", 8) != 0) {
+        if (c->remote_addr != lo4 && c->remote_addr != any4 &&
+            strncmp(fp_str(fp, c->remote_addr), "00000000", 8) != 0) {
             result->external_connections++;
         }
     }
@@ -346,3 +1186,33 @@ int analyze_fingerprint_quick(const fingerprint_t *fp, quick_analysis_t *result)
     
     return 0;
 }
+
+int analysis_exit_code(const fingerprint_t *fp, const quick_analysis_t *a,
+                       int audit_risk_score) {
+    int exit_code = EXIT_OK;
+    
+    if (a->zombie_process_count > 0 || 
+        a->config_permission_issues > 0 ||
+        a->unusual_listeners > 3) {
+        exit_code = EXIT_CRITICAL;
+    } else if (a->high_fd_process_count > 5 ||
+               a->unusual_listeners > 0) {
+        exit_code = EXIT_WARNINGS;
+    }
+    
+    /* So can detection rules */
+    if (fp->rules.critical > 0) {
+        exit_code = EXIT_CRITICAL;
+    } else if (fp->rules.warnings > 0 && exit_code < EXIT_WARNINGS) {
+        exit_code = EXIT_WARNINGS;
+    }
+    
+    /* Audit can also trigger critical */
+    if (audit_risk_score >= 16) {  /* high or critical */
+        exit_code = EXIT_CRITICAL;
+    } else if (audit_risk_score >= 6 && exit_code < EXIT_WARNINGS) {
+        exit_code = EXIT_WARNINGS;
+    }
+    
+    return exit_code;
+}
@@ -66,7 +66,7 @@ static int read_proc_stat(pid_t pid, char *comm, size_t comm_len, pid_t *ppid) {
     char buf[512];
     
     snprintf(path, sizeof(path), "/proc/%d/stat", pid);
-    FILE *fp = fopen(path, "r");
+    FILE *fp = pfs_fopen(path);
     if (!fp) return -1;
     
     if (!fgets(buf, sizeof(buf), fp)) {
@@ -105,7 +105,7 @@ static pid_t get_ppid_fallback(pid_t pid) {
     char line[256];
     
     snprintf(path, sizeof(path), "/proc/%d/status", pid);
-    FILE *fp = fopen(path, "r");
+    FILE *fp = pfs_fopen(path);
     if (!fp) return -1;
     
     pid_t ppid = -1;
@@ -0,0 +1,557 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * procfs.c - Batched /proc file reads, via io_uring where available
+ *
+ * A plain read of /proc/<pid>/stat is three syscalls (openat, read,
+ * close), so a full scan of N processes is 3N syscalls. With io_uring
+ * each file becomes a linked openat -> read -> close chain into a
+ * fixed-file slot, and a whole batch of chains is submitted and reaped
+ * with one io_uring_enter(). Kernels without io_uring (or with it
+ * disabled by sysctl/seccomp) fall back to the synchronous path.
+ *
+ * Directory walks go through getdents64() directly into a large
+ * per-thread buffer: no DIR allocation, no 32 KB readdir refills, and
+ * numeric names are parsed in the same pass that validates them.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#include "sentinel.h"
+
+/* Submission queue size; a batch is a third of it (three ops per file) */
+#define URING_ENTRIES 384
+#define URING_BATCH (URING_ENTRIES / 3)
+
+/* user_data: slot in the batch, and which op of the chain */
+#define UD_OPEN  0
+#define UD_READ  1
+#define UD_CLOSE 2
+#define UD_MAKE(slot, op) (((uint64_t)(slot) << 2) | (op))
+#define UD_SLOT(ud) ((int)((ud) >> 2))
+#define UD_OP(ud) ((int)((ud) & 3))
+
+typedef struct {
+    int fd;
+    unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *sq_ptr, *cq_ptr;
+    size_t sq_size, cq_size, sqes_size;
+    int single_mmap;
+
+    /* Reads land here, not in the caller's buffers, so a ring that is
+     * abandoned with reads still in flight can only scribble on memory
+     * we have deliberately leaked */
+    char *scratch;
+    size_t slot_size;
+    char paths[URING_BATCH][48];
+} uring_t;
+
+static procfs_backend_t g_backend = PROCFS_BACKEND_AUTO;
+static uring_t *g_ring = NULL;
+static int g_uring_broken = 0;      /* Setup failed or a batch timed out */
+
+void procfs_set_backend(procfs_backend_t backend) {
+    g_backend = backend;
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+/* ============================================================
+ * Directory enumeration (getdents64)
+ * ============================================================ */
+
+/* getdents64 record layout - not exported by glibc */
+struct linux_dirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
+/* One buffer per nesting level per thread (the socket index walks
+ * /proc and each /proc/<pid>/fd inside it). Watchdog workers are new
+ * threads every cycle, so a thread's set goes back to a small pool at
+ * exit and the next thread takes it, buffers and all; only sets beyond
+ * the pool are freed. */
+typedef struct {
+    char *bufs[PROCFS_WALK_DEPTH];
+    int depth;
+} dirbuf_set_t;
+
+static pthread_key_t g_dirbuf_key;
+static pthread_once_t g_dirbuf_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t g_dirbuf_lock = PTHREAD_MUTEX_INITIALIZER;
+static dirbuf_set_t *g_dirbuf_pool[PROCFS_DIRBUF_POOL];
+static int g_dirbuf_pooled = 0;
+
+static void dirbuf_free(void *p) {
+    dirbuf_set_t *set = p;
+    set->depth = 0;
+
+    pthread_mutex_lock(&g_dirbuf_lock);
+    if (g_dirbuf_pooled < PROCFS_DIRBUF_POOL) {
+        g_dirbuf_pool[g_dirbuf_pooled++] = set;
+        set = NULL;
+    }
+    pthread_mutex_unlock(&g_dirbuf_lock);
+
+    if (set) {
+        for (int i = 0; i < PROCFS_WALK_DEPTH; i++) free(set->bufs[i]);
+        free(set);
+    }
+}
+
+static void dirbuf_key_init(void) {
+    pthread_key_create(&g_dirbuf_key, dirbuf_free);
+}
+
+static dirbuf_set_t *dirbuf_set(void) {
+    pthread_once(&g_dirbuf_once, dirbuf_key_init);
+    dirbuf_set_t *set = pthread_getspecific(g_dirbuf_key);
+    if (set) return set;
+
+    pthread_mutex_lock(&g_dirbuf_lock);
+    if (g_dirbuf_pooled > 0) set = g_dirbuf_pool[--g_dirbuf_pooled];
+    pthread_mutex_unlock(&g_dirbuf_lock);
+
+    if (!set) set = calloc(1, sizeof(*set));
+    if (set) pthread_setspecific(g_dirbuf_key, set);
+    return set;
+}
+
+int procfs_parse_uint(const char *name) {
+    if (*name < '0' || *name > '9') return -1;
+    int v = 0;
+    for (; *name; name++) {
+        unsigned d = (unsigned)(*name - '0');
+        if (d > 9 || v > (0x7fffffff - 9) / 10) return -1;
+        v = v * 10 + (int)d;
+    }
+    return v;
+}
+
+int procfs_walk_dir(int dirfd, procfs_dirent_fn fn, void *arg) {
+    if (pfs_active()) return pfs_walk_dir(dirfd, fn, arg);
+
+    dirbuf_set_t *set = dirbuf_set();
+    if (!set || set->depth >= PROCFS_WALK_DEPTH) return -1;
+
+    char **slot = &set->bufs[set->depth];
+    if (!*slot && !(*slot = malloc(PROCFS_DIRBUF_SIZE))) return -1;
+    char *buf = *slot;
+    set->depth++;
+
+    int count = 0;
+    int stop = 0;
+    while (!stop) {
+        long n = syscall(SYS_getdents64, dirfd, buf, PROCFS_DIRBUF_SIZE);
+        if (n <= 0) break;
+
+        for (long off = 0; off < n && !stop; ) {
+            struct linux_dirent64 *d = (struct linux_dirent64 *)(buf + off);
+            off += d->d_reclen;
+
+            /* Skip "." and ".." */
+            if (d->d_name[0] == '.' &&
+                (d->d_name[1] == '\0' || (d->d_name[1] == '.' && d->d_name[2] == '\0'))) {
+                continue;
+            }
+            count++;
+            if (fn) stop = fn(dirfd, d->d_name, d->d_type, arg);
+        }
+    }
+
+    set->depth--;
+    return count;
+}
+
+int procfs_count_dir(int dirfd) {
+    return procfs_walk_dir(dirfd, NULL, NULL);
+}
+
+typedef struct {
+    int *pids;
+    int count;
+    int max;
+    int **grow;                 /* Non-NULL: realloc *grow as needed */
+    int *cap;
+} pid_collect_t;
+
+static int collect_pid(int dirfd, const char *name, unsigned char type, void *arg) {
+    (void)dirfd;
+    pid_collect_t *pc = arg;
+
+    if (type != DT_DIR && type != DT_UNKNOWN) return 0;
+    int pid = procfs_parse_uint(name);
+    if (pid <= 0) return 0;
+
+    if (pc->count == pc->max) {
+        if (!pc->grow) return 1;
+        int cap = *pc->cap ? *pc->cap * 2 : 4096;
+        int *p = realloc(*pc->grow, (size_t)cap * sizeof(int));
+        if (!p) return 1;
+        *pc->grow = pc->pids = p;
+        *pc->cap = pc->max = cap;
+    }
+    pc->pids[pc->count++] = pid;
+    return 0;
+}
+
+static int list_pids(pid_collect_t *pc) {
+    int dirfd = pfs_opendir("/proc");
+    if (dirfd < 0) return -1;
+    int rc = procfs_walk_dir(dirfd, collect_pid, pc);
+    pfs_closedir(dirfd);
+    return rc < 0 ? -1 : pc->count;
+}
+
+int procfs_list_pids(int *pids, int max) {
+    pid_collect_t pc = { pids, 0, max, NULL, NULL };
+    return list_pids(&pc);
+}
+
+int procfs_list_pids_alloc(int **pids, int *cap) {
+    pid_collect_t pc = { *pids, 0, *cap, pids, cap };
+    return list_pids(&pc);
+}
+
+/* ============================================================
+ * io_uring plumbing (raw syscalls - no liburing dependency)
+ * ============================================================ */
+
+static void ring_unmap(uring_t *r) {
+    if (r->sqes) munmap(r->sqes, r->sqes_size);
+    if (r->cq_ptr && !r->single_mmap) munmap(r->cq_ptr, r->cq_size);
+    if (r->sq_ptr) munmap(r->sq_ptr, r->sq_size);
+    if (r->fd >= 0) close(r->fd);
+}
+
+static uring_t *ring_create(size_t slot_size) {
+    uring_t *r = calloc(1, sizeof(*r));
+    if (!r) return NULL;
+    r->fd = -1;
+
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    r->fd = (int)syscall(__NR_io_uring_setup, URING_ENTRIES, &p);
+    if (r->fd < 0) goto fail;
+
+    /* EXT_ARG (5.11+) lets us bound the wait; every op we use predates it */
+    if (!(p.features & IORING_FEAT_EXT_ARG)) goto fail;
+
+    r->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    r->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    r->single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (r->single_mmap && r->cq_size > r->sq_size) r->sq_size = r->cq_size;
+
+    r->sq_ptr = mmap(NULL, r->sq_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+    if (r->sq_ptr == MAP_FAILED) { r->sq_ptr = NULL; goto fail; }
+
+    if (r->single_mmap) {
+        r->cq_ptr = r->sq_ptr;
+    } else {
+        r->cq_ptr = mmap(NULL, r->cq_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+        if (r->cq_ptr == MAP_FAILED) { r->cq_ptr = NULL; goto fail; }
+    }
+
+    r->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes = mmap(NULL, r->sqes_size, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+    if (r->sqes == MAP_FAILED) { r->sqes = NULL; goto fail; }
+
+    char *sq = r->sq_ptr, *cq = r->cq_ptr;
+    r->sq_head = (unsigned *)(sq + p.sq_off.head);
+    r->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+    r->sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+    r->sq_array = (unsigned *)(sq + p.sq_off.array);
+    r->cq_head = (unsigned *)(cq + p.cq_off.head);
+    r->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+    r->cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+    r->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+    /* Sparse fixed-file table: openat installs straight into a slot and
+     * read/close use it, so no fd ever enters our descriptor table */
+    int fds[URING_BATCH];
+    for (int i = 0; i < URING_BATCH; i++) fds[i] = -1;
+    if (syscall(__NR_io_uring_register, r->fd, IORING_REGISTER_FILES,
+                fds, URING_BATCH) < 0) {
+        goto fail;
+    }
+
+    r->slot_size = slot_size;
+    r->scratch = malloc(URING_BATCH * slot_size);
+    if (!r->scratch) goto fail;
+
+    return r;
+
+fail:
+    ring_unmap(r);
+    free(r);
+    return NULL;
+}
+
+static void ring_destroy(uring_t *r, int leak_scratch) {
+    ring_unmap(r);
+    if (!leak_scratch) free(r->scratch);
+    free(r);
+}
+
+static struct io_uring_sqe *ring_sqe(uring_t *r, unsigned *tail) {
+    unsigned idx = *tail & *r->sq_mask;
+    struct io_uring_sqe *sqe = &r->sqes[idx];
+    memset(sqe, 0, sizeof(*sqe));
+    r->sq_array[idx] = idx;
+    (*tail)++;
+    return sqe;
+}
+
+/* Read one batch (<= URING_BATCH files). Returns 0, or -1 if the
+ * deadline passed with completions outstanding. */
+static int ring_read_batch(uring_t *r, const int *pids, int count, const char *name,
+                           char *bufs, size_t buf_size, int *lens,
+                           double deadline_ms, uint64_t *syscalls) {
+    size_t slot = buf_size < r->slot_size ? buf_size : r->slot_size;
+    unsigned tail = *r->sq_tail;
+
+    for (int i = 0; i < count; i++) {
+        snprintf(r->paths[i], sizeof(r->paths[i]), "/proc/%d/%s", pids[i], name);
+        lens[i] = -1;
+
+        struct io_uring_sqe *sqe = ring_sqe(r, &tail);
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = (uint64_t)(uintptr_t)r->paths[i];
+        sqe->open_flags = O_RDONLY;         /* O_CLOEXEC is EINVAL for direct fds */
+        sqe->file_index = i + 1;            /* 1-based; 0 means "normal fd" */
+        sqe->flags = IOSQE_IO_LINK;
+        sqe->user_data = UD_MAKE(i, UD_OPEN);
+
+        /* Hard link so the close still runs if the read fails */
+        sqe = ring_sqe(r, &tail);
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = i;
+        sqe->addr = (uint64_t)(uintptr_t)(r->scratch + (size_t)i * r->slot_size);
+        sqe->len = (unsigned)(slot - 1);
+        sqe->off = 0;
+        sqe->flags = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK;
+        sqe->user_data = UD_MAKE(i, UD_READ);
+
+        sqe = ring_sqe(r, &tail);
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->file_index = i + 1;
+        sqe->user_data = UD_MAKE(i, UD_CLOSE);
+    }
+    __atomic_store_n(r->sq_tail, tail, __ATOMIC_RELEASE);
+
+    unsigned to_submit = (unsigned)count * 3;
+    unsigned outstanding = to_submit;
+
+    while (outstanding > 0) {
+        double left = deadline_ms - now_ms();
+        if (left <= 0) return -1;
+
+        struct __kernel_timespec ts;
+        ts.tv_sec = (long long)(left / 1000);
+        ts.tv_nsec = (long long)((left - ts.tv_sec * 1000.0) * 1e6);
+        struct io_uring_getevents_arg arg;
+        memset(&arg, 0, sizeof(arg));
+        arg.ts = (uint64_t)(uintptr_t)&ts;
+
+        long rc = syscall(__NR_io_uring_enter, r->fd, to_submit, outstanding,
+                          IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                          &arg, sizeof(arg));
+        (*syscalls)++;
+        if (rc < 0 && errno != ETIME && errno != EINTR && errno != EAGAIN) {
+            return -1;
+        }
+        if (rc > 0) to_submit -= (unsigned)rc < to_submit ? (unsigned)rc : to_submit;
+
+        unsigned head = *r->cq_head;
+        unsigned ctail = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+        while (head != ctail) {
+            struct io_uring_cqe *cqe = &r->cqes[head & *r->cq_mask];
+            int i = UD_SLOT(cqe->user_data);
+
+            if (UD_OP(cqe->user_data) == UD_READ && cqe->res >= 0 && i < count) {
+                char *dst = bufs + (size_t)i * buf_size;
+                memcpy(dst, r->scratch + (size_t)i * r->slot_size, (size_t)cqe->res);
+                dst[cqe->res] = '\0';
+                lens[i] = cqe->res;
+            }
+            head++;
+            outstanding--;
+        }
+        __atomic_store_n(r->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    return 0;
+}
+
+/* ============================================================
+ * Public API
+ * ============================================================ */
+
+static int read_batch_sync(const int *pids, int count, const char *name,
+                           char *bufs, size_t buf_size, int *lens,
+                           uint64_t *syscalls) {
+    int ok = 0;
+    char path[64];
+
+    for (int i = 0; i < count; i++) {
+        lens[i] = -1;
+        snprintf(path, sizeof(path), "/proc/%d/%s", pids[i], name);
+
+        char *dst = bufs + (size_t)i * buf_size;
+        ssize_t n = pfs_read(path, dst, buf_size);
+        if (n < 0) {
+            (*syscalls)++;
+            continue;
+        }
+        *syscalls += 3;
+        lens[i] = (int)n;
+        ok++;
+    }
+    return ok;
+}
+
+int procfs_uring_available(void) {
+    if (g_uring_broken) return 0;
+    if (!g_ring) {
+        g_ring = ring_create(PROCFS_SLOT_SIZE);
+        if (!g_ring) {
+            g_uring_broken = 1;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int procfs_batch_async(void) {
+    /* Recording and replay go through pfs_read() */
+    return g_backend != PROCFS_BACKEND_SYNC && !pfs_active() &&
+           procfs_uring_available();
+}
+
+int procfs_read_batch(const int *pids, int count, const char *name,
+                      char *bufs, size_t buf_size, int *lens,
+                      procfs_stats_t *stats) {
+    procfs_stats_t local;
+    if (!stats) stats = &local;
+    memset(stats, 0, sizeof(*stats));
+
+    double start = now_ms();
+    if (!procfs_batch_async()) {
+        stats->backend = PROCFS_BACKEND_SYNC;
+        int ok = read_batch_sync(pids, count, name, bufs, buf_size, lens, &stats->syscalls);
+        stats->files = (uint64_t)count;
+        stats->wall_ms = now_ms() - start;
+        return ok;
+    }
+
+    stats->backend = PROCFS_BACKEND_URING;
+    /* Callers run the batch ahead of per-item watchdog work, so it gets
+     * no longer than one item would */
+    int budget_ms = watchdog_item_deadline_ms();
+    if (budget_ms > PROCFS_BATCH_DEADLINE_MS) budget_ms = PROCFS_BATCH_DEADLINE_MS;
+    double deadline = start + budget_ms;
+    int done = 0;
+
+    while (done < count) {
+        int n = count - done < URING_BATCH ? count - done : URING_BATCH;
+        if (ring_read_batch(g_ring, pids + done, n, name,
+                            bufs + (size_t)done * buf_size, buf_size, lens + done,
+                            deadline, &stats->syscalls) != 0) {
+            /* A read is stuck in the kernel. Tear the ring down, keeping
+             * its scratch alive for the straggler, and stay synchronous -
+             * the caller's per-item watchdog copes with what is left. */
+            ring_destroy(g_ring, 1);
+            g_ring = NULL;
+            g_uring_broken = 1;
+            for (int i = done + n; i < count; i++) lens[i] = -1;
+            break;
+        }
+        done += n;
+    }
+
+    int ok = 0;
+    for (int i = 0; i < count; i++) {
+        if (lens[i] >= 0) ok++;
+    }
+    stats->files = (uint64_t)count;
+    stats->wall_ms = now_ms() - start;
+    return ok;
+}
+
+/* ============================================================
+ * Benchmark (--bench-procfs)
+ * ============================================================ */
+
+int procfs_benchmark(int rounds) {
+    static int pids[MAX_PROCS];
+    static char bufs[MAX_PROCS][PROCFS_SLOT_SIZE];
+    static int lens[MAX_PROCS];
+
+    int count = procfs_list_pids(pids, MAX_PROCS);
+    if (count < 0) return -1;
+
+    if (rounds < 1) rounds = 1;
+    printf("procfs read benchmark: /proc/<pid>/stat x %d processes, %d rounds\n",
+           count, rounds);
+
+    const procfs_backend_t backends[] = { PROCFS_BACKEND_SYNC, PROCFS_BACKEND_URING };
+    const char *names[] = { "sync", "io_uring" };
+    procfs_backend_t saved = g_backend;
+
+    for (int b = 0; b < 2; b++) {
+        if (backends[b] == PROCFS_BACKEND_URING && !procfs_uring_available()) {
+            printf("  %-9s unavailable on this kernel (fell back to sync)\n", names[b]);
+            continue;
+        }
+        g_backend = backends[b];
+
+        double wall = 0;
+        uint64_t syscalls = 0;
+        int ok = 0;
+        for (int r = 0; r < rounds; r++) {
+            procfs_stats_t st;
+            ok = procfs_read_batch(pids, count, "stat", &bufs[0][0],
+                                   PROCFS_SLOT_SIZE, lens, &st);
+            wall += st.wall_ms;
+            syscalls += st.syscalls;
+        }
+        printf("  %-9s %6.2f ms/round  %7.1f syscalls/round  %5.2f us/file  (%d read)\n",
+               names[b], wall / rounds, (double)syscalls / rounds,
+               count ? 1000.0 * wall / rounds / count : 0.0, ok);
+    }
+
+    g_backend = saved;
+    return 0;
+}
@@ -0,0 +1,975 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * rules.c - Declarative detection rules over fingerprint fields
+ *
+ * Rules live in a text file (~/.sentinel/rules or --rules FILE), one
+ * per line:
+ *
+ *   rule <name> <info|warning|critical> when <expression>
+ *
+ *   rule zombie_farm critical when count(processes where state == "Z") > 20
+ *   rule load_high   warning  when system.load1 > cpu.count * 2
+ *   rule java_heap   warning  when sum(processes.rss where name == "java") > 8G
+ *
+ * Expressions have numbers (with K/M/G/T byte and s/m/h/d time
+ * suffixes), scalar fields (system.load1), and aggregates - count, sum,
+ * min, max, avg - over the processes, listeners, connections and
+ * configs collections, with an optional "where" filter on row fields.
+ * min/max/avg of an empty set are NaN, so a comparison on one is false.
+ * A rule over listeners, connections or network.* makes the network
+ * probe run even without --network.
+ *
+ * Each rule is compiled at load into postfix bytecode for a small stack
+ * machine; every aggregate becomes a separate predicate/value program.
+ * Evaluation makes one pass per collection, running all of that
+ * collection's aggregate programs on each row, then runs each rule's
+ * program against the aggregate results. String literals are looked
+ * up in the snapshot's string table once per evaluation, so comparing
+ * an interned field is an integer compare.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "sentinel.h"
+
+#define RULE_CODE_MAX 16384         /* Instructions, all rules */
+#define RULE_PROG_MAX 256           /* Instructions in one program */
+#define RULE_AGGS_MAX 1024
+#define RULE_STRINGS_MAX 512
+#define RULE_CONSTS_MAX 2048
+#define RULE_STACK_MAX 32
+#define RULE_LINE_MAX 1024
+
+/* ============================================================
+ * Fields
+ * ============================================================ */
+
+typedef enum {
+    COLL_PROCESSES,
+    COLL_LISTENERS,
+    COLL_CONNECTIONS,
+    COLL_CONFIGS,
+    COLL_COUNT,
+    COLL_NONE = 0xFF
+} rule_collection_t;
+
+static const char *collection_names[COLL_COUNT] = {
+    "processes", "listeners", "connections", "configs"
+};
+
+typedef enum {
+    TYPE_NUM,
+    TYPE_STR,                   /* Interned str_id_t */
+    TYPE_TEXT,                  /* char[] in the struct */
+    TYPE_CHAR,                  /* Single character, e.g. process state */
+    TYPE_LITERAL                /* String literal, until a comparison types it */
+} rule_type_t;
+
+typedef enum {
+    F_PROC_PID, F_PROC_PPID, F_PROC_NAME, F_PROC_STATE, F_PROC_RSS,
+    F_PROC_VSIZE, F_PROC_FDS, F_PROC_THREADS, F_PROC_AGE, F_PROC_CPU,
+    F_PROC_IO, F_PROC_STUCK,
+    F_LIS_PORT, F_LIS_ADDR, F_LIS_PROTO, F_LIS_PID, F_LIS_PROCESS,
+    F_CONN_LPORT, F_CONN_RPORT, F_CONN_RADDR, F_CONN_PROTO, F_CONN_STATE,
+    F_CONN_PID, F_CONN_PROCESS,
+    F_CFG_PATH, F_CFG_MODE, F_CFG_WORLD_WRITABLE, F_CFG_SIZE, F_CFG_OWNER, F_CFG_AGE,
+    F_COUNT
+} rule_field_t;
+
+typedef struct {
+    const char *name;
+    uint8_t collection;
+    uint8_t type;
+} field_def_t;
+
+static const field_def_t fields[F_COUNT] = {
+    [F_PROC_PID]     = { "pid",         COLL_PROCESSES,  TYPE_NUM },
+    [F_PROC_PPID]    = { "ppid",        COLL_PROCESSES,  TYPE_NUM },
+    [F_PROC_NAME]    = { "name",        COLL_PROCESSES,  TYPE_STR },
+    [F_PROC_STATE]   = { "state",       COLL_PROCESSES,  TYPE_CHAR },
+    [F_PROC_RSS]     = { "rss",         COLL_PROCESSES,  TYPE_NUM },
+    [F_PROC_VSIZE]   = { "vsize",       COLL_PROCESSES,  TYPE_NUM },
+    [F_PROC_FDS]     = { "fds",         COLL_PROCESSES,  TYPE_NUM },
+    [F_PROC_THREADS] = { "threads",     COLL_PROCESSES,  TYPE_NUM },
+    [F_PROC_AGE]     = { "age",         COLL_PROCESSES,  TYPE_NUM },
+    [F_PROC_CPU]     = { "cpu",         COLL_PROCESSES,  TYPE_NUM },
+    [F_PROC_IO]      = { "io",          COLL_PROCESSES,  TYPE_NUM },
+    [F_PROC_STUCK]   = { "stuck",       COLL_PROCESSES,  TYPE_NUM },
+    [F_LIS_PORT]     = { "port",        COLL_LISTENERS,  TYPE_NUM },
+    [F_LIS_ADDR]     = { "addr",        COLL_LISTENERS,  TYPE_STR },
+    [F_LIS_PROTO]    = { "proto",       COLL_LISTENERS,  TYPE_TEXT },
+    [F_LIS_PID]      = { "pid",         COLL_LISTENERS,  TYPE_NUM },
+    [F_LIS_PROCESS]  = { "process",     COLL_LISTENERS,  TYPE_STR },
+    [F_CONN_LPORT]   = { "local_port",  COLL_CONNECTIONS, TYPE_NUM },
+    [F_CONN_RPORT]   = { "remote_port", COLL_CONNECTIONS, TYPE_NUM },
+    [F_CONN_RADDR]   = { "remote_addr", COLL_CONNECTIONS, TYPE_STR },
+    [F_CONN_PROTO]   = { "proto",       COLL_CONNECTIONS, TYPE_TEXT },
+    [F_CONN_STATE]   = { "state",       COLL_CONNECTIONS, TYPE_TEXT },
+    [F_CONN_PID]     = { "pid",         COLL_CONNECTIONS, TYPE_NUM },
+    [F_CONN_PROCESS] = { "process",     COLL_CONNECTIONS, TYPE_STR },
+    [F_CFG_PATH]     = { "path",        COLL_CONFIGS,    TYPE_STR },
+    [F_CFG_MODE]     = { "mode",        COLL_CONFIGS,    TYPE_NUM },
+    [F_CFG_WORLD_WRITABLE] = { "world_writable", COLL_CONFIGS, TYPE_NUM },
+    [F_CFG_SIZE]     = { "size",        COLL_CONFIGS,    TYPE_NUM },
+    [F_CFG_OWNER]    = { "owner",       COLL_CONFIGS,    TYPE_NUM },
+    [F_CFG_AGE]      = { "age",         COLL_CONFIGS,    TYPE_NUM },
+};
+
+typedef enum {
+    S_LOAD1, S_LOAD5, S_LOAD15, S_UPTIME, S_MEM_TOTAL, S_MEM_USED_PCT,
+    S_CPU_COUNT, S_CPU_BUSY, S_CPU_IOWAIT, S_CPU_STEAL,
+    S_PROC_TOTAL, S_NET_LISTENERS, S_NET_CONNECTIONS, S_NET_UNUSUAL,
+    S_TCP_RETRANS, S_FD_DELETED, S_FD_DELETED_BYTES,
+    S_LEAKS, S_ZOMBIE_PARENTS, S_ZOMBIE_REAP_MAX, S_PROBE_ERRORS,
+    S_COUNT
+} rule_scalar_t;
+
+static const char *scalar_names[S_COUNT] = {
+    [S_LOAD1]            = "system.load1",
+    [S_LOAD5]            = "system.load5",
+    [S_LOAD15]           = "system.load15",
+    [S_UPTIME]           = "system.uptime",
+    [S_MEM_TOTAL]        = "system.mem_total",
+    [S_MEM_USED_PCT]     = "system.mem_used_pct",
+    [S_CPU_COUNT]        = "cpu.count",
+    [S_CPU_BUSY]         = "cpu.busy_pct",
+    [S_CPU_IOWAIT]       = "cpu.iowait_pct",
+    [S_CPU_STEAL]        = "cpu.steal_pct",
+    [S_PROC_TOTAL]       = "processes.total",
+    [S_NET_LISTENERS]    = "network.listeners",
+    [S_NET_CONNECTIONS]  = "network.connections",
+    [S_NET_UNUSUAL]      = "network.unusual_ports",
+    [S_TCP_RETRANS]      = "tcp.retrans_pct",
+    [S_FD_DELETED]       = "fds.deleted",
+    [S_FD_DELETED_BYTES] = "fds.deleted_bytes",
+    [S_LEAKS]            = "leaks.count",
+    [S_ZOMBIE_PARENTS]   = "zombies.parents",
+    [S_ZOMBIE_REAP_MAX]  = "zombies.reap_max",
+    [S_PROBE_ERRORS]     = "probe.errors",
+};
+
+/* ============================================================
+ * Bytecode
+ * ============================================================ */
+
+typedef enum {
+    OP_END,
+    OP_CONST,                   /* push consts[b] */
+    OP_SCALAR,                  /* push scalar a */
+    OP_FIELD,                   /* push field a of the current row */
+    OP_STR,                     /* push the str_id of strings[b] */
+    OP_AGG,                     /* push aggregate b */
+    OP_TEXT_EQ,                 /* push strcmp(field a, strings[b]) == 0 */
+    OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_NEG,
+    OP_EQ, OP_NE, OP_LT, OP_LE, OP_GT, OP_GE,
+    OP_AND, OP_OR, OP_NOT
+} rule_op_t;
+
+typedef struct {
+    uint8_t op;
+    uint8_t a;
+    uint16_t b;
+} rule_insn_t;
+
+typedef enum { AGG_COUNT, AGG_SUM, AGG_MIN, AGG_MAX, AGG_AVG } rule_agg_kind_t;
+
+static const char *agg_names[] = { "count", "sum", "min", "max", "avg" };
+
+typedef struct {
+    uint8_t kind;
+    uint8_t collection;
+    int32_t pred;               /* Code offset, -1 = every row */
+    int32_t value;              /* Code offset, -1 for count */
+} rule_agg_t;
+
+typedef struct {
+    char name[RULE_NAME_LEN];
+    char text[RULE_TEXT_LEN];   /* The expression, for reports */
+    rule_severity_t severity;
+    int32_t code;
+} rule_t;
+
+/* The loaded rule set */
+static rule_t g_rules[RULES_MAX];
+static int g_rule_count;
+static rule_insn_t g_code[RULE_CODE_MAX];
+static int g_code_len;
+static rule_agg_t g_aggs[RULE_AGGS_MAX];
+static int g_agg_count;
+static double g_consts[RULE_CONSTS_MAX];
+static int g_const_count;
+static char *g_strings[RULE_STRINGS_MAX];
+static int g_string_count;
+
+/* Aggregate indices per collection, for the one-pass evaluation */
+static uint16_t g_coll_aggs[COLL_COUNT][RULE_AGGS_MAX];
+static int g_coll_agg_count[COLL_COUNT];
+
+/* Per-evaluation scratch */
+static double g_agg_values[RULE_AGGS_MAX];
+static double g_agg_counts[RULE_AGGS_MAX];
+static str_id_t g_string_ids[RULE_STRINGS_MAX];
+
+static const char *severity_names[] = {
+    [RULE_INFO] = "info", [RULE_WARNING] = "warning", [RULE_CRITICAL] = "critical"
+};
+
+const char *rule_severity_name(rule_severity_t s) {
+    return (unsigned)s <= RULE_CRITICAL ? severity_names[s] : "unknown";
+}
+
+int rules_loaded(void) {
+    return g_rule_count;
+}
+
+int rules_need_network(void) {
+    for (int i = 0; i < g_agg_count; i++) {
+        if (g_aggs[i].collection == COLL_LISTENERS ||
+            g_aggs[i].collection == COLL_CONNECTIONS) return 1;
+    }
+    for (int i = 0; i < g_code_len; i++) {
+        if (g_code[i].op == OP_SCALAR &&
+            g_code[i].a >= S_NET_LISTENERS && g_code[i].a <= S_NET_UNUSUAL) return 1;
+    }
+    return 0;
+}
+
+/* ============================================================
+ * Compiler
+ * ============================================================ */
+
+typedef enum {
+    T_EOF, T_NUM, T_STR, T_IDENT, T_LPAREN, T_RPAREN,
+    T_PLUS, T_MINUS, T_STAR, T_SLASH,
+    T_EQ, T_NE, T_LT, T_LE, T_GT, T_GE
+} token_kind_t;
+
+typedef struct {
+    rule_insn_t insn[RULE_PROG_MAX];
+    int len;
+    int depth;
+    int max_depth;
+} prog_t;
+
+typedef struct {
+    const char *p;
+    token_kind_t tok;
+    double num;
+    char text[RULE_LINE_MAX];   /* Identifier or string literal */
+    prog_t *prog;
+    int row_collection;         /* COLL_NONE outside an aggregate */
+    uint16_t last_string;       /* Index of the most recent literal */
+    char *err;
+    size_t err_size;
+    int failed;
+} parser_t;
+
+static void fail(parser_t *ps, const char *fmt, const char *arg) {
+    if (ps->failed) return;
+    ps->failed = 1;
+    snprintf(ps->err, ps->err_size, fmt, arg);
+}
+
+static void next(parser_t *ps) {
+    while (isspace((unsigned char)*ps->p)) ps->p++;
+    const char *p = ps->p;
+    char c = *p;
+
+    if (c == '\0' || c == '#') {
+        ps->tok = T_EOF;
+        return;
+    }
+    if (isdigit((unsigned char)c) || (c == '.' && isdigit((unsigned char)p[1]))) {
+        char *end;
+        ps->num = strtod(p, &end);
+        /* Byte and time suffixes */
+        switch (*end) {
+            case 'K': ps->num *= 1024.0; end++; break;
+            case 'M': ps->num *= 1024.0 * 1024; end++; break;
+            case 'G': ps->num *= 1024.0 * 1024 * 1024; end++; break;
+            case 'T': ps->num *= 1024.0 * 1024 * 1024 * 1024; end++; break;
+            case 's': end++; break;
+            case 'm': ps->num *= 60; end++; break;
+            case 'h': ps->num *= 3600; end++; break;
+            case 'd': ps->num *= 86400; end++; break;
+            default: break;
+        }
+        if (isalnum((unsigned char)*end) || *end == '_') {
+            char bad[32];
+            size_t n = strcspn(p, " \t\r\n()");
+            snprintf(bad, sizeof(bad), "%.*s", (int)(n < sizeof(bad) ? n : sizeof(bad) - 1), p);
+            fail(ps, "bad number '%s'", bad);
+        }
+        ps->p = end;
+        ps->tok = T_NUM;
+        return;
+    }
+    if (isalpha((unsigned char)c) || c == '_') {
+        size_t n = 0;
+        while (isalnum((unsigned char)*p) || *p == '_' || *p == '.') {
+            if (n + 1 < sizeof(ps->text)) ps->text[n++] = *p;
+            p++;
+        }
+        ps->text[n] = '\0';
+        ps->p = p;
+        ps->tok = T_IDENT;
+        return;
+    }
+    if (c == '"' || c == '\'') {
+        size_t n = 0;
+        p++;
+        while (*p && *p != c) {
+            if (n + 1 < sizeof(ps->text)) ps->text[n++] = *p;
+            p++;
+        }
+        if (*p != c) fail(ps, "unterminated string%s", "");
+        ps->text[n] = '\0';
+        ps->p = *p ? p + 1 : p;
+        ps->tok = T_STR;
+        return;
+    }
+
+    ps->p = p + 1;
+    switch (c) {
+        case '(': ps->tok = T_LPAREN; return;
+        case ')': ps->tok = T_RPAREN; return;
+        case '+': ps->tok = T_PLUS; return;
+        case '-': ps->tok = T_MINUS; return;
+        case '*': ps->tok = T_STAR; return;
+        case '/': ps->tok = T_SLASH; return;
+        case '=':
+            if (p[1] == '=') ps->p++;
+            ps->tok = T_EQ;
+            return;
+        case '!':
+            if (p[1] == '=') { ps->p++; ps->tok = T_NE; return; }
+            break;
+        case '<':
+            if (p[1] == '=') { ps->p++; ps->tok = T_LE; return; }
+            ps->tok = T_LT;
+            return;
+        case '>':
+            if (p[1] == '=') { ps->p++; ps->tok = T_GE; return; }
+            ps->tok = T_GT;
+            return;
+        default:
+            break;
+    }
+    char bad[2] = { c, '\0' };
+    fail(ps, "unexpected '%s'", bad);
+    ps->tok = T_EOF;
+}
+
+static int is_keyword(const parser_t *ps, const char *kw) {
+    return ps->tok == T_IDENT && strcmp(ps->text, kw) == 0;
+}
+
+/* Stack effect of each op, for the depth check */
+static int stack_effect(rule_op_t op) {
+    switch (op) {
+        case OP_CONST: case OP_SCALAR: case OP_FIELD: case OP_STR:
+        case OP_AGG: case OP_TEXT_EQ:
+            return 1;
+        case OP_NEG: case OP_NOT: case OP_END:
+            return 0;
+        default:
+            return -1;
+    }
+}
+
+static void emit(parser_t *ps, rule_op_t op, int a, int b) {
+    prog_t *pg = ps->prog;
+    if (pg->len >= RULE_PROG_MAX - 1) {
+        fail(ps, "expression too long%s", "");
+        return;
+    }
+    pg->insn[pg->len++] = (rule_insn_t){ (uint8_t)op, (uint8_t)a, (uint16_t)b };
+    pg->depth += stack_effect(op);
+    if (pg->depth > pg->max_depth) pg->max_depth = pg->depth;
+}
+
+/* Drop the last n instructions (to re-emit them fused) */
+static void unemit(parser_t *ps, int n) {
+    while (n-- > 0 && ps->prog->len > 0) {
+        ps->prog->depth -= stack_effect((rule_op_t)ps->prog->insn[--ps->prog->len].op);
+    }
+}
+
+static int add_const(parser_t *ps, double v) {
+    for (int i = 0; i < g_const_count; i++) {
+        if (g_consts[i] == v) return i;
+    }
+    if (g_const_count >= RULE_CONSTS_MAX) {
+        fail(ps, "too many constants%s", "");
+        return 0;
+    }
+    g_consts[g_const_count] = v;
+    return g_const_count++;
+}
+
+static int add_string(parser_t *ps, const char *s) {
+    for (int i = 0; i < g_string_count; i++) {
+        if (strcmp(g_strings[i], s) == 0) return i;
+    }
+    if (g_string_count >= RULE_STRINGS_MAX || !(g_strings[g_string_count] = strdup(s))) {
+        fail(ps, "too many strings%s", "");
+        return 0;
+    }
+    return g_string_count++;
+}
+
+/* Copy a finished program into the shared code array; its offset */
+static int32_t commit_prog(parser_t *ps, prog_t *pg) {
+    if (pg->max_depth > RULE_STACK_MAX) {
+        fail(ps, "expression nests too deeply%s", "");
+        return -1;
+    }
+    if (g_code_len + pg->len + 1 > RULE_CODE_MAX) {
+        fail(ps, "rule set too large%s", "");
+        return -1;
+    }
+    int32_t at = g_code_len;
+    memcpy(&g_code[g_code_len], pg->insn, (size_t)pg->len * sizeof(rule_insn_t));
+    g_code_len += pg->len;
+    g_code[g_code_len++] = (rule_insn_t){ OP_END, 0, 0 };
+    return at;
+}
+
+static rule_type_t parse_expr(parser_t *ps);
+
+static int find_field(int collection, const char *name) {
+    for (int i = 0; i < F_COUNT; i++) {
+        if (fields[i].collection == collection && strcmp(fields[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static int find_collection(const char *name) {
+    for (int i = 0; i < COLL_COUNT; i++) {
+        if (strcmp(collection_names[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+/* count(coll [where pred]) / sum|min|max|avg(coll.field [where pred]) */
+static rule_type_t parse_aggregate(parser_t *ps, rule_agg_kind_t kind) {
+    if (ps->row_collection != COLL_NONE) {
+        fail(ps, "aggregates cannot be nested%s", "");
+        return TYPE_NUM;
+    }
+    next(ps);
+    if (ps->tok != T_LPAREN) fail(ps, "expected '(' after %s", agg_names[kind]);
+    next(ps);
+    if (ps->tok != T_IDENT) {
+        fail(ps, "expected a collection in %s()", agg_names[kind]);
+        return TYPE_NUM;
+    }
+
+    char *dot = strchr(ps->text, '.');
+    if (dot) *dot = '\0';
+    int coll = find_collection(ps->text);
+    if (coll < 0) {
+        fail(ps, "unknown collection '%s'", ps->text);
+        return TYPE_NUM;
+    }
+    int value_field = -1;
+    if (dot) {
+        value_field = find_field(coll, dot + 1);
+        if (value_field < 0 || fields[value_field].type != TYPE_NUM) {
+            fail(ps, "no numeric field '%s'", dot + 1);
+            return TYPE_NUM;
+        }
+    }
+    if (kind == AGG_COUNT && value_field >= 0) fail(ps, "count() takes a collection, not a field%s", "");
+    if (kind != AGG_COUNT && value_field < 0) fail(ps, "%s() needs collection.field", agg_names[kind]);
+    if (g_agg_count >= RULE_AGGS_MAX) {
+        fail(ps, "too many aggregates%s", "");
+        return TYPE_NUM;
+    }
+
+    rule_agg_t agg = { (uint8_t)kind, (uint8_t)coll, -1, -1 };
+    prog_t *outer = ps->prog;
+    ps->row_collection = coll;
+
+    if (value_field >= 0) {
+        prog_t value = { .len = 0 };
+        ps->prog = &value;
+        emit(ps, OP_FIELD, value_field, 0);
+        agg.value = commit_prog(ps, &value);
+    }
+
+    next(ps);
+    if (is_keyword(ps, "where")) {
+        prog_t pred = { .len = 0 };
+        ps->prog = &pred;
+        next(ps);
+        parse_expr(ps);
+        agg.pred = commit_prog(ps, &pred);
+    }
+    if (ps->tok != T_RPAREN) fail(ps, "expected ')' to close %s()", agg_names[kind]);
+
+    ps->prog = outer;
+    ps->row_collection = COLL_NONE;
+    g_aggs[g_agg_count] = agg;
+    g_coll_aggs[coll][g_coll_agg_count[coll]++] = (uint16_t)g_agg_count;
+    emit(ps, OP_AGG, 0, g_agg_count++);
+    next(ps);
+    return TYPE_NUM;
+}
+
+static rule_type_t parse_primary(parser_t *ps) {
+    if (ps->failed) return TYPE_NUM;
+
+    if (ps->tok == T_NUM) {
+        emit(ps, OP_CONST, 0, add_const(ps, ps->num));
+        next(ps);
+        return TYPE_NUM;
+    }
+    if (ps->tok == T_STR) {
+        ps->last_string = (uint16_t)add_string(ps, ps->text);
+        emit(ps, OP_STR, 0, ps->last_string);
+        next(ps);
+        return TYPE_LITERAL;
+    }
+    if (ps->tok == T_LPAREN) {
+        next(ps);
+        rule_type_t t = parse_expr(ps);
+        if (ps->tok != T_RPAREN) fail(ps, "expected ')'%s", "");
+        next(ps);
+        return t;
+    }
+    if (ps->tok == T_MINUS) {
+        next(ps);
+        if (parse_primary(ps) != TYPE_NUM) fail(ps, "'-' needs a number%s", "");
+        emit(ps, OP_NEG, 0, 0);
+        return TYPE_NUM;
+    }
+    if (ps->tok != T_IDENT) {
+        fail(ps, "expected a value%s", "");
+        return TYPE_NUM;
+    }
+
+    for (int k = AGG_COUNT; k <= AGG_AVG; k++) {
+        if (strcmp(ps->text, agg_names[k]) == 0) return parse_aggregate(ps, (rule_agg_kind_t)k);
+    }
+    if (ps->row_collection != COLL_NONE) {
+        int f = find_field(ps->row_collection, ps->text);
+        if (f >= 0) {
+            emit(ps, OP_FIELD, f, 0);
+            next(ps);
+            return (rule_type_t)fields[f].type;
+        }
+    }
+    for (int s = 0; s < S_COUNT; s++) {
+        if (strcmp(ps->text, scalar_names[s]) == 0) {
+            emit(ps, OP_SCALAR, s, 0);
+            next(ps);
+            return TYPE_NUM;
+        }
+    }
+    fail(ps, "unknown field '%s'", ps->text);
+    return TYPE_NUM;
+}
+
+static rule_type_t parse_term(parser_t *ps) {
+    rule_type_t t = parse_primary(ps);
+    while (!ps->failed && (ps->tok == T_STAR || ps->tok == T_SLASH)) {
+        rule_op_t op = ps->tok == T_STAR ? OP_MUL : OP_DIV;
+        next(ps);
+        if (t != TYPE_NUM || parse_primary(ps) != TYPE_NUM) fail(ps, "arithmetic needs numbers%s", "");
+        emit(ps, op, 0, 0);
+    }
+    return t;
+}
+
+static rule_type_t parse_sum(parser_t *ps) {
+    rule_type_t t = parse_term(ps);
+    while (!ps->failed && (ps->tok == T_PLUS || ps->tok == T_MINUS)) {
+        rule_op_t op = ps->tok == T_PLUS ? OP_ADD : OP_SUB;
+        next(ps);
+        if (t != TYPE_NUM || parse_term(ps) != TYPE_NUM) fail(ps, "arithmetic needs numbers%s", "");
+        emit(ps, op, 0, 0);
+    }
+    return t;
+}
+
+static rule_type_t parse_comparison(parser_t *ps) {
+    int left_at = ps->prog->len;
+    rule_type_t left = parse_sum(ps);
+    if (ps->tok < T_EQ || ps->tok > T_GE) return left;
+
+    static const rule_op_t ops[] = {
+        [T_EQ] = OP_EQ, [T_NE] = OP_NE, [T_LT] = OP_LT,
+        [T_LE] = OP_LE, [T_GT] = OP_GT, [T_GE] = OP_GE
+    };
+    token_kind_t tok = ps->tok;
+    next(ps);
+    rule_type_t right = parse_sum(ps);
+    if (ps->failed) return TYPE_NUM;
+
+    if (left == TYPE_NUM && right == TYPE_NUM) {
+        emit(ps, ops[tok], 0, 0);
+        return TYPE_NUM;
+    }
+
+    /* Strings: a bare field against a literal, equality only */
+    if (right != TYPE_LITERAL || left == TYPE_NUM || left == TYPE_LITERAL ||
+        ps->prog->len != left_at + 2 || (tok != T_EQ && tok != T_NE)) {
+        fail(ps, "strings compare as field == \"literal\" or field != \"literal\"%s", "");
+        return TYPE_NUM;
+    }
+    int field = ps->prog->insn[left_at].a;
+    const char *lit = g_strings[ps->last_string];
+
+    if (left == TYPE_CHAR) {
+        if (strlen(lit) != 1) fail(ps, "'%s' is not a single character", lit);
+        unemit(ps, 1);
+        emit(ps, OP_CONST, 0, add_const(ps, (unsigned char)lit[0]));
+        emit(ps, ops[tok], 0, 0);
+    } else if (left == TYPE_TEXT) {
+        unemit(ps, 2);
+        emit(ps, OP_TEXT_EQ, field, ps->last_string);
+        if (tok == T_NE) emit(ps, OP_NOT, 0, 0);
+    } else {
+        emit(ps, ops[tok], 0, 0);   /* Interned: compare ids */
+    }
+    return TYPE_NUM;
+}
+
+static rule_type_t parse_not(parser_t *ps) {
+    if (is_keyword(ps, "not")) {
+        next(ps);
+        parse_not(ps);
+        emit(ps, OP_NOT, 0, 0);
+        return TYPE_NUM;
+    }
+    return parse_comparison(ps);
+}
+
+static rule_type_t parse_and(parser_t *ps) {
+    rule_type_t t = parse_not(ps);
+    while (!ps->failed && is_keyword(ps, "and")) {
+        next(ps);
+        parse_not(ps);
+        emit(ps, OP_AND, 0, 0);
+        t = TYPE_NUM;
+    }
+    return t;
+}
+
+static rule_type_t parse_expr(parser_t *ps) {
+    rule_type_t t = parse_and(ps);
+    while (!ps->failed && is_keyword(ps, "or")) {
+        next(ps);
+        parse_and(ps);
+        emit(ps, OP_OR, 0, 0);
+        t = TYPE_NUM;
+    }
+    if (t == TYPE_LITERAL) fail(ps, "a string on its own is not a condition%s", "");
+    return t;
+}
+
+/* rule <name> <severity> when <expression> */
+static int compile_rule(char *line, char *err, size_t err_size) {
+    parser_t ps = { .p = line, .row_collection = COLL_NONE, .err = err, .err_size = err_size };
+    prog_t top = { .len = 0 };
+    ps.prog = &top;
+
+    if (g_rule_count >= RULES_MAX) {
+        snprintf(err, err_size, "more than %d rules", RULES_MAX);
+        return -1;
+    }
+    rule_t *r = &g_rules[g_rule_count];
+
+    next(&ps);
+    if (!is_keyword(&ps, "rule")) fail(&ps, "expected 'rule'%s", "");
+    next(&ps);
+    if (ps.tok != T_IDENT) fail(&ps, "expected a rule name%s", "");
+    if (strlen(ps.text) >= sizeof(r->name)) fail(&ps, "rule name '%.32s...' is too long", ps.text);
+    memcpy(r->name, ps.text, sizeof(r->name) - 1);
+    r->name[sizeof(r->name) - 1] = '\0';
+    next(&ps);
+
+    int sev = -1;
+    for (int i = RULE_INFO; i <= RULE_CRITICAL; i++) {
+        if (ps.tok == T_IDENT && strcmp(ps.text, severity_names[i]) == 0) sev = i;
+    }
+    if (sev < 0) fail(&ps, "severity must be info, warning or critical, not '%s'", ps.text);
+    r->severity = (rule_severity_t)sev;
+    next(&ps);
+    if (!is_keyword(&ps, "when")) fail(&ps, "expected 'when'%s", "");
+
+    const char *expr_start = ps.p;
+    while (isspace((unsigned char)*expr_start)) expr_start++;
+    snprintf(r->text, sizeof(r->text), "%s", expr_start);
+    r->text[strcspn(r->text, "#\r\n")] = '\0';
+
+    /* Roll back aggregates and code if this rule fails */
+    int code_len = g_code_len, agg_count = g_agg_count;
+    int coll_counts[COLL_COUNT];
+    memcpy(coll_counts, g_coll_agg_count, sizeof(coll_counts));
+
+    next(&ps);
+    if (!ps.failed) parse_expr(&ps);
+    if (!ps.failed && ps.tok != T_EOF) fail(&ps, "unexpected text after the expression%s", "");
+    if (!ps.failed) r->code = commit_prog(&ps, &top);
+
+    if (ps.failed) {
+        g_code_len = code_len;
+        g_agg_count = agg_count;
+        memcpy(g_coll_agg_count, coll_counts, sizeof(coll_counts));
+        return -1;
+    }
+    g_rule_count++;
+    return 0;
+}
+
+static void rules_clear(void) {
+    for (int i = 0; i < g_string_count; i++) free(g_strings[i]);
+    g_rule_count = g_code_len = g_agg_count = g_const_count = g_string_count = 0;
+    memset(g_coll_agg_count, 0, sizeof(g_coll_agg_count));
+}
+
+int rules_load(const char *path, char *err, size_t err_size) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        snprintf(err, err_size, "%s: cannot open", path);
+        return -1;
+    }
+
+    rules_clear();
+    char line[RULE_LINE_MAX];
+    char msg[256];
+    int lineno = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        char *s = line;
+        while (isspace((unsigned char)*s)) s++;
+        if (*s == '#' || *s == '\0') continue;
+
+        if (compile_rule(s, msg, sizeof(msg)) != 0) {
+            snprintf(err, err_size, "%s:%d: %s", path, lineno, msg);
+            fclose(f);
+            rules_clear();
+            return -1;
+        }
+    }
+    fclose(f);
+    return g_rule_count;
+}
+
+/* ============================================================
+ * Evaluation
+ * ============================================================ */
+
+static double load_scalar(const fingerprint_t *fp, int s) {
+    switch (s) {
+        case S_LOAD1:            return fp->system.load_avg[0];
+        case S_LOAD5:            return fp->system.load_avg[1];
+        case S_LOAD15:           return fp->system.load_avg[2];
+        case S_UPTIME:           return (double)fp->system.uptime_seconds;
+        case S_MEM_TOTAL:        return (double)fp->system.total_ram;
+        case S_MEM_USED_PCT:
+            return fp->system.total_ram ?
+                   100.0 * (1.0 - (double)fp->system.free_ram / fp->system.total_ram) : 0;
+        case S_CPU_COUNT:        return fp->cpu.cpu_count;
+        case S_CPU_BUSY:         return fp->cpu.total.busy_pct;
+        case S_CPU_IOWAIT:       return fp->cpu.total.iowait_pct;
+        case S_CPU_STEAL:        return fp->cpu.total.steal_pct;
+        case S_PROC_TOTAL:       return fp->process_total;
+        case S_NET_LISTENERS:    return fp->network.listener_count;
+        case S_NET_CONNECTIONS:  return fp->network.connection_count;
+        case S_NET_UNUSUAL:      return fp->network.unusual_port_count;
+        case S_TCP_RETRANS:      return fp->tcp_health.retrans_percent;
+        case S_FD_DELETED:       return (double)fp->fd_census.deleted;
+        case S_FD_DELETED_BYTES: return (double)fp->fd_census.deleted_bytes;
+        case S_LEAKS:            return fp->leaks.count;
+        case S_ZOMBIE_PARENTS:   return fp->zombies.parent_count;
+        case S_ZOMBIE_REAP_MAX:  return fp->zombies.reap_max_seconds;
+        case S_PROBE_ERRORS:     return fp->probe_errors;
+        default:                 return 0;
+    }
+}
+
+static double load_field(const fingerprint_t *fp, int f, const void *row) {
+    const process_info_t *p = row;
+    const net_listener_t *l = row;
+    const net_connection_t *c = row;
+    const config_file_t *cf = row;
+
+    switch (f) {
+        case F_PROC_PID:     return p->pid;
+        case F_PROC_PPID:    return p->ppid;
+        case F_PROC_NAME:    return p->name;
+        case F_PROC_STATE:   return (unsigned char)p->state;
+        case F_PROC_RSS:     return (double)p->rss_bytes;
+        case F_PROC_VSIZE:   return (double)p->vsize_bytes;
+        case F_PROC_FDS:     return p->open_fd_count < PROC_FD_SANE_MAX ? p->open_fd_count : 0;
+        case F_PROC_THREADS: return p->thread_count;
+        case F_PROC_AGE:     return (double)p->age_seconds;
+        case F_PROC_CPU:     return p->cpu_percent;
+        case F_PROC_IO:      return p->io_bytes_per_sec;
+        case F_PROC_STUCK:   return p->is_potentially_stuck;
+        case F_LIS_PORT:     return l->local_port;
+        case F_LIS_ADDR:     return l->local_addr;
+        case F_LIS_PID:      return l->pid;
+        case F_LIS_PROCESS:  return l->process_name;
+        case F_CONN_LPORT:   return c->local_port;
+        case F_CONN_RPORT:   return c->remote_port;
+        case F_CONN_RADDR:   return c->remote_addr;
+        case F_CONN_PID:     return c->pid;
+        case F_CONN_PROCESS: return c->process_name;
+        case F_CFG_PATH:     return cf->path;
+        case F_CFG_MODE:     return cf->permissions & 07777;
+        case F_CFG_WORLD_WRITABLE: return (cf->permissions & S_IWOTH) != 0;
+        case F_CFG_SIZE:     return (double)cf->size;
+        case F_CFG_OWNER:    return cf->owner;
+        case F_CFG_AGE:      return (double)(fp->system.probe_time - cf->mtime);
+        default:             return 0;
+    }
+}
+
+static const char *load_text(int f, const void *row) {
+    switch (f) {
+        case F_LIS_PROTO:  return ((const net_listener_t *)row)->protocol;
+        case F_CONN_PROTO: return ((const net_connection_t *)row)->protocol;
+        case F_CONN_STATE: return ((const net_connection_t *)row)->state;
+        default:           return "";
+    }
+}
+
+static double run(const fingerprint_t *fp, int32_t pc, const void *row) {
+    double stack[RULE_STACK_MAX];
+    int sp = 0;
+
+    for (const rule_insn_t *i = &g_code[pc]; ; i++) {
+        switch ((rule_op_t)i->op) {
+            case OP_END:     return sp ? stack[sp - 1] : 0;
+            case OP_CONST:   stack[sp++] = g_consts[i->b]; break;
+            case OP_SCALAR:  stack[sp++] = load_scalar(fp, i->a); break;
+            case OP_FIELD:   stack[sp++] = load_field(fp, i->a, row); break;
+            case OP_STR:     stack[sp++] = g_string_ids[i->b]; break;
+            case OP_AGG:     stack[sp++] = g_agg_values[i->b]; break;
+            case OP_TEXT_EQ:
+                stack[sp++] = strcmp(load_text(i->a, row), g_strings[i->b]) == 0;
+                break;
+            case OP_NEG:     stack[sp - 1] = -stack[sp - 1]; break;
+            case OP_NOT:     stack[sp - 1] = !stack[sp - 1]; break;
+            default: {
+                double b = stack[--sp], a = stack[sp - 1], r;
+                switch ((rule_op_t)i->op) {
+                    case OP_ADD: r = a + b; break;
+                    case OP_SUB: r = a - b; break;
+                    case OP_MUL: r = a * b; break;
+                    case OP_DIV: r = b != 0 ? a / b : NAN; break;
+                    case OP_EQ:  r = a == b; break;
+                    case OP_NE:  r = a != b; break;
+                    case OP_LT:  r = a < b; break;
+                    case OP_LE:  r = a <= b; break;
+                    case OP_GT:  r = a > b; break;
+                    case OP_GE:  r = a >= b; break;
+                    case OP_AND: r = a != 0 && b != 0; break;
+                    case OP_OR:  r = a != 0 || b != 0; break;
+                    default:     r = 0; break;
+                }
+                stack[sp - 1] = r;
+                break;
+            }
+        }
+    }
+}
+
+/* One pass over a collection, feeding every aggregate that reads it */
+static void scan_collection(const fingerprint_t *fp, int coll) {
+    int naggs = g_coll_agg_count[coll];
+    if (naggs == 0) return;
+
+    const void *base;
+    size_t stride;
+    int rows;
+    switch (coll) {
+        case COLL_PROCESSES:
+            base = fp->processes; stride = sizeof(process_info_t); rows = fp->process_count; break;
+        case COLL_LISTENERS:
+            base = fp->network.listeners; stride = sizeof(net_listener_t);
+            rows = fp->network.listener_count; break;
+        case COLL_CONNECTIONS:
+            base = fp->network.connections; stride = sizeof(net_connection_t);
+            rows = fp->network.connection_count; break;
+        default:
+            base = fp->configs; stride = sizeof(config_file_t); rows = fp->config_count; break;
+    }
+
+    for (int r = 0; r < rows; r++) {
+        const void *row = (const char *)base + (size_t)r * stride;
+        for (int k = 0; k < naggs; k++) {
+            int a = g_coll_aggs[coll][k];
+            const rule_agg_t *agg = &g_aggs[a];
+            if (agg->pred >= 0 && run(fp, agg->pred, row) == 0) continue;
+
+            double v = agg->value >= 0 ? run(fp, agg->value, row) : 1;
+            double *acc = &g_agg_values[a];
+            switch (agg->kind) {
+                case AGG_MIN: if (g_agg_counts[a] == 0 || v < *acc) *acc = v; break;
+                case AGG_MAX: if (g_agg_counts[a] == 0 || v > *acc) *acc = v; break;
+                default:      *acc += v; break;
+            }
+            g_agg_counts[a]++;
+        }
+    }
+}
+
+void rules_evaluate(fingerprint_t *fp) {
+    rule_report_t *rep = &fp->rules;
+    memset(rep, 0, sizeof(*rep));
+    rep->loaded = g_rule_count;
+    if (g_rule_count == 0) return;
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (int i = 0; i < g_string_count; i++) {
+        g_string_ids[i] = strtab_find(fp->strings, g_strings[i]);
+    }
+    memset(g_agg_values, 0, (size_t)g_agg_count * sizeof(double));
+    memset(g_agg_counts, 0, (size_t)g_agg_count * sizeof(double));
+
+    for (int c = 0; c < COLL_COUNT; c++) {
+        scan_collection(fp, c);
+    }
+    for (int a = 0; a < g_agg_count; a++) {
+        if (g_aggs[a].kind == AGG_AVG && g_agg_counts[a] > 0) g_agg_values[a] /= g_agg_counts[a];
+        if (g_aggs[a].kind >= AGG_MIN && g_agg_counts[a] == 0) g_agg_values[a] = NAN;
+    }
+
+    for (int r = 0; r < g_rule_count; r++) {
+        double v = run(fp, g_rules[r].code, NULL);
+        if (v == 0 || isnan(v)) continue;
+
+        if (g_rules[r].severity == RULE_CRITICAL) rep->critical++;
+        else if (g_rules[r].severity == RULE_WARNING) rep->warnings++;
+        if (rep->count < RULE_HITS_MAX) {
+            rule_hit_t *h = &rep->hits[rep->count++];
+            h->name = g_rules[r].name;
+            h->text = g_rules[r].text;
+            h->severity = g_rules[r].severity;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    rep->eval_us = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3;
+}
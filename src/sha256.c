@@ -219,8 +219,8 @@ int sha256_file(const char *path, char *out, size_t out_size) {
     return 0;
 }
 
-/* Compute SHA256 of a string, output as hex string */
-int sha256_string(const char *str, char *out, size_t out_size) {
+/* Compute SHA256 of a byte range, output as hex string */
+int sha256_buffer(const void *data, size_t len, char *out, size_t out_size) {
     sha256_ctx_t ctx;
     uint8_t hash[32];
     int i;
@@ -230,7 +230,7 @@ int sha256_string(const char *str, char *out, size_t out_size) {
     }
     
     sha256_init(&ctx);
-    sha256_update(&ctx, (const uint8_t *)str, strlen(str));
+    sha256_update(&ctx, (const uint8_t *)data, len);
     sha256_final(&ctx, hash);
     
     for (i = 0; i < 32; i++) {
@@ -240,3 +240,8 @@ int sha256_string(const char *str, char *out, size_t out_size) {
     
     return 0;
 }
+
+/* Compute SHA256 of a string, output as hex string */
+int sha256_string(const char *str, char *out, size_t out_size) {
+    return sha256_buffer(str, strlen(str), out, out_size);
+}
@@ -0,0 +1,281 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * strtab.c - Interned strings for one snapshot
+ *
+ * Process names, paths and addresses repeat thousands of times per
+ * snapshot and mostly fit in a few bytes of a 256/4096 byte field.
+ * Entities hold a 32-bit str_id_t instead; the bytes live once, in
+ * append-only chunks, found again through an open-addressing hash.
+ *
+ * Probe workers intern concurrently (and an abandoned worker may wake
+ * up late), so intern/find take a mutex and nothing is ever freed
+ * until strtab_destroy(): a reset rewinds the chunks and clears the
+ * index but keeps the memory, so a straggler can never touch freed
+ * storage. Lookup by id is lock-free through fixed pages.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "sentinel.h"
+
+#define STRTAB_CHUNK_SIZE 65536
+#define STRTAB_PAGE_IDS 1024
+#define STRTAB_MAX_PAGES 4096           /* 4M distinct strings */
+#define STRTAB_INITIAL_SLOTS 4096       /* Power of two */
+
+typedef struct strtab_chunk {
+    struct strtab_chunk *next;
+    size_t size;
+    size_t used;
+    char data[];
+} strtab_chunk_t;
+
+typedef struct {
+    const char *str;
+    uint32_t len;
+    uint32_t hash;
+} strtab_entry_t;
+
+struct strtab {
+    pthread_mutex_t lock;
+    strtab_chunk_t *chunks;             /* All chunks, in allocation order */
+    strtab_chunk_t *current;            /* Where the next string goes */
+    strtab_entry_t *pages[STRTAB_MAX_PAGES];
+    uint32_t count;                     /* Ids handed out, including 0 */
+    uint32_t *slots;                    /* id + 1, 0 = empty */
+    uint32_t slot_mask;
+    size_t bytes;                       /* String bytes in use */
+};
+
+/* FNV-1a - short strings, so nothing fancier pays off */
+static uint32_t str_hash(const char *s, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)s[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static strtab_entry_t *entry_at(const strtab_t *t, uint32_t id) {
+    return &t->pages[id / STRTAB_PAGE_IDS][id % STRTAB_PAGE_IDS];
+}
+
+/* Copy bytes into chunk storage, reusing rewound chunks first */
+static const char *store_bytes(strtab_t *t, const char *s, size_t len) {
+    size_t need = len + 1;
+    strtab_chunk_t *c = t->current;
+
+    while (c && c->used + need > c->size) {
+        c = c->next;
+        if (c) c->used = 0;
+    }
+    if (!c) {
+        size_t size = need > STRTAB_CHUNK_SIZE ? need : STRTAB_CHUNK_SIZE;
+        c = malloc(sizeof(*c) + size);
+        if (!c) return NULL;
+        c->size = size;
+        c->used = 0;
+        c->next = NULL;
+        /* Append so a reset walks chunks in the same order */
+        strtab_chunk_t **tail = &t->chunks;
+        while (*tail) tail = &(*tail)->next;
+        *tail = c;
+    }
+    t->current = c;
+
+    char *dst = c->data + c->used;
+    memcpy(dst, s, len);
+    dst[len] = '\0';
+    c->used += need;
+    t->bytes += need;
+    return dst;
+}
+
+static int grow_slots(strtab_t *t) {
+    uint32_t cap = (t->slot_mask + 1) * 2;
+    uint32_t *slots = calloc(cap, sizeof(uint32_t));
+    if (!slots) return -1;
+
+    for (uint32_t id = 1; id < t->count; id++) {
+        uint32_t i = entry_at(t, id)->hash & (cap - 1);
+        while (slots[i]) i = (i + 1) & (cap - 1);
+        slots[i] = id + 1;
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->slot_mask = cap - 1;
+    return 0;
+}
+
+strtab_t *strtab_create(void) {
+    strtab_t *t = calloc(1, sizeof(*t));
+    if (!t) return NULL;
+
+    t->slots = calloc(STRTAB_INITIAL_SLOTS, sizeof(uint32_t));
+    t->pages[0] = calloc(STRTAB_PAGE_IDS, sizeof(strtab_entry_t));
+    if (!t->slots || !t->pages[0]) {
+        free(t->slots);
+        free(t->pages[0]);
+        free(t);
+        return NULL;
+    }
+    t->slot_mask = STRTAB_INITIAL_SLOTS - 1;
+    pthread_mutex_init(&t->lock, NULL);
+
+    /* Id 0 is the empty string, so zeroed structs read as "" */
+    t->pages[0][0].str = "";
+    t->count = 1;
+    return t;
+}
+
+void strtab_destroy(strtab_t *t) {
+    if (!t) return;
+    for (strtab_chunk_t *c = t->chunks; c; ) {
+        strtab_chunk_t *next = c->next;
+        free(c);
+        c = next;
+    }
+    for (int i = 0; i < STRTAB_MAX_PAGES && t->pages[i]; i++) free(t->pages[i]);
+    free(t->slots);
+    pthread_mutex_destroy(&t->lock);
+    free(t);
+}
+
+void strtab_reset(strtab_t *t) {
+    if (!t) return;
+    pthread_mutex_lock(&t->lock);
+    t->current = t->chunks;
+    if (t->current) t->current->used = 0;
+    memset(t->slots, 0, (size_t)(t->slot_mask + 1) * sizeof(uint32_t));
+    t->count = 1;
+    t->bytes = 0;
+    pthread_mutex_unlock(&t->lock);
+}
+
+/* Caller holds the lock. Returns the slot for s (occupied or empty). */
+static uint32_t *find_slot(strtab_t *t, const char *s, size_t len, uint32_t hash) {
+    uint32_t i = hash & t->slot_mask;
+    for (;;) {
+        uint32_t *slot = &t->slots[i];
+        if (*slot == 0) return slot;
+
+        const strtab_entry_t *e = entry_at(t, *slot - 1);
+        if (e->hash == hash && e->len == len && memcmp(e->str, s, len) == 0) {
+            return slot;
+        }
+        i = (i + 1) & t->slot_mask;
+    }
+}
+
+str_id_t strtab_intern_n(strtab_t *t, const char *s, size_t len) {
+    if (!t || !s || len == 0) return STR_EMPTY;
+
+    uint32_t hash = str_hash(s, len);
+    str_id_t id = STR_EMPTY;
+
+    pthread_mutex_lock(&t->lock);
+
+    uint32_t *slot = find_slot(t, s, len, hash);
+    if (*slot) {
+        id = *slot - 1;
+        goto out;
+    }
+
+    /* Keep the index under 50% full */
+    if ((t->count + 1) * 2 > t->slot_mask + 1) {
+        if (grow_slots(t) != 0) goto out;
+        slot = find_slot(t, s, len, hash);
+    }
+
+    uint32_t page = t->count / STRTAB_PAGE_IDS;
+    if (page >= STRTAB_MAX_PAGES) goto out;
+    if (!t->pages[page]) {
+        t->pages[page] = calloc(STRTAB_PAGE_IDS, sizeof(strtab_entry_t));
+        if (!t->pages[page]) goto out;
+    }
+
+    const char *copy = store_bytes(t, s, len);
+    if (!copy) goto out;
+
+    id = t->count;
+    strtab_entry_t *e = entry_at(t, id);
+    e->str = copy;
+    e->len = (uint32_t)len;
+    e->hash = hash;
+    *slot = id + 1;
+    t->count++;
+
+out:
+    pthread_mutex_unlock(&t->lock);
+    return id;
+}
+
+str_id_t strtab_intern(strtab_t *t, const char *s) {
+    return s ? strtab_intern_n(t, s, strlen(s)) : STR_EMPTY;
+}
+
+str_id_t strtab_find(strtab_t *t, const char *s) {
+    if (!t || !s) return STR_NONE;
+    size_t len = strlen(s);
+    if (len == 0) return STR_EMPTY;
+
+    pthread_mutex_lock(&t->lock);
+    uint32_t *slot = find_slot(t, s, len, str_hash(s, len));
+    str_id_t id = *slot ? *slot - 1 : STR_NONE;
+    pthread_mutex_unlock(&t->lock);
+    return id;
+}
+
+const char *strtab_get(const strtab_t *t, str_id_t id) {
+    if (!t || id >= t->count) return "";
+    return entry_at(t, id)->str;
+}
+
+uint32_t strtab_count(const strtab_t *t) {
+    return t ? t->count : 0;
+}
+
+size_t strtab_bytes(const strtab_t *t) {
+    return t ? t->bytes : 0;
+}
+
+/* Interning src's strings in id order into an empty table hands out
+ * the same ids, since src holds no duplicates */
+int strtab_copy(strtab_t *dst, strtab_t *src) {
+    if (!dst || !src) return -1;
+    strtab_reset(dst);
+
+    int rc = 0;
+    pthread_mutex_lock(&src->lock);
+    for (uint32_t id = 1; id < src->count && rc == 0; id++) {
+        const strtab_entry_t *e = entry_at(src, id);
+        if (strtab_intern_n(dst, e->str, e->len) != id) rc = -1;
+    }
+    pthread_mutex_unlock(&src->lock);
+    return rc;
+}
+
+/* The table every probe interns into; reset at the start of a capture */
+static strtab_t *g_snapshot = NULL;
+static pthread_once_t g_snapshot_once = PTHREAD_ONCE_INIT;
+
+static void snapshot_create(void) {
+    g_snapshot = strtab_create();
+}
+
+strtab_t *strtab_snapshot(void) {
+    pthread_once(&g_snapshot_once, snapshot_create);
+    return g_snapshot;
+}
@@ -0,0 +1,215 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * tcp_stats.c - TCP/IP stack health counters from /proc/net/snmp
+ *               and /proc/net/netstat, with per-interval deltas
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "sentinel.h"
+
+#define TCP_STATE_FILENAME "tcp_stats.dat"
+#define TCP_STATE_MAGIC "SNTLTCP1"
+
+/* Both files are a few KB; one read() each is enough */
+#define SNMP_BUF_SIZE 16384
+
+/* Where each counter lives: section prefix and column name */
+static const struct {
+    const char *proto;
+    const char *name;
+} counter_table[TCP_CTR_COUNT] = {
+    [TCP_CTR_IN_SEGS]           = { "Tcp",    "InSegs" },
+    [TCP_CTR_OUT_SEGS]          = { "Tcp",    "OutSegs" },
+    [TCP_CTR_RETRANS_SEGS]      = { "Tcp",    "RetransSegs" },
+    [TCP_CTR_IN_ERRS]           = { "Tcp",    "InErrs" },
+    [TCP_CTR_OUT_RSTS]          = { "Tcp",    "OutRsts" },
+    [TCP_CTR_ATTEMPT_FAILS]     = { "Tcp",    "AttemptFails" },
+    [TCP_CTR_ESTAB_RESETS]      = { "Tcp",    "EstabResets" },
+    [TCP_CTR_LISTEN_OVERFLOWS]  = { "TcpExt", "ListenOverflows" },
+    [TCP_CTR_LISTEN_DROPS]      = { "TcpExt", "ListenDrops" },
+    [TCP_CTR_TIMEOUTS]          = { "TcpExt", "TCPTimeouts" },
+    [TCP_CTR_SYN_RETRANS]       = { "TcpExt", "TCPSynRetrans" },
+    [TCP_CTR_ABORT_ON_MEMORY]   = { "TcpExt", "TCPAbortOnMemory" },
+    [TCP_CTR_BACKLOG_DROP]      = { "TcpExt", "TCPBacklogDrop" },
+    [TCP_CTR_IP_IN_DISCARDS]    = { "Ip",     "InDiscards" },
+    [TCP_CTR_UDP_IN_ERRORS]     = { "Udp",    "InErrors" },
+    [TCP_CTR_UDP_RCVBUF_ERRORS] = { "Udp",    "RcvbufErrors" },
+};
+
+/* Previous sample, kept in-process for watch mode */
+typedef struct {
+    char magic[8];
+    double taken_s;             /* CLOCK_BOOTTIME when sampled */
+    uint64_t totals[TCP_CTR_COUNT];
+} tcp_sample_t;
+
+static tcp_sample_t g_prev;
+static int g_have_prev = 0;
+
+const char *tcp_counter_name(tcp_counter_t ctr) {
+    if (ctr < 0 || ctr >= TCP_CTR_COUNT) return "unknown";
+    return counter_table[ctr].name;
+}
+
+/* Match a header/value line pair, e.g.
+ *   Tcp: RtoAlgorithm RtoMin ... RetransSegs ...
+ *   Tcp: 1 200 ... 4711 ...
+ * and store any columns present in counter_table. */
+static int parse_line_pair(char *names, char *values, uint64_t *totals) {
+    char *colon = strchr(names, ':');
+    if (!colon || strncmp(names, values, (size_t)(colon - names + 1)) != 0) {
+        return 0;
+    }
+    *colon = '\0';
+    const char *proto = names;
+
+    char *nsave = NULL, *vsave = NULL;
+    char *name = strtok_r(colon + 1, " \n", &nsave);
+    char *value = strtok_r(values + (colon - names) + 1, " \n", &vsave);
+    int found = 0;
+
+    while (name && value) {
+        for (int i = 0; i < TCP_CTR_COUNT; i++) {
+            if (strcmp(counter_table[i].proto, proto) == 0 &&
+                strcmp(counter_table[i].name, name) == 0) {
+                /* Some columns (e.g. Tcp MaxConn) are signed; clamp */
+                long long v = strtoll(value, NULL, 10);
+                totals[i] = v < 0 ? 0 : (uint64_t)v;
+                found++;
+                break;
+            }
+        }
+        name = strtok_r(NULL, " \n", &nsave);
+        value = strtok_r(NULL, " \n", &vsave);
+    }
+    return found;
+}
+
+/* Walk a snmp-format buffer two lines at a time */
+static int parse_snmp_buffer(char *buf, uint64_t *totals) {
+    int found = 0;
+    char *line = buf;
+
+    while (line && *line) {
+        char *next = strchr(line, '\n');
+        if (!next) break;
+        *next = '\0';
+
+        char *values = next + 1;
+        char *after = strchr(values, '\n');
+        if (after) *after = '\0';
+
+        found += parse_line_pair(line, values, totals);
+        line = after ? after + 1 : NULL;
+    }
+    return found;
+}
+
+/* Raw counters since boot. Runs under the watchdog, so touches no
+ * shared state; deltas are worked out by tcp_health_delta(). */
+int probe_tcp_health(tcp_health_t *th) {
+    static __thread char buf[SNMP_BUF_SIZE];
+
+    memset(th, 0, sizeof(*th));
+
+    if (pfs_read("/proc/net/snmp", buf, sizeof(buf)) < 0) {
+        return -1;
+    }
+    if (parse_snmp_buffer(buf, th->totals) == 0) {
+        return -1;
+    }
+
+    /* TcpExt is optional (containers sometimes hide it) */
+    if (pfs_read("/proc/net/netstat", buf, sizeof(buf)) >= 0) {
+        parse_snmp_buffer(buf, th->totals);
+    }
+
+    th->available = 1;
+    return 0;
+}
+
+/* None under --record/--replay: the recording is the only history */
+static int load_state(tcp_sample_t *s) {
+    char path[512];
+    if (pfs_active() || probe_state_path(TCP_STATE_FILENAME, path, sizeof(path)) != 0) {
+        return -1;
+    }
+
+    FILE *f = fopen(path, "rb");
+    if (!f) return -1;
+    size_t n = fread(s, sizeof(*s), 1, f);
+    fclose(f);
+
+    if (n != 1 || memcmp(s->magic, TCP_STATE_MAGIC, 8) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static void save_state(const tcp_sample_t *s) {
+    char path[512];
+    if (pfs_active() || probe_state_path(TCP_STATE_FILENAME, path, sizeof(path)) != 0) {
+        return;
+    }
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return;
+    fwrite(s, sizeof(*s), 1, f);
+    fclose(f);
+}
+
+/* Fill deltas/rates against the previous sample, then remember this one.
+ * The first call in a process falls back to the state file so one-shot
+ * runs from cron with --keep-state still see an interval. */
+void tcp_health_delta(tcp_health_t *th) {
+    if (!th->available) return;
+
+    double now = boottime_seconds();
+
+    if (!g_have_prev && load_state(&g_prev) == 0) {
+        g_have_prev = 1;
+    }
+
+    if (g_have_prev && now > g_prev.taken_s) {
+        int reset = 0;
+        for (int i = 0; i < TCP_CTR_COUNT; i++) {
+            if (th->totals[i] < g_prev.totals[i]) {
+                reset = 1;      /* Reboot or namespace change */
+                break;
+            }
+        }
+
+        if (!reset) {
+            th->has_delta = 1;
+            th->interval_seconds = now - g_prev.taken_s;
+            for (int i = 0; i < TCP_CTR_COUNT; i++) {
+                th->deltas[i] = th->totals[i] - g_prev.totals[i];
+                th->rates[i] = th->deltas[i] / th->interval_seconds;
+            }
+            if (th->deltas[TCP_CTR_OUT_SEGS] > 0) {
+                th->retrans_percent = 100.0 * th->deltas[TCP_CTR_RETRANS_SEGS] /
+                                      th->deltas[TCP_CTR_OUT_SEGS];
+            }
+        }
+    }
+
+    memcpy(g_prev.magic, TCP_STATE_MAGIC, 8);
+    g_prev.taken_s = now;
+    memcpy(g_prev.totals, th->totals, sizeof(g_prev.totals));
+    g_have_prev = 1;
+    save_state(&g_prev);
+}
@@ -0,0 +1,127 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * topk.c - Top-K resource consumers by RSS, CPU, fds, threads and I/O
+ *
+ * Fixed thresholds give an empty list on a quiet host and an unbounded
+ * one on a busy host. Instead, keep the K largest of each metric: one
+ * pass over the process table, a bounded min-heap per metric (the root
+ * is the smallest kept value, so most processes are rejected with one
+ * compare), O(n log K) time and no allocation.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sentinel.h"
+
+static int g_topk = TOPK_DEFAULT;
+
+static const char *metric_names[TOPK_METRIC_COUNT] = {
+    [TOPK_RSS]     = "rss",
+    [TOPK_CPU]     = "cpu",
+    [TOPK_FDS]     = "fds",
+    [TOPK_THREADS] = "threads",
+    [TOPK_IO]      = "io",
+};
+
+void process_topk_set(int k) {
+    if (k < 0) k = 0;
+    if (k > TOPK_MAX) k = TOPK_MAX;
+    g_topk = k;
+}
+
+int process_topk_get(void) {
+    return g_topk;
+}
+
+const char *topk_metric_name(topk_metric_t m) {
+    if (m < 0 || m >= TOPK_METRIC_COUNT) return "unknown";
+    return metric_names[m];
+}
+
+/* a ranks below b: smaller value, ties broken towards the later process
+ * so equal values keep a stable, table-order preference */
+static int ranks_below(const topk_entry_t *a, const topk_entry_t *b) {
+    if (a->value != b->value) return a->value < b->value;
+    return a->proc > b->proc;
+}
+
+static void sift_down(topk_entry_t *h, int n, int i) {
+    for (;;) {
+        int l = 2 * i + 1, r = l + 1, m = i;
+        if (l < n && ranks_below(&h[l], &h[m])) m = l;
+        if (r < n && ranks_below(&h[r], &h[m])) m = r;
+        if (m == i) return;
+        topk_entry_t t = h[i];
+        h[i] = h[m];
+        h[m] = t;
+        i = m;
+    }
+}
+
+static void sift_up(topk_entry_t *h, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!ranks_below(&h[i], &h[parent])) return;
+        topk_entry_t t = h[i];
+        h[i] = h[parent];
+        h[parent] = t;
+        i = parent;
+    }
+}
+
+static void heap_offer(topk_entry_t *h, int *n, int k, int proc, double value) {
+    topk_entry_t e = { proc, value };
+    if (*n < k) {
+        h[*n] = e;
+        sift_up(h, (*n)++);
+    } else if (ranks_below(&h[0], &e)) {
+        h[0] = e;
+        sift_down(h, k, 0);
+    }
+}
+
+/* Heap sort in place: repeatedly move the smallest to the end, which
+ * leaves the array largest first */
+static void heap_drain(topk_entry_t *h, int n) {
+    for (int end = n - 1; end > 0; end--) {
+        topk_entry_t t = h[0];
+        h[0] = h[end];
+        h[end] = t;
+        sift_down(h, end, 0);
+    }
+}
+
+void select_top_consumers(fingerprint_t *fp) {
+    process_topk_t *t = &fp->topk;
+    memset(t, 0, sizeof(*t));
+    t->k = g_topk;
+    if (t->k <= 0) return;
+
+    for (int i = 0; i < fp->process_count; i++) {
+        const process_info_t *p = &fp->processes[i];
+        if (p->state == 'Z') continue;      /* Nothing left to consume */
+
+        double v[TOPK_METRIC_COUNT] = {
+            [TOPK_RSS]     = (double)p->rss_bytes,
+            [TOPK_CPU]     = p->cpu_percent,
+            [TOPK_FDS]     = p->open_fd_count < PROC_FD_SANE_MAX ? p->open_fd_count : 0,
+            [TOPK_THREADS] = p->thread_count,
+            [TOPK_IO]      = p->io_bytes_per_sec,
+        };
+        for (int m = 0; m < TOPK_METRIC_COUNT; m++) {
+            if (v[m] > 0) heap_offer(t->entries[m], &t->count[m], t->k, i, v[m]);
+        }
+    }
+
+    for (int m = 0; m < TOPK_METRIC_COUNT; m++) {
+        heap_drain(t->entries[m], t->count[m]);
+    }
+}
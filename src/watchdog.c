@@ -0,0 +1,450 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * watchdog.c - Deadline enforcement for probe stages
+ *
+ * Reads from /proc can block indefinitely when the target process is
+ * stuck in the kernel (D state, hung NFS, wedged FUSE mount). A blocked
+ * read cannot be interrupted, so the only way to keep the probe cycle on
+ * time is to do the work on a worker thread and walk away from it.
+ *
+ * Each stage runs on a worker. The calling thread waits with a timeout,
+ * watching both the stage as a whole and the item currently in flight.
+ * When an item overruns, the worker is abandoned (detached, left to finish
+ * whenever the kernel lets it) and a fresh worker resumes at the next item.
+ * Abandoned workers never write into the caller's data: all results go
+ * through a heap-allocated job that is reference counted and generation
+ * stamped, so a late worker simply discards what it produced.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+
+#include "sentinel.h"
+
+/* How often the watchdog wakes up to check the item in flight */
+#define WATCHDOG_TICK_MS 10
+
+/* Stop spawning replacement workers once this many are stuck */
+#define MAX_STUCK_WORKERS 16
+
+/* Items whose last read is still blocked - skipped until it returns */
+#define MAX_QUARANTINE 64
+
+/* Item status in a batch job */
+#define ITEM_PENDING     0
+#define ITEM_OK          1
+#define ITEM_SKIPPED     2     /* item_fn returned non-zero (process exited, etc.) */
+#define ITEM_TIMEOUT     3
+#define ITEM_QUARANTINED 4
+
+static int g_stage_deadline_ms = PROBE_STAGE_DEADLINE_MS;
+static int g_item_deadline_ms = PROBE_ITEM_DEADLINE_MS;
+
+/* Shared between all jobs: stuck worker accounting and quarantine */
+static pthread_mutex_t g_wd_lock = PTHREAD_MUTEX_INITIALIZER;
+static int g_stuck_workers = 0;
+
+typedef struct {
+    char stage[16];
+    int key;
+} quarantine_entry_t;
+
+static quarantine_entry_t g_quarantine[MAX_QUARANTINE];
+static int g_quarantine_count = 0;
+
+/* ============================================================
+ * Helpers
+ * ============================================================ */
+
+double watchdog_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+void watchdog_set_deadlines(int stage_ms, int item_ms) {
+    if (stage_ms > 0) g_stage_deadline_ms = stage_ms;
+    if (item_ms > 0) g_item_deadline_ms = item_ms;
+    if (g_item_deadline_ms > g_stage_deadline_ms) {
+        g_item_deadline_ms = g_stage_deadline_ms;
+    }
+}
+
+int watchdog_item_deadline_ms(void) {
+    return g_item_deadline_ms;
+}
+
+void probe_error_add(fingerprint_t *fp, const char *stage, int item,
+                     double elapsed_ms, const char *reason) {
+    fp->probe_errors++;
+    if (fp->error_log_count >= MAX_PROBE_ERRORS) return;
+
+    probe_error_t *e = &fp->error_log[fp->error_log_count++];
+    snprintf(e->stage, sizeof(e->stage), "%s", stage);
+    snprintf(e->reason, sizeof(e->reason), "%s", reason);
+    e->item = item;
+    e->elapsed_ms = elapsed_ms;
+}
+
+/* Absolute CLOCK_REALTIME deadline for pthread_cond_timedwait */
+static void deadline_in(struct timespec *ts, int ms) {
+    clock_gettime(CLOCK_REALTIME, ts);
+    ts->tv_sec += ms / 1000;
+    ts->tv_nsec += (long)(ms % 1000) * 1000000L;
+    if (ts->tv_nsec >= 1000000000L) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000L;
+    }
+}
+
+/* Caller holds g_wd_lock */
+static int quarantine_find(const char *stage, int key) {
+    for (int i = 0; i < g_quarantine_count; i++) {
+        if (g_quarantine[i].key == key &&
+            strcmp(g_quarantine[i].stage, stage) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void quarantine_add(const char *stage, int key) {
+    pthread_mutex_lock(&g_wd_lock);
+    if (quarantine_find(stage, key) < 0 && g_quarantine_count < MAX_QUARANTINE) {
+        quarantine_entry_t *q = &g_quarantine[g_quarantine_count++];
+        snprintf(q->stage, sizeof(q->stage), "%s", stage);
+        q->key = key;
+    }
+    pthread_mutex_unlock(&g_wd_lock);
+}
+
+static void quarantine_remove(const char *stage, int key) {
+    pthread_mutex_lock(&g_wd_lock);
+    int i = quarantine_find(stage, key);
+    if (i >= 0) {
+        g_quarantine[i] = g_quarantine[--g_quarantine_count];
+    }
+    pthread_mutex_unlock(&g_wd_lock);
+}
+
+static int quarantine_contains(const char *stage, int key) {
+    pthread_mutex_lock(&g_wd_lock);
+    int found = quarantine_find(stage, key) >= 0;
+    pthread_mutex_unlock(&g_wd_lock);
+    return found;
+}
+
+/* ============================================================
+ * Job - shared between the watchdog and its workers
+ * ============================================================ */
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int refs;                   /* Watchdog + live workers */
+    unsigned generation;        /* Bumped whenever a worker is abandoned */
+    int finished;               /* Set by the current-generation worker */
+    int closed;                 /* Watchdog has stopped listening */
+
+    char stage[16];
+    probe_item_fn item_fn;
+    const void *ctx;
+    size_t out_size;
+    int count;
+    int *keys;
+    unsigned char *outputs;
+    unsigned char *status;
+
+    int next;                   /* Next item to start */
+    int current;                /* Item in flight, -1 if none */
+    double item_started_ms;
+} watchdog_job_t;
+
+typedef struct {
+    watchdog_job_t *job;
+    unsigned generation;
+} worker_arg_t;
+
+static void job_release(watchdog_job_t *job) {
+    pthread_mutex_lock(&job->lock);
+    int refs = --job->refs;
+    pthread_mutex_unlock(&job->lock);
+
+    if (refs > 0) return;
+
+    pthread_cond_destroy(&job->cond);
+    pthread_mutex_destroy(&job->lock);
+    free(job->keys);
+    free(job->outputs);
+    free(job->status);
+    free(job);
+}
+
+static void *worker_main(void *arg) {
+    worker_arg_t wa = *(worker_arg_t *)arg;
+    watchdog_job_t *job = wa.job;
+    free(arg);
+
+    void *scratch = calloc(1, job->out_size);
+
+    pthread_mutex_lock(&job->lock);
+    while (scratch && job->generation == wa.generation && job->next < job->count) {
+        int i = job->next++;
+        int key = job->keys[i];
+
+        if (quarantine_contains(job->stage, key)) {
+            job->status[i] = ITEM_QUARANTINED;
+            continue;
+        }
+
+        job->current = i;
+        job->item_started_ms = watchdog_now_ms();
+        pthread_mutex_unlock(&job->lock);
+
+        memset(scratch, 0, job->out_size);
+        arena_bind_thread(probe_arena());
+        int rc = job->item_fn(job->ctx, key, scratch);
+
+        pthread_mutex_lock(&job->lock);
+        if (job->generation != wa.generation) {
+            /* We were abandoned while blocked on this item */
+            pthread_mutex_unlock(&job->lock);
+            quarantine_remove(job->stage, key);
+            pthread_mutex_lock(&g_wd_lock);
+            g_stuck_workers--;
+            pthread_mutex_unlock(&g_wd_lock);
+            arena_straggler_done(probe_arena());
+            pthread_mutex_lock(&job->lock);
+            break;
+        }
+        if (rc == 0) {
+            memcpy(job->outputs + (size_t)i * job->out_size, scratch, job->out_size);
+            job->status[i] = ITEM_OK;
+        } else {
+            job->status[i] = ITEM_SKIPPED;
+        }
+        job->current = -1;
+    }
+
+    if (job->generation == wa.generation) {
+        job->finished = 1;
+        pthread_cond_signal(&job->cond);
+    }
+    pthread_mutex_unlock(&job->lock);
+
+    free(scratch);
+    job_release(job);
+    return NULL;
+}
+
+/* Caller holds job->lock */
+static int spawn_worker(watchdog_job_t *job) {
+    worker_arg_t *wa = malloc(sizeof(*wa));
+    if (!wa) return -1;
+    wa->job = job;
+    wa->generation = job->generation;
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    pthread_t tid;
+    job->refs++;
+    int rc = pthread_create(&tid, &attr, worker_main, wa);
+    pthread_attr_destroy(&attr);
+
+    if (rc != 0) {
+        job->refs--;
+        free(wa);
+        return -1;
+    }
+    return 0;
+}
+
+/* ============================================================
+ * Public API
+ * ============================================================ */
+
+static int run_items(fingerprint_t *fp, const char *stage,
+                     probe_item_fn item_fn, const void *ctx,
+                     const int *keys, int count,
+                     void *outputs, size_t out_size, int *kept,
+                     int item_deadline_ms) {
+    if (!fp || !item_fn || !outputs || !kept) return -1;
+    *kept = 0;
+    if (count <= 0) return 0;
+
+    watchdog_job_t *job = calloc(1, sizeof(*job));
+    if (!job) return -1;
+
+    job->keys = malloc((size_t)count * sizeof(int));
+    job->outputs = calloc((size_t)count, out_size);
+    job->status = calloc((size_t)count, 1);
+    if (!job->keys || !job->outputs || !job->status) {
+        free(job->keys);
+        free(job->outputs);
+        free(job->status);
+        free(job);
+        return -1;
+    }
+
+    memcpy(job->keys, keys, (size_t)count * sizeof(int));
+    snprintf(job->stage, sizeof(job->stage), "%s", stage);
+    job->item_fn = item_fn;
+    job->ctx = ctx;
+    job->out_size = out_size;
+    job->count = count;
+    job->current = -1;
+    job->refs = 1;
+    pthread_mutex_init(&job->lock, NULL);
+    pthread_cond_init(&job->cond, NULL);
+
+    double stage_start = watchdog_now_ms();
+    int result = 0;
+
+    pthread_mutex_lock(&job->lock);
+
+    if (spawn_worker(job) != 0) {
+        /* No threads available - run inline, without protection */
+        pthread_mutex_unlock(&job->lock);
+        for (int i = 0; i < count; i++) {
+            if (item_fn(ctx, keys[i], job->outputs + (size_t)i * out_size) == 0) {
+                job->status[i] = ITEM_OK;
+            }
+        }
+        pthread_mutex_lock(&job->lock);
+        job->finished = 1;
+    }
+
+    while (!job->finished) {
+        struct timespec ts;
+        deadline_in(&ts, WATCHDOG_TICK_MS);
+        pthread_cond_timedwait(&job->cond, &job->lock, &ts);
+        if (job->finished) break;
+
+        double now = watchdog_now_ms();
+
+        if (now - stage_start > g_stage_deadline_ms) {
+            char reason[96];
+            snprintf(reason, sizeof(reason),
+                     "stage deadline (%d ms) exceeded, %d of %d items done",
+                     g_stage_deadline_ms, job->next, count);
+            if (job->current >= 0) {
+                job->status[job->current] = ITEM_TIMEOUT;
+                quarantine_add(stage, job->keys[job->current]);
+                pthread_mutex_lock(&g_wd_lock);
+                g_stuck_workers++;
+                pthread_mutex_unlock(&g_wd_lock);
+                arena_taint(probe_arena());
+            }
+            probe_error_add(fp, stage, -1, now - stage_start, reason);
+            job->generation++;
+            result = -1;
+            break;
+        }
+
+        if (job->current >= 0 && now - job->item_started_ms > item_deadline_ms) {
+            int i = job->current;
+            char reason[96];
+            snprintf(reason, sizeof(reason),
+                     "item deadline (%d ms) exceeded, abandoned", item_deadline_ms);
+            probe_error_add(fp, stage, job->keys[i], now - job->item_started_ms, reason);
+
+            job->status[i] = ITEM_TIMEOUT;
+            job->current = -1;
+            job->generation++;
+            quarantine_add(stage, job->keys[i]);
+
+            pthread_mutex_lock(&g_wd_lock);
+            int stuck = ++g_stuck_workers;
+            pthread_mutex_unlock(&g_wd_lock);
+            arena_taint(probe_arena());
+
+            if (stuck > MAX_STUCK_WORKERS || spawn_worker(job) != 0) {
+                probe_error_add(fp, stage, -1, now - stage_start,
+                                "too many stuck workers, stage cut short");
+                result = -1;
+                break;
+            }
+        }
+    }
+
+    /* Collect results in input order */
+    unsigned char *dst = outputs;
+    for (int i = 0; i < count; i++) {
+        if (job->status[i] == ITEM_OK) {
+            memcpy(dst + (size_t)(*kept) * out_size,
+                   job->outputs + (size_t)i * out_size, out_size);
+            (*kept)++;
+        } else if (job->status[i] == ITEM_QUARANTINED) {
+            probe_error_add(fp, stage, job->keys[i], 0,
+                            "skipped, previous read still blocked");
+        }
+    }
+
+    job->closed = 1;
+    pthread_mutex_unlock(&job->lock);
+    job_release(job);
+
+    return result;
+}
+
+int watchdog_run_items(fingerprint_t *fp, const char *stage,
+                       probe_item_fn item_fn, const void *ctx,
+                       const int *keys, int count,
+                       void *outputs, size_t out_size, int *kept) {
+    return run_items(fp, stage, item_fn, ctx, keys, count,
+                     outputs, out_size, kept, g_item_deadline_ms);
+}
+
+/* Adapter so a whole stage can run as a one-item batch */
+typedef struct {
+    probe_stage_fn fn;
+    void *arg;
+} stage_ctx_t;
+
+static int run_stage_item(const void *ctx, int key, void *out) {
+    (void)key;
+    const stage_ctx_t *sc = ctx;
+    return sc->fn(sc->arg, out);
+}
+
+int watchdog_run_stage(fingerprint_t *fp, const char *stage,
+                       probe_stage_fn fn, void *arg,
+                       void *out, size_t out_size) {
+    /* The adapter context lives on the heap: an abandoned worker may
+     * still dereference it after we return. It is leaked in that case,
+     * which is bounded by MAX_STUCK_WORKERS. */
+    stage_ctx_t *sc = malloc(sizeof(*sc));
+    if (!sc) return -1;
+    sc->fn = fn;
+    sc->arg = arg;
+
+    int key = 0;
+    int kept = 0;
+
+    /* A single-item stage is bounded by the stage deadline only */
+    int rc = run_items(fp, stage, run_stage_item, sc, &key, 1,
+                       out, out_size, &kept, g_stage_deadline_ms + 1);
+
+    if (rc == 0) {
+        free(sc);
+    }
+    if (rc == 0 && kept == 0) {
+        probe_error_add(fp, stage, -1, 0, "stage failed");
+        return -1;
+    }
+    return rc;
+}
@@ -0,0 +1,262 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * zombie.c - Attribute zombies to their parents and time the reaping
+ *
+ * A zombie is harmless; a parent that never calls wait() is the bug.
+ * Each cycle groups the snapshot's zombies by ppid, so one leaky parent
+ * with 500 children is one row rather than 500. Each zombie's first
+ * sighting is carried across cycles (static tables sorted by pid, plus
+ * ~/.sentinel/zombies.dat for --keep-state runs), which gives its age now
+ * and, once it is gone, how long its parent took to reap it.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sentinel.h"
+
+#define ZOMBIE_STATE_FILENAME "zombies.dat"
+#define ZOMBIE_STATE_MAGIC "SNTLZB02"
+
+typedef struct {
+    pid_t pid;
+    pid_t ppid;
+    uint64_t start_ticks;
+    double first_seen;          /* Boot time of the first sighting */
+    double last_seen;
+    int carried;                /* Scratch: still a zombie this cycle */
+} zombie_entry_t;
+
+/* One zombie (or one reap) to fold into its parent's row */
+typedef struct {
+    pid_t ppid;
+    double age;                 /* Seconds since first seen */
+    int reaped;
+} zombie_event_t;
+
+static zombie_entry_t g_tables[2][ZOMBIE_TRACK_MAX];
+static int g_counts[2];
+static int g_prev = 0;
+static int g_loaded = 0;
+
+static int cmp_entry(const void *a, const void *b) {
+    pid_t x = ((const zombie_entry_t *)a)->pid;
+    pid_t y = ((const zombie_entry_t *)b)->pid;
+    return (x > y) - (x < y);
+}
+
+static int cmp_event(const void *a, const void *b) {
+    pid_t x = ((const zombie_event_t *)a)->ppid;
+    pid_t y = ((const zombie_event_t *)b)->ppid;
+    return (x > y) - (x < y);
+}
+
+/* Most zombies first, then the longest wait */
+static int parent_ranks_above(const zombie_parent_t *a, const zombie_parent_t *b) {
+    if (a->zombies != b->zombies) return a->zombies > b->zombies;
+    return a->oldest_seconds > b->oldest_seconds;
+}
+
+/* ============================================================
+ * State File
+ * ============================================================ */
+
+static void load_state(void) {
+    char path[512];
+    if (pfs_active() || probe_state_path(ZOMBIE_STATE_FILENAME, path, sizeof(path)) != 0) return;
+
+    FILE *f = fopen(path, "rb");
+    if (!f) return;
+
+    char magic[8];
+    int count = 0;
+    if (fread(magic, sizeof(magic), 1, f) == 1 &&
+        memcmp(magic, ZOMBIE_STATE_MAGIC, 8) == 0 &&
+        fread(&count, sizeof(count), 1, f) == 1 &&
+        count >= 0 && count <= ZOMBIE_TRACK_MAX &&
+        fread(g_tables[g_prev], sizeof(zombie_entry_t), (size_t)count, f) == (size_t)count) {
+        g_counts[g_prev] = count;
+    }
+    fclose(f);
+}
+
+static void save_state(const zombie_entry_t *entries, int count) {
+    char path[512];
+    if (pfs_active() || probe_state_path(ZOMBIE_STATE_FILENAME, path, sizeof(path)) != 0) return;
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return;
+    fwrite(ZOMBIE_STATE_MAGIC, 8, 1, f);
+    fwrite(&count, sizeof(count), 1, f);
+    fwrite(entries, sizeof(zombie_entry_t), (size_t)count, f);
+    fclose(f);
+}
+
+/* ============================================================
+ * Parents
+ * ============================================================ */
+
+/* Interned name of a parent: from the snapshot if it is there (it
+ * usually is - a zombie's parent is alive by definition), else comm */
+static str_id_t parent_name(const fingerprint_t *fp, pid_t ppid) {
+    for (int i = 0; i < fp->process_count; i++) {
+        if (fp->processes[i].pid == ppid) return fp->processes[i].name;
+    }
+
+    strtab_t *strings = strtab_snapshot();
+    char path[64];
+    char name[256];
+    snprintf(path, sizeof(path), "/proc/%d/comm", ppid);
+    FILE *f = pfs_fopen(path);
+    if (!f) return strtab_intern(strings, "[unknown]");
+
+    str_id_t id = STR_EMPTY;
+    if (fgets(name, sizeof(name), f)) {
+        name[strcspn(name, "\n")] = '\0';
+        id = strtab_intern(strings, name);
+    }
+    fclose(f);
+    return id;
+}
+
+/* Keep the ZOMBIE_PARENT_MAX worst parents, worst first */
+static void report_add(zombie_report_t *r, const zombie_parent_t *p) {
+    int slot = r->count;
+    while (slot > 0 && parent_ranks_above(p, &r->parents[slot - 1])) slot--;
+    if (slot >= ZOMBIE_PARENT_MAX) return;
+
+    int last = r->count < ZOMBIE_PARENT_MAX ? r->count : ZOMBIE_PARENT_MAX - 1;
+    memmove(&r->parents[slot + 1], &r->parents[slot],
+            (size_t)(last - slot) * sizeof(zombie_parent_t));
+    if (r->count < ZOMBIE_PARENT_MAX) r->count++;
+    r->parents[slot] = *p;
+}
+
+/* Group the events by ppid into one row per parent */
+static void aggregate_parents(fingerprint_t *fp, zombie_event_t *events, int n) {
+    zombie_report_t *r = &fp->zombies;
+    double reap_sum = 0;
+
+    qsort(events, n, sizeof(*events), cmp_event);
+    for (int i = 0; i < n; ) {
+        zombie_parent_t p = { .ppid = events[i].ppid };
+        double parent_reap_sum = 0;
+
+        for (; i < n && events[i].ppid == p.ppid; i++) {
+            const zombie_event_t *e = &events[i];
+            if (e->reaped) {
+                p.reaped++;
+                parent_reap_sum += e->age;
+                if (e->age > p.reap_max_seconds) p.reap_max_seconds = e->age;
+            } else {
+                p.zombies++;
+                if (e->age > p.oldest_seconds) p.oldest_seconds = e->age;
+            }
+        }
+        if (p.reaped) p.reap_mean_seconds = parent_reap_sum / p.reaped;
+
+        r->reaped += p.reaped;
+        reap_sum += parent_reap_sum;
+        if (p.reap_max_seconds > r->reap_max_seconds) r->reap_max_seconds = p.reap_max_seconds;
+        if (p.zombies) r->parent_count++;
+        report_add(r, &p);
+    }
+    if (r->reaped) r->reap_mean_seconds = reap_sum / r->reaped;
+
+    /* Names only for the rows that are reported */
+    for (int i = 0; i < r->count; i++) {
+        r->parents[i].name = parent_name(fp, r->parents[i].ppid);
+    }
+}
+
+/* ============================================================
+ * Update
+ * ============================================================ */
+
+/* The pid is still this zombie: in /proc, still 'Z', and started when
+ * it did. A reaped zombie's pid can be handed to a new process before
+ * the next cycle; that one is not the zombie. */
+static int still_zombie(const zombie_entry_t *e) {
+    process_info_t p;
+    if (probe_process_stat(e->pid, &p) != 0) return 0;
+    return p.state == 'Z' && p.start_ticks == e->start_ticks;
+}
+
+void zombie_track_update(fingerprint_t *fp) {
+    if (!g_loaded) {
+        load_state();
+        g_loaded = 1;
+    }
+
+    memset(&fp->zombies, 0, sizeof(fp->zombies));
+
+    /* An empty snapshot means the listing failed, not that every
+     * zombie was reaped at once */
+    if (fp->process_count == 0) return;
+
+    zombie_entry_t *prev = g_tables[g_prev];
+    int prev_count = g_counts[g_prev];
+    zombie_entry_t *cur = g_tables[1 - g_prev];
+    int n = 0;
+    double now = boottime_seconds();
+
+    zombie_event_t *events = arena_alloc(probe_arena(),
+        (size_t)(fp->process_count + prev_count + 1) * sizeof(*events));
+    if (!events) return;
+    int event_count = 0;
+
+    for (int i = 0; i < prev_count; i++) prev[i].carried = 0;
+
+    for (int i = 0; i < fp->process_count; i++) {
+        const process_info_t *p = &fp->processes[i];
+        if (p->state != 'Z') continue;
+        fp->zombies.zombies++;
+
+        zombie_entry_t key = { .pid = p->pid };
+        zombie_entry_t *old = bsearch(&key, prev, prev_count, sizeof(key), cmp_entry);
+        zombie_entry_t e = { .pid = p->pid, .ppid = p->ppid, .start_ticks = p->start_ticks,
+                             .first_seen = now };
+
+        if (old && old->start_ticks == p->start_ticks && now >= old->last_seen) {
+            old->carried = 1;
+            e.first_seen = old->first_seen;
+        }
+        e.last_seen = now;
+        if (n < ZOMBIE_TRACK_MAX) cur[n++] = e;
+
+        events[event_count++] = (zombie_event_t){ p->ppid, now - e.first_seen, 0 };
+    }
+
+    /* Zombies from last time that are gone were reaped somewhere between
+     * their last sighting and now; count the midpoint. One missing from
+     * the snapshot but still in /proc (a capped sampling cycle, a
+     * quarantined pid) is kept as it is. */
+    for (int i = 0; i < prev_count; i++) {
+        const zombie_entry_t *e = &prev[i];
+        if (e->carried || now < e->last_seen) continue;
+        if (still_zombie(e)) {
+            if (n < ZOMBIE_TRACK_MAX) cur[n++] = *e;
+            continue;
+        }
+        double reaped_at = (e->last_seen + now) / 2;
+        events[event_count++] = (zombie_event_t){ e->ppid, reaped_at - e->first_seen, 1 };
+    }
+
+    aggregate_parents(fp, events, event_count);
+
+    qsort(cur, n, sizeof(*cur), cmp_entry);
+    g_counts[1 - g_prev] = n;
+    g_prev = 1 - g_prev;
+
+    save_state(cur, n);
+}
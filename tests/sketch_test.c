@@ -0,0 +1,93 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * sketch_test.c - Checks on the auth failure sketches (make test)
+ *
+ * Feeds auth_sketch_add a known stream and checks what
+ * auth_sketch_report makes of it: the count-min estimate of a heavy
+ * source, the linear-counting distinct totals, the burst and spray
+ * flags, and the window sliding past old buckets. State is not kept,
+ * so nothing is read from or written to ~/.sentinel.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/audit.h"
+
+static int failures = 0;
+
+static void check(int ok, const char *what) {
+    if (!ok) {
+        fprintf(stderr, "   sketch: %s\n", what);
+        failures++;
+    }
+}
+
+static int within(int value, int expect, int percent) {
+    int slack = expect * percent / 100;
+    return value >= expect - slack && value <= expect + slack;
+}
+
+int main(void) {
+    static auth_sketch_t sketch;
+    static audit_summary_t summary;
+    char source[32], user[32];
+    time_t now = 1700000000;
+    int64_t ms = (int64_t)now * 1000;
+    uint32_t serial = 1;
+
+    auth_sketch_load(&sketch);
+
+    /* One noisy source: a burst, and never under-counted */
+    for (int i = 0; i < AUTH_BURST_FAILURES + 2; i++) {
+        auth_sketch_add(&sketch, ms, serial++, "10.0.0.1", "root");
+    }
+    /* The same records again, as an overlapping probe window reads them */
+    serial = 1;
+    for (int i = 0; i < AUTH_BURST_FAILURES + 2; i++) {
+        auth_sketch_add(&sketch, ms, serial++, "10.0.0.1", "root");
+    }
+
+    auth_sketch_report(&sketch, now, &summary);
+    check(summary.window_failures == AUTH_BURST_FAILURES + 2, "overlapping records counted twice");
+    check(summary.top_source_count == 1 && strcmp(summary.top_sources[0].key, "10.0.0.1") == 0,
+          "heavy source not reported");
+    check(summary.top_sources[0].window == AUTH_BURST_FAILURES + 2, "heavy source estimate wrong");
+    check(summary.source_burst, "burst not flagged");
+    check(!summary.distributed_spray, "spray flagged for one source");
+
+    /* Then a spray: 200 sources and users, one attempt each */
+    for (int i = 0; i < 200; i++) {
+        snprintf(source, sizeof(source), "192.168.%d.%d", i / 250, i % 250 + 1);
+        snprintf(user, sizeof(user), "user%d", i);
+        auth_sketch_add(&sketch, ms + 1, serial++, source, user);
+    }
+
+    auth_sketch_report(&sketch, now, &summary);
+    check(within(summary.failure_sources, 201, 10), "distinct sources off by more than 10%");
+    check(within(summary.window_users, 201, 10), "distinct users off by more than 10%");
+    check(summary.distributed_spray, "spray not flagged");
+    check(strcmp(summary.top_sources[0].key, "10.0.0.1") == 0 &&
+          summary.top_sources[0].window >= AUTH_BURST_FAILURES + 2,
+          "heavy source lost among the spray");
+
+    /* Two buckets on, the burst is over but the window still holds it */
+    auth_sketch_report(&sketch, now + 2 * AUTH_BUCKET_SECONDS, &summary);
+    check(!summary.source_burst, "burst outlived two buckets");
+    check(summary.window_failures == AUTH_BURST_FAILURES + 2 + 200, "window lost failures");
+
+    /* A whole window on, nothing is left */
+    auth_sketch_report(&sketch, now + AUTH_BUCKETS * AUTH_BUCKET_SECONDS, &summary);
+    check(summary.window_failures == 0 && summary.failure_sources == 0, "window did not slide");
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
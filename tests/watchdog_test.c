@@ -0,0 +1,109 @@
+/*
+ * C-Sentinel - Semantic Observability for UNIX Systems
+ * Copyright (c) 2025 William Murray
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file for details.
+ *
+ * https://github.com/williamofai/c-sentinel
+ *
+ * watchdog_test.c - Checks on the probe watchdog (make test)
+ *
+ * One item of a batch blocks in read() on a pipe nobody writes to, as
+ * a read of a wedged /proc file would. The batch must finish soon
+ * after the item deadline with the other items kept and the stuck one
+ * in fp->error_log; a second batch must skip the quarantined key
+ * without waiting; and a stage that blocks must be cut off at the
+ * stage deadline.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../include/sentinel.h"
+
+#define ITEM_MS     100
+#define STAGE_MS    400
+#define STUCK_KEY   3
+
+static int g_pipe[2];
+static int failures = 0;
+
+static void check(int ok, const char *what) {
+    if (!ok) {
+        fprintf(stderr, "   watchdog: %s\n", what);
+        failures++;
+    }
+}
+
+static int probe_item(const void *ctx, int key, void *out) {
+    (void)ctx;
+    if (key == STUCK_KEY) {
+        char c;
+        if (read(g_pipe[0], &c, 1) < 0) return -1;
+    }
+    *(int *)out = key * 10;
+    return 0;
+}
+
+static int probe_stage(void *arg, void *out) {
+    (void)arg;
+    char c;
+    if (read(g_pipe[0], &c, 1) < 0) return -1;
+    *(int *)out = 1;
+    return 0;
+}
+
+static int error_for(const fingerprint_t *fp, int item, const char *reason) {
+    for (int i = 0; i < fp->error_log_count; i++) {
+        const probe_error_t *e = &fp->error_log[i];
+        if (e->item == item && strstr(e->reason, reason)) return 1;
+    }
+    return 0;
+}
+
+int main(void) {
+    static fingerprint_t fp;
+    const int keys[] = { 1, 2, STUCK_KEY, 4, 5 };
+    int outputs[5], kept;
+
+    if (pipe(g_pipe) != 0) return EXIT_FAILURE;
+    watchdog_set_deadlines(STAGE_MS, ITEM_MS);
+
+    /* A stuck item is abandoned and the rest of the batch still runs */
+    double start = watchdog_now_ms();
+    int rc = watchdog_run_items(&fp, "items", probe_item, NULL, keys, 5,
+                                outputs, sizeof(int), &kept);
+    double took = watchdog_now_ms() - start;
+    check(rc == 0, "batch with a stuck item failed");
+    check(kept == 4 && outputs[0] == 10 && outputs[2] == 40 && outputs[3] == 50,
+          "items around the stuck one not kept in order");
+    check(fp.probe_errors == 1 && error_for(&fp, STUCK_KEY, "item deadline"),
+          "stuck item not in the error log");
+    check(took < ITEM_MS + 200, "batch not finished soon after the item deadline");
+
+    /* Its read is still blocked, so the next batch skips it outright */
+    memset(&fp, 0, sizeof(fp));
+    start = watchdog_now_ms();
+    rc = watchdog_run_items(&fp, "items", probe_item, NULL, keys, 5,
+                            outputs, sizeof(int), &kept);
+    took = watchdog_now_ms() - start;
+    check(rc == 0 && kept == 4, "second batch lost items");
+    check(error_for(&fp, STUCK_KEY, "still blocked"), "quarantined item not skipped");
+    check(took < ITEM_MS, "second batch waited on the quarantined item");
+
+    /* A whole stage that blocks is bounded by the stage deadline */
+    memset(&fp, 0, sizeof(fp));
+    int out = 0;
+    start = watchdog_now_ms();
+    rc = watchdog_run_stage(&fp, "stage", probe_stage, NULL, &out, sizeof(out));
+    took = watchdog_now_ms() - start;
+    check(rc != 0 && out == 0, "stuck stage reported success");
+    check(error_for(&fp, -1, "stage deadline"), "stuck stage not in the error log");
+    check(took < STAGE_MS + 200, "stage not cut off at its deadline");
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}